@@ -36,20 +36,30 @@ EXPERIMENTS = {
     },
     "off": {
         "core_end2end_test": [
+            "callback_run_to_completion",
+            "event_engine_executor",
             "promise_based_client_call",
         ],
         "endpoint_test": [
             "tcp_frame_size_tuning",
             "tcp_rcv_lowat",
+            "tcp_release_idle_read_buffers",
         ],
         "event_engine_client_test": [
             "event_engine_client",
         ],
+        "event_engine_timer_test": [
+            "event_engine_timer_wheel",
+        ],
+        "event_poller_test": [
+            "event_engine_io_uring_poller",
+        ],
         "flow_control_test": [
             "flow_control_fixes",
             "peer_state_based_framing",
             "tcp_frame_size_tuning",
             "tcp_rcv_lowat",
+            "tcp_release_idle_read_buffers",
         ],
         "lame_client_test": [
             "promise_based_client_call",
@@ -394,6 +394,7 @@
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+        'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
         'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
         'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
         'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -401,6 +402,7 @@
         'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
         'src/core/ext/filters/client_channel/lb_policy/rls/rls.cc',
         'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
+        'src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.cc',
         'src/core/ext/filters/client_channel/lb_policy/weighted_target/weighted_target.cc',
         'src/core/ext/filters/client_channel/lb_policy/xds/cds.cc',
         'src/core/ext/filters/client_channel/lb_policy/xds/xds_attributes.cc',
@@ -417,6 +419,7 @@
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
         'src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.cc',
+        'src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.cc',
         'src/core/ext/filters/client_channel/resolver/dns/native/dns_resolver.cc',
         'src/core/ext/filters/client_channel/resolver/fake/fake_resolver.cc',
         'src/core/ext/filters/client_channel/resolver/google_c2p/google_c2p_resolver.cc',
@@ -809,6 +812,7 @@
         'src/core/lib/event_engine/forkable.cc',
         'src/core/lib/event_engine/memory_allocator.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -817,6 +821,7 @@
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.cc',
@@ -830,6 +835,7 @@
         'src/core/lib/event_engine/windows/iocp.cc',
         'src/core/lib/event_engine/windows/win_socket.cc',
         'src/core/lib/event_engine/windows/windows_engine.cc',
+        'src/core/lib/event_engine/work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gprpp/status_helper.cc',
@@ -999,6 +1005,7 @@
         'src/core/lib/service_config/service_config_parser.cc',
         'src/core/lib/slice/b64.cc',
         'src/core/lib/slice/percent_encoding.cc',
+        'src/core/lib/slice/slab_allocator.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
         'src/core/lib/slice/slice_string_helpers.cc',
@@ -1157,6 +1164,7 @@
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+        'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
         'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
         'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
         'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -1164,6 +1172,7 @@
         'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
         'src/core/ext/filters/client_channel/lb_policy/rls/rls.cc',
         'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
+        'src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.cc',
         'src/core/ext/filters/client_channel/lb_policy/weighted_target/weighted_target.cc',
         'src/core/ext/filters/client_channel/local_subchannel_pool.cc',
         'src/core/ext/filters/client_channel/resolver/binder/binder_resolver.cc',
@@ -1174,6 +1183,7 @@
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
         'src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.cc',
+        'src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.cc',
         'src/core/ext/filters/client_channel/resolver/dns/native/dns_resolver.cc',
         'src/core/ext/filters/client_channel/resolver/fake/fake_resolver.cc',
         'src/core/ext/filters/client_channel/resolver/polling_resolver.cc',
@@ -1271,6 +1281,7 @@
         'src/core/lib/event_engine/forkable.cc',
         'src/core/lib/event_engine/memory_allocator.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -1279,6 +1290,7 @@
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.cc',
@@ -1292,6 +1304,7 @@
         'src/core/lib/event_engine/windows/iocp.cc',
         'src/core/lib/event_engine/windows/win_socket.cc',
         'src/core/lib/event_engine/windows/windows_engine.cc',
+        'src/core/lib/event_engine/work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gprpp/status_helper.cc',
@@ -1428,6 +1441,7 @@
         'src/core/lib/service_config/service_config_parser.cc',
         'src/core/lib/slice/b64.cc',
         'src/core/lib/slice/percent_encoding.cc',
+        'src/core/lib/slice/slab_allocator.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
         'src/core/lib/slice/slice_string_helpers.cc',
@@ -124,6 +124,24 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Like grpc_completion_queue_next, but also returns the events already queued
+    behind the first one, up to max_events in all. This amortizes the cost of
+    the call over the events when many are ready at once.
+
+    Writes the events to events and returns how many were written. That is at
+    least 1, and only a returned event of type GRPC_OP_COMPLETE can be followed
+    by more events. max_events must be at least 1.
+
+    Only valid for completion queues of type GRPC_CQ_NEXT. Callers must not call
+    grpc_completion_queue_next_batch and grpc_completion_queue_pluck
+    simultaneously on the same completion queue. This function is
+    experimental. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -360,6 +378,13 @@ GRPCAPI grpc_call_error grpc_call_cancel_with_status(grpc_call* call,
  * an error (as opposed to a graceful end-of-stream) */
 GRPCAPI int grpc_call_failed_before_recv_message(const grpc_call* c);
 
+/** EXPERIMENTAL. Returns whether the message received by the last
+    GRPC_OP_RECV_MESSAGE on \a c, started with
+    GRPC_RECV_MESSAGE_ALLOW_PARTIAL, is only part of a message: the next
+    GRPC_OP_RECV_MESSAGE receives the part that follows it. Valid from the
+    completion of that op until the next GRPC_OP_RECV_MESSAGE is started. */
+GRPCAPI int grpc_call_recv_message_is_partial(const grpc_call* c);
+
 /** Ref a call.
     THREAD SAFETY: grpc_call_ref is thread-compatible */
 GRPCAPI void grpc_call_ref(grpc_call* call);
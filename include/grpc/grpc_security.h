@@ -887,6 +887,19 @@ GRPCAPI void grpc_tls_credentials_options_set_cert_request_type(
 GRPCAPI void grpc_tls_credentials_options_set_crl_directory(
     grpc_tls_credentials_options* options, const char* crl_directory);
 
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets how many verified peer certificate chains are remembered, so that
+ * handshakes with a peer that reconnects skip verifying its chain again.
+ * Entries expire with the chain and after at most an hour, and are dropped
+ * whenever the root certificates change. 0 (the default) disables the
+ * cache. The cache is not used when a CRL directory is set. Only supported
+ * for OpenSSL version >= 1.1.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_verification_cache_size(
+    grpc_tls_credentials_options* options, size_t verification_cache_size);
+
 /**
  * EXPERIMENTAL API - Subject to change
  *
@@ -88,7 +88,8 @@ GRPCAPI int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
 GRPCAPI int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
                                          grpc_slice** slice);
 
-/** Merge all data from \a reader into single slice */
+/** Merge all data from \a reader into single slice. If the buffer is a single
+    slice, returns a new reference to it rather than a copy. */
 GRPCAPI grpc_slice
 grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader);
 
@@ -145,6 +145,11 @@ typedef struct {
 /** Request that optional features default to off (regardless of what they
     usually default to) - to enable tight control over what gets enabled */
 #define GRPC_ARG_MINIMAL_STACK "grpc.minimal_stack"
+/** Experimental Arg. If non-zero, each run of adjacent promise based filters
+    in a channel stack is replaced by one filter that chains their promises,
+    so that calls convert between batches and promises once per run rather
+    than once per filter. Defaults to 0. */
+#define GRPC_ARG_FUSE_PROMISE_FILTERS "grpc.experimental.fuse_promise_filters"
 /** Maximum number of concurrent incoming streams to allow on a http2
     connection. Int valued. */
 #define GRPC_ARG_MAX_CONCURRENT_STREAMS "grpc.max_concurrent_streams"
@@ -167,6 +172,14 @@ typedef struct {
 /** Grace period after the channel reaches its max age. Int valued,
    milliseconds. INT_MAX means unlimited. */
 #define GRPC_ARG_MAX_CONNECTION_AGE_GRACE_MS "grpc.max_connection_age_grace_ms"
+/** Maximum number of connections per second that may be sent a GOAWAY for
+    having reached GRPC_ARG_MAX_CONNECTION_AGE_MS. Connections that reach
+    their max age faster than that wait for their turn, and the ones with
+    the fewest calls in progress go first. The limit is shared by all servers
+    in the process. Int valued; 0 (the default) means unlimited.
+    Experimental. */
+#define GRPC_ARG_MAX_CONNECTION_AGE_DRAINS_PER_SECOND \
+  "grpc.experimental.max_connection_age_drains_per_second"
 /** Timeout after the last RPC finishes on the client channel at which the
  * channel goes back into IDLE state. Int valued, milliseconds. INT_MAX means
  * unlimited. The default value is 30 minutes and the min value is 1 second. */
@@ -179,9 +192,27 @@ typedef struct {
    application will see the compressed message in the byte buffer. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION \
   "grpc.per_message_decompression"
+/** Experimental Arg. Int valued, from 1 (fastest) to 9 (smallest output).
+   The zlib level at which messages are compressed with deflate or gzip.
+   Defaults to zlib's own default, 6. Low levels compress several times
+   faster, which can matter more than the ratio on fast links. */
+#define GRPC_ARG_EXPERIMENTAL_ZLIB_COMPRESSION_LEVEL \
+  "grpc.experimental.zlib_compression_level"
+/** Experimental Arg. If non-zero, a stream whose messages keep compressing
+   poorly sends its next messages uncompressed, compressing one again now
+   and then to check whether that is still the case. Defaults to 0. */
+#define GRPC_ARG_EXPERIMENTAL_ADAPTIVE_COMPRESSION \
+  "grpc.experimental.adaptive_compression"
 /** Enable/disable support for deadline checking. Defaults to 1, unless
     GRPC_ARG_MINIMAL_STACK is enabled, in which case it defaults to 0 */
 #define GRPC_ARG_ENABLE_DEADLINE_CHECKS "grpc.enable_deadline_checking"
+/** Experimental Arg. Int valued, milliseconds. If set above 0, call deadlines
+    are rounded up to a multiple of this value, and the calls of a channel
+    whose deadlines round to the same time share one timer. This saves a timer
+    per call, but deadlines may be reported up to this much late. Defaults
+    to 0, which gives each call its own timer. */
+#define GRPC_ARG_DEADLINE_TIMER_GRANULARITY_MS \
+  "grpc.experimental.deadline_timer_granularity_ms"
 /** Initial stream ID for http2 transports. Int valued. */
 #define GRPC_ARG_HTTP2_INITIAL_SEQUENCE_NUMBER \
   "grpc.http2.initial_sequence_number"
@@ -196,12 +227,45 @@ typedef struct {
 /** How much memory to use for hpack encoding. Int valued, bytes. */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** If non-zero, custom metadata that the process keeps sending with the same
+    value (on any connection with this option) is added to the hpack table of
+    a connection the first time it is sent there, so later streams on the
+    connection send an index instead of the literal. Do not enable it when
+    untrusted callers choose metadata sent on a shared connection. Defaults to
+    off (0). */
+#define GRPC_ARG_HTTP2_HPACK_INDEX_HOT_METADATA \
+  "grpc.http2.hpack_index_hot_metadata"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. */
 #define GRPC_ARG_HTTP2_MAX_FRAME_SIZE "grpc.http2.max_frame_size"
 /** Should BDP probing be performed? */
 #define GRPC_ARG_HTTP2_BDP_PROBE "grpc.http2.bdp_probe"
+/** If non-zero, size the receive windows of a connection from a memory budget
+    of twice its measured BDP for every stream that is waiting for data,
+    rather than from process-wide memory pressure alone. This lets windows
+    grow past their defaults on high latency links and keeps them small on
+    local ones. Requires BDP probing. Defaults to off (0). */
+#define GRPC_ARG_HTTP2_BDP_MEMORY_BUDGET "grpc.http2.bdp_memory_budget"
+/** If positive, an idle transport waits up to this many microseconds (at
+    most 10000) before writing a message, so that messages other streams send
+    in the meantime share the write. Headers, trailers, pings and flow control
+    updates are written right away, and take held back messages with them.
+    The delay is rounded up to the resolution of the transport timers.
+    Defaults to 0 (off). */
+#define GRPC_ARG_HTTP2_WRITE_CORK_DELAY_US "grpc.http2.write_cork_delay_us"
+/** If non-zero on a server, each connection lowers the MAX_CONCURRENT_STREAMS
+    it advertises while the server's memory quota is under pressure, down to
+    a single stream, so that clients send new calls to other backends before
+    this one has to fail them. The configured limit is advertised again once
+    the pressure subsides. Defaults to off (0). */
+#define GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS \
+  "grpc.http2.adaptive_max_concurrent_streams"
+/** If non-zero, the transport asks the endpoint for the next bytes before it
+    parses the ones that just arrived, so that receiving (and decrypting) the
+    next read overlaps with parsing the current one. Costs at most one extra
+    read buffer per connection. Defaults to off (0). Experimental. */
+#define GRPC_ARG_HTTP2_PIPELINE_READS "grpc.experimental.http2_pipeline_reads"
 /** (DEPRECATED) Does not have any effect.
     Earlier, this arg configured the minimum time between successive ping frames
     without receiving any data/header frame, Int valued, milliseconds. This put
@@ -262,12 +326,77 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** If non-zero, subchannels in this process that connect to the same
+    address take turns: while one of them has a connection attempt in flight,
+    the others wait for its outcome instead of starting their own. If that
+    attempt fails, the waiting subchannels fail along with it and back off;
+    if it succeeds, they all connect right away. This avoids a reconnect
+    storm when a backend restarts, but should only be enabled when channels
+    to the same address use the same credentials. Defaults to 0.
+    Experimental. */
+#define GRPC_ARG_COORDINATE_RECONNECTS "grpc.experimental.coordinate_reconnects"
+/** The maximum number of connections a channel opens to each backend
+    address (default 1).  Connections beyond the first are opened while every
+    open connection carries GRPC_ARG_TARGET_STREAMS_PER_CONNECTION streams,
+    and closed again once the load fits on fewer connections.  Each call goes
+    to the connection with the fewest active streams.  Experimental. */
+#define GRPC_ARG_MAX_CONNECTIONS_PER_ADDRESS \
+  "grpc.experimental.max_connections_per_address"
+/** The number of active streams per connection at which a channel opens
+    another connection to the same address, if
+    GRPC_ARG_MAX_CONNECTIONS_PER_ADDRESS allows (default 100).  Set it at or
+    below the server's SETTINGS_MAX_CONCURRENT_STREAMS.  Experimental. */
+#define GRPC_ARG_TARGET_STREAMS_PER_CONNECTION \
+  "grpc.experimental.target_streams_per_connection"
+/** If non-zero, a channel that uses the global subchannel pool may send its
+    calls over an established connection that another channel opened to the
+    same address for a different authority, provided all other channel args
+    match and the peer's credentials are valid for this channel's authority
+    (HTTP/2 connection coalescing, RFC 7540 section 9.1.1).  Calls on such a
+    connection carry the channel's own :authority.  Both channels must set
+    this arg.  Defaults to 0.  Experimental. */
+#define GRPC_ARG_HTTP2_CONNECTION_COALESCING \
+  "grpc.experimental.http2_connection_coalescing"
+/** If positive, pick_first connects to addresses in the style of Happy
+    Eyeballs (RFC 8305): address families are interleaved, and if an attempt
+    has not connected after this many milliseconds, an attempt on the next
+    address starts without cancelling it.  The first connection to succeed
+    is used.  RFC 8305 recommends 250.  Defaults to 0, which tries addresses
+    one at a time.  Experimental. */
+#define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.experimental.happy_eyeballs_connection_attempt_delay_ms"
+/** If non-zero, a client channel starts connecting when it is created rather
+    than on its first call, and then keeps a connection up: it does not go
+    idle after GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS, and pick_first reconnects as
+    soon as its connection is lost.  Defaults to 0.  Experimental. */
+#define GRPC_ARG_PREWARM_CONNECTION "grpc.experimental.prewarm_connection"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
+/** If positive, the DNS resolver shares its address lookups with the other
+    channels in the process that set this arg: a lookup of the same name
+    that completed successfully less than this many ms ago is reused, and a
+    lookup already in flight is joined instead of being started again.
+    Defaults to 0, which disables the sharing.  Experimental. */
+#define GRPC_ARG_DNS_RESULT_CACHE_TTL_MS \
+  "grpc.experimental.dns_result_cache_ttl_ms"
+/** If positive, the DNS resolver resolves again this many ms after each
+    successful resolution, without waiting for the channel to ask.  Until
+    such a refresh succeeds the channel keeps using the last result, and
+    a refresh that returns the same result is not reported.  Values below
+    GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS are raised to it.  Defaults
+    to 0, which disables background refreshes.  Experimental. */
+#define GRPC_ARG_DNS_REFRESH_INTERVAL_MS \
+  "grpc.experimental.dns_refresh_interval_ms"
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
+/** The maximum number of incoming connections a server listener handshakes
+    at once. Connections accepted beyond that, or while the server's memory
+    quota is under high pressure, are closed before any handshaking work is
+    done. Defaults to unlimited. Experimental. */
+#define GRPC_ARG_SERVER_MAX_PENDING_HANDSHAKES \
+  "grpc.experimental.server_max_pending_handshakes"
 /** This *should* be used for testing only.
     The caller of the secure_channel_create functions may override the target
     name used for SSL host name checking using this channel argument which is of
@@ -284,11 +413,34 @@ typedef struct {
  *  protector.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, TLS connections hand record encryption over to the kernel
+    (Linux kernel TLS) after the handshake where the TLS library, protocol
+    version, cipher and kernel support it, and then use the TCP endpoint
+    directly.  Otherwise they fall back to encrypting in gRPC.  Requires
+    BoringSSL and AES-GCM; TLS 1.3 is only offloaded on servers.  Default
+    is 0.  Experimental. */
+#define GRPC_ARG_EXPERIMENTAL_KERNEL_TLS "grpc.experimental.kernel_tls"
+/** If non-zero, the security handshaker's crypto (key exchange, signing and
+    certificate verification) runs on a small process-wide pool of threads
+    rather than on the I/O thread that read the handshake data.  When too
+    many handshakes are already waiting for that pool, new ones run inline,
+    so that a reconnect storm slows down the connections being handshaken
+    instead of queueing unbounded work.  Ignored when fork support is
+    enabled.  Default is 0.  Experimental. */
+#define GRPC_ARG_EXPERIMENTAL_HANDSHAKE_OFFLOAD \
+  "grpc.experimental.handshake_offload"
 /** Maximum metadata size, in bytes. Note this limit applies to the max sum of
     all metadata key-value entries in a batch of headers. */
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** If positive, and a server port is opened once per pollset with
+ * SO_REUSEPORT, steer each new connection by the CPU that received it: the
+ * CPUs are split into this many contiguous ranges, and connections arriving
+ * on the i-th range are accepted by the i-th listener and polled on the i-th
+ * pollset. Linux only. Experimental. */
+#define GRPC_ARG_REUSEPORT_CPU_STEERING \
+  "grpc.experimental.reuseport_cpu_steering"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -317,6 +469,12 @@ typedef struct {
  * level. Disabling channelz naturally disables channel tracing. The default
  * is for channelz to be enabled. */
 #define GRPC_ARG_ENABLE_CHANNELZ "grpc.enable_channelz"
+/** If non-zero, the channelz node of a channel or server keeps latency
+ * histograms: of whole calls, and of LB picks for a channel or of the wait
+ * for a matching request for a server.  They cost a few KB per CPU each, and
+ * so are off by default. */
+#define GRPC_ARG_CHANNELZ_LATENCY_HISTOGRAMS \
+  "grpc.experimental.channelz_latency_histograms"
 /** If non-zero, Cronet transport will coalesce packets to fewer frames
  * when possible. */
 #define GRPC_ARG_USE_CRONET_PACKET_COALESCING \
@@ -346,6 +504,28 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map the received pages into memory with
+   TCP_ZEROCOPY_RECEIVE instead of copying them. By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only zerocopy if >= this many bytes are
+   expected to be read. By default, this is set to 256KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_recv_bytes_threshold"
+/* TCP write coalescing enable state: zero is disabled, non-zero is enabled.
+   When enabled, EventEngine endpoint writes issued while a write coalescer
+   scope is active on the calling thread are sent together with the writes of
+   other endpoints when the scope ends. By default, it is disabled. */
+#define GRPC_ARG_TCP_WRITE_COALESCING_ENABLED \
+  "grpc.experimental.tcp_write_coalescing_enabled"
+/* TCP busy poll time in microseconds: if positive, sets SO_BUSY_POLL (and
+   SO_PREFER_BUSY_POLL where available) on the channel's or server's sockets,
+   so that the kernel polls the device queue for this long when they have no
+   data before it waits for an interrupt. Values above net.core.busy_read, and
+   SO_PREFER_BUSY_POLL, need CAP_NET_ADMIN. Linux only. By default, it is
+   disabled. */
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -391,15 +571,14 @@ typedef struct {
     retries are enabled when they are configured via the service config.
     For details, see:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    NOTE: Hedging functionality is not yet implemented, so those
-          fields in the service config will currently be ignored.  See
-          also the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below.
+    NOTE: Hedging policies in the service config are ignored unless the
+          GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below is also set.
  */
 #define GRPC_ARG_ENABLE_RETRIES "grpc.enable_retries"
 /** Enables hedging functionality, as described in:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    Default is currently false, since this functionality is not yet
-    fully implemented.
+    When set, a method's service config may contain a hedgingPolicy instead
+    of a retryPolicy.  Default is currently false.
     NOTE: This channel arg is experimental and will eventually be removed.
           Once hedging functionality has been implemented and proves stable,
           this arg will be removed, and the hedging functionality will
@@ -407,6 +586,13 @@ typedef struct {
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
 /** Per-RPC retry buffer size, in bytes. Default is 256 KiB. */
 #define GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE "grpc.per_rpc_retry_buffer_size"
+/** If non-zero, the data buffered for retries is charged to the channel's
+    resource quota instead of being limited by
+    GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE, and calls commit to their current
+    attempt only once the quota is under memory pressure.  This keeps large
+    requests retriable when memory allows.  Default is 0.  Experimental. */
+#define GRPC_ARG_RETRY_BUFFER_FROM_RESOURCE_QUOTA \
+  "grpc.experimental.retry_buffer_from_resource_quota"
 /** Channel arg that carries the bridged objective c object for custom metrics
  * logging filter. */
 #define GRPC_ARG_MOBILE_LOG_CONTEXT "grpc.mobile_log_context"
@@ -457,6 +643,51 @@ typedef struct {
  * channel arg. Int valued, milliseconds. Defaults to 10 minutes.*/
 #define GRPC_ARG_SERVER_CONFIG_CHANGE_DRAIN_GRACE_TIME_MS \
   "grpc.experimental.server_config_change_drain_grace_time_ms"
+/** EXPERIMENTAL. If non-zero, the C++ callback API server treats all of its
+    reactors as non-blocking and runs every reaction (OnReadDone, OnDone,
+    OnCancel, ...) inline on the thread that completed the operation, often
+    a polling thread, instead of handing it to an executor thread. This
+    saves a thread hop per reaction, but a reaction that blocks or runs long
+    stalls all other calls served by that thread: only set it if no reactor
+    of the server ever blocks. Reactions that run for longer than 10ms are
+    counted by the cq_callback_slow_runs stat. Defaults to 0. */
+#define GRPC_ARG_CALLBACK_REACTORS_NON_BLOCKING \
+  "grpc.experimental.callback_reactors_non_blocking"
+/** EXPERIMENTAL. The number of finished calls whose request objects the C++
+    server keeps for reuse, per callback method, so that new calls to the
+    method need no allocation to be matched and dispatched. Int valued.
+    Defaults to 64; 0 disables the reuse. */
+#define GRPC_ARG_CALLBACK_REQUEST_POOL_SIZE \
+  "grpc.experimental.callback_request_pool_size"
+/** EXPERIMENTAL. If positive, the server limits how many calls to each
+    method it runs at once, to a limit it adapts to the latency of the calls
+    it completes, and at most this value. Calls beyond the limit fail with
+    RESOURCE_EXHAUSTED and a grpc-retry-pushback-ms trailer asking the
+    client to wait before retrying. The limit of a method is shared by all
+    servers of the process. Int valued; defaults to 0 (disabled). */
+#define GRPC_ARG_ADAPTIVE_CONCURRENCY_MAX_LIMIT \
+  "grpc.experimental.adaptive_concurrency_max_limit"
+/** EXPERIMENTAL. If non-zero, a server that takes a call off the queue of
+    calls waiting for the application to request them first fails, with
+    DEADLINE_EXCEEDED, the calls at the head of the queue whose deadline
+    would pass before the application is expected to finish them, judging
+    by how long it recently took to finish calls to the same method.
+    Defaults to 0. */
+#define GRPC_ARG_SERVER_SHED_LATE_CALLS \
+  "grpc.experimental.server_shed_late_calls"
+/** EXPERIMENTAL. If non-zero, calls waiting for the application to request
+    them are handed out earliest deadline first rather than in arrival
+    order. Defaults to 0. */
+#define GRPC_ARG_SERVER_EARLIEST_DEADLINE_FIRST \
+  "grpc.experimental.server_earliest_deadline_first"
+/** EXPERIMENTAL. If positive, enables client-side adaptive throttling of
+    the calls a channel sends to its target: once the target rejects calls
+    (with UNAVAILABLE or RESOURCE_EXHAUSTED), calls fail locally with
+    UNAVAILABLE, with a probability that grows as the ratio of calls the
+    target accepted over the last two minutes falls below 1/K. The value
+    is K in percent; 200 is a common choice. Defaults to 0 (disabled). */
+#define GRPC_ARG_ADAPTIVE_THROTTLING_K_PERCENT \
+  "grpc.experimental.adaptive_throttling_k_percent"
 /** \} */
 
 /** Result of a grpc call. If the caller satisfies the prerequisites of a
@@ -532,6 +763,16 @@ typedef enum grpc_call_error {
   (GRPC_INITIAL_METADATA_WAIT_FOR_READY_EXPLICITLY_SET | \
    GRPC_INITIAL_METADATA_WAIT_FOR_READY | GRPC_WRITE_THROUGH)
 
+/** Receive message flags */
+/** EXPERIMENTAL. Allow a GRPC_OP_RECV_MESSAGE to complete with the part of
+    a message received so far instead of waiting for all of it, so that a
+    large message is consumed as it arrives, with memory bounded by flow
+    control rather than by the size of the message. Use
+    grpc_call_recv_message_is_partial() to tell whether more of the message
+    follows. Only uncompressed messages are delivered in parts, and not by
+    all transports. */
+#define GRPC_RECV_MESSAGE_ALLOW_PARTIAL (0x00000001u)
+
 /** A single metadata element */
 typedef struct grpc_metadata {
   /** the key, value values are expected to line up with grpc_mdelem: if
@@ -19,7 +19,10 @@
 #ifndef GRPCPP_CHANNEL_H
 #define GRPCPP_CHANNEL_H
 
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include <grpc/grpc.h>
 #include <grpcpp/completion_queue.h>
@@ -104,6 +107,11 @@ class Channel final : public grpc::ChannelInterface,
       const grpc::internal::RpcMethod& method, grpc::ClientContext* context,
       grpc::CompletionQueue* cq, size_t interceptor_pos) override;
 
+  // Returns the tag of \a method registered with \a authority in place of
+  // the channel's host, or nullptr if too many have been registered.
+  void* RegisteredMethodWithAuthority(const grpc::internal::RpcMethod& method,
+                                      const std::string& authority);
+
   const std::string host_;
   grpc_channel* const c_channel_;  // owned
 
@@ -116,6 +124,15 @@ class Channel final : public grpc::ChannelInterface,
   // shutdown callback tag (invoked when the CQ is fully shutdown).
   std::atomic<CompletionQueue*> callback_cq_{nullptr};
 
+  // Tags of registered methods called with a per-call authority, by
+  // authority and then by the method's own tag. The core channel keeps each
+  // registration for its lifetime, so their number is capped.
+  grpc::internal::Mutex authority_registrations_mu_;
+  std::map<std::string, std::map<void*, void*>, std::less<>>
+      authority_registrations_ ABSL_GUARDED_BY(authority_registrations_mu_);
+  size_t num_authority_registrations_
+      ABSL_GUARDED_BY(authority_registrations_mu_) = 0;
+
   std::vector<
       std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
       interceptor_creators_;
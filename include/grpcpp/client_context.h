@@ -29,7 +29,8 @@
 /// compression options, can be made persistent at channel construction time
 /// (see \a grpc::CreateCustomChannel).
 ///
-/// \warning ClientContext instances should \em not be reused across rpcs.
+/// \warning ClientContext instances should \em not be reused across rpcs,
+///          other than through \a ClientContext::Reset.
 
 #ifndef GRPCPP_CLIENT_CONTEXT_H
 #define GRPCPP_CLIENT_CONTEXT_H
@@ -37,6 +38,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <grpc/impl/codegen/compression_types.h>
 #include <grpc/impl/codegen/propagation_bits.h>
@@ -51,6 +53,7 @@
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 #include <grpcpp/support/string_ref.h>
+#include <grpcpp/support/tcp_tracer.h>
 #include <grpcpp/support/time.h>
 
 struct census_context;
@@ -187,7 +190,8 @@ class PropagationOptions {
 /// compression options, can be made persistent at channel construction time
 /// (see \a grpc::CreateCustomChannel).
 ///
-/// \warning ClientContext instances should \em not be reused across rpcs.
+/// \warning ClientContext instances should \em not be reused across rpcs,
+///          other than through \a Reset.
 /// \warning The ClientContext instance used for creating an rpc must remain
 ///          alive and valid for the lifetime of the rpc.
 class ClientContext {
@@ -377,6 +381,13 @@ class ClientContext {
     return census_context_;
   }
 
+  /// EXPERIMENTAL: Have \a tracer receive the kernel timestamps of the
+  /// call's TCP writes. It is only valid to call this before the client call
+  /// is created.
+  void set_tcp_tracer(std::shared_ptr<grpc::experimental::TcpTracer> tracer) {
+    tcp_tracer_ = std::move(tracer);
+  }
+
   /// Send a best-effort out-of-band cancel on the call associated with
   /// this client context.  The call could be in any stage; e.g., if it is
   /// already finished, it may still return success.
@@ -391,6 +402,16 @@ class ClientContext {
   /// thread.
   void TryCancel();
 
+  /// EXPERIMENTAL: Return the context to the state of a newly constructed
+  /// one, so that it can be used for another rpc without being allocated
+  /// again. Everything set on it is cleared, including the server context
+  /// it was created from, if any.
+  ///
+  /// \warning The previous rpc must have completed: its final status must
+  /// have been delivered and, for the callback API, its reactor's OnDone
+  /// must have run.
+  void Reset();
+
   /// Global Callbacks
   ///
   /// Can be set exactly once per application to install hooks whenever
@@ -479,7 +500,7 @@ class ClientContext {
                 : 0);
   }
 
-  std::string authority() { return authority_; }
+  const std::string& authority() const { return authority_; }
 
   void SendCancelToInterceptors();
 
@@ -499,6 +520,7 @@ class ClientContext {
   std::shared_ptr<grpc::CallCredentials> creds_;
   mutable std::shared_ptr<const grpc::AuthContext> auth_context_;
   struct census_context* census_context_;
+  std::shared_ptr<grpc::experimental::TcpTracer> tcp_tracer_;
   std::multimap<std::string, std::string> send_initial_metadata_;
   mutable grpc::internal::MetadataMap recv_initial_metadata_;
   mutable grpc::internal::MetadataMap trailing_metadata_;
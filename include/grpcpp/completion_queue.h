@@ -202,6 +202,29 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
     return AsyncNextInternal(tag, ok, deadline_tp.raw_time());
   }
 
+  /// EXPERIMENTAL
+  /// Like \a AsyncNext, but also reads the events already queued behind the
+  /// first one, up to \a max_events in all. This amortizes the cost of reading
+  /// from the queue when many events are ready at once.
+  ///
+  /// \param[out] tags Upon success, the tags of the events read. Must have
+  ///        room for \a max_events tags.
+  /// \param[out] oks Upon success, the ok values of the events read. Must have
+  ///        room for \a max_events values.
+  /// \param[in] max_events The most events to read. Must be at least 1.
+  /// \param[out] num_events Upon success, the number of events read.
+  /// \param[in] deadline How long to block in wait for the first event.
+  ///
+  /// \return GOT_EVENT if at least one event was read, else the same as
+  ///         \a AsyncNext.
+  template <typename T>
+  NextStatus AsyncNextBatch(void** tags, bool* oks, size_t max_events,
+                            size_t* num_events, const T& deadline) {
+    grpc::TimePoint<T> deadline_tp(deadline);
+    return AsyncNextBatchInternal(tags, oks, max_events, num_events,
+                                  deadline_tp.raw_time());
+  }
+
   /// EXPERIMENTAL
   /// First executes \a F, then reads from the queue, blocking up to
   /// \a deadline (or the queue's shutdown).
@@ -316,6 +339,8 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
   };
 
   NextStatus AsyncNextInternal(void** tag, bool* ok, gpr_timespec deadline);
+  NextStatus AsyncNextBatchInternal(void** tags, bool* oks, size_t max_events,
+                                    size_t* num_events, gpr_timespec deadline);
 
   /// Wraps \a grpc_completion_queue_pluck.
   /// \warning Must not be mixed with calls to \a Next.
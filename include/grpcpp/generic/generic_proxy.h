@@ -0,0 +1,60 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_GENERIC_GENERIC_PROXY_H
+#define GRPCPP_GENERIC_GENERIC_PROXY_H
+
+#include <grpc/impl/codegen/port_platform.h>
+
+#include <memory>
+#include <utility>
+
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/impl/codegen/channel_interface.h>
+
+namespace grpc {
+namespace experimental {
+
+/// \a CallbackGenericProxyService forwards every call it receives to the
+/// same method on another channel, and the backend's responses, metadata
+/// and status back to the caller. Register it with
+/// ServerBuilder::RegisterCallbackGenericService.
+///
+/// Messages are passed through as the byte buffers they arrived in, without
+/// being copied or handed to application code. Each direction has at most
+/// one message in flight, so that a slow reader on either side applies flow
+/// control to the sender on the other. The call's deadline and cancellation
+/// are propagated to the backend.
+class CallbackGenericProxyService : public CallbackGenericService {
+ public:
+  explicit CallbackGenericProxyService(
+      std::shared_ptr<ChannelInterface> channel)
+      : stub_(std::move(channel)) {}
+
+  ServerGenericBidiReactor* CreateReactor(
+      GenericCallbackServerContext* ctx) override;
+
+ private:
+  GenericStub stub_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_GENERIC_GENERIC_PROXY_H
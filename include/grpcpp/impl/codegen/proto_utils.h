@@ -52,9 +52,12 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
   int byte_size = static_cast<int>(msg.ByteSizeLong());
-  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE) {
+  if (byte_size <= kProtoBufferWriterMaxBufferLength) {
+    // Anything that would fit in a single ProtoBufferWriter block is
+    // serialized directly into one right-sized slice, reusing the size cached
+    // by ByteSizeLong() above instead of going through a stream that computes
+    // it again.
     Slice slice(byte_size);
-    // We serialize directly into the allocated slices memory
     GPR_CODEGEN_ASSERT(slice.end() == msg.SerializeWithCachedSizesToArray(
                                           const_cast<uint8_t*>(slice.begin())));
     ByteBuffer tmp(&slice, 1);
@@ -80,7 +83,14 @@ Status GenericDeserialize(ByteBuffer* buffer,
     return Status(StatusCode::INTERNAL, "No payload");
   }
   Status result = g_core_codegen_interface->ok();
-  {
+  Slice slice;
+  if (buffer->TrySingleSlice(&slice).ok()) {
+    // A message that arrived in one slice is parsed straight from it, rather
+    // than chunk by chunk through a ZeroCopyInputStream.
+    if (!msg->ParseFromArray(slice.begin(), static_cast<int>(slice.size()))) {
+      result = Status(StatusCode::INTERNAL, msg->InitializationErrorString());
+    }
+  } else {
     ProtoBufferReader reader(buffer);
     if (!reader.status().ok()) {
       return reader.status();
@@ -20,6 +20,9 @@
 
 // IWYU pragma: private
 
+#include <memory>
+#include <utility>
+
 #include <grpcpp/impl/codegen/message_allocator.h>
 #include <grpcpp/impl/codegen/rpc_service_method.h>
 #include <grpcpp/impl/codegen/server_callback.h>
@@ -153,7 +156,9 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
       // is directly invoking a user-controlled reaction
       // (OnSendInitialMetadataDone). Thus it must be dispatched to an executor
       // thread. However, any OnDone needed after that can be inlined because it
-      // is already running on an executor thread.
+      // is already running on an executor thread. None of this applies if the
+      // server was told that its reactors do not block: then every reaction
+      // runs inline.
       meta_tag_.Set(
           call_.call(),
           [this](bool ok) {
@@ -162,7 +167,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->non_blocking_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -185,6 +190,9 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
           allocator_state_(allocator_state),
           call_requester_(std::move(call_requester)) {
       ctx_->set_message_allocator_state(allocator_state);
+      if (ctx_->callback_reactors_non_blocking_) {
+        this->set_non_blocking_reactions();
+      }
     }
 
     /// SetupReactor binds the reactor (which also releases any queued
@@ -346,7 +354,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->non_blocking_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -359,6 +367,10 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
 
     void Read(RequestType* req) override {
       this->Ref();
+      if (read_ahead_ != nullptr) {
+        ReadFromReadAhead(req);
+        return;
+      }
       read_ops_.RecvMessage(req);
       call_.PerformOps(&read_ops_);
     }
@@ -366,10 +378,108 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
    private:
     friend class CallbackClientStreamingHandler<RequestType, ResponseType>;
 
+    // State of reads for a reactor that enabled read-ahead. A read in flight
+    // holds a ref of its own; a message it stores for the next Read() does
+    // not, so a reactor that finishes without reading it is not held up.
+    struct ReadAhead {
+      enum class State { kIdle, kReading, kDone };
+
+      grpc::internal::Mutex mu;
+      State state ABSL_GUARDED_BY(mu) = State::kIdle;
+      // The result of the read that completed before Read() asked for it.
+      bool ok ABSL_GUARDED_BY(mu) = false;
+      // The reactor's Read() waiting for the read in flight.
+      RequestType* waiting ABSL_GUARDED_BY(mu) = nullptr;
+      RequestType msg;
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<RequestType>>
+          ops;
+      grpc::internal::CallbackWithSuccessTag tag;
+      // A batch without ops, to run OnReadDone for a message that was already
+      // received from a callback rather than from within Read().
+      bool deliver_ok = false;
+      grpc::internal::CallOpSet<> deliver_ops;
+      grpc::internal::CallbackWithSuccessTag deliver_tag;
+    };
+
+    void StartReadAhead() {
+      read_ahead_->ops.RecvMessage(&read_ahead_->msg);
+      call_.PerformOps(&read_ahead_->ops);
+    }
+
+    void ReadFromReadAhead(RequestType* req) {
+      bool deliver = false;
+      bool start_read = false;
+      {
+        grpc::internal::MutexLock l(&read_ahead_->mu);
+        switch (read_ahead_->state) {
+          case ReadAhead::State::kDone:
+            *req = std::move(read_ahead_->msg);
+            deliver = true;
+            read_ahead_->deliver_ok = read_ahead_->ok;
+            start_read = read_ahead_->ok;
+            break;
+          case ReadAhead::State::kReading:
+            read_ahead_->waiting = req;
+            break;
+          case ReadAhead::State::kIdle:
+            read_ahead_->waiting = req;
+            start_read = true;
+            break;
+        }
+        if (start_read) read_ahead_->state = ReadAhead::State::kReading;
+        if (deliver && !start_read) {
+          read_ahead_->state = ReadAhead::State::kIdle;
+        }
+      }
+      if (start_read) {
+        this->Ref();
+        StartReadAhead();
+      }
+      if (deliver) call_.PerformOps(&read_ahead_->deliver_ops);
+    }
+
+    void OnReadAheadDone(bool ok) {
+      if (GPR_UNLIKELY(!ok)) {
+        ctx_->MaybeMarkCancelledOnRead();
+      }
+      RequestType* req;
+      {
+        grpc::internal::MutexLock l(&read_ahead_->mu);
+        req = read_ahead_->waiting;
+        read_ahead_->waiting = nullptr;
+        if (req == nullptr) {
+          read_ahead_->state = ReadAhead::State::kDone;
+          read_ahead_->ok = ok;
+        } else {
+          read_ahead_->state =
+              ok ? ReadAhead::State::kReading : ReadAhead::State::kIdle;
+        }
+      }
+      if (req == nullptr) {
+        // Kept for the next Read().
+        this->MaybeDone(/*inlineable_ondone=*/true);
+        return;
+      }
+      if (ok) {
+        *req = std::move(read_ahead_->msg);
+        // This read's ref moves to the next one.
+        StartReadAhead();
+      } else {
+        this->MaybeDone(/*inlineable_ondone=*/true);
+      }
+      reactor_.load(std::memory_order_relaxed)->OnReadDone(ok);
+      // The ref taken by Read().
+      this->MaybeDone(/*inlineable_ondone=*/true);
+    }
+
     ServerCallbackReaderImpl(grpc::CallbackServerContext* ctx,
                              grpc::internal::Call* call,
                              std::function<void()> call_requester)
-        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {}
+        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {
+      if (ctx_->callback_reactors_non_blocking_) {
+        this->set_non_blocking_reactions();
+      }
+    }
 
     void SetupReactor(ServerReadReactor<RequestType>* reactor) {
       reactor_.store(reactor, std::memory_order_relaxed);
@@ -385,8 +495,25 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, /*can_inline=*/this->non_blocking_reactions());
       read_ops_.set_core_cq_tag(&read_tag_);
+      if (this->ReadAheadEnabled(reactor)) {
+        read_ahead_ = std::make_unique<ReadAhead>();
+        // Like read_tag_, these run the reactor's OnReadDone.
+        read_ahead_->tag.Set(
+            call_.call(), [this](bool ok) { OnReadAheadDone(ok); },
+            &read_ahead_->ops, /*can_inline=*/this->non_blocking_reactions());
+        read_ahead_->ops.set_core_cq_tag(&read_ahead_->tag);
+        read_ahead_->deliver_tag.Set(
+            call_.call(),
+            [this](bool) {
+              reactor_.load(std::memory_order_relaxed)
+                  ->OnReadDone(read_ahead_->deliver_ok);
+              this->MaybeDone(/*inlineable_ondone=*/true);
+            },
+            &read_ahead_->deliver_ops, /*can_inline=*/false);
+        read_ahead_->deliver_ops.set_core_cq_tag(&read_ahead_->deliver_tag);
+      }
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
       // Inlineable OnDone can be false here because there is no read
@@ -426,6 +553,8 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<RequestType>>
         read_ops_;
     grpc::internal::CallbackWithSuccessTag read_tag_;
+    // Set if the reactor enabled read-ahead.
+    std::unique_ptr<ReadAhead> read_ahead_;
 
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
@@ -548,7 +677,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->non_blocking_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -561,6 +690,33 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
 
     void Write(const ResponseType* resp, grpc::WriteOptions options) override {
       this->Ref();
+      PerformWrite(resp, options);
+    }
+
+    void WriteBatch(const ResponseType* const* resps, size_t count,
+                    grpc::WriteOptions options) override {
+      GPR_CODEGEN_ASSERT(count > 0);
+      this->Ref();
+      // The rest of the batch is written from the write callback; the
+      // reactor only hears about the batch once all of it is done.
+      batch_next_ = resps + 1;
+      batch_end_ = resps + count;
+      batch_options_ = options;
+      PerformWrite(resps[0], NextBatchWriteOptions());
+    }
+
+    void WriteAndFinish(const ResponseType* resp, grpc::WriteOptions options,
+                        grpc::Status s) override {
+      // This combines the write into the finish callback
+      // TODO(vjpai): don't assert
+      GPR_CODEGEN_ASSERT(finish_ops_.SendMessagePtr(resp, options).ok());
+      Finish(std::move(s));
+    }
+
+   private:
+    friend class CallbackServerStreamingHandler<RequestType, ResponseType>;
+
+    void PerformWrite(const ResponseType* resp, grpc::WriteOptions options) {
       if (options.is_last_message()) {
         options.set_buffer_hint();
       }
@@ -577,24 +733,25 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       call_.PerformOps(&write_ops_);
     }
 
-    void WriteAndFinish(const ResponseType* resp, grpc::WriteOptions options,
-                        grpc::Status s) override {
-      // This combines the write into the finish callback
-      // TODO(vjpai): don't assert
-      GPR_CODEGEN_ASSERT(finish_ops_.SendMessagePtr(resp, options).ok());
-      Finish(std::move(s));
+    // Options for the batch message about to be written: only the final
+    // message of a batch may be marked as the last message.
+    grpc::WriteOptions NextBatchWriteOptions() const {
+      grpc::WriteOptions options = batch_options_;
+      if (batch_next_ != batch_end_) options.clear_last_message();
+      return options;
     }
 
-   private:
-    friend class CallbackServerStreamingHandler<RequestType, ResponseType>;
-
     ServerCallbackWriterImpl(grpc::CallbackServerContext* ctx,
                              grpc::internal::Call* call, const RequestType* req,
                              std::function<void()> call_requester)
         : ctx_(ctx),
           call_(*call),
           req_(req),
-          call_requester_(std::move(call_requester)) {}
+          call_requester_(std::move(call_requester)) {
+      if (ctx_->callback_reactors_non_blocking_) {
+        this->set_non_blocking_reactions();
+      }
+    }
 
     void SetupReactor(ServerWriteReactor<ResponseType>* reactor) {
       reactor_.store(reactor, std::memory_order_relaxed);
@@ -604,10 +761,16 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       write_tag_.Set(
           call_.call(),
           [this, reactor](bool ok) {
+            if (ok && batch_next_ != batch_end_) {
+              const ResponseType* resp = *batch_next_++;
+              PerformWrite(resp, NextBatchWriteOptions());
+              return;
+            }
+            batch_next_ = batch_end_ = nullptr;
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, /*can_inline=*/this->non_blocking_reactions());
       write_ops_.set_core_cq_tag(&write_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -652,6 +815,11 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
                               grpc::internal::CallOpSendMessage>
         write_ops_;
     grpc::internal::CallbackWithSuccessTag write_tag_;
+    // Remaining messages of the write batch in progress, if any. Only touched
+    // by WriteBatch and the write callback, which never run concurrently.
+    const ResponseType* const* batch_next_ = nullptr;
+    const ResponseType* const* batch_end_ = nullptr;
+    grpc::WriteOptions batch_options_;
 
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
@@ -758,7 +926,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->non_blocking_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -806,7 +974,11 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
     ServerCallbackReaderWriterImpl(grpc::CallbackServerContext* ctx,
                                    grpc::internal::Call* call,
                                    std::function<void()> call_requester)
-        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {}
+        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {
+      if (ctx_->callback_reactors_non_blocking_) {
+        this->set_non_blocking_reactions();
+      }
+    }
 
     void SetupReactor(ServerBidiReactor<RequestType, ResponseType>* reactor) {
       reactor_.store(reactor, std::memory_order_relaxed);
@@ -819,7 +991,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, /*can_inline=*/this->non_blocking_reactions());
       write_ops_.set_core_cq_tag(&write_tag_);
       read_tag_.Set(
           call_.call(),
@@ -830,7 +1002,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, /*can_inline=*/this->non_blocking_reactions());
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -65,6 +65,8 @@ extern const absl::string_view kRpcClientStartedRpcsMeasureName;
 extern const absl::string_view kRpcClientRetriesPerCallMeasureName;
 extern const absl::string_view kRpcClientTransparentRetriesPerCallMeasureName;
 extern const absl::string_view kRpcClientRetryDelayPerCallMeasureName;
+extern const absl::string_view kRpcClientCpuTimePerRpcMeasureName;
+extern const absl::string_view kRpcClientArenaBytesPerRpcMeasureName;
 
 extern const absl::string_view kRpcServerSentMessagesPerRpcMeasureName;
 extern const absl::string_view kRpcServerSentBytesPerRpcMeasureName;
@@ -90,6 +92,8 @@ const ::opencensus::stats::ViewDescriptor&
 ClientTransparentRetriesPerCallCumulative();
 const ::opencensus::stats::ViewDescriptor& ClientTransparentRetriesCumulative();
 const ::opencensus::stats::ViewDescriptor& ClientRetryDelayPerCallCumulative();
+const ::opencensus::stats::ViewDescriptor& ClientCpuTimePerRpcCumulative();
+const ::opencensus::stats::ViewDescriptor& ClientArenaBytesPerRpcCumulative();
 
 const ::opencensus::stats::ViewDescriptor& ServerSentBytesPerRpcCumulative();
 const ::opencensus::stats::ViewDescriptor&
@@ -36,6 +36,12 @@ class ResourceQuota final : private grpc::GrpcLibraryCodegen {
   /// \param name - a unique name for this ResourceQuota.
   explicit ResourceQuota(const std::string& name);
   ResourceQuota();
+  /// Creates a sub-quota of \a parent, e.g. one per tenant or method.
+  /// Memory used through the sub-quota also counts against \a parent, and
+  /// threads are drawn from \a parent. \a Resize bounds the sub-quota's own
+  /// usage (its maximum share of \a parent), and \a SetMinShare its
+  /// guaranteed share.
+  ResourceQuota(const std::string& name, const ResourceQuota& parent);
   ~ResourceQuota() override;
 
   /// Resize this \a ResourceQuota to a new size. If \a new_size is smaller
@@ -54,6 +60,12 @@ class ResourceQuota final : private grpc::GrpcLibraryCodegen {
   /// normal course.
   ResourceQuota& SetMaxThreads(int new_max_threads);
 
+  /// For a sub-quota: when \a parent is out of memory, reclaim memory only
+  /// from sub-quotas using more than their minimum share. Usage up to
+  /// \a min_bytes is thus protected from other tenants' demand, though it is
+  /// still subject to this sub-quota's own size.
+  ResourceQuota& SetMinShare(size_t min_bytes);
+
   grpc_resource_quota* c_resource_quota() const { return impl_; }
 
  private:
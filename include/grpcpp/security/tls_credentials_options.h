@@ -104,6 +104,14 @@ class TlsCredentialsOptions {
   // version > 1.1.
   void set_crl_directory(const std::string& path);
 
+  // TODO(zhenlian): This is an experimental API is likely to change in the
+  // future. Before de-experiementalizing, verify the API is up to date.
+  // If set to a non-zero value, gRPC remembers up to that many verified peer
+  // certificate chains and skips verifying them again when the same peer
+  // reconnects. Not used together with set_crl_directory(). Only supported
+  // for OpenSSL version >= 1.1.
+  void set_verification_cache_size(size_t size);
+
   // ----- Getters for member fields ----
   // Get the internal c options. This function shall be used only internally.
   grpc_tls_credentials_options* c_credentials_options() const {
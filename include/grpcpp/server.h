@@ -260,6 +260,13 @@ class Server : public ServerInterface, private GrpcLibraryCodegen {
 
   ServerInitializer* initializer();
 
+  // Pin the threads serving each sync server completion queue to a disjoint
+  // subset of the CPUs, so that each completion queue and its ThreadManager
+  // form an independent shard. With numa_aware, the shards are dealt out
+  // over the NUMA nodes and each one only gets CPUs of its own node. Must be
+  // called before Start().
+  void ShardSyncServerAcrossCpus(bool numa_aware);
+
   // Functions to manage the server shutdown ref count. Things that increase
   // the ref count are the running state of the server (take a ref at start and
   // drop it at shutdown) and each running callback RPC.
@@ -279,6 +286,9 @@ class Server : public ServerInterface, private GrpcLibraryCodegen {
       interceptor_creators_;
 
   int max_receive_message_size_;
+  bool callback_reactors_non_blocking_ = false;
+  // Number of done callback requests whose memory is kept per method.
+  int callback_request_pool_size_ = 64;
 
   /// The following completion queues are ONLY used in case of Sync API
   /// i.e. if the server has any services with sync methods. The server uses
@@ -226,10 +226,17 @@ class ServerBuilder {
 
   /// Options for synchronous servers.
   enum SyncServerOption {
-    NUM_CQS,         ///< Number of completion queues.
-    MIN_POLLERS,     ///< Minimum number of polling threads.
-    MAX_POLLERS,     ///< Maximum number of polling threads.
-    CQ_TIMEOUT_MSEC  ///< Completion queue timeout in milliseconds.
+    NUM_CQS,          ///< Number of completion queues.
+    MIN_POLLERS,      ///< Minimum number of polling threads.
+    MAX_POLLERS,      ///< Maximum number of polling threads.
+    CQ_TIMEOUT_MSEC,  ///< Completion queue timeout in milliseconds.
+    /// Number of completion queues, each served by threads pinned to a
+    /// disjoint subset of the CPUs. Overrides NUM_CQS when set. Experimental.
+    NUM_CPU_SHARDS,
+    /// When non-zero, keep each CPU shard within one NUMA node, dealing the
+    /// shards out over the nodes. Without NUM_CPU_SHARDS, creates one shard
+    /// per node. Experimental.
+    NUMA_AWARE
   };
 
   /// Only useful if this is a Synchronous server.
@@ -357,7 +364,12 @@ class ServerBuilder {
 
   struct SyncServerSettings {
     SyncServerSettings()
-        : num_cqs(1), min_pollers(1), max_pollers(2), cq_timeout_msec(10000) {}
+        : num_cqs(1),
+          min_pollers(1),
+          max_pollers(2),
+          cq_timeout_msec(10000),
+          num_cpu_shards(0),
+          numa_aware(false) {}
 
     /// Number of server completion queues to create to listen to incoming RPCs.
     int num_cqs;
@@ -372,6 +384,12 @@ class ServerBuilder {
 
     /// The timeout for server completion queue's AsyncNext call.
     int cq_timeout_msec;
+
+    /// If non-zero, the number of CPU-pinned completion queue shards.
+    int num_cpu_shards;
+
+    /// Whether CPU shards are kept within NUMA nodes.
+    bool numa_aware;
   };
 
   int max_receive_message_size_;
@@ -43,6 +43,7 @@
 #include <grpcpp/support/server_interceptor.h>
 #include <grpcpp/support/status.h>
 #include <grpcpp/support/string_ref.h>
+#include <grpcpp/support/tcp_tracer.h>
 #include <grpcpp/support/time.h>
 
 struct grpc_metadata;
@@ -299,6 +300,12 @@ class ServerContextBase {
   /// Returns the call's authority.
   grpc::string_ref ExperimentalGetAuthority() const;
 
+  /// EXPERIMENTAL API
+  /// Has \a tracer receive the kernel timestamps of the call's TCP writes.
+  /// It is only valid to call this before any metadata or message is sent.
+  void ExperimentalSetTcpTracer(
+      std::shared_ptr<grpc::experimental::TcpTracer> tracer);
+
  protected:
   /// Async only. Has to be called before the rpc starts.
   /// Returns the tag in completion queue when the rpc finishes.
@@ -486,6 +493,8 @@ class ServerContextBase {
   RpcAllocatorState* message_allocator_state_ = nullptr;
   ContextAllocator* context_allocator_ = nullptr;
   experimental::CallMetricRecorder* call_metric_recorder_ = nullptr;
+  // Set from GRPC_ARG_CALLBACK_REACTORS_NON_BLOCKING for callback calls.
+  bool callback_reactors_non_blocking_ = false;
 
   class Reactor : public grpc::ServerUnaryReactor {
    public:
@@ -19,7 +19,10 @@
 #ifndef GRPCPP_SUPPORT_CLIENT_INTERCEPTOR_H
 #define GRPCPP_SUPPORT_CLIENT_INTERCEPTOR_H
 
+#include <stdint.h>
+
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <grpcpp/impl/rpc_method.h>
@@ -50,6 +53,12 @@ class ClientInterceptorFactoryInterface {
   // otherwise. If nullptr is returned, this server interceptor factory is
   // ignored for the purposes of that RPC.
   virtual Interceptor* CreateClientInterceptor(ClientRpcInfo* info) = 0;
+  // Returns an interceptor to use for every RPC in place of creating one per
+  // RPC with CreateClientInterceptor, or nullptr (the default) to create
+  // them. The factory keeps ownership of the interceptor, which must allow
+  // being used by several RPCs at once, typically by holding no per-RPC
+  // state.
+  virtual Interceptor* GetSharedClientInterceptor() { return nullptr; }
 };
 }  // namespace experimental
 
@@ -132,11 +141,60 @@ class ClientRpcInfo {
   // TODO(yashykt): Delete move assignment
   ClientRpcInfo& operator=(ClientRpcInfo&&) = default;
 
-  // Runs interceptor at pos \a pos.
+  struct RegisteredInterceptor {
+    experimental::Interceptor* interceptor;
+    // Null if the interceptor is shared and owned by its factory.
+    std::unique_ptr<experimental::Interceptor> owned;
+    uint32_t hook_points;
+  };
+
+  static constexpr uint32_t kAllHookPoints = ~uint32_t{0};
+
+  // Whether \a interceptor_methods has any of \a hook_points.
+  static bool HasHookPoint(
+      experimental::InterceptorBatchMethods* interceptor_methods,
+      uint32_t hook_points) {
+    for (int i = 0;
+         i < static_cast<int>(InterceptionHookPoints::NUM_INTERCEPTION_HOOKS);
+         ++i) {
+      if ((hook_points & (uint32_t{1} << i)) != 0 &&
+          interceptor_methods->QueryInterceptionHookPoint(
+              static_cast<InterceptionHookPoints>(i))) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Runs interceptor at pos \a pos, or skips it if it has no interest in the
+  // batch.
   void RunInterceptor(
       experimental::InterceptorBatchMethods* interceptor_methods, size_t pos) {
     GPR_CODEGEN_ASSERT(pos < interceptors_.size());
-    interceptors_[pos]->Intercept(interceptor_methods);
+    const RegisteredInterceptor& registered = interceptors_[pos];
+    if (registered.hook_points != kAllHookPoints &&
+        !HasHookPoint(interceptor_methods, registered.hook_points)) {
+      interceptor_methods->Proceed();
+      return;
+    }
+    registered.interceptor->Intercept(interceptor_methods);
+  }
+
+  void AddInterceptor(
+      experimental::ClientInterceptorFactoryInterface* factory) {
+    experimental::Interceptor* interceptor =
+        factory->GetSharedClientInterceptor();
+    std::unique_ptr<experimental::Interceptor> owned;
+    if (interceptor == nullptr) {
+      owned.reset(factory->CreateClientInterceptor(this));
+      if (owned == nullptr) return;
+      interceptor = owned.get();
+    }
+    uint32_t hook_points = interceptor->InterceptedHookPoints();
+    if (hook_points != kAllHookPoints) {
+      hook_points |= HookPointBit(InterceptionHookPoints::PRE_SEND_CANCEL);
+    }
+    interceptors_.push_back({interceptor, std::move(owned), hook_points});
   }
 
   void RegisterInterceptors(
@@ -151,16 +209,10 @@ class ClientRpcInfo {
     //       iterate over a portion of the creators vector.
     for (auto it = creators.begin() + interceptor_pos; it != creators.end();
          ++it) {
-      auto* interceptor = (*it)->CreateClientInterceptor(this);
-      if (interceptor != nullptr) {
-        interceptors_.push_back(
-            std::unique_ptr<experimental::Interceptor>(interceptor));
-      }
+      AddInterceptor(it->get());
     }
     if (internal::g_global_client_interceptor_factory != nullptr) {
-      interceptors_.push_back(std::unique_ptr<experimental::Interceptor>(
-          internal::g_global_client_interceptor_factory
-              ->CreateClientInterceptor(this)));
+      AddInterceptor(internal::g_global_client_interceptor_factory);
     }
   }
 
@@ -170,7 +222,7 @@ class ClientRpcInfo {
   const char* method_ = nullptr;
   const char* suffix_for_stats_ = nullptr;
   grpc::ChannelInterface* channel_ = nullptr;
-  std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  std::vector<RegisteredInterceptor> interceptors_;
   bool hijacked_ = false;
   size_t hijacked_interceptor_ = 0;
 
@@ -0,0 +1,210 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_SUPPORT_COROUTINE_H
+#define GRPCPP_SUPPORT_COROUTINE_H
+
+// EXPERIMENTAL: C++20 coroutine awaitables over the callback API. This header
+// is empty unless the compiler supports coroutines.
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define GRPCPP_HAS_COROUTINES 1
+#endif
+#endif
+
+#ifdef GRPCPP_HAS_COROUTINES
+
+#include <coroutine>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+
+#include <grpcpp/impl/codegen/sync.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/status.h>
+
+namespace grpc {
+namespace experimental {
+
+/// Awaitable for a call made with a stub's callback API. \a start is called
+/// with the function to pass as the call's completion callback, and should
+/// start the call, for example:
+///
+///   grpc::Status status = co_await grpc::experimental::AwaitCall(
+///       [&](std::function<void(grpc::Status)> done) {
+///         stub->async()->Echo(&context, &request, &response,
+///                             std::move(done));
+///       });
+///
+/// The coroutine resumes on the thread that completes the call, so like a
+/// reactor's reactions it must not block until its next co_await.
+template <class Start>
+class AwaitCall {
+ public:
+  explicit AwaitCall(Start start) : start_(std::move(start)) {}
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> handle) {
+    start_([this, handle](grpc::Status status) {
+      status_ = std::move(status);
+      handle.resume();
+    });
+  }
+  grpc::Status await_resume() { return std::move(status_); }
+
+ private:
+  Start start_;
+  grpc::Status status_;
+};
+
+/// A \a ClientBidiReactor whose operations are awaited rather than handled in
+/// reactions. At most one read and one write (or WritesDone) may be awaited at
+/// a time, as with StartRead and StartWrite. For example:
+///
+///   CoroutineClientBidiReactor<Request, Response> stream;
+///   stub->async()->BidiStream(&context, &stream);
+///   stream.StartCall();
+///   co_await stream.Write(&request);
+///   co_await stream.WritesDone();
+///   while (co_await stream.Read(&response)) { ... }
+///   grpc::Status status = co_await stream.Finish();
+///
+/// The coroutine resumes on the thread that completes each operation, so it
+/// must not block between co_awaits. The reactor must outlive the call; the
+/// call is over once Finish() has been awaited.
+template <class Request, class Response>
+class CoroutineClientBidiReactor
+    : public grpc::ClientBidiReactor<Request, Response> {
+ public:
+  class ReadOperation {
+   public:
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+      reactor_->read_handle_ = handle;
+      reactor_->StartRead(resp_);
+    }
+    bool await_resume() const { return reactor_->read_ok_; }
+
+   private:
+    friend class CoroutineClientBidiReactor;
+    ReadOperation(CoroutineClientBidiReactor* reactor, Response* resp)
+        : reactor_(reactor), resp_(resp) {}
+
+    CoroutineClientBidiReactor* const reactor_;
+    Response* const resp_;
+  };
+
+  class WriteOperation {
+   public:
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+      reactor_->write_handle_ = handle;
+      if (req_ == nullptr) {
+        reactor_->StartWritesDone();
+      } else {
+        reactor_->StartWrite(req_, options_);
+      }
+    }
+    bool await_resume() const { return reactor_->write_ok_; }
+
+   private:
+    friend class CoroutineClientBidiReactor;
+    WriteOperation(CoroutineClientBidiReactor* reactor, const Request* req,
+                   grpc::WriteOptions options)
+        : reactor_(reactor), req_(req), options_(options) {}
+
+    CoroutineClientBidiReactor* const reactor_;
+    // Null for WritesDone.
+    const Request* const req_;
+    const grpc::WriteOptions options_;
+  };
+
+  class FinishOperation {
+   public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle) {
+      grpc::internal::MutexLock lock(&reactor_->mu_);
+      // Resume right away if OnDone already ran.
+      if (reactor_->done_) return false;
+      reactor_->finish_handle_ = handle;
+      return true;
+    }
+    grpc::Status await_resume() const { return reactor_->status_; }
+
+   private:
+    friend class CoroutineClientBidiReactor;
+    explicit FinishOperation(CoroutineClientBidiReactor* reactor)
+        : reactor_(reactor) {}
+
+    CoroutineClientBidiReactor* const reactor_;
+  };
+
+  /// Awaits the next message in \a resp; the result is false once there are
+  /// no more.
+  ReadOperation Read(Response* resp) { return ReadOperation(this, resp); }
+  /// Awaits the write of \a req; the result is false if the stream is broken.
+  WriteOperation Write(const Request* req,
+                       grpc::WriteOptions options = grpc::WriteOptions()) {
+    return WriteOperation(this, req, options);
+  }
+  /// Awaits the half-close of the stream.
+  WriteOperation WritesDone() {
+    return WriteOperation(this, nullptr, grpc::WriteOptions());
+  }
+  /// Awaits the status of the call, once it is over.
+  FinishOperation Finish() { return FinishOperation(this); }
+
+  void OnReadDone(bool ok) override {
+    read_ok_ = ok;
+    std::exchange(read_handle_, nullptr).resume();
+  }
+  void OnWriteDone(bool ok) override {
+    write_ok_ = ok;
+    std::exchange(write_handle_, nullptr).resume();
+  }
+  void OnWritesDoneDone(bool ok) override { OnWriteDone(ok); }
+  void OnDone(const grpc::Status& s) override {
+    std::coroutine_handle<> handle;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      status_ = s;
+      done_ = true;
+      handle = std::exchange(finish_handle_, nullptr);
+    }
+    // The coroutine may destroy this reactor.
+    if (handle) handle.resume();
+  }
+
+ private:
+  std::coroutine_handle<> read_handle_;
+  bool read_ok_ = false;
+  std::coroutine_handle<> write_handle_;
+  bool write_ok_ = false;
+  grpc::internal::Mutex mu_;
+  std::coroutine_handle<> finish_handle_ ABSL_GUARDED_BY(mu_);
+  bool done_ ABSL_GUARDED_BY(mu_) = false;
+  grpc::Status status_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_HAS_COROUTINES
+
+#endif  // GRPCPP_SUPPORT_COROUTINE_H
@@ -19,6 +19,8 @@
 #ifndef GRPCPP_SUPPORT_INTERCEPTOR_H
 #define GRPCPP_SUPPORT_INTERCEPTOR_H
 
+#include <stdint.h>
+
 #include <map>
 #include <memory>
 #include <string>
@@ -81,6 +83,12 @@ enum class InterceptionHookPoints {
   NUM_INTERCEPTION_HOOKS
 };
 
+/// Returns the bit of \a point in a set of hook points such as the one
+/// returned by \a Interceptor::InterceptedHookPoints.
+constexpr uint32_t HookPointBit(InterceptionHookPoints point) {
+  return uint32_t{1} << static_cast<int>(point);
+}
+
 /// Class that is passed as an argument to the \a Intercept method
 /// of the application's \a Interceptor interface implementation. It has five
 /// purposes:
@@ -223,6 +231,15 @@ class Interceptor {
   /// The one public method of an Interceptor interface. Override this to
   /// trigger the desired actions at the hook points described above.
   virtual void Intercept(InterceptorBatchMethods* methods) = 0;
+
+  /// EXPERIMENTAL: Returns the set of hook points, as a bitwise or of
+  /// \a HookPointBit values, that this interceptor acts on. \a Intercept is
+  /// not called for batches with none of them: the interceptor is skipped as
+  /// if it had called \a Proceed right away. It is asked once per RPC, when
+  /// the interceptor is added to it. PRE_SEND_CANCEL is delivered regardless,
+  /// and an interceptor that hijacks RPCs must include every hook point.
+  /// Currently only honored by client interceptors.
+  virtual uint32_t InterceptedHookPoints() const { return ~uint32_t{0}; }
 };
 
 }  // namespace experimental
@@ -0,0 +1,139 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_SUPPORT_LAZY_MESSAGE_H
+#define GRPCPP_SUPPORT_LAZY_MESSAGE_H
+
+#include <memory>
+#include <utility>
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/status.h>
+
+namespace grpc {
+namespace experimental {
+
+/// A message of type \a T that is kept in its serialized form until it is
+/// first looked at. Receiving one only takes a reference on the slices that
+/// arrived from the wire; parsing happens on the first call to message() or
+/// mutable_message(). As long as the message has not been mutated, sending it
+/// again (e.g. forwarding a request to a backend) reuses the original slices
+/// without copying or re-serializing them.
+///
+/// Services can receive their requests this way by running the C++ plugin
+/// with the `generate_lazy_request_methods=true` option, which adds a
+/// WithLazyRequestCallbackMethod_<Method> class for every method.
+///
+/// Not thread-safe: the first access mutates the object.
+template <class T>
+class LazyMessage {
+ public:
+  LazyMessage() = default;
+
+  /// Wraps already serialized bytes. Only references the slices of \a bytes.
+  explicit LazyMessage(const ByteBuffer& bytes) : bytes_(bytes) {}
+
+  /// Wraps an already parsed message, which will be serialized when sent.
+  explicit LazyMessage(T message)
+      : message_(new T(std::move(message))), modified_(true) {}
+
+  /// The serialized form of the message as it was received. Empty once the
+  /// message has been mutated or was constructed from a parsed message.
+  const ByteBuffer& bytes() const { return bytes_; }
+
+  /// Whether the message has been parsed already.
+  bool parsed() const { return message_ != nullptr; }
+
+  /// Parses the message on first call. Returns nullptr if the bytes are not a
+  /// valid \a T; status() then explains why.
+  const T* message() const { return Parse(); }
+
+  /// Like message(), but lets the message be changed. The received bytes are
+  /// dropped and the message will be serialized again when sent.
+  T* mutable_message() {
+    if (Parse() == nullptr) return nullptr;
+    bytes_.Clear();
+    modified_ = true;
+    return message_.get();
+  }
+
+  /// The result of parsing, or OK if the message has not been parsed yet.
+  const Status& status() const { return parse_status_; }
+
+ private:
+  friend class SerializationTraits<LazyMessage<T>, void>;
+
+  const T* Parse() const {
+    if (message_ == nullptr) {
+      message_.reset(new T());
+      if (bytes_.Valid()) {
+        // Deserializing consumes its input, so parse from a copy that shares
+        // the slices and keep bytes_ intact for forwarding.
+        ByteBuffer copy(bytes_);
+        parse_status_ =
+            SerializationTraits<T>::Deserialize(&copy, message_.get());
+      }
+    }
+    return parse_status_.ok() ? message_.get() : nullptr;
+  }
+
+  void Reset(ByteBuffer* bytes) {
+    bytes_.Swap(bytes);
+    message_.reset();
+    parse_status_ = Status::OK;
+    modified_ = false;
+  }
+
+  ByteBuffer bytes_;
+  mutable std::unique_ptr<T> message_;
+  mutable Status parse_status_;
+  bool modified_ = false;
+};
+
+}  // namespace experimental
+
+template <class T>
+class SerializationTraits<experimental::LazyMessage<T>, void> {
+ public:
+  // Takes ownership of the received slices without parsing them. Malformed
+  // messages are reported by LazyMessage::message() on first access.
+  static Status Deserialize(ByteBuffer* byte_buffer,
+                            experimental::LazyMessage<T>* dest) {
+    dest->Reset(byte_buffer);
+    return Status::OK;
+  }
+  static Status Serialize(const experimental::LazyMessage<T>& source,
+                          ByteBuffer* buffer, bool* own_buffer) {
+    if (!source.modified_ && source.bytes_.Valid()) {
+      *buffer = source.bytes_;
+      *own_buffer = true;
+      return Status::OK;
+    }
+    if (source.message_ == nullptr) {
+      return SerializationTraits<T>::Serialize(T(), buffer, own_buffer);
+    }
+    return SerializationTraits<T>::Serialize(*source.message_, buffer,
+                                             own_buffer);
+  }
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_LAZY_MESSAGE_H
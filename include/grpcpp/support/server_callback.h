@@ -125,6 +125,12 @@ class ServerCallbackCall {
   /// Increases the reference count
   void Ref() { callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed); }
 
+  // Marks all reactions of this call as inlineable, because the server was
+  // told (through GRPC_ARG_CALLBACK_REACTORS_NON_BLOCKING) that none of its
+  // reactors block. Must be called before the reactor is bound.
+  void set_non_blocking_reactions() { non_blocking_reactions_ = true; }
+  bool non_blocking_reactions() const { return non_blocking_reactions_; }
+
  private:
   virtual ServerReactor* reactor() = 0;
 
@@ -156,6 +162,7 @@ class ServerCallbackCall {
   std::atomic_int on_cancel_conditions_remaining_{2};
   std::atomic_int callbacks_outstanding_{
       3};  // reserve for start, Finish, and CompletionOp
+  bool non_blocking_reactions_ = false;
 };
 
 template <class Request, class Response>
@@ -216,6 +223,9 @@ class ServerCallbackReader : public internal::ServerCallbackCall {
   void BindReactor(ServerReadReactor<Request>* reactor) {
     reactor->InternalBindReader(this);
   }
+  static bool ReadAheadEnabled(const ServerReadReactor<Request>* reactor) {
+    return reactor->read_ahead_;
+  }
 };
 
 template <class Response>
@@ -226,6 +236,8 @@ class ServerCallbackWriter : public internal::ServerCallbackCall {
   virtual void Finish(grpc::Status s) = 0;
   virtual void SendInitialMetadata() = 0;
   virtual void Write(const Response* msg, grpc::WriteOptions options) = 0;
+  virtual void WriteBatch(const Response* const* msgs, size_t count,
+                          grpc::WriteOptions options) = 0;
   virtual void WriteAndFinish(const Response* msg, grpc::WriteOptions options,
                               grpc::Status s) = 0;
 
@@ -535,6 +547,15 @@ class ServerReadReactor : public internal::ServerReactor {
     reader->Finish(std::move(s));
   }
 
+  /// EXPERIMENTAL: Have the library read the next message as soon as the
+  /// previous one has been passed to OnReadDone, instead of when StartRead
+  /// is called, so that receiving it overlaps with the reactor's handling of
+  /// the previous one. A StartRead that finds the message already received
+  /// completes right away. At most one message is read ahead, so flow
+  /// control still limits what the client can send. Must be called before
+  /// the reactor is returned from the method handler.
+  void EnableReadAhead() { read_ahead_ = true; }
+
   /// The following notifications are exactly like ServerBidiReactor.
   virtual void OnSendInitialMetadataDone(bool /*ok*/) {}
   virtual void OnReadDone(bool /*ok*/) {}
@@ -544,6 +565,8 @@ class ServerReadReactor : public internal::ServerReactor {
  private:
   friend class ServerCallbackReader<Request>;
 
+  bool read_ahead_ = false;
+
   // May be overridden by internal implementation details. This is not a public
   // customization point.
   virtual void InternalBindReader(ServerCallbackReader<Request>* reader)
@@ -613,6 +636,37 @@ class ServerWriteReactor : public internal::ServerReactor {
     }
     writer->Write(resp, options);
   }
+  /// Initiate a batch of writes. The \a count messages in \a resps are
+  /// written in order, each one starting as soon as the previous one has
+  /// completed, without a round trip through the reactor in between.
+  /// OnWriteDone is called once for the whole batch: with ok=true after the
+  /// last message has been written, or with ok=false as soon as any of them
+  /// fails. A write batch counts as the single outstanding write, so it may
+  /// not overlap with StartWrite or another StartWriteBatch. Both the \a resps
+  /// array and the messages must remain valid until OnWriteDone.
+  ///
+  /// \param[in] resps The messages to be written, in order.
+  /// \param[in] count The number of messages; must be at least 1.
+  /// \param[in] options The WriteOptions for every message. If it marks the
+  ///                    last message, only the final message of the batch is
+  ///                    sent as the last message.
+  void StartWriteBatch(const Response* const* resps, size_t count,
+                       grpc::WriteOptions options)
+      ABSL_LOCKS_EXCLUDED(writer_mu_) {
+    ServerCallbackWriter<Response>* writer =
+        writer_.load(std::memory_order_acquire);
+    if (writer == nullptr) {
+      grpc::internal::MutexLock l(&writer_mu_);
+      writer = writer_.load(std::memory_order_relaxed);
+      if (writer == nullptr) {
+        backlog_.write_batch_wanted = resps;
+        backlog_.write_batch_count_wanted = count;
+        backlog_.write_options_wanted = options;
+        return;
+      }
+    }
+    writer->WriteBatch(resps, count, options);
+  }
   void StartWriteAndFinish(const Response* resp, grpc::WriteOptions options,
                            grpc::Status s) ABSL_LOCKS_EXCLUDED(writer_mu_) {
     ServerCallbackWriter<Response>* writer =
@@ -674,6 +728,11 @@ class ServerWriteReactor : public internal::ServerReactor {
         writer->Write(backlog_.write_wanted,
                       std::move(backlog_.write_options_wanted));
       }
+      if (GPR_UNLIKELY(backlog_.write_batch_wanted != nullptr)) {
+        writer->WriteBatch(backlog_.write_batch_wanted,
+                           backlog_.write_batch_count_wanted,
+                           std::move(backlog_.write_options_wanted));
+      }
       if (GPR_UNLIKELY(backlog_.finish_wanted)) {
         writer->Finish(std::move(backlog_.status_wanted));
       }
@@ -689,6 +748,8 @@ class ServerWriteReactor : public internal::ServerReactor {
     bool write_and_finish_wanted = false;
     bool finish_wanted = false;
     const Response* write_wanted = nullptr;
+    const Response* const* write_batch_wanted = nullptr;
+    size_t write_batch_count_wanted = 0;
     grpc::WriteOptions write_options_wanted;
     grpc::Status status_wanted;
   };
@@ -0,0 +1,62 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_SUPPORT_TCP_TRACER_H
+#define GRPCPP_SUPPORT_TCP_TRACER_H
+
+#include <stddef.h>
+
+#include <grpc/impl/codegen/gpr_types.h>
+
+namespace grpc {
+namespace experimental {
+
+/// EXPERIMENTAL: Receives the kernel timestamps of one rpc's writes to its
+/// TCP socket, on platforms that collect them (currently Linux). Together
+/// they show how long each write spent queued in the kernel and on the
+/// network. The timestamps of a write arrive once the peer has acked it,
+/// possibly after the rpc is over, on an internal thread; RecordEvent must
+/// not block.
+///
+/// Tracing costs a socket error-queue read per traced write, so it is meant
+/// for a sample of rpcs.
+class TcpTracer {
+ public:
+  enum class Event {
+    /// The write was passed to sendmsg().
+    kSendMsg,
+    /// The kernel scheduled the write's last byte for sending.
+    kScheduled,
+    /// The write's last byte was handed to the network interface.
+    kSent,
+    /// The peer acked the write's last byte.
+    kAcked,
+  };
+
+  virtual ~TcpTracer() {}
+
+  /// \a time is in GPR_CLOCK_REALTIME. \a byte_offset is the number of bytes
+  /// of the rpc written up to the end of the traced write.
+  virtual void RecordEvent(Event event, gpr_timespec time,
+                           size_t byte_offset) = 0;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_TCP_TRACER_H
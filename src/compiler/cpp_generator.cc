@@ -156,6 +156,9 @@ std::string GetHeaderIncludes(grpc_generator::File* file,
         "grpcpp/support/sync_stream.h",
     };
     std::vector<std::string> headers(headers_strs, array_end(headers_strs));
+    if (params.generate_lazy_request_methods) {
+      headers.push_back("grpcpp/support/lazy_message.h");
+    }
     PrintIncludes(printer.get(), headers, params.use_system_headers,
                   params.grpc_search_path);
     printer->Print(vars, "\n");
@@ -1115,6 +1118,78 @@ void PrintHeaderServerMethodRawCallback(
   printer->Print(*vars, "};\n");
 }
 
+void PrintHeaderServerMethodLazyRequestCallback(
+    grpc_generator::Printer* printer, const grpc_generator::Method* method,
+    std::map<std::string, std::string>* vars) {
+  (*vars)["Method"] = method->name();
+  // These will be disabled
+  (*vars)["Request"] = method->input_type_name();
+  (*vars)["Response"] = method->output_type_name();
+  // Requests stay serialized until the handler looks at them
+  (*vars)["RealRequest"] =
+      "::grpc::experimental::LazyMessage< " + method->input_type_name() + ">";
+  (*vars)["RealResponse"] = method->output_type_name();
+  printer->Print(*vars, "template <class BaseClass>\n");
+  printer->Print(*vars,
+                 "class WithLazyRequestCallbackMethod_$Method$ : public "
+                 "BaseClass {\n");
+  printer->Print(
+      " private:\n"
+      "  void BaseClassMustBeDerivedFromService(const Service* /*service*/) "
+      "{}\n");
+  printer->Print(" public:\n");
+  printer->Indent();
+  printer->Print(*vars, "WithLazyRequestCallbackMethod_$Method$() {\n");
+  if (method->NoStreaming()) {
+    printer->Print(*vars,
+                   "  ::grpc::Service::MarkMethodCallback($Idx$,\n"
+                   "      new ::grpc::internal::CallbackUnaryHandler< "
+                   "$RealRequest$, $RealResponse$>(\n"
+                   "        [this](\n"
+                   "               ::grpc::CallbackServerContext* context, "
+                   "const $RealRequest$* "
+                   "request, "
+                   "$RealResponse$* response) { return "
+                   "this->$Method$(context, request, response); }));\n");
+  } else if (ClientOnlyStreaming(method)) {
+    printer->Print(
+        *vars,
+        "  ::grpc::Service::MarkMethodCallback($Idx$,\n"
+        "      new ::grpc::internal::CallbackClientStreamingHandler< "
+        "$RealRequest$, $RealResponse$>(\n"
+        "        [this](\n"
+        "               ::grpc::CallbackServerContext* context, "
+        "$RealResponse$* response) "
+        "{ return this->$Method$(context, response); }));\n");
+  } else if (ServerOnlyStreaming(method)) {
+    printer->Print(
+        *vars,
+        "  ::grpc::Service::MarkMethodCallback($Idx$,\n"
+        "      new ::grpc::internal::CallbackServerStreamingHandler< "
+        "$RealRequest$, $RealResponse$>(\n"
+        "        [this](\n"
+        "               ::grpc::CallbackServerContext* context, "
+        "const $RealRequest$* request) { return "
+        "this->$Method$(context, request); }));\n");
+  } else if (method->BidiStreaming()) {
+    printer->Print(*vars,
+                   "  ::grpc::Service::MarkMethodCallback($Idx$,\n"
+                   "      new ::grpc::internal::CallbackBidiHandler< "
+                   "$RealRequest$, $RealResponse$>(\n"
+                   "        [this](\n"
+                   "               ::grpc::CallbackServerContext* context) "
+                   "{ return this->$Method$(context); }));\n");
+  }
+  printer->Print(*vars, "}\n");
+  printer->Print(*vars,
+                 "~WithLazyRequestCallbackMethod_$Method$() override {\n"
+                 "  BaseClassMustBeDerivedFromService(this);\n"
+                 "}\n");
+  PrintHeaderServerCallbackMethodsHelper(printer, method, vars);
+  printer->Outdent();
+  printer->Print(*vars, "};\n");
+}
+
 void PrintHeaderServerMethodStreamedUnary(
     grpc_generator::Printer* printer, const grpc_generator::Method* method,
     std::map<std::string, std::string>* vars) {
@@ -1328,7 +1403,8 @@ void PrintHeaderServerMethodRaw(grpc_generator::Printer* printer,
 
 void PrintHeaderService(grpc_generator::Printer* printer,
                         const grpc_generator::Service* service,
-                        std::map<std::string, std::string>* vars) {
+                        std::map<std::string, std::string>* vars,
+                        const Parameters& params) {
   (*vars)["Service"] = service->name();
 
   printer->Print(service->GetLeadingComments("//").c_str());
@@ -1479,6 +1555,15 @@ void PrintHeaderService(grpc_generator::Printer* printer,
     PrintHeaderServerMethodRawCallback(printer, service->method(i).get(), vars);
   }
 
+  // Server side - Lazy Request Callback
+  if (params.generate_lazy_request_methods) {
+    for (int i = 0; i < service->method_count(); ++i) {
+      (*vars)["Idx"] = as_string(i);
+      PrintHeaderServerMethodLazyRequestCallback(
+          printer, service->method(i).get(), vars);
+    }
+  }
+
   // Server side - Streamed Unary
   for (int i = 0; i < service->method_count(); ++i) {
     (*vars)["Idx"] = as_string(i);
@@ -1572,7 +1657,8 @@ std::string GetHeaderServices(grpc_generator::File* file,
     }
 
     for (int i = 0; i < file->service_count(); ++i) {
-      PrintHeaderService(printer.get(), file->service(i).get(), &vars);
+      PrintHeaderService(printer.get(), file->service(i).get(), &vars,
+                         params);
       printer->Print("\n");
     }
 
@@ -1662,6 +1748,9 @@ std::string GetSourceIncludes(grpc_generator::File* file,
         "grpcpp/impl/service_type.h",
         "grpcpp/support/sync_stream.h"};
     std::vector<std::string> headers(headers_strs, array_end(headers_strs));
+    if (params.generate_lazy_request_methods) {
+      headers.push_back("grpcpp/support/lazy_message.h");
+    }
     PrintIncludes(printer.get(), headers, params.use_system_headers,
                   params.grpc_search_path);
 
@@ -2188,6 +2277,9 @@ std::string GetMockIncludes(grpc_generator::File* file,
         "grpcpp/support/sync_stream.h",
     };
     std::vector<std::string> headers(headers_strs, array_end(headers_strs));
+    if (params.generate_lazy_request_methods) {
+      headers.push_back("grpcpp/support/lazy_message.h");
+    }
     PrintIncludes(printer.get(), headers, params.use_system_headers,
                   params.grpc_search_path);
 
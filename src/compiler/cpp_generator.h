@@ -64,6 +64,9 @@ struct Parameters {
   std::string message_header_extension;
   // Whether to include headers corresponding to imports in source file.
   bool include_import_headers;
+  // Generate WithLazyRequestCallbackMethod_<Method> classes whose handlers
+  // receive requests as grpc::experimental::LazyMessage.
+  bool generate_lazy_request_methods;
 };
 
 // Return the prologue of the generated header file.
@@ -0,0 +1,207 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/types/variant.h"
+
+#include <grpc/impl/codegen/grpc_types.h>
+
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/surface/channel_init.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/lib/transport/metadata_batch.h"
+
+namespace grpc_core {
+
+namespace {
+
+// How strongly a new estimate moves the limit.
+constexpr double kSmoothing = 0.2;
+// The number of samples the long-term latency average is taken over.
+constexpr double kLongWindow = 600;
+// How much slower than the long-term average calls may get before the limit
+// starts to shrink.
+constexpr double kTolerance = 1.5;
+// Calls to more distinct methods than this share a single limit, so that
+// clients cannot grow the registry by calling made-up methods.
+constexpr size_t kMaxMethods = 1000;
+
+struct Registry {
+  Mutex mu;
+  std::map<std::string, RefCountedPtr<AdaptiveConcurrencyLimit>> limits
+      ABSL_GUARDED_BY(mu);
+};
+
+// Holds an admitted call's slot in the limit; releases it when the call's
+// promise is destroyed, with the call's latency if it completed.
+class CallTracker {
+ public:
+  explicit CallTracker(RefCountedPtr<AdaptiveConcurrencyLimit> limit)
+      : limit_(std::move(limit)), start_(Timestamp::Now()) {}
+  CallTracker(const CallTracker&) = delete;
+  CallTracker& operator=(const CallTracker&) = delete;
+  CallTracker(CallTracker&& other) noexcept
+      : limit_(std::move(other.limit_)),
+        start_(other.start_),
+        latency_(other.latency_) {}
+  CallTracker& operator=(CallTracker&&) = delete;
+
+  ~CallTracker() {
+    if (limit_ != nullptr) limit_->Release(latency_);
+  }
+
+  void Complete() { latency_ = Timestamp::Now() - start_; }
+
+ private:
+  RefCountedPtr<AdaptiveConcurrencyLimit> limit_;
+  Timestamp start_;
+  absl::optional<Duration> latency_;
+};
+
+}  // namespace
+
+AdaptiveConcurrencyLimit::AdaptiveConcurrencyLimit(const Options& options)
+    : options_(options),
+      limit_(Clamp(options.initial_limit, options.min_limit,
+                   options.max_limit)) {}
+
+RefCountedPtr<AdaptiveConcurrencyLimit> AdaptiveConcurrencyLimit::ForMethod(
+    absl::string_view method, const Options& options) {
+  static NoDestruct<Registry> registry;
+  MutexLock lock(&registry->mu);
+  auto it = registry->limits.find(std::string(method));
+  if (it == registry->limits.end()) {
+    if (registry->limits.size() >= kMaxMethods) method = "";
+    it = registry->limits.emplace(std::string(method), nullptr).first;
+    if (it->second == nullptr) {
+      it->second = MakeRefCounted<AdaptiveConcurrencyLimit>(options);
+    }
+  }
+  return it->second;
+}
+
+bool AdaptiveConcurrencyLimit::TryAcquire() {
+  MutexLock lock(&mu_);
+  if (in_flight_ >= static_cast<int>(limit_)) return false;
+  ++in_flight_;
+  return true;
+}
+
+void AdaptiveConcurrencyLimit::Release(absl::optional<Duration> latency) {
+  MutexLock lock(&mu_);
+  const int in_flight = in_flight_--;
+  if (!latency.has_value()) return;
+  const double sample =
+      std::max(static_cast<double>(latency->millis()), 1.0);
+  if (long_latency_ms_ == 0) {
+    long_latency_ms_ = sample;
+  } else {
+    long_latency_ms_ += (sample - long_latency_ms_) / kLongWindow;
+  }
+  // After a period of overload the average is far above what calls take now;
+  // let it recover faster than the window alone would.
+  if (long_latency_ms_ / sample > 2) long_latency_ms_ *= 0.95;
+  // With few calls in flight the latency says nothing about how many more
+  // the server could take.
+  if (in_flight < limit_ / 2) return;
+  const double gradient =
+      Clamp(kTolerance * long_latency_ms_ / sample, 0.5, 1.0);
+  const double estimate = limit_ * gradient + sqrt(limit_);
+  limit_ = Clamp(limit_ * (1 - kSmoothing) + estimate * kSmoothing,
+                 options_.min_limit, options_.max_limit);
+}
+
+Duration AdaptiveConcurrencyLimit::PushbackDelay() {
+  MutexLock lock(&mu_);
+  // About the time it takes for a call in flight to finish and free a slot.
+  return Duration::Milliseconds(
+      std::max<int64_t>(1, static_cast<int64_t>(long_latency_ms_)));
+}
+
+int AdaptiveConcurrencyLimit::limit() {
+  MutexLock lock(&mu_);
+  return static_cast<int>(limit_);
+}
+
+int AdaptiveConcurrencyLimit::in_flight() {
+  MutexLock lock(&mu_);
+  return in_flight_;
+}
+
+const grpc_channel_filter AdaptiveConcurrencyFilter::kFilter =
+    MakePromiseBasedFilter<AdaptiveConcurrencyFilter, FilterEndpoint::kServer>(
+        "adaptive_concurrency");
+
+absl::StatusOr<AdaptiveConcurrencyFilter> AdaptiveConcurrencyFilter::Create(
+    const ChannelArgs& args, ChannelFilter::Args) {
+  AdaptiveConcurrencyLimit::Options options;
+  options.max_limit =
+      args.GetInt(GRPC_ARG_ADAPTIVE_CONCURRENCY_MAX_LIMIT).value_or(0);
+  options.initial_limit = std::min(options.initial_limit, options.max_limit);
+  return AdaptiveConcurrencyFilter(options);
+}
+
+ArenaPromise<ServerMetadataHandle> AdaptiveConcurrencyFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  const Slice* path =
+      call_args.client_initial_metadata->get_pointer(HttpPathMetadata());
+  auto limit = AdaptiveConcurrencyLimit::ForMethod(
+      path == nullptr ? absl::string_view() : path->as_string_view(),
+      options_);
+  if (!limit->TryAcquire()) {
+    auto md = ServerMetadataFromStatus(absl::ResourceExhaustedError(
+        "Server is at its concurrency limit for this method"));
+    md->Set(GrpcRetryPushbackMsMetadata(), limit->PushbackDelay());
+    return Immediate(std::move(md));
+  }
+  return [tracker = CallTracker(std::move(limit)),
+          next = next_promise_factory(std::move(call_args))]() mutable
+         -> Poll<ServerMetadataHandle> {
+    auto r = next();
+    if (!absl::holds_alternative<Pending>(r)) tracker.Complete();
+    return r;
+  };
+}
+
+void RegisterAdaptiveConcurrencyFilter(CoreConfiguration::Builder* builder) {
+  builder->channel_init()->RegisterStage(
+      GRPC_SERVER_CHANNEL, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
+      [](ChannelStackBuilder* builder) {
+        auto channel_args = builder->channel_args();
+        if (!channel_args.WantMinimalStack() &&
+            channel_args.GetInt(GRPC_ARG_ADAPTIVE_CONCURRENCY_MAX_LIMIT)
+                    .value_or(0) > 0) {
+          builder->PrependFilter(&AdaptiveConcurrencyFilter::kFilter);
+        }
+        return true;
+      });
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,104 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
+#define GRPC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/transport/transport.h"
+
+namespace grpc_core {
+
+// Estimates how many calls to one method a server can run at once before
+// they start queueing, from the latency of the calls it completes, using
+// the gradient algorithm: while the latency of recent calls stays close to
+// the long-term average the limit grows, and as it rises above that average
+// the limit shrinks in proportion.
+class AdaptiveConcurrencyLimit : public RefCounted<AdaptiveConcurrencyLimit> {
+ public:
+  struct Options {
+    double initial_limit = 20;
+    double min_limit = 1;
+    double max_limit = 1000;
+  };
+
+  explicit AdaptiveConcurrencyLimit(const Options& options);
+
+  // Returns the limit shared by all server channels of this process for
+  // \a method, creating it with \a options if needed: the options of the
+  // first channel to see a call to the method apply.
+  static RefCountedPtr<AdaptiveConcurrencyLimit> ForMethod(
+      absl::string_view method, const Options& options);
+
+  // Admits a call if fewer than limit() calls are in flight. Each admitted
+  // call must be released with Release().
+  bool TryAcquire();
+  // Releases an admitted call. \a latency is how long the call took, or
+  // nullopt if it did not complete (for example because it was cancelled),
+  // in which case it does not affect the limit.
+  void Release(absl::optional<Duration> latency);
+
+  // How long a rejected client should wait before retrying.
+  Duration PushbackDelay();
+
+  int limit();
+  int in_flight();
+
+ private:
+  const Options options_;
+  Mutex mu_;
+  double limit_ ABSL_GUARDED_BY(mu_);
+  int in_flight_ ABSL_GUARDED_BY(mu_) = 0;
+  // Long-term exponential average of the latency, in milliseconds; zero
+  // until the first sample.
+  double long_latency_ms_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+// Server filter that rejects calls beyond their method's
+// AdaptiveConcurrencyLimit with RESOURCE_EXHAUSTED, asking the client to
+// retry after the limit's PushbackDelay().
+class AdaptiveConcurrencyFilter final : public ChannelFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<AdaptiveConcurrencyFilter> Create(
+      const ChannelArgs& args, ChannelFilter::Args);
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override;
+
+ private:
+  explicit AdaptiveConcurrencyFilter(AdaptiveConcurrencyLimit::Options options)
+      : options_(options) {}
+
+  AdaptiveConcurrencyLimit::Options options_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
@@ -21,7 +21,10 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <functional>
+#include <map>
+#include <memory>
 #include <utility>
 
 #include "absl/types/optional.h"
@@ -34,9 +37,11 @@
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -78,16 +83,109 @@ TraceFlag grpc_trace_client_idle_filter(false, "client_idle_filter");
 namespace {
 
 Duration GetClientIdleTimeout(const ChannelArgs& args) {
+  // A channel that keeps a warm connection never goes idle.
+  if (args.GetBool(GRPC_ARG_PREWARM_CONNECTION).value_or(false)) {
+    return Duration::Infinity();
+  }
   return args.GetDurationFromIntMillis(GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS)
       .value_or(kDefaultIdleTimeout);
 }
 
+// Hands out max age drains to connections no more often than they ask for,
+// so that connections accepted in a burst do not all send GOAWAY (and have
+// their clients reconnect) in a burst a max age later.  When several
+// connections are waiting, the one with the fewest calls in progress goes
+// first.
+class MaxAgeDrainScheduler {
+ public:
+  static MaxAgeDrainScheduler* Get() {
+    static MaxAgeDrainScheduler* scheduler = new MaxAgeDrainScheduler();
+    return scheduler;
+  }
+
+  // Returns true if the connection identified by \a key may be drained now.
+  // Otherwise, the current activity is woken up once it may be.
+  bool PollSlot(const void* key, Duration interval,
+                std::shared_ptr<IdleFilterState> state) {
+    MutexLock lock(&mu_);
+    auto it = waiters_.find(key);
+    if (it != waiters_.end()) {
+      if (!it->second.granted) return false;
+      waiters_.erase(it);
+      return true;
+    }
+    const Timestamp now = Timestamp::Now();
+    if (waiters_.empty() && now >= next_slot_) {
+      next_slot_ = now + interval;
+      return true;
+    }
+    waiters_.emplace(key, Waiter{interval, std::move(state),
+                                 Activity::current()->MakeNonOwningWaker(),
+                                 false});
+    MaybeStartTimerLocked();
+    return false;
+  }
+
+  void Remove(const void* key) {
+    MutexLock lock(&mu_);
+    waiters_.erase(key);
+  }
+
+ private:
+  struct Waiter {
+    Duration interval;
+    std::shared_ptr<IdleFilterState> state;
+    Waker waker;
+    bool granted;
+  };
+
+  void MaybeStartTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (timer_pending_) return;
+    timer_pending_ = true;
+    grpc_event_engine::experimental::GetDefaultEventEngine()->RunAfter(
+        std::max(Duration::Zero(), next_slot_ - Timestamp::Now()), [this] {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          OnTimer();
+        });
+  }
+
+  void OnTimer() {
+    Waker waker;
+    {
+      MutexLock lock(&mu_);
+      timer_pending_ = false;
+      Waiter* next = nullptr;
+      for (auto& p : waiters_) {
+        Waiter& waiter = p.second;
+        if (waiter.granted) continue;
+        if (next == nullptr || waiter.state->CallsInProgress() <
+                                   next->state->CallsInProgress()) {
+          next = &waiter;
+        }
+      }
+      if (next == nullptr) return;
+      next->granted = true;
+      next_slot_ = Timestamp::Now() + next->interval;
+      waker = std::move(next->waker);
+      if (waiters_.size() > 1) MaybeStartTimerLocked();
+    }
+    waker.Wakeup();
+  }
+
+  Mutex mu_;
+  std::map<const void*, Waiter> waiters_ ABSL_GUARDED_BY(mu_);
+  Timestamp next_slot_ ABSL_GUARDED_BY(mu_);
+  bool timer_pending_ ABSL_GUARDED_BY(mu_) = false;
+};
+
 }  // namespace
 
 struct MaxAgeFilter::Config {
   Duration max_connection_age;
   Duration max_connection_idle;
   Duration max_connection_age_grace;
+  Duration drain_interval;
 
   bool enable() const {
     return max_connection_age != Duration::Infinity() ||
@@ -113,9 +211,16 @@ struct MaxAgeFilter::Config {
     const double multiplier =
         rand() * kMaxConnectionAgeJitter * 2.0 / RAND_MAX + 1.0 -
         kMaxConnectionAgeJitter;
+    const int drains_per_second =
+        args.GetInt(GRPC_ARG_MAX_CONNECTION_AGE_DRAINS_PER_SECOND).value_or(0);
+    const Duration drain_interval =
+        drains_per_second > 0
+            ? Duration::Milliseconds(std::max(1, 1000 / drains_per_second))
+            : Duration::Zero();
     /* GRPC_MILLIS_INF_FUTURE - 0.5 converts the value to float, so that result
        will not be cast to int implicitly before the comparison. */
-    return Config{args_max_age * multiplier, args_max_idle, args_max_age_grace};
+    return Config{args_max_age * multiplier, args_max_idle, args_max_age_grace,
+                  drain_interval};
   }
 };
 
@@ -133,11 +238,29 @@ absl::StatusOr<MaxAgeFilter> MaxAgeFilter::Create(
   return absl::StatusOr<MaxAgeFilter>(std::move(filter));
 }
 
+MaxAgeFilter::~MaxAgeFilter() {
+  if (drain_interval_ != Duration::Zero()) {
+    MaxAgeDrainScheduler::Get()->Remove(this);
+  }
+}
+
 void MaxAgeFilter::Shutdown() {
   max_age_activity_.Reset();
+  if (drain_interval_ != Duration::Zero()) {
+    MaxAgeDrainScheduler::Get()->Remove(this);
+  }
   ChannelIdleFilter::Shutdown();
 }
 
+Poll<absl::Status> MaxAgeFilter::PollDrainSlot() {
+  if (drain_interval_ == Duration::Zero() ||
+      MaxAgeDrainScheduler::Get()->PollSlot(this, drain_interval_,
+                                            idle_filter_state())) {
+    return absl::OkStatus();
+  }
+  return Pending{};
+}
+
 void MaxAgeFilter::PostInit() {
   struct StartupClosure {
     RefCountedPtr<grpc_channel_stack> channel_stack;
@@ -170,6 +293,8 @@ void MaxAgeFilter::PostInit() {
         TrySeq(
             // First sleep until the max connection age
             Sleep(Timestamp::Now() + max_connection_age_),
+            // Then wait for our turn to drain
+            [this] { return [this] { return PollDrainSlot(); }; },
             // Then send a goaway.
             [this] {
               GRPC_CHANNEL_STACK_REF(this->channel_stack(),
@@ -310,6 +435,7 @@ MaxAgeFilter::MaxAgeFilter(grpc_channel_stack* channel_stack,
                            const Config& max_age_config)
     : ChannelIdleFilter(channel_stack, max_age_config.max_connection_idle),
       max_connection_age_(max_age_config.max_connection_age),
-      max_connection_age_grace_(max_age_config.max_connection_age_grace) {}
+      max_connection_age_grace_(max_age_config.max_connection_age_grace),
+      drain_interval_(max_age_config.drain_interval) {}
 
 }  // namespace grpc_core
@@ -34,6 +34,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/transport.h"
 
@@ -71,6 +72,10 @@ class ChannelIdleFilter : public ChannelFilter {
   void IncreaseCallCount();
   void DecreaseCallCount();
 
+  const std::shared_ptr<IdleFilterState>& idle_filter_state() const {
+    return idle_filter_state_;
+  }
+
  private:
   void StartIdleTimer();
 
@@ -108,6 +113,10 @@ class MaxAgeFilter final : public ChannelIdleFilter {
   static absl::StatusOr<MaxAgeFilter> Create(const ChannelArgs& args,
                                              ChannelFilter::Args filter_args);
 
+  MaxAgeFilter(MaxAgeFilter&&) = default;
+  MaxAgeFilter& operator=(MaxAgeFilter&&) = default;
+  ~MaxAgeFilter() override;
+
   void PostInit() override;
 
  private:
@@ -131,9 +140,15 @@ class MaxAgeFilter final : public ChannelIdleFilter {
 
   void Shutdown() override;
 
+  // Resolves once this connection may be drained without exceeding
+  // GRPC_ARG_MAX_CONNECTION_AGE_DRAINS_PER_SECOND.
+  Poll<absl::Status> PollDrainSlot();
+
   SingleSetActivityPtr max_age_activity_;
   Duration max_connection_age_;
   Duration max_connection_age_grace_;
+  // Minimum time between two max age drains in the process, or zero.
+  Duration drain_interval_;
 };
 
 }  // namespace grpc_core
@@ -21,76 +21,55 @@
 namespace grpc_core {
 
 IdleFilterState::IdleFilterState(bool start_timer)
-    : state_(start_timer ? kTimerStarted : 0) {}
+    : timer_started_(start_timer) {}
 
 void IdleFilterState::IncreaseCallCount() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  do {
-    // Increment the counter, and flag that there's been activity.
-    new_state = state;
-    new_state |= kCallsStartedSinceLastTimerCheck;
-    new_state += kCallIncrement;
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
+  shards_.this_cpu().started.fetch_add(1);
 }
 
 bool IdleFilterState::DecreaseCallCount() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  bool start_timer;
-  do {
-    start_timer = false;
-    new_state = state;
-    // Decrement call count (and assert there's at least one call outstanding!)
-    assert(new_state >= kCallIncrement);
-    new_state -= kCallIncrement;
-    // If that decrement reaches a call count of zero and we have not started a
-    // timer
-    if ((new_state >> kCallsInProgressShift) == 0 &&
-        (new_state & kTimerStarted) == 0) {
-      // Flag that we will start a timer, and mark it started so nobody else
-      // does.
-      start_timer = true;
-      new_state |= kTimerStarted;
-      new_state &= ~kCallsInProgressShift;
-    }
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
-  return start_timer;
+  shards_.this_cpu().finished.fetch_add(1);
+  // With a timer running (the common case on a busy channel) there is
+  // nothing more to do: the timer will see this call when it next fires.
+  if (timer_started_.load()) return false;
+  // Otherwise start one if we reached idle.  Whichever of the calls finishing
+  // last sums the shards after the others' updates, and sees zero.
+  Counts counts = CallCounts();
+  assert(counts.started >= counts.finished);
+  if (counts.in_progress() != 0) return false;
+  // Flag that we will start a timer, and mark it started so nobody else
+  // does.
+  return !timer_started_.exchange(true);
 }
 
 bool IdleFilterState::CheckTimer() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  bool start_timer;
-  do {
-    if ((state >> kCallsInProgressShift) != 0) {
-      // Still calls in progress: nothing needs updating, just return
-      // and keep the timer going!
-      return true;
-    }
-    new_state = state;
-    bool is_active = false;
-    if (new_state & kCallsStartedSinceLastTimerCheck) {
-      // If any calls started since the last time we checked, then consider the
-      // channel still active and try again.
-      is_active = true;
-      new_state &= ~kCallsStartedSinceLastTimerCheck;
-    }
-    if (is_active) {
-      // If we are still active, we should signal that the timer should start
-      // again.
-      start_timer = true;
-    } else {
-      // Otherwise, we should not start the timer again, and we should signal
-      // that in the updated state.
-      start_timer = false;
-      new_state &= ~kTimerStarted;
-    }
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
-  return start_timer;
+  Counts counts = CallCounts();
+  if (counts.in_progress() != 0) {
+    // Still calls in progress: keep the timer going!
+    return true;
+  }
+  if (counts.started != started_at_last_check_) {
+    // If any calls started since the last time we checked, then consider the
+    // channel still active and try again.
+    started_at_last_check_ = counts.started;
+    return true;
+  }
+  // Otherwise the channel has been idle for one full cycle: stop the timer.
+  // A call that started after the sums above is no different from one that
+  // starts just after the channel goes idle: if it is still in progress now,
+  // finishing it will start a new timer.
+  timer_started_.store(false);
+  return false;
+}
+
+IdleFilterState::Counts IdleFilterState::CallCounts() const {
+  // Sum finished before started: every call counted as finished is then also
+  // counted as started, and a call in progress at the moment between the two
+  // loops is counted as started but not finished.
+  Counts counts{0, 0};
+  for (const Shard& shard : shards_) counts.finished += shard.finished.load();
+  for (const Shard& shard : shards_) counts.started += shard.started.load();
+  return counts;
 }
 
 }  // namespace grpc_core
@@ -21,11 +21,18 @@
 
 #include <atomic>
 
+#include "src/core/lib/gprpp/per_cpu.h"
+
 namespace grpc_core {
 
 // State machine for the idle filter.
 // Keeps track of how many calls are in progress, whether there is a timer
 // started, and whether we've seen calls since the previous timer fired.
+//
+// Calls are counted per CPU, so that starting and finishing calls on a busy
+// channel does not bounce a shared cache line between cores; the counts are
+// only summed when a timer fires, or when a call finishes with no timer
+// running.
 class IdleFilterState {
  public:
   explicit IdleFilterState(bool start_timer);
@@ -48,19 +55,37 @@ class IdleFilterState {
   // we know that the channel is idle and has been for one full cycle.
   GRPC_MUST_USE_RESULT bool CheckTimer();
 
+  // Returns the number of calls in progress.  May be stale by the time the
+  // caller looks at it.
+  uintptr_t CallsInProgress() const {
+    return static_cast<uintptr_t>(CallCounts().in_progress());
+  }
+
  private:
-  // Bit in state_ indicating that the timer has been started.
-  static constexpr uintptr_t kTimerStarted = 1;
-  // Bit in state_ indicating that we've seen a call start or stop since the
-  // last timer.
-  static constexpr uintptr_t kCallsStartedSinceLastTimerCheck = 2;
-  // How much should we shift to get the number of calls in progress.
-  static constexpr uintptr_t kCallsInProgressShift = 2;
-  // How much to increment/decrement the state_ when a call is started/stopped.
-  // Ensures we don't clobber the preceding bits.
-  static constexpr uintptr_t kCallIncrement = uintptr_t(1)
-                                              << kCallsInProgressShift;
-  std::atomic<uintptr_t> state_;
+  // Calls started and finished on one CPU.  A call may start and finish on
+  // different CPUs, so only the sums are meaningful.  Both only ever grow, so
+  // that a sum of finished calls taken before a sum of started calls can never
+  // miss a call that was in progress in between.
+  struct Shard {
+    std::atomic<uint64_t> started{0};
+    std::atomic<uint64_t> finished{0};
+    char padding[GPR_CACHELINE_SIZE];
+  };
+  struct Counts {
+    uint64_t started;
+    uint64_t finished;
+    uint64_t in_progress() const { return started - finished; }
+  };
+  // Sums the shards: zero calls in progress means that there was a moment
+  // while summing at which no call was in progress.
+  Counts CallCounts() const;
+
+  PerCpu<Shard> shards_;
+  // Whether the timer has been started.  Only DecreaseCallCount() sets it,
+  // and only the timer (in CheckTimer()) clears it.
+  std::atomic<bool> timer_started_;
+  // Calls started as of the previous timer check.  Only the timer touches it.
+  uint64_t started_at_last_check_ = 0;
 };
 
 }  // namespace grpc_core
@@ -31,6 +31,10 @@ namespace grpc_core {
 
 namespace {
 
+// Enough for the upb arena's own bookkeeping plus a typical report, so that
+// parsing the report of every call does not allocate an arena on the heap.
+constexpr size_t kParseArenaSize = 1024;
+
 template <typename EntryType>
 std::map<absl::string_view, double> ParseMap(
     xds_data_orca_v3_OrcaLoadReport* msg,
@@ -57,7 +61,7 @@ std::map<absl::string_view, double> ParseMap(
 const BackendMetricData* ParseBackendMetricData(
     absl::string_view serialized_load_report,
     BackendMetricAllocatorInterface* allocator) {
-  upb::Arena upb_arena;
+  upb::InlinedArena<kParseArenaSize> upb_arena;
   xds_data_orca_v3_OrcaLoadReport* msg = xds_data_orca_v3_OrcaLoadReport_parse(
       serialized_load_report.data(), serialized_load_report.size(),
       upb_arena.ptr());
@@ -68,6 +72,7 @@ const BackendMetricData* ParseBackendMetricData(
       xds_data_orca_v3_OrcaLoadReport_cpu_utilization(msg);
   backend_metric_data->mem_utilization =
       xds_data_orca_v3_OrcaLoadReport_mem_utilization(msg);
+  backend_metric_data->qps = xds_data_orca_v3_OrcaLoadReport_rps(msg);
   backend_metric_data->request_cost =
       ParseMap<xds_data_orca_v3_OrcaLoadReport_RequestCostEntry>(
           msg, xds_data_orca_v3_OrcaLoadReport_request_cost_next,
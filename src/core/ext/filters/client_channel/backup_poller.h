@@ -29,7 +29,8 @@ GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_client_channel_backup_poll_interval_ms);
 /* Initializes backup polling. */
 void grpc_client_channel_global_init_backup_polling();
 
-/* Starts polling \a interested_parties periodically in the timer thread. */
+/* Starts polling \a interested_parties periodically in the timer thread.
+ * Does nothing if the iomgr polls in the background. */
 void grpc_client_channel_start_backup_polling(
     grpc_pollset_set* interested_parties);
 
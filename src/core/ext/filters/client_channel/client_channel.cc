@@ -20,8 +20,10 @@
 
 #include <inttypes.h>
 #include <limits.h>
+#include <time.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <new>
 #include <set>
@@ -43,6 +45,7 @@
 #include <grpc/status.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/filters/client_channel/backend_metric.h"
 #include "src/core/ext/filters/client_channel/backup_poller.h"
@@ -79,6 +82,7 @@
 #include "src/core/lib/resolver/server_address.h"
 #include "src/core/lib/service_config/service_config_call_data.h"
 #include "src/core/lib/service_config/service_config_impl.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/transport/connectivity_state.h"
@@ -184,6 +188,8 @@ class ClientChannel::CallData {
   // calls queued for name resolution.
   void MaybeAddCallToResolverQueuedCallsLocked(grpc_call_element* elem)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::resolution_mu_);
+  // Annotates the call's tracer, if any, with \a phase.
+  void RecordPhase(CallTracer::Phase phase);
 
   static void RecvTrailingMetadataReadyForConfigSelectorCommitCallback(
       void* arg, grpc_error_handle error);
@@ -251,7 +257,7 @@ const grpc_channel_filter ClientChannel::kFilterVtable = {
     ClientChannel::CallData::Destroy,
     sizeof(ClientChannel),
     ClientChannel::Init,
-    grpc_channel_stack_no_post_init,
+    ClientChannel::PostInit,
     ClientChannel::Destroy,
     ClientChannel::GetChannelInfo,
     "client-channel",
@@ -430,31 +436,37 @@ class ClientChannel::ResolverResultHandler : public Resolver::ResultHandler {
 class ClientChannel::SubchannelWrapper : public SubchannelInterface {
  public:
   SubchannelWrapper(ClientChannel* chand, RefCountedPtr<Subchannel> subchannel,
-                    absl::optional<std::string> health_check_service_name)
+                    absl::optional<std::string> health_check_service_name,
+                    const grpc_resolved_address& address,
+                    const ChannelArgs& subchannel_args)
       : SubchannelInterface(GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_trace)
                                 ? "SubchannelWrapper"
                                 : nullptr),
         chand_(chand),
         subchannel_(std::move(subchannel)),
-        health_check_service_name_(std::move(health_check_service_name)) {
+        health_check_service_name_(std::move(health_check_service_name)),
+        address_(address),
+        subchannel_args_(subchannel_args),
+        max_connections_(std::max(
+            1, subchannel_args.GetInt(GRPC_ARG_MAX_CONNECTIONS_PER_ADDRESS)
+                   .value_or(1))),
+        target_streams_per_connection_(std::max(
+            1, subchannel_args.GetInt(GRPC_ARG_TARGET_STREAMS_PER_CONNECTION)
+                   .value_or(100))) {
+    // The subchannel may have been created for another authority, in which
+    // case its default authority is not ours.
+    if (subchannel_args.GetBool(GRPC_ARG_HTTP2_CONNECTION_COALESCING)
+            .value_or(false)) {
+      authority_ = Slice::FromCopiedString(
+          subchannel_args.GetString(GRPC_ARG_DEFAULT_AUTHORITY).value_or(""));
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_trace)) {
       gpr_log(GPR_INFO,
               "chand=%p: creating subchannel wrapper %p for subchannel %p",
               chand, this, subchannel_.get());
     }
     GRPC_CHANNEL_STACK_REF(chand_->owning_stack_, "SubchannelWrapper");
-    if (chand_->channelz_node_ != nullptr) {
-      auto* subchannel_node = subchannel_->channelz_node();
-      if (subchannel_node != nullptr) {
-        auto it = chand_->subchannel_refcount_map_.find(subchannel_.get());
-        if (it == chand_->subchannel_refcount_map_.end()) {
-          chand_->channelz_node_->AddChildSubchannel(subchannel_node->uuid());
-          it = chand_->subchannel_refcount_map_.emplace(subchannel_.get(), 0)
-                   .first;
-        }
-        ++it->second;
-      }
-    }
+    AddChannelzChild(subchannel_.get());
     chand_->subchannel_wrappers_.insert(this);
   }
 
@@ -465,17 +477,11 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
               chand_, this, subchannel_.get());
     }
     chand_->subchannel_wrappers_.erase(this);
-    if (chand_->channelz_node_ != nullptr) {
-      auto* subchannel_node = subchannel_->channelz_node();
-      if (subchannel_node != nullptr) {
-        auto it = chand_->subchannel_refcount_map_.find(subchannel_.get());
-        GPR_ASSERT(it != chand_->subchannel_refcount_map_.end());
-        --it->second;
-        if (it->second == 0) {
-          chand_->channelz_node_->RemoveChildSubchannel(
-              subchannel_node->uuid());
-          chand_->subchannel_refcount_map_.erase(it);
-        }
+    RemoveChannelzChild(subchannel_.get());
+    {
+      MutexLock lock(&connections_mu_);
+      for (const auto& subchannel : extra_subchannels_) {
+        RemoveChannelzChild(subchannel.get());
       }
     }
     GRPC_CHANNEL_STACK_UNREF(chand_->owning_stack_, "SubchannelWrapper");
@@ -503,13 +509,29 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
     watcher_map_.erase(it);
   }
 
-  RefCountedPtr<ConnectedSubchannel> connected_subchannel() const {
-    return subchannel_->connected_subchannel();
+  // Returns the connection to use for a call.  Called from the data plane.
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel() {
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+        subchannel_->connected_subchannel();
+    if (max_connections_ == 1 || connected_subchannel == nullptr) {
+      return connected_subchannel;
+    }
+    return PickConnection(std::move(connected_subchannel));
   }
 
+  // The :authority to set on calls that do not have one, or an empty slice
+  // to leave that to the subchannel.
+  const Slice& authority() const { return authority_; }
+
   void RequestConnection() override { subchannel_->RequestConnection(); }
 
-  void ResetBackoff() override { subchannel_->ResetBackoff(); }
+  void ResetBackoff() override {
+    subchannel_->ResetBackoff();
+    MutexLock lock(&connections_mu_);
+    for (const auto& subchannel : extra_subchannels_) {
+      subchannel->ResetBackoff();
+    }
+  }
 
   void AddDataWatcher(std::unique_ptr<DataWatcherInterface> watcher) override
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand_->work_serializer_) {
@@ -522,6 +544,10 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
 
   void ThrottleKeepaliveTime(int new_keepalive_time) {
     subchannel_->ThrottleKeepaliveTime(new_keepalive_time);
+    MutexLock lock(&connections_mu_);
+    for (const auto& subchannel : extra_subchannels_) {
+      subchannel->ThrottleKeepaliveTime(new_keepalive_time);
+    }
   }
 
  private:
@@ -646,9 +672,155 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
     WatcherWrapper* replacement_ = nullptr;
   };
 
+  void AddChannelzChild(Subchannel* subchannel) {
+    if (chand_->channelz_node_ == nullptr) return;
+    auto* subchannel_node = subchannel->channelz_node();
+    if (subchannel_node == nullptr) return;
+    auto it = chand_->subchannel_refcount_map_.find(subchannel);
+    if (it == chand_->subchannel_refcount_map_.end()) {
+      chand_->channelz_node_->AddChildSubchannel(subchannel_node->uuid());
+      it = chand_->subchannel_refcount_map_.emplace(subchannel, 0).first;
+    }
+    ++it->second;
+  }
+
+  void RemoveChannelzChild(Subchannel* subchannel) {
+    if (chand_->channelz_node_ == nullptr) return;
+    auto* subchannel_node = subchannel->channelz_node();
+    if (subchannel_node == nullptr) return;
+    auto it = chand_->subchannel_refcount_map_.find(subchannel);
+    GPR_ASSERT(it != chand_->subchannel_refcount_map_.end());
+    --it->second;
+    if (it->second == 0) {
+      chand_->channelz_node_->RemoveChildSubchannel(subchannel_node->uuid());
+      chand_->subchannel_refcount_map_.erase(it);
+    }
+  }
+
+  // Returns the connection with the fewest active calls, and asks the
+  // control plane to grow or shrink the pool if the load calls for it.
+  RefCountedPtr<ConnectedSubchannel> PickConnection(
+      RefCountedPtr<ConnectedSubchannel> primary) {
+    RefCountedPtr<ConnectedSubchannel> best = std::move(primary);
+    size_t best_calls = best->active_calls();
+    size_t total_calls = best_calls;
+    size_t connections;
+    bool all_connected = true;
+    {
+      MutexLock lock(&connections_mu_);
+      connections = extra_subchannels_.size() + 1;
+      for (const auto& subchannel : extra_subchannels_) {
+        RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+            subchannel->connected_subchannel();
+        if (connected_subchannel == nullptr) {
+          all_connected = false;
+          continue;
+        }
+        const size_t calls = connected_subchannel->active_calls();
+        total_calls += calls;
+        if (calls < best_calls) {
+          best = std::move(connected_subchannel);
+          best_calls = calls;
+        }
+      }
+    }
+    // Grow while even the least loaded connection is at the target.  While
+    // an extra connection is not connected, only ask for it to be
+    // (re)connected.  Shrink once the load would fill no more than half of
+    // the remaining connections, so that a steady load does not flap.
+    if (best_calls >= target_streams_per_connection_) {
+      if (!all_connected) {
+        RequestResize(connections);
+      } else if (connections < max_connections_) {
+        RequestResize(connections + 1);
+      }
+    } else if (connections > 1 &&
+               2 * total_calls <
+                   (connections - 1) * target_streams_per_connection_) {
+      RequestResize(connections - 1);
+    }
+    return best;
+  }
+
+  void RequestResize(size_t connections) {
+    if (resize_pending_.exchange(true, std::memory_order_relaxed)) return;
+    // This is called from the data plane, so hop into the ExecCtx before
+    // entering the WorkSerializer.
+    Ref(DEBUG_LOCATION, "ResizeLocked").release();
+    ExecCtx::Run(
+        DEBUG_LOCATION,
+        NewClosure([this, connections](grpc_error_handle /*error*/) {
+          chand_->work_serializer_->Run(
+              [this, connections]()
+                  ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand_->work_serializer_) {
+                    ResizeLocked(connections);
+                    Unref(DEBUG_LOCATION, "ResizeLocked");
+                  },
+              DEBUG_LOCATION);
+        }),
+        absl::OkStatus());
+  }
+
+  // Adds or removes one extra connection to get closer to the requested
+  // number, and requests a connection on every extra subchannel.
+  void ResizeLocked(size_t connections)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand_->work_serializer_) {
+    resize_pending_.store(false, std::memory_order_relaxed);
+    // Calls already started on a removed connection keep it open until
+    // they finish.
+    RefCountedPtr<Subchannel> removed;
+    std::vector<RefCountedPtr<Subchannel>> extra_subchannels;
+    {
+      MutexLock lock(&connections_mu_);
+      if (connections < extra_subchannels_.size() + 1) {
+        removed = std::move(extra_subchannels_.back());
+        extra_subchannels_.pop_back();
+      }
+      extra_subchannels = extra_subchannels_;
+    }
+    if (removed != nullptr) RemoveChannelzChild(removed.get());
+    if (connections > extra_subchannels.size() + 1 &&
+        chand_->resolver_ != nullptr) {
+      RefCountedPtr<Subchannel> subchannel =
+          chand_->client_channel_factory_->CreateSubchannel(
+              address_, subchannel_args_.Set(
+                            GRPC_ARG_SUBCHANNEL_CONNECTION_INDEX,
+                            static_cast<int>(extra_subchannels.size() + 1)));
+      if (subchannel != nullptr) {
+        subchannel->ThrottleKeepaliveTime(chand_->keepalive_time_);
+        AddChannelzChild(subchannel.get());
+        extra_subchannels.push_back(subchannel);
+        MutexLock lock(&connections_mu_);
+        extra_subchannels_.push_back(std::move(subchannel));
+      }
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p: subchannel wrapper %p now has %" PRIuPTR
+              " connection(s), %" PRIuPTR " requested",
+              chand_, this, extra_subchannels.size() + 1, connections);
+    }
+    for (const auto& subchannel : extra_subchannels) {
+      subchannel->RequestConnection();
+    }
+  }
+
   ClientChannel* chand_;
+  // The primary connection.  The LB policy sees only its state; extra
+  // connections opened under GRPC_ARG_MAX_CONNECTIONS_PER_ADDRESS just
+  // carry calls.
   RefCountedPtr<Subchannel> subchannel_;
   absl::optional<std::string> health_check_service_name_;
+  const grpc_resolved_address address_;
+  const ChannelArgs subchannel_args_;
+  const size_t max_connections_;
+  const size_t target_streams_per_connection_;
+  // Set under GRPC_ARG_HTTP2_CONNECTION_COALESCING.
+  Slice authority_;
+  Mutex connections_mu_;
+  std::vector<RefCountedPtr<Subchannel>> extra_subchannels_
+      ABSL_GUARDED_BY(connections_mu_);
+  std::atomic<bool> resize_pending_{false};
   // Maps from the address of the watcher passed to us by the LB policy
   // to the address of the WrapperWatcher that we passed to the underlying
   // subchannel.  This is needed so that when the LB policy calls
@@ -880,7 +1052,8 @@ class ClientChannel::ClientChannelControlHelper
     subchannel->ThrottleKeepaliveTime(chand_->keepalive_time_);
     // Create and return wrapper for the subchannel.
     return MakeRefCounted<SubchannelWrapper>(
-        chand_, std::move(subchannel), std::move(health_check_service_name));
+        chand_, std::move(subchannel), std::move(health_check_service_name),
+        address.address(), subchannel_args);
   }
 
   void UpdateState(
@@ -961,6 +1134,16 @@ grpc_error_handle ClientChannel::Init(grpc_channel_element* elem,
   return error;
 }
 
+void ClientChannel::PostInit(grpc_channel_stack* /*stack*/,
+                             grpc_channel_element* elem) {
+  ClientChannel* chand = static_cast<ClientChannel*>(elem->channel_data);
+  // Start connecting now that the channel stack is complete.
+  if (chand->channel_args_.GetBool(GRPC_ARG_PREWARM_CONNECTION)
+          .value_or(false)) {
+    chand->CheckConnectivityState(/*try_to_connect=*/true);
+  }
+}
+
 void ClientChannel::Destroy(grpc_channel_element* elem) {
   ClientChannel* chand = static_cast<ClientChannel*>(elem->channel_data);
   chand->~ClientChannel();
@@ -980,14 +1163,19 @@ RefCountedPtr<SubchannelPoolInterface> GetSubchannelPool(
 
 ClientChannel::ClientChannel(grpc_channel_element_args* args,
                              grpc_error_handle* error)
-    : channel_args_(ChannelArgs::FromC(args->channel_args)),
+    : channel_args_(*args->core_channel_args),
       deadline_checking_enabled_(grpc_deadline_checking_enabled(channel_args_)),
+      deadline_timer_buckets_(
+          deadline_checking_enabled_
+              ? DeadlineTimerBuckets::CreateFromChannelArgs(channel_args_)
+              : nullptr),
       owning_stack_(args->channel_stack),
       client_channel_factory_(channel_args_.GetObject<ClientChannelFactory>()),
       channelz_node_(channel_args_.GetObject<channelz::ChannelNode>()),
       interested_parties_(grpc_pollset_set_create()),
       service_config_parser_index_(
           internal::ClientChannelServiceConfigParser::ParserIndex()),
+      picker_([this]() { RequestPickerReclamation(); }),
       work_serializer_(std::make_shared<WorkSerializer>()),
       state_tracker_("client_channel", GRPC_CHANNEL_IDLE),
       subchannel_pool_(GetSubchannelPool(channel_args_)) {
@@ -995,8 +1183,6 @@ ClientChannel::ClientChannel(grpc_channel_element_args* args,
     gpr_log(GPR_INFO, "chand=%p: creating client_channel for channel stack %p",
             this, owning_stack_);
   }
-  // Start backup polling.
-  grpc_client_channel_start_backup_polling(interested_parties_);
   // Check client channel factory.
   if (client_channel_factory_ == nullptr) {
     *error = GRPC_ERROR_CREATE(
@@ -1066,8 +1252,6 @@ ClientChannel::~ClientChannel() {
     gpr_log(GPR_INFO, "chand=%p: destroying channel", this);
   }
   DestroyResolverAndLbPolicyLocked();
-  // Stop backup polling.
-  grpc_client_channel_stop_backup_polling(interested_parties_);
   grpc_pollset_set_destroy(interested_parties_);
 }
 
@@ -1503,6 +1687,10 @@ void ClientChannel::CreateResolverLocked() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_trace)) {
     gpr_log(GPR_INFO, "chand=%p: starting name resolution", this);
   }
+  // Start backup polling.  Only the resolver and the LB policy do I/O for
+  // the channel without a call to poll for it, so an idle channel does not
+  // need to be polled, and no longer wakes up the timer thread.
+  grpc_client_channel_start_backup_polling(interested_parties_);
   resolver_ = CoreConfiguration::Get().resolver_registry().CreateResolver(
       uri_to_resolve_.c_str(), channel_args_, interested_parties_,
       work_serializer_, std::make_unique<ResolverResultHandler>(this));
@@ -1534,6 +1722,8 @@ void ClientChannel::DestroyResolverAndLbPolicyLocked() {
                                        interested_parties_);
       lb_policy_.reset();
     }
+    // Stop backup polling.
+    grpc_client_channel_stop_backup_polling(interested_parties_);
   }
 }
 
@@ -1572,9 +1762,9 @@ void ClientChannel::UpdateStateAndPickerLocked(
   // Grab data plane lock to update the picker.
   {
     MutexLock lock(&data_plane_mu_);
-    // Swap out the picker.
-    // Note: Original value will be destroyed after the lock is released.
-    picker_.swap(picker);
+    // Swap out the picker.  Picks that are still using the original value
+    // keep it alive until they are done.
+    picker_.Store(std::move(picker));
     // Re-process queued picks.
     for (LbQueuedCall* call = lb_queued_calls_; call != nullptr;
          call = call->next) {
@@ -1593,6 +1783,25 @@ void ClientChannel::UpdateStateAndPickerLocked(
       }
     }
   }
+  // Destroy the original picker, unless picks are still using it.
+  picker_.Reclaim();
+}
+
+void ClientChannel::RequestPickerReclamation() {
+  // This is called from the data plane, so hop into the ExecCtx before
+  // entering the WorkSerializer.
+  GRPC_CHANNEL_STACK_REF(owning_stack_, "RequestPickerReclamation");
+  ExecCtx::Run(
+      DEBUG_LOCATION, NewClosure([this](grpc_error_handle /*error*/) {
+        work_serializer_->Run(
+            [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_) {
+              picker_.Reclaim();
+              GRPC_CHANNEL_STACK_UNREF(owning_stack_,
+                                       "RequestPickerReclamation");
+            },
+            DEBUG_LOCATION);
+      }),
+      absl::OkStatus());
 }
 
 namespace {
@@ -1636,7 +1845,7 @@ grpc_error_handle ClientChannel::DoPingLocked(grpc_transport_op* op) {
   LoadBalancingPolicy::PickResult result;
   {
     MutexLock lock(&data_plane_mu_);
-    result = picker_->Pick(LoadBalancingPolicy::PickArgs());
+    result = picker_.get()->Pick(LoadBalancingPolicy::PickArgs());
   }
   return HandlePickResult<grpc_error_handle>(
       &result,
@@ -1825,7 +2034,8 @@ ClientChannel::CallData::CallData(grpc_call_element* elem,
     : deadline_state_(elem, args,
                       GPR_LIKELY(chand.deadline_checking_enabled_)
                           ? args.deadline
-                          : Timestamp::InfFuture()),
+                          : Timestamp::InfFuture(),
+                      chand.deadline_timer_buckets_.get()),
       path_(CSliceRef(args.path)),
       call_start_time_(args.start_time),
       deadline_(args.deadline),
@@ -2132,9 +2342,18 @@ class ClientChannel::CallData::ResolverQueuedCallCanceller {
   grpc_closure closure_;
 };
 
+void ClientChannel::CallData::RecordPhase(CallTracer::Phase phase) {
+  auto* call_tracer =
+      static_cast<CallTracer*>(call_context_[GRPC_CONTEXT_CALL_TRACER].value);
+  if (call_tracer != nullptr) {
+    call_tracer->RecordPhase(phase, gpr_now(GPR_CLOCK_REALTIME));
+  }
+}
+
 void ClientChannel::CallData::MaybeRemoveCallFromResolverQueuedCallsLocked(
     grpc_call_element* elem) {
   if (!queued_pending_resolver_result_) return;
+  RecordPhase(CallTracer::Phase::kResolutionDequeued);
   auto* chand = static_cast<ClientChannel*>(elem->channel_data);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
     gpr_log(GPR_INFO,
@@ -2155,6 +2374,7 @@ void ClientChannel::CallData::MaybeAddCallToResolverQueuedCallsLocked(
     gpr_log(GPR_INFO, "chand=%p calld=%p: adding to resolver queued picks list",
             chand, this);
   }
+  RecordPhase(CallTracer::Phase::kResolutionQueued);
   queued_pending_resolver_result_ = true;
   resolver_queued_call_.elem = elem;
   chand->AddResolverQueuedCall(&resolver_queued_call_, pollent_);
@@ -2215,6 +2435,12 @@ grpc_error_handle ClientChannel::CallData::ApplyServiceConfigToCallLocked(
           !wait_for_ready->explicitly_set) {
         wait_for_ready->value = method_params->wait_for_ready().value();
       }
+      // Pass the write weight from the service config down to the transport.
+      if (method_params->write_weight().has_value()) {
+        pending_batches_[0]
+            ->payload->send_initial_metadata.send_initial_metadata->Set(
+                GrpcStreamWriteWeight(), *method_params->write_weight());
+      }
     }
     // Set the dynamic filter stack.
     dynamic_filters_ = chand->dynamic_filters_;
@@ -2415,6 +2641,17 @@ class ClientChannel::LoadBalancedCall::Metadata
                    });
   }
 
+  void Add(absl::string_view key, Slice value) override {
+    if (batch_ == nullptr) return;
+    batch_->Append(key, std::move(value),
+                   [key](absl::string_view error, const Slice& value) {
+                     gpr_log(GPR_ERROR, "%s",
+                             absl::StrCat(error, " key:", key,
+                                          " value:", value.as_string_view())
+                                 .c_str());
+                   });
+  }
+
   std::vector<std::pair<std::string, std::string>> TestOnlyCopyToVector()
       override {
     if (batch_ == nullptr) return {};
@@ -2533,8 +2770,56 @@ CallTracer::CallAttemptTracer* GetCallAttemptTracer(
   return call_tracer->StartNewAttempt(is_transparent_retry);
 }
 
+// Returns the CPU time used by the current thread so far, or 0 on platforms
+// without a per-thread CPU clock.
+int64_t ThreadCpuNanos() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+    return static_cast<int64_t>(ts.tv_sec) * GPR_NS_PER_SEC + ts.tv_nsec;
+  }
+#endif
+  return 0;
+}
+
 }  // namespace
 
+// Charges the thread CPU time spent in its scope to a traced call, for
+// CallAttemptTracer::RecordResourceUsage(). Scopes nest when a batch
+// completes synchronously; only the outermost one on a thread counts, so the
+// same time is never charged twice. Holds a ref so that the call outlives the
+// scope even if a callback run within it releases the call.
+class ClientChannel::LoadBalancedCall::ScopedCpuTimer {
+ public:
+  explicit ScopedCpuTimer(LoadBalancedCall* call) {
+    if (call->call_attempt_tracer_ == nullptr) return;
+    entered_ = true;
+    if (nesting_++ > 0) return;
+    call_ = call->Ref(DEBUG_LOCATION, "ScopedCpuTimer");
+    start_nanos_ = ThreadCpuNanos();
+  }
+
+  ~ScopedCpuTimer() {
+    if (call_ != nullptr) {
+      call_->cpu_nanos_.fetch_add(ThreadCpuNanos() - start_nanos_,
+                                  std::memory_order_relaxed);
+    }
+    if (entered_) --nesting_;
+  }
+
+  ScopedCpuTimer(const ScopedCpuTimer&) = delete;
+  ScopedCpuTimer& operator=(const ScopedCpuTimer&) = delete;
+
+ private:
+  static thread_local int nesting_;
+
+  bool entered_ = false;
+  RefCountedPtr<LoadBalancedCall> call_;
+  int64_t start_nanos_ = 0;
+};
+
+thread_local int ClientChannel::LoadBalancedCall::ScopedCpuTimer::nesting_ = 0;
+
 ClientChannel::LoadBalancedCall::LoadBalancedCall(
     ClientChannel* chand, const grpc_call_element_args& args,
     grpc_polling_entity* pollent, grpc_closure* on_call_destruction_complete,
@@ -2586,6 +2871,10 @@ void ClientChannel::LoadBalancedCall::Orphan() {
   if (call_attempt_tracer_ != nullptr) {
     gpr_timespec latency =
         gpr_cycle_counter_sub(gpr_get_cycle_counter(), lb_call_start_time_);
+    call_attempt_tracer_->RecordResourceUsage(
+        gpr_time_from_nanos(cpu_nanos_.load(std::memory_order_relaxed),
+                            GPR_TIMESPAN),
+        arena_->TotalUsedBytes());
     call_attempt_tracer_->RecordEnd(latency);
   }
   Unref();
@@ -2705,6 +2994,7 @@ void ClientChannel::LoadBalancedCall::PendingBatchesResume() {
 
 void ClientChannel::LoadBalancedCall::StartTransportStreamOpBatch(
     grpc_transport_stream_op_batch* batch) {
+  ScopedCpuTimer cpu_timer(this);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace) ||
       GRPC_TRACE_FLAG_ENABLED(grpc_trace_channel)) {
     gpr_log(GPR_INFO,
@@ -2817,13 +3107,10 @@ void ClientChannel::LoadBalancedCall::StartTransportStreamOpBatch(
   }
   // Add the batch to the pending list.
   PendingBatchesAdd(batch);
-  // For batches containing a send_initial_metadata op, acquire the
-  // channel's data plane mutex to pick a subchannel.
+  // For batches containing a send_initial_metadata op, pick a subchannel.
   if (GPR_LIKELY(batch->send_initial_metadata)) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-      gpr_log(GPR_INFO,
-              "chand=%p lb_call=%p: grabbing data plane mutex to perform pick",
-              chand_, this);
+      gpr_log(GPR_INFO, "chand=%p lb_call=%p: performing pick", chand_, this);
     }
     PickSubchannel(this, absl::OkStatus());
   } else {
@@ -2841,6 +3128,7 @@ void ClientChannel::LoadBalancedCall::StartTransportStreamOpBatch(
 void ClientChannel::LoadBalancedCall::SendInitialMetadataOnComplete(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<LoadBalancedCall*>(arg);
+  ScopedCpuTimer cpu_timer(self);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
     gpr_log(GPR_INFO,
             "chand=%p lb_call=%p: got on_complete for send_initial_metadata: "
@@ -2856,6 +3144,7 @@ void ClientChannel::LoadBalancedCall::SendInitialMetadataOnComplete(
 void ClientChannel::LoadBalancedCall::RecvInitialMetadataReady(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<LoadBalancedCall*>(arg);
+  ScopedCpuTimer cpu_timer(self);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
     gpr_log(GPR_INFO,
             "chand=%p lb_call=%p: got recv_initial_metadata_ready: error=%s",
@@ -2873,6 +3162,7 @@ void ClientChannel::LoadBalancedCall::RecvInitialMetadataReady(
 void ClientChannel::LoadBalancedCall::RecvMessageReady(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<LoadBalancedCall*>(arg);
+  ScopedCpuTimer cpu_timer(self);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
     gpr_log(GPR_INFO, "chand=%p lb_call=%p: got recv_message_ready: error=%s",
             self->chand_, self, StatusToString(error).c_str());
@@ -2886,6 +3176,7 @@ void ClientChannel::LoadBalancedCall::RecvMessageReady(
 void ClientChannel::LoadBalancedCall::RecvTrailingMetadataReady(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<LoadBalancedCall*>(arg);
+  ScopedCpuTimer cpu_timer(self);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
     gpr_log(GPR_INFO,
             "chand=%p lb_call=%p: got recv_trailing_metadata_ready: error=%s "
@@ -2971,6 +3262,13 @@ void ClientChannel::LoadBalancedCall::CreateSubchannelCall() {
   if (GPR_UNLIKELY(!error.ok())) {
     PendingBatchesFail(error, YieldCallCombiner);
   } else {
+    if (call_attempt_tracer_ != nullptr) {
+      auto tcp_tracer = call_attempt_tracer_->StartNewTcpTrace();
+      if (tcp_tracer != nullptr) {
+        SetTcpTracer(call_context_, std::move(tcp_tracer));
+      }
+    }
+    RecordPhase(CallTracer::Phase::kSubchannelCallStarted);
     PendingBatchesResume();
   }
 }
@@ -3022,8 +3320,15 @@ class ClientChannel::LoadBalancedCall::LbQueuedCallCanceller {
   grpc_closure closure_;
 };
 
+void ClientChannel::LoadBalancedCall::RecordPhase(CallTracer::Phase phase) {
+  if (call_attempt_tracer_ != nullptr) {
+    call_attempt_tracer_->RecordPhase(phase, gpr_now(GPR_CLOCK_REALTIME));
+  }
+}
+
 void ClientChannel::LoadBalancedCall::MaybeRemoveCallFromLbQueuedCallsLocked() {
   if (!queued_pending_lb_pick_) return;
+  RecordPhase(CallTracer::Phase::kPickDequeued);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
     gpr_log(GPR_INFO, "chand=%p lb_call=%p: removing from queued picks list",
             chand_, this);
@@ -3040,6 +3345,7 @@ void ClientChannel::LoadBalancedCall::MaybeAddCallToLbQueuedCallsLocked() {
     gpr_log(GPR_INFO, "chand=%p lb_call=%p: adding to queued picks list",
             chand_, this);
   }
+  RecordPhase(CallTracer::Phase::kPickQueued);
   queued_pending_lb_pick_ = true;
   queued_call_.lb_call = this;
   chand_->AddLbQueuedCall(&queued_call_, pollent_);
@@ -3072,8 +3378,19 @@ void ClientChannel::LoadBalancedCall::PickDone(void* arg,
 void ClientChannel::LoadBalancedCall::PickSubchannel(void* arg,
                                                      grpc_error_handle error) {
   auto* self = static_cast<LoadBalancedCall*>(arg);
-  bool pick_complete;
+  bool pick_complete = false;
   {
+    // Pick with the current picker without taking the data plane mutex.
+    RcuPtr<LoadBalancingPolicy::SubchannelPicker>::ReadScope picker(
+        &self->chand_->picker_);
+    if (picker.get() != nullptr) {
+      pick_complete = self->PickSubchannelImpl(picker.get(), &error);
+    }
+  }
+  if (!pick_complete) {
+    // The pick has to be queued.  Retry it under the mutex, so that it
+    // either uses a picker that arrived in the meantime or is queued before
+    // the next picker update re-processes the queue.
     MutexLock lock(&self->chand_->data_plane_mu_);
     pick_complete = self->PickSubchannelLocked(&error);
   }
@@ -3084,6 +3401,16 @@ void ClientChannel::LoadBalancedCall::PickSubchannel(void* arg,
 
 bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
     grpc_error_handle* error) {
+  if (PickSubchannelImpl(chand_->picker_.get(), error)) {
+    MaybeRemoveCallFromLbQueuedCallsLocked();
+    return true;
+  }
+  MaybeAddCallToLbQueuedCallsLocked();
+  return false;
+}
+
+bool ClientChannel::LoadBalancedCall::PickSubchannelImpl(
+    LoadBalancingPolicy::SubchannelPicker* picker, grpc_error_handle* error) {
   GPR_ASSERT(connected_subchannel_ == nullptr);
   GPR_ASSERT(subchannel_call_ == nullptr);
   // Grab initial metadata.
@@ -3098,91 +3425,90 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
   pick_args.call_state = &lb_call_state;
   Metadata initial_metadata(initial_metadata_batch);
   pick_args.initial_metadata = &initial_metadata;
-  auto result = chand_->picker_->Pick(pick_args);
+  auto result = picker->Pick(pick_args);
   return HandlePickResult<bool>(
       &result,
       // CompletePick
-      [this](LoadBalancingPolicy::PickResult::Complete* complete_pick)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
-            if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-              gpr_log(GPR_INFO,
-                      "chand=%p lb_call=%p: LB pick succeeded: subchannel=%p",
-                      chand_, this, complete_pick->subchannel.get());
-            }
-            GPR_ASSERT(complete_pick->subchannel != nullptr);
-            // Grab a ref to the connected subchannel while we're still
-            // holding the data plane mutex.
-            SubchannelWrapper* subchannel = static_cast<SubchannelWrapper*>(
-                complete_pick->subchannel.get());
-            connected_subchannel_ = subchannel->connected_subchannel();
-            // If the subchannel has no connected subchannel (e.g., if the
-            // subchannel has moved out of state READY but the LB policy hasn't
-            // yet seen that change and given us a new picker), then just
-            // queue the pick.  We'll try again as soon as we get a new picker.
-            if (connected_subchannel_ == nullptr) {
-              if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-                gpr_log(GPR_INFO,
-                        "chand=%p lb_call=%p: subchannel returned by LB picker "
-                        "has no connected subchannel; queueing pick",
-                        chand_, this);
-              }
-              MaybeAddCallToLbQueuedCallsLocked();
-              return false;
-            }
-            lb_subchannel_call_tracker_ =
-                std::move(complete_pick->subchannel_call_tracker);
-            if (lb_subchannel_call_tracker_ != nullptr) {
-              lb_subchannel_call_tracker_->Start();
-            }
-            MaybeRemoveCallFromLbQueuedCallsLocked();
-            return true;
-          },
+      [this, initial_metadata_batch](
+          LoadBalancingPolicy::PickResult::Complete* complete_pick) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
+          gpr_log(GPR_INFO,
+                  "chand=%p lb_call=%p: LB pick succeeded: subchannel=%p",
+                  chand_, this, complete_pick->subchannel.get());
+        }
+        GPR_ASSERT(complete_pick->subchannel != nullptr);
+        // Grab a ref to the connected subchannel while the picker, and
+        // therefore the subchannel, is still in use.
+        SubchannelWrapper* subchannel = static_cast<SubchannelWrapper*>(
+            complete_pick->subchannel.get());
+        connected_subchannel_ = subchannel->connected_subchannel();
+        // If the subchannel has no connected subchannel (e.g., if the
+        // subchannel has moved out of state READY but the LB policy hasn't
+        // yet seen that change and given us a new picker), then just
+        // queue the pick.  We'll try again as soon as we get a new picker.
+        if (connected_subchannel_ == nullptr) {
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
+            gpr_log(GPR_INFO,
+                    "chand=%p lb_call=%p: subchannel returned by LB picker "
+                    "has no connected subchannel; queueing pick", chand_, this);
+          }
+          return false;
+        }
+        if (!subchannel->authority().empty() &&
+            initial_metadata_batch->get_pointer(HttpAuthorityMetadata()) ==
+                nullptr) {
+          initial_metadata_batch->Set(HttpAuthorityMetadata(),
+                                      subchannel->authority().Ref());
+        }
+        lb_subchannel_call_tracker_ =
+            std::move(complete_pick->subchannel_call_tracker);
+        if (lb_subchannel_call_tracker_ != nullptr) {
+          lb_subchannel_call_tracker_->Start();
+        }
+        if (chand_->channelz_node_ != nullptr) {
+          chand_->channelz_node_->RecordPickLatency(lb_call_start_time_);
+        }
+        return true;
+      },
       // QueuePick
-      [this](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
-            if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-              gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick queued", chand_,
-                      this);
-            }
-            MaybeAddCallToLbQueuedCallsLocked();
-            return false;
-          },
+      [this](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
+          gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick queued", chand_,
+                  this);
+        }
+        return false;
+      },
       // FailPick
       [this, initial_metadata_batch,
-       &error](LoadBalancingPolicy::PickResult::Fail* fail_pick)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
-            if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-              gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick failed: %s",
-                      chand_, this, fail_pick->status.ToString().c_str());
-            }
-            // If wait_for_ready is false, then the error indicates the RPC
-            // attempt's final status.
-            if (!initial_metadata_batch->GetOrCreatePointer(WaitForReady())
-                     ->value) {
-              *error = absl_status_to_grpc_error(MaybeRewriteIllegalStatusCode(
-                  std::move(fail_pick->status), "LB pick"));
-              MaybeRemoveCallFromLbQueuedCallsLocked();
-              return true;
-            }
-            // If wait_for_ready is true, then queue to retry when we get a new
-            // picker.
-            MaybeAddCallToLbQueuedCallsLocked();
-            return false;
-          },
+       &error](LoadBalancingPolicy::PickResult::Fail* fail_pick) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
+          gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick failed: %s",
+                  chand_, this, fail_pick->status.ToString().c_str());
+        }
+        // If wait_for_ready is false, then the error indicates the RPC
+        // attempt's final status.
+        if (!initial_metadata_batch->GetOrCreatePointer(WaitForReady())
+                 ->value) {
+          *error = absl_status_to_grpc_error(MaybeRewriteIllegalStatusCode(
+              std::move(fail_pick->status), "LB pick"));
+          return true;
+        }
+        // If wait_for_ready is true, then queue to retry when we get a new
+        // picker.
+        return false;
+      },
       // DropPick
-      [this, &error](LoadBalancingPolicy::PickResult::Drop* drop_pick)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
-            if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-              gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick dropped: %s",
-                      chand_, this, drop_pick->status.ToString().c_str());
-            }
-            *error = grpc_error_set_int(
-                absl_status_to_grpc_error(MaybeRewriteIllegalStatusCode(
-                    std::move(drop_pick->status), "LB drop")),
-                StatusIntProperty::kLbPolicyDrop, 1);
-            MaybeRemoveCallFromLbQueuedCallsLocked();
-            return true;
-          });
+      [this, &error](LoadBalancingPolicy::PickResult::Drop* drop_pick) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
+          gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick dropped: %s",
+                  chand_, this, drop_pick->status.ToString().c_str());
+        }
+        *error = grpc_error_set_int(
+            absl_status_to_grpc_error(MaybeRewriteIllegalStatusCode(
+                std::move(drop_pick->status), "LB drop")),
+            StatusIntProperty::kLbPolicyDrop, 1);
+        return true;
+      });
 }
 
 }  // namespace grpc_core
@@ -43,6 +43,7 @@
 #include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
 #include "src/core/ext/filters/client_channel/subchannel.h"
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
+#include "src/core/ext/filters/deadline/deadline_filter.h"
 #include "src/core/lib/channel/call_tracer.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
@@ -51,6 +52,7 @@
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/rcu_ptr.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -92,6 +94,12 @@
 // Channel arg containing a pointer to the ClientChannel object.
 #define GRPC_ARG_CLIENT_CHANNEL "grpc.internal.client_channel"
 
+// Channel arg that distinguishes the extra connections opened to an address
+// under GRPC_ARG_MAX_CONNECTIONS_PER_ADDRESS, so that they do not share a
+// subchannel in the subchannel pool.
+#define GRPC_ARG_SUBCHANNEL_CONNECTION_INDEX \
+  "grpc.internal.subchannel_connection_index"
+
 // Max number of batches that can be pending on a call at any given
 // time.  This includes one batch for each of the following ops:
 //   recv_initial_metadata
@@ -236,6 +244,7 @@ class ClientChannel {
   // Filter vtable functions.
   static grpc_error_handle Init(grpc_channel_element* elem,
                                 grpc_channel_element_args* args);
+  static void PostInit(grpc_channel_stack* stack, grpc_channel_element* elem);
   static void Destroy(grpc_channel_element* elem);
   static void StartTransportOp(grpc_channel_element* elem,
                                grpc_transport_op* op);
@@ -291,6 +300,9 @@ class ClientChannel {
                                 grpc_polling_entity* pollent)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(resolution_mu_);
 
+  // Schedules a pass that destroys pickers that picks no longer use.
+  void RequestPickerReclamation();
+
   // These methods all require holding data_plane_mu_.
   void AddLbQueuedCall(LbQueuedCall* call, grpc_polling_entity* pollent)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(data_plane_mu_);
@@ -302,6 +314,7 @@ class ClientChannel {
   //
   ChannelArgs channel_args_;
   const bool deadline_checking_enabled_;
+  const OrphanablePtr<DeadlineTimerBuckets> deadline_timer_buckets_;
   grpc_channel_stack* owning_stack_;
   ClientChannelFactory* client_channel_factory_;
   RefCountedPtr<ServiceConfig> default_service_config_;
@@ -332,8 +345,10 @@ class ClientChannel {
   // Fields used in the data plane.  Guarded by data_plane_mu_.
   //
   mutable Mutex data_plane_mu_;
-  std::unique_ptr<LoadBalancingPolicy::SubchannelPicker> picker_
-      ABSL_GUARDED_BY(data_plane_mu_);
+  // Picks read the picker without holding data_plane_mu_.  It is replaced
+  // while holding data_plane_mu_ in the WorkSerializer, and replaced
+  // pickers are destroyed in the WorkSerializer once no pick uses them.
+  RcuPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
   // Linked list of calls queued waiting for LB pick.
   LbQueuedCall* lb_queued_calls_ ABSL_GUARDED_BY(data_plane_mu_) = nullptr;
 
@@ -421,7 +436,8 @@ class ClientChannel::LoadBalancedCall
 
   void StartTransportStreamOpBatch(grpc_transport_stream_op_batch* batch);
 
-  // Invoked by channel for queued LB picks when the picker is updated.
+  // Performs an LB pick.  The data plane mutex is taken only if the pick
+  // has to be queued.
   static void PickSubchannel(void* arg, grpc_error_handle error);
   // Helper function for performing an LB pick while holding the data plane
   // mutex.  Returns true if the pick is complete, in which case the caller
@@ -440,6 +456,7 @@ class ClientChannel::LoadBalancedCall
   class LbQueuedCallCanceller;
   class Metadata;
   class BackendMetricAccessor;
+  class ScopedCpuTimer;
 
   // Returns the index into pending_batches_ to be used for batch.
   static size_t GetBatchIndex(grpc_transport_stream_op_batch* batch);
@@ -480,12 +497,18 @@ class ClientChannel::LoadBalancedCall
   void CreateSubchannelCall();
   // Invoked when a pick is completed, on both success or failure.
   static void PickDone(void* arg, grpc_error_handle error);
+  // Performs an LB pick with picker.  Returns true if the pick is complete;
+  // false means it must be queued until the next picker update.
+  bool PickSubchannelImpl(LoadBalancingPolicy::SubchannelPicker* picker,
+                          grpc_error_handle* error);
   // Removes the call from the channel's list of queued picks if present.
   void MaybeRemoveCallFromLbQueuedCallsLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
   // Adds the call to the channel's list of queued picks if not already present.
   void MaybeAddCallToLbQueuedCallsLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
+  // Annotates the attempt's tracer, if any, with \a phase.
+  void RecordPhase(CallTracer::Phase phase);
 
   ClientChannel* chand_;
 
@@ -505,6 +528,8 @@ class ClientChannel::LoadBalancedCall
   CallTracer::CallAttemptTracer* call_attempt_tracer_;
 
   gpr_cycle_counter lb_call_start_time_ = gpr_get_cycle_counter();
+  // Thread CPU time spent on this call, if call_attempt_tracer_ is set.
+  std::atomic<int64_t> cpu_nanos_{0};
 
   // Set when we get a cancel_stream op.
   grpc_error_handle cancel_error_;
@@ -20,12 +20,38 @@
 
 #include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
 
+#include <string.h>
+
 #include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/codegen/grpc_types.h>
 
 #include "src/core/ext/filters/client_channel/subchannel.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/security/security_connector/security_connector.h"
 
 namespace grpc_core {
 
+namespace {
+
+// The args that must match for two subchannels to share a connection: all
+// but the authority and the security connector created for it.
+ChannelArgs CoalescingArgs(const ChannelArgs& args) {
+  return args.Remove(GRPC_ARG_DEFAULT_AUTHORITY)
+      .Remove(GRPC_ARG_SECURITY_CONNECTOR);
+}
+
+bool SameAddress(const grpc_resolved_address& a,
+                 const grpc_resolved_address& b) {
+  return a.len == b.len && memcmp(a.addr, b.addr, a.len) == 0;
+}
+
+}  // namespace
+
 RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
   static GlobalSubchannelPool* p = new GlobalSubchannelPool();
   return p->Ref();
@@ -33,33 +59,67 @@ RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::RegisterSubchannel(
     const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it != subchannel_map_.end()) {
+  Shard& shard = ShardFor(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.subchannel_map.find(key);
+  if (it != shard.subchannel_map.end()) {
     RefCountedPtr<Subchannel> existing = it->second->RefIfNonZero();
     if (existing != nullptr) return existing;
   }
-  subchannel_map_[key] = constructed.get();
+  shard.subchannel_map[key] = constructed.get();
   return constructed;
 }
 
 void GlobalSubchannelPool::UnregisterSubchannel(const SubchannelKey& key,
                                                 Subchannel* subchannel) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
+  Shard& shard = ShardFor(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.subchannel_map.find(key);
   // delete only if key hasn't been re-registered to a different subchannel
   // between strong-unreffing and unregistration of subchannel.
-  if (it != subchannel_map_.end() && it->second == subchannel) {
-    subchannel_map_.erase(it);
+  if (it != shard.subchannel_map.end() && it->second == subchannel) {
+    shard.subchannel_map.erase(it);
   }
 }
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
     const SubchannelKey& key) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it == subchannel_map_.end()) return nullptr;
+  Shard& shard = ShardFor(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.subchannel_map.find(key);
+  if (it == shard.subchannel_map.end()) return nullptr;
   return it->second->RefIfNonZero();
 }
 
+RefCountedPtr<Subchannel> GlobalSubchannelPool::FindCoalescableSubchannel(
+    const SubchannelKey& key) {
+  absl::optional<absl::string_view> authority =
+      key.args().GetString(GRPC_ARG_DEFAULT_AUTHORITY);
+  if (!authority.has_value()) return nullptr;
+  const ChannelArgs args = CoalescingArgs(key.args());
+  // Keys are sharded by address, so every candidate is in this shard.
+  std::vector<RefCountedPtr<Subchannel>> candidates;
+  {
+    Shard& shard = ShardFor(key);
+    MutexLock lock(&shard.mu);
+    for (const auto& p : shard.subchannel_map) {
+      if (!SameAddress(p.first.address(), key.address())) continue;
+      if (CoalescingArgs(p.first.args()) != args) continue;
+      RefCountedPtr<Subchannel> subchannel = p.second->RefIfNonZero();
+      if (subchannel != nullptr) candidates.push_back(std::move(subchannel));
+    }
+  }
+  // Checked outside of the shard lock, which the subchannels take when they
+  // are unreffed.
+  for (RefCountedPtr<Subchannel>& subchannel : candidates) {
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+        subchannel->connected_subchannel();
+    if (connected_subchannel != nullptr &&
+        connected_subchannel->CanCarryAuthority(*authority)) {
+      return std::move(subchannel);
+    }
+  }
+  return nullptr;
+}
+
 }  // namespace grpc_core
@@ -307,7 +307,7 @@ class GrpcLb : public LoadBalancingPolicy {
   class SubchannelWrapper : public DelegatingSubchannel {
    public:
     SubchannelWrapper(RefCountedPtr<SubchannelInterface> subchannel,
-                      RefCountedPtr<GrpcLb> lb_policy, std::string lb_token,
+                      RefCountedPtr<GrpcLb> lb_policy, Slice lb_token,
                       RefCountedPtr<GrpcLbClientStats> client_stats)
         : DelegatingSubchannel(std::move(subchannel)),
           lb_policy_(std::move(lb_policy)),
@@ -320,48 +320,50 @@ class GrpcLb : public LoadBalancingPolicy {
       }
     }
 
-    const std::string& lb_token() const { return lb_token_; }
+    const Slice& lb_token() const { return lb_token_; }
     GrpcLbClientStats* client_stats() const { return client_stats_.get(); }
 
    private:
     RefCountedPtr<GrpcLb> lb_policy_;
-    std::string lb_token_;
+    Slice lb_token_;
     RefCountedPtr<GrpcLbClientStats> client_stats_;
   };
 
   class TokenAndClientStatsAttribute
       : public ServerAddress::AttributeInterface {
    public:
-    TokenAndClientStatsAttribute(std::string lb_token,
+    TokenAndClientStatsAttribute(Slice lb_token,
                                  RefCountedPtr<GrpcLbClientStats> client_stats)
         : lb_token_(std::move(lb_token)),
           client_stats_(std::move(client_stats)) {}
 
     std::unique_ptr<AttributeInterface> Copy() const override {
-      return std::make_unique<TokenAndClientStatsAttribute>(lb_token_,
+      return std::make_unique<TokenAndClientStatsAttribute>(lb_token_.Ref(),
                                                             client_stats_);
     }
 
     int Cmp(const AttributeInterface* other_base) const override {
       const TokenAndClientStatsAttribute* other =
           static_cast<const TokenAndClientStatsAttribute*>(other_base);
-      int r = lb_token_.compare(other->lb_token_);
+      int r = lb_token_.as_string_view().compare(
+          other->lb_token_.as_string_view());
       if (r != 0) return r;
       return QsortCompare(client_stats_.get(), other->client_stats_.get());
     }
 
     std::string ToString() const override {
-      return absl::StrFormat("lb_token=\"%s\" client_stats=%p", lb_token_,
-                             client_stats_.get());
+      return absl::StrFormat("lb_token=\"%s\" client_stats=%p",
+                             lb_token_.as_string_view(), client_stats_.get());
     }
 
-    const std::string& lb_token() const { return lb_token_; }
+    const Slice& lb_token() const { return lb_token_; }
     RefCountedPtr<GrpcLbClientStats> client_stats() const {
       return client_stats_;
     }
 
    private:
-    std::string lb_token_;
+    // Shared by every call picked for the address, see Picker::Pick().
+    Slice lb_token_;
     RefCountedPtr<GrpcLbClientStats> client_stats_;
   };
 
@@ -693,7 +695,7 @@ ServerAddressList GrpcLb::Serverlist::GetServerAddressList(
     // LB token processing.
     const size_t lb_token_length = strnlen(
         server.load_balance_token, GPR_ARRAY_SIZE(server.load_balance_token));
-    std::string lb_token(server.load_balance_token, lb_token_length);
+    absl::string_view lb_token(server.load_balance_token, lb_token_length);
     if (lb_token.empty()) {
       auto addr_uri = grpc_sockaddr_to_uri(&addr);
       gpr_log(GPR_INFO,
@@ -706,8 +708,8 @@ ServerAddressList GrpcLb::Serverlist::GetServerAddressList(
     std::map<const char*, std::unique_ptr<ServerAddress::AttributeInterface>>
         attributes;
     attributes[kGrpcLbAddressAttributeKey] =
-        std::make_unique<TokenAndClientStatsAttribute>(std::move(lb_token),
-                                                       stats);
+        std::make_unique<TokenAndClientStatsAttribute>(
+            Slice::FromCopiedString(lb_token), stats);
     // Add address.
     addresses.emplace_back(addr, ChannelArgs(), std::move(attributes));
   }
@@ -774,14 +776,13 @@ GrpcLb::PickResult GrpcLb::Picker::Pick(PickArgs args) {
       client_stats->AddCallStarted();
     }
     // Encode the LB token in metadata.
-    // Create a new copy on the call arena, since the subchannel list
-    // may get refreshed between when we return this pick and when the
-    // initial metadata goes out on the wire.
+    // The metadata holds a ref to the token rather than a copy of it; the
+    // ref keeps the token alive if the subchannel list gets refreshed
+    // between when we return this pick and when the initial metadata goes
+    // out on the wire.
     if (!subchannel_wrapper->lb_token().empty()) {
-      char* lb_token = static_cast<char*>(
-          args.call_state->Alloc(subchannel_wrapper->lb_token().size() + 1));
-      strcpy(lb_token, subchannel_wrapper->lb_token().c_str());
-      args.initial_metadata->Add(LbTokenMetadata::key(), lb_token);
+      args.initial_metadata->Add(LbTokenMetadata::key(),
+                                 subchannel_wrapper->lb_token().Ref());
     }
     // Unwrap subchannel to pass up to the channel.
     complete_pick->subchannel = subchannel_wrapper->wrapped_subchannel();
@@ -805,7 +806,7 @@ RefCountedPtr<SubchannelInterface> GrpcLb::Helper::CreateSubchannel(
             parent_.get(), address.ToString().c_str());
     abort();
   }
-  std::string lb_token = attribute->lb_token();
+  Slice lb_token = attribute->lb_token().Ref();
   RefCountedPtr<GrpcLbClientStats> client_stats = attribute->client_stats();
   return MakeRefCounted<SubchannelWrapper>(
       parent_->channel_control_helper()->CreateSubchannel(std::move(address),
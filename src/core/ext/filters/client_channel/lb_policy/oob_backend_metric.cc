@@ -21,16 +21,18 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
-#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "google/protobuf/duration.upb.h"
+#include "upb/upb.h"
 #include "upb/upb.hpp"
 #include "xds/service/orca/v3/orca.upb.h"
 
@@ -38,7 +40,6 @@
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/slice.h>
 #include <grpc/status.h>
-#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/backend_metric.h"
@@ -49,7 +50,6 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
-#include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -70,6 +70,29 @@ TraceFlag grpc_orca_client_trace(false, "orca_client");
 
 class OrcaWatcher;
 
+// Storage for a parsed backend metric report.  It is injected into
+// ParseBackendMetricData() as an allocator that returns internal storage,
+// with the strings the report points to in an arena inlined into it rather
+// than in a separate allocation each.
+class BackendMetricAllocator : public BackendMetricAllocatorInterface {
+ public:
+  BackendMetricData* AllocateBackendMetricData() override {
+    return &backend_metric_data_;
+  }
+
+  char* AllocateString(size_t size) override {
+    return static_cast<char*>(upb_Arena_Malloc(arena_.ptr(), size));
+  }
+
+  const BackendMetricData& backend_metric_data() const {
+    return backend_metric_data_;
+  }
+
+ private:
+  BackendMetricData backend_metric_data_;
+  upb::InlinedArena<256> arena_;
+};
+
 // This producer is registered with a subchannel.  It creates a
 // streaming ORCA call and reports the resulting backend metrics to all
 // registered watchers.
@@ -86,10 +109,19 @@ class OrcaProducer : public Subchannel::DataProducerInterface {
 
   UniqueTypeName type() const override { return Type(); }
 
+  ~OrcaProducer() override;
+
   // Adds and removes watchers.
   void AddWatcher(OrcaWatcher* watcher);
   void RemoveWatcher(OrcaWatcher* watcher);
 
+  // Hands a new report to the watchers, asynchronously, which avoids lock
+  // inversion problems due to acquiring mu_ while holding the lock from
+  // inside of SubchannelStreamClient.  A report that arrives before the
+  // previous one reached the watchers replaces it, so that watchers that
+  // fall behind see only the latest load rather than a backlog.
+  void QueueReport(std::unique_ptr<BackendMetricAllocator> report);
+
  private:
   class ConnectivityWatcher;
   class OrcaStreamEventHandler;
@@ -105,8 +137,8 @@ class OrcaProducer : public Subchannel::DataProducerInterface {
   // Handles a connectivity state change on the subchannel.
   void OnConnectivityStateChange(grpc_connectivity_state state);
 
-  // Called to notify watchers of a new backend metric report.
-  void NotifyWatchers(const BackendMetricData& backend_metric_data);
+  // Called to notify watchers of the queued backend metric report.
+  void NotifyWatchers();
 
   RefCountedPtr<Subchannel> subchannel_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_;
@@ -115,6 +147,8 @@ class OrcaProducer : public Subchannel::DataProducerInterface {
   std::set<OrcaWatcher*> watchers_ ABSL_GUARDED_BY(mu_);
   Duration report_interval_ ABSL_GUARDED_BY(mu_) = Duration::Infinity();
   OrphanablePtr<SubchannelStreamClient> stream_client_ ABSL_GUARDED_BY(mu_);
+  // The report waiting for NotifyWatchers(), if any.
+  std::atomic<BackendMetricAllocator*> pending_report_{nullptr};
 };
 
 // This watcher is returned to the LB policy and added to the
@@ -209,14 +243,11 @@ class OrcaProducer::OrcaStreamEventHandler
   absl::Status RecvMessageReadyLocked(
       SubchannelStreamClient* /*client*/,
       absl::string_view serialized_message) override {
-    auto* allocator = new BackendMetricAllocator(producer_);
-    auto* backend_metric_data =
-        ParseBackendMetricData(serialized_message, allocator);
-    if (backend_metric_data == nullptr) {
-      delete allocator;
+    auto report = std::make_unique<BackendMetricAllocator>();
+    if (ParseBackendMetricData(serialized_message, report.get()) == nullptr) {
       return absl::InvalidArgumentError("unable to parse Orca response");
     }
-    allocator->AsyncNotifyWatchersAndDelete();
+    producer_->QueueReport(std::move(report));
     return absl::OkStatus();
   }
 
@@ -236,49 +267,6 @@ class OrcaProducer::OrcaStreamEventHandler
   }
 
  private:
-  // This class acts as storage for the parsed backend metric data.  It
-  // is injected into ParseBackendMetricData() as an allocator that
-  // returns internal storage.  It then also acts as a place to hold
-  // onto the data during an async hop into the ExecCtx before sending
-  // notifications, which avoids lock inversion problems due to
-  // acquiring producer_->mu_ while holding the lock from inside of
-  // SubchannelStreamClient.
-  class BackendMetricAllocator : public BackendMetricAllocatorInterface {
-   public:
-    explicit BackendMetricAllocator(WeakRefCountedPtr<OrcaProducer> producer)
-        : producer_(std::move(producer)) {}
-
-    BackendMetricData* AllocateBackendMetricData() override {
-      return &backend_metric_data_;
-    }
-
-    char* AllocateString(size_t size) override {
-      char* string = static_cast<char*>(gpr_malloc(size));
-      string_storage_.emplace_back(string);
-      return string;
-    }
-
-    // Notifies watchers asynchronously and then deletes the
-    // BackendMetricAllocator object.
-    void AsyncNotifyWatchersAndDelete() {
-      GRPC_CLOSURE_INIT(&closure_, NotifyWatchersInExecCtx, this, nullptr);
-      ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::OkStatus());
-    }
-
-   private:
-    static void NotifyWatchersInExecCtx(void* arg,
-                                        grpc_error_handle /*error*/) {
-      auto* self = static_cast<BackendMetricAllocator*>(arg);
-      self->producer_->NotifyWatchers(self->backend_metric_data_);
-      delete self;
-    }
-
-    WeakRefCountedPtr<OrcaProducer> producer_;
-    BackendMetricData backend_metric_data_;
-    std::vector<UniquePtr<char>> string_storage_;
-    grpc_closure closure_;
-  };
-
   WeakRefCountedPtr<OrcaProducer> producer_;
   const Duration report_interval_;
 };
@@ -297,6 +285,10 @@ void OrcaProducer::Start(RefCountedPtr<Subchannel> subchannel) {
       std::move(connectivity_watcher));
 }
 
+OrcaProducer::~OrcaProducer() {
+  delete pending_report_.load(std::memory_order_relaxed);
+}
+
 void OrcaProducer::Orphan() {
   {
     MutexLock lock(&mu_);
@@ -351,8 +343,26 @@ void OrcaProducer::MaybeStartStreamLocked() {
       GRPC_TRACE_FLAG_ENABLED(grpc_orca_client_trace) ? "OrcaClient" : nullptr);
 }
 
-void OrcaProducer::NotifyWatchers(
-    const BackendMetricData& backend_metric_data) {
+void OrcaProducer::QueueReport(
+    std::unique_ptr<BackendMetricAllocator> report) {
+  BackendMetricAllocator* replaced =
+      pending_report_.exchange(report.release(), std::memory_order_acq_rel);
+  if (replaced != nullptr) {
+    // The notification already scheduled delivers the new report instead.
+    delete replaced;
+    return;
+  }
+  ExecCtx::Run(DEBUG_LOCATION,
+               NewClosure([self = WeakRef()](grpc_error_handle) {
+                 self->NotifyWatchers();
+               }),
+               absl::OkStatus());
+}
+
+void OrcaProducer::NotifyWatchers() {
+  std::unique_ptr<BackendMetricAllocator> report(
+      pending_report_.exchange(nullptr, std::memory_order_acq_rel));
+  const BackendMetricData& backend_metric_data = report->backend_metric_data();
   if (GRPC_TRACE_FLAG_ENABLED(grpc_orca_client_trace)) {
     gpr_log(GPR_INFO, "OrcaProducer %p: reporting backend metrics to watchers",
             this);
@@ -215,29 +215,23 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
 
   class SubchannelState : public RefCounted<SubchannelState> {
    public:
-    struct Bucket {
-      std::atomic<uint64_t> successes;
-      std::atomic<uint64_t> failures;
-    };
-
-    void RotateBucket() {
-      backup_bucket_->successes = 0;
-      backup_bucket_->failures = 0;
-      current_bucket_.swap(backup_bucket_);
-      active_bucket_.store(current_bucket_.get());
-    }
-
-    absl::optional<std::pair<double, uint64_t>> GetSuccessRateAndVolume() {
-      uint64_t total_request =
-          backup_bucket_->successes + backup_bucket_->failures;
+    // Discards the calls counted so far.
+    void ResetCallCounters() { TakeSuccessRateAndVolume(); }
+
+    // Returns the success rate, in percent, and the number of calls since
+    // the last call, and starts counting again from zero; nullopt if there
+    // were no calls.  A call that finishes concurrently is counted in
+    // either this interval or the next one.
+    absl::optional<std::pair<double, uint64_t>> TakeSuccessRateAndVolume() {
+      const uint64_t successes =
+          successes_.exchange(0, std::memory_order_relaxed);
+      const uint64_t failures =
+          failures_.exchange(0, std::memory_order_relaxed);
+      const uint64_t total_request = successes + failures;
       if (total_request == 0) {
         return absl::nullopt;
       }
-      double success_rate =
-          backup_bucket_->successes * 100.0 /
-          (backup_bucket_->successes + backup_bucket_->failures);
-      return {
-          {success_rate, backup_bucket_->successes + backup_bucket_->failures}};
+      return {{successes * 100.0 / total_request, total_request}};
     }
 
     void AddSubchannel(SubchannelWrapper* wrapper) {
@@ -248,9 +242,13 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
       subchannels_.erase(wrapper);
     }
 
-    void AddSuccessCount() { active_bucket_.load()->successes.fetch_add(1); }
+    void AddSuccessCount() {
+      successes_.fetch_add(1, std::memory_order_relaxed);
+    }
 
-    void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
+    void AddFailureCount() {
+      failures_.fetch_add(1, std::memory_order_relaxed);
+    }
 
     absl::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
@@ -296,11 +294,9 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
     }
 
    private:
-    std::unique_ptr<Bucket> current_bucket_ = std::make_unique<Bucket>();
-    std::unique_ptr<Bucket> backup_bucket_ = std::make_unique<Bucket>();
-    // The bucket used to update call counts.
-    // Points to either current_bucket or active_bucket.
-    std::atomic<Bucket*> active_bucket_{current_bucket_.get()};
+    // Calls finished since the ejection timer last ran.
+    std::atomic<uint64_t> successes_{0};
+    std::atomic<uint64_t> failures_{0};
     uint32_t multiplier_ = 0;
     absl::optional<Timestamp> ejection_time_;
     std::set<SubchannelWrapper*> subchannels_;
@@ -310,11 +306,13 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
   class RefCountedPicker : public RefCounted<RefCountedPicker> {
    public:
     explicit RefCountedPicker(std::unique_ptr<SubchannelPicker> picker)
-        : picker_(std::move(picker)) {}
-    PickResult Pick(PickArgs args) { return picker_->Pick(args); }
+        : picker_(std::move(picker)), target_(picker_->Innermost()) {}
+    PickResult Pick(PickArgs args) { return target_->Pick(args); }
 
    private:
     std::unique_ptr<SubchannelPicker> picker_;
+    // Skips any pass-through layers in the child policy's picker.
+    SubchannelPicker* target_;
   };
 
   // A picker that wraps the picker from the child to perform outlier detection.
@@ -604,7 +602,7 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
     }
     ejection_timer_ = MakeOrphanable<EjectionTimer>(Ref(), Timestamp::Now());
     for (const auto& p : subchannel_state_map_) {
-      p.second->RotateBucket();  // Reset call counters.
+      p.second->ResetCallCounters();
     }
   } else if (old_config->outlier_detection_config().interval !=
              config_->outlier_detection_config().interval) {
@@ -821,24 +819,27 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked(grpc_error_handle error) {
       gpr_log(GPR_INFO, "[outlier_detection_lb %p] ejection timer running",
               parent_.get());
     }
-    std::map<SubchannelState*, double> success_rate_ejection_candidates;
-    std::map<SubchannelState*, double> failure_percentage_ejection_candidates;
+    std::vector<std::pair<SubchannelState*, double>>
+        success_rate_ejection_candidates;
+    std::vector<std::pair<SubchannelState*, double>>
+        failure_percentage_ejection_candidates;
     size_t ejected_host_count = 0;
-    double success_rate_sum = 0;
+    // Mean and sum of squared deviations of the success rate candidates'
+    // success rates, updated as each candidate is found (Welford's method),
+    // so that the threshold takes no second pass over the candidates.
+    double success_rate_mean = 0;
+    double success_rate_m2 = 0;
     auto time_now = Timestamp::Now();
     auto& config = parent_->config_->outlier_detection_config();
     for (auto& state : parent_->subchannel_state_map_) {
       auto* subchannel_state = state.second.get();
-      // For each address, swap the call counter's buckets in that address's
-      // map entry.
-      subchannel_state->RotateBucket();
       // Gather data to run success rate algorithm or failure percentage
       // algorithm.
       if (subchannel_state->ejection_time().has_value()) {
         ++ejected_host_count;
       }
       absl::optional<std::pair<double, uint64_t>> host_success_rate_and_volume =
-          subchannel_state->GetSuccessRateAndVolume();
+          subchannel_state->TakeSuccessRateAndVolume();
       if (!host_success_rate_and_volume.has_value()) {
         continue;
       }
@@ -846,15 +847,19 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked(grpc_error_handle error) {
       uint64_t request_volume = host_success_rate_and_volume->second;
       if (config.success_rate_ejection.has_value()) {
         if (request_volume >= config.success_rate_ejection->request_volume) {
-          success_rate_ejection_candidates[subchannel_state] = success_rate;
-          success_rate_sum += success_rate;
+          success_rate_ejection_candidates.emplace_back(subchannel_state,
+                                                        success_rate);
+          const double delta = success_rate - success_rate_mean;
+          success_rate_mean +=
+              delta / success_rate_ejection_candidates.size();
+          success_rate_m2 += delta * (success_rate - success_rate_mean);
         }
       }
       if (config.failure_percentage_ejection.has_value()) {
         if (request_volume >=
             config.failure_percentage_ejection->request_volume) {
-          failure_percentage_ejection_candidates[subchannel_state] =
-              success_rate;
+          failure_percentage_ejection_candidates.emplace_back(subchannel_state,
+                                                              success_rate);
         }
       }
     }
@@ -863,10 +868,10 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked(grpc_error_handle error) {
               "[outlier_detection_lb %p] found %" PRIuPTR
               " success rate candidates and %" PRIuPTR
               " failure percentage candidates; ejected_host_count=%" PRIuPTR
-              "; success_rate_sum=%.3f",
+              "; success_rate_mean=%.3f",
               parent_.get(), success_rate_ejection_candidates.size(),
               failure_percentage_ejection_candidates.size(), ejected_host_count,
-              success_rate_sum);
+              success_rate_mean);
     }
     // success rate algorithm
     if (!success_rate_ejection_candidates.empty() &&
@@ -879,17 +884,13 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked(grpc_error_handle error) {
       }
       // calculate ejection threshold: (mean - stdev *
       // (success_rate_ejection.stdev_factor / 1000))
-      double mean = success_rate_sum / success_rate_ejection_candidates.size();
-      double variance = 0;
-      for (const auto& p : success_rate_ejection_candidates) {
-        variance += std::pow(p.second - mean, 2);
-      }
-      variance /= success_rate_ejection_candidates.size();
-      double stdev = std::sqrt(variance);
+      double stdev = std::sqrt(success_rate_m2 /
+                               success_rate_ejection_candidates.size());
       const double success_rate_stdev_factor =
           static_cast<double>(config.success_rate_ejection->stdev_factor) /
           1000;
-      double ejection_threshold = mean - stdev * success_rate_stdev_factor;
+      double ejection_threshold =
+          success_rate_mean - stdev * success_rate_stdev_factor;
       if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
         gpr_log(GPR_INFO,
                 "[outlier_detection_lb %p] stdev=%.3f, ejection_threshold=%.3f",
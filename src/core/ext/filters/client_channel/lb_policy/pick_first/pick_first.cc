@@ -31,17 +31,22 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/codegen/connectivity_state.h>
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "src/core/lib/load_balancing/lb_policy_factory.h"
@@ -56,12 +61,37 @@ TraceFlag grpc_lb_pick_first_trace(false, "pick_first");
 
 namespace {
 
+using ::grpc_event_engine::experimental::EventEngine;
+
 //
 // pick_first LB policy
 //
 
 constexpr absl::string_view kPickFirst = "pick_first";
 
+// Reorders addresses so that address families alternate, starting with the
+// family of the first address, as recommended for Happy Eyeballs by RFC 8305
+// section 4.  Otherwise preserves the resolver's order.
+void InterleaveAddressFamilies(ServerAddressList* addresses) {
+  if (addresses->empty()) return;
+  const int first_family =
+      grpc_sockaddr_get_family(&addresses->front().address());
+  ServerAddressList first;
+  ServerAddressList other;
+  for (ServerAddress& address : *addresses) {
+    if (grpc_sockaddr_get_family(&address.address()) == first_family) {
+      first.push_back(std::move(address));
+    } else {
+      other.push_back(std::move(address));
+    }
+  }
+  addresses->clear();
+  for (size_t i = 0; i < std::max(first.size(), other.size()); ++i) {
+    if (i < first.size()) addresses->push_back(std::move(first[i]));
+    if (i < other.size()) addresses->push_back(std::move(other[i]));
+  }
+}
+
 class PickFirst : public LoadBalancingPolicy {
  public:
   explicit PickFirst(Args args);
@@ -122,6 +152,11 @@ class PickFirst : public LoadBalancingPolicy {
       p->Unref(DEBUG_LOCATION, "subchannel_list");
     }
 
+    void Orphan() override {
+      CancelConnectionAttemptTimerLocked();
+      SubchannelList::Orphan();
+    }
+
     bool in_transient_failure() const { return in_transient_failure_; }
     void set_in_transient_failure(bool in_transient_failure) {
       in_transient_failure_ = in_transient_failure;
@@ -130,6 +165,14 @@ class PickFirst : public LoadBalancingPolicy {
     size_t attempting_index() const { return attempting_index_; }
     void set_attempting_index(size_t index) { attempting_index_ = index; }
 
+    // Starts a connection attempt on the subchannel at index.  With Happy
+    // Eyeballs enabled, also starts the timer that begins an attempt on the
+    // next subchannel if this one is still not connected by then; earlier
+    // attempts keep going in the meantime.
+    void StartConnectionAttemptLocked(size_t index);
+
+    void CancelConnectionAttemptTimerLocked();
+
     bool AllSubchannelsSeenInitialState() {
       for (size_t i = 0; i < num_subchannels(); ++i) {
         if (!subchannel(i)->connectivity_state().has_value()) return false;
@@ -138,8 +181,11 @@ class PickFirst : public LoadBalancingPolicy {
     }
 
    private:
+    void OnConnectionAttemptTimerLocked(size_t index);
+
     bool in_transient_failure_ = false;
     size_t attempting_index_ = 0;
+    absl::optional<EventEngine::TaskHandle> connection_attempt_timer_handle_;
   };
 
   class Picker : public SubchannelPicker {
@@ -161,6 +207,10 @@ class PickFirst : public LoadBalancingPolicy {
 
   // Lateset update args.
   UpdateArgs latest_update_args_;
+  // The Happy Eyeballs connection attempt delay, or zero if disabled.
+  Duration connection_attempt_delay_;
+  // Whether to reconnect right away instead of going IDLE.
+  bool prewarm_connection_ = false;
   // All our subchannels.
   RefCountedPtr<PickFirstSubchannelList> subchannel_list_;
   // Latest pending subchannel list.
@@ -220,6 +270,9 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
   if (latest_update_args_.addresses.ok()) {
     addresses = *latest_update_args_.addresses;
   }
+  if (connection_attempt_delay_ > Duration::Zero()) {
+    InterleaveAddressFamilies(&addresses);
+  }
   // Replace latest_pending_subchannel_list_.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace) &&
       latest_pending_subchannel_list_ != nullptr) {
@@ -288,6 +341,14 @@ absl::Status PickFirst::UpdateLocked(UpdateArgs args) {
   if (!args.addresses.ok() && latest_update_args_.config != nullptr) {
     args.addresses = std::move(latest_update_args_.addresses);
   }
+  connection_attempt_delay_ = std::max(
+      Duration::Zero(),
+      args.args
+          .GetDurationFromIntMillis(
+              GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
+          .value_or(Duration::Zero()));
+  prewarm_connection_ =
+      args.args.GetBool(GRPC_ARG_PREWARM_CONNECTION).value_or(false);
   // Update latest_update_args_.
   latest_update_args_ = std::move(args);
   // If we are not in idle, start connection attempt immediately.
@@ -352,6 +413,18 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
     // TODO(qianchengz): We may want to request re-resolution in
     // ExitIdleLocked().
     p->channel_control_helper()->RequestReresolution();
+    // To keep a warm connection, start connecting again right away.
+    if (p->prewarm_connection_) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+        gpr_log(GPR_INFO,
+                "Pick First %p selected subchannel lost; reconnecting", p);
+      }
+      // This reports CONNECTING, since there is no subchannel list.
+      p->selected_ = nullptr;
+      p->subchannel_list_.reset();
+      p->AttemptToConnectUsingLatestUpdateArgsLocked();
+      return;
+    }
     // TODO(roth): We chould check the connectivity states of all the
     // subchannels here, just in case one of them happens to be READY,
     // and we could switch to that rather than going IDLE.
@@ -386,7 +459,7 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
   // the subchannels report their state.
   if (!old_state.has_value()) {
     if (subchannel_list()->AllSubchannelsSeenInitialState()) {
-      subchannel_list()->subchannel(0)->subchannel()->RequestConnection();
+      subchannel_list()->StartConnectionAttemptLocked(0);
     }
     return;
   }
@@ -400,7 +473,6 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
       GPR_UNREACHABLE_CODE(break);
     case GRPC_CHANNEL_TRANSIENT_FAILURE: {
       size_t next_index = (Index() + 1) % subchannel_list()->num_subchannels();
-      subchannel_list()->set_attempting_index(next_index);
       PickFirstSubchannelData* sd = subchannel_list()->subchannel(next_index);
       // If we're tried all subchannels, set state to TRANSIENT_FAILURE.
       if (sd->Index() == 0) {
@@ -438,16 +510,8 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
               std::make_unique<TransientFailurePicker>(status));
         }
       }
-      // If the next subchannel is in IDLE, trigger a connection attempt.
-      // If it's in READY, we can't get here, because we would already
-      // have selected the subchannel above.
-      // If it's already in CONNECTING, we don't need to do this.
-      // If it's in TRANSIENT_FAILURE, then we will trigger the
-      // connection attempt later when it reports IDLE.
-      auto sd_state = sd->connectivity_state();
-      if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
-        sd->subchannel()->RequestConnection();
-      }
+      // Move on to the next subchannel.
+      subchannel_list()->StartConnectionAttemptLocked(next_index);
       break;
     }
     case GRPC_CHANNEL_IDLE: {
@@ -500,6 +564,7 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
     gpr_log(GPR_INFO, "Pick First %p selected subchannel %p", p, subchannel());
   }
   p->selected_ = this;
+  subchannel_list()->CancelConnectionAttemptTimerLocked();
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::Status(),
       std::make_unique<Picker>(subchannel()->Ref()));
@@ -510,6 +575,74 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   }
 }
 
+//
+// PickFirst::PickFirstSubchannelList
+//
+
+void PickFirst::PickFirstSubchannelList::StartConnectionAttemptLocked(
+    size_t index) {
+  CancelConnectionAttemptTimerLocked();
+  set_attempting_index(index);
+  // If the subchannel is in IDLE, trigger a connection attempt.
+  // If it's in READY, we can't get here, because we would already
+  // have selected the subchannel.
+  // If it's already in CONNECTING, we don't need to do this.
+  // If it's in TRANSIENT_FAILURE, then we will trigger the
+  // connection attempt later when it reports IDLE.
+  PickFirstSubchannelData* sd = subchannel(index);
+  auto state = sd->connectivity_state();
+  if (state.has_value() && *state == GRPC_CHANNEL_IDLE) {
+    sd->subchannel()->RequestConnection();
+  }
+  PickFirst* p = static_cast<PickFirst*>(policy());
+  if (p->connection_attempt_delay_ == Duration::Zero() ||
+      index + 1 == num_subchannels()) {
+    return;
+  }
+  connection_attempt_timer_handle_ =
+      p->channel_control_helper()->GetEventEngine()->RunAfter(
+          p->connection_attempt_delay_,
+          [self = WeakRef(DEBUG_LOCATION, "ConnectionAttemptTimer"),
+           index]() mutable {
+            ApplicationCallbackExecCtx app_exec_ctx;
+            ExecCtx exec_ctx;
+            auto* self_ptr = self.get();
+            static_cast<PickFirst*>(self_ptr->policy())
+                ->work_serializer()
+                ->Run(
+                    [self = std::move(self), index]() {
+                      self->OnConnectionAttemptTimerLocked(index);
+                    },
+                    DEBUG_LOCATION);
+          });
+}
+
+void PickFirst::PickFirstSubchannelList::CancelConnectionAttemptTimerLocked() {
+  if (connection_attempt_timer_handle_.has_value()) {
+    PickFirst* p = static_cast<PickFirst*>(policy());
+    p->channel_control_helper()->GetEventEngine()->Cancel(
+        *connection_attempt_timer_handle_);
+    connection_attempt_timer_handle_.reset();
+  }
+}
+
+void PickFirst::PickFirstSubchannelList::OnConnectionAttemptTimerLocked(
+    size_t index) {
+  // Ignore the timer if it was cancelled after it fired, i.e., if we have
+  // since selected a subchannel or moved on because of a failure.
+  if (shutting_down() || index != attempting_index()) return;
+  PickFirst* p = static_cast<PickFirst*>(policy());
+  if (p->selected_ != nullptr && p->subchannel_list_.get() == this) return;
+  connection_attempt_timer_handle_.reset();
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+    gpr_log(GPR_INFO,
+            "Pick First %p subchannel list %p: subchannel %" PRIuPTR
+            " not connected after %s; also trying the next one",
+            p, this, index, p->connection_attempt_delay_.ToString().c_str());
+  }
+  StartConnectionAttemptLocked(index + 1);
+}
+
 class PickFirstConfig : public LoadBalancingPolicy::Config {
  public:
   absl::string_view name() const override { return kPickFirst; }
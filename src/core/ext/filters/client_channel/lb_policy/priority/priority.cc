@@ -86,6 +86,8 @@ class PriorityLbConfig : public LoadBalancingPolicy::Config {
  public:
   struct PriorityLbChild {
     RefCountedPtr<LoadBalancingPolicy::Config> config;
+    // The JSON that config was parsed from, for comparing configs.
+    Json config_json;
     bool ignore_reresolution_requests = false;
 
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
@@ -140,8 +142,7 @@ class PriorityLb : public LoadBalancingPolicy {
 
     const std::string& name() const { return name_; }
 
-    absl::Status UpdateLocked(RefCountedPtr<LoadBalancingPolicy::Config> config,
-                              bool ignore_reresolution_requests);
+    absl::Status UpdateLocked(const PriorityLbConfig::PriorityLbChild& config);
     void ExitIdleLocked();
     void ResetBackoffLocked();
     void MaybeDeactivateLocked();
@@ -166,11 +167,16 @@ class PriorityLb : public LoadBalancingPolicy {
     class RefCountedPicker : public RefCounted<RefCountedPicker> {
      public:
       explicit RefCountedPicker(std::unique_ptr<SubchannelPicker> picker)
-          : picker_(std::move(picker)) {}
-      PickResult Pick(PickArgs args) { return picker_->Pick(args); }
+          : picker_(std::move(picker)), target_(picker_->Innermost()) {}
+      PickResult Pick(PickArgs args) { return target_->Pick(args); }
+
+      SubchannelPicker* target() const { return target_; }
 
      private:
       std::unique_ptr<SubchannelPicker> picker_;
+      // The picker that picks are forwarded to, past any pass-through
+      // layers in the child policy's picker.
+      SubchannelPicker* target_;
     };
 
     // A non-ref-counted wrapper for RefCountedPicker.
@@ -179,6 +185,9 @@ class PriorityLb : public LoadBalancingPolicy {
       explicit RefCountedPickerWrapper(RefCountedPtr<RefCountedPicker> picker)
           : picker_(std::move(picker)) {}
       PickResult Pick(PickArgs args) override { return picker_->Pick(args); }
+      SubchannelPicker* PassThroughTarget() override {
+        return picker_->target();
+      }
 
      private:
       RefCountedPtr<RefCountedPicker> picker_;
@@ -258,6 +267,14 @@ class PriorityLb : public LoadBalancingPolicy {
 
     bool seen_ready_or_idle_since_transient_failure_ = true;
 
+    // The last update passed to the child policy and its result, used to
+    // skip updates that would not change anything for the child.
+    Json last_config_json_;
+    absl::optional<ServerAddressList> last_addresses_;
+    std::string last_resolution_note_;
+    ChannelArgs last_args_;
+    absl::Status last_update_status_;
+
     OrphanablePtr<DeactivationTimer> deactivation_timer_;
     OrphanablePtr<FailoverTimer> failover_timer_;
   };
@@ -382,9 +399,7 @@ absl::Status PriorityLb::UpdateLocked(UpdateArgs args) {
       child->MaybeDeactivateLocked();
     } else {
       // Existing child found in new config.  Update it.
-      absl::Status status =
-          child->UpdateLocked(config_it->second.config,
-                              config_it->second.ignore_reresolution_requests);
+      absl::Status status = child->UpdateLocked(config_it->second);
       if (!status.ok()) {
         errors.emplace_back(
             absl::StrCat("child ", child_name, ": ", status.ToString()));
@@ -445,9 +460,7 @@ void PriorityLb::ChoosePriorityLocked() {
       GPR_DEBUG_ASSERT(child_config != config_->children().end());
       // TODO(roth): If the child reports a non-OK status with the
       // update, we need to propagate that back to the resolver somehow.
-      (void)child->UpdateLocked(
-          child_config->second.config,
-          child_config->second.ignore_reresolution_requests);
+      (void)child->UpdateLocked(child_config->second);
     } else {
       // The child already exists.  Reactivate if needed.
       child->MaybeReactivateLocked();
@@ -695,23 +708,50 @@ PriorityLb::ChildPriority::GetPicker() {
 }
 
 absl::Status PriorityLb::ChildPriority::UpdateLocked(
-    RefCountedPtr<LoadBalancingPolicy::Config> config,
-    bool ignore_reresolution_requests) {
+    const PriorityLbConfig::PriorityLbChild& config) {
   if (priority_policy_->shutting_down_) return absl::OkStatus();
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
     gpr_log(GPR_INFO, "[priority_lb %p] child %s (%p): start update",
             priority_policy_.get(), name_.c_str(), this);
   }
-  ignore_reresolution_requests_ = ignore_reresolution_requests;
+  ignore_reresolution_requests_ = config.ignore_reresolution_requests;
+  // If nothing that the child policy sees has changed, skip the update, so
+  // that an update to other priorities does not make this child rebuild
+  // its subchannels and picker.
+  const ServerAddressList* addresses = nullptr;
+  if (priority_policy_->addresses_.ok()) {
+    addresses = &(*priority_policy_->addresses_)[name_];
+  }
+  if (child_policy_ != nullptr && addresses != nullptr &&
+      last_addresses_.has_value() && *addresses == *last_addresses_ &&
+      config.config_json == last_config_json_ &&
+      priority_policy_->resolution_note_ == last_resolution_note_ &&
+      priority_policy_->args_ == last_args_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
+      gpr_log(GPR_INFO,
+              "[priority_lb %p] child %s (%p): child policy update unchanged, "
+              "skipping",
+              priority_policy_.get(), name_.c_str(), this);
+    }
+    return last_update_status_;
+  }
+  last_config_json_ = config.config_json;
+  if (addresses != nullptr) {
+    last_addresses_ = *addresses;
+  } else {
+    last_addresses_.reset();
+  }
+  last_resolution_note_ = priority_policy_->resolution_note_;
+  last_args_ = priority_policy_->args_;
   // Create policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(priority_policy_->args_);
   }
   // Construct update args.
   UpdateArgs update_args;
-  update_args.config = std::move(config);
-  if (priority_policy_->addresses_.ok()) {
-    update_args.addresses = (*priority_policy_->addresses_)[name_];
+  update_args.config = config.config;
+  if (addresses != nullptr) {
+    update_args.addresses = *addresses;
   } else {
     update_args.addresses = priority_policy_->addresses_.status();
   }
@@ -723,7 +763,8 @@ absl::Status PriorityLb::ChildPriority::UpdateLocked(
             "[priority_lb %p] child %s (%p): updating child policy handler %p",
             priority_policy_.get(), name_.c_str(), this, child_policy_.get());
   }
-  return child_policy_->UpdateLocked(std::move(update_args));
+  last_update_status_ = child_policy_->UpdateLocked(std::move(update_args));
+  return last_update_status_;
 }
 
 OrphanablePtr<LoadBalancingPolicy>
@@ -897,6 +938,7 @@ void PriorityLbConfig::PriorityLbChild::JsonPostLoad(const Json& json,
     return;
   }
   config = std::move(*lb_config);
+  config_json = it->second;
 }
 
 const JsonLoaderInterface* PriorityLbConfig::JsonLoader(const JsonArgs&) {
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -31,7 +32,6 @@
 
 #include "absl/base/attributes.h"
 #include "absl/base/thread_annotations.h"
-#include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/numbers.h"
@@ -79,16 +79,33 @@ UniqueTypeName RequestHashAttributeName() {
 
 // Helper Parser method
 
+namespace {
+
+// Envoy's limit on Maglev table sizes.
+constexpr uint64_t kMaxMaglevTableSize = 5000011;
+
+bool IsPrime(uint64_t n) {
+  if (n < 2) return false;
+  for (uint64_t i = 2; i * i <= n; ++i) {
+    if (n % i == 0) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 const JsonLoaderInterface* RingHashConfig::JsonLoader(const JsonArgs&) {
   static const auto* loader =
       JsonObjectLoader<RingHashConfig>()
           .OptionalField("min_ring_size", &RingHashConfig::min_ring_size)
           .OptionalField("max_ring_size", &RingHashConfig::max_ring_size)
+          .OptionalField("maglev_table_size",
+                         &RingHashConfig::maglev_table_size)
           .Finish();
   return loader;
 }
 
-void RingHashConfig::JsonPostLoad(const Json&, const JsonArgs&,
+void RingHashConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
                                   ValidationErrors* errors) {
   {
     ValidationErrors::ScopedField field(errors, ".min_ring_size");
@@ -107,6 +124,173 @@ void RingHashConfig::JsonPostLoad(const Json&, const JsonArgs&,
   if (min_ring_size > max_ring_size) {
     errors->AddError("max_ring_size cannot be smaller than min_ring_size");
   }
+  auto table_type = LoadJsonObjectField<std::string>(
+      json.object_value(), args, "lookup_table", errors, /*required=*/false);
+  if (table_type.has_value()) {
+    if (*table_type == "maglev") {
+      lookup_table = LookupTable::kMaglev;
+    } else if (*table_type != "ring") {
+      ValidationErrors::ScopedField field(errors, ".lookup_table");
+      errors->AddError("must be \"ring\" or \"maglev\"");
+    }
+  }
+  {
+    ValidationErrors::ScopedField field(errors, ".maglev_table_size");
+    if (!errors->FieldHasErrors() &&
+        (maglev_table_size > kMaxMaglevTableSize ||
+         !IsPrime(maglev_table_size))) {
+      errors->AddError("must be a prime number no larger than 5000011");
+    }
+  }
+}
+
+//
+// RingHashLookupTable
+//
+
+RingHashLookupTable::RingHashLookupTable(const RingHashConfig& config,
+                                         std::vector<Endpoint> endpoints)
+    : config_(config), endpoints_(std::move(endpoints)) {
+  if (endpoints_.empty()) return;
+  if (config_.lookup_table == RingHashConfig::LookupTable::kRing) {
+    BuildRing();
+  } else {
+    BuildMaglevTable();
+  }
+}
+
+bool RingHashLookupTable::Matches(
+    const RingHashConfig& config,
+    const std::vector<Endpoint>& endpoints) const {
+  return config_.lookup_table == config.lookup_table &&
+         config_.min_ring_size == config.min_ring_size &&
+         config_.max_ring_size == config.max_ring_size &&
+         config_.maglev_table_size == config.maglev_table_size &&
+         endpoints_ == endpoints;
+}
+
+size_t RingHashLookupTable::Find(uint64_t hash) const {
+  if (config_.lookup_table == RingHashConfig::LookupTable::kMaglev) {
+    return hash % table_.size();
+  }
+  // As in ketama, the request goes to the first entry whose hash is not
+  // less than the request hash, wrapping around at the end of the ring.
+  auto it = std::lower_bound(
+      ring_.begin(), ring_.end(), hash,
+      [](const RingEntry& entry, uint64_t h) { return entry.hash < h; });
+  return it == ring_.end() ? 0 : it - ring_.begin();
+}
+
+void RingHashLookupTable::BuildRing() {
+  // Find the smallest normalized weight.
+  size_t sum = 0;
+  for (const Endpoint& endpoint : endpoints_) sum += endpoint.weight;
+  double min_normalized_weight = 1.0;
+  for (const Endpoint& endpoint : endpoints_) {
+    min_normalized_weight =
+        std::min(static_cast<double>(endpoint.weight) / sum,
+                 min_normalized_weight);
+  }
+  // Scale up the number of hashes per host such that the least-weighted host
+  // gets a whole number of hashes on the ring. Other hosts might not end up
+  // with whole numbers, and that's fine (the ring-building algorithm below can
+  // handle this). This preserves the original implementation's behavior: when
+  // weights aren't provided, all hosts should get an equal number of hashes. In
+  // the case where this number exceeds the max_ring_size, it's scaled back down
+  // to fit.
+  const double scale = std::min(
+      std::ceil(min_normalized_weight * config_.min_ring_size) /
+          min_normalized_weight,
+      static_cast<double>(config_.max_ring_size));
+  // Reserve memory for the entire ring up front.
+  const size_t ring_size = std::ceil(scale);
+  ring_.reserve(ring_size);
+  // Populate the hash ring by walking through the (host, weight) pairs in
+  // endpoints_, and generating (scale * weight) hashes for each
+  // host. Since these aren't necessarily whole numbers, we maintain running
+  // sums -- current_hashes and target_hashes -- which allows us to populate the
+  // ring in a mostly stable way.
+  std::string hash_key;
+  double current_hashes = 0.0;
+  double target_hashes = 0.0;
+  for (size_t i = 0; i < endpoints_.size(); ++i) {
+    // Each hash key is "<address>_<count>"; only the count is rewritten.
+    hash_key.assign(endpoints_[i].hash_key);
+    hash_key.push_back('_');
+    const size_t prefix_size = hash_key.size();
+    target_hashes += scale * (static_cast<double>(endpoints_[i].weight) / sum);
+    size_t count = 0;
+    while (current_hashes < target_hashes) {
+      hash_key.resize(prefix_size);
+      absl::StrAppend(&hash_key, count);
+      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
+      ring_.push_back({hash, static_cast<uint32_t>(i)});
+      ++count;
+      ++current_hashes;
+    }
+  }
+  std::sort(ring_.begin(), ring_.end(),
+            [](const RingEntry& lhs, const RingEntry& rhs) {
+              return lhs.hash < rhs.hash;
+            });
+}
+
+void RingHashLookupTable::BuildMaglevTable() {
+  // Maglev (Eisenbud et al., NSDI 2016), with Envoy's extension for
+  // weights: each endpoint walks its own permutation of the table and, in
+  // turn, claims the next free slot on it, taking a turn in a fraction of
+  // the rounds proportional to its weight.  Endpoints take turns in hash
+  // key order, so the table does not depend on the order of the address
+  // list.
+  struct BuildEntry {
+    uint32_t endpoint_index;
+    uint64_t offset;
+    uint64_t skip;
+    uint64_t weight;
+    uint64_t target_weight = 0;
+    uint64_t next = 0;
+  };
+  const uint64_t table_size = config_.maglev_table_size;
+  std::vector<BuildEntry> entries;
+  entries.reserve(endpoints_.size());
+  uint64_t max_weight = 0;
+  for (size_t i = 0; i < endpoints_.size(); ++i) {
+    const std::string& key = endpoints_[i].hash_key;
+    BuildEntry entry;
+    entry.endpoint_index = static_cast<uint32_t>(i);
+    entry.offset = XXH64(key.data(), key.size(), 0) % table_size;
+    entry.skip = XXH64(key.data(), key.size(), 1) % (table_size - 1) + 1;
+    entry.weight = endpoints_[i].weight;
+    max_weight = std::max(max_weight, entry.weight);
+    entries.push_back(entry);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [this](const BuildEntry& lhs, const BuildEntry& rhs) {
+              const std::string& lhs_key =
+                  endpoints_[lhs.endpoint_index].hash_key;
+              const std::string& rhs_key =
+                  endpoints_[rhs.endpoint_index].hash_key;
+              if (lhs_key != rhs_key) return lhs_key < rhs_key;
+              return lhs.endpoint_index < rhs.endpoint_index;
+            });
+  constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+  table_.assign(table_size, kEmpty);
+  uint64_t filled = 0;
+  // The heaviest endpoint takes a turn in every round, so each round fills
+  // at least one slot.
+  for (uint64_t round = 0; filled < table_size; ++round) {
+    for (BuildEntry& entry : entries) {
+      if (filled == table_size) break;
+      if (round * entry.weight < entry.target_weight) continue;
+      entry.target_weight += max_weight;
+      uint64_t slot;
+      do {
+        slot = (entry.offset + entry.skip * entry.next++) % table_size;
+      } while (table_[slot] != kEmpty);
+      table_[slot] = entry.endpoint_index;
+      ++filled;
+    }
+  }
 }
 
 namespace {
@@ -115,15 +299,12 @@ constexpr absl::string_view kRingHash = "ring_hash_experimental";
 
 class RingHashLbConfig : public LoadBalancingPolicy::Config {
  public:
-  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size)
-      : min_ring_size_(min_ring_size), max_ring_size_(max_ring_size) {}
+  explicit RingHashLbConfig(const RingHashConfig& config) : config_(config) {}
   absl::string_view name() const override { return kRingHash; }
-  size_t min_ring_size() const { return min_ring_size_; }
-  size_t max_ring_size() const { return max_ring_size_; }
+  const RingHashConfig& ring_hash_config() const { return config_; }
 
  private:
-  size_t min_ring_size_;
-  size_t max_ring_size_;
+  RingHashConfig config_;
 };
 
 //
@@ -192,24 +373,25 @@ class RingHash : public LoadBalancingPolicy {
     absl::Status connectivity_status_ ABSL_GUARDED_BY(&mu_);
   };
 
-  // A list of subchannels and the ring containing those subchannels.
+  // A list of subchannels and the lookup table containing those
+  // subchannels.
   class RingHashSubchannelList
       : public SubchannelList<RingHashSubchannelList, RingHashSubchannelData> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      RingHashSubchannelData* subchannel;
-    };
-
+    // If previous_table was built from the same endpoints, it is reused
+    // rather than building a new one.
     RingHashSubchannelList(RingHash* policy, ServerAddressList addresses,
-                           const ChannelArgs& args);
+                           const ChannelArgs& args,
+                           RefCountedPtr<RingHashLookupTable> previous_table);
 
     ~RingHashSubchannelList() override {
       RingHash* p = static_cast<RingHash*>(policy());
       p->Unref(DEBUG_LOCATION, "subchannel_list");
     }
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    const RefCountedPtr<RingHashLookupTable>& lookup_table() const {
+      return lookup_table_;
+    }
 
     // Updates the counters of subchannels in each state when a
     // subchannel transitions from old_state to new_state.
@@ -240,7 +422,7 @@ class RingHash : public LoadBalancingPolicy {
     size_t num_connecting_ = 0;
     size_t num_transient_failure_ = 0;
 
-    std::vector<RingEntry> ring_;
+    RefCountedPtr<RingHashLookupTable> lookup_table_;
 
     // The index of the subchannel currently doing an internally
     // triggered connection attempt, if any.
@@ -357,34 +539,12 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     return PickResult::Fail(
         absl::InternalError("ring hash value is not a number"));
   }
-  const auto& ring = subchannel_list_->ring();
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and first_index. Do not change them!
-  size_t lowp = 0;
-  size_t highp = ring.size();
-  size_t first_index = 0;
-  while (true) {
-    first_index = (lowp + highp) / 2;
-    if (first_index == ring.size()) {
-      first_index = 0;
-      break;
-    }
-    uint64_t midval = ring[first_index].hash;
-    uint64_t midval1 = first_index == 0 ? 0 : ring[first_index - 1].hash;
-    if (h <= midval && h > midval1) {
-      break;
-    }
-    if (midval < h) {
-      lowp = first_index + 1;
-    } else {
-      highp = first_index - 1;
-    }
-    if (lowp > highp) {
-      first_index = 0;
-      break;
-    }
-  }
+  const RingHashLookupTable& table = *subchannel_list_->lookup_table();
+  const size_t first_index = table.Find(h);
+  auto entry_subchannel = [&](size_t position) {
+    return subchannel_list_->subchannel(table.EndpointIndex(position));
+  };
+  RingHashSubchannelData* first_subchannel = entry_subchannel(first_index);
   OrphanablePtr<SubchannelConnectionAttempter> subchannel_connection_attempter;
   auto ScheduleSubchannelConnectionAttempt =
       [&](RefCountedPtr<SubchannelInterface> subchannel) {
@@ -396,41 +556,38 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
         }
         subchannel_connection_attempter->AddSubchannel(std::move(subchannel));
       };
-  switch (ring[first_index].subchannel->GetConnectivityState()) {
+  switch (first_subchannel->GetConnectivityState()) {
     case GRPC_CHANNEL_READY:
-      return PickResult::Complete(
-          ring[first_index].subchannel->subchannel()->Ref());
+      return PickResult::Complete(first_subchannel->subchannel()->Ref());
     case GRPC_CHANNEL_IDLE:
       ScheduleSubchannelConnectionAttempt(
-          ring[first_index].subchannel->subchannel()->Ref());
+          first_subchannel->subchannel()->Ref());
       ABSL_FALLTHROUGH_INTENDED;
     case GRPC_CHANNEL_CONNECTING:
       return PickResult::Queue();
     default:  // GRPC_CHANNEL_TRANSIENT_FAILURE
       break;
   }
-  ScheduleSubchannelConnectionAttempt(
-      ring[first_index].subchannel->subchannel()->Ref());
+  ScheduleSubchannelConnectionAttempt(first_subchannel->subchannel()->Ref());
   // Loop through remaining subchannels to find one in READY.
   // On the way, we make sure the right set of connection attempts
   // will happen.
   bool found_second_subchannel = false;
   bool found_first_non_failed = false;
-  for (size_t i = 1; i < ring.size(); ++i) {
-    const auto& entry = ring[(first_index + i) % ring.size()];
-    if (entry.subchannel == ring[first_index].subchannel) {
+  for (size_t i = 1; i < table.size(); ++i) {
+    RingHashSubchannelData* entry =
+        entry_subchannel((first_index + i) % table.size());
+    if (entry == first_subchannel) {
       continue;
     }
-    grpc_connectivity_state connectivity_state =
-        entry.subchannel->GetConnectivityState();
+    grpc_connectivity_state connectivity_state = entry->GetConnectivityState();
     if (connectivity_state == GRPC_CHANNEL_READY) {
-      return PickResult::Complete(entry.subchannel->subchannel()->Ref());
+      return PickResult::Complete(entry->subchannel()->Ref());
     }
     if (!found_second_subchannel) {
       switch (connectivity_state) {
         case GRPC_CHANNEL_IDLE:
-          ScheduleSubchannelConnectionAttempt(
-              entry.subchannel->subchannel()->Ref());
+          ScheduleSubchannelConnectionAttempt(entry->subchannel()->Ref());
           ABSL_FALLTHROUGH_INTENDED;
         case GRPC_CHANNEL_CONNECTING:
           return PickResult::Queue();
@@ -441,12 +598,10 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     }
     if (!found_first_non_failed) {
       if (connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
-        ScheduleSubchannelConnectionAttempt(
-            entry.subchannel->subchannel()->Ref());
+        ScheduleSubchannelConnectionAttempt(entry->subchannel()->Ref());
       } else {
         if (connectivity_state == GRPC_CHANNEL_IDLE) {
-          ScheduleSubchannelConnectionAttempt(
-              entry.subchannel->subchannel()->Ref());
+          ScheduleSubchannelConnectionAttempt(entry->subchannel()->Ref());
         }
         found_first_non_failed = true;
       }
@@ -454,7 +609,7 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   return PickResult::Fail(absl::UnavailableError(absl::StrCat(
       "ring hash cannot find a connected subchannel; first failure: ",
-      ring[first_index].subchannel->GetConnectivityStatus().ToString())));
+      first_subchannel->GetConnectivityStatus().ToString())));
 }
 
 //
@@ -462,7 +617,8 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
 //
 
 RingHash::RingHashSubchannelList::RingHashSubchannelList(
-    RingHash* policy, ServerAddressList addresses, const ChannelArgs& args)
+    RingHash* policy, ServerAddressList addresses, const ChannelArgs& args,
+    RefCountedPtr<RingHashLookupTable> previous_table)
     : SubchannelList(policy,
                      (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)
                           ? "RingHashSubchannelList"
@@ -474,101 +630,41 @@ RingHash::RingHashSubchannelList::RingHashSubchannelList(
   // any references to subchannels, since the subchannels'
   // pollset_sets will include the LB policy's pollset_set.
   policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
-  // Construct the ring.
-  // Store the weights while finding the sum.
-  struct AddressWeight {
-    std::string address;
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
-  std::vector<AddressWeight> address_weights;
-  size_t sum = 0;
-  address_weights.reserve(num_subchannels());
+  // Collect the hash keys and weights that the lookup table is built from.
+  std::vector<RingHashLookupTable::Endpoint> endpoints;
+  endpoints.reserve(num_subchannels());
   for (size_t i = 0; i < num_subchannels(); ++i) {
     RingHashSubchannelData* sd = subchannel(i);
     const ServerAddressWeightAttribute* weight_attribute = static_cast<
         const ServerAddressWeightAttribute*>(sd->address().GetAttribute(
         ServerAddressWeightAttribute::kServerAddressWeightAttributeKey));
-    AddressWeight address_weight;
-    address_weight.address =
+    RingHashLookupTable::Endpoint endpoint;
+    endpoint.hash_key =
         grpc_sockaddr_to_string(&sd->address().address(), false).value();
+    // Default weight is 1 for the cases where a weight is not provided,
+    // each occurrence of the address will be counted a weight value of 1.
     // Weight should never be zero, but ignore it just in case, since
     // that value would screw up the ring-building algorithm.
+    endpoint.weight = 1;
     if (weight_attribute != nullptr && weight_attribute->weight() > 0) {
-      address_weight.weight = weight_attribute->weight();
+      endpoint.weight = weight_attribute->weight();
     }
-    sum += address_weight.weight;
-    address_weights.push_back(std::move(address_weight));
+    endpoints.push_back(std::move(endpoint));
   }
-  // Calculating normalized weights and find min and max.
-  double min_normalized_weight = 1.0;
-  double max_normalized_weight = 0.0;
-  for (auto& address : address_weights) {
-    address.normalized_weight = static_cast<double>(address.weight) / sum;
-    min_normalized_weight =
-        std::min(address.normalized_weight, min_normalized_weight);
-    max_normalized_weight =
-        std::max(address.normalized_weight, max_normalized_weight);
-  }
-  // Scale up the number of hashes per host such that the least-weighted host
-  // gets a whole number of hashes on the ring. Other hosts might not end up
-  // with whole numbers, and that's fine (the ring-building algorithm below can
-  // handle this). This preserves the original implementation's behavior: when
-  // weights aren't provided, all hosts should get an equal number of hashes. In
-  // the case where this number exceeds the max_ring_size, it's scaled back down
-  // to fit.
-  const size_t min_ring_size = policy->config_->min_ring_size();
-  const size_t max_ring_size = policy->config_->max_ring_size();
-  const double scale = std::min(
-      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
-      static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const size_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
-  double current_hashes = 0.0;
-  double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < num_subchannels(); ++i) {
-    const std::string& address_string = address_weights[i].address;
-    hash_key_buffer.assign(address_string.begin(), address_string.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * address_weights[i].normalized_weight;
-    size_t count = 0;
-    while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, subchannel(i)});
-      ++count;
-      ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
-    }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
+  const RingHashConfig& config = policy->config_->ring_hash_config();
+  const bool reused =
+      previous_table != nullptr && previous_table->Matches(config, endpoints);
+  if (reused) {
+    lookup_table_ = std::move(previous_table);
+  } else {
+    lookup_table_ =
+        MakeRefCounted<RingHashLookupTable>(config, std::move(endpoints));
   }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingHashSubchannelList::RingEntry& lhs,
-               const RingHashSubchannelList::RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
     gpr_log(GPR_INFO,
-            "[RH %p] created subchannel list %p with %" PRIuPTR " ring entries",
-            policy, this, ring_.size());
+            "[RH %p] created subchannel list %p with %" PRIuPTR
+            " lookup table entries (%s)",
+            policy, this, lookup_table_->size(), reused ? "reused" : "built");
   }
 }
 
@@ -822,8 +918,15 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
     gpr_log(GPR_INFO, "[RH %p] replacing latest pending subchannel list %p",
             this, latest_pending_subchannel_list_.get());
   }
+  // The newest list's table is the most likely to match this update.
+  RefCountedPtr<RingHashLookupTable> previous_table;
+  if (latest_pending_subchannel_list_ != nullptr) {
+    previous_table = latest_pending_subchannel_list_->lookup_table();
+  } else if (subchannel_list_ != nullptr) {
+    previous_table = subchannel_list_->lookup_table();
+  }
   latest_pending_subchannel_list_ = MakeRefCounted<RingHashSubchannelList>(
-      this, std::move(addresses), args.args);
+      this, std::move(addresses), args.args, std::move(previous_table));
   latest_pending_subchannel_list_->StartWatchingLocked();
   // If we have no existing list or the new list is empty, immediately
   // promote the new list.
@@ -875,8 +978,7 @@ class RingHashFactory : public LoadBalancingPolicyFactory {
     auto config = LoadFromJson<RingHashConfig>(
         json, JsonArgs(), "errors validating ring_hash LB policy config");
     if (!config.ok()) return config.status();
-    return MakeRefCounted<RingHashLbConfig>(config->min_ring_size,
-                                            config->max_ring_size);
+    return MakeRefCounted<RingHashLbConfig>(*config);
   }
 };
 
@@ -19,8 +19,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <string>
+#include <vector>
+
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
@@ -34,14 +39,78 @@ UniqueTypeName RequestHashAttributeName();
 // Helper Parsing method to parse ring hash policy configs; for example, ring
 // hash size validity.
 struct RingHashConfig {
+  // How request hashes are mapped onto endpoints.  kRing builds a ketama
+  // ring of between min_ring_size and max_ring_size entries, compatible
+  // with Envoy's ring_hash policy.  kMaglev builds a Maglev lookup table of
+  // maglev_table_size entries, which is cheaper to build and maps a hash in
+  // O(1), at the cost of somewhat more disruption when endpoints change.
+  enum class LookupTable { kRing, kMaglev };
+
   uint64_t min_ring_size = 1024;
   uint64_t max_ring_size = 8388608;
+  LookupTable lookup_table = LookupTable::kRing;
+  uint64_t maglev_table_size = 65537;
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
-  void JsonPostLoad(const Json& json, const JsonArgs&,
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
                     ValidationErrors* errors);
 };
 
+// The table used by the ring_hash policy to map a request hash onto an
+// endpoint.  It depends only on the config and on each endpoint's hash key
+// and weight, so a new subchannel list whose endpoints are unchanged can
+// share its predecessor's table instead of rebuilding it.
+class RingHashLookupTable : public RefCounted<RingHashLookupTable> {
+ public:
+  struct Endpoint {
+    std::string hash_key;
+    uint32_t weight;
+
+    bool operator==(const Endpoint& other) const {
+      return hash_key == other.hash_key && weight == other.weight;
+    }
+  };
+
+  RingHashLookupTable(const RingHashConfig& config,
+                      std::vector<Endpoint> endpoints);
+
+  // Returns true if this table was built from the given config and
+  // endpoints, in which case it can be reused as is.
+  bool Matches(const RingHashConfig& config,
+               const std::vector<Endpoint>& endpoints) const;
+
+  size_t size() const {
+    return config_.lookup_table == RingHashConfig::LookupTable::kRing
+               ? ring_.size()
+               : table_.size();
+  }
+
+  // Returns the position of the entry that a request hash maps to.  If
+  // that entry's endpoint is unusable, callers walk forward from there.
+  size_t Find(uint64_t hash) const;
+
+  // Returns the index in the endpoint list of the entry at position.
+  size_t EndpointIndex(size_t position) const {
+    return config_.lookup_table == RingHashConfig::LookupTable::kRing
+               ? ring_[position].endpoint_index
+               : table_[position];
+  }
+
+ private:
+  struct RingEntry {
+    uint64_t hash;
+    uint32_t endpoint_index;
+  };
+
+  void BuildRing();
+  void BuildMaglevTable();
+
+  const RingHashConfig config_;
+  const std::vector<Endpoint> endpoints_;
+  std::vector<RingEntry> ring_;
+  std::vector<uint32_t> table_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_RING_HASH_RING_HASH_H
@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <map>
@@ -123,6 +124,14 @@ const Duration kCacheBackoffInitial = Duration::Seconds(1);
 const double kCacheBackoffMultiplier = 1.6;
 const double kCacheBackoffJitter = 0.2;
 const Duration kCacheBackoffMax = Duration::Minutes(2);
+// How long a pick for a throttled key fails fast without consulting the
+// throttle again.
+const Duration kThrottledEntryTime = Duration::Seconds(1);
+// An entry that has served this many picks since its last RLS response is
+// refreshed during the last 1/kPrefetchFraction of its stale age, rather
+// than once it is stale.
+const size_t kPrefetchMinPicks = 10;
+const int64_t kPrefetchFraction = 10;
 const Duration kDefaultThrottleWindowSize = Duration::Seconds(30);
 const double kDefaultThrottleRatioForSuccesses = 2.0;
 const int kDefaultThrottlePadding = 8;
@@ -415,6 +424,22 @@ class RlsLb : public LoadBalancingPolicy {
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
         return min_expiration_time_;
       }
+      Timestamp throttled_until() const
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        return throttled_until_;
+      }
+      void set_throttled_until(Timestamp throttled_until)
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        throttled_until_ = throttled_until;
+      }
+
+      // Returns true if the entry is used often enough that it should be
+      // refreshed before it becomes stale, and the time to do so has come.
+      bool ShouldPrefetch(Timestamp now) const
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        return picks_since_response_ >= kPrefetchMinPicks &&
+               prefetch_time_ <= now;
+      }
 
       std::unique_ptr<BackOff> TakeBackoffState()
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
@@ -488,6 +513,14 @@ class RlsLb : public LoadBalancingPolicy {
       Timestamp data_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_) =
           Timestamp::InfPast();
       Timestamp stale_time_ ABSL_GUARDED_BY(&RlsLb::mu_) = Timestamp::InfPast();
+      Timestamp prefetch_time_ ABSL_GUARDED_BY(&RlsLb::mu_) =
+          Timestamp::InfFuture();
+      size_t picks_since_response_ ABSL_GUARDED_BY(&RlsLb::mu_) = 0;
+
+      // Set while picks for the key fail fast because the RLS request for
+      // it was throttled.
+      Timestamp throttled_until_ ABSL_GUARDED_BY(&RlsLb::mu_) =
+          Timestamp::InfPast();
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
@@ -686,6 +719,7 @@ class RlsLb : public LoadBalancingPolicy {
   // Returns a new picker to the channel to trigger reprocessing of
   // pending picks.  Schedules the actual picker update on the ExecCtx
   // to be run later, so it's safe to invoke this while holding the lock.
+  // Calls made before a scheduled update has started share it.
   void UpdatePickerAsync();
   // Hops into work serializer and calls UpdatePickerLocked().
   static void UpdatePickerCallback(void* arg, grpc_error_handle error);
@@ -699,6 +733,9 @@ class RlsLb : public LoadBalancingPolicy {
   Mutex mu_;
   bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
   bool update_in_progress_ = false;
+  // Set while a picker update scheduled by UpdatePickerAsync() has not
+  // started yet.
+  std::atomic<bool> picker_update_pending_{false};
   Cache cache_ ABSL_GUARDED_BY(mu_);
   // Maps an RLS request key to an RlsRequest object that represents a pending
   // RLS request.
@@ -1036,17 +1073,26 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
   // Check if there's a cache entry.
   Cache::Entry* entry = lb_policy_->cache_.Find(key);
   // If there is no cache entry, or if the cache entry is not in backoff
-  // and has a stale time in the past, and there is not already a
-  // pending RLS request for this key, then try to start a new RLS request.
+  // and has a stale time in the past (or is used often enough to be
+  // refreshed ahead of that), and there is not already a pending RLS
+  // request for this key, then try to start a new RLS request.
   if ((entry == nullptr ||
-       (entry->stale_time() < now && entry->backoff_time() < now)) &&
+       ((entry->stale_time() < now || entry->ShouldPrefetch(now)) &&
+        entry->backoff_time() < now)) &&
       lb_policy_->request_map_.find(key) == lb_policy_->request_map_.end()) {
-    // Check if requests are being throttled.
-    if (lb_policy_->rls_channel_->ShouldThrottle()) {
+    // Check if requests are being throttled.  A key without data that was
+    // just throttled stays so for a while, so that its picks do not each
+    // count as another throttled request.
+    if ((entry != nullptr && entry->throttled_until() >= now) ||
+        lb_policy_->rls_channel_->ShouldThrottle()) {
       // Request is throttled.
       // If there is no non-expired data in the cache, then we use the
       // default target if set, or else we fail the pick.
       if (entry == nullptr || entry->data_expiration_time() < now) {
+        if (entry == nullptr) entry = lb_policy_->cache_.FindOrInsert(key);
+        if (entry->throttled_until() < now) {
+          entry->set_throttled_until(now + kThrottledEntryTime);
+        }
         if (default_child_policy_ != nullptr) {
           if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
             gpr_log(GPR_INFO,
@@ -1205,6 +1251,7 @@ size_t RlsLb::Cache::Entry::Size() const {
 }
 
 LoadBalancingPolicy::PickResult RlsLb::Cache::Entry::Pick(PickArgs args) {
+  ++picks_since_response_;
   size_t i = 0;
   ChildPolicyWrapper* child_policy_wrapper = nullptr;
   // Skip targets before the last one that are in state TRANSIENT_FAILURE.
@@ -1265,10 +1312,10 @@ bool RlsLb::Cache::Entry::CanEvict() const {
 }
 
 void RlsLb::Cache::Entry::MarkUsed() {
+  // Splicing keeps lru_iterator_ valid and does not allocate, which
+  // matters since every pick that finds the entry does this.
   auto& lru_list = lb_policy_->cache_.lru_list_;
-  auto new_it = lru_list.insert(lru_list.end(), *lru_iterator_);
-  lru_list.erase(lru_iterator_);
-  lru_iterator_ = new_it;
+  lru_list.splice(lru_list.end(), lru_list, lru_iterator_);
 }
 
 std::vector<RlsLb::ChildPolicyWrapper*>
@@ -1298,6 +1345,10 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
   Timestamp now = Timestamp::Now();
   data_expiration_time_ = now + lb_policy_->config_->max_age();
   stale_time_ = now + lb_policy_->config_->stale_age();
+  prefetch_time_ =
+      stale_time_ - lb_policy_->config_->stale_age() / kPrefetchFraction;
+  picks_since_response_ = 0;
+  throttled_until_ = Timestamp::InfPast();
   status_ = absl::OkStatus();
   backoff_state_.reset();
   backoff_time_ = Timestamp::InfPast();
@@ -2073,6 +2124,11 @@ void RlsLb::ShutdownLocked() {
 }
 
 void RlsLb::UpdatePickerAsync() {
+  // The picker reads the cache when picking, so an update that has not
+  // started yet will see this change too.  This keeps a burst of RLS
+  // responses, e.g. for a cold cache, from reprocessing the queued picks
+  // once per response.
+  if (picker_update_pending_.exchange(true)) return;
   // Run via the ExecCtx, since the caller may be holding the lock, and
   // we don't want to be doing that when we hop into the WorkSerializer,
   // in case the WorkSerializer callback happens to run inline.
@@ -2089,6 +2145,7 @@ void RlsLb::UpdatePickerCallback(void* arg, grpc_error_handle /*error*/) {
   rls_lb->work_serializer()->Run(
       [rls_lb]() {
         RefCountedPtr<RlsLb> lb_policy(rls_lb);
+        lb_policy->picker_update_pending_.store(false);
         lb_policy->UpdatePickerLocked();
         lb_policy.reset(DEBUG_LOCATION, "UpdatePickerCallback");
       },
@@ -0,0 +1,87 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/subchannel_rtt.h"
+
+#include <utility>
+
+#include "src/core/ext/filters/client_channel/subchannel.h"
+#include "src/core/ext/filters/client_channel/subchannel_interface_internal.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/transport/connection_rtt.h"
+
+namespace grpc_core {
+
+//
+// SubchannelRttWatcher
+//
+
+// Nothing needs to be produced here: the transport keeps the estimate up to
+// date on its own, so the watcher only has to hand the real subchannel over
+// to the SubchannelRtt.
+class SubchannelRttWatcher : public InternalSubchannelDataWatcherInterface {
+ public:
+  explicit SubchannelRttWatcher(RefCountedPtr<SubchannelRtt> rtt)
+      : rtt_(std::move(rtt)) {}
+
+  // When the client channel sees this wrapper, it will pass it the real
+  // subchannel to use.
+  void SetSubchannel(Subchannel* subchannel) override {
+    rtt_->SetSubchannel(subchannel);
+  }
+
+ private:
+  RefCountedPtr<SubchannelRtt> rtt_;
+};
+
+//
+// SubchannelRtt
+//
+
+// Defined here rather than in the header, where Subchannel is incomplete.
+SubchannelRtt::~SubchannelRtt() = default;
+
+absl::optional<Duration> SubchannelRtt::GetSmoothedRtt() const {
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+  {
+    MutexLock lock(&mu_);
+    if (subchannel_ == nullptr) return absl::nullopt;
+    connected_subchannel = subchannel_->connected_subchannel();
+  }
+  if (connected_subchannel == nullptr ||
+      connected_subchannel->rtt() == nullptr) {
+    return absl::nullopt;
+  }
+  return connected_subchannel->rtt()->smoothed_rtt();
+}
+
+void SubchannelRtt::SetSubchannel(Subchannel* subchannel) {
+  MutexLock lock(&mu_);
+  subchannel_ = subchannel->WeakRef(DEBUG_LOCATION, "SubchannelRtt");
+}
+
+//
+// public API
+//
+
+std::unique_ptr<SubchannelInterface::DataWatcherInterface>
+MakeSubchannelRttWatcher(RefCountedPtr<SubchannelRtt> rtt) {
+  return std::make_unique<SubchannelRttWatcher>(std::move(rtt));
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,72 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_SUBCHANNEL_RTT_H
+#define GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_SUBCHANNEL_RTT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/load_balancing/subchannel_interface.h"
+
+namespace grpc_core {
+
+class Subchannel;
+
+// Gives LB policies access to the round trip time of a subchannel's current
+// connection, as measured by the transport from its HTTP/2 ping round trips.
+// Policies can use it to steer traffic away from, or eject, backends whose
+// connection is up but degraded, well before a keepalive timeout would
+// notice.
+//
+// To use this, an LB policy creates a SubchannelRtt and registers it with
+// the subchannel like this:
+//   auto rtt = MakeRefCounted<SubchannelRtt>();
+//   subchannel->AddDataWatcher(MakeSubchannelRttWatcher(rtt));
+// and then polls rtt->GetSmoothedRtt() whenever it needs a value, e.g. from
+// a periodic timer or when building a picker.  It is safe to call from any
+// thread.
+class SubchannelRtt : public RefCounted<SubchannelRtt> {
+ public:
+  ~SubchannelRtt() override;
+
+  // Returns the smoothed RTT of the subchannel's current connection, or
+  // nullopt if it is not connected or has not completed a ping yet.
+  absl::optional<Duration> GetSmoothedRtt() const;
+
+ private:
+  friend class SubchannelRttWatcher;
+
+  void SetSubchannel(Subchannel* subchannel);
+
+  mutable Mutex mu_;
+  WeakRefCountedPtr<Subchannel> subchannel_ ABSL_GUARDED_BY(mu_);
+};
+
+std::unique_ptr<SubchannelInterface::DataWatcherInterface>
+MakeSubchannelRttWatcher(RefCountedPtr<SubchannelRtt> rtt);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_SUBCHANNEL_RTT_H
@@ -0,0 +1,1057 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+
+#include <grpc/impl/codegen/connectivity_state.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
+#include "src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.h"
+#include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/load_balancing/lb_policy_factory.h"
+#include "src/core/lib/load_balancing/lb_policy_registry.h"
+#include "src/core/lib/load_balancing/subchannel_interface.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+
+namespace grpc_core {
+
+TraceFlag grpc_lb_wrr_trace(false, "weighted_round_robin_lb");
+
+namespace {
+
+constexpr absl::string_view kWeightedRoundRobin = "weighted_round_robin";
+
+//
+// config
+//
+
+class WeightedRoundRobinConfig : public LoadBalancingPolicy::Config {
+ public:
+  WeightedRoundRobinConfig() = default;
+
+  WeightedRoundRobinConfig(const WeightedRoundRobinConfig&) = delete;
+  WeightedRoundRobinConfig& operator=(const WeightedRoundRobinConfig&) =
+      delete;
+
+  WeightedRoundRobinConfig(WeightedRoundRobinConfig&&) = delete;
+  WeightedRoundRobinConfig& operator=(WeightedRoundRobinConfig&&) = delete;
+
+  absl::string_view name() const override { return kWeightedRoundRobin; }
+
+  bool enable_oob_load_report() const { return enable_oob_load_report_; }
+  Duration oob_reporting_period() const { return oob_reporting_period_; }
+  Duration blackout_period() const { return blackout_period_; }
+  Duration weight_update_period() const { return weight_update_period_; }
+  Duration weight_expiration_period() const {
+    return weight_expiration_period_;
+  }
+  float error_utilization_penalty() const {
+    return error_utilization_penalty_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<WeightedRoundRobinConfig>()
+            .OptionalField("enableOobLoadReport",
+                           &WeightedRoundRobinConfig::enable_oob_load_report_)
+            .OptionalField("oobReportingPeriod",
+                           &WeightedRoundRobinConfig::oob_reporting_period_)
+            .OptionalField("blackoutPeriod",
+                           &WeightedRoundRobinConfig::blackout_period_)
+            .OptionalField("weightUpdatePeriod",
+                           &WeightedRoundRobinConfig::weight_update_period_)
+            .OptionalField(
+                "weightExpirationPeriod",
+                &WeightedRoundRobinConfig::weight_expiration_period_)
+            .OptionalField(
+                "errorUtilizationPenalty",
+                &WeightedRoundRobinConfig::error_utilization_penalty_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    // Weight updates more frequent than this are not useful and would
+    // only churn pickers.
+    weight_update_period_ =
+        std::max(weight_update_period_, Duration::Milliseconds(100));
+    if (error_utilization_penalty_ < 0) {
+      ValidationErrors::ScopedField field(errors, ".errorUtilizationPenalty");
+      errors->AddError("must be non-negative");
+    }
+  }
+
+ private:
+  bool enable_oob_load_report_ = false;
+  Duration oob_reporting_period_ = Duration::Seconds(10);
+  Duration blackout_period_ = Duration::Seconds(10);
+  Duration weight_update_period_ = Duration::Seconds(1);
+  Duration weight_expiration_period_ = Duration::Minutes(3);
+  float error_utilization_penalty_ = 1.0;
+};
+
+//
+// StaticStrideScheduler
+//
+
+// Picks indexes in proportion to a fixed set of weights.
+//
+// Each index is visited in round robin order and is accepted or skipped
+// depending on its weight, so that over kMaxWeight generations an index
+// with weight w is accepted w times.  Weights are scaled so that the
+// largest is kMaxWeight and clamped so that none is below kMinRatio of
+// that, which bounds the expected number of skips per pick.  Pick() only
+// touches an atomic counter, so it is safe to call concurrently.
+class StaticStrideScheduler {
+ public:
+  // Returns null if fewer than two weights are known or all scaled
+  // weights are identical, in which case plain round robin should be used.
+  // Weights <= 0 are unknown and are given the mean of the known weights.
+  static std::unique_ptr<StaticStrideScheduler> Make(
+      absl::Span<const float> weights, uint32_t initial_sequence);
+
+  explicit StaticStrideScheduler(std::vector<uint16_t> scaled_weights,
+                                 uint32_t initial_sequence)
+      : scaled_weights_(std::move(scaled_weights)),
+        sequence_(initial_sequence) {}
+
+  size_t Pick() const;
+
+ private:
+  static constexpr uint16_t kMaxWeight = 65535;
+  static constexpr double kMinRatio = 0.1;
+
+  const std::vector<uint16_t> scaled_weights_;
+  mutable std::atomic<uint32_t> sequence_;
+};
+
+std::unique_ptr<StaticStrideScheduler> StaticStrideScheduler::Make(
+    absl::Span<const float> weights, uint32_t initial_sequence) {
+  if (weights.size() < 2) return nullptr;
+  size_t num_known = 0;
+  double sum = 0;
+  float max = 0;
+  for (float weight : weights) {
+    if (weight <= 0) continue;
+    ++num_known;
+    sum += weight;
+    max = std::max(max, weight);
+  }
+  if (num_known < 2) return nullptr;
+  const double scaling_factor = kMaxWeight / max;
+  const uint16_t lower_bound =
+      static_cast<uint16_t>(std::lround(kMaxWeight * kMinRatio));
+  const uint16_t mean = std::max(
+      static_cast<uint16_t>(std::lround(scaling_factor * sum / num_known)),
+      lower_bound);
+  std::vector<uint16_t> scaled_weights;
+  scaled_weights.reserve(weights.size());
+  bool all_equal = true;
+  for (float weight : weights) {
+    uint16_t scaled = mean;
+    if (weight > 0) {
+      scaled = std::max(
+          static_cast<uint16_t>(std::lround(scaling_factor * weight)),
+          lower_bound);
+    }
+    if (!scaled_weights.empty() && scaled != scaled_weights.front()) {
+      all_equal = false;
+    }
+    scaled_weights.push_back(scaled);
+  }
+  if (all_equal) return nullptr;
+  return std::make_unique<StaticStrideScheduler>(std::move(scaled_weights),
+                                                 initial_sequence);
+}
+
+size_t StaticStrideScheduler::Pick() const {
+  const uint64_t num_weights = scaled_weights_.size();
+  while (true) {
+    const uint64_t sequence =
+        sequence_.fetch_add(1, std::memory_order_relaxed);
+    const uint64_t index = sequence % num_weights;
+    const uint64_t generation = sequence / num_weights;
+    const uint64_t weight = scaled_weights_[index];
+    // Spread out the generations in which each index is accepted, so that
+    // indexes with equal weights are not all skipped at the same time.
+    const uint64_t offset = kMaxWeight / 2 * index;
+    if ((weight * generation + offset) % kMaxWeight < kMaxWeight - weight) {
+      continue;
+    }
+    return static_cast<size_t>(index);
+  }
+}
+
+//
+// weighted_round_robin LB policy
+//
+
+class WeightedRoundRobin : public LoadBalancingPolicy {
+ public:
+  explicit WeightedRoundRobin(Args args);
+
+  absl::string_view name() const override { return kWeightedRoundRobin; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // Load data for an endpoint, shared by every subchannel list and picker
+  // that contains the endpoint's address, so that a new address list does
+  // not lose the weights learned from the previous one.
+  // Reports are written from the data plane and from OOB watchers, while
+  // weights are read on the work serializer, so access is guarded by mu_.
+  class EndpointWeight : public RefCounted<EndpointWeight> {
+   public:
+    EndpointWeight(RefCountedPtr<WeightedRoundRobin> wrr, std::string key)
+        : wrr_(std::move(wrr)), key_(std::move(key)) {}
+    ~EndpointWeight() override;
+
+    // Records the metrics from a backend load report.
+    void MaybeUpdateWeight(double qps, double cpu_utilization);
+
+    // Records the status of a call sent to the endpoint.
+    void RecordCallStatus(bool ok) {
+      calls_.fetch_add(1, std::memory_order_relaxed);
+      if (!ok) errors_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the current weight, or 0 if it is not known, expired, or
+    // still in the blackout period.  Starts a new window for the error
+    // rate, so this should be called once per weight update period.
+    float ComputeWeight(Timestamp now, const WeightedRoundRobinConfig& config);
+
+    // Restarts the blackout period; called when the endpoint reconnects.
+    void ResetNonEmptySince() {
+      MutexLock lock(&mu_);
+      non_empty_since_ = Timestamp::InfFuture();
+    }
+
+   private:
+    RefCountedPtr<WeightedRoundRobin> wrr_;
+    const std::string key_;
+
+    std::atomic<uint64_t> calls_{0};
+    std::atomic<uint64_t> errors_{0};
+
+    Mutex mu_;
+    double qps_ ABSL_GUARDED_BY(&mu_) = 0;
+    double cpu_utilization_ ABSL_GUARDED_BY(&mu_) = 0;
+    double error_fraction_ ABSL_GUARDED_BY(&mu_) = 0;
+    Timestamp non_empty_since_ ABSL_GUARDED_BY(&mu_) = Timestamp::InfFuture();
+    Timestamp last_update_time_ ABSL_GUARDED_BY(&mu_) =
+        Timestamp::InfPast();
+  };
+
+  // Forward declaration.
+  class WrrSubchannelList;
+
+  // Data for a particular subchannel in a subchannel list.
+  // This subclass adds the following functionality:
+  // - Tracks the previous connectivity state of the subchannel, so that
+  //   we know how many subchannels are in each state.
+  // - Holds the endpoint's weight and registers the OOB load report
+  //   watcher when enabled.
+  class WrrSubchannelData
+      : public SubchannelData<WrrSubchannelList, WrrSubchannelData> {
+   public:
+    WrrSubchannelData(
+        SubchannelList<WrrSubchannelList, WrrSubchannelData>* subchannel_list,
+        const ServerAddress& address,
+        RefCountedPtr<SubchannelInterface> subchannel);
+
+    absl::optional<grpc_connectivity_state> connectivity_state() const {
+      return logical_connectivity_state_;
+    }
+
+    RefCountedPtr<EndpointWeight> endpoint_weight() const { return weight_; }
+
+    // The weight the most recent picker was built with.
+    float cached_weight() const { return cached_weight_; }
+
+    // Recomputes cached_weight().  Returns true if it changed.
+    bool UpdateCachedWeightLocked(Timestamp now,
+                                  const WeightedRoundRobinConfig& config);
+
+   private:
+    class OobWatcher : public OobBackendMetricWatcher {
+     public:
+      explicit OobWatcher(RefCountedPtr<EndpointWeight> weight)
+          : weight_(std::move(weight)) {}
+
+      void OnBackendMetricReport(
+          const BackendMetricData& backend_metric_data) override {
+        weight_->MaybeUpdateWeight(backend_metric_data.qps,
+                                   backend_metric_data.cpu_utilization);
+      }
+
+     private:
+      RefCountedPtr<EndpointWeight> weight_;
+    };
+
+    // Performs connectivity state updates that need to be done only
+    // after we have started watching.
+    void ProcessConnectivityChangeLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state) override;
+
+    // Updates the logical connectivity state.
+    void UpdateLogicalConnectivityStateLocked(
+        grpc_connectivity_state connectivity_state);
+
+    // The logical connectivity state of the subchannel.
+    // Note that the logical connectivity state may differ from the
+    // actual reported state in some cases (e.g., after we see
+    // TRANSIENT_FAILURE, we ignore any subsequent state changes until
+    // we see READY).
+    absl::optional<grpc_connectivity_state> logical_connectivity_state_;
+
+    RefCountedPtr<EndpointWeight> weight_;
+    float cached_weight_ = 0;
+  };
+
+  // A list of subchannels.
+  class WrrSubchannelList
+      : public SubchannelList<WrrSubchannelList, WrrSubchannelData> {
+   public:
+    WrrSubchannelList(WeightedRoundRobin* policy, ServerAddressList addresses,
+                      const ChannelArgs& args)
+        : SubchannelList(policy,
+                         (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)
+                              ? "WrrSubchannelList"
+                              : nullptr),
+                         std::move(addresses), policy->channel_control_helper(),
+                         args) {
+      // Need to maintain a ref to the LB policy as long as we maintain
+      // any references to subchannels, since the subchannels'
+      // pollset_sets will include the LB policy's pollset_set.
+      policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+    }
+
+    ~WrrSubchannelList() override {
+      WeightedRoundRobin* p = static_cast<WeightedRoundRobin*>(policy());
+      p->Unref(DEBUG_LOCATION, "subchannel_list");
+    }
+
+    // Updates the counters of subchannels in each state when a
+    // subchannel transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right subchannel list is used and then updates
+    // the WRR policy's connectivity state based on the subchannel list's
+    // state counters.
+    void MaybeUpdateConnectivityStateLocked(absl::Status status_for_tf);
+
+    // Recomputes the weights of all subchannels and, if any of them
+    // changed while the list is READY, reports a new picker.
+    void UpdateWeightsLocked();
+
+   private:
+    std::string CountersString() const {
+      return absl::StrCat("num_subchannels=", num_subchannels(),
+                          " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  // Pickers are immutable apart from their atomic counters: when the
+  // weights change, the policy builds a new picker and reports it, so
+  // picks never wait on a weight update.
+  class Picker : public SubchannelPicker {
+   public:
+    Picker(WeightedRoundRobin* parent, WrrSubchannelList* subchannel_list);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    class SubchannelCallTracker;
+
+    struct Endpoint {
+      RefCountedPtr<SubchannelInterface> subchannel;
+      RefCountedPtr<EndpointWeight> weight;
+    };
+
+    // Using pointer value only, no ref held -- do not dereference!
+    WeightedRoundRobin* parent_;
+
+    const bool use_per_call_metrics_;
+    std::vector<Endpoint> endpoints_;
+    // Null if fewer than two weights are known, in which case picks
+    // fall back to plain round robin.
+    std::unique_ptr<StaticStrideScheduler> scheduler_;
+    std::atomic<size_t> last_picked_index_;
+  };
+
+  // Periodically recomputes the endpoint weights.
+  class WeightUpdateTimer : public InternallyRefCounted<WeightUpdateTimer> {
+   public:
+    explicit WeightUpdateTimer(RefCountedPtr<WeightedRoundRobin> parent);
+
+    void Orphan() override;
+
+   private:
+    static void OnTimer(void* arg, grpc_error_handle error);
+    void OnTimerLocked(grpc_error_handle error);
+
+    RefCountedPtr<WeightedRoundRobin> parent_;
+    grpc_timer timer_;
+    grpc_closure on_timer_;
+    bool timer_pending_ = true;
+  };
+
+  ~WeightedRoundRobin() override;
+
+  static std::string MakeKeyForAddress(const ServerAddress& address);
+
+  void ShutdownLocked() override;
+
+  // Returns the weight for the address, creating it if needed.
+  RefCountedPtr<EndpointWeight> GetOrCreateWeight(const ServerAddress& address);
+
+  // Current config from the resolver.
+  RefCountedPtr<WeightedRoundRobinConfig> config_;
+
+  // List of subchannels.
+  RefCountedPtr<WrrSubchannelList> subchannel_list_;
+  // Latest pending subchannel list.
+  // When we get an updated address list, we create a new subchannel list
+  // for it here, and we wait to swap it into subchannel_list_ until the new
+  // list becomes READY.
+  RefCountedPtr<WrrSubchannelList> latest_pending_subchannel_list_;
+
+  // Weights by address.  Entries are removed by the EndpointWeight
+  // destructor, which may run on any thread, hence the mutex.
+  Mutex endpoint_weight_map_mu_;
+  std::map<std::string, EndpointWeight*> endpoint_weight_map_
+      ABSL_GUARDED_BY(&endpoint_weight_map_mu_);
+
+  OrphanablePtr<WeightUpdateTimer> weight_update_timer_;
+
+  absl::BitGen bit_gen_;
+
+  bool shutdown_ = false;
+};
+
+//
+// WeightedRoundRobin::EndpointWeight
+//
+
+WeightedRoundRobin::EndpointWeight::~EndpointWeight() {
+  MutexLock lock(&wrr_->endpoint_weight_map_mu_);
+  auto it = wrr_->endpoint_weight_map_.find(key_);
+  if (it != wrr_->endpoint_weight_map_.end() && it->second == this) {
+    wrr_->endpoint_weight_map_.erase(it);
+  }
+}
+
+void WeightedRoundRobin::EndpointWeight::MaybeUpdateWeight(
+    double qps, double cpu_utilization) {
+  // A report without both values carries no load information.
+  if (qps <= 0 || cpu_utilization <= 0) return;
+  const Timestamp now = Timestamp::Now();
+  MutexLock lock(&mu_);
+  if (non_empty_since_ == Timestamp::InfFuture()) non_empty_since_ = now;
+  qps_ = qps;
+  cpu_utilization_ = cpu_utilization;
+  last_update_time_ = now;
+}
+
+float WeightedRoundRobin::EndpointWeight::ComputeWeight(
+    Timestamp now, const WeightedRoundRobinConfig& config) {
+  const uint64_t calls = calls_.exchange(0, std::memory_order_relaxed);
+  const uint64_t errors = errors_.exchange(0, std::memory_order_relaxed);
+  MutexLock lock(&mu_);
+  // Keep the previous error rate across windows with no calls.
+  if (calls > 0) error_fraction_ = static_cast<double>(errors) / calls;
+  if (qps_ <= 0) return 0;
+  // Forget weights whose reports have stopped arriving.
+  if (now - last_update_time_ >= config.weight_expiration_period()) {
+    non_empty_since_ = Timestamp::InfFuture();
+    qps_ = 0;
+    return 0;
+  }
+  // Ignore the first reports after a (re)connection, which tend to
+  // reflect an idle backend rather than its steady state.
+  if (non_empty_since_ == Timestamp::InfFuture() ||
+      now - non_empty_since_ < config.blackout_period()) {
+    return 0;
+  }
+  return static_cast<float>(
+      qps_ / (cpu_utilization_ +
+              error_fraction_ * config.error_utilization_penalty()));
+}
+
+//
+// WeightedRoundRobin::Picker::SubchannelCallTracker
+//
+
+class WeightedRoundRobin::Picker::SubchannelCallTracker
+    : public LoadBalancingPolicy::SubchannelCallTrackerInterface {
+ public:
+  SubchannelCallTracker(RefCountedPtr<EndpointWeight> weight,
+                        bool use_per_call_metrics)
+      : weight_(std::move(weight)),
+        use_per_call_metrics_(use_per_call_metrics) {}
+
+  void Start() override {}
+
+  void Finish(FinishArgs args) override {
+    weight_->RecordCallStatus(args.status.ok());
+    if (!use_per_call_metrics_ || args.backend_metric_accessor == nullptr) {
+      return;
+    }
+    const BackendMetricData* backend_metric_data =
+        args.backend_metric_accessor->GetBackendMetricData();
+    if (backend_metric_data == nullptr) return;
+    weight_->MaybeUpdateWeight(backend_metric_data->qps,
+                               backend_metric_data->cpu_utilization);
+  }
+
+ private:
+  RefCountedPtr<EndpointWeight> weight_;
+  const bool use_per_call_metrics_;
+};
+
+//
+// WeightedRoundRobin::Picker
+//
+
+WeightedRoundRobin::Picker::Picker(WeightedRoundRobin* parent,
+                                   WrrSubchannelList* subchannel_list)
+    : parent_(parent),
+      use_per_call_metrics_(!parent->config_->enable_oob_load_report()) {
+  std::vector<float> weights;
+  for (size_t i = 0; i < subchannel_list->num_subchannels(); ++i) {
+    WrrSubchannelData* sd = subchannel_list->subchannel(i);
+    if (sd->connectivity_state().value_or(GRPC_CHANNEL_IDLE) ==
+        GRPC_CHANNEL_READY) {
+      endpoints_.push_back({sd->subchannel()->Ref(), sd->endpoint_weight()});
+      weights.push_back(sd->cached_weight());
+    }
+  }
+  // For discussion on why we generate a random starting index for
+  // the picker, see https://github.com/grpc/grpc-go/issues/2580.
+  const uint32_t initial_sequence = absl::Uniform<uint32_t>(parent->bit_gen_);
+  scheduler_ = StaticStrideScheduler::Make(weights, initial_sequence);
+  last_picked_index_.store(initial_sequence % endpoints_.size(),
+                           std::memory_order_relaxed);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO,
+            "[WRR %p picker %p] created picker from subchannel_list=%p "
+            "with %" PRIuPTR " READY subchannels; scheduler=%s",
+            parent_, this, subchannel_list, endpoints_.size(),
+            scheduler_ == nullptr ? "round_robin" : "weighted");
+  }
+}
+
+WeightedRoundRobin::PickResult WeightedRoundRobin::Picker::Pick(
+    PickArgs /*args*/) {
+  size_t index;
+  if (scheduler_ != nullptr) {
+    index = scheduler_->Pick();
+  } else {
+    index = (last_picked_index_.fetch_add(1, std::memory_order_relaxed) + 1) %
+            endpoints_.size();
+  }
+  const Endpoint& endpoint = endpoints_[index];
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO,
+            "[WRR %p picker %p] returning index %" PRIuPTR ", subchannel=%p",
+            parent_, this, index, endpoint.subchannel.get());
+  }
+  return PickResult::Complete(endpoint.subchannel,
+                              std::make_unique<SubchannelCallTracker>(
+                                  endpoint.weight, use_per_call_metrics_));
+}
+
+//
+// WeightedRoundRobin::WeightUpdateTimer
+//
+
+WeightedRoundRobin::WeightUpdateTimer::WeightUpdateTimer(
+    RefCountedPtr<WeightedRoundRobin> parent)
+    : parent_(std::move(parent)) {
+  const Duration period = parent_->config_->weight_update_period();
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO, "[WRR %p] weight update timer will run in %s",
+            parent_.get(), period.ToString().c_str());
+  }
+  GRPC_CLOSURE_INIT(&on_timer_, OnTimer, this, nullptr);
+  Ref().release();
+  grpc_timer_init(&timer_, Timestamp::Now() + period, &on_timer_);
+}
+
+void WeightedRoundRobin::WeightUpdateTimer::Orphan() {
+  if (timer_pending_) {
+    timer_pending_ = false;
+    grpc_timer_cancel(&timer_);
+  }
+  Unref();
+}
+
+void WeightedRoundRobin::WeightUpdateTimer::OnTimer(void* arg,
+                                                    grpc_error_handle error) {
+  auto* self = static_cast<WeightUpdateTimer*>(arg);
+  self->parent_->work_serializer()->Run(
+      [self, error]() { self->OnTimerLocked(error); }, DEBUG_LOCATION);
+}
+
+void WeightedRoundRobin::WeightUpdateTimer::OnTimerLocked(
+    grpc_error_handle error) {
+  if (error.ok() && timer_pending_) {
+    if (parent_->subchannel_list_ != nullptr) {
+      parent_->subchannel_list_->UpdateWeightsLocked();
+    }
+    timer_pending_ = false;
+    parent_->weight_update_timer_ = MakeOrphanable<WeightUpdateTimer>(parent_);
+  }
+  Unref(DEBUG_LOCATION, "Timer");
+}
+
+//
+// WeightedRoundRobin
+//
+
+WeightedRoundRobin::WeightedRoundRobin(Args args)
+    : LoadBalancingPolicy(std::move(args)) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO, "[WRR %p] Created", this);
+  }
+}
+
+WeightedRoundRobin::~WeightedRoundRobin() {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO, "[WRR %p] Destroying WRR policy", this);
+  }
+  GPR_ASSERT(subchannel_list_ == nullptr);
+  GPR_ASSERT(latest_pending_subchannel_list_ == nullptr);
+}
+
+std::string WeightedRoundRobin::MakeKeyForAddress(
+    const ServerAddress& address) {
+  // Use only the address, not the attributes.
+  auto addr_str = grpc_sockaddr_to_string(&address.address(), false);
+  return addr_str.ok() ? addr_str.value() : addr_str.status().ToString();
+}
+
+void WeightedRoundRobin::ShutdownLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO, "[WRR %p] Shutting down", this);
+  }
+  shutdown_ = true;
+  weight_update_timer_.reset();
+  subchannel_list_.reset();
+  latest_pending_subchannel_list_.reset();
+}
+
+void WeightedRoundRobin::ResetBackoffLocked() {
+  subchannel_list_->ResetBackoffLocked();
+  if (latest_pending_subchannel_list_ != nullptr) {
+    latest_pending_subchannel_list_->ResetBackoffLocked();
+  }
+}
+
+RefCountedPtr<WeightedRoundRobin::EndpointWeight>
+WeightedRoundRobin::GetOrCreateWeight(const ServerAddress& address) {
+  std::string key = MakeKeyForAddress(address);
+  MutexLock lock(&endpoint_weight_map_mu_);
+  auto it = endpoint_weight_map_.find(key);
+  if (it != endpoint_weight_map_.end()) {
+    // The entry may be in the middle of being destroyed.
+    auto weight = it->second->RefIfNonZero();
+    if (weight != nullptr) return weight;
+  }
+  auto weight = MakeRefCounted<EndpointWeight>(
+      Ref(DEBUG_LOCATION, "EndpointWeight"), key);
+  endpoint_weight_map_[std::move(key)] = weight.get();
+  return weight;
+}
+
+absl::Status WeightedRoundRobin::UpdateLocked(UpdateArgs args) {
+  auto old_config = std::move(config_);
+  config_ = std::move(args.config);
+  // Start the weight update timer if needed.
+  if (weight_update_timer_ == nullptr ||
+      old_config->weight_update_period() != config_->weight_update_period()) {
+    weight_update_timer_ = MakeOrphanable<WeightUpdateTimer>(
+        Ref(DEBUG_LOCATION, "WeightUpdateTimer"));
+  }
+  ServerAddressList addresses;
+  if (args.addresses.ok()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO, "[WRR %p] received update with %" PRIuPTR " addresses",
+              this, args.addresses->size());
+    }
+    addresses = std::move(*args.addresses);
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO, "[WRR %p] received update with address error: %s",
+              this, args.addresses.status().ToString().c_str());
+    }
+    // If we already have a subchannel list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (subchannel_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new subchannel list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace) &&
+      latest_pending_subchannel_list_ != nullptr) {
+    gpr_log(GPR_INFO, "[WRR %p] replacing previous pending subchannel list %p",
+            this, latest_pending_subchannel_list_.get());
+  }
+  latest_pending_subchannel_list_ = MakeRefCounted<WrrSubchannelList>(
+      this, std::move(addresses), args.args);
+  latest_pending_subchannel_list_->StartWatchingLocked();
+  // If the new list is empty, immediately promote it to
+  // subchannel_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_subchannel_list_->num_subchannels() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace) &&
+        subchannel_list_ != nullptr) {
+      gpr_log(GPR_INFO, "[WRR %p] replacing previous subchannel list %p", this,
+              subchannel_list_.get());
+    }
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    absl::Status status =
+        args.addresses.ok() ? absl::UnavailableError(absl::StrCat(
+                                  "empty address list: ", args.resolution_note))
+                            : args.addresses.status();
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+        std::make_unique<TransientFailurePicker>(status));
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // subchannel_list_ and report CONNECTING.
+  if (subchannel_list_.get() == nullptr) {
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        std::make_unique<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker")));
+  }
+  return absl::OkStatus();
+}
+
+//
+// WrrSubchannelList
+//
+
+void WeightedRoundRobin::WrrSubchannelList::UpdateStateCountersLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  if (old_state.has_value()) {
+    GPR_ASSERT(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      GPR_ASSERT(num_ready_ > 0);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING) {
+      GPR_ASSERT(num_connecting_ > 0);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      GPR_ASSERT(num_transient_failure_ > 0);
+      --num_transient_failure_;
+    }
+  }
+  GPR_ASSERT(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void WeightedRoundRobin::WrrSubchannelList::MaybeUpdateConnectivityStateLocked(
+    absl::Status status_for_tf) {
+  WeightedRoundRobin* p = static_cast<WeightedRoundRobin*>(policy());
+  // If this is latest_pending_subchannel_list_, then swap it into
+  // subchannel_list_ in the following cases:
+  // - subchannel_list_ has no READY subchannels.
+  // - This list has at least one READY subchannel.
+  // - All of the subchannels in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (p->latest_pending_subchannel_list_.get() == this &&
+      (p->subchannel_list_->num_ready_ == 0 || num_ready_ > 0 ||
+       num_transient_failure_ == num_subchannels())) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      const std::string old_counters_string =
+          p->subchannel_list_ != nullptr ? p->subchannel_list_->CountersString()
+                                         : "";
+      gpr_log(
+          GPR_INFO,
+          "[WRR %p] swapping out subchannel list %p (%s) in favor of %p (%s)",
+          p, p->subchannel_list_.get(), old_counters_string.c_str(), this,
+          CountersString().c_str());
+    }
+    p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
+  }
+  // Only set connectivity state if this is the current subchannel list.
+  if (p->subchannel_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY subchannel is READY => policy is READY.
+  // 2) ANY subchannel is CONNECTING => policy is CONNECTING.
+  // 3) ALL subchannels are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO, "[WRR %p] reporting READY with subchannel list %p", p,
+              this);
+    }
+    p->channel_control_helper()->UpdateState(GRPC_CHANNEL_READY, absl::Status(),
+                                             std::make_unique<Picker>(p, this));
+  } else if (num_connecting_ > 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO, "[WRR %p] reporting CONNECTING with subchannel list %p",
+              p, this);
+    }
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        std::make_unique<QueuePicker>(p->Ref(DEBUG_LOCATION, "QueuePicker")));
+  } else if (num_transient_failure_ == num_subchannels()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO,
+              "[WRR %p] reporting TRANSIENT_FAILURE with subchannel list %p: "
+              "%s",
+              p, this, status_for_tf.ToString().c_str());
+    }
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.ToString()));
+    }
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, last_failure_,
+        std::make_unique<TransientFailurePicker>(last_failure_));
+  }
+}
+
+void WeightedRoundRobin::WrrSubchannelList::UpdateWeightsLocked() {
+  WeightedRoundRobin* p = static_cast<WeightedRoundRobin*>(policy());
+  const Timestamp now = Timestamp::Now();
+  bool changed = false;
+  for (size_t i = 0; i < num_subchannels(); ++i) {
+    if (subchannel(i)->UpdateCachedWeightLocked(now, *p->config_)) {
+      changed = true;
+    }
+  }
+  if (!changed || num_ready_ == 0) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(GPR_INFO,
+            "[WRR %p] weights changed, reporting new picker for subchannel "
+            "list %p",
+            p, this);
+  }
+  p->channel_control_helper()->UpdateState(GRPC_CHANNEL_READY, absl::Status(),
+                                           std::make_unique<Picker>(p, this));
+}
+
+//
+// WrrSubchannelData
+//
+
+WeightedRoundRobin::WrrSubchannelData::WrrSubchannelData(
+    SubchannelList<WrrSubchannelList, WrrSubchannelData>* subchannel_list,
+    const ServerAddress& address, RefCountedPtr<SubchannelInterface> subchannel)
+    : SubchannelData(subchannel_list, address, std::move(subchannel)) {
+  WeightedRoundRobin* p =
+      static_cast<WeightedRoundRobin*>(subchannel_list->policy());
+  weight_ = p->GetOrCreateWeight(address);
+  // Start from any weight already learned for this address, so that a
+  // new address list does not fall back to plain round robin.
+  UpdateCachedWeightLocked(Timestamp::Now(), *p->config_);
+  if (p->config_->enable_oob_load_report()) {
+    this->subchannel()->AddDataWatcher(MakeOobBackendMetricWatcher(
+        p->config_->oob_reporting_period(),
+        std::make_unique<OobWatcher>(weight_)));
+  }
+}
+
+bool WeightedRoundRobin::WrrSubchannelData::UpdateCachedWeightLocked(
+    Timestamp now, const WeightedRoundRobinConfig& config) {
+  const float weight = weight_->ComputeWeight(now, config);
+  if (weight == cached_weight_) return false;
+  cached_weight_ = weight;
+  return true;
+}
+
+void WeightedRoundRobin::WrrSubchannelData::ProcessConnectivityChangeLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  WeightedRoundRobin* p =
+      static_cast<WeightedRoundRobin*>(subchannel_list()->policy());
+  GPR_ASSERT(subchannel() != nullptr);
+  // If this is not the initial state notification and the new state is
+  // TRANSIENT_FAILURE or IDLE, re-resolve.
+  // Note that we don't want to do this on the initial state notification,
+  // because that would result in an endless loop of re-resolution.
+  if (old_state.has_value() && (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+                                new_state == GRPC_CHANNEL_IDLE)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO,
+              "[WRR %p] Subchannel %p reported %s; requesting re-resolution",
+              p, subchannel(), ConnectivityStateName(new_state));
+    }
+    p->channel_control_helper()->RequestReresolution();
+  }
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO,
+              "[WRR %p] Subchannel %p reported IDLE; requesting connection", p,
+              subchannel());
+    }
+    subchannel()->RequestConnection();
+  }
+  // A new connection starts a new blackout period, since the backend's
+  // load reports no longer describe the traffic we will send it.
+  if (new_state == GRPC_CHANNEL_READY &&
+      (!old_state.has_value() || *old_state != GRPC_CHANNEL_READY)) {
+    weight_->ResetNonEmptySince();
+  }
+  // Update logical connectivity state.
+  UpdateLogicalConnectivityStateLocked(new_state);
+  // Update the policy state.
+  subchannel_list()->MaybeUpdateConnectivityStateLocked(connectivity_status());
+}
+
+void WeightedRoundRobin::WrrSubchannelData::
+    UpdateLogicalConnectivityStateLocked(
+        grpc_connectivity_state connectivity_state) {
+  WeightedRoundRobin* p =
+      static_cast<WeightedRoundRobin*>(subchannel_list()->policy());
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+    gpr_log(
+        GPR_INFO,
+        "[WRR %p] connectivity changed for subchannel %p, subchannel_list %p "
+        "(index %" PRIuPTR " of %" PRIuPTR "): prev_state=%s new_state=%s",
+        p, subchannel(), subchannel_list(), Index(),
+        subchannel_list()->num_subchannels(),
+        (logical_connectivity_state_.has_value()
+             ? ConnectivityStateName(*logical_connectivity_state_)
+             : "N/A"),
+        ConnectivityStateName(connectivity_state));
+  }
+  // Decide what state to report for aggregation purposes.
+  // If the last logical state was TRANSIENT_FAILURE, then ignore the
+  // state change unless the new state is READY.
+  if (logical_connectivity_state_.has_value() &&
+      *logical_connectivity_state_ == GRPC_CHANNEL_TRANSIENT_FAILURE &&
+      connectivity_state != GRPC_CHANNEL_READY) {
+    return;
+  }
+  // If the new state is IDLE, treat it as CONNECTING, since it will
+  // immediately transition into CONNECTING anyway.
+  if (connectivity_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO,
+              "[WRR %p] subchannel %p, subchannel_list %p (index %" PRIuPTR
+              " of %" PRIuPTR "): treating IDLE as CONNECTING",
+              p, subchannel(), subchannel_list(), Index(),
+              subchannel_list()->num_subchannels());
+    }
+    connectivity_state = GRPC_CHANNEL_CONNECTING;
+  }
+  // If no change, return false.
+  if (logical_connectivity_state_.has_value() &&
+      *logical_connectivity_state_ == connectivity_state) {
+    return;
+  }
+  // Otherwise, update counters and logical state.
+  subchannel_list()->UpdateStateCountersLocked(logical_connectivity_state_,
+                                               connectivity_state);
+  logical_connectivity_state_ = connectivity_state;
+}
+
+//
+// factory
+//
+
+class WeightedRoundRobinFactory : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<WeightedRoundRobin>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kWeightedRoundRobin; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadRefCountedFromJson<WeightedRoundRobinConfig>(
+        json, JsonArgs(),
+        "errors validating weighted_round_robin LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterWeightedRoundRobinLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<WeightedRoundRobinFactory>());
+}
+
+}  // namespace grpc_core
@@ -84,6 +84,8 @@ class WeightedTargetLbConfig : public LoadBalancingPolicy::Config {
   struct ChildConfig {
     uint32_t weight;
     RefCountedPtr<LoadBalancingPolicy::Config> config;
+    // The JSON that config was parsed from, for comparing configs.
+    Json config_json;
 
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json& json, const JsonArgs&,
@@ -125,31 +127,43 @@ class WeightedTargetLb : public LoadBalancingPolicy {
   class ChildPickerWrapper : public RefCounted<ChildPickerWrapper> {
    public:
     explicit ChildPickerWrapper(std::unique_ptr<SubchannelPicker> picker)
-        : picker_(std::move(picker)) {}
-    PickResult Pick(PickArgs args) { return picker_->Pick(args); }
+        : picker_(std::move(picker)), target_(picker_->Innermost()) {}
+    PickResult Pick(PickArgs args) { return target_->Pick(args); }
 
    private:
     std::unique_ptr<SubchannelPicker> picker_;
+    // Skips any pass-through layers in the child policy's picker.
+    SubchannelPicker* target_;
   };
 
   // Picks a child using stateless WRR and then delegates to that
   // child's picker.
   class WeightedPicker : public SubchannelPicker {
    public:
-    // Maintains a weighted list of pickers from each child that is in
-    // ready state. The first element in the pair represents the end of a
-    // range proportional to the child's weight. The start of the range
-    // is the previous value in the vector and is 0 for the first element.
+    // The pickers of the children in the picker's state, each with the
+    // child's weight.
     using PickerList =
-        std::vector<std::pair<uint64_t, RefCountedPtr<ChildPickerWrapper>>>;
+        std::vector<std::pair<uint32_t, RefCountedPtr<ChildPickerWrapper>>>;
 
-    explicit WeightedPicker(PickerList pickers)
-        : pickers_(std::move(pickers)) {}
+    explicit WeightedPicker(PickerList pickers);
 
     PickResult Pick(PickArgs args) override;
 
    private:
+    // One bucket of the alias table: a pick that lands in the bucket goes
+    // to the bucket's own picker if the second random number is below
+    // threshold, and to the picker at index alias otherwise.
+    struct Bucket {
+      uint64_t threshold;
+      size_t alias;
+    };
+
     PickerList pickers_;
+    // Alias table over pickers_, built by Vose's method: every bucket holds
+    // total_weight_ worth of picks, so a pick takes constant time however
+    // many children there are.
+    std::vector<Bucket> buckets_;
+    uint64_t total_weight_ = 0;
     absl::BitGen bit_gen_;
   };
 
@@ -235,6 +249,14 @@ class WeightedTargetLb : public LoadBalancingPolicy {
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_CONNECTING;
 
     OrphanablePtr<DelayedRemovalTimer> delayed_removal_timer_;
+
+    // The last update passed to the child policy and its result, used to
+    // skip updates that would not change anything for the child.
+    Json last_config_json_;
+    absl::optional<ServerAddressList> last_addresses_;
+    std::string last_resolution_note_;
+    ChannelArgs last_args_;
+    absl::Status last_update_status_;
   };
 
   ~WeightedTargetLb() override;
@@ -258,29 +280,45 @@ class WeightedTargetLb : public LoadBalancingPolicy {
 // WeightedTargetLb::WeightedPicker
 //
 
-WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
-    PickArgs args) {
-  // Generate a random number in [0, total weight).
-  const uint64_t key =
-      absl::Uniform<uint64_t>(bit_gen_, 0, pickers_.back().first);
-  // Find the index in pickers_ corresponding to key.
-  size_t mid = 0;
-  size_t start_index = 0;
-  size_t end_index = pickers_.size() - 1;
-  size_t index = 0;
-  while (end_index > start_index) {
-    mid = (start_index + end_index) / 2;
-    if (pickers_[mid].first > key) {
-      end_index = mid;
-    } else if (pickers_[mid].first < key) {
-      start_index = mid + 1;
-    } else {
-      index = mid + 1;
-      break;
+WeightedTargetLb::WeightedPicker::WeightedPicker(PickerList pickers)
+    : pickers_(std::move(pickers)), buckets_(pickers_.size()) {
+  const size_t n = pickers_.size();
+  for (const auto& p : pickers_) total_weight_ += p.first;
+  // Scale each weight by the number of buckets, so that the weights sum
+  // up to n buckets of total_weight_ each.  Integer arithmetic keeps the
+  // table exact.
+  std::vector<uint64_t> scaled(n);
+  std::vector<size_t> small;
+  std::vector<size_t> large;
+  for (size_t i = 0; i < n; ++i) {
+    scaled[i] = static_cast<uint64_t>(pickers_[i].first) * n;
+    (scaled[i] < total_weight_ ? small : large).push_back(i);
+  }
+  // Fill each under-full bucket with weight from an over-full one.
+  while (!small.empty() && !large.empty()) {
+    const size_t s = small.back();
+    small.pop_back();
+    const size_t l = large.back();
+    buckets_[s] = {scaled[s], l};
+    scaled[l] -= total_weight_ - scaled[s];
+    if (scaled[l] < total_weight_) {
+      large.pop_back();
+      small.push_back(l);
     }
   }
-  if (index == 0) index = start_index;
-  GPR_ASSERT(pickers_[index].first > key);
+  // What is left is exactly full.
+  for (size_t i : small) buckets_[i] = {total_weight_, i};
+  for (size_t i : large) buckets_[i] = {total_weight_, i};
+}
+
+WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
+    PickArgs args) {
+  const Bucket& bucket =
+      buckets_[absl::Uniform<size_t>(bit_gen_, 0, buckets_.size())];
+  const size_t index =
+      absl::Uniform<uint64_t>(bit_gen_, 0, total_weight_) < bucket.threshold
+          ? &bucket - buckets_.data()
+          : bucket.alias;
   // Delegate to the child picker.
   return pickers_[index].second->Pick(args);
 }
@@ -391,13 +429,9 @@ void WeightedTargetLb::UpdateStateLocked() {
   }
   // Construct lists of child pickers with associated weights, one for
   // children that are in state READY and another for children that are
-  // in state TRANSIENT_FAILURE.  Each child is represented by a portion of
-  // the range proportional to its weight, such that the total range is the
-  // sum of the weights of all children.
+  // in state TRANSIENT_FAILURE.
   WeightedPicker::PickerList ready_picker_list;
-  uint64_t ready_end = 0;
   WeightedPicker::PickerList tf_picker_list;
-  uint64_t tf_end = 0;
   // Also count the number of children in CONNECTING and IDLE, to determine
   // the aggregated state.
   size_t num_connecting = 0;
@@ -419,8 +453,8 @@ void WeightedTargetLb::UpdateStateLocked() {
     switch (child->connectivity_state()) {
       case GRPC_CHANNEL_READY: {
         GPR_ASSERT(child->weight() > 0);
-        ready_end += child->weight();
-        ready_picker_list.emplace_back(ready_end, child->picker_wrapper());
+        ready_picker_list.emplace_back(child->weight(),
+                                       child->picker_wrapper());
         break;
       }
       case GRPC_CHANNEL_CONNECTING: {
@@ -433,8 +467,7 @@ void WeightedTargetLb::UpdateStateLocked() {
       }
       case GRPC_CHANNEL_TRANSIENT_FAILURE: {
         GPR_ASSERT(child->weight() > 0);
-        tf_end += child->weight();
-        tf_picker_list.emplace_back(tf_end, child->picker_wrapper());
+        tf_picker_list.emplace_back(child->weight(), child->picker_wrapper());
         break;
       }
       default:
@@ -606,6 +639,29 @@ absl::Status WeightedTargetLb::WeightedChild::UpdateLocked(
     }
     delayed_removal_timer_.reset();
   }
+  // If nothing that the child policy sees has changed, skip the update, so
+  // that an update to other targets does not make this child rebuild its
+  // subchannels and picker.
+  if (child_policy_ != nullptr && addresses.ok() &&
+      last_addresses_.has_value() && *addresses == *last_addresses_ &&
+      config.config_json == last_config_json_ &&
+      resolution_note == last_resolution_note_ && args == last_args_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_weighted_target_trace)) {
+      gpr_log(GPR_INFO,
+              "[weighted_target_lb %p] WeightedChild %p %s: child policy "
+              "update unchanged, skipping",
+              weighted_target_policy_.get(), this, name_.c_str());
+    }
+    return last_update_status_;
+  }
+  last_config_json_ = config.config_json;
+  if (addresses.ok()) {
+    last_addresses_ = *addresses;
+  } else {
+    last_addresses_.reset();
+  }
+  last_resolution_note_ = resolution_note;
+  last_args_ = args;
   // Create child policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(args);
@@ -624,7 +680,8 @@ absl::Status WeightedTargetLb::WeightedChild::UpdateLocked(
             weighted_target_policy_.get(), this, name_.c_str(),
             child_policy_.get());
   }
-  return child_policy_->UpdateLocked(std::move(update_args));
+  last_update_status_ = child_policy_->UpdateLocked(std::move(update_args));
+  return last_update_status_;
 }
 
 void WeightedTargetLb::WeightedChild::ResetBackoffLocked() {
@@ -747,6 +804,7 @@ void WeightedTargetLbConfig::ChildConfig::JsonPostLoad(
     return;
   }
   config = std::move(*lb_config);
+  config_json = it->second;
 }
 
 const JsonLoaderInterface* WeightedTargetLbConfig::JsonLoader(const JsonArgs&) {
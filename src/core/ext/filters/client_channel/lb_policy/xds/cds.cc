@@ -758,8 +758,8 @@ class CdsLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterCdsLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<CdsLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kCds, []() { return std::make_unique<CdsLbFactory>(); });
 }
 
 }  // namespace grpc_core
@@ -214,11 +214,13 @@ class XdsClusterImplLb : public LoadBalancingPolicy {
   class RefCountedPicker : public RefCounted<RefCountedPicker> {
    public:
     explicit RefCountedPicker(std::unique_ptr<SubchannelPicker> picker)
-        : picker_(std::move(picker)) {}
-    PickResult Pick(PickArgs args) { return picker_->Pick(args); }
+        : picker_(std::move(picker)), target_(picker_->Innermost()) {}
+    PickResult Pick(PickArgs args) { return target_->Pick(args); }
 
    private:
     std::unique_ptr<SubchannelPicker> picker_;
+    // Skips any pass-through layers in the child policy's picker.
+    SubchannelPicker* target_;
   };
 
   // A picker that wraps the picker from the child to perform drops.
@@ -799,8 +801,9 @@ class XdsClusterImplLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsClusterImplLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterImplLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsClusterImpl,
+      []() { return std::make_unique<XdsClusterImplLbFactory>(); });
 }
 
 }  // namespace grpc_core
@@ -125,14 +125,18 @@ class XdsClusterManagerLb : public LoadBalancingPolicy {
    public:
     ChildPickerWrapper(std::string name,
                        std::unique_ptr<SubchannelPicker> picker)
-        : name_(std::move(name)), picker_(std::move(picker)) {}
-    PickResult Pick(PickArgs args) { return picker_->Pick(args); }
+        : name_(std::move(name)),
+          picker_(std::move(picker)),
+          target_(picker_->Innermost()) {}
+    PickResult Pick(PickArgs args) { return target_->Pick(args); }
 
     const std::string& name() const { return name_; }
 
    private:
     std::string name_;
     std::unique_ptr<SubchannelPicker> picker_;
+    // Skips any pass-through layers in the child policy's picker.
+    SubchannelPicker* target_;
   };
 
   // Picks a child using prefix or path matching and then delegates to that
@@ -724,8 +728,9 @@ class XdsClusterManagerLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsClusterManagerLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterManagerLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsClusterManager,
+      []() { return std::make_unique<XdsClusterManagerLbFactory>(); });
 }
 
 }  // namespace grpc_core
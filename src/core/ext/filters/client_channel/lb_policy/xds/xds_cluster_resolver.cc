@@ -1208,8 +1208,9 @@ class XdsClusterResolverLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsClusterResolverLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterResolverLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsClusterResolver,
+      []() { return std::make_unique<XdsClusterResolverLbFactory>(); });
 }
 
 }  // namespace grpc_core
@@ -357,8 +357,9 @@ class XdsWrrLocalityLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsWrrLocalityLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsWrrLocalityLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsWrrLocality,
+      []() { return std::make_unique<XdsWrrLocalityLbFactory>(); });
 }
 
 }  // namespace grpc_core
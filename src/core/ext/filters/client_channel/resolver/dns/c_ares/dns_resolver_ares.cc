@@ -72,6 +72,7 @@
 #include "src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.h"
 #include "src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper.h"
 #include "src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.h"
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
 #include "src/core/ext/filters/client_channel/resolver/polling_resolver.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -113,13 +114,35 @@ class AresClientChannelDNSResolver : public PollingResolver {
       Ref(DEBUG_LOCATION, "OnHostnameResolved").release();
       GRPC_CLOSURE_INIT(&on_hostname_resolved_, OnHostnameResolved, this,
                         nullptr);
-      hostname_request_.reset(grpc_dns_lookup_hostname_ares(
-          resolver_->authority().c_str(), resolver_->name_to_resolve().c_str(),
-          kDefaultSecurePort, resolver_->interested_parties(),
-          &on_hostname_resolved_, &addresses_, resolver_->query_timeout_ms_));
-      GRPC_CARES_TRACE_LOG(
-          "resolver:%p Started resolving hostnames. hostname_request_:%p",
-          resolver_.get(), hostname_request_.get());
+      if (resolver_->result_cache_ttl_ > Duration::Zero()) {
+        hostname_cache_request_ = DnsResultCache::Get()->Lookup(
+            absl::StrCat("ares:", resolver_->authority(), "/",
+                         resolver_->name_to_resolve()),
+            resolver_->result_cache_ttl_, resolver_->interested_parties(),
+            [this](grpc_pollset_set* lookup_parties,
+                   DnsResultCache::OnDone on_done) {
+              return MakeOrphanable<AresHostnameLookup>(
+                  resolver_->authority(), resolver_->name_to_resolve(),
+                  lookup_parties, resolver_->query_timeout_ms_,
+                  std::move(on_done));
+            },
+            [this](DnsResultCache::Result result) {
+              OnCachedHostnameResolved(std::move(result));
+            });
+        GRPC_CARES_TRACE_LOG(
+            "resolver:%p Looking up hostnames in the DNS result cache. "
+            "hostname_cache_request_:%p",
+            resolver_.get(), hostname_cache_request_.get());
+      } else {
+        hostname_request_.reset(grpc_dns_lookup_hostname_ares(
+            resolver_->authority().c_str(),
+            resolver_->name_to_resolve().c_str(), kDefaultSecurePort,
+            resolver_->interested_parties(), &on_hostname_resolved_,
+            &addresses_, resolver_->query_timeout_ms_));
+        GRPC_CARES_TRACE_LOG(
+            "resolver:%p Started resolving hostnames. hostname_request_:%p",
+            resolver_.get(), hostname_request_.get());
+      }
       if (resolver_->enable_srv_queries_) {
         Ref(DEBUG_LOCATION, "OnSRVResolved").release();
         GRPC_CLOSURE_INIT(&on_srv_resolved_, OnSRVResolved, this, nullptr);
@@ -160,6 +183,7 @@ class AresClientChannelDNSResolver : public PollingResolver {
         if (hostname_request_ != nullptr) {
           grpc_cancel_ares_request(hostname_request_.get());
         }
+        hostname_cache_request_.reset();
         if (srv_request_ != nullptr) {
           grpc_cancel_ares_request(srv_request_.get());
         }
@@ -172,6 +196,7 @@ class AresClientChannelDNSResolver : public PollingResolver {
 
    private:
     static void OnHostnameResolved(void* arg, grpc_error_handle error);
+    void OnCachedHostnameResolved(DnsResultCache::Result result);
     static void OnSRVResolved(void* arg, grpc_error_handle error);
     static void OnTXTResolved(void* arg, grpc_error_handle error);
     absl::optional<Result> OnResolvedLocked(grpc_error_handle error)
@@ -182,6 +207,10 @@ class AresClientChannelDNSResolver : public PollingResolver {
     grpc_closure on_hostname_resolved_;
     std::unique_ptr<grpc_ares_request> hostname_request_
         ABSL_GUARDED_BY(on_resolved_mu_);
+    // Used instead of hostname_request_ when results are shared through the
+    // DnsResultCache.
+    OrphanablePtr<Orphanable> hostname_cache_request_
+        ABSL_GUARDED_BY(on_resolved_mu_);
     grpc_closure on_srv_resolved_;
     std::unique_ptr<grpc_ares_request> srv_request_
         ABSL_GUARDED_BY(on_resolved_mu_);
@@ -196,6 +225,39 @@ class AresClientChannelDNSResolver : public PollingResolver {
     char* service_config_json_ ABSL_GUARDED_BY(on_resolved_mu_) = nullptr;
   };
 
+  // Looks up the addresses of a name on behalf of the DnsResultCache.
+  class AresHostnameLookup : public InternallyRefCounted<AresHostnameLookup> {
+   public:
+    AresHostnameLookup(const std::string& authority, const std::string& name,
+                       grpc_pollset_set* interested_parties,
+                       int query_timeout_ms, DnsResultCache::OnDone on_done)
+        : on_done_(std::move(on_done)) {
+      MutexLock lock(&mu_);
+      Ref(DEBUG_LOCATION, "OnResolved").release();
+      GRPC_CLOSURE_INIT(&on_resolved_, OnResolved, this, nullptr);
+      request_.reset(grpc_dns_lookup_hostname_ares(
+          authority.c_str(), name.c_str(), kDefaultSecurePort,
+          interested_parties, &on_resolved_, &addresses_, query_timeout_ms));
+    }
+
+    void Orphan() override ABSL_NO_THREAD_SAFETY_ANALYSIS {
+      {
+        MutexLock lock(&mu_);
+        if (request_ != nullptr) grpc_cancel_ares_request(request_.get());
+      }
+      Unref(DEBUG_LOCATION, "Orphan");
+    }
+
+   private:
+    static void OnResolved(void* arg, grpc_error_handle error);
+
+    Mutex mu_;
+    grpc_closure on_resolved_;
+    std::unique_ptr<grpc_ares_request> request_ ABSL_GUARDED_BY(mu_);
+    std::unique_ptr<ServerAddressList> addresses_ ABSL_GUARDED_BY(mu_);
+    DnsResultCache::OnDone on_done_;
+  };
+
   ~AresClientChannelDNSResolver() override;
 
   /// whether to request the service config
@@ -204,6 +266,9 @@ class AresClientChannelDNSResolver : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   const int query_timeout_ms_;
+  // TTL of results shared through the DnsResultCache, or zero if the cache
+  // is not used
+  const Duration result_cache_ttl_;
 };
 
 AresClientChannelDNSResolver::AresClientChannelDNSResolver(
@@ -215,6 +280,9 @@ AresClientChannelDNSResolver::AresClientChannelDNSResolver(
                        .GetDurationFromIntMillis(
                            GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS)
                        .value_or(Duration::Seconds(30))),
+          channel_args
+              .GetDurationFromIntMillis(GRPC_ARG_DNS_REFRESH_INTERVAL_MS)
+              .value_or(Duration::Zero()),
           BackOff::Options()
               .set_initial_backoff(Duration::Milliseconds(
                   GRPC_DNS_INITIAL_CONNECT_BACKOFF_SECONDS * 1000))
@@ -230,7 +298,8 @@ AresClientChannelDNSResolver::AresClientChannelDNSResolver(
                               .value_or(false)),
       query_timeout_ms_(
           std::max(0, channel_args.GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
-                          .value_or(GRPC_DNS_ARES_DEFAULT_QUERY_TIMEOUT_MS))) {}
+                          .value_or(GRPC_DNS_ARES_DEFAULT_QUERY_TIMEOUT_MS))),
+      result_cache_ttl_(DnsResultCache::TtlFromChannelArgs(channel_args)) {}
 
 AresClientChannelDNSResolver::~AresClientChannelDNSResolver() {
   GRPC_CARES_TRACE_LOG("resolver:%p destroying AresClientChannelDNSResolver",
@@ -348,6 +417,45 @@ void AresClientChannelDNSResolver::AresRequestWrapper::OnHostnameResolved(
   self->Unref(DEBUG_LOCATION, "OnHostnameResolved");
 }
 
+void AresClientChannelDNSResolver::AresRequestWrapper::OnCachedHostnameResolved(
+    DnsResultCache::Result result) {
+  absl::optional<Result> resolver_result;
+  {
+    MutexLock lock(&on_resolved_mu_);
+    hostname_cache_request_.reset();
+    grpc_error_handle error;
+    if (result.ok()) {
+      addresses_ = std::make_unique<ServerAddressList>(std::move(*result));
+    } else {
+      error = result.status();
+    }
+    resolver_result = OnResolvedLocked(error);
+  }
+  if (resolver_result.has_value()) {
+    resolver_->OnRequestComplete(std::move(*resolver_result));
+  }
+  Unref(DEBUG_LOCATION, "OnHostnameResolved");
+}
+
+void AresClientChannelDNSResolver::AresHostnameLookup::OnResolved(
+    void* arg, grpc_error_handle error) {
+  auto* self = static_cast<AresHostnameLookup*>(arg);
+  DnsResultCache::Result result;
+  {
+    MutexLock lock(&self->mu_);
+    self->request_.reset();
+    if (self->addresses_ != nullptr) {
+      result = std::move(*self->addresses_);
+    } else if (!error.ok()) {
+      result = error;
+    } else {
+      result = absl::UnavailableError("no addresses returned");
+    }
+  }
+  self->on_done_(std::move(result));
+  self->Unref(DEBUG_LOCATION, "OnResolved");
+}
+
 void AresClientChannelDNSResolver::AresRequestWrapper::OnSRVResolved(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<AresRequestWrapper*>(arg);
@@ -385,12 +493,15 @@ void AresClientChannelDNSResolver::AresRequestWrapper::OnTXTResolved(
 absl::optional<AresClientChannelDNSResolver::Result>
 AresClientChannelDNSResolver::AresRequestWrapper::OnResolvedLocked(
     grpc_error_handle error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(on_resolved_mu_) {
-  if (hostname_request_ != nullptr || srv_request_ != nullptr ||
-      txt_request_ != nullptr) {
+  if (hostname_request_ != nullptr || hostname_cache_request_ != nullptr ||
+      srv_request_ != nullptr || txt_request_ != nullptr) {
     GRPC_CARES_TRACE_LOG(
         "resolver:%p OnResolved() waiting for results (hostname: %s, srv: %s, "
         "txt: %s)",
-        this, hostname_request_ != nullptr ? "waiting" : "done",
+        this,
+        hostname_request_ != nullptr || hostname_cache_request_ != nullptr
+            ? "waiting"
+            : "done",
         srv_request_ != nullptr ? "waiting" : "done",
         txt_request_ != nullptr ? "waiting" : "done");
     return absl::nullopt;
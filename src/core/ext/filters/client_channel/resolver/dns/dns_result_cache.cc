@@ -0,0 +1,249 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+
+#include <grpc/impl/codegen/grpc_types.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Runs on_done from the ExecCtx, so that it is never invoked with the
+// caller's locks held.
+void RunOnDone(DnsResultCache::OnDone on_done, DnsResultCache::Result result) {
+  ExecCtx::Run(DEBUG_LOCATION,
+               NewClosure([on_done = std::move(on_done),
+                           result = std::move(result)](
+                              grpc_error_handle /*error*/) mutable {
+                 on_done(std::move(result));
+               }),
+               absl::OkStatus());
+}
+
+}  // namespace
+
+//
+// DnsResultCache::InFlight
+//
+
+struct DnsResultCache::InFlight {
+  InFlight() : interested_parties(grpc_pollset_set_create()) {}
+  ~InFlight() { grpc_pollset_set_destroy(interested_parties); }
+
+  // Drives the lookup.  The interested_parties of every waiting request
+  // are linked to it.
+  grpc_pollset_set* const interested_parties;
+  // Null until start_lookup has returned.
+  OrphanablePtr<Orphanable> lookup;
+  bool done = false;
+  std::vector<Request*> requests;
+};
+
+//
+// DnsResultCache::Request
+//
+
+class DnsResultCache::Request : public Orphanable {
+ public:
+  Request(DnsResultCache* cache, grpc_pollset_set* interested_parties,
+          OnDone on_done)
+      : cache_(cache),
+        interested_parties_(interested_parties),
+        on_done_(std::move(on_done)) {}
+
+  void Orphan() override {
+    cache_->CancelRequest(this);
+    delete this;
+  }
+
+ private:
+  friend class DnsResultCache;
+
+  DnsResultCache* const cache_;
+  grpc_pollset_set* const interested_parties_;
+  // Guarded by the cache's mu_ while the request waits on a lookup.
+  std::string key_;
+  InFlight* in_flight_ = nullptr;
+  OnDone on_done_;
+};
+
+//
+// DnsResultCache
+//
+
+DnsResultCache* DnsResultCache::Get() {
+  static DnsResultCache* cache = new DnsResultCache();
+  return cache;
+}
+
+Duration DnsResultCache::TtlFromChannelArgs(const ChannelArgs& args) {
+  return std::max(
+      Duration::Zero(),
+      args.GetDurationFromIntMillis(GRPC_ARG_DNS_RESULT_CACHE_TTL_MS)
+          .value_or(Duration::Zero()));
+}
+
+OrphanablePtr<Orphanable> DnsResultCache::Lookup(
+    const std::string& key, Duration ttl, grpc_pollset_set* interested_parties,
+    const StartLookup& start_lookup, OnDone on_done) {
+  auto* request = new Request(this, interested_parties, std::move(on_done));
+  OrphanablePtr<Orphanable> request_ptr(request);
+  const Timestamp now = Timestamp::Now();
+  std::shared_ptr<InFlight> in_flight;
+  {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      Entry& entry = it->second;
+      entry.max_ttl = std::max(entry.max_ttl, ttl);
+      if (entry.addresses.has_value() && now - entry.resolved_time < ttl) {
+        global_stats().IncrementDnsCacheHits();
+        RunOnDone(std::move(request->on_done_), *entry.addresses);
+        return request_ptr;
+      }
+      if (entry.in_flight != nullptr) {
+        global_stats().IncrementDnsCacheHits();
+        request->key_ = key;
+        request->in_flight_ = entry.in_flight.get();
+        entry.in_flight->requests.push_back(request);
+        grpc_pollset_set_add_pollset_set(interested_parties,
+                                         entry.in_flight->interested_parties);
+        return request_ptr;
+      }
+    } else {
+      RemoveExpiredEntriesLocked(now);
+    }
+    global_stats().IncrementDnsCacheMisses();
+    Entry& entry = entries_[key];
+    entry.max_ttl = std::max(entry.max_ttl, ttl);
+    entry.in_flight = std::make_shared<InFlight>();
+    in_flight = entry.in_flight;
+    request->key_ = key;
+    request->in_flight_ = in_flight.get();
+    in_flight->requests.push_back(request);
+    grpc_pollset_set_add_pollset_set(interested_parties,
+                                     in_flight->interested_parties);
+  }
+  // The callback holds the only ref to in_flight that outlives the entry,
+  // so that its pollset_set stays alive for as long as the lookup runs.
+  OrphanablePtr<Orphanable> lookup = start_lookup(
+      in_flight->interested_parties, [this, key, in_flight](Result result) {
+        OnLookupDone(key, in_flight.get(), std::move(result));
+      });
+  {
+    MutexLock lock(&mu_);
+    if (!in_flight->done && !in_flight->requests.empty()) {
+      in_flight->lookup = std::move(lookup);
+    }
+  }
+  // If the lookup already finished or lost all of its requests, lookup is
+  // still set and is orphaned here.
+  return request_ptr;
+}
+
+void DnsResultCache::OnLookupDone(const std::string& key, InFlight* in_flight,
+                                  Result result) {
+  std::vector<OnDone> callbacks;
+  OrphanablePtr<Orphanable> lookup;
+  {
+    MutexLock lock(&mu_);
+    in_flight->done = true;
+    lookup = std::move(in_flight->lookup);
+    for (Request* request : in_flight->requests) {
+      grpc_pollset_set_del_pollset_set(request->interested_parties_,
+                                       in_flight->interested_parties);
+      request->in_flight_ = nullptr;
+      callbacks.push_back(std::move(request->on_done_));
+    }
+    in_flight->requests.clear();
+    // The entry no longer refers to in_flight if its last request was
+    // cancelled.
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second.in_flight.get() == in_flight) {
+      Entry& entry = it->second;
+      if (result.ok()) {
+        entry.in_flight.reset();
+        entry.addresses = *result;
+        entry.resolved_time = Timestamp::Now();
+      } else {
+        entries_.erase(it);
+      }
+    }
+  }
+  for (OnDone& on_done : callbacks) RunOnDone(std::move(on_done), result);
+}
+
+void DnsResultCache::CancelRequest(Request* request) {
+  OnDone on_done;
+  OrphanablePtr<Orphanable> lookup;
+  {
+    MutexLock lock(&mu_);
+    InFlight* in_flight = request->in_flight_;
+    if (in_flight == nullptr) return;
+    request->in_flight_ = nullptr;
+    grpc_pollset_set_del_pollset_set(request->interested_parties_,
+                                     in_flight->interested_parties);
+    on_done = std::move(request->on_done_);
+    in_flight->requests.erase(std::find(in_flight->requests.begin(),
+                                        in_flight->requests.end(), request));
+    if (in_flight->requests.empty()) {
+      // Nobody waits for the lookup any more.  Its callback still runs,
+      // once the cancellation reaches it, but finds no entry to fill.
+      lookup = std::move(in_flight->lookup);
+      auto it = entries_.find(request->key_);
+      if (it != entries_.end() && it->second.in_flight.get() == in_flight) {
+        if (it->second.addresses.has_value()) {
+          it->second.in_flight.reset();
+        } else {
+          entries_.erase(it);
+        }
+      }
+    }
+  }
+  RunOnDone(std::move(on_done), absl::CancelledError("DNS lookup cancelled"));
+}
+
+void DnsResultCache::RemoveExpiredEntriesLocked(Timestamp now) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    const Entry& entry = it->second;
+    if (entry.in_flight == nullptr &&
+        (!entry.addresses.has_value() ||
+         now - entry.resolved_time >= entry.max_ttl)) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,100 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_DNS_DNS_RESULT_CACHE_H
+#define GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_DNS_DNS_RESULT_CACHE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/resolver/server_address.h"
+
+namespace grpc_core {
+
+// A process-wide cache of DNS address lookups, shared by the DNS resolvers
+// of all channels that opt in with GRPC_ARG_DNS_RESULT_CACHE_TTL_MS.
+//
+// A successful result is reused by later lookups of the same key for as
+// long as it is younger than the TTL each of them asks for.  A lookup that
+// finds another one for its key in flight joins it instead of starting
+// its own.  Failures are only shared with the lookups that joined.
+class DnsResultCache {
+ public:
+  using Result = absl::StatusOr<ServerAddressList>;
+  using OnDone = std::function<void(Result)>;
+  // Starts the lookup, which must invoke on_done exactly once, and returns
+  // a handle whose orphaning cancels the lookup if it is still running.
+  // The handle is orphaned after on_done has run, too.  The lookup must be
+  // driven by interested_parties.
+  using StartLookup = std::function<OrphanablePtr<Orphanable>(
+      grpc_pollset_set* interested_parties, OnDone on_done)>;
+
+  static DnsResultCache* Get();
+
+  // Returns the TTL set by GRPC_ARG_DNS_RESULT_CACHE_TTL_MS in args, or
+  // zero if the cache is not to be used.
+  static Duration TtlFromChannelArgs(const ChannelArgs& args);
+
+  // Looks up key, calling start_lookup only if there is neither a fresh
+  // result nor a lookup in flight.  on_done is invoked exactly once, never
+  // from within Lookup() itself.  Orphaning the returned request makes
+  // on_done see a CANCELLED status if it is still waiting; the shared
+  // lookup is cancelled once no request waits on it any more.
+  OrphanablePtr<Orphanable> Lookup(const std::string& key, Duration ttl,
+                                   grpc_pollset_set* interested_parties,
+                                   const StartLookup& start_lookup,
+                                   OnDone on_done);
+
+ private:
+  class Request;
+  struct InFlight;
+
+  struct Entry {
+    // Set while a lookup is in flight.
+    std::shared_ptr<InFlight> in_flight;
+    // The last successful result, if any.
+    absl::optional<ServerAddressList> addresses;
+    Timestamp resolved_time;
+    // The longest TTL any lookup of this key has asked for.
+    Duration max_ttl;
+  };
+
+  void OnLookupDone(const std::string& key, InFlight* in_flight,
+                    Result result);
+  void CancelRequest(Request* request);
+  void RemoveExpiredEntriesLocked(Timestamp now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  std::map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_DNS_DNS_RESULT_CACHE_H
@@ -34,6 +34,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.h"
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
 #include "src/core/ext/filters/client_channel/resolver/polling_resolver.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -84,10 +85,23 @@ class NativeClientChannelDNSResolver : public PollingResolver {
     void Orphan() override { delete this; }
   };
 
-  void OnResolved(
-      absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or);
+  void OnResolved(absl::StatusOr<ServerAddressList> addresses_or);
+
+  // The TTL of results shared through the DnsResultCache, or zero if the
+  // cache is not used.
+  const Duration result_cache_ttl_;
 };
 
+absl::StatusOr<ServerAddressList> ToServerAddressList(
+    absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or) {
+  if (!addresses_or.ok()) return addresses_or.status();
+  ServerAddressList addresses;
+  for (auto& addr : *addresses_or) {
+    addresses.emplace_back(addr, ChannelArgs());
+  }
+  return addresses;
+}
+
 NativeClientChannelDNSResolver::NativeClientChannelDNSResolver(
     ResolverArgs args, const ChannelArgs& channel_args)
     : PollingResolver(
@@ -97,6 +111,9 @@ NativeClientChannelDNSResolver::NativeClientChannelDNSResolver(
                        .GetDurationFromIntMillis(
                            GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS)
                        .value_or(Duration::Seconds(30))),
+          channel_args
+              .GetDurationFromIntMillis(GRPC_ARG_DNS_REFRESH_INTERVAL_MS)
+              .value_or(Duration::Zero()),
           BackOff::Options()
               .set_initial_backoff(Duration::Milliseconds(
                   GRPC_DNS_INITIAL_CONNECT_BACKOFF_SECONDS * 1000))
@@ -104,7 +121,8 @@ NativeClientChannelDNSResolver::NativeClientChannelDNSResolver(
               .set_jitter(GRPC_DNS_RECONNECT_JITTER)
               .set_max_backoff(Duration::Milliseconds(
                   GRPC_DNS_RECONNECT_MAX_BACKOFF_SECONDS * 1000)),
-          &grpc_trace_dns_resolver) {
+          &grpc_trace_dns_resolver),
+      result_cache_ttl_(DnsResultCache::TtlFromChannelArgs(channel_args)) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
     gpr_log(GPR_DEBUG, "[dns_resolver=%p] created", this);
   }
@@ -118,8 +136,27 @@ NativeClientChannelDNSResolver::~NativeClientChannelDNSResolver() {
 
 OrphanablePtr<Orphanable> NativeClientChannelDNSResolver::StartRequest() {
   Ref(DEBUG_LOCATION, "dns_request").release();
+  if (result_cache_ttl_ > Duration::Zero()) {
+    return DnsResultCache::Get()->Lookup(
+        absl::StrCat("native:", name_to_resolve()), result_cache_ttl_,
+        interested_parties(),
+        [this](grpc_pollset_set* lookup_parties,
+               DnsResultCache::OnDone on_done) -> OrphanablePtr<Orphanable> {
+          GetDNSResolver()->LookupHostname(
+              [on_done](absl::StatusOr<std::vector<grpc_resolved_address>>
+                            addresses_or) {
+                on_done(ToServerAddressList(std::move(addresses_or)));
+              },
+              name_to_resolve(), kDefaultSecurePort, kDefaultDNSRequestTimeout,
+              lookup_parties, /*name_server=*/"");
+          return MakeOrphanable<Request>();
+        },
+        absl::bind_front(&NativeClientChannelDNSResolver::OnResolved, this));
+  }
   auto dns_request_handle = GetDNSResolver()->LookupHostname(
-      absl::bind_front(&NativeClientChannelDNSResolver::OnResolved, this),
+      [this](absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or) {
+        OnResolved(ToServerAddressList(std::move(addresses_or)));
+      },
       name_to_resolve(), kDefaultSecurePort, kDefaultDNSRequestTimeout,
       interested_parties(), /*name_server=*/"");
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
@@ -130,7 +167,7 @@ OrphanablePtr<Orphanable> NativeClientChannelDNSResolver::StartRequest() {
 }
 
 void NativeClientChannelDNSResolver::OnResolved(
-    absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or) {
+    absl::StatusOr<ServerAddressList> addresses_or) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
     gpr_log(GPR_DEBUG, "[dns_resolver=%p] request complete, status=\"%s\"",
             this, addresses_or.status().ToString().c_str());
@@ -138,11 +175,7 @@ void NativeClientChannelDNSResolver::OnResolved(
   // Convert result from iomgr DNS API into Resolver::Result.
   Result result;
   if (addresses_or.ok()) {
-    ServerAddressList addresses;
-    for (auto& addr : *addresses_or) {
-      addresses.emplace_back(addr, ChannelArgs());
-    }
-    result.addresses = std::move(addresses);
+    result.addresses = std::move(*addresses_or);
   } else {
     result.addresses = absl::UnavailableError(
         absl::StrCat("DNS resolution failed for ", name_to_resolve(), ": ",
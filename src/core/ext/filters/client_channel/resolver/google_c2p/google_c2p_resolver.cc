@@ -464,10 +464,13 @@ class ExperimentalGoogleCloud2ProdResolverFactory : public ResolverFactory {
 }  // namespace
 
 void RegisterCloud2ProdResolver(CoreConfiguration::Builder* builder) {
-  builder->resolver_registry()->RegisterResolverFactory(
-      std::make_unique<GoogleCloud2ProdResolverFactory>());
-  builder->resolver_registry()->RegisterResolverFactory(
-      std::make_unique<ExperimentalGoogleCloud2ProdResolverFactory>());
+  builder->resolver_registry()->RegisterLazyResolverFactory(
+      "google-c2p",
+      []() { return std::make_unique<GoogleCloud2ProdResolverFactory>(); });
+  builder->resolver_registry()->RegisterLazyResolverFactory(
+      "google-c2p-experimental", []() {
+        return std::make_unique<ExperimentalGoogleCloud2ProdResolverFactory>();
+      });
 }
 
 }  // namespace grpc_core
@@ -20,7 +20,9 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <functional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -48,6 +50,7 @@ namespace grpc_core {
 PollingResolver::PollingResolver(ResolverArgs args,
                                  const ChannelArgs& channel_args,
                                  Duration min_time_between_resolutions,
+                                 Duration refresh_interval,
                                  BackOff::Options backoff_options,
                                  TraceFlag* tracer)
     : authority_(args.uri.authority()),
@@ -58,6 +61,10 @@ PollingResolver::PollingResolver(ResolverArgs args,
       tracer_(tracer),
       interested_parties_(args.pollset_set),
       min_time_between_resolutions_(min_time_between_resolutions),
+      refresh_interval_(refresh_interval > Duration::Zero()
+                            ? std::max(refresh_interval,
+                                       min_time_between_resolutions)
+                            : Duration::Zero()),
       backoff_(backoff_options) {
   if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
     gpr_log(GPR_INFO, "[polling resolver %p] created", this);
@@ -102,6 +109,9 @@ void PollingResolver::ShutdownLocked() {
   if (have_next_resolution_timer_) {
     grpc_timer_cancel(&next_resolution_timer_);
   }
+  if (have_refresh_timer_) {
+    grpc_timer_cancel(&refresh_timer_);
+  }
   request_.reset();
 }
 
@@ -119,7 +129,9 @@ void PollingResolver::OnNextResolutionLocked(grpc_error_handle error) {
             this, StatusToString(error).c_str(), shutdown_);
   }
   have_next_resolution_timer_ = false;
+  const bool refresh = std::exchange(refresh_retry_pending_, false);
   if (error.ok() && !shutdown_) {
+    refresh_in_flight_ = refresh;
     StartResolvingLocked();
   }
   Unref(DEBUG_LOCATION, "retry-timer");
@@ -137,7 +149,8 @@ void PollingResolver::OnRequestCompleteLocked(Result result) {
     gpr_log(GPR_INFO, "[polling resolver %p] request complete", this);
   }
   request_.reset();
-  if (!shutdown_) {
+  const bool refresh = std::exchange(refresh_in_flight_, false);
+  if (!shutdown_ && (!refresh || ShouldReportRefreshResultLocked(result))) {
     if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
       gpr_log(GPR_INFO,
               "[polling resolver %p] returning result: "
@@ -154,6 +167,7 @@ void PollingResolver::OnRequestCompleteLocked(Result result) {
                                .c_str())
                   : result.service_config.status().ToString().c_str());
     }
+    RecordReportedResultLocked(result);
     GPR_ASSERT(result.result_health_callback == nullptr);
     RefCountedPtr<PollingResolver> self =
         Ref(DEBUG_LOCATION, "result_health_callback");
@@ -181,28 +195,11 @@ void PollingResolver::GetResultStatus(absl::Status status) {
     if (std::exchange(result_status_state_, ResultStatusState::kNone) ==
         ResultStatusState::kReresolutionRequestedWhileCallbackWasPending) {
       MaybeStartResolvingLocked();
+    } else {
+      MaybeStartRefreshTimerLocked();
     }
   } else {
-    // Set up for retry.
-    // InvalidateNow to avoid getting stuck re-initializing this timer
-    // in a loop while draining the currently-held WorkSerializer.
-    // Also see https://github.com/grpc/grpc/issues/26079.
-    ExecCtx::Get()->InvalidateNow();
-    Timestamp next_try = backoff_.NextAttemptTime();
-    Duration timeout = next_try - Timestamp::Now();
-    GPR_ASSERT(!have_next_resolution_timer_);
-    have_next_resolution_timer_ = true;
-    if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
-      if (timeout > Duration::Zero()) {
-        gpr_log(GPR_INFO, "[polling resolver %p] retrying in %" PRId64 " ms",
-                this, timeout.millis());
-      } else {
-        gpr_log(GPR_INFO, "[polling resolver %p] retrying immediately", this);
-      }
-    }
-    Ref(DEBUG_LOCATION, "next_resolution_timer").release();
-    GRPC_CLOSURE_INIT(&on_next_resolution_, OnNextResolution, this, nullptr);
-    grpc_timer_init(&next_resolution_timer_, next_try, &on_next_resolution_);
+    StartRetryTimerLocked();
     // Reset result_status_state_.  Note that even if re-resolution was
     // requested while the result-health callback was pending, we can
     // ignore it here, because we are in backoff to re-resolve anyway.
@@ -210,6 +207,118 @@ void PollingResolver::GetResultStatus(absl::Status status) {
   }
 }
 
+void PollingResolver::StartRetryTimerLocked() {
+  // InvalidateNow to avoid getting stuck re-initializing this timer
+  // in a loop while draining the currently-held WorkSerializer.
+  // Also see https://github.com/grpc/grpc/issues/26079.
+  ExecCtx::Get()->InvalidateNow();
+  Timestamp next_try = backoff_.NextAttemptTime();
+  Duration timeout = next_try - Timestamp::Now();
+  GPR_ASSERT(!have_next_resolution_timer_);
+  have_next_resolution_timer_ = true;
+  if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
+    if (timeout > Duration::Zero()) {
+      gpr_log(GPR_INFO, "[polling resolver %p] retrying in %" PRId64 " ms",
+              this, timeout.millis());
+    } else {
+      gpr_log(GPR_INFO, "[polling resolver %p] retrying immediately", this);
+    }
+  }
+  Ref(DEBUG_LOCATION, "next_resolution_timer").release();
+  GRPC_CLOSURE_INIT(&on_next_resolution_, OnNextResolution, this, nullptr);
+  grpc_timer_init(&next_resolution_timer_, next_try, &on_next_resolution_);
+}
+
+namespace {
+
+std::string ServiceConfigJson(const Resolver::Result& result) {
+  if (*result.service_config == nullptr) return "";
+  return std::string((*result.service_config)->json_string());
+}
+
+}  // namespace
+
+bool PollingResolver::ShouldReportRefreshResultLocked(const Result& result) {
+  if (!result.addresses.ok() || !result.service_config.ok()) {
+    // Keep the last good result in place and try again with backoff.
+    if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
+      gpr_log(GPR_INFO,
+              "[polling resolver %p] background refresh failed; keeping "
+              "last result",
+              this);
+    }
+    StartRetryTimerLocked();
+    refresh_retry_pending_ = true;
+    return false;
+  }
+  if (last_addresses_.has_value() && *result.addresses == *last_addresses_ &&
+      ServiceConfigJson(result) == last_service_config_json_ &&
+      result.args == last_args_) {
+    if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
+      gpr_log(GPR_INFO,
+              "[polling resolver %p] background refresh returned the last "
+              "result; not reporting it",
+              this);
+    }
+    backoff_.Reset();
+    MaybeStartRefreshTimerLocked();
+    return false;
+  }
+  return true;
+}
+
+void PollingResolver::RecordReportedResultLocked(const Result& result) {
+  if (refresh_interval_ == Duration::Zero()) return;
+  if (!result.addresses.ok() || !result.service_config.ok()) {
+    last_addresses_.reset();
+    return;
+  }
+  last_addresses_ = *result.addresses;
+  last_service_config_json_ = ServiceConfigJson(result);
+  last_args_ = result.args;
+}
+
+void PollingResolver::MaybeStartRefreshTimerLocked() {
+  if (refresh_interval_ == Duration::Zero() || have_refresh_timer_ ||
+      shutdown_ || !last_resolution_timestamp_.has_value()) {
+    return;
+  }
+  have_refresh_timer_ = true;
+  Ref(DEBUG_LOCATION, "refresh_timer").release();
+  GRPC_CLOSURE_INIT(&on_refresh_, OnRefresh, this, nullptr);
+  grpc_timer_init(&refresh_timer_,
+                  *last_resolution_timestamp_ + refresh_interval_,
+                  &on_refresh_);
+}
+
+void PollingResolver::OnRefresh(void* arg, grpc_error_handle error) {
+  auto* self = static_cast<PollingResolver*>(arg);
+  self->work_serializer_->Run(
+      [self, error]() { self->OnRefreshLocked(error); }, DEBUG_LOCATION);
+}
+
+void PollingResolver::OnRefreshLocked(grpc_error_handle error) {
+  have_refresh_timer_ = false;
+  // Anything else in progress starts the refresh timer again when done.
+  if (error.ok() && !shutdown_ && request_ == nullptr &&
+      !have_next_resolution_timer_ &&
+      result_status_state_ == ResultStatusState::kNone) {
+    ExecCtx::Get()->InvalidateNow();
+    if (Timestamp::Now() < *last_resolution_timestamp_ + refresh_interval_) {
+      // The channel asked for a resolution since the timer was started.
+      MaybeStartRefreshTimerLocked();
+    } else {
+      if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
+        gpr_log(GPR_INFO, "[polling resolver %p] starting background refresh",
+                this);
+      }
+      refresh_in_flight_ = true;
+      StartResolvingLocked();
+    }
+  }
+  Unref(DEBUG_LOCATION, "refresh_timer");
+}
+
 void PollingResolver::MaybeStartResolvingLocked() {
   // If there is an existing timer, the time it fires is the earliest time we
   // can start the next resolution.
@@ -37,17 +37,25 @@
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/resolver/resolver.h"
 #include "src/core/lib/resolver/resolver_factory.h"
+#include "src/core/lib/resolver/server_address.h"
 
 namespace grpc_core {
 
 // A base class for polling-based resolvers.
 // Handles cooldown and backoff timers.
 // Implementations need only to implement StartRequest().
+//
+// If refresh_interval is positive, the resolver also resolves again that
+// long after each successful result, without waiting for the channel to
+// ask.  Such a background refresh keeps the last good result in place: a
+// failure is retried with backoff instead of being reported, and a result
+// identical to the last one is not reported either.
 class PollingResolver : public Resolver {
  public:
   PollingResolver(ResolverArgs args, const ChannelArgs& channel_args,
                   Duration min_time_between_resolutions,
-                  BackOff::Options backoff_options, TraceFlag* tracer);
+                  Duration refresh_interval, BackOff::Options backoff_options,
+                  TraceFlag* tracer);
   ~PollingResolver() override;
 
   void StartLocked() override;
@@ -77,6 +85,15 @@ class PollingResolver : public Resolver {
   void StartResolvingLocked();
 
   void OnRequestCompleteLocked(Result result);
+  // Returns true if the result of a background refresh should be
+  // reported to the channel.
+  bool ShouldReportRefreshResultLocked(const Result& result);
+  void RecordReportedResultLocked(const Result& result);
+
+  void StartRetryTimerLocked();
+  void MaybeStartRefreshTimerLocked();
+  static void OnRefresh(void* arg, grpc_error_handle error);
+  void OnRefreshLocked(grpc_error_handle error);
 
   void GetResultStatus(absl::Status status);
 
@@ -104,6 +121,21 @@ class PollingResolver : public Resolver {
   grpc_closure on_next_resolution_;
   /// min time between DNS requests
   Duration min_time_between_resolutions_;
+  /// interval of background refreshes, or zero if they are disabled
+  Duration refresh_interval_;
+  /// background refresh timer
+  bool have_refresh_timer_ = false;
+  grpc_timer refresh_timer_;
+  grpc_closure on_refresh_;
+  /// is the request in flight a background refresh?
+  bool refresh_in_flight_ = false;
+  /// is next_resolution_timer_ retrying a failed background refresh?
+  bool refresh_retry_pending_ = false;
+  /// the last successful result reported, for background refreshes to
+  /// compare against
+  absl::optional<ServerAddressList> last_addresses_;
+  std::string last_service_config_json_;
+  ChannelArgs last_args_;
   /// timestamp of last DNS request
   absl::optional<Timestamp> last_resolution_timestamp_;
   /// retry backoff state
@@ -39,6 +39,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 #include "absl/types/variant.h"
 #include "re2/re2.h"
 
@@ -349,6 +350,7 @@ class XdsResolver : public Resolver {
 
     RefCountedPtr<XdsResolver> resolver_;
     RouteTable route_table_;
+    XdsRouting::RouteListIndex route_list_index_;
     std::map<absl::string_view, RefCountedPtr<ClusterState>> clusters_;
     std::vector<const grpc_channel_filter*> filters_;
   };
@@ -522,6 +524,8 @@ XdsResolver::XdsConfigSelector::XdsConfigSelector(
       if (!status->ok()) return;
     }
   }
+  route_list_index_ =
+      XdsRouting::RouteListIndex(RouteListIterator(&route_table_));
   // Populate filter list.
   const auto& http_filter_registry =
       static_cast<const GrpcXdsBootstrap&>(resolver_->xds_client_->bootstrap())
@@ -533,6 +537,13 @@ XdsResolver::XdsConfigSelector::XdsConfigSelector(
         http_filter_registry.GetFilterForType(
             http_filter.config.config_proto_type_name);
     GPR_ASSERT(filter_impl != nullptr);
+    // Leave out filters that no route gives anything to do, so that the
+    // dynamic filter stack for this config selector doesn't include them.
+    if (XdsRouting::IsHttpFilterNoOp(
+            *filter_impl, http_filter,
+            absl::MakeConstSpan(&resolver_->current_virtual_host_, 1))) {
+      continue;
+    }
     // Add C-core filter to list.
     if (filter_impl->channel_filter() != nullptr) {
       filters_.push_back(filter_impl->channel_filter());
@@ -674,8 +685,8 @@ absl::optional<uint64_t> HeaderHashHelper(
 ConfigSelector::CallConfig XdsResolver::XdsConfigSelector::GetCallConfig(
     GetCallConfigArgs args) {
   auto route_index = XdsRouting::GetRouteForRequest(
-      RouteListIterator(&route_table_), StringViewFromSlice(*args.path),
-      args.initial_metadata);
+      RouteListIterator(&route_table_), route_list_index_,
+      StringViewFromSlice(*args.path), args.initial_metadata);
   if (!route_index.has_value()) {
     return CallConfig();
   }
@@ -1121,8 +1132,8 @@ class XdsResolverFactory : public ResolverFactory {
 }  // namespace
 
 void RegisterXdsResolver(CoreConfiguration::Builder* builder) {
-  builder->resolver_registry()->RegisterResolverFactory(
-      std::make_unique<XdsResolverFactory>());
+  builder->resolver_registry()->RegisterLazyResolverFactory(
+      "xds", []() { return std::make_unique<XdsResolverFactory>(); });
 }
 
 }  // namespace grpc_core
@@ -169,6 +169,18 @@ ClientChannelServiceConfigParser::ParsePerMethodParams(
   Duration timeout;
   ParseJsonObjectFieldAsDuration(json.object_value(), "timeout", &timeout,
                                  &error_list, false);
+  // Parse writeWeight.
+  absl::optional<uint32_t> write_weight;
+  uint32_t weight;
+  if (ParseJsonObjectField(json.object_value(), "writeWeight", &weight,
+                           &error_list, false)) {
+    if (weight == 0) {
+      error_list.push_back(GRPC_ERROR_CREATE(
+          "field:writeWeight error:must be greater than 0"));
+    } else {
+      write_weight = weight;
+    }
+  }
   // Return result.
   if (!error_list.empty()) {
     grpc_error_handle error =
@@ -178,8 +190,8 @@ ClientChannelServiceConfigParser::ParsePerMethodParams(
                      StatusToString(error)));
     return status;
   }
-  return std::make_unique<ClientChannelMethodParsedConfig>(timeout,
-                                                           wait_for_ready);
+  return std::make_unique<ClientChannelMethodParsedConfig>(
+      timeout, wait_for_ready, write_weight);
 }
 
 }  // namespace internal
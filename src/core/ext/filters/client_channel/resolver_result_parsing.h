@@ -73,16 +73,23 @@ class ClientChannelMethodParsedConfig
     : public ServiceConfigParser::ParsedConfig {
  public:
   ClientChannelMethodParsedConfig(Duration timeout,
-                                  const absl::optional<bool>& wait_for_ready)
-      : timeout_(timeout), wait_for_ready_(wait_for_ready) {}
+                                  const absl::optional<bool>& wait_for_ready,
+                                  const absl::optional<uint32_t>& write_weight)
+      : timeout_(timeout),
+        wait_for_ready_(wait_for_ready),
+        write_weight_(write_weight) {}
 
   Duration timeout() const { return timeout_; }
 
   absl::optional<bool> wait_for_ready() const { return wait_for_ready_; }
 
+  // Relative share of each connection write given to the call's stream.
+  absl::optional<uint32_t> write_weight() const { return write_weight_; }
+
  private:
   Duration timeout_;
   absl::optional<bool> wait_for_ready_;
+  absl::optional<uint32_t> write_weight_;
 };
 
 class ClientChannelServiceConfigParser : public ServiceConfigParser::Parser {
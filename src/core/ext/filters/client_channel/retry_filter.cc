@@ -50,6 +50,8 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/channel/status_util.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/construct_destruct.h"
@@ -65,7 +67,9 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/iomgr/timer.h"
+#include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/service_config/service_config.h"
 #include "src/core/lib/service_config/service_config_call_data.h"
 #include "src/core/lib/slice/slice.h"
@@ -102,6 +106,10 @@
 // the surface) by the time we realize that we need to retry.  To deal
 // with this, we cache data for send ops, so that we can replay them on a
 // different LB call even after we have completed the original batches.
+// The cache holds the original slices of each message, not a copy.  The
+// amount cached is limited by GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE, or, with
+// GRPC_ARG_RETRY_BUFFER_FROM_RESOURCE_QUOTA, charged to the resource quota
+// until it comes under memory pressure.
 //
 // The code is structured as follows:
 // - In CallData (in the parent channel), we maintain a list of pending
@@ -116,9 +124,14 @@
 // When constructing the "child" batches, we compare the state in the
 // CallAttempt object against the state in the CallData object to see
 // which batches need to be sent on the LB call for a given attempt.
-
-// TODO(roth): In subsequent PRs:
-// - implement hedging
+//
+// Hedging, which is configured with a hedgingPolicy instead of a
+// retryPolicy, uses the same machinery.  Rather than waiting for an attempt
+// to fail, we start another attempt every hedgingDelay, up to maxAttempts,
+// and it replays the cached send ops.  All attempts in flight get every
+// batch from the surface.  The first attempt to receive response headers,
+// or a status that is not one of the nonFatalStatusCodes, is committed, and
+// the others are cancelled.
 
 // By default, we buffer 256 KiB per RPC for retries.
 // TODO(roth): Do we have any data to suggest a better value?
@@ -132,6 +145,7 @@ namespace grpc_core {
 
 namespace {
 
+using internal::AdaptiveThrottleData;
 using internal::RetryGlobalConfig;
 using internal::RetryMethodConfig;
 using internal::RetryServiceConfigParser;
@@ -180,14 +194,24 @@ class RetryFilter {
         per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
         service_config_parser_index_(
             internal::RetryServiceConfigParser::ParserIndex()) {
+    if (grpc_channel_args_find_bool(
+            args, GRPC_ARG_RETRY_BUFFER_FROM_RESOURCE_QUOTA, false)) {
+      memory_quota_ = ResourceQuotaFromChannelArgs(args)->memory_quota();
+      retry_buffer_allocator_ =
+          memory_quota_->CreateMemoryAllocator("retry_buffer");
+    }
     // Get retry throttling parameters from service config.
     auto* service_config = grpc_channel_args_find_pointer<ServiceConfig>(
         args, GRPC_ARG_SERVICE_CONFIG_OBJ);
-    if (service_config == nullptr) return;
-    const auto* config = static_cast<const RetryGlobalConfig*>(
-        service_config->GetGlobalParsedConfig(
-            RetryServiceConfigParser::ParserIndex()));
-    if (config == nullptr) return;
+    const auto* config =
+        service_config == nullptr
+            ? nullptr
+            : static_cast<const RetryGlobalConfig*>(
+                  service_config->GetGlobalParsedConfig(
+                      RetryServiceConfigParser::ParserIndex()));
+    const int adaptive_throttling_k_percent = grpc_channel_args_find_integer(
+        args, GRPC_ARG_ADAPTIVE_THROTTLING_K_PERCENT, {0, 0, INT_MAX});
+    if (config == nullptr && adaptive_throttling_k_percent == 0) return;
     // Get server name from target URI.
     const char* server_uri =
         grpc_channel_args_find_string(args, GRPC_ARG_SERVER_URI);
@@ -204,11 +228,20 @@ class RetryFilter {
       return;
     }
     std::string server_name(absl::StripPrefix(uri->path(), "/"));
-    // Get throttling config for server_name.
-    retry_throttle_data_ =
-        internal::ServerRetryThrottleMap::Get()->GetDataForServer(
-            server_name, config->max_milli_tokens(),
-            config->milli_token_ratio());
+    // Get throttling config for server_name.  This is the only lookup in
+    // the global map: calls use the data held here.
+    if (config != nullptr) {
+      retry_throttle_data_ =
+          internal::ServerRetryThrottleMap::Get()->GetDataForServer(
+              server_name, config->max_milli_tokens(),
+              config->milli_token_ratio());
+    }
+    if (adaptive_throttling_k_percent > 0) {
+      adaptive_throttle_data_ =
+          internal::ServerRetryThrottleMap::Get()
+              ->GetAdaptiveThrottleForServer(
+                  server_name, adaptive_throttling_k_percent / 100.0);
+    }
   }
 
   const RetryMethodConfig* GetRetryPolicy(
@@ -216,7 +249,11 @@ class RetryFilter {
 
   ClientChannel* client_channel_;
   size_t per_rpc_retry_buffer_size_;
+  // Set if the retry buffer is charged to the resource quota.
+  MemoryQuotaRefPtr memory_quota_;
+  MemoryAllocator retry_buffer_allocator_;
   RefCountedPtr<ServerRetryThrottleData> retry_throttle_data_;
+  RefCountedPtr<AdaptiveThrottleData> adaptive_throttle_data_;
   const size_t service_config_parser_index_;
 };
 
@@ -249,15 +286,26 @@ class RetryFilter::CallData {
   // State associated with each call attempt.
   class CallAttempt : public RefCounted<CallAttempt> {
    public:
-    CallAttempt(CallData* calld, bool is_transparent_retry);
+    CallAttempt(CallData* calld, bool is_transparent_retry, bool is_hedge);
     ~CallAttempt() override;
 
     bool lb_call_committed() const { return lb_call_committed_; }
+    bool is_hedge() const { return is_hedge_; }
+    bool abandoned() const { return abandoned_; }
+    size_t started_send_message_count() const {
+      return started_send_message_count_;
+    }
 
     // Constructs and starts whatever batches are needed on this call
     // attempt.
     void StartRetriableBatches();
 
+    // Adds whatever batches are needed on this attempt to closures.
+    void AddRetriableBatches(CallCombinerClosureList* closures);
+
+    // Cancels a hedged attempt after another attempt was committed.
+    void CancelLosingHedge(CallCombinerClosureList* closures);
+
     // Frees cached send ops that have already been completed after
     // committing the call.
     void FreeCachedSendOpDataAfterCommit();
@@ -289,7 +337,7 @@ class RetryFilter::CallData {
       // Adds retriable recv_initial_metadata op.
       void AddRetriableRecvInitialMetadataOp();
       // Adds retriable recv_message op.
-      void AddRetriableRecvMessageOp();
+      void AddRetriableRecvMessageOp(bool allow_partial);
       // Adds retriable recv_trailing_metadata op.
       void AddRetriableRecvTrailingMetadataOp();
       // Adds cancel_stream op.
@@ -423,9 +471,6 @@ class RetryFilter::CallData {
     // Adds batches for pending batches to closures.
     void AddBatchesForPendingBatches(CallCombinerClosureList* closures);
 
-    // Adds whatever batches are needed on this attempt to closures.
-    void AddRetriableBatches(CallCombinerClosureList* closures);
-
     // Returns true if any send op in the batch was not yet started on this
     // attempt.
     bool PendingBatchContainsUnstartedSendOps(PendingBatch* pending);
@@ -450,6 +495,8 @@ class RetryFilter::CallData {
     void MaybeCancelPerAttemptRecvTimer();
 
     CallData* calld_;
+    // True if this attempt was started by the hedging timer.
+    const bool is_hedge_;
     AttemptDispatchController attempt_dispatch_controller_;
     OrphanablePtr<ClientChannel::LoadBalancedCall> lb_call_;
     bool lb_call_committed_ = false;
@@ -544,9 +591,41 @@ class RetryFilter::CallData {
   void FreeCachedSendTrailingMetadata();
   void FreeAllCachedSendOpData();
 
+  // Adds bytes to the data buffered for retries, charging them to the
+  // resource quota if configured.  Returns true if that takes us over the
+  // retry buffer limit.
+  bool ExceedsRetryBufferLimit(size_t bytes);
+  // Returns any bytes charged to the resource quota.
+  void ReleaseRetryBufferReservation();
+
   // Commits the call so that no further retry attempts will be performed.
   void RetryCommit(CallAttempt* call_attempt);
 
+  bool hedging() const {
+    return retry_policy_ != nullptr &&
+           retry_policy_->hedging_delay().has_value();
+  }
+
+  // Constructs and starts whatever batches are needed on every attempt in
+  // flight.
+  void StartRetriableBatches();
+
+  // Makes call_attempt, which must be in flight, the current attempt and
+  // cancels the other hedged attempts.
+  void CommitToHedgedAttempt(CallAttempt* call_attempt);
+
+  // Forgets call_attempt after it failed while other hedged attempts are
+  // still in flight.  Returns false, leaving call_attempt in place, if it
+  // is the only attempt in flight.
+  bool RemoveHedgedAttempt(CallAttempt* call_attempt);
+
+  // Starts a timer to send the next hedged attempt, if more are allowed.
+  void MaybeStartHedgingTimer();
+  void MaybeCancelHedgingTimer();
+
+  static void OnHedgingTimer(void* arg, grpc_error_handle error);
+  static void OnHedgingTimerLocked(void* arg, grpc_error_handle error);
+
   // Starts a timer to retry after appropriate back-off.
   // If server_pushback is nullopt, retry_backoff_ is used.
   void StartRetryTimer(absl::optional<Duration> server_pushback);
@@ -563,10 +642,14 @@ class RetryFilter::CallData {
       bool is_transparent_retry);
 
   void CreateCallAttempt(bool is_transparent_retry);
+  // Starts a hedged attempt alongside the ones in flight.  Yields the call
+  // combiner.
+  void StartHedgedAttempt();
 
   RetryFilter* chand_;
   grpc_polling_entity* pollent_;
-  RefCountedPtr<ServerRetryThrottleData> retry_throttle_data_;
+  // Owned by the channel, which outlives the call.
+  ServerRetryThrottleData* retry_throttle_data_;
   const RetryMethodConfig* retry_policy_ = nullptr;
   BackOff retry_backoff_;
 
@@ -581,10 +664,11 @@ class RetryFilter::CallData {
 
   RefCountedPtr<CallStackDestructionBarrier> call_stack_destruction_barrier_;
 
-  // TODO(roth): As part of implementing hedging, we will need to maintain a
-  // list of all pending attempts, so that we can cancel them all if the call
-  // gets cancelled.
+  // The current call attempt.  With hedging, it is the most recently
+  // started attempt until the call is committed, and hedged_attempts_ holds
+  // the other attempts in flight.
   RefCountedPtr<CallAttempt> call_attempt_;
+  absl::InlinedVector<RefCountedPtr<CallAttempt>, 2> hedged_attempts_;
 
   // LB call used when we've committed to a call attempt and the retry
   // state for that attempt is no longer needed.  This provides a fast
@@ -597,6 +681,8 @@ class RetryFilter::CallData {
   // batches received from above will be added to this list, and they
   // will not be removed until we have invoked their completion callbacks.
   size_t bytes_buffered_for_retry_ = 0;
+  // Bytes charged to the resource quota for the retry buffer.
+  size_t bytes_reserved_for_retry_ = 0;
   PendingBatch pending_batches_[MAX_PENDING_BATCHES];
   bool pending_send_initial_metadata_ : 1;
   bool pending_send_message_ : 1;
@@ -607,9 +693,13 @@ class RetryFilter::CallData {
   bool retry_timer_pending_ : 1;
   bool retry_codepath_started_ : 1;
   bool sent_transparent_retry_not_seen_by_server_ : 1;
+  bool hedging_timer_pending_ : 1;
   int num_attempts_completed_ = 0;
+  int num_attempts_started_ = 0;
   grpc_timer retry_timer_;
   grpc_closure retry_closure_;
+  grpc_timer hedging_timer_;
+  grpc_closure hedging_closure_;
 
   // Cached data for retrying send ops.
   // send_initial_metadata
@@ -699,10 +789,12 @@ class RetryFilter::CallData::CallStackDestructionBarrier
 //
 
 RetryFilter::CallData::CallAttempt::CallAttempt(CallData* calld,
-                                                bool is_transparent_retry)
+                                                bool is_transparent_retry,
+                                                bool is_hedge)
     : RefCounted(GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace) ? "CallAttempt"
                                                            : nullptr),
       calld_(calld),
+      is_hedge_(is_hedge),
       attempt_dispatch_controller_(this),
       batch_payload_(calld->call_context_),
       started_send_initial_metadata_(false),
@@ -754,10 +846,11 @@ RetryFilter::CallData::CallAttempt::~CallAttempt() {
 }
 
 void RetryFilter::CallData::CallAttempt::FreeCachedSendOpDataAfterCommit() {
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // With hedging, the cancelled attempts may still be using this data, so
+  // it is kept until the call is destroyed.
+  // TODO(roth): Do the same when abandoned retry attempts are still
+  // using the data, or ref-count it.
+  if (calld_->hedging()) return;
   if (completed_send_initial_metadata_) {
     calld_->FreeCachedSendInitialMetadata();
   }
@@ -797,12 +890,11 @@ bool RetryFilter::CallData::CallAttempt::HaveSendOpsToReplay() {
 }
 
 void RetryFilter::CallData::CallAttempt::MaybeSwitchToFastPath() {
-  // If we're not yet committed, we can't switch yet.
-  // TODO(roth): As part of implementing hedging, this logic needs to
-  // check that *this* call attempt is the one that we've committed to.
-  // Might need to replace abandoned_ with an enum indicating whether we're
-  // in flight, abandoned, or the winning call attempt.
-  if (!calld_->retry_committed_) return;
+  // If we're not yet committed, or we committed to another attempt, we
+  // can't switch yet.
+  if (!calld_->retry_committed_ || calld_->call_attempt_.get() != this) {
+    return;
+  }
   // If we've already switched to fast path, there's nothing to do here.
   if (calld_->committed_call_ != nullptr) return;
   // If the perAttemptRecvTimeout timer is pending, we can't switch yet.
@@ -1073,7 +1165,8 @@ void RetryFilter::CallData::CallAttempt::AddBatchesForPendingBatches(
     }
     // recv_message.
     if (batch->recv_message) {
-      batch_data->AddRetriableRecvMessageOp();
+      batch_data->AddRetriableRecvMessageOp(
+          batch->payload->recv_message.allow_partial);
     }
     // recv_trailing_metadata.
     if (batch->recv_trailing_metadata && !started_recv_trailing_metadata_) {
@@ -1117,6 +1210,21 @@ void RetryFilter::CallData::CallAttempt::StartRetriableBatches() {
   closures.RunClosures(calld_->call_combiner_);
 }
 
+void RetryFilter::CallData::CallAttempt::CancelLosingHedge(
+    CallCombinerClosureList* closures) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p attempt=%p: cancelling losing hedged attempt",
+            calld_->chand_, calld_, this);
+  }
+  MaybeCancelPerAttemptRecvTimer();
+  MaybeAddBatchForCancelOp(
+      grpc_error_set_int(GRPC_ERROR_CREATE("hedged call attempt lost"),
+                         StatusIntProperty::kRpcStatus, GRPC_STATUS_CANCELLED),
+      closures);
+  Abandon();
+}
+
 void RetryFilter::CallData::CallAttempt::CancelFromSurface(
     grpc_transport_stream_op_batch* cancel_batch) {
   MaybeCancelPerAttemptRecvTimer();
@@ -1178,14 +1286,23 @@ bool RetryFilter::CallData::CallAttempt::ShouldRetry(
     }
     return false;
   }
-  // Check whether we have retries remaining.
+  // Check whether we have retries remaining.  With hedging, what matters
+  // is whether another attempt is in flight or may still be started.
   ++calld_->num_attempts_completed_;
-  if (calld_->num_attempts_completed_ >=
-      calld_->retry_policy_->max_attempts()) {
+  const int max_attempts = calld_->retry_policy_->max_attempts();
+  bool attempts_exhausted;
+  if (calld_->hedging()) {
+    attempts_exhausted = calld_->num_attempts_started_ >= max_attempts &&
+                         calld_->call_attempt_.get() == this &&
+                         calld_->hedged_attempts_.empty();
+  } else {
+    attempts_exhausted = calld_->num_attempts_completed_ >= max_attempts;
+  }
+  if (attempts_exhausted) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
-      gpr_log(
-          GPR_INFO, "chand=%p calld=%p attempt=%p: exceeded %d retry attempts",
-          calld_->chand_, calld_, this, calld_->retry_policy_->max_attempts());
+      gpr_log(GPR_INFO,
+              "chand=%p calld=%p attempt=%p: exceeded %d retry attempts",
+              calld_->chand_, calld_, this, max_attempts);
     }
     return false;
   }
@@ -1361,10 +1478,11 @@ RetryFilter::CallData::CallAttempt::BatchData::~BatchData() {
 void RetryFilter::CallData::CallAttempt::BatchData::
     FreeCachedSendOpDataForCompletedBatch() {
   auto* calld = call_attempt_->calld_;
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // With hedging, the cancelled attempts may still be using this data, so
+  // it is kept until the call is destroyed.
+  // TODO(roth): Do the same when abandoned retry attempts are still
+  // using the data, or ref-count it.
+  if (calld->hedging()) return;
   if (batch_.send_initial_metadata) {
     calld->FreeCachedSendInitialMetadata();
   }
@@ -1740,6 +1858,11 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
       batch_data->batch_.payload->recv_trailing_metadata.recv_trailing_metadata;
   GetCallStatus(calld->deadline_, md_batch, error, &status, &server_pushback,
                 &is_lb_drop, &stream_network_state);
+  if (calld->chand_->adaptive_throttle_data_ != nullptr && !is_lb_drop &&
+      status != GRPC_STATUS_UNAVAILABLE &&
+      status != GRPC_STATUS_RESOURCE_EXHAUSTED) {
+    calld->chand_->adaptive_throttle_data_->RecordAccepted();
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
     gpr_log(GPR_INFO,
             "chand=%p calld=%p attempt=%p: call finished, status=%s "
@@ -1784,10 +1907,19 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
                            StatusIntProperty::kRpcStatus, GRPC_STATUS_CANCELLED)
                      : error,
           &closures);
+      // With hedging, if other attempts are still in flight, we just
+      // wait for them.
       // For transparent retries, add a closure to immediately start a new
       // call attempt.
       // For configurable retries, start retry timer.
-      if (retry == kTransparentRetry) {
+      if (calld->RemoveHedgedAttempt(call_attempt)) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+          gpr_log(GPR_INFO,
+                  "chand=%p calld=%p attempt=%p: hedged attempt failed; "
+                  "other attempts still in flight",
+                  calld->chand_, calld, call_attempt);
+        }
+      } else if (retry == kTransparentRetry) {
         calld->AddClosureToStartTransparentRetry(&closures);
       } else {
         calld->StartRetryTimer(server_pushback);
@@ -1830,6 +1962,15 @@ void RetryFilter::CallData::CallAttempt::BatchData::
   if (pending == nullptr) {
     return;
   }
+  // A send_message op completes the pending batch only if it is the message
+  // that the batch carries.  Otherwise, this attempt was still catching up,
+  // as hedged attempts do while another attempt is ahead of them.
+  if (batch_.send_message &&
+      (!pending->send_ops_cached ||
+       call_attempt_->completed_send_message_count_ !=
+           calld->send_messages_.size())) {
+    return;
+  }
   // Propagate payload.
   if (batch_.send_message) {
     pending->batch->payload->send_message.stream_write_closed =
@@ -2040,13 +2181,15 @@ void RetryFilter::CallData::CallAttempt::BatchData::
       &call_attempt_->recv_initial_metadata_ready_;
 }
 
-void RetryFilter::CallData::CallAttempt::BatchData::
-    AddRetriableRecvMessageOp() {
+void RetryFilter::CallData::CallAttempt::BatchData::AddRetriableRecvMessageOp(
+    bool allow_partial) {
   ++call_attempt_->started_recv_message_count_;
   batch_.recv_message = true;
   batch_.payload->recv_message.recv_message = &call_attempt_->recv_message_;
   batch_.payload->recv_message.flags = &call_attempt_->recv_message_flags_;
   batch_.payload->recv_message.call_failed_before_recv_message = nullptr;
+  // A partial message commits the call like a whole one does.
+  batch_.payload->recv_message.allow_partial = allow_partial;
   GRPC_CLOSURE_INIT(&call_attempt_->recv_message_ready_, RecvMessageReady, this,
                     grpc_schedule_on_exec_ctx);
   batch_.payload->recv_message.recv_message_ready =
@@ -2137,7 +2280,7 @@ const RetryMethodConfig* RetryFilter::GetRetryPolicy(
 RetryFilter::CallData::CallData(RetryFilter* chand,
                                 const grpc_call_element_args& args)
     : chand_(chand),
-      retry_throttle_data_(chand->retry_throttle_data_),
+      retry_throttle_data_(chand->retry_throttle_data_.get()),
       retry_policy_(chand->GetRetryPolicy(args.context)),
       retry_backoff_(
           BackOff::Options()
@@ -2165,9 +2308,11 @@ RetryFilter::CallData::CallData(RetryFilter* chand,
       retry_committed_(false),
       retry_timer_pending_(false),
       retry_codepath_started_(false),
-      sent_transparent_retry_not_seen_by_server_(false) {}
+      sent_transparent_retry_not_seen_by_server_(false),
+      hedging_timer_pending_(false) {}
 
 RetryFilter::CallData::~CallData() {
+  ReleaseRetryBufferReservation();
   FreeAllCachedSendOpData();
   CSliceUnref(path_);
   // Make sure there are no remaining pending batches.
@@ -2209,19 +2354,15 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     PendingBatchesFail(cancelled_from_surface_);
     // If we have a current call attempt, commit the call, then send
     // the cancellation down to that attempt.  When the call fails, it
-    // will not be retried, because we have committed it here.
+    // will not be retried, because we have committed it here.  Committing
+    // also cancels any other hedged attempts.
     if (call_attempt_ != nullptr) {
       RetryCommit(call_attempt_.get());
-      // TODO(roth): When implementing hedging, this will get more
-      // complex, because instead of just passing the batch down to a
-      // single call attempt, we'll need to cancel multiple call
-      // attempts and wait for the cancellation on_complete from each call
-      // attempt before we propagate the on_complete from this batch
-      // back to the surface.
       // Note: This will release the call combiner.
       call_attempt_->CancelFromSurface(batch);
       return;
     }
+    MaybeCancelHedgingTimer();
     // Cancel retry timer if needed.
     if (retry_timer_pending_) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
@@ -2239,6 +2380,22 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
         batch, cancelled_from_surface_, call_combiner_);
     return;
   }
+  // Check client-side adaptive throttling when the call starts.
+  if (batch->send_initial_metadata &&
+      chand_->adaptive_throttle_data_ != nullptr &&
+      chand_->adaptive_throttle_data_->ShouldReject()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: call throttled", chand_, this);
+    }
+    // Fail this batch and, like a cancellation, any later ones.
+    cancelled_from_surface_ = grpc_error_set_int(
+        GRPC_ERROR_CREATE("Call throttled by client-side adaptive throttling"),
+        StatusIntProperty::kRpcStatus, GRPC_STATUS_UNAVAILABLE);
+    // Note: This will release the call combiner.
+    grpc_transport_stream_op_batch_finish_with_failure(
+        batch, cancelled_from_surface_, call_combiner_);
+    return;
+  }
   // Add the batch to the pending list.
   PendingBatch* pending = PendingBatchesAdd(batch);
   // If the timer is pending, yield the call combiner and wait for it to
@@ -2300,7 +2457,22 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     gpr_log(GPR_INFO, "chand=%p calld=%p: starting batch on attempt=%p", chand_,
             this, call_attempt_.get());
   }
-  call_attempt_->StartRetriableBatches();
+  StartRetriableBatches();
+}
+
+void RetryFilter::CallData::StartRetriableBatches() {
+  if (hedged_attempts_.empty()) {
+    call_attempt_->StartRetriableBatches();
+    return;
+  }
+  // Start the batches on all attempts at once, since running the closures
+  // yields the call combiner.
+  CallCombinerClosureList closures;
+  for (auto& call_attempt : hedged_attempts_) {
+    call_attempt->AddRetriableBatches(&closures);
+  }
+  call_attempt_->AddRetriableBatches(&closures);
+  closures.RunClosures(call_combiner_);
 }
 
 OrphanablePtr<ClientChannel::LoadBalancedCall>
@@ -2319,7 +2491,35 @@ RetryFilter::CallData::CreateLoadBalancedCall(
 }
 
 void RetryFilter::CallData::CreateCallAttempt(bool is_transparent_retry) {
-  call_attempt_ = MakeRefCounted<CallAttempt>(this, is_transparent_retry);
+  call_attempt_ = MakeRefCounted<CallAttempt>(this, is_transparent_retry,
+                                              /*is_hedge=*/false);
+  if (!is_transparent_retry) ++num_attempts_started_;
+  MaybeStartHedgingTimer();
+  call_attempt_->StartRetriableBatches();
+}
+
+void RetryFilter::CallData::StartHedgedAttempt() {
+  // Hedged attempts share the retry throttle.  The failures themselves are
+  // recorded when attempts finish.
+  if (retry_throttle_data_ != nullptr &&
+      !retry_throttle_data_->RetriesAllowed()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: hedged attempts throttled", chand_,
+              this);
+    }
+    GRPC_CALL_COMBINER_STOP(call_combiner_, "hedged attempt throttled");
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO, "chand=%p calld=%p: starting hedged attempt %d", chand_,
+            this, num_attempts_started_ + 1);
+  }
+  global_stats().IncrementRetryHedgedAttempts();
+  hedged_attempts_.push_back(std::move(call_attempt_));
+  call_attempt_ = MakeRefCounted<CallAttempt>(
+      this, /*is_transparent_retry=*/false, /*is_hedge=*/true);
+  ++num_attempts_started_;
+  MaybeStartHedgingTimer();
   call_attempt_->StartRetriableBatches();
 }
 
@@ -2425,34 +2625,59 @@ RetryFilter::CallData::PendingBatch* RetryFilter::CallData::PendingBatchesAdd(
   // Also check if the batch takes us over the retry buffer limit.
   // Note: We don't check the size of trailing metadata here, because
   // gRPC clients do not send trailing metadata.
+  size_t bytes = 0;
   if (batch->send_initial_metadata) {
     pending_send_initial_metadata_ = true;
-    bytes_buffered_for_retry_ += batch->payload->send_initial_metadata
-                                     .send_initial_metadata->TransportSize();
+    bytes += batch->payload->send_initial_metadata.send_initial_metadata
+                 ->TransportSize();
   }
   if (batch->send_message) {
     pending_send_message_ = true;
-    bytes_buffered_for_retry_ +=
-        batch->payload->send_message.send_message->Length();
+    bytes += batch->payload->send_message.send_message->Length();
   }
   if (batch->send_trailing_metadata) {
     pending_send_trailing_metadata_ = true;
   }
-  // TODO(roth): When we implement hedging, if there are currently attempts
-  // in flight, we will need to pick the one on which the max number of send
-  // ops have already been sent, and we commit to that attempt.
-  if (GPR_UNLIKELY(bytes_buffered_for_retry_ >
-                   chand_->per_rpc_retry_buffer_size_)) {
+  if (GPR_UNLIKELY(ExceedsRetryBufferLimit(bytes))) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
       gpr_log(GPR_INFO,
               "chand=%p calld=%p: exceeded retry buffer size, committing",
               chand_, this);
     }
-    RetryCommit(call_attempt_.get());
+    // If hedged attempts are in flight, commit to the one that has sent
+    // the most messages.
+    CallAttempt* call_attempt = call_attempt_.get();
+    for (auto& hedged_attempt : hedged_attempts_) {
+      if (hedged_attempt->started_send_message_count() >
+          call_attempt->started_send_message_count()) {
+        call_attempt = hedged_attempt.get();
+      }
+    }
+    RetryCommit(call_attempt);
   }
   return pending;
 }
 
+bool RetryFilter::CallData::ExceedsRetryBufferLimit(size_t bytes) {
+  bytes_buffered_for_retry_ += bytes;
+  if (chand_->memory_quota_ == nullptr) {
+    return bytes_buffered_for_retry_ > chand_->per_rpc_retry_buffer_size_;
+  }
+  // Once committed, nothing more is buffered for retries.
+  if (retry_committed_) return false;
+  if (bytes > 0) {
+    chand_->retry_buffer_allocator_.Reserve(MemoryRequest(bytes));
+    bytes_reserved_for_retry_ += bytes;
+  }
+  return chand_->memory_quota_->IsMemoryPressureHigh();
+}
+
+void RetryFilter::CallData::ReleaseRetryBufferReservation() {
+  if (bytes_reserved_for_retry_ == 0) return;
+  chand_->retry_buffer_allocator_.Release(
+      std::exchange(bytes_reserved_for_retry_, 0));
+}
+
 void RetryFilter::CallData::PendingBatchClear(PendingBatch* pending) {
   if (pending->batch->send_initial_metadata) {
     pending_send_initial_metadata_ = false;
@@ -2555,7 +2780,12 @@ void RetryFilter::CallData::RetryCommit(CallAttempt* call_attempt) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
     gpr_log(GPR_INFO, "chand=%p calld=%p: committing retries", chand_, this);
   }
+  MaybeCancelHedgingTimer();
+  // The retry buffer stops growing here, and its cached data is freed as
+  // the committed attempt completes its send ops.
+  ReleaseRetryBufferReservation();
   if (call_attempt != nullptr) {
+    if (hedging()) CommitToHedgedAttempt(call_attempt);
     // If the call attempt's LB call has been committed, inform the call
     // dispatch controller that the call has been committed.
     // Note: If call_attempt is null, this is happening before the first
@@ -2573,6 +2803,102 @@ void RetryFilter::CallData::RetryCommit(CallAttempt* call_attempt) {
   }
 }
 
+void RetryFilter::CallData::CommitToHedgedAttempt(CallAttempt* call_attempt) {
+  if (call_attempt->is_hedge()) {
+    global_stats().IncrementRetryHedgedAttemptsWon();
+  }
+  if (hedged_attempts_.empty()) return;
+  if (call_attempt_.get() != call_attempt) {
+    for (auto& hedged_attempt : hedged_attempts_) {
+      if (hedged_attempt.get() == call_attempt) {
+        std::swap(hedged_attempt, call_attempt_);
+        break;
+      }
+    }
+    GPR_ASSERT(call_attempt_.get() == call_attempt);
+  }
+  CallCombinerClosureList closures;
+  for (auto& hedged_attempt : hedged_attempts_) {
+    hedged_attempt->CancelLosingHedge(&closures);
+  }
+  hedged_attempts_.clear();
+  closures.RunClosuresWithoutYielding(call_combiner_);
+}
+
+bool RetryFilter::CallData::RemoveHedgedAttempt(CallAttempt* call_attempt) {
+  if (hedged_attempts_.empty()) return false;
+  if (call_attempt_.get() == call_attempt) {
+    call_attempt_ = std::move(hedged_attempts_.back());
+    hedged_attempts_.pop_back();
+    return true;
+  }
+  for (auto it = hedged_attempts_.begin(); it != hedged_attempts_.end(); ++it) {
+    if (it->get() == call_attempt) {
+      hedged_attempts_.erase(it);
+      break;
+    }
+  }
+  return true;
+}
+
+void RetryFilter::CallData::MaybeStartHedgingTimer() {
+  if (!hedging() || retry_committed_ || hedging_timer_pending_ ||
+      num_attempts_started_ >= retry_policy_->max_attempts()) {
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: next hedged attempt in %" PRId64 " ms",
+            chand_, this, retry_policy_->hedging_delay()->millis());
+  }
+  GRPC_CLOSURE_INIT(&hedging_closure_, OnHedgingTimer, this, nullptr);
+  GRPC_CALL_STACK_REF(owning_call_, "OnHedgingTimer");
+  hedging_timer_pending_ = true;
+  grpc_timer_init(&hedging_timer_,
+                  Timestamp::Now() + *retry_policy_->hedging_delay(),
+                  &hedging_closure_);
+}
+
+void RetryFilter::CallData::MaybeCancelHedgingTimer() {
+  if (hedging_timer_pending_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: cancelling hedging timer", chand_,
+              this);
+    }
+    hedging_timer_pending_ = false;  // Lame timer callback.
+    grpc_timer_cancel(&hedging_timer_);
+  }
+}
+
+void RetryFilter::CallData::OnHedgingTimer(void* arg,
+                                           grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  GRPC_CLOSURE_INIT(&calld->hedging_closure_, OnHedgingTimerLocked, calld,
+                    nullptr);
+  GRPC_CALL_COMBINER_START(calld->call_combiner_, &calld->hedging_closure_,
+                           error, "hedging timer fired");
+}
+
+void RetryFilter::CallData::OnHedgingTimerLocked(void* arg,
+                                                 grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  if (error.ok() && calld->hedging_timer_pending_) {
+    calld->hedging_timer_pending_ = false;
+    // If no attempt is in flight, a retry is already scheduled, and that
+    // attempt will restart the hedging timer.
+    if (calld->call_attempt_ != nullptr &&
+        !calld->call_attempt_->abandoned()) {
+      calld->StartHedgedAttempt();
+    } else {
+      GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                              "hedging timer fired with no attempt in flight");
+    }
+  } else {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner_, "hedging timer cancelled");
+  }
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnHedgingTimer");
+}
+
 void RetryFilter::CallData::StartRetryTimer(
     absl::optional<Duration> server_pushback) {
   // Reset call attempt.
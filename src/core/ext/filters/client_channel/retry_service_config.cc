@@ -161,6 +161,31 @@ RetryServiceConfigParser::ParseGlobalParams(const ChannelArgs& /*args*/,
 
 namespace {
 
+void ParseMaxAttempts(const Json& json, const char* policy_name,
+                      int* max_attempts,
+                      std::vector<grpc_error_handle>* error_list) {
+  auto it = json.object_value().find("maxAttempts");
+  if (it == json.object_value().end()) {
+    error_list->push_back(
+        GRPC_ERROR_CREATE("field:maxAttempts error:required field missing"));
+    return;
+  }
+  if (it->second.type() != Json::Type::NUMBER) {
+    error_list->push_back(
+        GRPC_ERROR_CREATE("field:maxAttempts error:should be of type number"));
+    return;
+  }
+  *max_attempts = gpr_parse_nonnegative_int(it->second.string_value().c_str());
+  if (*max_attempts <= 1) {
+    error_list->push_back(
+        GRPC_ERROR_CREATE("field:maxAttempts error:should be at least 2"));
+  } else if (*max_attempts > MAX_MAX_RETRY_ATTEMPTS) {
+    gpr_log(GPR_ERROR, "service config: clamped %s.maxAttempts at %d",
+            policy_name, MAX_MAX_RETRY_ATTEMPTS);
+    *max_attempts = MAX_MAX_RETRY_ATTEMPTS;
+  }
+}
+
 grpc_error_handle ParseRetryPolicy(
     const ChannelArgs& args, const Json& json, int* max_attempts,
     Duration* initial_backoff, Duration* max_backoff, float* backoff_multiplier,
@@ -172,28 +197,7 @@ grpc_error_handle ParseRetryPolicy(
   }
   std::vector<grpc_error_handle> error_list;
   // Parse maxAttempts.
-  auto it = json.object_value().find("maxAttempts");
-  if (it == json.object_value().end()) {
-    error_list.push_back(
-        GRPC_ERROR_CREATE("field:maxAttempts error:required field missing"));
-  } else {
-    if (it->second.type() != Json::Type::NUMBER) {
-      error_list.push_back(GRPC_ERROR_CREATE(
-          "field:maxAttempts error:should be of type number"));
-    } else {
-      *max_attempts =
-          gpr_parse_nonnegative_int(it->second.string_value().c_str());
-      if (*max_attempts <= 1) {
-        error_list.push_back(
-            GRPC_ERROR_CREATE("field:maxAttempts error:should be at least 2"));
-      } else if (*max_attempts > MAX_MAX_RETRY_ATTEMPTS) {
-        gpr_log(GPR_ERROR,
-                "service config: clamped retryPolicy.maxAttempts at %d",
-                MAX_MAX_RETRY_ATTEMPTS);
-        *max_attempts = MAX_MAX_RETRY_ATTEMPTS;
-      }
-    }
-  }
+  ParseMaxAttempts(json, "retryPolicy", max_attempts, &error_list);
   // Parse initialBackoff.
   if (ParseJsonObjectFieldAsDuration(json.object_value(), "initialBackoff",
                                      initial_backoff, &error_list) &&
@@ -209,7 +213,7 @@ grpc_error_handle ParseRetryPolicy(
         GRPC_ERROR_CREATE("field:maxBackoff error:must be greater than 0"));
   }
   // Parse backoffMultiplier.
-  it = json.object_value().find("backoffMultiplier");
+  auto it = json.object_value().find("backoffMultiplier");
   if (it == json.object_value().end()) {
     error_list.push_back(GRPC_ERROR_CREATE(
         "field:backoffMultiplier error:required field missing"));
@@ -289,13 +293,73 @@ grpc_error_handle ParseRetryPolicy(
   return GRPC_ERROR_CREATE_FROM_VECTOR("retryPolicy", &error_list);
 }
 
+grpc_error_handle ParseHedgingPolicy(const Json& json, int* max_attempts,
+                                     Duration* hedging_delay,
+                                     StatusCodeSet* non_fatal_status_codes) {
+  if (json.type() != Json::Type::OBJECT) {
+    return GRPC_ERROR_CREATE(
+        "field:hedgingPolicy error:should be of type object");
+  }
+  std::vector<grpc_error_handle> error_list;
+  // Parse maxAttempts.
+  ParseMaxAttempts(json, "hedgingPolicy", max_attempts, &error_list);
+  // Parse hedgingDelay.  If unset, all attempts are sent at once.
+  ParseJsonObjectFieldAsDuration(json.object_value(), "hedgingDelay",
+                                 hedging_delay, &error_list,
+                                 /*required=*/false);
+  // Parse nonFatalStatusCodes.
+  auto it = json.object_value().find("nonFatalStatusCodes");
+  if (it != json.object_value().end()) {
+    if (it->second.type() != Json::Type::ARRAY) {
+      error_list.push_back(GRPC_ERROR_CREATE(
+          "field:nonFatalStatusCodes error:must be of type array"));
+    } else {
+      for (const Json& element : it->second.array_value()) {
+        grpc_status_code status;
+        if (element.type() != Json::Type::STRING ||
+            !grpc_status_code_from_string(element.string_value().c_str(),
+                                          &status)) {
+          error_list.push_back(GRPC_ERROR_CREATE(
+              "field:nonFatalStatusCodes error:failed to parse status code"));
+          continue;
+        }
+        non_fatal_status_codes->Add(status);
+      }
+    }
+  }
+  return GRPC_ERROR_CREATE_FROM_VECTOR("hedgingPolicy", &error_list);
+}
+
 }  // namespace
 
 absl::StatusOr<std::unique_ptr<ServiceConfigParser::ParsedConfig>>
 RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
                                                const Json& json) {
+  // Parse hedging policy, if hedging is enabled.
+  auto it = json.object_value().find("hedgingPolicy");
+  if (it != json.object_value().end() &&
+      args.GetBool(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING).value_or(false)) {
+    if (json.object_value().find("retryPolicy") !=
+        json.object_value().end()) {
+      return absl::InvalidArgumentError(
+          "error parsing retry method parameters: retryPolicy and "
+          "hedgingPolicy are mutually exclusive");
+    }
+    int max_attempts = 0;
+    Duration hedging_delay;
+    StatusCodeSet non_fatal_status_codes;
+    grpc_error_handle error = ParseHedgingPolicy(
+        it->second, &max_attempts, &hedging_delay, &non_fatal_status_codes);
+    if (!error.ok()) {
+      absl::Status status = absl::InvalidArgumentError(absl::StrCat(
+          "error parsing retry method parameters: ", StatusToString(error)));
+      return status;
+    }
+    return std::make_unique<RetryMethodConfig>(max_attempts, hedging_delay,
+                                               non_fatal_status_codes);
+  }
   // Parse retry policy.
-  auto it = json.object_value().find("retryPolicy");
+  it = json.object_value().find("retryPolicy");
   if (it == json.object_value().end()) return nullptr;
   int max_attempts = 0;
   Duration initial_backoff;
@@ -20,12 +20,17 @@
 
 #include "src/core/ext/filters/client_channel/retry_throttle.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <utility>
 
+#include "absl/random/random.h"
+
 #include <grpc/support/atm.h>
 
+#include "src/core/lib/gprpp/time.h"
+
 namespace grpc_core {
 namespace internal {
 
@@ -96,6 +101,16 @@ bool ServerRetryThrottleData::RecordFailure() {
   return new_value > throttle_data->max_milli_tokens_ / 2;
 }
 
+bool ServerRetryThrottleData::RetriesAllowed() {
+  // First, check if we are stale and need to be replaced.
+  ServerRetryThrottleData* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  // Use the same threshold as RecordFailure().
+  return static_cast<intptr_t>(
+             gpr_atm_no_barrier_load(&throttle_data->milli_tokens_)) >
+         throttle_data->max_milli_tokens_ / 2;
+}
+
 void ServerRetryThrottleData::RecordSuccess() {
   // First, check if we are stale and need to be replaced.
   ServerRetryThrottleData* throttle_data = this;
@@ -108,6 +123,52 @@ void ServerRetryThrottleData::RecordSuccess() {
       static_cast<gpr_atm>(throttle_data->max_milli_tokens_));
 }
 
+//
+// AdaptiveThrottleData
+//
+
+AdaptiveThrottleData::Bucket* AdaptiveThrottleData::CurrentBucket(
+    int64_t epoch) {
+  Bucket* bucket = &buckets_[epoch % kNumBuckets];
+  int64_t seen = bucket->epoch.load(std::memory_order_acquire);
+  if (seen != epoch &&
+      bucket->epoch.compare_exchange_strong(seen, epoch,
+                                            std::memory_order_acq_rel)) {
+    // Counts added by other threads between the exchange and the reset are
+    // lost, which does not matter for an estimate.
+    bucket->requests.store(0, std::memory_order_relaxed);
+    bucket->accepts.store(0, std::memory_order_relaxed);
+  }
+  return bucket;
+}
+
+bool AdaptiveThrottleData::ShouldReject() {
+  const int64_t epoch =
+      Timestamp::Now().milliseconds_after_process_epoch() / kBucketMillis;
+  int64_t requests = 0;
+  int64_t accepts = 0;
+  for (Bucket& bucket : buckets_) {
+    if (bucket.epoch.load(std::memory_order_acquire) > epoch - kNumBuckets) {
+      requests += bucket.requests.load(std::memory_order_relaxed);
+      accepts += bucket.accepts.load(std::memory_order_relaxed);
+    }
+  }
+  // Rejected calls count as requests too, so that the client keeps
+  // probing the server while it is rejecting calls.
+  CurrentBucket(epoch)->requests.fetch_add(1, std::memory_order_relaxed);
+  const double reject_probability = std::max(
+      0.0, (requests - k_ * accepts) / static_cast<double>(requests + 1));
+  if (reject_probability <= 0) return false;
+  thread_local absl::InsecureBitGen bit_gen;
+  return absl::Uniform(bit_gen, 0.0, 1.0) < reject_probability;
+}
+
+void AdaptiveThrottleData::RecordAccepted() {
+  const int64_t epoch =
+      Timestamp::Now().milliseconds_after_process_epoch() / kBucketMillis;
+  CurrentBucket(epoch)->accepts.fetch_add(1, std::memory_order_relaxed);
+}
+
 //
 // ServerRetryThrottleMap
 //
@@ -137,5 +198,16 @@ RefCountedPtr<ServerRetryThrottleData> ServerRetryThrottleMap::GetDataForServer(
   return throttle_data->Ref();
 }
 
+RefCountedPtr<AdaptiveThrottleData>
+ServerRetryThrottleMap::GetAdaptiveThrottleForServer(
+    const std::string& server_name, double k) {
+  MutexLock lock(&mu_);
+  RefCountedPtr<AdaptiveThrottleData>& data = adaptive_map_[server_name];
+  if (data == nullptr || data->k() != k) {
+    data = MakeRefCounted<AdaptiveThrottleData>(k);
+  }
+  return data;
+}
+
 }  // namespace internal
 }  // namespace grpc_core
@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 #include <string>
 
@@ -50,6 +51,10 @@ class ServerRetryThrottleData : public RefCounted<ServerRetryThrottleData> {
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if retries are not currently throttled, without recording
+  /// anything.  Used before sending hedged attempts.
+  bool RetriesAllowed();
+
   intptr_t max_milli_tokens() const { return max_milli_tokens_; }
   intptr_t milli_token_ratio() const { return milli_token_ratio_; }
 
@@ -66,6 +71,42 @@ class ServerRetryThrottleData : public RefCounted<ServerRetryThrottleData> {
   gpr_atm replacement_ = 0;
 };
 
+/// Client-side adaptive throttling for an individual server name: tracks
+/// how many calls the client made and how many of them the server accepted
+/// over the last two minutes, and rejects new calls locally with
+/// probability max(0, (requests - k * accepts) / (requests + 1)), so that
+/// once the server rejects most calls the client stops sending it most of
+/// them. Lock-free.
+class AdaptiveThrottleData : public RefCounted<AdaptiveThrottleData> {
+ public:
+  explicit AdaptiveThrottleData(double k) : k_(k) {}
+
+  /// Counts a new call.  Returns true if the call should be rejected
+  /// locally instead of being sent.
+  bool ShouldReject();
+
+  /// Records that the server accepted a call: it completed with a status
+  /// other than UNAVAILABLE or RESOURCE_EXHAUSTED.
+  void RecordAccepted();
+
+  double k() const { return k_; }
+
+ private:
+  static constexpr int kNumBuckets = 12;
+  static constexpr int64_t kBucketMillis = 10000;
+
+  struct Bucket {
+    std::atomic<int64_t> epoch{-1};
+    std::atomic<int64_t> requests{0};
+    std::atomic<int64_t> accepts{0};
+  };
+
+  Bucket* CurrentBucket(int64_t epoch);
+
+  const double k_;
+  Bucket buckets_[kNumBuckets];
+};
+
 /// Global map of server name to retry throttle data.
 class ServerRetryThrottleMap {
  public:
@@ -77,12 +118,19 @@ class ServerRetryThrottleMap {
       const std::string& server_name, intptr_t max_milli_tokens,
       intptr_t milli_token_ratio);
 
+  /// Returns the adaptive throttling data for \a server_name, creating a
+  /// new entry if needed or if \a k changed.
+  RefCountedPtr<AdaptiveThrottleData> GetAdaptiveThrottleForServer(
+      const std::string& server_name, double k);
+
  private:
   using StringToDataMap =
       std::map<std::string, RefCountedPtr<ServerRetryThrottleData>>;
 
   Mutex mu_;
   StringToDataMap map_ ABSL_GUARDED_BY(mu_);
+  std::map<std::string, RefCountedPtr<AdaptiveThrottleData>> adaptive_map_
+      ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace internal
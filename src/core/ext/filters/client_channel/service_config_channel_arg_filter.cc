@@ -57,8 +57,8 @@ class ServiceConfigChannelArgChannelData {
     const char* service_config_str = grpc_channel_args_find_string(
         args->channel_args, GRPC_ARG_SERVICE_CONFIG);
     if (service_config_str != nullptr) {
-      auto service_config = ServiceConfigImpl::Create(
-          ChannelArgs::FromC(args->channel_args), service_config_str);
+      auto service_config = ServiceConfigImpl::Create(*args->core_channel_args,
+                                                      service_config_str);
       if (!service_config.ok()) {
         gpr_log(GPR_ERROR, "%s", service_config.status().ToString().c_str());
       } else {
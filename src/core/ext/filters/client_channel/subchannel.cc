@@ -22,14 +22,20 @@
 #include <limits.h>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
 #include <memory>
 #include <new>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/status/statusor.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/variant.h"
 
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/slice.h>
@@ -59,9 +65,12 @@
 #include "src/core/lib/handshaker/proxy_mapper_registry.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/init_internally.h"
+#include "src/core/lib/transport/connection_rtt.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
 
@@ -93,14 +102,18 @@ DebugOnlyTraceFlag grpc_trace_subchannel_refcount(false, "subchannel_refcount");
 
 ConnectedSubchannel::ConnectedSubchannel(
     grpc_channel_stack* channel_stack, const ChannelArgs& args,
-    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel)
+    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+    RefCountedPtr<ConnectionRtt> rtt,
+    RefCountedPtr<grpc_auth_context> auth_context)
     : RefCounted<ConnectedSubchannel>(
           GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel_refcount)
               ? "ConnectedSubchannel"
               : nullptr),
       channel_stack_(channel_stack),
       args_(args),
-      channelz_subchannel_(std::move(channelz_subchannel)) {}
+      channelz_subchannel_(std::move(channelz_subchannel)),
+      rtt_(std::move(rtt)),
+      auth_context_(std::move(auth_context)) {}
 
 ConnectedSubchannel::~ConnectedSubchannel() {
   GRPC_CHANNEL_STACK_UNREF(channel_stack_, "connected_subchannel_dtor");
@@ -127,6 +140,20 @@ void ConnectedSubchannel::Ping(grpc_closure* on_initiate,
   elem->filter->start_transport_op(elem, op);
 }
 
+bool ConnectedSubchannel::CanCarryAuthority(
+    absl::string_view authority) const {
+  auto* security_connector = args_.GetObject<grpc_security_connector>();
+  if (security_connector == nullptr || auth_context_ == nullptr) return false;
+  // Channel security connectors check the call host synchronously, so the
+  // promise is resolved by its first poll; anything else counts as a "no".
+  auto check =
+      static_cast<grpc_channel_security_connector*>(security_connector)
+          ->CheckCallHost(authority, auth_context_.get());
+  Poll<absl::Status> result = check();
+  const absl::Status* status = absl::get_if<absl::Status>(&result);
+  return status != nullptr && status->ok();
+}
+
 size_t ConnectedSubchannel::GetInitialCallSizeEstimate() const {
   return GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(SubchannelCall)) +
          channel_stack_->call_stack_size;
@@ -148,6 +175,7 @@ RefCountedPtr<SubchannelCall> SubchannelCall::Create(Args args,
 SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(std::move(args.connected_subchannel)),
       deadline_(args.deadline) {
+  connected_subchannel_->active_calls_.fetch_add(1, std::memory_order_relaxed);
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,             /* call_stack */
@@ -217,6 +245,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  connected_subchannel->active_calls_.fetch_sub(1, std::memory_order_relaxed);
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -613,6 +642,52 @@ BackOff::Options ParseArgsForBackoffValues(const ChannelArgs& args,
       .set_max_backoff(max_backoff);
 }
 
+// Tracks which addresses have a coordinated connection attempt in flight,
+// and who is waiting for each of them to finish.
+class ConnectAttemptGate {
+ public:
+  using Waiter = std::function<void(const absl::Status&)>;
+
+  static ConnectAttemptGate* Get() {
+    static ConnectAttemptGate* gate = new ConnectAttemptGate();
+    return gate;
+  }
+
+  // Returns true if the caller may start an attempt to \a address, in which
+  // case it must call Finish() once it is done.  Otherwise, \a waiter will
+  // be called with the outcome of the attempt that is already in flight.
+  bool TryStart(const std::string& address, Waiter waiter) {
+    MutexLock lock(&mu_);
+    auto it = in_flight_.find(address);
+    if (it == in_flight_.end()) {
+      in_flight_.emplace(address, std::vector<Waiter>());
+      return true;
+    }
+    it->second.push_back(std::move(waiter));
+    return false;
+  }
+
+  void Finish(const std::string& address, const absl::Status& status) {
+    std::vector<Waiter> waiters;
+    {
+      MutexLock lock(&mu_);
+      auto it = in_flight_.find(address);
+      GPR_ASSERT(it != in_flight_.end());
+      waiters = std::move(it->second);
+      in_flight_.erase(it);
+    }
+    for (Waiter& waiter : waiters) waiter(status);
+  }
+
+ private:
+  Mutex mu_;
+  std::map<std::string, std::vector<Waiter>> in_flight_ ABSL_GUARDED_BY(mu_);
+};
+
+std::string ConnectAttemptKey(const grpc_resolved_address& address) {
+  return std::string(address.addr, address.len);
+}
+
 }  // namespace
 
 Subchannel::Subchannel(SubchannelKey key,
@@ -645,6 +720,8 @@ Subchannel::Subchannel(SubchannelKey key,
                              .proxy_mapper_registry()
                              .MapAddress(key_.address(), &args_)
                              .value_or(key_.address());
+  coordinate_reconnects_ =
+      args_.GetBool(GRPC_ARG_COORDINATE_RECONNECTS).value_or(false);
   // Initialize channelz.
   const bool channelz_enabled = args_.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
                                     .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
@@ -686,6 +763,16 @@ RefCountedPtr<Subchannel> Subchannel::Create(
   if (c != nullptr) {
     return c;
   }
+  if (args.GetBool(GRPC_ARG_HTTP2_CONNECTION_COALESCING).value_or(false)) {
+    c = subchannel_pool->FindCoalescableSubchannel(key);
+    if (c != nullptr) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+        gpr_log(GPR_INFO, "subchannel %p %s: coalescing %s onto it", c.get(),
+                c->key_.ToString().c_str(), key.ToString().c_str());
+      }
+      return c;
+    }
+  }
   c = MakeRefCounted<Subchannel>(std::move(key), std::move(connector), args);
   // Try to register the subchannel before setting the subchannel pool.
   // Otherwise, in case of a registration race, unreffing c in
@@ -870,16 +957,47 @@ void Subchannel::OnRetryTimerLocked() {
 
 void Subchannel::StartConnectingLocked() {
   // Set next attempt time.
-  const Timestamp min_deadline = min_connect_timeout_ + Timestamp::Now();
   next_attempt_time_ = backoff_.NextAttemptTime();
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
-  // Start connection attempt.
+  if (coordinate_reconnects_) {
+    // If another subchannel is already connecting to this address, wait
+    // for its outcome.  The waiter may be run under that subchannel's lock,
+    // so it hops onto the EventEngine before taking ours.
+    leads_connect_attempt_ = ConnectAttemptGate::Get()->TryStart(
+        ConnectAttemptKey(address_for_connect_),
+        [self = WeakRef(DEBUG_LOCATION, "SharedConnect")](
+            const absl::Status& status) mutable {
+          auto* event_engine = self->event_engine_.get();
+          event_engine->Run([self = std::move(self), status]() mutable {
+            ApplicationCallbackExecCtx callback_exec_ctx;
+            ExecCtx exec_ctx;
+            self->OnSharedConnectAttemptFinished(status);
+            self.reset();
+          });
+        });
+    if (!leads_connect_attempt_) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+        gpr_log(GPR_INFO,
+                "subchannel %p %s: waiting for another subchannel's "
+                "connection attempt",
+                this, key_.ToString().c_str());
+      }
+      return;
+    }
+  }
+  StartConnectAttemptLocked();
+}
+
+void Subchannel::StartConnectAttemptLocked() {
+  const Timestamp min_deadline = min_connect_timeout_ + Timestamp::Now();
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
   args.interested_parties = pollset_set_;
   args.deadline = std::max(next_attempt_time_, min_deadline);
-  args.channel_args = args_;
+  // Each connection attempt gets its own RTT estimate, which the transport
+  // fills in from its ping round trips.
+  args.channel_args = args_.SetObject(MakeRefCounted<ConnectionRtt>());
   WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
 }
@@ -894,41 +1012,69 @@ void Subchannel::OnConnectingFinished(void* arg, grpc_error_handle error) {
 }
 
 void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
+  const bool leads_connect_attempt = leads_connect_attempt_;
+  leads_connect_attempt_ = false;
   if (shutdown_) {
+    if (leads_connect_attempt) {
+      ConnectAttemptGate::Get()->Finish(
+          ConnectAttemptKey(address_for_connect_),
+          absl::UnavailableError("subchannel shut down"));
+    }
     return;
   }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
+  absl::Status status;
+  if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
+    status = grpc_error_to_absl_status(error);
+    if (status.ok()) status = absl::UnavailableError("connect failed");
+    OnConnectAttemptFailedLocked(status);
+  }
+  if (leads_connect_attempt) {
+    ConnectAttemptGate::Get()->Finish(ConnectAttemptKey(address_for_connect_),
+                                      status);
+  }
+}
+
+void Subchannel::OnSharedConnectAttemptFinished(const absl::Status& status) {
+  MutexLock lock(&mu_);
+  if (shutdown_ || state_ != GRPC_CHANNEL_CONNECTING) return;
+  if (status.ok()) {
+    // The address is reachable again, so connect right away.
+    StartConnectAttemptLocked();
+  } else {
+    OnConnectAttemptFailedLocked(status);
+  }
+}
+
+void Subchannel::OnConnectAttemptFailedLocked(const absl::Status& status) {
   // Note that if the connection attempt took longer than the backoff
   // time, then the timer will fire immediately, and we will quickly
   // transition back to IDLE.
-  if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
-    const Duration time_until_next_attempt =
-        next_attempt_time_ - Timestamp::Now();
-    gpr_log(GPR_INFO,
-            "subchannel %p %s: connect failed (%s), backing off for %" PRId64
-            " ms",
-            this, key_.ToString().c_str(), StatusToString(error).c_str(),
-            time_until_next_attempt.millis());
-    SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE,
-                               grpc_error_to_absl_status(error));
-    retry_timer_handle_ = event_engine_->RunAfter(
-        time_until_next_attempt,
-        [self = WeakRef(DEBUG_LOCATION, "RetryTimer")]() mutable {
-          {
-            ApplicationCallbackExecCtx callback_exec_ctx;
-            ExecCtx exec_ctx;
-            self->OnRetryTimer();
-            // Subchannel deletion might require an active ExecCtx. So if
-            // self.reset() is not called here, the WeakRefCountedPtr destructor
-            // may run after the ExecCtx declared in the callback is destroyed.
-            // Since subchannel may get destroyed when the WeakRefCountedPtr
-            // destructor runs, it may not have an active ExecCtx - thus leading
-            // to crashes.
-            self.reset();
-          }
-        });
-  }
+  const Duration time_until_next_attempt =
+      next_attempt_time_ - Timestamp::Now();
+  gpr_log(GPR_INFO,
+          "subchannel %p %s: connect failed (%s), backing off for %" PRId64
+          " ms",
+          this, key_.ToString().c_str(), status.ToString().c_str(),
+          time_until_next_attempt.millis());
+  SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE, status);
+  retry_timer_handle_ = event_engine_->RunAfter(
+      time_until_next_attempt,
+      [self = WeakRef(DEBUG_LOCATION, "RetryTimer")]() mutable {
+        {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          self->OnRetryTimer();
+          // Subchannel deletion might require an active ExecCtx. So if
+          // self.reset() is not called here, the WeakRefCountedPtr destructor
+          // may run after the ExecCtx declared in the callback is destroyed.
+          // Since subchannel may get destroyed when the WeakRefCountedPtr
+          // destructor runs, it may not have an active ExecCtx - thus leading
+          // to crashes.
+          self.reset();
+        }
+      });
 }
 
 bool Subchannel::PublishTransportLocked() {
@@ -950,11 +1096,16 @@ bool Subchannel::PublishTransportLocked() {
   }
   RefCountedPtr<channelz::SocketNode> socket =
       std::move(connecting_result_.socket_node);
+  RefCountedPtr<ConnectionRtt> rtt =
+      connecting_result_.channel_args.GetObjectRef<ConnectionRtt>();
+  RefCountedPtr<grpc_auth_context> auth_context =
+      connecting_result_.channel_args.GetObjectRef<grpc_auth_context>();
   connecting_result_.Reset();
   if (shutdown_) return false;
   // Publish.
   connected_subchannel_.reset(
-      new ConnectedSubchannel(stk->release(), args_, channelz_node_));
+      new ConnectedSubchannel(stk->release(), args_, channelz_node_,
+                              std::move(rtt), std::move(auth_context)));
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
     gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
             key_.ToString().c_str(), connected_subchannel_.get());
@@ -21,6 +21,7 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <map>
@@ -29,6 +30,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include <grpc/event_engine/event_engine.h>
@@ -57,7 +59,9 @@
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/security/context/security_context.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/connection_rtt.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
@@ -70,7 +74,9 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
  public:
   ConnectedSubchannel(
       grpc_channel_stack* channel_stack, const ChannelArgs& args,
-      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel);
+      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+      RefCountedPtr<ConnectionRtt> rtt,
+      RefCountedPtr<grpc_auth_context> auth_context);
   ~ConnectedSubchannel() override;
 
   void StartWatch(grpc_pollset_set* interested_parties,
@@ -83,15 +89,33 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   channelz::SubchannelNode* channelz_subchannel() const {
     return channelz_subchannel_.get();
   }
+  // The RTT estimate fed by the transport, or null if it does not measure
+  // one.
+  ConnectionRtt* rtt() const { return rtt_.get(); }
+
+  // Returns true if the peer of this connection was authenticated for
+  // \a authority as well, so that calls for it may be sent here.
+  bool CanCarryAuthority(absl::string_view authority) const;
 
   size_t GetInitialCallSizeEstimate() const;
 
+  // Returns the number of SubchannelCalls currently using this connection.
+  size_t active_calls() const {
+    return active_calls_.load(std::memory_order_relaxed);
+  }
+
  private:
+  friend class SubchannelCall;
+
   grpc_channel_stack* channel_stack_;
   ChannelArgs args_;
   // ref counted pointer to the channelz node in this connected subchannel's
   // owning subchannel.
   RefCountedPtr<channelz::SubchannelNode> channelz_subchannel_;
+  RefCountedPtr<ConnectionRtt> rtt_;
+  // The auth context established by the handshake, or null.
+  RefCountedPtr<grpc_auth_context> auth_context_;
+  std::atomic<size_t> active_calls_{0};
 };
 
 // Implements the interface of RefCounted<>.
@@ -366,6 +390,13 @@ class Subchannel : public DualRefCounted<Subchannel> {
   void OnRetryTimer() ABSL_LOCKS_EXCLUDED(mu_);
   void OnRetryTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   void StartConnectingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void StartConnectAttemptLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnConnectAttemptFailedLocked(const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Called when the attempt of another subchannel to the same address,
+  // which this one was waiting for, has finished with \a status.
+  void OnSharedConnectAttemptFinished(const absl::Status& status)
+      ABSL_LOCKS_EXCLUDED(mu_);
   static void OnConnectingFinished(void* arg, grpc_error_handle error)
       ABSL_LOCKS_EXCLUDED(mu_);
   void OnConnectingFinishedLocked(grpc_error_handle error)
@@ -387,6 +418,9 @@ class Subchannel : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Whether connection attempts are coordinated with other subchannels to
+  // the same address (GRPC_ARG_COORDINATE_RECONNECTS).
+  bool coordinate_reconnects_ = false;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -420,6 +454,9 @@ class Subchannel : public DualRefCounted<Subchannel> {
   Timestamp next_attempt_time_ ABSL_GUARDED_BY(mu_);
   grpc_event_engine::experimental::EventEngine::TaskHandle retry_timer_handle_
       ABSL_GUARDED_BY(mu_);
+  // True while this subchannel's connection attempt is the one the other
+  // subchannels to the same address are waiting for.
+  bool leads_connect_attempt_ ABSL_GUARDED_BY(mu_) = false;
 
   // Keepalive time period (-1 for unset)
   int keepalive_time_ ABSL_GUARDED_BY(mu_) = -1;
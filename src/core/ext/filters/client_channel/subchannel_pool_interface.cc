@@ -22,9 +22,11 @@
 
 #include <string.h>
 
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -40,14 +42,23 @@ TraceFlag grpc_subchannel_pool_trace(false, "subchannel_pool");
 
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address),
+      args_(args),
+      hash_(absl::HashOf(absl::string_view(address_.addr, address_.len))) {}
 
 bool SubchannelKey::operator<(const SubchannelKey& other) const {
+  // Keys with different hashes differ in address, so comparing the hashes
+  // first orders them without comparing the address bytes.
+  if (hash_ != other.hash_) return hash_ < other.hash_;
   if (address_.len < other.address_.len) return true;
   if (address_.len > other.address_.len) return false;
   int r = memcmp(address_.addr, other.address_.addr, address_.len);
   if (r < 0) return true;
   if (r > 0) return false;
+  // Likewise, args with different hashes differ.
+  if (args_.Hash() != other.args_.Hash()) {
+    return args_.Hash() < other.args_.Hash();
+  }
   return args_ < other.args();
 }
 
@@ -21,6 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -53,12 +55,17 @@ class SubchannelKey {
   const grpc_resolved_address& address() const { return address_; }
   const ChannelArgs& args() const { return args_; }
 
+  // A hash of the address, computed once at construction.  Keys that
+  // compare equal have the same hash.
+  size_t hash() const { return hash_; }
+
   // Human-readable string suitable for logging.
   std::string ToString() const;
 
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  size_t hash_;
 };
 
 // Interface for subchannel pool.
@@ -93,6 +100,15 @@ class SubchannelPoolInterface : public RefCounted<SubchannelPoolInterface> {
   // if no such channel exists. Thread-safe.
   virtual RefCountedPtr<Subchannel> FindSubchannel(
       const SubchannelKey& key) = 0;
+
+  // Finds a connected subchannel to the address of \a key, registered for a
+  // different authority, that can carry calls for the authority in \a key
+  // (GRPC_ARG_HTTP2_CONNECTION_COALESCING). Returns NULL if there is none.
+  // Thread-safe.
+  virtual RefCountedPtr<Subchannel> FindCoalescableSubchannel(
+      const SubchannelKey& /*key*/) {
+    return nullptr;
+  }
 };
 
 }  // namespace grpc_core
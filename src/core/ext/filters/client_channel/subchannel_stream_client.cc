@@ -24,6 +24,8 @@
 #include <string>
 #include <utility>
 
+#include "absl/strings/string_view.h"
+
 #include <grpc/status.h>
 #include <grpc/support/log.h>
 
@@ -34,6 +36,7 @@
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/transport/error_utils.h"
 
 #define SUBCHANNEL_STREAM_INITIAL_CONNECT_BACKOFF_SECONDS 1
@@ -366,13 +369,22 @@ void SubchannelStreamClient::CallState::RecvMessageReady() {
     call_->Unref(DEBUG_LOCATION, "recv_message_ready");
     return;
   }
-  // Report payload.
+  // Report payload. Health and ORCA responses are small and almost always
+  // arrive in a single slice, which can be parsed in place.
+  std::string joined_message;
+  absl::string_view serialized_message;
+  if (recv_message_->Count() == 1) {
+    serialized_message = StringViewFromSlice(recv_message_->c_slice_at(0));
+  } else {
+    joined_message = recv_message_->JoinIntoString();
+    serialized_message = joined_message;
+  }
   {
     MutexLock lock(&subchannel_stream_client_->mu_);
     if (subchannel_stream_client_->event_handler_ != nullptr) {
       absl::Status status =
           subchannel_stream_client_->event_handler_->RecvMessageReadyLocked(
-              subchannel_stream_client_.get(), recv_message_->JoinIntoString());
+              subchannel_stream_client_.get(), serialized_message);
       if (!status.ok()) {
         if (GPR_UNLIKELY(subchannel_stream_client_->tracer_ != nullptr)) {
           gpr_log(GPR_INFO,
@@ -18,7 +18,9 @@
 
 #include "src/core/ext/filters/deadline/deadline_filter.h"
 
+#include <limits>
 #include <new>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "absl/types/optional.h"
@@ -41,6 +43,83 @@
 
 namespace grpc_core {
 
+//
+// DeadlineTimerBuckets
+//
+
+OrphanablePtr<DeadlineTimerBuckets>
+DeadlineTimerBuckets::CreateFromChannelArgs(const ChannelArgs& args) {
+  int granularity_ms =
+      args.GetInt(GRPC_ARG_DEADLINE_TIMER_GRANULARITY_MS).value_or(0);
+  if (granularity_ms <= 0) return nullptr;
+  return MakeOrphanable<DeadlineTimerBuckets>(
+      Duration::Milliseconds(granularity_ms));
+}
+
+void DeadlineTimerBuckets::Orphan() {
+  {
+    MutexLock lock(&mu_);
+    // The calls hold refs to the channel, so there are none left to wait for.
+    for (auto& p : buckets_) grpc_timer_cancel(&p.second->timer);
+  }
+  Unref();
+}
+
+void DeadlineTimerBuckets::Add(Entry* entry, Timestamp deadline) {
+  int64_t millis = deadline.milliseconds_after_process_epoch();
+  const int64_t granularity = granularity_.millis();
+  const int64_t remainder = millis % granularity;
+  if (remainder > 0 &&
+      millis <= std::numeric_limits<int64_t>::max() - granularity) {
+    millis += granularity - remainder;
+  }
+  deadline = Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+  MutexLock lock(&mu_);
+  Bucket*& bucket = buckets_[deadline];
+  if (bucket == nullptr) {
+    bucket = new Bucket;
+    bucket->buckets = Ref().release();
+    bucket->deadline = deadline;
+    GRPC_CLOSURE_INIT(&bucket->on_timer, OnTimer, bucket, nullptr);
+    grpc_timer_init(&bucket->timer, deadline, &bucket->on_timer);
+  }
+  entry->bucket = bucket;
+  entry->prev = nullptr;
+  entry->next = bucket->entries;
+  if (entry->next != nullptr) entry->next->prev = entry;
+  bucket->entries = entry;
+}
+
+bool DeadlineTimerBuckets::Cancel(Entry* entry) {
+  MutexLock lock(&mu_);
+  Bucket* bucket = entry->bucket;
+  if (bucket == nullptr) return false;
+  if (entry->prev != nullptr) {
+    entry->prev->next = entry->next;
+  } else {
+    bucket->entries = entry->next;
+  }
+  if (entry->next != nullptr) entry->next->prev = entry->prev;
+  entry->bucket = nullptr;
+  return true;
+}
+
+void DeadlineTimerBuckets::OnTimer(void* arg, grpc_error_handle /*error*/) {
+  Bucket* bucket = static_cast<Bucket*>(arg);
+  DeadlineTimerBuckets* self = bucket->buckets;
+  {
+    MutexLock lock(&self->mu_);
+    self->buckets_.erase(bucket->deadline);
+    for (Entry* entry = bucket->entries; entry != nullptr;
+         entry = entry->next) {
+      entry->bucket = nullptr;
+      ExecCtx::Run(DEBUG_LOCATION, entry->on_deadline, absl::OkStatus());
+    }
+  }
+  delete bucket;
+  self->Unref();
+}
+
 // A fire-and-forget class representing a pending deadline timer.
 // Allocated on the call arena.
 class TimerState {
@@ -50,10 +129,24 @@ class TimerState {
         static_cast<grpc_deadline_state*>(elem_->call_data);
     GRPC_CALL_STACK_REF(deadline_state->call_stack, "DeadlineTimerState");
     GRPC_CLOSURE_INIT(&closure_, TimerCallback, this, nullptr);
-    grpc_timer_init(&timer_, deadline, &closure_);
+    if (deadline_state->timer_buckets != nullptr) {
+      entry_.on_deadline = &closure_;
+      deadline_state->timer_buckets->Add(&entry_, deadline);
+    } else {
+      grpc_timer_init(&timer_, deadline, &closure_);
+    }
   }
 
-  void Cancel() { grpc_timer_cancel(&timer_); }
+  void Cancel() {
+    grpc_deadline_state* deadline_state =
+        static_cast<grpc_deadline_state*>(elem_->call_data);
+    if (deadline_state->timer_buckets == nullptr) {
+      grpc_timer_cancel(&timer_);
+    } else if (deadline_state->timer_buckets->Cancel(&entry_)) {
+      // Run the callback as a cancelled timer would.
+      ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::CancelledError());
+    }
+  }
 
  private:
   // The on_complete callback used when sending a cancel_error batch down the
@@ -107,6 +200,7 @@ class TimerState {
   // to cancel the timer.
   grpc_call_element* elem_;
   grpc_timer timer_;
+  DeadlineTimerBuckets::Entry entry_;
   grpc_closure closure_;
 };
 
@@ -192,12 +286,14 @@ static void start_timer_after_init(void* arg, grpc_error_handle error) {
                           "done scheduling deadline timer");
 }
 
-grpc_deadline_state::grpc_deadline_state(grpc_call_element* elem,
-                                         const grpc_call_element_args& args,
-                                         grpc_core::Timestamp deadline)
+grpc_deadline_state::grpc_deadline_state(
+    grpc_call_element* elem, const grpc_call_element_args& args,
+    grpc_core::Timestamp deadline,
+    grpc_core::DeadlineTimerBuckets* timer_buckets)
     : call_stack(args.call_stack),
       call_combiner(args.call_combiner),
-      arena(args.arena) {
+      arena(args.arena),
+      timer_buckets(timer_buckets) {
   // Deadline will always be infinite on servers, so the timer will only be
   // set on clients with a finite deadline.
   if (deadline != grpc_core::Timestamp::InfFuture()) {
@@ -245,15 +341,26 @@ void grpc_deadline_state_client_start_transport_stream_op_batch(
 // filter code
 //
 
+// Channel data used for both client and server filter.
+struct deadline_channel_data {
+  grpc_core::OrphanablePtr<grpc_core::DeadlineTimerBuckets> timer_buckets;
+};
+
 // Constructor for channel_data.  Used for both client and server filters.
 static grpc_error_handle deadline_init_channel_elem(
-    grpc_channel_element* /*elem*/, grpc_channel_element_args* args) {
+    grpc_channel_element* elem, grpc_channel_element_args* args) {
   GPR_ASSERT(!args->is_last);
+  new (elem->channel_data) deadline_channel_data{
+      grpc_core::DeadlineTimerBuckets::CreateFromChannelArgs(
+          *args->core_channel_args)};
   return absl::OkStatus();
 }
 
 // Destructor for channel_data.  Used for both client and server filters.
-static void deadline_destroy_channel_elem(grpc_channel_element* /*elem*/) {}
+static void deadline_destroy_channel_elem(grpc_channel_element* elem) {
+  static_cast<deadline_channel_data*>(elem->channel_data)
+      ->~deadline_channel_data();
+}
 
 // Call data used for both client and server filter.
 typedef struct base_call_data {
@@ -275,7 +382,10 @@ typedef struct server_call_data {
 // Constructor for call_data.  Used for both client and server filters.
 static grpc_error_handle deadline_init_call_elem(
     grpc_call_element* elem, const grpc_call_element_args* args) {
-  new (elem->call_data) grpc_deadline_state(elem, *args, args->deadline);
+  new (elem->call_data) grpc_deadline_state(
+      elem, *args, args->deadline,
+      static_cast<deadline_channel_data*>(elem->channel_data)
+          ->timer_buckets.get());
   return absl::OkStatus();
 }
 
@@ -350,7 +460,7 @@ const grpc_channel_filter grpc_client_deadline_filter = {
     deadline_init_call_elem,
     grpc_call_stack_ignore_set_pollset_or_pollset_set,
     deadline_destroy_call_elem,
-    0,  // sizeof(channel_data)
+    sizeof(deadline_channel_data),
     deadline_init_channel_elem,
     grpc_channel_stack_no_post_init,
     deadline_destroy_channel_elem,
@@ -366,7 +476,7 @@ const grpc_channel_filter grpc_server_deadline_filter = {
     deadline_init_call_elem,
     grpc_call_stack_ignore_set_pollset_or_pollset_set,
     deadline_destroy_call_elem,
-    0,  // sizeof(channel_data)
+    sizeof(deadline_channel_data),
     deadline_init_channel_elem,
     grpc_channel_stack_no_post_init,
     deadline_destroy_channel_elem,
@@ -19,17 +19,82 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <map>
+
+#include "absl/base/thread_annotations.h"
+
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
+
 class TimerState;
+
+// Deadline timers shared by the calls of a channel, for channels with
+// GRPC_ARG_DEADLINE_TIMER_GRANULARITY_MS set.
+//
+// Deadlines are rounded up to a multiple of the granularity, and all calls
+// whose deadlines round to the same time wait on one timer.  Starting and
+// cancelling a call's deadline are then a list insertion and removal instead
+// of a timer operation each, at the price of deadlines firing up to one
+// granularity late.  A bucket keeps its timer when its last call completes,
+// so that the calls that follow can reuse it.
+class DeadlineTimerBuckets : public InternallyRefCounted<DeadlineTimerBuckets> {
+ private:
+  struct Bucket;
+
+ public:
+  // A call waiting for its deadline.
+  struct Entry {
+    // Scheduled with an OK status when the deadline passes.
+    grpc_closure* on_deadline;
+    Bucket* bucket = nullptr;
+    Entry* prev = nullptr;
+    Entry* next = nullptr;
+  };
+
+  // Returns null if args do not ask for bucketed deadlines.
+  static OrphanablePtr<DeadlineTimerBuckets> CreateFromChannelArgs(
+      const ChannelArgs& args);
+
+  explicit DeadlineTimerBuckets(Duration granularity)
+      : granularity_(granularity) {}
+
+  void Orphan() override;
+
+  // Schedules entry->on_deadline to run once deadline has passed.
+  void Add(Entry* entry, Timestamp deadline);
+  // Removes entry, returning false if its on_deadline has already been
+  // scheduled.
+  bool Cancel(Entry* entry);
+
+ private:
+  struct Bucket {
+    DeadlineTimerBuckets* buckets;
+    Timestamp deadline;
+    Entry* entries = nullptr;
+    grpc_timer timer;
+    grpc_closure on_timer;
+  };
+
+  static void OnTimer(void* arg, grpc_error_handle error);
+
+  const Duration granularity_;
+  Mutex mu_;
+  // Each bucket holds a ref to this object until its timer has run.
+  std::map<Timestamp, Bucket*> buckets_ ABSL_GUARDED_BY(mu_);
+};
+
 }  // namespace grpc_core
 
 // State used for filters that enforce call deadlines.
@@ -37,13 +102,17 @@ class TimerState;
 struct grpc_deadline_state {
   grpc_deadline_state(grpc_call_element* elem,
                       const grpc_call_element_args& args,
-                      grpc_core::Timestamp deadline);
+                      grpc_core::Timestamp deadline,
+                      grpc_core::DeadlineTimerBuckets* timer_buckets = nullptr);
   ~grpc_deadline_state();
 
   // We take a reference to the call stack for the timer callback.
   grpc_call_stack* call_stack;
   grpc_core::CallCombiner* call_combiner;
   grpc_core::Arena* arena;
+  // If non-null, the deadline timer is shared with other calls of the
+  // channel.  Owned by the channel.
+  grpc_core::DeadlineTimerBuckets* const timer_buckets;
   grpc_core::TimerState* timer_state = nullptr;
   // Closure to invoke when we receive trailing metadata.
   // We use this to cancel the timer.
@@ -35,8 +35,11 @@
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -71,6 +74,20 @@ class ChannelData {
               name);
       default_compression_algorithm_ = GRPC_COMPRESS_NONE;
     }
+    const grpc_core::ChannelArgs& channel_args = *args->core_channel_args;
+    absl::optional<int> zlib_level =
+        channel_args.GetInt(GRPC_ARG_EXPERIMENTAL_ZLIB_COMPRESSION_LEVEL);
+    if (zlib_level.has_value()) {
+      if (*zlib_level >= 1 && *zlib_level <= 9) {
+        zlib_level_ = *zlib_level;
+      } else {
+        gpr_log(GPR_ERROR, "invalid zlib compression level %d: using default",
+                *zlib_level);
+      }
+    }
+    adaptive_compression_ =
+        channel_args.GetBool(GRPC_ARG_EXPERIMENTAL_ADAPTIVE_COMPRESSION)
+            .value_or(false);
     GPR_ASSERT(!args->is_last);
   }
 
@@ -82,11 +99,19 @@ class ChannelData {
     return enabled_compression_algorithms_;
   }
 
+  int zlib_level() const { return zlib_level_; }
+
+  bool adaptive_compression() const { return adaptive_compression_; }
+
  private:
   /** The default, channel-level, compression algorithm */
   grpc_compression_algorithm default_compression_algorithm_;
   /** Enabled compression algorithms */
   grpc_core::CompressionAlgorithmSet enabled_compression_algorithms_;
+  /** The zlib level used by deflate and gzip */
+  int zlib_level_ = grpc_core::MessageCompressor::kDefaultZlibLevel;
+  /** Whether to stop compressing streams that compress poorly */
+  bool adaptive_compression_;
 };
 
 class CallData {
@@ -100,6 +125,7 @@ class CallData {
             channeld->default_compression_algorithm()))) {
       compression_algorithm_ = channeld->default_compression_algorithm();
     }
+    if (channeld->adaptive_compression()) adaptive_compression_.emplace();
     GRPC_CLOSURE_INIT(&forward_send_message_batch_in_call_combiner_,
                       ForwardSendMessageBatch, elem, grpc_schedule_on_exec_ctx);
   }
@@ -111,6 +137,7 @@ class CallData {
 
  private:
   bool SkipMessageCompression();
+  void CompressMessage(grpc_call_element* elem);
   void FinishSendMessage(grpc_call_element* elem);
 
   void ProcessSendInitialMetadata(grpc_call_element* elem,
@@ -123,6 +150,11 @@ class CallData {
 
   grpc_core::CallCombiner* call_combiner_;
   grpc_compression_algorithm compression_algorithm_ = GRPC_COMPRESS_NONE;
+  // Created by the first message that is compressed, and kept for the rest
+  // of the call.
+  absl::optional<grpc_core::MessageCompressor> compressor_;
+  // Set if the channel enables adaptive compression.
+  absl::optional<grpc_core::AdaptiveCompressionPolicy> adaptive_compression_;
   grpc_error_handle cancel_error_;
   grpc_transport_stream_op_batch* send_message_batch_ = nullptr;
   bool seen_initial_metadata_ = false;
@@ -165,43 +197,66 @@ void CallData::ProcessSendInitialMetadata(
                         channeld->enabled_compression_algorithms());
 }
 
+void CallData::CompressMessage(grpc_call_element* elem) {
+  grpc_core::SliceBuffer tmp;
+  uint32_t& send_flags = send_message_batch_->payload->send_message.flags;
+  grpc_core::SliceBuffer* payload =
+      send_message_batch_->payload->send_message.send_message;
+  if (!compressor_.has_value()) {
+    ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+    compressor_.emplace(compression_algorithm_, channeld->zlib_level());
+  }
+  const size_t before_size = payload->Length();
+  bool did_compress =
+      compressor_->Compress(payload->c_slice_buffer(), tmp.c_slice_buffer());
+  const size_t after_size = did_compress ? tmp.Length() : before_size;
+  if (adaptive_compression_.has_value()) {
+    adaptive_compression_->RecordResult(before_size, after_size);
+  }
+  if (did_compress) {
+    grpc_core::global_stats().IncrementCompressionRatioPercent(
+        static_cast<int>(after_size * 100 / before_size));
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+      const char* algo_name;
+      const float savings_ratio = 1.0f - static_cast<float>(after_size) /
+                                             static_cast<float>(before_size);
+      GPR_ASSERT(grpc_compression_algorithm_name(compression_algorithm_,
+                                                 &algo_name));
+      gpr_log(GPR_INFO,
+              "Compressed[%s] %" PRIuPTR " bytes vs. %" PRIuPTR
+              " bytes (%.2f%% savings)",
+              algo_name, before_size, after_size, 100 * savings_ratio);
+    }
+    tmp.Swap(payload);
+    send_flags |= GRPC_WRITE_INTERNAL_COMPRESS;
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+      const char* algo_name;
+      GPR_ASSERT(grpc_compression_algorithm_name(compression_algorithm_,
+                                                 &algo_name));
+      gpr_log(GPR_INFO,
+              "Algorithm '%s' enabled but decided not to compress. Input size: "
+              "%" PRIuPTR,
+              algo_name, payload->Length());
+    }
+  }
+}
+
 void CallData::FinishSendMessage(grpc_call_element* elem) {
   // Compress the data if appropriate.
   if (!SkipMessageCompression()) {
-    grpc_core::SliceBuffer tmp;
-    uint32_t& send_flags = send_message_batch_->payload->send_message.flags;
-    grpc_core::SliceBuffer* payload =
-        send_message_batch_->payload->send_message.send_message;
-    bool did_compress =
-        grpc_msg_compress(compression_algorithm_, payload->c_slice_buffer(),
-                          tmp.c_slice_buffer());
-    if (did_compress) {
+    if (adaptive_compression_.has_value() &&
+        !adaptive_compression_->ShouldCompress()) {
+      grpc_core::global_stats().IncrementCompressionAdaptiveSkips();
       if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
-        const char* algo_name;
-        const size_t before_size = payload->Length();
-        const size_t after_size = tmp.Length();
-        const float savings_ratio = 1.0f - static_cast<float>(after_size) /
-                                               static_cast<float>(before_size);
-        GPR_ASSERT(grpc_compression_algorithm_name(compression_algorithm_,
-                                                   &algo_name));
         gpr_log(GPR_INFO,
-                "Compressed[%s] %" PRIuPTR " bytes vs. %" PRIuPTR
-                " bytes (%.2f%% savings)",
-                algo_name, before_size, after_size, 100 * savings_ratio);
+                "Not compressing: previous messages compressed poorly. Input "
+                "size: %" PRIuPTR,
+                send_message_batch_->payload->send_message.send_message
+                    ->Length());
       }
-      tmp.Swap(payload);
-      send_flags |= GRPC_WRITE_INTERNAL_COMPRESS;
     } else {
-      if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
-        const char* algo_name;
-        GPR_ASSERT(grpc_compression_algorithm_name(compression_algorithm_,
-                                                   &algo_name));
-        gpr_log(
-            GPR_INFO,
-            "Algorithm '%s' enabled but decided not to compress. Input size: "
-            "%" PRIuPTR,
-            algo_name, payload->Length());
-      }
+      CompressMessage(elem);
     }
   }
   grpc_call_next_op(elem, std::exchange(send_message_batch_, nullptr));
@@ -52,8 +52,7 @@ namespace {
 class ChannelData {
  public:
   explicit ChannelData(const grpc_channel_element_args* args)
-      : max_recv_size_(GetMaxRecvSizeFromChannelArgs(
-            ChannelArgs::FromC(args->channel_args))),
+      : max_recv_size_(GetMaxRecvSizeFromChannelArgs(*args->core_channel_args)),
         message_size_service_config_parser_index_(
             MessageSizeParser::ParserIndex()) {}
 
@@ -119,6 +118,9 @@ class CallData {
   bool seen_recv_message_ready_ = false;
   int max_recv_message_length_;
   grpc_compression_algorithm algorithm_ = GRPC_COMPRESS_NONE;
+  // Created by the first compressed message, and kept for the rest of the
+  // call.
+  absl::optional<MessageDecompressor> decompressor_;
   absl::optional<SliceBuffer>* recv_message_ = nullptr;
   uint32_t* recv_message_flags_ = nullptr;
   grpc_closure on_recv_message_ready_;
@@ -183,10 +185,24 @@ void CallData::OnRecvMessageReady(void* arg, grpc_error_handle error) {
             StatusIntProperty::kRpcStatus, GRPC_STATUS_RESOURCE_EXHAUSTED);
         return calld->ContinueRecvMessageReadyCallback(calld->error_);
       }
+      if (!calld->decompressor_.has_value()) {
+        calld->decompressor_.emplace(calld->algorithm_);
+      }
       SliceBuffer decompressed_slices;
-      if (grpc_msg_decompress(calld->algorithm_,
-                              (*calld->recv_message_)->c_slice_buffer(),
-                              decompressed_slices.c_slice_buffer()) == 0) {
+      absl::Status status = calld->decompressor_->Decompress(
+          (*calld->recv_message_)->c_slice_buffer(),
+          decompressed_slices.c_slice_buffer(),
+          calld->max_recv_message_length_ >= 0
+              ? static_cast<size_t>(calld->max_recv_message_length_)
+              : SIZE_MAX);
+      if (absl::IsResourceExhausted(status)) {
+        GPR_DEBUG_ASSERT(calld->error_.ok());
+        calld->error_ = grpc_error_set_int(
+            GRPC_ERROR_CREATE(absl::StrFormat(
+                "Received message larger than max when decompressed (> %d)",
+                calld->max_recv_message_length_)),
+            StatusIntProperty::kRpcStatus, GRPC_STATUS_RESOURCE_EXHAUSTED);
+      } else if (!status.ok()) {
         GPR_DEBUG_ASSERT(calld->error_.ok());
         calld->error_ = GRPC_ERROR_CREATE(absl::StrCat(
             "Unexpected error decompressing data for algorithm with "
@@ -96,17 +96,8 @@ absl::StatusOr<ServerLoadReportingFilter> ServerLoadReportingFilter::Create(
 }
 
 namespace {
-std::string GetCensusSafeClientIpString(
-    const ClientMetadataHandle& initial_metadata) {
-  // Find the client URI string.
-  auto client_uri_str = initial_metadata->get(PeerString());
-  if (!client_uri_str.has_value()) {
-    gpr_log(GPR_ERROR,
-            "Unable to extract client URI string (peer string) from gRPC "
-            "metadata.");
-    return "";
-  }
-  absl::StatusOr<URI> client_uri = URI::Parse(*client_uri_str);
+std::string GetCensusSafeClientIpString(absl::string_view client_uri_str) {
+  absl::StatusOr<URI> client_uri = URI::Parse(client_uri_str);
   if (!client_uri.ok()) {
     gpr_log(GPR_ERROR,
             "Unable to parse the client URI string (peer string) to a client "
@@ -142,9 +133,8 @@ std::string GetCensusSafeClientIpString(
   }
 }
 
-std::string MakeClientIpAndLrToken(
-    absl::string_view lr_token, const ClientMetadataHandle& initial_metadata) {
-  std::string client_ip = GetCensusSafeClientIpString(initial_metadata);
+std::string MakeClientIpAndLrToken(absl::string_view lr_token,
+                                   absl::string_view client_ip) {
   absl::string_view prefix;
   switch (client_ip.length()) {
     case 0:
@@ -179,6 +169,29 @@ const char* GetStatusTagForStatus(grpc_status_code status) {
 }
 }  // namespace
 
+std::string ServerLoadReportingFilter::GetClientIp(
+    const ClientMetadataHandle& initial_metadata) {
+  // Find the client URI string.
+  auto peer = initial_metadata->get(PeerString());
+  if (!peer.has_value()) {
+    gpr_log(GPR_ERROR,
+            "Unable to extract client URI string (peer string) from gRPC "
+            "metadata.");
+    return "";
+  }
+  {
+    MutexLock lock(&client_ip_cache_->mu);
+    if (!client_ip_cache_->peer.empty() && client_ip_cache_->peer == *peer) {
+      return client_ip_cache_->client_ip;
+    }
+  }
+  std::string client_ip = GetCensusSafeClientIpString(*peer);
+  MutexLock lock(&client_ip_cache_->mu);
+  client_ip_cache_->peer = std::string(*peer);
+  client_ip_cache_->client_ip = client_ip;
+  return client_ip;
+}
+
 ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
   // Gather up basic facts about the request
@@ -195,8 +208,9 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
   std::string client_ip_and_lr_token;
   auto lb_token = call_args.client_initial_metadata->Take(LbTokenMetadata())
                       .value_or(Slice());
-  client_ip_and_lr_token = MakeClientIpAndLrToken(
-      lb_token.as_string_view(), call_args.client_initial_metadata);
+  client_ip_and_lr_token =
+      MakeClientIpAndLrToken(lb_token.as_string_view(),
+                             GetClientIp(call_args.client_initial_metadata));
   // Record the beginning of the request
   opencensus::stats::Record(
       {{::grpc::load_reporter::MeasureStartCount(), 1}},
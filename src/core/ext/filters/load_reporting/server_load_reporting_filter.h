@@ -23,12 +23,15 @@
 
 #include <stddef.h>
 
+#include <memory>
 #include <string>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/statusor.h"
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/transport.h"
 
@@ -48,8 +51,21 @@ class ServerLoadReportingFilter : public ChannelFilter {
       CallArgs call_args, NextPromiseFactory next_promise_factory) override;
 
  private:
+  // The census-safe client IP of the last peer seen on this channel. Calls
+  // on a server channel all come from the same peer, so this saves parsing
+  // the peer address for every call.
+  struct ClientIpCache {
+    Mutex mu;
+    std::string peer ABSL_GUARDED_BY(mu);
+    std::string client_ip ABSL_GUARDED_BY(mu);
+  };
+
+  std::string GetClientIp(const ClientMetadataHandle& initial_metadata);
+
   // The peer's authenticated identity.
   std::string peer_identity_;
+  std::unique_ptr<ClientIpCache> client_ip_cache_ =
+      std::make_unique<ClientIpCache>();
 };
 
 }  // namespace grpc_core
@@ -199,6 +199,9 @@ struct call_data {
   grpc_error_handle error;
   // Used by recv_message_ready.
   absl::optional<grpc_core::SliceBuffer>* recv_message = nullptr;
+  uint32_t* recv_message_flags = nullptr;
+  // Length of the parts received so far of a message received in parts.
+  size_t partial_message_length = 0;
   // Original recv_message_ready callback, invoked after our own.
   grpc_closure* next_recv_message_ready = nullptr;
   // Original recv_trailing_metadata callback, invoked after our own.
@@ -214,13 +217,21 @@ struct call_data {
 static void recv_message_ready(void* user_data, grpc_error_handle error) {
   grpc_call_element* elem = static_cast<grpc_call_element*>(user_data);
   call_data* calld = static_cast<call_data*>(elem->call_data);
+  // A message received in parts counts with all of its parts so far.
+  size_t length = 0;
+  if (calld->recv_message->has_value()) {
+    length = calld->partial_message_length + (*calld->recv_message)->Length();
+    calld->partial_message_length =
+        (*calld->recv_message_flags & GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE)
+            ? length
+            : 0;
+  }
   if (calld->recv_message->has_value() && calld->limits.max_recv_size >= 0 &&
-      (*calld->recv_message)->Length() >
-          static_cast<size_t>(calld->limits.max_recv_size)) {
+      length > static_cast<size_t>(calld->limits.max_recv_size)) {
     grpc_error_handle new_error = grpc_error_set_int(
         GRPC_ERROR_CREATE(absl::StrFormat(
-            "Received message larger than max (%u vs. %d)",
-            (*calld->recv_message)->Length(), calld->limits.max_recv_size)),
+            "Received message larger than max (%u vs. %d)", length,
+            calld->limits.max_recv_size)),
         grpc_core::StatusIntProperty::kRpcStatus,
         GRPC_STATUS_RESOURCE_EXHAUSTED);
     error = grpc_error_add_child(error, new_error);
@@ -288,6 +299,7 @@ static void message_size_start_transport_stream_op_batch(
     calld->next_recv_message_ready =
         op->payload->recv_message.recv_message_ready;
     calld->recv_message = op->payload->recv_message.recv_message;
+    calld->recv_message_flags = op->payload->recv_message.flags;
     op->payload->recv_message.recv_message_ready = &calld->recv_message_ready;
   }
   // Inject callback for receiving trailing metadata.
@@ -331,8 +343,7 @@ static grpc_error_handle message_size_init_channel_elem(
   GPR_ASSERT(!args->is_last);
   channel_data* chand = static_cast<channel_data*>(elem->channel_data);
   new (chand) channel_data();
-  chand->limits = get_message_size_limits(
-      grpc_core::ChannelArgs::FromC(args->channel_args));
+  chand->limits = get_message_size_limits(*args->core_channel_args);
   return absl::OkStatus();
 }
 
@@ -435,7 +435,7 @@ static void perform_stream_op_locked(void* stream_op,
   auto tx = std::make_unique<grpc_binder::Transaction>(tx_code, gbt->is_client);
 
   if (op->send_initial_metadata) {
-    gpr_log(GPR_INFO, "send_initial_metadata");
+    gpr_log(GPR_DEBUG, "send_initial_metadata");
     grpc_binder::Metadata init_md;
     auto batch = op->payload->send_initial_metadata.send_initial_metadata;
 
@@ -444,12 +444,12 @@ static void perform_stream_op_locked(void* stream_op,
     tx->SetPrefix(init_md);
   }
   if (op->send_message) {
-    gpr_log(GPR_INFO, "send_message");
+    gpr_log(GPR_DEBUG, "send_message");
     tx->SetData(op->payload->send_message.send_message->JoinIntoString());
   }
 
   if (op->send_trailing_metadata) {
-    gpr_log(GPR_INFO, "send_trailing_metadata");
+    gpr_log(GPR_DEBUG, "send_trailing_metadata");
     auto batch = op->payload->send_trailing_metadata.send_trailing_metadata;
     grpc_binder::Metadata trailing_metadata;
 
@@ -462,7 +462,7 @@ static void perform_stream_op_locked(void* stream_op,
     tx->SetSuffix(trailing_metadata);
   }
   if (op->recv_initial_metadata) {
-    gpr_log(GPR_INFO, "recv_initial_metadata");
+    gpr_log(GPR_DEBUG, "recv_initial_metadata");
     gbs->recv_initial_metadata_ready =
         op->payload->recv_initial_metadata.recv_initial_metadata_ready;
     gbs->recv_initial_metadata =
@@ -485,7 +485,7 @@ static void perform_stream_op_locked(void* stream_op,
         });
   }
   if (op->recv_message) {
-    gpr_log(GPR_INFO, "recv_message");
+    gpr_log(GPR_DEBUG, "recv_message");
     gbs->recv_message_ready = op->payload->recv_message.recv_message_ready;
     gbs->recv_message = op->payload->recv_message.recv_message;
     gbs->call_failed_before_recv_message =
@@ -503,7 +503,7 @@ static void perform_stream_op_locked(void* stream_op,
         });
   }
   if (op->recv_trailing_metadata) {
-    gpr_log(GPR_INFO, "recv_trailing_metadata");
+    gpr_log(GPR_DEBUG, "recv_trailing_metadata");
     gbs->recv_trailing_metadata_finished =
         op->payload->recv_trailing_metadata.recv_trailing_metadata_ready;
     gbs->recv_trailing_metadata =
@@ -551,7 +551,7 @@ static void perform_stream_op_locked(void* stream_op,
   if (op->on_complete != nullptr) {
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, op->on_complete,
                             absl_status_to_grpc_error(status));
-    gpr_log(GPR_INFO, "on_complete closure schuduled");
+    gpr_log(GPR_DEBUG, "on_complete closure schuduled");
   }
   GRPC_BINDER_STREAM_UNREF(gbs, "perform_stream_op");
 }
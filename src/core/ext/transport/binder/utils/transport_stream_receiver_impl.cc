@@ -32,7 +32,7 @@ const absl::string_view
 
 void TransportStreamReceiverImpl::RegisterRecvInitialMetadata(
     StreamIdentifier id, InitialMetadataCallbackType cb) {
-  gpr_log(GPR_INFO, "%s id = %d is_client = %d", __func__, id, is_client_);
+  gpr_log(GPR_DEBUG, "%s id = %d is_client = %d", __func__, id, is_client_);
   absl::StatusOr<Metadata> initial_metadata{};
   {
     grpc_core::MutexLock l(&m_);
@@ -60,7 +60,7 @@ void TransportStreamReceiverImpl::RegisterRecvInitialMetadata(
 
 void TransportStreamReceiverImpl::RegisterRecvMessage(
     StreamIdentifier id, MessageDataCallbackType cb) {
-  gpr_log(GPR_INFO, "%s id = %d is_client = %d", __func__, id, is_client_);
+  gpr_log(GPR_DEBUG, "%s id = %d is_client = %d", __func__, id, is_client_);
   absl::StatusOr<std::string> message{};
   {
     grpc_core::MutexLock l(&m_);
@@ -94,7 +94,7 @@ void TransportStreamReceiverImpl::RegisterRecvMessage(
 
 void TransportStreamReceiverImpl::RegisterRecvTrailingMetadata(
     StreamIdentifier id, TrailingMetadataCallbackType cb) {
-  gpr_log(GPR_INFO, "%s id = %d is_client = %d", __func__, id, is_client_);
+  gpr_log(GPR_DEBUG, "%s id = %d is_client = %d", __func__, id, is_client_);
   std::pair<absl::StatusOr<Metadata>, int> trailing_metadata{};
   {
     grpc_core::MutexLock l(&m_);
@@ -118,7 +118,7 @@ void TransportStreamReceiverImpl::RegisterRecvTrailingMetadata(
 
 void TransportStreamReceiverImpl::NotifyRecvInitialMetadata(
     StreamIdentifier id, absl::StatusOr<Metadata> initial_metadata) {
-  gpr_log(GPR_INFO, "%s id = %d is_client = %d", __func__, id, is_client_);
+  gpr_log(GPR_DEBUG, "%s id = %d is_client = %d", __func__, id, is_client_);
   if (!is_client_ && accept_stream_callback_ && initial_metadata.ok()) {
     accept_stream_callback_();
   }
@@ -127,7 +127,7 @@ void TransportStreamReceiverImpl::NotifyRecvInitialMetadata(
     grpc_core::MutexLock l(&m_);
     auto iter = initial_metadata_cbs_.find(id);
     if (iter != initial_metadata_cbs_.end()) {
-      cb = iter->second;
+      cb = std::move(iter->second);
       initial_metadata_cbs_.erase(iter);
     } else {
       pending_initial_metadata_[id].push(std::move(initial_metadata));
@@ -139,13 +139,13 @@ void TransportStreamReceiverImpl::NotifyRecvInitialMetadata(
 
 void TransportStreamReceiverImpl::NotifyRecvMessage(
     StreamIdentifier id, absl::StatusOr<std::string> message) {
-  gpr_log(GPR_INFO, "%s id = %d is_client = %d", __func__, id, is_client_);
+  gpr_log(GPR_DEBUG, "%s id = %d is_client = %d", __func__, id, is_client_);
   MessageDataCallbackType cb;
   {
     grpc_core::MutexLock l(&m_);
     auto iter = message_cbs_.find(id);
     if (iter != message_cbs_.end()) {
-      cb = iter->second;
+      cb = std::move(iter->second);
       message_cbs_.erase(iter);
     } else {
       pending_message_[id].push(std::move(message));
@@ -162,14 +162,14 @@ void TransportStreamReceiverImpl::NotifyRecvTrailingMetadata(
   // assumes in-order commitments of transactions and that trailing metadata is
   // parsed after message data, we can safely cancel all upcoming callbacks of
   // recv_message.
-  gpr_log(GPR_INFO, "%s id = %d is_client = %d", __func__, id, is_client_);
+  gpr_log(GPR_DEBUG, "%s id = %d is_client = %d", __func__, id, is_client_);
   OnRecvTrailingMetadata(id);
   TrailingMetadataCallbackType cb;
   {
     grpc_core::MutexLock l(&m_);
     auto iter = trailing_metadata_cbs_.find(id);
     if (iter != trailing_metadata_cbs_.end()) {
-      cb = iter->second;
+      cb = std::move(iter->second);
       trailing_metadata_cbs_.erase(iter);
     } else {
       pending_trailing_metadata_[id].emplace(std::move(trailing_metadata),
@@ -62,8 +62,7 @@ ndk_util::binder_status_t f_onTransact(ndk_util::AIBinder* binder,
                                        transaction_code_t code,
                                        const ndk_util::AParcel* in,
                                        ndk_util::AParcel* /*out*/) {
-  gpr_log(GPR_INFO, __func__);
-  gpr_log(GPR_INFO, "tx code = %u", code);
+  gpr_log(GPR_DEBUG, "%s tx code = %u", __func__, code);
 
   auto* user_data =
       static_cast<BinderUserData*>(ndk_util::AIBinder_getUserData(binder));
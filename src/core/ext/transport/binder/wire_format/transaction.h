@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/string_view.h"
@@ -43,29 +44,29 @@ class Transaction {
       : tx_code_(tx_code), is_client_(is_client) {}
   // TODO(mingcl): Consider using string_view
   void SetPrefix(Metadata prefix_metadata) {
-    prefix_metadata_ = prefix_metadata;
+    prefix_metadata_ = std::move(prefix_metadata);
     GPR_ASSERT((flags_ & kFlagPrefix) == 0);
     flags_ |= kFlagPrefix;
   }
   void SetMethodRef(std::string method_ref) {
     GPR_ASSERT(is_client_);
-    method_ref_ = method_ref;
+    method_ref_ = std::move(method_ref);
   }
   void SetData(std::string message_data) {
-    message_data_ = message_data;
+    message_data_ = std::move(message_data);
     GPR_ASSERT((flags_ & kFlagMessageData) == 0);
     flags_ |= kFlagMessageData;
   }
   void SetSuffix(Metadata suffix_metadata) {
     if (is_client_) GPR_ASSERT(suffix_metadata.empty());
-    suffix_metadata_ = suffix_metadata;
+    suffix_metadata_ = std::move(suffix_metadata);
     GPR_ASSERT((flags_ & kFlagSuffix) == 0);
     flags_ |= kFlagSuffix;
   }
   void SetStatusDescription(std::string status_desc) {
     GPR_ASSERT(!is_client_);
     GPR_ASSERT((flags_ & kFlagStatusDescription) == 0);
-    status_desc_ = status_desc;
+    status_desc_ = std::move(status_desc);
   }
   void SetStatus(int status) {
     GPR_ASSERT(!is_client_);
@@ -300,7 +300,7 @@ absl::Status WireReaderImpl::ProcessStreamingTransactionImpl(
     transaction_code_t code, ReadableParcel* parcel, int* cancellation_flags) {
   GPR_ASSERT(cancellation_flags);
   num_incoming_bytes_ += parcel->GetDataSize();
-  gpr_log(GPR_INFO, "Total incoming bytes: %" PRId64, num_incoming_bytes_);
+  gpr_log(GPR_DEBUG, "Total incoming bytes: %" PRId64, num_incoming_bytes_);
 
   int flags;
   GRPC_RETURN_IF_ERROR(parcel->ReadInt32(&flags));
@@ -379,11 +379,23 @@ absl::Status WireReaderImpl::ProcessStreamingTransactionImpl(
     if (count > 0) {
       GRPC_RETURN_IF_ERROR(parcel->ReadByteArray(&msg_data));
     }
-    message_buffer_[code] += msg_data;
-    if ((flags & kFlagMessageDataIsPartial) == 0) {
-      std::string s = std::move(message_buffer_[code]);
-      message_buffer_.erase(code);
-      transport_stream_receiver_->NotifyRecvMessage(code, std::move(s));
+    if (flags & kFlagMessageDataIsPartial) {
+      // Take over the first chunk instead of copying it into an empty buffer.
+      std::string& buffer = message_buffer_[code];
+      if (buffer.empty()) {
+        buffer = std::move(msg_data);
+      } else {
+        buffer += msg_data;
+      }
+    } else {
+      // Messages that fit in one transaction never touch message_buffer_.
+      auto it = message_buffer_.find(code);
+      if (it != message_buffer_.end()) {
+        it->second += msg_data;
+        msg_data = std::move(it->second);
+        message_buffer_.erase(it);
+      }
+      transport_stream_receiver_->NotifyRecvMessage(code, std::move(msg_data));
     }
     *cancellation_flags &= ~kFlagMessageData;
   }
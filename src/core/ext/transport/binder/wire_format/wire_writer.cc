@@ -114,7 +114,7 @@ absl::Status WireWriterImpl::MakeBinderTransaction(
               parcel_size);
     }
     num_outgoing_bytes_ += parcel_size;
-    gpr_log(GPR_INFO, "Total outgoing bytes: %" PRId64,
+    gpr_log(GPR_DEBUG, "Total outgoing bytes: %" PRId64,
             num_outgoing_bytes_.load());
   }
   GPR_ASSERT(!is_transacting_);
@@ -284,7 +284,7 @@ absl::Status WireWriterImpl::SendAck(int64_t num_bytes) {
   // Ensure combiner will be run if this is not called from top-level gRPC API
   // entrypoint.
   grpc_core::ExecCtx exec_ctx;
-  gpr_log(GPR_INFO, "Ack %" PRId64 " bytes received", num_bytes);
+  gpr_log(GPR_DEBUG, "Ack %" PRId64 " bytes received", num_bytes);
   if (is_transacting_) {
     // This can happen because NDK might call our registered callback function
     // in the same thread while we are telling it to send a transaction
@@ -322,7 +322,7 @@ void WireWriterImpl::OnAckReceived(int64_t num_bytes) {
   // Ensure combiner will be run if this is not called from top-level gRPC API
   // entrypoint.
   grpc_core::ExecCtx exec_ctx;
-  gpr_log(GPR_INFO, "OnAckReceived %" PRId64, num_bytes);
+  gpr_log(GPR_DEBUG, "OnAckReceived %" PRId64, num_bytes);
   // Do not try to obtain `write_mu_` in this function. NDKBinder might invoke
   // the callback to notify us about new incoming binder transaction when we are
   // sending transaction. i.e. `write_mu_` might have already been acquired by
@@ -24,6 +24,8 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -145,7 +147,8 @@ class Chttp2ServerListener : public Server::ListenerInterface {
    public:
     class HandshakingState : public InternallyRefCounted<HandshakingState> {
      public:
-      HandshakingState(RefCountedPtr<ActiveConnection> connection_ref,
+      HandshakingState(Chttp2ServerListener* listener,
+                       RefCountedPtr<ActiveConnection> connection_ref,
                        grpc_pollset* accepting_pollset,
                        grpc_tcp_server_acceptor* acceptor,
                        const ChannelArgs& args);
@@ -164,6 +167,8 @@ class Chttp2ServerListener : public Server::ListenerInterface {
       static void OnTimeout(void* arg, grpc_error_handle error);
       static void OnReceiveSettings(void* arg, grpc_error_handle /* error */);
       static void OnHandshakeDone(void* arg, grpc_error_handle error);
+      // Only used to maintain pending_handshakes_, so not a ref.
+      Chttp2ServerListener* const listener_;
       RefCountedPtr<ActiveConnection> const connection_;
       grpc_pollset* const accepting_pollset_;
       grpc_tcp_server_acceptor* acceptor_;
@@ -177,7 +182,8 @@ class Chttp2ServerListener : public Server::ListenerInterface {
       grpc_pollset_set* const interested_parties_;
     };
 
-    ActiveConnection(grpc_pollset* accepting_pollset,
+    ActiveConnection(Chttp2ServerListener* listener,
+                     grpc_pollset* accepting_pollset,
                      grpc_tcp_server_acceptor* acceptor,
                      const ChannelArgs& args, MemoryOwner memory_owner);
     ~ActiveConnection() override;
@@ -278,6 +284,10 @@ class Chttp2ServerListener : public Server::ListenerInterface {
   grpc_closure* on_destroy_done_ ABSL_GUARDED_BY(mu_) = nullptr;
   RefCountedPtr<channelz::ListenSocketNode> channelz_listen_socket_;
   MemoryQuotaRefPtr memory_quota_;
+  // Admission control for new connections, see
+  // GRPC_ARG_SERVER_MAX_PENDING_HANDSHAKES.
+  const int max_pending_handshakes_;
+  std::atomic<int> pending_handshakes_{0};
 };
 
 //
@@ -365,15 +375,18 @@ Timestamp GetConnectionDeadline(const ChannelArgs& args) {
 }
 
 Chttp2ServerListener::ActiveConnection::HandshakingState::HandshakingState(
+    Chttp2ServerListener* listener,
     RefCountedPtr<ActiveConnection> connection_ref,
     grpc_pollset* accepting_pollset, grpc_tcp_server_acceptor* acceptor,
     const ChannelArgs& args)
-    : connection_(std::move(connection_ref)),
+    : listener_(listener),
+      connection_(std::move(connection_ref)),
       accepting_pollset_(accepting_pollset),
       acceptor_(acceptor),
       handshake_mgr_(MakeRefCounted<HandshakeManager>()),
       deadline_(GetConnectionDeadline(args)),
       interested_parties_(grpc_pollset_set_create()) {
+  listener_->pending_handshakes_.fetch_add(1, std::memory_order_relaxed);
   grpc_pollset_set_add_pollset(interested_parties_, accepting_pollset_);
   CoreConfiguration::Get().handshaker_registry().AddHandshakers(
       HANDSHAKER_SERVER, args, interested_parties_, handshake_mgr_.get());
@@ -383,6 +396,7 @@ Chttp2ServerListener::ActiveConnection::HandshakingState::~HandshakingState() {
   grpc_pollset_set_del_pollset(interested_parties_, accepting_pollset_);
   grpc_pollset_set_destroy(interested_parties_);
   gpr_free(acceptor_);
+  listener_->pending_handshakes_.fetch_sub(1, std::memory_order_relaxed);
 }
 
 void Chttp2ServerListener::ActiveConnection::HandshakingState::Orphan() {
@@ -547,10 +561,11 @@ void Chttp2ServerListener::ActiveConnection::HandshakingState::OnHandshakeDone(
 //
 
 Chttp2ServerListener::ActiveConnection::ActiveConnection(
-    grpc_pollset* accepting_pollset, grpc_tcp_server_acceptor* acceptor,
-    const ChannelArgs& args, MemoryOwner memory_owner)
+    Chttp2ServerListener* listener, grpc_pollset* accepting_pollset,
+    grpc_tcp_server_acceptor* acceptor, const ChannelArgs& args,
+    MemoryOwner memory_owner)
     : handshaking_state_(memory_owner.MakeOrphanable<HandshakingState>(
-          Ref(), accepting_pollset, acceptor, args)) {
+          listener, Ref(), accepting_pollset, acceptor, args)) {
   GRPC_CLOSURE_INIT(&on_close_, ActiveConnection::OnClose, this,
                     grpc_schedule_on_exec_ctx);
 }
@@ -745,7 +760,10 @@ Chttp2ServerListener::Chttp2ServerListener(
     : server_(server),
       args_modifier_(args_modifier),
       args_(args),
-      memory_quota_(args.GetObject<ResourceQuota>()->memory_quota()) {
+      memory_quota_(args.GetObject<ResourceQuota>()->memory_quota()),
+      max_pending_handshakes_(
+          std::max(1, args.GetInt(GRPC_ARG_SERVER_MAX_PENDING_HANDSHAKES)
+                          .value_or(std::numeric_limits<int>::max()))) {
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
 }
@@ -828,10 +846,20 @@ void Chttp2ServerListener::OnAccept(void* arg, grpc_endpoint* tcp,
       return;
     }
   }
+  // Shed the connection before doing any handshaking work if we are already
+  // handshaking as many connections as allowed, or are short of memory.
+  if (self->pending_handshakes_.load(std::memory_order_relaxed) >=
+          self->max_pending_handshakes_ ||
+      self->memory_quota_->IsMemoryPressureHigh()) {
+    gpr_log(GPR_DEBUG, "Closing connection from %s: server overloaded",
+            std::string(grpc_endpoint_get_peer(tcp)).c_str());
+    endpoint_cleanup(GRPC_ERROR_CREATE("Server overloaded"));
+    return;
+  }
   auto memory_owner = self->memory_quota_->CreateMemoryOwner(
       absl::StrCat(grpc_endpoint_get_peer(tcp), ":server_channel"));
   auto connection = memory_owner.MakeOrphanable<ActiveConnection>(
-      accepting_pollset, acceptor, args, std::move(memory_owner));
+      self, accepting_pollset, acceptor, args, std::move(memory_owner));
   // We no longer own acceptor
   acceptor = nullptr;
   // Hold a ref to connection to allow starting handshake outside the
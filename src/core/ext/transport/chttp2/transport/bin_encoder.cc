@@ -23,18 +23,22 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <new>
+
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/lib/slice/slice_refcount.h"
 
-static const char alphabet[] =
+static constexpr char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
 struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -49,6 +53,24 @@ static const b64_huff_sym huff_alphabet[64] = {
 
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
+namespace {
+
+// Both base64 symbols for each 12 bits of input, so that a triplet is
+// encoded with two lookups rather than four.
+struct B64Pairs {
+  constexpr B64Pairs() : chars() {
+    for (int i = 0; i < 4096; ++i) {
+      chars[i][0] = alphabet[i >> 6];
+      chars[i][1] = alphabet[i & 0x3f];
+    }
+  }
+  char chars[4096][2];
+};
+
+constexpr B64Pairs kB64Pairs;
+
+}  // namespace
+
 grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
   size_t input_triplets = input_length / 3;
@@ -61,10 +83,10 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
 
   /* encode full triplets */
   for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    memcpy(out, kB64Pairs.chars[triplet >> 12], 2);
+    memcpy(out + 2, kB64Pairs.chars[triplet & 0xfff], 2);
     out += 4;
     in += 3;
   }
@@ -93,77 +115,94 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
-  }
+namespace {
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+// Huffman codes of every pair of base64 symbols, indexed by the 12 bits of
+// input that the pair encodes. Each entry holds the concatenated code in its
+// low 24 bits and the code length above them.
+struct B64HuffPairs {
+  constexpr B64HuffPairs() : codes() {
+    for (int i = 0; i < 4096; ++i) {
+      const b64_huff_sym a = huff_alphabet[i >> 6];
+      const b64_huff_sym b = huff_alphabet[i & 0x3f];
+      codes[i] = (static_cast<uint32_t>(a.length + b.length) << 24) |
+                 (static_cast<uint32_t>(a.bits) << b.length) | b.bits;
     }
   }
+  uint32_t codes[4096];
+};
+
+constexpr B64HuffPairs kB64HuffPairs;
 
-  if (temp_length) {
-    /* NB: the following integer arithmetic operation needs to be in its
-     * expanded form due to the "integral promotion" performed (see section
-     * 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-     * is then required to avoid the compiler warning */
-    *out++ =
-        static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
-                             static_cast<uint8_t>(0xffu >> temp_length));
+// Packs huffman codes into bytes, storing 32 bits at a time rather than
+// flushing a byte per symbol.
+class HuffWriter {
+ public:
+  explicit HuffWriter(uint8_t* out) : out_(out) {}
+
+  // Appends the low \a length bits of \a bits; \a length is at most 32.
+  void Add(uint32_t bits, uint32_t length) {
+    temp_ = (temp_ << length) | bits;
+    temp_length_ += length;
+    if (temp_length_ >= 32) {
+      temp_length_ -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp_ >> temp_length_);
+      out_[0] = static_cast<uint8_t>(word >> 24);
+      out_[1] = static_cast<uint8_t>(word >> 16);
+      out_[2] = static_cast<uint8_t>(word >> 8);
+      out_[3] = static_cast<uint8_t>(word);
+      out_ += 4;
+    }
   }
 
-  GPR_ASSERT(out == GRPC_SLICE_END_PTR(output));
+  void AddPair(uint32_t index) {
+    const uint32_t code = kB64HuffPairs.codes[index];
+    Add(code & 0xffffff, code >> 24);
+  }
 
-  return output;
-}
+  // Writes the pending bits, padding the last byte with the most significant
+  // bits of EOS (all ones), and returns the end of the output.
+  uint8_t* Finish() {
+    while (temp_length_ >= 8) {
+      temp_length_ -= 8;
+      *out_++ = static_cast<uint8_t>(temp_ >> temp_length_);
+    }
+    if (temp_length_) {
+      *out_++ = static_cast<uint8_t>(
+          static_cast<uint8_t>(temp_ << (8u - temp_length_)) |
+          static_cast<uint8_t>(0xffu >> temp_length_));
+    }
+    return out_;
+  }
 
-struct huff_out {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
+ private:
+  // Only the low temp_length_ bits (always fewer than 32 between calls) are
+  // pending; higher bits were already written.
+  uint64_t temp_ = 0;
+  uint32_t temp_length_ = 0;
+  uint8_t* out_;
 };
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+
+}  // namespace
+
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  size_t nbits = 0;
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    nbits += grpc_chttp2_huffsyms[*in].length;
   }
-}
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
-}
+  grpc_slice output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
+  HuffWriter out(GRPC_SLICE_START_PTR(output));
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    out.Add(sym.bits, sym.length);
+  }
 
-static void enc_add1(huff_out* out, uint8_t a) {
-  b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+  GPR_ASSERT(out.Finish() == GRPC_SLICE_END_PTR(output));
+
+  return output;
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -177,22 +216,16 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   grpc_slice output = GRPC_SLICE_MALLOC(max_output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
-  huff_out out;
+  HuffWriter out(start_out);
   size_t i;
 
-  out.temp = 0;
-  out.temp_length = 0;
-  out.out = start_out;
-
-  /* encode full triplets */
+  /* encode full triplets: each half of the 24 input bits is a pair of base64
+   * symbols */
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    out.AddPair(triplet >> 12);
+    out.AddPair(triplet & 0xfff);
     in += 3;
   }
 
@@ -201,32 +234,86 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4));
+      out.AddPair(static_cast<uint32_t>(in[0]) << 4);
       in += 1;
       break;
     case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
-      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2));
+      const uint32_t pair = (static_cast<uint32_t>(in[0]) << 8) | in[1];
+      out.AddPair(pair >> 4);
+      const b64_huff_sym last = huff_alphabet[(in[1] & 0xf) << 2];
+      out.Add(last.bits, last.length);
       in += 2;
       break;
     }
   }
 
-  if (out.temp_length) {
-    /* NB: the following integer arithmetic operation needs to be in its
-     * expanded form due to the "integral promotion" performed (see section
-     * 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-     * is then required to avoid the compiler warning */
-    *out.out++ = static_cast<uint8_t>(
-        static_cast<uint8_t>(out.temp << (8u - out.temp_length)) |
-        static_cast<uint8_t>(0xffu >> out.temp_length));
-  }
-
-  GPR_ASSERT(out.out <= GRPC_SLICE_END_PTR(output));
-  GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
+  uint8_t* end_out = out.Finish();
+  GPR_ASSERT(end_out <= GRPC_SLICE_END_PTR(output));
+  GRPC_SLICE_SET_LENGTH(output, end_out - start_out);
 
   GPR_ASSERT(in == GRPC_SLICE_END_PTR(input));
   return output;
 }
+
+namespace {
+
+// Storage behind grpc_chttp2_slice_with_base64_huffman_form(): the refcount
+// is followed by the decoded bytes and then by the wire form.
+struct WireFormRefcount {
+  WireFormRefcount(size_t decoded_length, size_t wire_length)
+      : base(Destroy),
+        decoded_length(decoded_length),
+        wire_length(wire_length) {}
+
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* self = reinterpret_cast<WireFormRefcount*>(p);
+    self->~WireFormRefcount();
+    gpr_free(self);
+  }
+
+  uint8_t* decoded() { return reinterpret_cast<uint8_t*>(this + 1); }
+  uint8_t* wire() { return decoded() + decoded_length; }
+
+  grpc_slice_refcount base;
+  const size_t decoded_length;
+  const size_t wire_length;
+};
+
+}  // namespace
+
+grpc_slice grpc_chttp2_slice_with_base64_huffman_form(const uint8_t* decoded,
+                                                      size_t decoded_length,
+                                                      const uint8_t* wire,
+                                                      size_t wire_length) {
+  auto* storage = new (gpr_malloc(sizeof(WireFormRefcount) + decoded_length +
+                                  wire_length))
+      WireFormRefcount(decoded_length, wire_length);
+  if (decoded_length > 0) memcpy(storage->decoded(), decoded, decoded_length);
+  if (wire_length > 0) memcpy(storage->wire(), wire, wire_length);
+  grpc_slice slice;
+  slice.refcount = &storage->base;
+  slice.data.refcounted.bytes = storage->decoded();
+  slice.data.refcounted.length = decoded_length;
+  return slice;
+}
+
+bool grpc_chttp2_get_base64_huffman_form(const grpc_slice& input,
+                                         grpc_slice* output) {
+  grpc_slice_refcount* refcount = input.refcount;
+  if (refcount == nullptr ||
+      refcount == grpc_slice_refcount::NoopRefcount() ||
+      refcount->destroyer_fn() != WireFormRefcount::Destroy) {
+    return false;
+  }
+  auto* storage = reinterpret_cast<WireFormRefcount*>(refcount);
+  // A sub-slice has a different value than the wire form.
+  if (input.data.refcounted.bytes != storage->decoded() ||
+      input.data.refcounted.length != storage->decoded_length) {
+    return false;
+  }
+  refcount->Ref();
+  output->refcount = refcount;
+  output->data.refcounted.bytes = storage->wire();
+  output->data.refcounted.length = storage->wire_length;
+  return true;
+}
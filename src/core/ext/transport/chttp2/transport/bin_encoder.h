@@ -21,6 +21,9 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <grpc/slice.h>
 
 /* base64 encode a slice. Returns a new slice, does not take ownership of the
@@ -39,4 +42,21 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input);
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     const grpc_slice& input);
 
+/* Returns a new slice holding the decoded value of a binary header that was
+   received huffman compressed and base64 encoded, together with \a wire,
+   the bytes it was received as, so that the value can be forwarded without
+   encoding it again: see grpc_chttp2_get_base64_huffman_form(). */
+grpc_slice grpc_chttp2_slice_with_base64_huffman_form(const uint8_t* decoded,
+                                                      size_t decoded_length,
+                                                      const uint8_t* wire,
+                                                      size_t wire_length);
+
+/* If \a input is a whole slice returned by
+   grpc_chttp2_slice_with_base64_huffman_form(), sets \a output to a new ref
+   to its huffman compressed base64 form (which is what
+   grpc_chttp2_base64_encode_and_huffman_compress() would produce, up to
+   padding) and returns true; otherwise returns false. */
+bool grpc_chttp2_get_base64_huffman_form(const grpc_slice& input,
+                                         grpc_slice* output);
+
 #endif /* GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BIN_ENCODER_H */
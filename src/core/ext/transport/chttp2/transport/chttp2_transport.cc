@@ -29,6 +29,7 @@
 #include <new>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/status/status.h"
@@ -59,6 +60,7 @@
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/event_log.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -69,6 +71,7 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/http/parser.h"
+#include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -147,6 +150,9 @@ static void continue_read_action_locked(grpc_chttp2_transport* t);
 static void queue_setting_update(grpc_chttp2_transport* t,
                                  grpc_chttp2_setting_id id, uint32_t value);
 
+// Adjust the advertised MAX_CONCURRENT_STREAMS to the current memory pressure
+static void maybe_adapt_max_concurrent_streams(grpc_chttp2_transport* t);
+
 static void close_from_api(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                            grpc_error_handle error);
 
@@ -177,6 +183,12 @@ static void next_bdp_ping_timer_expired(void* tp, grpc_error_handle error);
 static void next_bdp_ping_timer_expired_locked(void* tp,
                                                grpc_error_handle error);
 
+static bool cork_write(grpc_chttp2_transport* t,
+                       grpc_chttp2_initiate_write_reason reason);
+static void uncork_writes(grpc_chttp2_transport* t);
+static void write_cork_timer_expired(void* tp, grpc_error_handle error);
+static void write_cork_timer_expired_locked(void* tp, grpc_error_handle error);
+
 static void cancel_pings(grpc_chttp2_transport* t, grpc_error_handle error);
 static void send_ping_locked(grpc_chttp2_transport* t,
                              grpc_closure* on_initiate, grpc_closure* on_ack);
@@ -185,6 +197,7 @@ static void retry_initiate_ping_locked(void* tp, grpc_error_handle error);
 // keepalive-relevant functions
 static void init_keepalive_ping(void* arg, grpc_error_handle error);
 static void init_keepalive_ping_locked(void* arg, grpc_error_handle error);
+static void schedule_keepalive_ping_timer(grpc_chttp2_transport* t);
 static void start_keepalive_ping(void* arg, grpc_error_handle error);
 static void finish_keepalive_ping(void* arg, grpc_error_handle error);
 static void start_keepalive_ping_locked(void* arg, grpc_error_handle error);
@@ -226,6 +239,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
   size_t i;
 
   if (channelz_socket != nullptr) {
+    channelz_socket->SetOptionsSource(nullptr);
     channelz_socket.reset();
   }
 
@@ -263,6 +277,12 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
     write_cb_pool = next;
   }
 
+  while (slice_array_pool) {
+    grpc_chttp2_pooled_slice_array* next = slice_array_pool->next;
+    gpr_free(slice_array_pool);
+    slice_array_pool = next;
+  }
+
   gpr_free(ping_acks);
   if (grpc_core::test_only_destruct_callback != nullptr) {
     grpc_core::test_only_destruct_callback();
@@ -274,6 +294,8 @@ static const grpc_transport_vtable* get_vtable(void);
 static void read_channel_args(grpc_chttp2_transport* t,
                               const grpc_core::ChannelArgs& channel_args,
                               bool is_client) {
+  t->connection_rtt = channel_args.GetObjectRef<grpc_core::ConnectionRtt>();
+
   const int initial_sequence_number =
       channel_args.GetInt(GRPC_ARG_HTTP2_INITIAL_SEQUENCE_NUMBER).value_or(-1);
   if (initial_sequence_number > 0) {
@@ -291,6 +313,16 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  t->hpack_compressor.SetIndexHotMetadata(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_INDEX_HOT_METADATA)
+          .value_or(false));
+  t->write_cork_delay = grpc_core::Duration::MicrosecondsRoundUp(
+      grpc_core::Clamp(
+          channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_CORK_DELAY_US).value_or(0),
+          0, 10000));
+  if (channel_args.GetBool(GRPC_ARG_HTTP2_BDP_MEMORY_BUDGET).value_or(false)) {
+    t->flow_control.EnableBdpMemoryBudget();
+  }
 
   t->ping_policy.max_pings_without_data =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA)
@@ -332,6 +364,12 @@ static void read_channel_args(grpc_chttp2_transport* t,
             absl::StrFormat("%s %s", get_vtable()->name, t->peer_string),
             channel_args
                 .GetObjectRef<grpc_core::channelz::SocketNode::Security>());
+    // The source is reset in the destructor, before ep is destroyed.
+    t->channelz_socket->SetOptionsSource([ep = t->ep]() {
+      std::vector<std::pair<std::string, std::string>> options;
+      grpc_endpoint_get_socket_options(ep, &options);
+      return options;
+    });
   }
 
   static const struct {
@@ -393,6 +431,16 @@ static void read_channel_args(grpc_chttp2_transport* t,
               is_client ? "clients" : "servers");
     }
   }
+  if (!is_client &&
+      channel_args.GetBool(GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS)
+          .value_or(false)) {
+    t->adaptive_max_concurrent_streams = true;
+    t->configured_max_concurrent_streams =
+        t->settings[GRPC_LOCAL_SETTINGS]
+                   [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
+  }
+  t->pipeline_reads =
+      channel_args.GetBool(GRPC_ARG_HTTP2_PIPELINE_READS).value_or(false);
 }
 
 static void init_transport_keepalive_settings(grpc_chttp2_transport* t) {
@@ -432,12 +480,8 @@ static void configure_transport_ping_policy(grpc_chttp2_transport* t) {
 static void init_keepalive_pings_if_enabled(grpc_chttp2_transport* t) {
   if (t->keepalive_time != grpc_core::Duration::Infinity()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
-    GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-    GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
-                      grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::Timestamp::Now() + t->keepalive_time,
-                    &t->init_keepalive_ping_locked);
+    t->keepalive_last_activity = grpc_core::Timestamp::Now();
+    schedule_keepalive_ping_timer(t);
   } else {
     // Use GRPC_CHTTP2_KEEPALIVE_STATE_DISABLED to indicate there are no
     //   inflight keeaplive timers
@@ -479,6 +523,15 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   //   TODO(ctiller): tune this
   grpc_chttp2_stream_map_init(&stream_map, 8);
 
+  // The endpoint reports the timestamps of traced writes to the ContextList
+  // that the transport passes along with them.
+  static const bool kTimestampsCallbackSet = [] {
+    grpc_core::grpc_tcp_set_write_timestamps_callback(
+        grpc_core::ContextList::Execute);
+    return true;
+  }();
+  (void)kTimestampsCallbackSet;
+
   grpc_slice_buffer_init(&read_buffer);
   grpc_slice_buffer_init(&outbuf);
   if (is_client) {
@@ -581,6 +634,9 @@ static void close_transport_locked(grpc_chttp2_transport* t,
     if (t->have_next_bdp_ping_timer) {
       grpc_timer_cancel(&t->next_bdp_ping_timer);
     }
+    if (t->have_write_cork_timer) {
+      grpc_timer_cancel(&t->write_cork_timer);
+    }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         grpc_timer_cancel(&t->keepalive_ping_timer);
@@ -638,6 +694,49 @@ grpc_chttp2_stream::Reffer::Reffer(grpc_chttp2_stream* s) {
   GRPC_CHTTP2_REF_TRANSPORT(s->t, "stream");
 }
 
+static_assert(sizeof(grpc_chttp2_pooled_slice_array) <= sizeof(grpc_slice),
+              "pooled slice arrays must fit in their first slice");
+
+// Hands a slice array left over by a destroyed stream to \a sb, unless \a sb
+// has grown one of its own already. Must be called under the combiner.
+static void take_pooled_slice_array(grpc_chttp2_transport* t,
+                                    grpc_slice_buffer* sb) {
+  grpc_chttp2_pooled_slice_array* array = t->slice_array_pool;
+  if (array == nullptr || sb->base_slices != sb->inlined) return;
+  t->slice_array_pool = array->next;
+  --t->slice_array_pool_size;
+  size_t capacity = array->capacity;
+  grpc_slice* slices = reinterpret_cast<grpc_slice*>(array);
+  memcpy(slices, sb->slices, sb->count * sizeof(grpc_slice));
+  sb->base_slices = sb->slices = slices;
+  sb->capacity = capacity;
+}
+
+static void take_pooled_slice_arrays(grpc_chttp2_transport* t,
+                                     grpc_chttp2_stream* s) {
+  take_pooled_slice_array(t, &s->frame_storage);
+  take_pooled_slice_array(t, &s->flow_controlled_buffer);
+}
+
+// Destroys \a sb, keeping the slice array it grew (if any) for the buffers of
+// a later stream. Must be called under the combiner.
+static void recycle_slice_buffer(grpc_chttp2_transport* t,
+                                 grpc_slice_buffer* sb) {
+  grpc_slice_buffer_reset_and_unref(sb);
+  if (sb->base_slices != sb->inlined &&
+      sb->capacity <= GRPC_CHTTP2_MAX_POOLED_SLICE_ARRAY_CAPACITY &&
+      t->slice_array_pool_size < GRPC_CHTTP2_MAX_POOLED_SLICE_ARRAYS) {
+    grpc_chttp2_pooled_slice_array* array =
+        reinterpret_cast<grpc_chttp2_pooled_slice_array*>(sb->base_slices);
+    array->capacity = sb->capacity;
+    array->next = t->slice_array_pool;
+    t->slice_array_pool = array;
+    ++t->slice_array_pool_size;
+    grpc_slice_buffer_init(sb);
+  }
+  grpc_slice_buffer_destroy(sb);
+}
+
 grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
                                        grpc_stream_refcount* refcount,
                                        const void* server_data,
@@ -657,6 +756,11 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
 
   grpc_slice_buffer_init(&frame_storage);
   grpc_slice_buffer_init(&flow_controlled_buffer);
+  // Server streams are created under the combiner; client streams pick up
+  // pooled slice arrays when their initial metadata is sent.
+  if (server_data) {
+    take_pooled_slice_arrays(t, this);
+  }
 }
 
 grpc_chttp2_stream::~grpc_chttp2_stream() {
@@ -676,7 +780,7 @@ grpc_chttp2_stream::~grpc_chttp2_stream() {
     GPR_ASSERT(grpc_chttp2_stream_map_find(&t->stream_map, id) == nullptr);
   }
 
-  grpc_slice_buffer_destroy(&frame_storage);
+  recycle_slice_buffer(t, &frame_storage);
 
   for (int i = 0; i < STREAM_LIST_COUNT; i++) {
     if (GPR_UNLIKELY(included.is_set(i))) {
@@ -691,7 +795,7 @@ grpc_chttp2_stream::~grpc_chttp2_stream() {
   GPR_ASSERT(recv_initial_metadata_ready == nullptr);
   GPR_ASSERT(recv_message_ready == nullptr);
   GPR_ASSERT(recv_trailing_metadata_finished == nullptr);
-  grpc_slice_buffer_destroy(&flow_controlled_buffer);
+  recycle_slice_buffer(t, &flow_controlled_buffer);
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "stream");
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, destroy_stream_arg, absl::OkStatus());
 }
@@ -777,6 +881,8 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   switch (t->write_state) {
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
+      if (cork_write(t, reason)) break;
+      uncork_writes(t);
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
       GRPC_CHTTP2_REF_TRANSPORT(t, "writing");
@@ -810,6 +916,61 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
   }
 }
 
+// Holds back a write requested by \a reason on an idle transport until the
+// cork timer fires, so that messages other streams send in the meantime go
+// out with it. Returns false if the write should start now.
+static bool cork_write(grpc_chttp2_transport* t,
+                       grpc_chttp2_initiate_write_reason reason) {
+  if (t->write_cork_delay == grpc_core::Duration::Zero() ||
+      reason != GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE) {
+    return false;
+  }
+  ++t->corked_write_requests;
+  if (!t->have_write_cork_timer) {
+    t->have_write_cork_timer = true;
+    grpc_core::global_stats().IncrementHttp2WritesCorked();
+    GRPC_CHTTP2_REF_TRANSPORT(t, "write_cork");
+    GRPC_CLOSURE_INIT(&t->write_cork_timer_expired_locked,
+                      write_cork_timer_expired, t, grpc_schedule_on_exec_ctx);
+    grpc_timer_init(&t->write_cork_timer,
+                    grpc_core::Timestamp::Now() + t->write_cork_delay,
+                    &t->write_cork_timer_expired_locked);
+  }
+  return true;
+}
+
+// A write is starting: it carries every held back message along.
+static void uncork_writes(grpc_chttp2_transport* t) {
+  if (t->corked_write_requests == 0) return;
+  grpc_core::global_stats().IncrementHttp2CorkBatchSize(
+      t->corked_write_requests);
+  t->corked_write_requests = 0;
+  if (t->have_write_cork_timer) {
+    grpc_timer_cancel(&t->write_cork_timer);
+  }
+}
+
+static void write_cork_timer_expired(void* tp, grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->combiner->Run(
+      GRPC_CLOSURE_INIT(&t->write_cork_timer_expired_locked,
+                        write_cork_timer_expired_locked, t, nullptr),
+      error);
+}
+
+static void write_cork_timer_expired_locked(void* tp,
+                                            grpc_error_handle /*error*/) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  GPR_ASSERT(t->have_write_cork_timer);
+  t->have_write_cork_timer = false;
+  // Requests may have been held back after the timer was cancelled by a
+  // write that has already finished.
+  if (t->corked_write_requests > 0) {
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_CORK_TIMER);
+  }
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "write_cork");
+}
+
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s) {
   if (t->closed_with_error.ok() && grpc_chttp2_list_add_writable_stream(t, s)) {
@@ -874,6 +1035,7 @@ static void write_action(void* gt, grpc_error_handle /*error*/) {
           ? 2 * t->settings[GRPC_PEER_SETTINGS]
                            [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE]
           : INT_MAX;
+  grpc_core::FlightRecorder::Record("chttp2-write-begin", t->outbuf.length);
   grpc_endpoint_write(
       t->ep, &t->outbuf,
       GRPC_CLOSURE_INIT(&t->write_action_end_locked, write_action_end, t,
@@ -952,6 +1114,39 @@ static void queue_setting_update(grpc_chttp2_transport* t,
   }
 }
 
+static void maybe_adapt_max_concurrent_streams(grpc_chttp2_transport* t) {
+  if (!t->adaptive_max_concurrent_streams) return;
+  // Start shrinking the limit at this pressure, and restore it below the
+  // lower one, so that we do not flap between the two.
+  static constexpr double kShrinkPressure = 0.8;
+  static constexpr double kRestorePressure = 0.5;
+  const double pressure =
+      t->memory_owner.GetPressureInfo().pressure_control_value;
+  const uint32_t current =
+      t->settings[GRPC_LOCAL_SETTINGS]
+                 [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
+  uint32_t target;
+  if (pressure >= kShrinkPressure) {
+    // Allow no more streams than are open now, scaled down towards a single
+    // stream as pressure approaches 1.
+    const double scale =
+        std::max(0.0, (1.0 - pressure) / (1.0 - kShrinkPressure));
+    const double open = static_cast<double>(
+        std::min<size_t>(grpc_chttp2_stream_map_size(&t->stream_map),
+                         t->configured_max_concurrent_streams));
+    target = std::max<uint32_t>(1, static_cast<uint32_t>(open * scale));
+    // Only send a SETTINGS frame for a cut of at least a quarter.
+    if (target > current - current / 4) return;
+  } else if (pressure < kRestorePressure) {
+    target = t->configured_max_concurrent_streams;
+    if (target == current) return;
+  } else {
+    return;
+  }
+  queue_setting_update(t, GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, target);
+  grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+}
+
 // Cancel out streams that haven't yet started if we have received a GOAWAY
 static void cancel_unstarted_streams(grpc_chttp2_transport* t,
                                      grpc_error_handle error) {
@@ -1221,8 +1416,11 @@ static void perform_stream_op_locked(void* stream_op,
   }
 
   if (op->send_initial_metadata) {
-    if (t->is_client && t->channelz_socket != nullptr) {
-      t->channelz_socket->RecordStreamStartedFromLocal();
+    if (t->is_client) {
+      take_pooled_slice_arrays(t, s);
+      if (t->channelz_socket != nullptr) {
+        t->channelz_socket->RecordStreamStartedFromLocal();
+      }
     }
     GPR_ASSERT(s->send_initial_metadata_finished == nullptr);
     on_complete->next_data.scratch |= CLOSURE_BARRIER_MAY_COVER_WRITE;
@@ -1239,6 +1437,11 @@ static void perform_stream_op_locked(void* stream_op,
     if (contains_non_ok_status(s->send_initial_metadata)) {
       s->seen_error = true;
     }
+    if (auto weight = s->send_initial_metadata->get(
+            grpc_core::GrpcStreamWriteWeight())) {
+      s->write_weight = grpc_core::Clamp(*weight, uint32_t{1},
+                                         GRPC_CHTTP2_MAX_STREAM_WRITE_WEIGHT);
+    }
     if (!s->write_closed) {
       if (t->is_client) {
         if (t->closed_with_error.ok()) {
@@ -1408,6 +1611,7 @@ static void perform_stream_op_locked(void* stream_op,
     s->recv_message = op_payload->recv_message.recv_message;
     s->recv_message->emplace();
     s->recv_message_flags = op_payload->recv_message.flags;
+    s->recv_message_allow_partial = op_payload->recv_message.allow_partial;
     s->call_failed_before_recv_message =
         op_payload->recv_message.call_failed_before_recv_message;
     grpc_chttp2_maybe_complete_recv_trailing_metadata(t, s);
@@ -1807,17 +2011,20 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
     if (s->final_metadata_requested && s->seen_error) {
       grpc_slice_buffer_reset_and_unref(&s->frame_storage);
       s->recv_message->reset();
+      s->partial_message_remaining = 0;
     } else {
       if (s->frame_storage.length != 0) {
         while (true) {
           GPR_ASSERT(s->frame_storage.length > 0);
           int64_t min_progress_size;
           auto r = grpc_deframe_unprocessed_incoming_frames(
-              s, &min_progress_size, &**s->recv_message, s->recv_message_flags);
+              s, &min_progress_size, &**s->recv_message, s->recv_message_flags,
+              s->recv_message_allow_partial);
           if (absl::holds_alternative<grpc_core::Pending>(r)) {
             if (s->read_closed) {
               grpc_slice_buffer_reset_and_unref(&s->frame_storage);
               s->recv_message->reset();
+              s->partial_message_remaining = 0;
               break;
             } else {
               upd.SetMinProgressSize(min_progress_size);
@@ -1839,8 +2046,11 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
         }
       } else if (s->read_closed) {
         s->recv_message->reset();
+        s->partial_message_remaining = 0;
       } else {
-        upd.SetMinProgressSize(GRPC_HEADER_SIZE_IN_BYTES);
+        upd.SetMinProgressSize(s->partial_message_remaining > 0
+                                   ? 1
+                                   : GRPC_HEADER_SIZE_IN_BYTES);
         return;  // Out of lambda to enclosing function
       }
     }
@@ -2300,7 +2510,7 @@ void grpc_chttp2_act_on_flowctl_action(
               });
 }
 
-static grpc_error_handle try_http_parsing(grpc_chttp2_transport* t) {
+static grpc_error_handle try_http_parsing(grpc_slice_buffer* read_buffer) {
   grpc_http_parser parser;
   size_t i = 0;
   grpc_error_handle error;
@@ -2309,9 +2519,9 @@ static grpc_error_handle try_http_parsing(grpc_chttp2_transport* t) {
   grpc_http_parser_init(&parser, GRPC_HTTP_RESPONSE, &response);
 
   grpc_error_handle parse_error;
-  for (; i < t->read_buffer.count && parse_error.ok(); i++) {
+  for (; i < read_buffer->count && parse_error.ok(); i++) {
     parse_error =
-        grpc_http_parser_parse(&parser, t->read_buffer.slices[i], nullptr);
+        grpc_http_parser_parse(&parser, read_buffer->slices[i], nullptr);
   }
   if (parse_error.ok() &&
       (parse_error = grpc_http_parser_eof(&parser)) == absl::OkStatus()) {
@@ -2345,14 +2555,33 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
         grpc_core::StatusIntProperty::kOccurredDuringWrite, t->write_state);
   }
   std::swap(err, error);
+  if (error.ok()) {
+    grpc_core::FlightRecorder::Record("chttp2-read", t->read_buffer.length);
+  }
+  // When pipelining, move the bytes that just arrived aside and get the
+  // endpoint working on the next read right away: it receives and decrypts
+  // them on its own thread while we parse these under the combiner. The
+  // combiner runs the next read_action_locked only after this one returns, so
+  // frames are still parsed in order.
+  grpc_slice_buffer* read_buffer = &t->read_buffer;
+  grpc_slice_buffer pipelined_buffer;
+  const bool read_in_flight =
+      t->pipeline_reads && error.ok() && t->closed_with_error.ok() &&
+      t->num_pending_induced_frames < DEFAULT_MAX_PENDING_INDUCED_FRAMES;
+  if (read_in_flight) {
+    grpc_slice_buffer_init(&pipelined_buffer);
+    grpc_slice_buffer_swap(&t->read_buffer, &pipelined_buffer);
+    read_buffer = &pipelined_buffer;
+    continue_read_action_locked(t);
+  }
   if (t->closed_with_error.ok()) {
     size_t i = 0;
     grpc_error_handle errors[3] = {error, absl::OkStatus(), absl::OkStatus()};
-    for (; i < t->read_buffer.count && errors[1] == absl::OkStatus(); i++) {
-      errors[1] = grpc_chttp2_perform_read(t, t->read_buffer.slices[i]);
+    for (; i < read_buffer->count && errors[1] == absl::OkStatus(); i++) {
+      errors[1] = grpc_chttp2_perform_read(t, read_buffer->slices[i]);
     }
     if (errors[1] != absl::OkStatus()) {
-      errors[2] = try_http_parsing(t);
+      errors[2] = try_http_parsing(read_buffer);
       error = GRPC_ERROR_CREATE_REFERENCING("Failed parsing HTTP/2", errors,
                                             GPR_ARRAY_SIZE(errors));
     }
@@ -2370,6 +2599,7 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
       }
       t->initial_window_update = 0;
     }
+    maybe_adapt_max_concurrent_streams(t);
   }
 
   bool keep_reading = false;
@@ -2388,10 +2618,17 @@ static void read_action_locked(void* tp, grpc_error_handle error) {
     t->endpoint_reading = 0;
   } else if (t->closed_with_error.ok()) {
     keep_reading = true;
-    // Since we have read a byte, reset the keepalive timer
-    if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING) {
-      grpc_timer_cancel(&t->keepalive_ping_timer);
-    }
+    // Since we have read a byte, push back the keepalive ping. The timer is
+    // left alone and re-armed for the remaining time when it fires, which is
+    // much cheaper than cancelling it on every read.
+    t->keepalive_last_activity = grpc_core::Timestamp::Now();
+  }
+  if (read_in_flight) {
+    grpc_slice_buffer_destroy(&pipelined_buffer);
+    // The read started above owns the "reading_action" ref now. If parsing
+    // closed the transport, the endpoint was shut down and that read fails,
+    // which releases the ref.
+    return;
   }
   grpc_slice_buffer_reset_and_unref(&t->read_buffer);
 
@@ -2415,8 +2652,11 @@ static void continue_read_action_locked(grpc_chttp2_transport* t) {
   const bool urgent = !t->goaway_error.ok();
   GRPC_CLOSURE_INIT(&t->read_action_locked, read_action, t,
                     grpc_schedule_on_exec_ctx);
-  grpc_endpoint_read(t->ep, &t->read_buffer, &t->read_action_locked, urgent,
-                     grpc_chttp2_min_read_progress_size(t));
+  // A pipelined read is started before the parser has seen the previous
+  // bytes, so it cannot tell how many more it needs.
+  grpc_endpoint_read(
+      t->ep, &t->read_buffer, &t->read_action_locked, urgent,
+      t->pipeline_reads ? 1 : grpc_chttp2_min_read_progress_size(t));
 }
 
 // t is reffed prior to calling the first time, and once the callback chain
@@ -2448,10 +2688,8 @@ static void start_bdp_ping_locked(void* tp, grpc_error_handle error) {
   if (!error.ok() || !t->closed_with_error.ok()) {
     return;
   }
-  // Reset the keepalive ping timer
-  if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING) {
-    grpc_timer_cancel(&t->keepalive_ping_timer);
-  }
+  // Push back the keepalive ping
+  t->keepalive_last_activity = grpc_core::Timestamp::Now();
   t->flow_control.bdp_estimator()->StartPing();
   t->bdp_ping_started = true;
 }
@@ -2484,6 +2722,10 @@ static void finish_bdp_ping_locked(void* tp, grpc_error_handle error) {
   t->bdp_ping_started = false;
   grpc_core::Timestamp next_ping =
       t->flow_control.bdp_estimator()->CompletePing();
+  if (t->connection_rtt != nullptr) {
+    t->connection_rtt->AddSample(
+        t->flow_control.bdp_estimator()->LastPingRtt());
+  }
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t,
                                     nullptr);
   GPR_ASSERT(!t->have_next_bdp_ping_timer);
@@ -2592,38 +2834,56 @@ static void init_keepalive_ping_locked(void* arg, grpc_error_handle error) {
   if (t->destroying || !t->closed_with_error.ok()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_DYING;
   } else if (error.ok()) {
-    if (t->keepalive_permit_without_calls ||
-        grpc_chttp2_stream_map_size(&t->stream_map) > 0) {
+    if (t->keepalive_last_activity + t->keepalive_time >
+        grpc_core::Timestamp::Now()) {
+      // We heard from the peer since the timer was armed, which proves the
+      // connection is alive as well as a ping would. Wait for the rest of
+      // the interval.
+      schedule_keepalive_ping_timer(t);
+    } else if (t->keepalive_permit_without_calls ||
+               grpc_chttp2_stream_map_size(&t->stream_map) > 0) {
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_PINGING;
       GRPC_CHTTP2_REF_TRANSPORT(t, "keepalive ping end");
       grpc_timer_init_unset(&t->keepalive_watchdog_timer);
       send_keepalive_ping_locked(t);
       grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_KEEPALIVE_PING);
     } else {
-      GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-      GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
-                        grpc_schedule_on_exec_ctx);
-      grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::Timestamp::Now() + t->keepalive_time,
-                      &t->init_keepalive_ping_locked);
+      t->keepalive_last_activity = grpc_core::Timestamp::Now();
+      schedule_keepalive_ping_timer(t);
     }
   } else if (error == absl::CancelledError()) {
-    // The keepalive ping timer may be cancelled by bdp
+    // Reads and BDP pings no longer cancel the timer, but keep re-arming it
+    // if something else does.
     if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace) ||
         GRPC_TRACE_FLAG_ENABLED(grpc_keepalive_trace)) {
       gpr_log(GPR_INFO, "%s: Keepalive ping cancelled. Resetting timer.",
               t->peer_string.c_str());
     }
-    GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-    GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
-                      grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::Timestamp::Now() + t->keepalive_time,
-                    &t->init_keepalive_ping_locked);
+    t->keepalive_last_activity = grpc_core::Timestamp::Now();
+    schedule_keepalive_ping_timer(t);
   }
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "init keepalive ping");
 }
 
+// Arms the keepalive timer for keepalive_time after the last activity. Long
+// intervals are rounded up to a whole second so that the timers of many idle
+// connections expire together instead of each waking the process on its own.
+static void schedule_keepalive_ping_timer(grpc_chttp2_transport* t) {
+  static constexpr int64_t kAlignMs = 1000;
+  grpc_core::Timestamp deadline =
+      t->keepalive_last_activity + t->keepalive_time;
+  if (t->keepalive_time >= grpc_core::Duration::Seconds(10)) {
+    const int64_t ms = deadline.milliseconds_after_process_epoch();
+    deadline = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        (ms + kAlignMs - 1) / kAlignMs * kAlignMs);
+  }
+  GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
+  GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
+                    grpc_schedule_on_exec_ctx);
+  grpc_timer_init(&t->keepalive_ping_timer, deadline,
+                  &t->init_keepalive_ping_locked);
+}
+
 static void start_keepalive_ping(void* arg, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
   t->combiner->Run(GRPC_CLOSURE_INIT(&t->start_keepalive_ping_locked,
@@ -2650,6 +2910,7 @@ static void start_keepalive_ping_locked(void* arg, grpc_error_handle error) {
                   grpc_core::Timestamp::Now() + t->keepalive_timeout,
                   &t->keepalive_watchdog_fired_locked);
   t->keepalive_ping_started = true;
+  t->keepalive_ping_start_time = gpr_now(GPR_CLOCK_MONOTONIC);
 }
 
 static void finish_keepalive_ping(void* arg, grpc_error_handle error) {
@@ -2679,12 +2940,14 @@ static void finish_keepalive_ping_locked(void* arg, grpc_error_handle error) {
       t->keepalive_ping_started = false;
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
       grpc_timer_cancel(&t->keepalive_watchdog_timer);
-      GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-      GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
-                        grpc_schedule_on_exec_ctx);
-      grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::Timestamp::Now() + t->keepalive_time,
-                      &t->init_keepalive_ping_locked);
+      if (t->connection_rtt != nullptr) {
+        t->connection_rtt->AddSample(gpr_timespec_to_micros(gpr_time_sub(
+                                         gpr_now(GPR_CLOCK_MONOTONIC),
+                                         t->keepalive_ping_start_time)) /
+                                     1e6);
+      }
+      t->keepalive_last_activity = grpc_core::Timestamp::Now();
+      schedule_keepalive_ping_timer(t);
     }
   }
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "keepalive ping end");
@@ -2705,6 +2968,11 @@ static void keepalive_watchdog_fired_locked(void* arg,
     if (error.ok()) {
       gpr_log(GPR_INFO, "%s: Keepalive watchdog fired. Closing transport.",
               t->peer_string.c_str());
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_keepalive_trace)) {
+        gpr_log(GPR_INFO, "%s: recent transport events:\n%s",
+                t->peer_string.c_str(),
+                grpc_core::FlightRecorder::Get()->DumpCsv().c_str());
+      }
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_DYING;
       close_transport_locked(
           t, grpc_error_set_int(GRPC_ERROR_CREATE("keepalive watchdog timeout"),
@@ -2905,6 +3173,8 @@ const char* grpc_chttp2_initiate_write_reason_string(
       return "PING_RESPONSE";
     case GRPC_CHTTP2_INITIATE_WRITE_FORCE_RST_STREAM:
       return "FORCE_RST_STREAM";
+    case GRPC_CHTTP2_INITIATE_WRITE_CORK_TIMER:
+      return "CORK_TIMER";
   }
   GPR_UNREACHABLE_CODE(return "unknown");
 }
@@ -22,6 +22,8 @@
 
 #include <stdint.h>
 
+#include <utility>
+
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 
 namespace {
@@ -44,11 +46,34 @@ void ContextList::Append(ContextList** head, grpc_chttp2_stream* s) {
   *head = elem;
 }
 
+void ContextList::Append(ContextList** head,
+                         std::shared_ptr<TcpTracerInterface> tcp_tracer,
+                         size_t byte_offset) {
+  ContextList* elem = new ContextList();
+  elem->tcp_tracer_ = std::move(tcp_tracer);
+  elem->byte_offset_ = byte_offset;
+  elem->next_ = *head;
+  *head = elem;
+}
+
 void ContextList::Execute(void* arg, Timestamps* ts, grpc_error_handle error) {
   ContextList* head = static_cast<ContextList*>(arg);
   ContextList* to_be_freed;
   while (head != nullptr) {
-    if (write_timestamps_callback_g) {
+    if (head->tcp_tracer_ != nullptr) {
+      if (ts != nullptr && error.ok()) {
+        using Type = TcpTracerInterface::Type;
+        TcpTracerInterface* tracer = head->tcp_tracer_.get();
+        tracer->RecordEvent(Type::kSendMsg, ts->sendmsg_time.time,
+                            head->byte_offset_);
+        tracer->RecordEvent(Type::kScheduled, ts->scheduled_time.time,
+                            head->byte_offset_);
+        tracer->RecordEvent(Type::kSent, ts->sent_time.time,
+                            head->byte_offset_);
+        tracer->RecordEvent(Type::kAcked, ts->acked_time.time,
+                            head->byte_offset_);
+      }
+    } else if (write_timestamps_callback_g) {
       if (ts) {
         ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
       }
@@ -23,7 +23,10 @@
 
 #include <stddef.h>
 
+#include <memory>
+
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/lib/channel/call_tracer.h"
 #include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/error.h"
 
@@ -35,6 +38,12 @@ class ContextList {
    * list. */
   static void Append(ContextList** head, grpc_chttp2_stream* s);
 
+  /* Appends an element that reports the timestamps to \a tcp_tracer rather
+   * than to the write timestamps callback. */
+  static void Append(ContextList** head,
+                     std::shared_ptr<TcpTracerInterface> tcp_tracer,
+                     size_t byte_offset);
+
   /* Executes a function \a fn with each context in the list and \a ts. It also
    * frees up the entire list after this operation. It is intended as a callback
    * and hence does not take a ref on \a error */
@@ -42,6 +51,7 @@ class ContextList {
 
  private:
   void* trace_context_ = nullptr;
+  std::shared_ptr<TcpTracerInterface> tcp_tracer_;
   ContextList* next_ = nullptr;
   size_t byte_offset_ = 0;
 };
@@ -144,8 +144,9 @@ absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
 
     tfc_upd_.UpdateAnnouncedWindowDelta(&sfc_->announced_window_delta_,
                                         -incoming_frame_size);
-    sfc_->min_progress_size_ -=
-        std::min(sfc_->min_progress_size_, incoming_frame_size);
+    sfc_->UpdateMinProgressSize(
+        sfc_->min_progress_size_ -
+        std::min(sfc_->min_progress_size_, incoming_frame_size));
     return absl::OkStatus();
   });
 }
@@ -166,10 +167,28 @@ absl::Status TransportFlowControl::IncomingUpdateContext::RecvData(
 int64_t TransportFlowControl::target_window() const {
   // See comment above announced_stream_total_over_incoming_window_ for the
   // logic behind this decision.
+  int64_t target = announced_stream_total_over_incoming_window_ +
+                   target_initial_window_size_;
+  if (bdp_memory_budget()) target = std::min(target, memory_budget());
   return static_cast<uint32_t>(
-      std::min(static_cast<int64_t>((1u << 31) - 1),
-               announced_stream_total_over_incoming_window_ +
-                   target_initial_window_size_));
+      std::min(static_cast<int64_t>((1u << 31) - 1), target));
+}
+
+int64_t TransportFlowControl::memory_budget() const {
+  return std::min(kMaxWindow, target_initial_window_size_ *
+                                  std::max(int64_t(1), busy_streams_));
+}
+
+int64_t TransportFlowControl::MaxStreamWindowDelta(int64_t stream_delta) const {
+  if (!bdp_memory_budget()) return kMaxWindowDelta;
+  // Lend the stream whatever part of the budget the other streams are not
+  // holding beyond their initial windows.
+  const int64_t others_over_initial_window =
+      announced_stream_total_over_incoming_window_ -
+      std::max(int64_t(0), stream_delta);
+  return Clamp(memory_budget() - target_initial_window_size_ -
+                   others_over_initial_window,
+               int64_t(0), kMaxWindow);
 }
 
 FlowControlAction TransportFlowControl::UpdateAction(FlowControlAction action) {
@@ -268,6 +287,25 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   }
 }
 
+double TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryBudgetAndBdp()
+    const {
+  // Twice the BDP keeps a stream flowing while window updates are in flight.
+  // Past 50% memory pressure the window shrinks linearly, down to a single
+  // frame per round trip at 100%.
+  const double bdp_window = bdp_estimator_.EstimateBdp() * 2.0;
+  const double memory_pressure =
+      memory_owner_->is_valid()
+          ? memory_owner_->GetPressureInfo().pressure_control_value
+          : 0.0;
+  const double kShrinkPressure = 0.5;
+  const double scale =
+      memory_pressure < kShrinkPressure
+          ? 1.0
+          : std::max(0.0, (1.0 - memory_pressure) / (1.0 - kShrinkPressure));
+  return Clamp(bdp_window * scale, double(kDefaultFrameSize),
+               double(kMaxInitialWindowSize));
+}
+
 void TransportFlowControl::UpdateSetting(
     grpc_chttp2_setting_id id, int64_t* desired_value,
     uint32_t new_desired_value, FlowControlAction* action,
@@ -304,7 +342,30 @@ void TransportFlowControl::UpdateSetting(
 
 FlowControlAction TransportFlowControl::PeriodicUpdate() {
   FlowControlAction action;
-  if (enable_bdp_probe_) {
+  if (bdp_memory_budget()) {
+    uint32_t target = static_cast<uint32_t>(RoundUpToPowerOf2(
+        TargetInitialWindowSizeBasedOnMemoryBudgetAndBdp()));
+    if (g_test_only_transport_target_window_estimates_mocker != nullptr) {
+      // Hook for simulating unusual flow control situations in tests.
+      target = g_test_only_transport_target_window_estimates_mocker
+                   ->ComputeNextTargetInitialWindowSizeFromPeriodicUpdate(
+                       target_initial_window_size_ /* current target */);
+    }
+    target = std::min(target, kMaxInitialWindowSize);
+    UpdateSetting(GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE,
+                  &target_initial_window_size_, target, &action,
+                  &FlowControlAction::set_send_initial_window_update);
+    UpdateSetting(GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE, &target_frame_size_,
+                  Clamp(target, kDefaultFrameSize, uint32_t(16777215)), &action,
+                  &FlowControlAction::set_send_max_frame_size_update);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_flowctl_trace)) {
+      gpr_log(GPR_INFO,
+              "%p budget: bdp=%" PRId64 " initial_window=%" PRId64
+              " busy_streams=%" PRId64 " budget=%" PRId64,
+              this, bdp_estimator_.EstimateBdp(), target_initial_window_size_,
+              busy_streams_, memory_budget());
+    }
+  } else if (enable_bdp_probe_) {
     if (IsFlowControlFixesEnabled()) {
       // get bdp estimate and update initial_window accordingly.
       // target might change based on how much memory pressure we are under
@@ -390,7 +451,8 @@ int64_t StreamFlowControl::DesiredAnnounceSize() const {
         return announced_window_delta_;
       }
     } else {
-      return std::min(min_progress_size_, kMaxWindowDelta);
+      return std::min(min_progress_size_,
+                      tfc_->MaxStreamWindowDelta(announced_window_delta_));
     }
   }();
   return Clamp(desired_window_delta - announced_window_delta_, int64_t(0),
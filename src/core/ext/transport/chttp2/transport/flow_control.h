@@ -154,6 +154,23 @@ class TransportFlowControl final {
 
   bool bdp_probe() const { return enable_bdp_probe_; }
 
+  // Sizes windows from a per-connection memory budget instead of the process
+  // wide memory pressure alone: every stream gets an initial window of twice
+  // the measured BDP, and the connection may have that much outstanding for
+  // each stream with a reader waiting for data (at least one). A waiting
+  // stream may be granted the part of the budget that other streams are not
+  // holding, and a stream stops counting towards the budget once its reader
+  // has what it asked for. Only takes effect with BDP probing enabled.
+  void EnableBdpMemoryBudget() { bdp_memory_budget_ = true; }
+  bool bdp_memory_budget() const {
+    return enable_bdp_probe_ && bdp_memory_budget_;
+  }
+  // Number of streams with a reader waiting for data.
+  int64_t busy_streams() const { return busy_streams_; }
+  // Bytes the peer may have outstanding on this connection in BDP memory
+  // budget mode.
+  int64_t memory_budget() const;
+
   // returns an announce if we should send a transport update to our peer,
   // else returns zero; writing_anyway indicates if a write would happen
   // regardless of the send - if it is false and this function returns non-zero,
@@ -255,6 +272,12 @@ class TransportFlowControl final {
   }
 
  private:
+  friend class StreamFlowControl;
+
+  // Largest window delta that may be announced for a stream whose current
+  // delta is \a stream_delta.
+  int64_t MaxStreamWindowDelta(int64_t stream_delta) const;
+  double TargetInitialWindowSizeBasedOnMemoryBudgetAndBdp() const;
   double TargetLogBdp();
   double SmoothLogBdp(double value);
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
@@ -280,6 +303,10 @@ class TransportFlowControl final {
 
   /** should we probe bdp? */
   const bool enable_bdp_probe_;
+  /** should windows be sized from a per-connection memory budget? */
+  bool bdp_memory_budget_ = false;
+  /** number of streams with min_progress_size > 0 */
+  int64_t busy_streams_ = 0;
 
   /* bdp estimation */
   BdpEstimator bdp_estimator_;
@@ -302,6 +329,7 @@ class StreamFlowControl final {
   explicit StreamFlowControl(TransportFlowControl* tfc);
   ~StreamFlowControl() {
     tfc_->RemoveAnnouncedWindowDelta(announced_window_delta_);
+    if (min_progress_size_ > 0) --tfc_->busy_streams_;
   }
 
   // Track an update to the incoming flow control counters - that is how many
@@ -321,7 +349,7 @@ class StreamFlowControl final {
 
     // the application is asking for a certain amount of bytes
     void SetMinProgressSize(int64_t min_progress_size) {
-      sfc_->min_progress_size_ = min_progress_size;
+      sfc_->UpdateMinProgressSize(min_progress_size);
     }
 
     void SetPendingSize(int64_t pending_size);
@@ -368,6 +396,10 @@ class StreamFlowControl final {
 
   FlowControlAction UpdateAction(FlowControlAction action);
   int64_t DesiredAnnounceSize() const;
+  void UpdateMinProgressSize(int64_t min_progress_size) {
+    tfc_->busy_streams_ += (min_progress_size > 0) - (min_progress_size_ > 0);
+    min_progress_size_ = min_progress_size;
+  }
 };
 
 class TestOnlyTransportTargetWindowEstimatesMocker {
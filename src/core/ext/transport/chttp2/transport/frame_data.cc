@@ -22,6 +22,8 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 
@@ -82,17 +84,49 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
 
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_stream* s, int64_t* min_progress_size,
-    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags) {
+    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags,
+    bool allow_partial) {
   grpc_slice_buffer* slices = &s->frame_storage;
   grpc_error_handle error;
 
+  // The rest of a message of which a part was already delivered.
+  if (s->partial_message_remaining > 0) {
+    const size_t remaining = s->partial_message_remaining;
+    if (slices->length < remaining && !allow_partial) {
+      if (min_progress_size != nullptr) {
+        *min_progress_size = remaining - slices->length;
+      }
+      return grpc_core::Pending{};
+    }
+    if (min_progress_size != nullptr) *min_progress_size = 0;
+    const size_t length = std::min(slices->length, remaining);
+    s->partial_message_remaining -= length;
+    if (message_flags != nullptr) {
+      *message_flags = s->partial_message_remaining > 0
+                           ? GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE
+                           : 0;
+    }
+    if (stream_out != nullptr) {
+      s->stats.incoming.data_bytes += length;
+      grpc_slice_buffer_move_first(slices, length,
+                                   stream_out->c_slice_buffer());
+    }
+    return absl::OkStatus();
+  }
+
   if (slices->length < 5) {
     if (min_progress_size != nullptr) *min_progress_size = 5 - slices->length;
     return grpc_core::Pending{};
   }
 
-  uint8_t header[5];
-  grpc_slice_buffer_copy_first_into_buffer(slices, 5, header);
+  // Read the message header in place when the first slice holds all of it,
+  // which it does unless a frame boundary splits the header.
+  uint8_t header_copy[5];
+  const uint8_t* header = GRPC_SLICE_START_PTR(slices->slices[0]);
+  if (GRPC_SLICE_LENGTH(slices->slices[0]) < 5) {
+    grpc_slice_buffer_copy_first_into_buffer(slices, 5, header_copy);
+    header = header_copy;
+  }
 
   switch (header[0]) {
     case 0:
@@ -116,9 +150,13 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
                   (static_cast<uint32_t>(header[3]) << 8) |
                   static_cast<uint32_t>(header[4]);
 
-  if (slices->length < length + 5) {
+  // Only uncompressed messages can be delivered in parts: decompression
+  // needs the whole message.
+  const bool partial =
+      slices->length < length + 5 && allow_partial && header[0] == 0;
+  if (slices->length < length + 5 && (!partial || slices->length == 5)) {
     if (min_progress_size != nullptr) {
-      *min_progress_size = length + 5 - slices->length;
+      *min_progress_size = partial ? 1 : length + 5 - slices->length;
     }
     return grpc_core::Pending{};
   }
@@ -127,8 +165,40 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
 
   if (stream_out != nullptr) {
     s->stats.incoming.framing_bytes += 5;
+    const size_t first_length = GRPC_SLICE_LENGTH(slices->slices[0]);
+    if (first_length >= length + 5) {
+      // The whole message is in the first slice, as each of a run of small
+      // messages sent in one frame is: hand the payload over as a single
+      // view of the slice and trim the slice past the message in place.
+      s->stats.incoming.data_bytes += length;
+      if (length > 0) {
+        grpc_slice_buffer_add(stream_out->c_slice_buffer(),
+                              grpc_slice_sub(slices->slices[0], 5, length + 5));
+      }
+      if (first_length == length + 5) {
+        grpc_slice_buffer_remove_first(slices);
+      } else {
+        grpc_slice_buffer_sub_first(slices, length + 5, first_length);
+      }
+      return absl::OkStatus();
+    }
+    // Drop the header, then hand the payload over as references to the
+    // slices read from the endpoint.
+    if (first_length > 5) {
+      grpc_slice_buffer_sub_first(slices, 5, first_length);
+    } else if (first_length == 5) {
+      grpc_slice_buffer_remove_first(slices);
+    } else {
+      grpc_slice_buffer_move_first_into_buffer(slices, 5, header_copy);
+    }
+    if (partial) {
+      s->partial_message_remaining = length - slices->length;
+      length = slices->length;
+      if (message_flags != nullptr) {
+        *message_flags |= GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE;
+      }
+    }
     s->stats.incoming.data_bytes += length;
-    grpc_slice_buffer_move_first_into_buffer(slices, 5, header);
     grpc_slice_buffer_move_first(slices, length, stream_out->c_slice_buffer());
   }
 
@@ -53,8 +53,14 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              grpc_transport_one_way_stats* stats,
                              grpc_slice_buffer* outbuf);
 
+// Moves the next message received on \a s to \a stream_out.  If
+// \a allow_partial is true and the message is not compressed, the part of it
+// received so far may be moved instead, flagged with
+// GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE; the next calls then continue with the
+// rest of the message.
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_stream* s, int64_t* min_progress_size,
-    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags);
+    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags,
+    bool allow_partial);
 
 #endif /* GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_FRAME_DATA_H */
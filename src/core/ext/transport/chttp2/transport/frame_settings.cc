@@ -36,6 +36,7 @@
 #include "src/core/ext/transport/chttp2/transport/frame_goaway.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/debug/event_log.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
@@ -102,6 +103,7 @@ grpc_error_handle grpc_chttp2_settings_parser_begin_frame(
   parser->state = GRPC_CHTTP2_SPS_ID0;
   if (flags == GRPC_CHTTP2_FLAG_ACK) {
     parser->is_ack = 1;
+    grpc_core::FlightRecorder::Record("chttp2-settings-ack-received", length);
     if (length != 0) {
       return GRPC_ERROR_CREATE("non-empty settings ack frame received");
     }
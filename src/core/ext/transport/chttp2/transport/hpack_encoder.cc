@@ -23,6 +23,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
@@ -33,6 +39,9 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
 #include "src/core/ext/transport/chttp2/transport/varint.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 
@@ -42,6 +51,70 @@ namespace {
 
 constexpr size_t kDataFrameHeaderSize = 9;
 
+// Largest table entry considered as hot metadata: big enough for typical
+// authorization tokens, while several still fit in the default table.
+constexpr size_t kMaxHotMetadataSize = 1024;
+
+// Process-wide counts of the custom metadata sent by compressors that index
+// hot metadata. A key/value pair is hot once the process has sent it
+// kHotSends times, on any connection; from then on every such connection
+// adds it to its table on first use and sends an index afterwards.
+class HotMetadata {
+ public:
+  static constexpr uint32_t kHotSends = 8;
+
+  // Records a send of key/value and returns whether the pair is hot.
+  static bool Observe(absl::string_view key, absl::string_view value) {
+    static HotMetadata* hot_metadata = new HotMetadata();
+    return hot_metadata->ObserveImpl(key, value);
+  }
+
+ private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kMaxEntriesPerShard = 16;
+
+  struct Entry {
+    std::string key;
+    std::string value;
+    uint32_t sends;
+  };
+
+  struct Shard {
+    Mutex mu;
+    absl::flat_hash_map<size_t, Entry> entries ABSL_GUARDED_BY(mu);
+  };
+
+  bool ObserveImpl(absl::string_view key, absl::string_view value) {
+    const size_t hash =
+        absl::Hash<std::pair<absl::string_view, absl::string_view>>()(
+            std::make_pair(key, value));
+    Shard& shard = shards_[hash % kNumShards];
+    MutexLock lock(&shard.mu);
+    auto it = shard.entries.find(hash);
+    if (it != shard.entries.end() && it->second.key == key &&
+        it->second.value == value) {
+      if (it->second.sends < kHotSends) ++it->second.sends;
+      return it->second.sends == kHotSends;
+    }
+    if (it == shard.entries.end() &&
+        shard.entries.size() >= kMaxEntriesPerShard) {
+      // Make room by forgetting the pairs that have not become hot.
+      for (auto next = shard.entries.begin(); next != shard.entries.end();) {
+        if (next->second.sends < kHotSends) {
+          shard.entries.erase(next++);
+        } else {
+          ++next;
+        }
+      }
+      if (shard.entries.size() >= kMaxEntriesPerShard) return false;
+    }
+    shard.entries[hash] = Entry{std::string(key), std::string(value), 1};
+    return false;
+  }
+
+  Shard shards_[kNumShards];
+};
+
 } /* namespace */
 
 /* fills p (which is expected to be kDataFrameHeaderSize bytes long)
@@ -176,11 +249,16 @@ static WireValue GetWireValue(Slice value, bool true_binary_enabled,
   if (is_bin_hdr) {
     if (true_binary_enabled) {
       return WireValue(0x00, true, std::move(value));
-    } else {
-      return WireValue(0x80, false,
-                       Slice(grpc_chttp2_base64_encode_and_huffman_compress(
-                           value.c_slice())));
     }
+    // A value forwarded from a peer that sent it in this form goes out in
+    // the bytes it arrived as.
+    grpc_slice wire;
+    if (grpc_chttp2_get_base64_huffman_form(value.c_slice(), &wire)) {
+      return WireValue(0x80, false, Slice(wire));
+    }
+    return WireValue(0x80, false,
+                     Slice(grpc_chttp2_base64_encode_and_huffman_compress(
+                         value.c_slice())));
   } else {
     /* TODO(ctiller): opportunistically compress non-binary headers */
     return WireValue(0x00, false, std::move(value));
@@ -327,8 +405,10 @@ void HPackCompressor::SliceIndex::EmitTo(absl::string_view key,
     return;
   }
   // Linear scan through previous values to see if we find the value.
+  // Registered calls send the same refcounted path slice every time, so check
+  // for that before comparing contents.
   for (It it = values_.begin(); it != values_.end(); ++it) {
-    if (value == it->value) {
+    if (value.is_equivalent(it->value) || value == it->value) {
       // Got a hit... is it still in the decode table?
       if (table.ConvertableToDynamicIndex(it->index)) {
         // Yes, emit the index and proceed to cleanup.
@@ -363,11 +443,54 @@ void HPackCompressor::SliceIndex::EmitTo(absl::string_view key,
 void HPackCompressor::Framer::Encode(const Slice& key, const Slice& value) {
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
-  } else {
+  } else if (!compressor_->index_hot_metadata_ ||
+             !EncodeHotMetadata(key, value)) {
     EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   }
 }
 
+bool HPackCompressor::Framer::EncodeHotMetadata(const Slice& key,
+                                                const Slice& value) {
+  const size_t transport_length =
+      hpack_constants::SizeForEntry(key.size(), value.size());
+  if (transport_length > kMaxHotMetadataSize) return false;
+  auto& table = compressor_->table_;
+  auto& entries = compressor_->hot_metadata_;
+  for (auto& entry : entries) {
+    if (entry.key != key || entry.value != value) continue;
+    if (table.ConvertableToDynamicIndex(entry.index)) {
+      const uint32_t index = table.DynamicIndex(entry.index);
+      EmitIndexed(index);
+      // Compare against the literal without indexing sent otherwise.
+      const size_t literal_length = 1 + VarintWriter<1>(key.size()).length() +
+                                    key.size() +
+                                    VarintWriter<1>(value.size()).length() +
+                                    value.size();
+      global_stats().IncrementHttp2HpackHotMetadataBytesSaved(
+          static_cast<int>(literal_length - VarintWriter<1>(index).length()));
+    } else {
+      entry.index = table.AllocateIndex(transport_length);
+      EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+    }
+    return true;
+  }
+  if (!HotMetadata::Observe(key.as_string_view(), value.as_string_view())) {
+    return false;
+  }
+  // Forget entries that were evicted from the table to make room.
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&table](const HotMetadataIndex& entry) {
+                                 return !table.ConvertableToDynamicIndex(
+                                     entry.index);
+                               }),
+                entries.end());
+  if (entries.size() >= kMaxHotMetadataEntries) return false;
+  entries.push_back(HotMetadataIndex{
+      key.Ref(), value.Ref(), table.AllocateIndex(transport_length)});
+  EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+  return true;
+}
+
 void HPackCompressor::Framer::Encode(HttpPathMetadata, const Slice& value) {
   compressor_->path_index_.EmitTo(HttpPathMetadata::key(), value, this);
 }
@@ -401,10 +524,10 @@ void HPackCompressor::Framer::Encode(HttpSchemeMetadata,
                                      HttpSchemeMetadata::ValueType value) {
   switch (value) {
     case HttpSchemeMetadata::ValueType::kHttp:
-      EmitIndexed(6);  // :scheme: http
+      EmitStaticIndexed<6>();  // :scheme: http
       break;
     case HttpSchemeMetadata::ValueType::kHttps:
-      EmitIndexed(7);  // :scheme: https
+      EmitStaticIndexed<7>();  // :scheme: https
       break;
     case HttpSchemeMetadata::ValueType::kInvalid:
       GPR_ASSERT(false);
@@ -425,36 +548,32 @@ void HPackCompressor::Framer::Encode(GrpcTagsBinMetadata, const Slice& slice) {
 }
 
 void HPackCompressor::Framer::Encode(HttpStatusMetadata, uint32_t status) {
-  if (status == 200) {
-    EmitIndexed(8);  // :status: 200
+  if (GPR_LIKELY(status == 200)) {
+    EmitStaticIndexed<8>();  // :status: 200
     return;
   }
-  uint8_t index = 0;
   switch (status) {
     case 204:
-      index = 9;  // :status: 204
+      EmitStaticIndexed<9>();  // :status: 204
       break;
     case 206:
-      index = 10;  // :status: 206
+      EmitStaticIndexed<10>();  // :status: 206
       break;
     case 304:
-      index = 11;  // :status: 304
+      EmitStaticIndexed<11>();  // :status: 304
       break;
     case 400:
-      index = 12;  // :status: 400
+      EmitStaticIndexed<12>();  // :status: 400
       break;
     case 404:
-      index = 13;  // :status: 404
+      EmitStaticIndexed<13>();  // :status: 404
       break;
     case 500:
-      index = 14;  // :status: 500
+      EmitStaticIndexed<14>();  // :status: 500
       break;
-  }
-  if (GPR_LIKELY(index != 0)) {
-    EmitIndexed(index);
-  } else {
-    EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice::FromStaticString(":status"),
-                                           Slice::FromInt64(status));
+    default:
+      EmitLitHdrWithNonBinaryStringKeyIncIdx(
+          Slice::FromStaticString(":status"), Slice::FromInt64(status));
   }
 }
 
@@ -462,10 +581,10 @@ void HPackCompressor::Framer::Encode(HttpMethodMetadata,
                                      HttpMethodMetadata::ValueType method) {
   switch (method) {
     case HttpMethodMetadata::ValueType::kPost:
-      EmitIndexed(3);  // :method: POST
+      EmitStaticIndexed<3>();  // :method: POST
       break;
     case HttpMethodMetadata::ValueType::kGet:
-      EmitIndexed(2);  // :method: GET
+      EmitStaticIndexed<2>();  // :method: GET
       break;
     case HttpMethodMetadata::ValueType::kPut:
       // Right now, we only emit PUT as a method for testing purposes, so it's
@@ -61,6 +61,11 @@ class HPackCompressor {
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
 
+  // If enabled, custom metadata that the process has repeatedly sent with the
+  // same value is added to the table the first time it is sent on this
+  // connection (see GRPC_ARG_HTTP2_HPACK_INDEX_HOT_METADATA).
+  void SetIndexHotMetadata(bool enabled) { index_hot_metadata_ = enabled; }
+
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
   }
@@ -138,6 +143,13 @@ class HPackCompressor {
 
     void AdvertiseTableSizeChange();
     void EmitIndexed(uint32_t index);
+    // Emits static table entry kIndex: a single byte known at compile time.
+    template <uint8_t kIndex>
+    void EmitStaticIndexed() {
+      static_assert(kIndex > 0 && kIndex <= hpack_constants::kLastStaticEntry,
+                    "not a static table index");
+      *AddTiny(1) = 0x80 | kIndex;
+    }
     void EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice key_slice,
                                                 Slice value_slice);
     void EmitLitHdrWithBinaryStringKeyIncIdx(Slice key_slice,
@@ -157,6 +169,9 @@ class HPackCompressor {
     void EncodeRepeatingSliceValue(const absl::string_view& key,
                                    const Slice& slice, uint32_t* index,
                                    size_t max_compression_size);
+    // Returns false if key/value is not hot metadata, in which case nothing
+    // was emitted.
+    bool EncodeHotMetadata(const Slice& key, const Slice& value);
 
     size_t CurrentFrameSize() const;
     void Add(Slice slice);
@@ -178,6 +193,7 @@ class HPackCompressor {
  private:
   static constexpr size_t kNumFilterValues = 64;
   static constexpr uint32_t kNumCachedGrpcStatusValues = 16;
+  static constexpr size_t kMaxHotMetadataEntries = 32;
 
   // maximum number of bytes we'll use for the decode table (to guard against
   // peers ooming us by setting decode table size high)
@@ -206,6 +222,12 @@ class HPackCompressor {
     uint32_t index;
   };
 
+  struct HotMetadataIndex {
+    Slice key;
+    Slice value;
+    uint32_t index;
+  };
+
   // Index into table_ for the te:trailers metadata element
   uint32_t te_index_ = 0;
   // Index into table_ for the content-type metadata element
@@ -229,6 +251,9 @@ class HPackCompressor {
   SliceIndex path_index_;
   SliceIndex authority_index_;
   std::vector<PreviousTimeout> previous_timeouts_;
+  bool index_hot_metadata_ = false;
+  // Hot metadata added to table_ by this compressor.
+  std::vector<HotMetadataIndex> hot_metadata_;
 };
 
 }  // namespace grpc_core
@@ -43,6 +43,7 @@
 #include <grpc/status.h>
 #include <grpc/support/log.h>
 
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
 #include "src/core/ext/transport/chttp2/transport/frame_rst_stream.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
@@ -677,6 +678,8 @@ class HPackParser::String {
   absl::string_view string_view() const {
     if (auto* p = absl::get_if<Slice>(&value_)) {
       return p->as_string_view();
+    } else if (auto* p = absl::get_if<OwnedSlice>(&value_)) {
+      return p->slice.as_string_view();
     } else if (auto* p = absl::get_if<absl::Span<const uint8_t>>(&value_)) {
       return absl::string_view(reinterpret_cast<const char*>(p->data()),
                                p->size());
@@ -718,6 +721,7 @@ class HPackParser::String {
       return Unbase64(input, std::move(*base64));
     } else {
       // Huffman encoded...
+      const uint8_t* wire = input->cur_ptr();
       std::vector<uint8_t> decompressed;
       // State here says either we don't know if it's base64 or binary, or we do
       // and what is it.
@@ -747,16 +751,30 @@ class HPackParser::String {
         case State::kBinary:
           // Binary, we're done
           return String(std::move(decompressed));
-        case State::kBase64:
-          // Base64 - unpack it
-          return Unbase64(input, String(std::move(decompressed)));
+        case State::kBase64: {
+          // Base64 - unpack it, keeping the bytes it arrived as so that an
+          // encoder that forwards the value can send them unchanged.
+          auto unbase64 = Unbase64(input, String(std::move(decompressed)));
+          if (!unbase64.has_value()) return {};
+          auto value = unbase64->string_view();
+          return String(OwnedSlice{
+              Slice(grpc_chttp2_slice_with_base64_huffman_form(
+                  reinterpret_cast<const uint8_t*>(value.data()),
+                  value.size(), wire, pfx->length))});
+        }
       }
       GPR_UNREACHABLE_CODE(abort(););
     }
   }
 
  private:
+  // A slice the string owns outright, which Take() need not copy.
+  struct OwnedSlice {
+    Slice slice;
+  };
+
   void AppendBytes(const uint8_t* data, size_t length);
+  explicit String(OwnedSlice v) : value_(std::move(v)) {}
   explicit String(std::vector<uint8_t> v) : value_(std::move(v)) {}
   explicit String(absl::Span<const uint8_t> v) : value_(v) {}
   String(grpc_slice_refcount* r, const uint8_t* begin, const uint8_t* end)
@@ -919,7 +937,9 @@ class HPackParser::String {
     GPR_UNREACHABLE_CODE(return out;);
   }
 
-  absl::variant<Slice, absl::Span<const uint8_t>, std::vector<uint8_t>> value_;
+  absl::variant<Slice, OwnedSlice, absl::Span<const uint8_t>,
+                std::vector<uint8_t>>
+      value_;
 };
 
 // Parser parses one key/value pair from a byte stream.
@@ -1232,6 +1252,8 @@ class HPackParser::Parser {
 Slice HPackParser::String::Take() {
   if (auto* p = absl::get_if<Slice>(&value_)) {
     return p->Copy();
+  } else if (auto* p = absl::get_if<OwnedSlice>(&value_)) {
+    return std::move(p->slice);
   } else if (auto* p = absl::get_if<absl::Span<const uint8_t>>(&value_)) {
     return Slice::FromCopiedBuffer(*p);
   } else if (auto* p = absl::get_if<std::vector<uint8_t>>(&value_)) {
@@ -61,6 +61,7 @@
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/init_internally.h"
+#include "src/core/lib/transport/connection_rtt.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
@@ -129,6 +130,7 @@ typedef enum {
   GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL_UNSTALLED,
   GRPC_CHTTP2_INITIATE_WRITE_PING_RESPONSE,
   GRPC_CHTTP2_INITIATE_WRITE_FORCE_RST_STREAM,
+  GRPC_CHTTP2_INITIATE_WRITE_CORK_TIMER,
 } grpc_chttp2_initiate_write_reason;
 
 const char* grpc_chttp2_initiate_write_reason_string(
@@ -230,6 +232,13 @@ typedef struct grpc_chttp2_write_cb {
   struct grpc_chttp2_write_cb* next;
 } grpc_chttp2_write_cb;
 
+/* A grown slice array left over by a destroyed stream, kept for reuse by the
+   buffers of a new stream. Overlays the first slice of the array. */
+typedef struct grpc_chttp2_pooled_slice_array {
+  size_t capacity;
+  struct grpc_chttp2_pooled_slice_array* next;
+} grpc_chttp2_pooled_slice_array;
+
 typedef enum {
   GRPC_CHTTP2_KEEPALIVE_STATE_WAITING,
   GRPC_CHTTP2_KEEPALIVE_STATE_PINGING,
@@ -280,6 +289,8 @@ struct grpc_chttp2_transport
 
   /** is there a read request to the endpoint outstanding? */
   uint8_t endpoint_reading = 1;
+  /** start the next endpoint read before parsing the current one? */
+  bool pipeline_reads = false;
 
   /** various lists of streams */
   grpc_chttp2_stream_list lists[STREAM_LIST_COUNT] = {};
@@ -396,6 +407,10 @@ struct grpc_chttp2_transport
                               int is_last);
 
   grpc_chttp2_write_cb* write_cb_pool = nullptr;
+  /** slice arrays grown by the frame_storage and flow_controlled_buffer of
+      destroyed streams */
+  grpc_chttp2_pooled_slice_array* slice_array_pool = nullptr;
+  size_t slice_array_pool_size = 0;
 
   /* bdp estimator */
   bool bdp_ping_blocked =
@@ -427,6 +442,24 @@ struct grpc_chttp2_transport
   bool bdp_ping_started = false;
   grpc_timer next_bdp_ping_timer;
 
+  /* write corking */
+  /** how long an idle transport holds back a write requested to send a
+      message, so that messages of other streams can join it; zero disables
+      corking */
+  grpc_core::Duration write_cork_delay;
+  /** is write_cork_timer pending (or its closure not yet run)? */
+  bool have_write_cork_timer = false;
+  /** write requests held back since the last write started */
+  int corked_write_requests = 0;
+  grpc_timer write_cork_timer;
+  grpc_closure write_cork_timer_expired_locked;
+
+  /* adaptive MAX_CONCURRENT_STREAMS (servers only) */
+  /** lower the advertised stream limit under memory pressure? */
+  bool adaptive_max_concurrent_streams = false;
+  /** the stream limit configured through channel args */
+  uint32_t configured_max_concurrent_streams = 0;
+
   /* keep-alive ping support */
   /** Closure to initialize a keepalive ping */
   grpc_closure init_keepalive_ping_locked;
@@ -448,10 +481,23 @@ struct grpc_chttp2_transport
   bool keepalive_permit_without_calls = false;
   /** If start_keepalive_ping_locked has been called */
   bool keepalive_ping_started = false;
+  /** when the outstanding keepalive ping was put on the wire */
+  gpr_timespec keepalive_ping_start_time;
+  /** when we last read from the peer or sent it a BDP ping; the keepalive
+      ping is due keepalive_time after this */
+  grpc_core::Timestamp keepalive_last_activity;
   /** keep-alive state machine state */
   grpc_chttp2_keepalive_state keepalive_state;
   grpc_core::ContextList* cl = nullptr;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
+  /** how many bytes we'd like to put on the wire in a single write; follows
+      the congestion window of the connection */
+  uint32_t target_write_size = 1024 * 1024;
+  /** when to look at the congestion window again */
+  grpc_core::Timestamp next_target_write_size_update;
+  /** where to report ping round trip times, if the creator of the connection
+      asked for them */
+  grpc_core::RefCountedPtr<grpc_core::ConnectionRtt> connection_rtt;
   uint32_t num_messages_in_next_write = 0;
   /** The number of pending induced frames (SETTINGS_ACK, PINGS_ACK and
    * RST_STREAM) in the outgoing buffer (t->qbuf). If this number goes beyond
@@ -516,6 +562,9 @@ struct grpc_chttp2_stream {
   bool* trailing_metadata_available = nullptr;
   absl::optional<grpc_core::SliceBuffer>* recv_message = nullptr;
   uint32_t* recv_message_flags = nullptr;
+  bool recv_message_allow_partial = false;
+  // Bytes of a message delivered in parts that are still to be delivered.
+  size_t partial_message_remaining = 0;
   bool* call_failed_before_recv_message = nullptr;
   grpc_closure* recv_message_ready = nullptr;
   grpc_metadata_batch* recv_trailing_metadata;
@@ -580,6 +629,9 @@ struct grpc_chttp2_stream {
   bool traced = false;
   /** Byte counter for number of bytes written */
   size_t byte_counter = 0;
+  /** How many chunks of GRPC_CHTTP2_STREAM_WRITE_QUANTUM bytes of data this
+      stream may send each time it is visited by grpc_chttp2_begin_write */
+  uint32_t write_weight = 1;
 };
 
 /** Transport writing call flow:
@@ -686,6 +738,11 @@ void grpc_chttp2_complete_closure_step(grpc_chttp2_transport* t,
                                        const char* desc);
 
 #define GRPC_HEADER_SIZE_IN_BYTES 5
+#define GRPC_CHTTP2_STREAM_WRITE_QUANTUM 16384u
+#define GRPC_CHTTP2_MAX_STREAM_WRITE_WEIGHT 256u
+#define GRPC_CHTTP2_MAX_COALESCED_WRITE_SIZE 4096u
+#define GRPC_CHTTP2_MAX_POOLED_SLICE_ARRAYS 16u
+#define GRPC_CHTTP2_MAX_POOLED_SLICE_ARRAY_CAPACITY 256u
 #define MAX_SIZE_T (~(size_t)0)
 
 #define GRPC_CHTTP2_CLIENT_CONNECT_STRING "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
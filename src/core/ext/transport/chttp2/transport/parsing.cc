@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/base/attributes.h"
@@ -80,6 +81,37 @@ static char get_utf8_safe_char(char c) {
   return static_cast<unsigned char>(c) < 128 ? c : 32;
 }
 
+// While reading a DATA frame that carries part of a message the application
+// is waiting for, returns how many bytes beyond the end of that frame the
+// message still needs, including the headers of the frames that will carry
+// them. Lets the endpoint wake up (and allocate) once per message instead of
+// once per frame. Returns 0 when anything else might arrive in between that
+// must not be delayed, i.e. other streams are waiting for data or a ping is
+// outstanding. Capped so a huge message is not read into one giant buffer.
+static uint32_t message_read_ahead_size(grpc_chttp2_transport* t) {
+  static constexpr int64_t kMaxReadAhead = 16 * 1024 * 1024;
+  if (t->incoming_frame_type != GRPC_CHTTP2_FRAME_DATA) return 0;
+  grpc_chttp2_stream* s = t->incoming_stream;
+  if (s == nullptr) return 0;
+  int64_t remaining = s->flow_control.min_progress_size();
+  if (remaining <= 0 || t->flow_control.busy_streams() > 1) return 0;
+  if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_PINGING ||
+      !grpc_closure_list_empty(
+          t->ping_queue.lists[GRPC_CHTTP2_PCL_INFLIGHT])) {
+    return 0;
+  }
+  // The peer cannot send more than the flow control windows allow.
+  remaining = std::min(remaining, t->flow_control.announced_window());
+  remaining = std::min(remaining, s->flow_control.announced_window_delta() +
+                                      t->flow_control.acked_init_window());
+  if (remaining <= 0) return 0;
+  const int64_t max_frame_size =
+      t->settings[GRPC_ACKED_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE];
+  const int64_t frames = (remaining + max_frame_size - 1) / max_frame_size;
+  return static_cast<uint32_t>(
+      std::min(remaining + frames * 9, kMaxReadAhead));
+}
+
 uint32_t grpc_chttp2_min_read_progress_size(grpc_chttp2_transport* t) {
   switch (t->deframe_state) {
     case GRPC_DTS_CLIENT_PREFIX_0:
@@ -119,7 +151,7 @@ uint32_t grpc_chttp2_min_read_progress_size(grpc_chttp2_transport* t) {
     case GRPC_DTS_FH_8:
       return 9 - (t->deframe_state - GRPC_DTS_FH_0);
     case GRPC_DTS_FRAME:
-      return t->incoming_frame_size;
+      return t->incoming_frame_size + message_read_ahead_size(t);
   }
   GPR_UNREACHABLE_CODE(return 1);
 }
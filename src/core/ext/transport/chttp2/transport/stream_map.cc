@@ -25,16 +25,31 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+/* Ids from the same peer share a parity and advance together, so key / 2 maps
+   a window of live streams to consecutive slots. Even keys are offset by half
+   the table so that a map holding both parities does not form one cluster. */
+static size_t home_slot(size_t capacity, uint32_t key) {
+  size_t slot = key >> 1;
+  if ((key & 1) == 0) slot += capacity / 2;
+  return slot & (capacity - 1);
+}
+
+static void alloc_table(grpc_chttp2_stream_map* map, size_t capacity) {
+  map->keys = static_cast<uint32_t*>(gpr_zalloc(sizeof(uint32_t) * capacity));
+  map->values = static_cast<void**>(gpr_zalloc(sizeof(void*) * capacity));
+  map->capacity = capacity;
+}
+
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity) {
   GPR_DEBUG_ASSERT(initial_capacity > 1);
-  map->keys =
-      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * initial_capacity));
-  map->values =
-      static_cast<void**>(gpr_malloc(sizeof(void*) * initial_capacity));
+  size_t capacity = 2;
+  while (capacity < initial_capacity) capacity *= 2;
+  alloc_table(map, capacity);
   map->count = 0;
   map->free = 0;
-  map->capacity = initial_capacity;
+  map->min_capacity = capacity;
+  map->last_key = 0;
 }
 
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
@@ -42,134 +57,144 @@ void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
   gpr_free(map->values);
 }
 
-static size_t compact(uint32_t* keys, void** values, size_t count) {
-  size_t i, out;
+static void insert(grpc_chttp2_stream_map* map, uint32_t key, void* value) {
+  const size_t mask = map->capacity - 1;
+  size_t i = home_slot(map->capacity, key);
+  while (map->keys[i] != 0) i = (i + 1) & mask;
+  map->keys[i] = key;
+  map->values[i] = value;
+}
 
-  for (i = 0, out = 0; i < count; i++) {
-    if (values[i]) {
-      keys[out] = keys[i];
-      values[out] = values[i];
-      out++;
-    }
+/* Drop the deleted entries without reallocating the table */
+static void rebuild_in_place(grpc_chttp2_stream_map* map) {
+  const size_t mask = map->capacity - 1;
+  /* Probe sequences never cross an empty slot, so every entry met walking
+     forward from one has its home slot between that slot and itself: moving
+     each entry to the first empty slot from its home, in that order, keeps
+     all of them reachable. */
+  size_t start = 0;
+  while (map->keys[start] != 0) start++;
+  for (size_t i = 0; i < map->capacity; i++) {
+    if (map->values[i] == nullptr) map->keys[i] = 0;
   }
+  for (size_t n = 1; n < map->capacity; n++) {
+    size_t i = (start + n) & mask;
+    if (map->keys[i] == 0) continue;
+    uint32_t key = map->keys[i];
+    void* value = map->values[i];
+    map->keys[i] = 0;
+    map->values[i] = nullptr;
+    insert(map, key, value);
+  }
+  map->free = 0;
+}
 
-  return out;
+/* Drop the deleted entries, sizing the table so that it would be at most 5/8
+   full with one more entry, which leaves room for a number of adds before the
+   next rebuild. */
+static void rebuild(grpc_chttp2_stream_map* map) {
+  size_t capacity = map->min_capacity;
+  while ((map->count + 1) * 8 > capacity * 5) capacity *= 2;
+  if (capacity == map->capacity) {
+    rebuild_in_place(map);
+    return;
+  }
+  uint32_t* old_keys = map->keys;
+  void** old_values = map->values;
+  size_t old_capacity = map->capacity;
+  alloc_table(map, capacity);
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_values[i] != nullptr) insert(map, old_keys[i], old_values[i]);
+  }
+  map->free = 0;
+  gpr_free(old_keys);
+  gpr_free(old_values);
 }
 
 void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
                                 void* value) {
-  size_t count = map->count;
-  size_t capacity = map->capacity;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-
-  // The first assertion ensures that the table is monotonically increasing.
-  GPR_ASSERT(count == 0 || keys[count - 1] < key);
+  // Keys are monotonically increasing, which also rules out key 0 and
+  // re-adding a key that is already present.
+  GPR_ASSERT(key > map->last_key);
   GPR_DEBUG_ASSERT(value);
-  // Asserting that the key is not already in the map can be a debug assertion.
-  // Why: we're already checking that the map elements are monotonically
-  // increasing. If we re-add a key, i.e. if the key is already present, then
-  // either it is the most recently added key in the map (in which case the
-  // first assertion fails due to key == last_key) or there is a more recently
-  // added (larger) key at the end of the map: in which case the first assertion
-  // still fails due to key < last_key.
-  GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
-
-  if (count == capacity) {
-    if (map->free > capacity / 4) {
-      count = compact(keys, values, count);
-      map->free = 0;
-    } else {
-      /* resize when less than 25% of the table is free, because compaction
-         won't help much */
-      map->capacity = capacity = 2 * capacity;
-      map->keys = keys = static_cast<uint32_t*>(
-          gpr_realloc(keys, capacity * sizeof(uint32_t)));
-      map->values = values =
-          static_cast<void**>(gpr_realloc(values, capacity * sizeof(void*)));
-    }
+  /* rebuild when more than 3/4 of the slots would be in use, to keep probe
+     sequences short */
+  if ((map->count + map->free + 1) * 4 > map->capacity * 3) {
+    rebuild(map);
   }
-
-  keys[count] = key;
-  values[count] = value;
-  map->count = count + 1;
+  insert(map, key, value);
+  map->count++;
+  map->last_key = key;
 }
 
-template <bool strict_find>
-static void** find(grpc_chttp2_stream_map* map, uint32_t key) {
-  size_t min_idx = 0;
-  size_t max_idx = map->count;
-  size_t mid_idx;
+/* Return the slot holding key, or capacity if key is not present */
+static size_t find(grpc_chttp2_stream_map* map, uint32_t key) {
+  const size_t mask = map->capacity - 1;
   uint32_t* keys = map->keys;
-  void** values = map->values;
-  uint32_t mid_key;
-
-  GPR_DEBUG_ASSERT(!strict_find || max_idx > 0);
-  if (!strict_find && max_idx == 0) return nullptr;
-
-  while (min_idx < max_idx) {
-    /* find the midpoint, avoiding overflow */
-    mid_idx = min_idx + ((max_idx - min_idx) / 2);
-    mid_key = keys[mid_idx];
-
-    if (mid_key < key) {
-      min_idx = mid_idx + 1;
-    } else if (mid_key > key) {
-      max_idx = mid_idx;
-    } else /* mid_key == key */
-    {
-      return &values[mid_idx];
+  for (size_t i = home_slot(map->capacity, key); keys[i] != 0;
+       i = (i + 1) & mask) {
+    if (keys[i] == key) {
+      return map->values[i] != nullptr ? i : map->capacity;
     }
   }
-
-  GPR_DEBUG_ASSERT(!strict_find);
-  return nullptr;
+  return map->capacity;
 }
 
 void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<true>(map, key);
-  GPR_DEBUG_ASSERT(pvalue != nullptr);
-  void* out = *pvalue;
-  GPR_DEBUG_ASSERT(out != nullptr);
-  *pvalue = nullptr;
+  size_t i = find(map, key);
+  GPR_DEBUG_ASSERT(i != map->capacity);
+  if (i == map->capacity) return nullptr;
+  void* out = map->values[i];
+  map->values[i] = nullptr;
+  map->count--;
   map->free++;
-  /* recognize complete emptyness and ensure we can skip
-     defragmentation later */
-  if (map->free == map->count) {
-    map->free = map->count = 0;
+  /* No probe sequence continues past a slot followed by an empty one, so the
+     deleted entries ending such a run can be reclaimed in place. This keeps
+     maps with few streams from ever needing a rebuild. */
+  const size_t mask = map->capacity - 1;
+  if (map->keys[(i + 1) & mask] == 0) {
+    while (map->keys[i] != 0 && map->values[i] == nullptr) {
+      map->keys[i] = 0;
+      map->free--;
+      i = (i - 1) & mask;
+    }
   }
   GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
   return out;
 }
 
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<false>(map, key);
-  return pvalue != nullptr ? *pvalue : nullptr;
+  size_t i = find(map, key);
+  return i != map->capacity ? map->values[i] : nullptr;
 }
 
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map) {
-  return map->count - map->free;
+  return map->count;
 }
 
 void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map) {
-  if (map->count == map->free) {
+  if (map->count == 0) {
     return nullptr;
   }
-  if (map->free != 0) {
-    map->count = compact(map->keys, map->values, map->count);
-    map->free = 0;
-    GPR_ASSERT(map->count > 0);
+  /* reclaim deleted entries first if they outnumber the live ones: rebuilt
+     tables are at least 5/16 full (or at their initial size), so a few probes
+     find a populated slot */
+  if (map->free > map->count) {
+    rebuild(map);
   }
-  return map->values[(static_cast<size_t>(rand())) % map->count];
+  /* i -> 5 * i + 1 visits every slot of a power of two sized table, so
+     this needs a single call to rand() and always terminates */
+  const size_t mask = map->capacity - 1;
+  size_t i = static_cast<size_t>(rand()) & mask;
+  while (map->values[i] == nullptr) i = (5 * i + 1) & mask;
+  return map->values[i];
 }
 
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
                                      void* user_data) {
-  size_t i;
-
-  for (i = 0; i < map->count; i++) {
+  for (size_t i = 0; i < map->capacity; i++) {
     if (map->values[i]) {
       f(user_data, map->keys[i], map->values[i]);
     }
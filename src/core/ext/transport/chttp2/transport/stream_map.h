@@ -26,16 +26,26 @@
 
 /* Data structure to map a uint32_t to a data object (represented by a void*)
 
-   Represented as a sorted array of keys, and a corresponding array of values.
-   Lookups are performed with binary search.
+   Represented as an open addressing hash table with linear probing, indexed
+   by key / 2: the stream ids initiated by one peer all have the same parity,
+   and the ones alive at any time form a mostly dense window, so they land in
+   distinct slots and lookups touch a single slot.
+   Deleted entries keep their key with a NULL value until a later add rebuilds
+   the table, which keeps deleting from grpc_chttp2_stream_map_for_each safe.
    Adds are restricted to strictly higher keys than previously seen (this is
    guaranteed by http2). */
 struct grpc_chttp2_stream_map {
+  /* key 0 marks an empty slot */
   uint32_t* keys;
   void** values;
+  /* number of populated entries */
   size_t count;
+  /* number of deleted entries waiting to be reclaimed */
   size_t free;
+  /* always a power of two */
   size_t capacity;
+  size_t min_capacity;
+  uint32_t last_key;
 };
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity);
@@ -59,7 +69,8 @@ void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map);
 /* How many (populated) entries are in the stream map? */
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map);
 
-/* Callback on each stream */
+/* Callback on each stream, in no particular order. The callback may delete
+   entries, but must not add them */
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "absl/types/optional.h"
@@ -46,10 +47,14 @@
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
+#include "src/core/lib/channel/call_tracer.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/debug/event_log.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -171,6 +176,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
   grpc_slice_buffer_add(&t->outbuf,
                         grpc_chttp2_ping_create(false, pq->inflight_id));
   grpc_core::global_stats().IncrementHttp2PingsSent();
+  grpc_core::FlightRecorder::Record("chttp2-ping-sent", pq->inflight_id);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace) ||
       GRPC_TRACE_FLAG_ENABLED(grpc_bdp_estimator_trace) ||
       GRPC_TRACE_FLAG_ENABLED(grpc_keepalive_trace)) {
@@ -229,8 +235,24 @@ static void report_stall(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 }
 
 /* How many bytes would we like to put on the wire during a single syscall */
-static uint32_t target_write_size(grpc_chttp2_transport* /*t*/) {
-  return 1024 * 1024;
+static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  return t->target_write_size;
+}
+
+/* Sizes writes to twice the congestion window: one window in flight and one
+   queued in the socket buffer keep the pipe full, while anything beyond that
+   would only sit in the kernel and delay streams that become writable later.
+   Refreshed at most once per second, as it costs a syscall. */
+static void update_target_write_size(grpc_chttp2_transport* t) {
+  static constexpr size_t kMinTargetWriteSize = 64 * 1024;
+  static constexpr size_t kMaxTargetWriteSize = 4 * 1024 * 1024;
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  if (now < t->next_target_write_size_update) return;
+  t->next_target_write_size_update = now + grpc_core::Duration::Seconds(1);
+  const size_t cwnd = grpc_endpoint_get_congestion_window(t->ep);
+  if (cwnd == 0) return;
+  t->target_write_size = static_cast<uint32_t>(
+      grpc_core::Clamp(2 * cwnd, kMinTargetWriteSize, kMaxTargetWriteSize));
 }
 
 namespace {
@@ -329,7 +351,7 @@ class WriteContext {
   grpc_chttp2_stream* NextStream() {
     if (t_->outbuf.length > target_write_size(t_)) {
       result_.partial = true;
-      return nullptr;
+      return PopSmallWritableStream();
     }
 
     grpc_chttp2_stream* s;
@@ -340,6 +362,21 @@ class WriteContext {
     return s;
   }
 
+  // Streams with no more than one quantum of data left still go out in a
+  // full write, so that small calls are not held behind bulk streams for
+  // another write cycle.
+  grpc_chttp2_stream* PopSmallWritableStream() {
+    for (grpc_chttp2_stream* s = t_->lists[GRPC_CHTTP2_LIST_WRITABLE].head;
+         s != nullptr; s = s->links[GRPC_CHTTP2_LIST_WRITABLE].next) {
+      if (s->flow_controlled_buffer.length <=
+          GRPC_CHTTP2_STREAM_WRITE_QUANTUM) {
+        grpc_chttp2_list_remove_writable_stream(t_, s);
+        return s;
+      }
+    }
+    return nullptr;
+  }
+
   void IncInitialMetadataWrites() { ++initial_metadata_writes_; }
   void IncWindowUpdateWrites() { ++flow_control_writes_; }
   void IncMessageWrites() { ++message_writes_; }
@@ -369,10 +406,11 @@ class WriteContext {
 class DataSendContext {
  public:
   DataSendContext(WriteContext* write_context, grpc_chttp2_transport* t,
-                  grpc_chttp2_stream* s)
+                  grpc_chttp2_stream* s, grpc_slice_buffer* out)
       : write_context_(write_context),
         t_(t),
         s_(s),
+        out_(out),
         sending_bytes_before_(s_->sending_bytes) {}
 
   uint32_t stream_remote_window() const {
@@ -393,16 +431,19 @@ class DataSendContext {
 
   bool AnyOutgoing() const { return max_outgoing() > 0; }
 
-  void FlushBytes() {
+  // Sends at most \a max_bytes of data, returning how many were sent.
+  uint32_t FlushBytes(uint32_t max_bytes) {
     uint32_t send_bytes = static_cast<uint32_t>(
-        std::min(size_t(max_outgoing()), s_->flow_controlled_buffer.length));
+        std::min(size_t(std::min(max_outgoing(), max_bytes)),
+                 s_->flow_controlled_buffer.length));
     is_last_frame_ = send_bytes == s_->flow_controlled_buffer.length &&
                      s_->send_trailing_metadata != nullptr &&
                      s_->send_trailing_metadata->empty();
     grpc_chttp2_encode_data(s_->id, &s_->flow_controlled_buffer, send_bytes,
-                            is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
+                            is_last_frame_, &s_->stats.outgoing, out_);
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    return send_bytes;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -421,6 +462,7 @@ class DataSendContext {
   WriteContext* write_context_;
   grpc_chttp2_transport* t_;
   grpc_chttp2_stream* s_;
+  grpc_slice_buffer* const out_;
   grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext sfc_upd_{
       &s_->flow_control};
   const size_t sending_bytes_before_;
@@ -437,6 +479,34 @@ class StreamWriteContext {
                 s->sent_initial_metadata, s->send_initial_metadata != nullptr));
   }
 
+  // Frames everything the stream is ready to send. When a small call has its
+  // initial metadata, message and trailing metadata all ready at once (the
+  // common case for unary calls), the frames are encoded into a scratch
+  // buffer and then handed to the endpoint as one contiguous slice, rather
+  // than as a slice for every header fragment and frame header.
+  void Flush() {
+    if (!IsCompleteSmallCall()) {
+      FlushFrames();
+      return;
+    }
+    grpc_slice_buffer scratch;
+    grpc_slice_buffer_init(&scratch);
+    out_ = &scratch;
+    FlushFrames();
+    out_ = &t_->outbuf;
+    if (scratch.count > 1 &&
+        scratch.length <= 2 * GRPC_CHTTP2_MAX_COALESCED_WRITE_SIZE) {
+      grpc_slice coalesced = GRPC_SLICE_MALLOC(scratch.length);
+      grpc_slice_buffer_move_first_into_buffer(
+          &scratch, scratch.length, GRPC_SLICE_START_PTR(coalesced));
+      grpc_slice_buffer_add(&t_->outbuf, coalesced);
+      grpc_core::global_stats().IncrementHttp2CoalescedWrites();
+    } else {
+      grpc_slice_buffer_move_into(&scratch, &t_->outbuf);
+    }
+    grpc_slice_buffer_destroy(&scratch);
+  }
+
   void FlushInitialMetadata() {
     /* send initial metadata if it's available */
     if (s_->sent_initial_metadata) return;
@@ -465,7 +535,7 @@ class StreamWriteContext {
                   [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],  // max_frame_size
               &s_->stats.outgoing                         // stats
           },
-          *s_->send_initial_metadata, &t_->outbuf);
+          *s_->send_initial_metadata, out_);
       grpc_chttp2_reset_ping_clock(t_);
       write_context_->IncInitialMetadataWrites();
     }
@@ -486,8 +556,8 @@ class StreamWriteContext {
     if (stream_announce == 0) return;
 
     grpc_slice_buffer_add(
-        &t_->outbuf, grpc_chttp2_window_update_create(s_->id, stream_announce,
-                                                      &s_->stats.outgoing));
+        out_, grpc_chttp2_window_update_create(s_->id, stream_announce,
+                                               &s_->stats.outgoing));
     grpc_chttp2_reset_ping_clock(t_);
     write_context_->IncWindowUpdateWrites();
   }
@@ -499,24 +569,30 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
-    DataSendContext data_send_context(write_context_, t_, s_);
+    DataSendContext data_send_context(write_context_, t_, s_, out_);
 
     if (!data_send_context.AnyOutgoing()) {
       if (t_->flow_control.remote_window() <= 0) {
         grpc_core::global_stats().IncrementHttp2TransportStalls();
         report_stall(t_, s_, "transport");
+        grpc_core::FlightRecorder::Record("chttp2-stall-transport", s_->id);
         grpc_chttp2_list_add_stalled_by_transport(t_, s_);
       } else if (data_send_context.stream_remote_window() <= 0) {
         grpc_core::global_stats().IncrementHttp2StreamStalls();
         report_stall(t_, s_, "stream");
+        grpc_core::FlightRecorder::Record("chttp2-stall-stream", s_->id);
         grpc_chttp2_list_add_stalled_by_stream(t_, s_);
       }
       return;  // early out: nothing to do
     }
 
-    while (s_->flow_controlled_buffer.length > 0 &&
+    // Weighted round robin: the stream sends at most write_weight quanta of
+    // data per visit, and then goes to the back of the writable list so that
+    // a bulk stream cannot fill a whole write while other streams wait.
+    uint32_t budget = GRPC_CHTTP2_STREAM_WRITE_QUANTUM * s_->write_weight;
+    while (s_->flow_controlled_buffer.length > 0 && budget > 0 &&
            data_send_context.max_outgoing() > 0) {
-      data_send_context.FlushBytes();
+      budget -= data_send_context.FlushBytes(budget);
     }
     grpc_chttp2_reset_ping_clock(t_);
     if (data_send_context.is_last_frame()) {
@@ -540,7 +616,7 @@ class StreamWriteContext {
     GRPC_CHTTP2_IF_TRACING(gpr_log(GPR_INFO, "sending trailing_metadata"));
     if (s_->send_trailing_metadata->empty()) {
       grpc_chttp2_encode_data(s_->id, &s_->flow_controlled_buffer, 0, true,
-                              &s_->stats.outgoing, &t_->outbuf);
+                              &s_->stats.outgoing, out_);
     } else {
       if (send_status_.has_value()) {
         s_->send_trailing_metadata->Set(grpc_core::HttpStatusMetadata(),
@@ -560,7 +636,7 @@ class StreamWriteContext {
               t_->settings[GRPC_PEER_SETTINGS]
                           [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
               &s_->stats.outgoing},
-          *s_->send_trailing_metadata, &t_->outbuf);
+          *s_->send_trailing_metadata, out_);
     }
     write_context_->IncTrailingMetadataWrites();
     grpc_chttp2_reset_ping_clock(t_);
@@ -575,6 +651,21 @@ class StreamWriteContext {
   bool stream_became_writable() { return stream_became_writable_; }
 
  private:
+  bool IsCompleteSmallCall() const {
+    return !s_->sent_initial_metadata && s_->send_initial_metadata != nullptr &&
+           s_->send_trailing_metadata != nullptr &&
+           s_->flow_controlled_buffer.length > 0 &&
+           s_->flow_controlled_buffer.length <=
+               GRPC_CHTTP2_MAX_COALESCED_WRITE_SIZE;
+  }
+
+  void FlushFrames() {
+    FlushInitialMetadata();
+    FlushWindowUpdates();
+    FlushData();
+    FlushTrailingMetadata();
+  }
+
   void ConvertInitialMetadataToTrailingMetadata() {
     GRPC_CHTTP2_IF_TRACING(
         gpr_log(GPR_INFO, "not sending initial_metadata (Trailers-Only)"));
@@ -597,8 +688,8 @@ class StreamWriteContext {
 
     if (!t_->is_client && !s_->read_closed) {
       grpc_slice_buffer_add(
-          &t_->outbuf, grpc_chttp2_rst_stream_create(
-                           s_->id, GRPC_HTTP2_NO_ERROR, &s_->stats.outgoing));
+          out_, grpc_chttp2_rst_stream_create(s_->id, GRPC_HTTP2_NO_ERROR,
+                                              &s_->stats.outgoing));
     }
     grpc_chttp2_mark_stream_closed(t_, s_, !t_->is_client, true,
                                    absl::OkStatus());
@@ -607,6 +698,7 @@ class StreamWriteContext {
   WriteContext* const write_context_;
   grpc_chttp2_transport* const t_;
   grpc_chttp2_stream* const s_;
+  grpc_slice_buffer* out_ = &t_->outbuf;
   bool stream_became_writable_ = false;
   absl::optional<uint32_t> send_status_;
   absl::optional<grpc_core::ContentTypeMetadata::ValueType> send_content_type_ =
@@ -616,6 +708,7 @@ class StreamWriteContext {
 
 grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t) {
+  update_target_write_size(t);
   WriteContext ctx(t);
   ctx.FlushSettings();
   ctx.FlushPingAcks();
@@ -631,16 +724,22 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
   while (grpc_chttp2_stream* s = ctx.NextStream()) {
     StreamWriteContext stream_ctx(&ctx, s);
     size_t orig_len = t->outbuf.length;
-    stream_ctx.FlushInitialMetadata();
-    stream_ctx.FlushWindowUpdates();
-    stream_ctx.FlushData();
-    stream_ctx.FlushTrailingMetadata();
+    stream_ctx.Flush();
     if (t->outbuf.length > orig_len) {
       /* Add this stream to the list of the contexts to be traced at TCP */
       s->byte_counter += t->outbuf.length - orig_len;
       if (s->traced && grpc_endpoint_can_track_err(t->ep)) {
         grpc_core::ContextList::Append(&t->cl, s);
       }
+      if (s->context != nullptr &&
+          s->context[GRPC_CONTEXT_TCP_TRACER].value != nullptr &&
+          grpc_endpoint_can_track_err(t->ep)) {
+        auto tcp_tracer = grpc_core::GetTcpTracer(s->context);
+        if (tcp_tracer != nullptr) {
+          grpc_core::ContextList::Append(&t->cl, std::move(tcp_tracer),
+                                         s->byte_counter);
+        }
+      }
     }
     if (stream_ctx.stream_became_writable()) {
       if (!grpc_chttp2_list_add_writing_stream(t, s)) {
@@ -666,6 +765,8 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
 
   if (t->channelz_socket != nullptr) {
     t->channelz_socket->RecordMessagesSent(t->num_messages_in_next_write);
+    t->channelz_socket->RecordFlowControlWindows(
+        t->flow_control.announced_window(), t->flow_control.remote_window());
   }
   t->num_messages_in_next_write = 0;
 
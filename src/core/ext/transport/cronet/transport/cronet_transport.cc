@@ -135,6 +135,9 @@ struct read_state {
 
   /* vars to store data coming from server */
   char* read_buffer = nullptr;
+  /* refcounted slice that message payloads are read into directly; when
+     non-empty, read_buffer points into it */
+  grpc_core::Slice read_data_slice;
   bool length_field_received = false;
   int received_bytes = 0;
   int remaining_bytes = 0;
@@ -299,10 +302,7 @@ static const char* op_id_string(enum e_op_id i) {
 }
 
 static void null_and_maybe_free_read_buffer(stream_obj* s) {
-  if (s->state.rs.read_buffer &&
-      s->state.rs.read_buffer != s->state.rs.grpc_header_bytes) {
-    gpr_free(s->state.rs.read_buffer);
-  }
+  s->state.rs.read_data_slice = grpc_core::Slice();
   s->state.rs.read_buffer = nullptr;
 }
 
@@ -1210,9 +1210,14 @@ static enum e_op_result execute_stream_op(struct op_and_state* oas) {
         CRONET_LOG(GPR_DEBUG, "length field = %d",
                    stream_state->rs.length_field);
         if (stream_state->rs.length_field > 0) {
-          stream_state->rs.read_buffer = static_cast<char*>(
-              gpr_malloc(static_cast<size_t>(stream_state->rs.length_field)));
-          GPR_ASSERT(stream_state->rs.read_buffer);
+          /* Let Cronet write the payload straight into the slice that is
+             handed to the application. It must not be inlined, since its
+             bytes would move along with the slice. */
+          grpc_slice read_data_slice = grpc_slice_malloc_large(
+              static_cast<size_t>(stream_state->rs.length_field));
+          stream_state->rs.read_buffer =
+              reinterpret_cast<char*>(GRPC_SLICE_START_PTR(read_data_slice));
+          stream_state->rs.read_data_slice = grpc_core::Slice(read_data_slice);
           stream_state->rs.remaining_bytes = stream_state->rs.length_field;
           stream_state->rs.received_bytes = 0;
           CRONET_LOG(GPR_DEBUG, "bidirectional_stream_read(%p)", s->cbs);
@@ -1264,16 +1269,12 @@ static enum e_op_result execute_stream_op(struct op_and_state* oas) {
       }
     } else if (stream_state->rs.remaining_bytes == 0) {
       CRONET_LOG(GPR_DEBUG, "read operation complete");
-      grpc_slice read_data_slice =
-          GRPC_SLICE_MALLOC((uint32_t)stream_state->rs.length_field);
-      uint8_t* dst_p = GRPC_SLICE_START_PTR(read_data_slice);
-      memcpy(dst_p, stream_state->rs.read_buffer,
-             static_cast<size_t>(stream_state->rs.length_field));
+      grpc_core::Slice read_data_slice =
+          std::move(stream_state->rs.read_data_slice);
       null_and_maybe_free_read_buffer(s);
       /* Clean up read_slice_buffer in case there is unread data. */
       stream_state->rs.read_slice_buffer.Clear();
-      stream_state->rs.read_slice_buffer.Append(
-          grpc_core::Slice(read_data_slice));
+      stream_state->rs.read_slice_buffer.Append(std::move(read_data_slice));
       uint32_t flags = 0;
       if (stream_state->rs.compressed) {
         flags = GRPC_WRITE_INTERNAL_COMPRESS;
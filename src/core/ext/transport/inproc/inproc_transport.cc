@@ -302,8 +302,7 @@ class CopySink {
   explicit CopySink(grpc_metadata_batch* dst) : dst_(dst) {}
 
   void Encode(const grpc_core::Slice& key, const grpc_core::Slice& value) {
-    dst_->Append(key.as_string_view(), value.AsOwned(),
-                 [](absl::string_view, const grpc_core::Slice&) {});
+    dst_->AppendUnknown(key.Ref(), value.AsOwned());
   }
 
   template <class T, class V>
@@ -341,6 +340,19 @@ void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
   metadata->Encode(&sink);
 }
 
+// Hands metadata that fill_in_metadata already copied into this stream to the
+// recv op that asked for it. Both batches live in the call arena, so the
+// contents are moved rather than copied a second time.
+void move_in_metadata(inproc_stream* s, grpc_metadata_batch* metadata,
+                      grpc_metadata_batch* out_md) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_inproc_trace)) {
+    log_metadata(metadata, s->t->is_client,
+                 metadata->get_pointer(grpc_core::WaitForReady()) != nullptr);
+  }
+  *out_md = std::move(*metadata);
+  metadata->Clear();
+}
+
 int init_stream(grpc_transport* gt, grpc_stream* gs,
                 grpc_stream_refcount* refcount, const void* server_data,
                 grpc_core::Arena* arena) {
@@ -678,10 +690,9 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
 
     if (s->to_read_initial_md_filled) {
       s->initial_md_recvd = true;
-      fill_in_metadata(s, &s->to_read_initial_md,
+      move_in_metadata(s, &s->to_read_initial_md,
                        s->recv_initial_md_op->payload->recv_initial_metadata
-                           .recv_initial_metadata,
-                       nullptr);
+                           .recv_initial_metadata);
       if (s->deadline != grpc_core::Timestamp::InfFuture()) {
         s->recv_initial_md_op->payload->recv_initial_metadata
             .recv_initial_metadata->Set(grpc_core::GrpcTimeoutMetadata(),
@@ -760,10 +771,9 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
     if (s->recv_trailing_md_op != nullptr) {
       // We wanted trailing metadata and we got it
       s->trailing_md_recvd = true;
-      fill_in_metadata(s, &s->to_read_trailing_md,
+      move_in_metadata(s, &s->to_read_trailing_md,
                        s->recv_trailing_md_op->payload->recv_trailing_metadata
-                           .recv_trailing_metadata,
-                       nullptr);
+                           .recv_trailing_metadata);
       s->to_read_trailing_md.Clear();
       s->to_read_trailing_md_filled = false;
 
@@ -68,15 +68,20 @@ class XdsApi {
 
     // Called to parse each individual resource in the ADS response.
     // Note that resource_name is non-empty only when the resource was
-    // wrapped in a Resource wrapper proto.
+    // wrapped in a Resource wrapper proto.  resource_version is set only
+    // in delta responses, which version each resource separately.
     virtual void ParseResource(upb_Arena* arena, size_t idx,
                                absl::string_view type_url,
                                absl::string_view resource_name,
+                               absl::string_view resource_version,
                                absl::string_view serialized_resource) = 0;
 
     // Called when a resource is wrapped in a Resource wrapper proto but
     // we fail to deserialize the wrapper proto.
     virtual void ResourceWrapperParsingFailed(size_t idx) = 0;
+
+    // Called for each resource that a delta response says was removed.
+    virtual void ResourceRemoved(absl::string_view resource_name) = 0;
   };
 
   struct ClusterLoadReport {
@@ -161,6 +166,23 @@ class XdsApi {
   absl::Status ParseAdsResponse(absl::string_view encoded_response,
                                 AdsResponseParserInterface* parser);
 
+  // Creates a delta (incremental) ADS request.  The subscribe and
+  // unsubscribe lists are changes relative to the previous request for
+  // the same type on the stream.  initial_resource_versions is used only
+  // in the first request for a type on a stream.
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& subscribe,
+      const std::vector<std::string>& unsubscribe,
+      const std::map<std::string /*resource_name*/, std::string /*version*/>&
+          initial_resource_versions,
+      absl::Status status, bool populate_node);
+
+  // Same as ParseAdsResponse(), but for a delta response.  The
+  // version reported in the top-level fields is system_version_info.
+  absl::Status ParseDeltaAdsResponse(absl::string_view encoded_response,
+                                     AdsResponseParserInterface* parser);
+
   // Creates an initial LRS request.
   std::string CreateLrsInitialRequest();
 
@@ -178,6 +200,19 @@ class XdsApi {
   std::string AssembleClientConfig(
       const ResourceTypeMetadataMap& resource_type_metadata_map);
 
+  // An ACKED resource from a serialized client config.
+  struct ClientConfigResource {
+    std::string type_url;  // Without the "type.googleapis.com/" prefix.
+    std::string name;
+    std::string version;
+    std::string serialized_proto;
+  };
+
+  // Parses a client config serialized by AssembleClientConfig() and
+  // populates resources with the ACKED resources in it.
+  absl::Status ParseClientConfig(absl::string_view serialized_client_config,
+                                 std::vector<ClientConfigResource>* resources);
+
  private:
   XdsClient* client_;
   TraceFlag* tracer_;
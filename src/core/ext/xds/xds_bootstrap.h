@@ -47,6 +47,8 @@ class XdsBootstrap {
 
     virtual const std::string& server_uri() const = 0;
     virtual bool IgnoreResourceDeletion() const = 0;
+    // If true, use the delta (incremental) variant of the ADS protocol.
+    virtual bool UseDeltaXds() const = 0;
 
     virtual bool Equals(const XdsServer& other) const = 0;
 
@@ -96,6 +96,7 @@ namespace {
 
 constexpr absl::string_view kServerFeatureIgnoreResourceDeletion =
     "ignore_resource_deletion";
+constexpr absl::string_view kServerFeatureDeltaXds = "delta_xds";
 
 }  // namespace
 
@@ -104,6 +105,11 @@ bool GrpcXdsBootstrap::GrpcXdsServer::IgnoreResourceDeletion() const {
              kServerFeatureIgnoreResourceDeletion)) != server_features_.end();
 }
 
+bool GrpcXdsBootstrap::GrpcXdsServer::UseDeltaXds() const {
+  return server_features_.find(std::string(kServerFeatureDeltaXds)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsBootstrap::GrpcXdsServer::Equals(const XdsServer& other) const {
   const auto& o = static_cast<const GrpcXdsServer&>(other);
   return (server_uri_ == o.server_uri_ &&
@@ -162,7 +168,8 @@ void GrpcXdsBootstrap::GrpcXdsServer::JsonPostLoad(const Json& json,
         for (const Json& feature_json : array) {
           if (feature_json.type() == Json::Type::STRING &&
               (feature_json.string_value() ==
-               kServerFeatureIgnoreResourceDeletion)) {
+                   kServerFeatureIgnoreResourceDeletion ||
+               feature_json.string_value() == kServerFeatureDeltaXds)) {
             server_features_.insert(feature_json.string_value());
           }
         }
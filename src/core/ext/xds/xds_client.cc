@@ -22,7 +22,9 @@
 #include <string.h>
 
 #include <algorithm>
+#include <iterator>
 
+#include "absl/hash/hash.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -140,6 +142,8 @@ class XdsClient::ChannelState::AdsCallState
       std::map<std::string /*authority*/, std::set<XdsResourceKey>>
           resources_seen;
       bool have_valid_resources = false;
+      // Whether a resource in the cache was added, changed or deleted.
+      bool resources_changed = false;
     };
 
     explicit AdsResponseParser(AdsCallState* ads_call_state)
@@ -150,16 +154,35 @@ class XdsClient::ChannelState::AdsCallState
 
     void ParseResource(upb_Arena* arena, size_t idx, absl::string_view type_url,
                        absl::string_view resource_name,
+                       absl::string_view resource_version,
                        absl::string_view serialized_resource) override
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
     void ResourceWrapperParsingFailed(size_t idx) override;
 
+    void ResourceRemoved(absl::string_view resource_name) override
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     Result TakeResult() { return std::move(result_); }
 
    private:
     XdsClient* xds_client() const { return ads_call_state_->xds_client(); }
 
+    // Returns the name of the cached resource whose serialized form is
+    // identical to serialized_resource, if any.  Such a resource does not
+    // need to be decoded again.
+    absl::optional<XdsResourceName> FindUnchangedResource(
+        absl::string_view resource_name,
+        absl::string_view serialized_resource)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    // Records that the response contained the named resource.  Returns
+    // the cache entry for the resource, or null if we don't have a
+    // subscription for it.
+    ResourceState* ResourceSeen(const XdsResourceName& name,
+                                absl::string_view resource_name)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     AdsCallState* ads_call_state_;
     const Timestamp update_time_ = Timestamp::Now();
     Result result_;
@@ -285,11 +308,32 @@ class XdsClient::ChannelState::AdsCallState
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Delta xDS only: whether a request for this type has been sent on
+    // this stream, and the full names of the resources that the server
+    // was told to send.  Each request carries only the changes.
+    bool sent_initial_request = false;
+    std::set<std::string> sent_resource_names;
   };
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
+  // Constructs a delta ADS request for the changes in the subscriptions
+  // of the given type since the last request.
+  std::string CreateDeltaRequestLocked(const XdsResourceType* type,
+                                       ResourceTypeState* state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+  // Handles the server's deletion of a resource, unless the bootstrap
+  // config says to ignore deletions.  Returns true if the resource was
+  // deleted.
+  bool OnResourceDeletedLocked(const XdsResourceType* type,
+                               const std::string& authority,
+                               const XdsResourceKey& resource_key,
+                               ResourceState* resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
   void OnStatusReceived(absl::Status status);
@@ -556,14 +600,15 @@ void XdsClient::ChannelState::SetChannelStatusLocked(absl::Status status) {
     }
   }
   // Enqueue notification for the watchers.
-  xds_client_->work_serializer_.Schedule(
-      [watchers = std::move(watchers), status = std::move(status)]()
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(xds_client_->work_serializer_) {
-            for (const auto& watcher : watchers) {
+  for (const auto& watcher : watchers) {
+    xds_client_->work_serializer_.Schedule(
+        watcher.get(),
+        [watcher, status]()
+            ABSL_EXCLUSIVE_LOCKS_REQUIRED(xds_client_->work_serializer_) {
               watcher->OnError(status);
-            }
-          },
-      DEBUG_LOCATION);
+            },
+        DEBUG_LOCATION);
+  }
 }
 
 //
@@ -714,7 +759,8 @@ void UpdateResourceMetadataNacked(const std::string& version,
 
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
     upb_Arena* arena, size_t idx, absl::string_view type_url,
-    absl::string_view resource_name, absl::string_view serialized_resource) {
+    absl::string_view resource_name, absl::string_view resource_version,
+    absl::string_view serialized_resource) {
   std::string error_prefix = absl::StrCat(
       "resource index ", idx, ": ",
       resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
@@ -725,6 +771,29 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
                      " (should be ", result_.type_url, ")"));
     return;
   }
+  // If the resource is byte-for-byte identical to the cached one, skip
+  // decoding and validating it again.
+  absl::optional<XdsResourceName> unchanged_name =
+      FindUnchangedResource(resource_name, serialized_resource);
+  if (unchanged_name.has_value()) {
+    const std::string full_name =
+        resource_name.empty()
+            ? XdsClient::ConstructFullXdsResourceName(
+                  unchanged_name->authority, result_.type->type_url(),
+                  unchanged_name->key)
+            : std::string(resource_name);
+    ResourceState* resource_state = ResourceSeen(*unchanged_name, full_name);
+    result_.have_valid_resources = true;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+      gpr_log(GPR_INFO,
+              "[xds_client %p] %s resource %s unchanged, skipping decode.",
+              xds_client(), result_.type_url.c_str(), full_name.c_str());
+    }
+    if (!resource_version.empty()) {
+      resource_state->meta.version = std::string(resource_version);
+    }
+    return;
+  }
   // Parse the resource.
   XdsResourceType::DecodeContext context = {
       xds_client(), ads_call_state_->chand()->server_, &grpc_xds_client_trace,
@@ -760,41 +829,134 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
         absl::StrCat(error_prefix, "Cannot parse xDS resource name"));
     return;
   }
+  ResourceState* resource_state_ptr =
+      ResourceSeen(*parsed_resource_name, resource_name);
+  if (resource_state_ptr == nullptr) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  ResourceState& resource_state = *resource_state_ptr;
+  // Delta responses carry a version for each resource.
+  const std::string version = resource_version.empty()
+                                  ? result_.version
+                                  : std::string(resource_version);
+  // Update resource state based on whether the resource is valid.
+  if (!decode_status.ok()) {
+    xds_client()->NotifyWatchersOnErrorLocked(
+        resource_state.watchers,
+        absl::UnavailableError(
+            absl::StrCat("invalid resource: ", decode_status.ToString())));
+    UpdateResourceMetadataNacked(version, decode_status.ToString(),
+                                 update_time_, &resource_state.meta);
+    return;
+  }
+  // Resource is valid.
+  result_.have_valid_resources = true;
+  // If it didn't change, ignore it.
+  if (resource_state.resource != nullptr &&
+      result_.type->ResourcesEqual(resource_state.resource.get(),
+                                   decode_result.resource->get())) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+      gpr_log(GPR_INFO,
+              "[xds_client %p] %s resource %s identical to current, ignoring.",
+              xds_client(), result_.type_url.c_str(),
+              std::string(resource_name).c_str());
+    }
+    // Still record the new version, since that is what we report to a
+    // delta server on a new stream.
+    if (!resource_version.empty()) resource_state.meta.version = version;
+    return;
+  }
+  // Update the resource state.
+  xds_client()->ReindexSerializedResourceLocked(
+      result_.type, *parsed_resource_name,
+      resource_state.meta.serialized_proto, serialized_resource);
+  resource_state.resource = std::move(*decode_result.resource);
+  resource_state.meta = CreateResourceMetadataAcked(
+      std::string(serialized_resource), version, update_time_);
+  result_.resources_changed = true;
+  // Notify watchers.
+  auto& watchers_list = resource_state.watchers;
+  std::shared_ptr<const XdsResourceType::ResourceData> value =
+      result_.type->CopyResource(resource_state.resource.get());
+  for (const auto& p : watchers_list) {
+    xds_client()->work_serializer_.Schedule(
+        p.first,
+        [watcher = p.second, value]()
+            ABSL_EXCLUSIVE_LOCKS_REQUIRED(&xds_client()->work_serializer_) {
+              watcher->OnGenericResourceChanged(value.get());
+            },
+        DEBUG_LOCATION);
+  }
+}
+
+absl::optional<XdsClient::XdsResourceName>
+XdsClient::ChannelState::AdsCallState::AdsResponseParser::FindUnchangedResource(
+    absl::string_view resource_name, absl::string_view serialized_resource) {
+  XdsResourceName name;
+  if (!resource_name.empty()) {
+    auto parsed_resource_name =
+        xds_client()->ParseXdsResourceName(resource_name, result_.type);
+    if (!parsed_resource_name.ok()) return absl::nullopt;
+    name = std::move(*parsed_resource_name);
+  } else {
+    // Without a Resource wrapper, the name is known only from the last
+    // time we decoded the same bytes.
+    auto type_it = xds_client()->serialized_resource_index_.find(result_.type);
+    if (type_it == xds_client()->serialized_resource_index_.end()) {
+      return absl::nullopt;
+    }
+    auto it = type_it->second.find(
+        absl::Hash<absl::string_view>()(serialized_resource));
+    if (it == type_it->second.end()) return absl::nullopt;
+    name = it->second;
+  }
+  // Compare against the cached bytes, which also guards against hash
+  // collisions.
+  auto authority_it = xds_client()->authority_state_map_.find(name.authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) {
+    return absl::nullopt;
+  }
+  auto type_it = authority_it->second.resource_map.find(result_.type);
+  if (type_it == authority_it->second.resource_map.end()) return absl::nullopt;
+  auto it = type_it->second.find(name.key);
+  if (it == type_it->second.end() || it->second.resource == nullptr ||
+      it->second.meta.serialized_proto != serialized_resource) {
+    return absl::nullopt;
+  }
+  return name;
+}
+
+XdsClient::ResourceState*
+XdsClient::ChannelState::AdsCallState::AdsResponseParser::ResourceSeen(
+    const XdsResourceName& name, absl::string_view resource_name) {
   // Cancel resource-does-not-exist timer, if needed.
   auto timer_it = ads_call_state_->state_map_.find(result_.type);
   if (timer_it != ads_call_state_->state_map_.end()) {
-    auto it = timer_it->second.subscribed_resources.find(
-        parsed_resource_name->authority);
+    auto it = timer_it->second.subscribed_resources.find(name.authority);
     if (it != timer_it->second.subscribed_resources.end()) {
-      auto res_it = it->second.find(parsed_resource_name->key);
+      auto res_it = it->second.find(name.key);
       if (res_it != it->second.end()) {
         res_it->second->MaybeCancelTimer();
       }
     }
   }
   // Lookup the authority in the cache.
-  auto authority_it =
-      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  auto authority_it = xds_client()->authority_state_map_.find(name.authority);
   if (authority_it == xds_client()->authority_state_map_.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
+    return nullptr;
   }
   // Found authority, so look up type.
   AuthorityState& authority_state = authority_it->second;
   auto type_it = authority_state.resource_map.find(result_.type);
-  if (type_it == authority_state.resource_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
+  if (type_it == authority_state.resource_map.end()) return nullptr;
   auto& type_map = type_it->second;
   // Found type, so look up resource key.
-  auto it = type_map.find(parsed_resource_name->key);
-  if (it == type_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
+  auto it = type_map.find(name.key);
+  if (it == type_map.end()) return nullptr;
   ResourceState& resource_state = it->second;
   // If needed, record that we've seen this resource.
   if (result_.type->AllResourcesRequiredInSotW()) {
-    result_.resources_seen[parsed_resource_name->authority].insert(
-        parsed_resource_name->key);
+    result_.resources_seen[name.authority].insert(name.key);
   }
   // If we previously ignored the resource's deletion, log that we're
   // now re-adding it.
@@ -805,50 +967,10 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
             "name %s",
             xds_client(),
             ads_call_state_->chand()->server_.server_uri().c_str(),
-            std::string(type_url).c_str(), std::string(resource_name).c_str());
+            result_.type_url.c_str(), std::string(resource_name).c_str());
     resource_state.ignored_deletion = false;
   }
-  // Update resource state based on whether the resource is valid.
-  if (!decode_status.ok()) {
-    xds_client()->NotifyWatchersOnErrorLocked(
-        resource_state.watchers,
-        absl::UnavailableError(
-            absl::StrCat("invalid resource: ", decode_status.ToString())));
-    UpdateResourceMetadataNacked(result_.version, decode_status.ToString(),
-                                 update_time_, &resource_state.meta);
-    return;
-  }
-  // Resource is valid.
-  result_.have_valid_resources = true;
-  // If it didn't change, ignore it.
-  if (resource_state.resource != nullptr &&
-      result_.type->ResourcesEqual(resource_state.resource.get(),
-                                   decode_result.resource->get())) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
-      gpr_log(GPR_INFO,
-              "[xds_client %p] %s resource %s identical to current, ignoring.",
-              xds_client(), result_.type_url.c_str(),
-              std::string(resource_name).c_str());
-    }
-    return;
-  }
-  // Update the resource state.
-  resource_state.resource = std::move(*decode_result.resource);
-  resource_state.meta = CreateResourceMetadataAcked(
-      std::string(serialized_resource), result_.version, update_time_);
-  // Notify watchers.
-  auto& watchers_list = resource_state.watchers;
-  auto* value =
-      result_.type->CopyResource(resource_state.resource.get()).release();
-  xds_client()->work_serializer_.Schedule(
-      [watchers_list, value]()
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&xds_client()->work_serializer_) {
-            for (const auto& p : watchers_list) {
-              p.first->OnGenericResourceChanged(value);
-            }
-            delete value;
-          },
-      DEBUG_LOCATION);
+  return &resource_state;
 }
 
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
@@ -857,6 +979,52 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
       "resource index ", idx, ": Can't decode Resource proto wrapper"));
 }
 
+void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
+    ResourceRemoved(absl::string_view resource_name) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, result_.type);
+  if (!parsed_resource_name.ok()) {
+    result_.errors.emplace_back(
+        absl::StrCat("removed resource ", resource_name,
+                     ": Cannot parse xDS resource name"));
+    return;
+  }
+  // The server has answered for this resource, so the
+  // resource-does-not-exist timer is no longer needed.
+  auto timer_it = ads_call_state_->state_map_.find(result_.type);
+  if (timer_it != ads_call_state_->state_map_.end()) {
+    auto it = timer_it->second.subscribed_resources.find(
+        parsed_resource_name->authority);
+    if (it != timer_it->second.subscribed_resources.end()) {
+      auto res_it = it->second.find(parsed_resource_name->key);
+      if (res_it != it->second.end()) {
+        res_it->second->MaybeCancelTimer();
+      }
+    }
+  }
+  // Look up the resource in the cache.
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return;
+  auto type_it = authority_it->second.resource_map.find(result_.type);
+  if (type_it == authority_it->second.resource_map.end()) return;
+  auto it = type_it->second.find(parsed_resource_name->key);
+  if (it == type_it->second.end()) return;
+  ResourceState& resource_state = it->second;
+  // Unlike a resource missing from a SotW response, a removal is
+  // explicit, so it applies even to a resource that we have not received
+  // yet.
+  if (resource_state.resource == nullptr) {
+    resource_state.meta.client_status =
+        XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+  }
+  if (ads_call_state_->OnResourceDeletedLocked(
+          result_.type, parsed_resource_name->authority,
+          parsed_resource_name->key, &resource_state)) {
+    result_.resources_changed = true;
+  }
+}
+
 //
 // XdsClient::ChannelState::AdsCallState
 //
@@ -871,8 +1039,11 @@ XdsClient::ChannelState::AdsCallState::AdsCallState(
   GPR_ASSERT(xds_client() != nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      chand()->server_.UseDeltaXds()
+          ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "DeltaAggregatedResources"
+          : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "StreamAggregatedResources";
   call_ = chand()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -924,9 +1095,20 @@ void XdsClient::ChannelState::AdsCallState::SendMessageLocked(
     return;
   }
   auto& state = state_map_[type];
-  std::string serialized_message = xds_client()->api_.CreateAdsRequest(
-      type->type_url(), chand()->resource_type_version_map_[type], state.nonce,
-      ResourceNamesForRequest(type), state.status, !sent_initial_message_);
+  std::string serialized_message;
+  if (chand()->server_.UseDeltaXds()) {
+    // An initial delta request with no resource names would be a wildcard
+    // subscription, which we never want.
+    if (!state.sent_initial_request && state.subscribed_resources.empty()) {
+      return;
+    }
+    serialized_message = CreateDeltaRequestLocked(type, &state);
+  } else {
+    serialized_message = xds_client()->api_.CreateAdsRequest(
+        type->type_url(), chand()->resource_type_version_map_[type],
+        state.nonce, ResourceNamesForRequest(type), state.status,
+        !sent_initial_message_);
+  }
   sent_initial_message_ = true;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
     gpr_log(GPR_INFO,
@@ -938,10 +1120,79 @@ void XdsClient::ChannelState::AdsCallState::SendMessageLocked(
             state.nonce.c_str(), state.status.ToString().c_str());
   }
   state.status = absl::OkStatus();
+  // A delta request carries the nonce only when it is an ACK or NACK.
+  if (chand()->server_.UseDeltaXds()) state.nonce.clear();
   call_->SendMessage(std::move(serialized_message));
   send_message_pending_ = true;
 }
 
+std::string XdsClient::ChannelState::AdsCallState::CreateDeltaRequestLocked(
+    const XdsResourceType* type, ResourceTypeState* state) {
+  std::vector<std::string> resource_names = ResourceNamesForRequest(type);
+  std::set<std::string> current(resource_names.begin(), resource_names.end());
+  std::vector<std::string> subscribe;
+  std::set_difference(current.begin(), current.end(),
+                      state->sent_resource_names.begin(),
+                      state->sent_resource_names.end(),
+                      std::back_inserter(subscribe));
+  std::vector<std::string> unsubscribe;
+  std::set_difference(state->sent_resource_names.begin(),
+                      state->sent_resource_names.end(), current.begin(),
+                      current.end(), std::back_inserter(unsubscribe));
+  // In the first request for a type on a stream, tell the server which
+  // versions of the resources we already have cached, so that it does
+  // not need to resend them.
+  std::map<std::string, std::string> initial_resource_versions;
+  if (!state->sent_initial_request) {
+    for (const auto& a : state->subscribed_resources) {
+      const std::string& authority = a.first;
+      auto authority_it = xds_client()->authority_state_map_.find(authority);
+      if (authority_it == xds_client()->authority_state_map_.end()) continue;
+      auto type_it = authority_it->second.resource_map.find(type);
+      if (type_it == authority_it->second.resource_map.end()) continue;
+      for (const auto& r : a.second) {
+        auto it = type_it->second.find(r.first);
+        if (it == type_it->second.end() || it->second.resource == nullptr ||
+            it->second.meta.version.empty()) {
+          continue;
+        }
+        initial_resource_versions.emplace(
+            XdsClient::ConstructFullXdsResourceName(authority,
+                                                    type->type_url(), r.first),
+            it->second.meta.version);
+      }
+    }
+    state->sent_initial_request = true;
+  }
+  state->sent_resource_names = std::move(current);
+  return xds_client()->api_.CreateDeltaAdsRequest(
+      type->type_url(), state->nonce, subscribe, unsubscribe,
+      initial_resource_versions, state->status, !sent_initial_message_);
+}
+
+bool XdsClient::ChannelState::AdsCallState::OnResourceDeletedLocked(
+    const XdsResourceType* type, const std::string& authority,
+    const XdsResourceKey& resource_key, ResourceState* resource_state) {
+  if (resource_state->resource != nullptr &&
+      chand()->server_.IgnoreResourceDeletion()) {
+    if (!resource_state->ignored_deletion) {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] xds server %s: ignoring deletion "
+              "for resource type %s name %s",
+              xds_client(), chand()->server_.server_uri().c_str(),
+              std::string(type->type_url()).c_str(),
+              XdsClient::ConstructFullXdsResourceName(
+                  authority, type->type_url(), resource_key)
+                  .c_str());
+      resource_state->ignored_deletion = true;
+    }
+    return false;
+  }
+  resource_state->resource.reset();
+  xds_client()->NotifyWatchersOnResourceDoesNotExist(resource_state->watchers);
+  return true;
+}
+
 void XdsClient::ChannelState::AdsCallState::SubscribeLocked(
     const XdsResourceType* type, const XdsResourceName& name, bool delay_send) {
   auto& state = state_map_[type].subscribed_resources[name.authority][name.key];
@@ -993,12 +1244,16 @@ void XdsClient::ChannelState::AdsCallState::OnRequestSent(bool ok) {
 
 void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
     absl::string_view payload) {
+  bool resource_cache_changed = false;
   {
     MutexLock lock(&xds_client()->mu_);
     if (!IsCurrentCallOnChannel()) return;
     // Parse and validate the response.
     AdsResponseParser parser(this);
-    absl::Status status = xds_client()->api_.ParseAdsResponse(payload, &parser);
+    absl::Status status =
+        chand()->server_.UseDeltaXds()
+            ? xds_client()->api_.ParseDeltaAdsResponse(payload, &parser)
+            : xds_client()->api_.ParseAdsResponse(payload, &parser);
     if (!status.ok()) {
       // Ignore unparsable response.
       gpr_log(GPR_ERROR,
@@ -1026,8 +1281,10 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
                 result.type_url.c_str(), result.version.c_str(),
                 state.nonce.c_str(), state.status.ToString().c_str());
       }
-      // Delete resources not seen in update if needed.
-      if (result.type->AllResourcesRequiredInSotW()) {
+      // Delete resources not seen in update if needed.  Delta responses
+      // report deletions explicitly instead.
+      if (!chand()->server_.UseDeltaXds() &&
+          result.type->AllResourcesRequiredInSotW()) {
         for (auto& a : xds_client()->authority_state_map_) {
           const std::string& authority = a.first;
           AuthorityState& authority_state = a.second;
@@ -1052,22 +1309,9 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
               // that the resource does not exist.  For that case, we rely on
               // the request timeout instead.
               if (resource_state.resource == nullptr) continue;
-              if (chand()->server_.IgnoreResourceDeletion()) {
-                if (!resource_state.ignored_deletion) {
-                  gpr_log(GPR_ERROR,
-                          "[xds_client %p] xds server %s: ignoring deletion "
-                          "for resource type %s name %s",
-                          xds_client(), chand()->server_.server_uri().c_str(),
-                          result.type_url.c_str(),
-                          XdsClient::ConstructFullXdsResourceName(
-                              authority, result.type_url.c_str(), resource_key)
-                              .c_str());
-                  resource_state.ignored_deletion = true;
-                }
-              } else {
-                resource_state.resource.reset();
-                xds_client()->NotifyWatchersOnResourceDoesNotExist(
-                    resource_state.watchers);
+              if (OnResourceDeletedLocked(result.type, authority,
+                                          resource_key, &resource_state)) {
+                result.resources_changed = true;
               }
             }
           }
@@ -1086,9 +1330,11 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
       }
       // Send ACK or NACK.
       SendMessageLocked(result.type);
+      resource_cache_changed = result.resources_changed;
     }
   }
   xds_client()->work_serializer_.DrainQueue();
+  if (resource_cache_changed) xds_client()->OnResourceCacheChanged();
 }
 
 void XdsClient::ChannelState::AdsCallState::OnStatusReceived(
@@ -1479,7 +1725,7 @@ void XdsClient::WatchResource(const XdsResourceType* type,
       invalid_watchers_[w] = watcher;
     }
     work_serializer_.Run(
-        [watcher = std::move(watcher), status = std::move(status)]()
+        w, [watcher = std::move(watcher), status = std::move(status)]()
             ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
               watcher->OnError(status);
             },
@@ -1513,6 +1759,10 @@ void XdsClient::WatchResource(const XdsResourceType* type,
     ResourceState& resource_state =
         authority_state.resource_map[type][resource_name->key];
     resource_state.watchers[w] = watcher;
+    if (resource_state.resource == nullptr && !resource_seeds_.empty()) {
+      MaybeSeedResourceLocked(type, *resource_name, *xds_server,
+                              &resource_state);
+    }
     // If we already have a cached value for the resource, notify the new
     // watcher immediately.
     if (resource_state.resource != nullptr) {
@@ -1523,6 +1773,7 @@ void XdsClient::WatchResource(const XdsResourceType* type,
       }
       auto* value = type->CopyResource(resource_state.resource.get()).release();
       work_serializer_.Schedule(
+          w,
           [watcher, value]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
             watcher->OnGenericResourceChanged(value);
             delete value;
@@ -1536,6 +1787,7 @@ void XdsClient::WatchResource(const XdsResourceType* type,
                 std::string(name).c_str());
       }
       work_serializer_.Schedule(
+          w,
           [watcher]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
             watcher->OnResourceDoesNotExist();
           },
@@ -1555,6 +1807,7 @@ void XdsClient::WatchResource(const XdsResourceType* type,
         absl::StrAppend(&details, " (node ID:", bootstrap_->node()->id(), ")");
       }
       work_serializer_.Schedule(
+          w,
           [watcher, details = std::move(details)]()
               ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
                 watcher->OnError(absl::UnavailableError(
@@ -1577,6 +1830,7 @@ void XdsClient::WatchResource(const XdsResourceType* type,
                 channel_status.ToString().c_str());
       }
       work_serializer_.Schedule(
+          w,
           [watcher = std::move(watcher), status = std::move(channel_status)]()
               ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) mutable {
                 watcher->OnError(std::move(status));
@@ -1623,6 +1877,9 @@ void XdsClient::CancelResourceWatch(const XdsResourceType* type,
     }
     authority_state.channel_state->UnsubscribeLocked(type, *resource_name,
                                                      delay_unsubscription);
+    ReindexSerializedResourceLocked(type, *resource_name,
+                                    resource_state.meta.serialized_proto,
+                                    absl::string_view());
     type_map.erase(resource_it);
     if (type_map.empty()) {
       authority_state.resource_map.erase(type_it);
@@ -1633,6 +1890,24 @@ void XdsClient::CancelResourceWatch(const XdsResourceType* type,
   }
 }
 
+void XdsClient::ReindexSerializedResourceLocked(
+    const XdsResourceType* type, const XdsResourceName& name,
+    absl::string_view old_serialized, absl::string_view new_serialized) {
+  auto& index = serialized_resource_index_[type];
+  if (!old_serialized.empty()) {
+    auto it = index.find(absl::Hash<absl::string_view>()(old_serialized));
+    // The entry may belong to another resource after a hash collision.
+    if (it != index.end() && it->second.authority == name.authority &&
+        !(it->second.key < name.key) && !(name.key < it->second.key)) {
+      index.erase(it);
+    }
+  }
+  if (!new_serialized.empty()) {
+    index[absl::Hash<absl::string_view>()(new_serialized)] = name;
+  }
+  if (index.empty()) serialized_resource_index_.erase(type);
+}
+
 void XdsClient::MaybeRegisterResourceTypeLocked(
     const XdsResourceType* resource_type) {
   auto it = resource_types_.find(resource_type->type_url());
@@ -1853,26 +2128,29 @@ void XdsClient::NotifyWatchersOnErrorLocked(
         status.code(),
         absl::StrCat(status.message(), " (node ID:", node->id(), ")"));
   }
-  work_serializer_.Schedule(
-      [watchers, status = std::move(status)]()
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
-            for (const auto& p : watchers) {
-              p.first->OnError(status);
-            }
-          },
-      DEBUG_LOCATION);
+  for (const auto& p : watchers) {
+    work_serializer_.Schedule(
+        p.first,
+        [watcher = p.second, status]()
+            ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
+              watcher->OnError(status);
+            },
+        DEBUG_LOCATION);
+  }
 }
 
 void XdsClient::NotifyWatchersOnResourceDoesNotExist(
     const std::map<ResourceWatcherInterface*,
                    RefCountedPtr<ResourceWatcherInterface>>& watchers) {
-  work_serializer_.Schedule(
-      [watchers]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
-        for (const auto& p : watchers) {
-          p.first->OnResourceDoesNotExist();
-        }
-      },
-      DEBUG_LOCATION);
+  for (const auto& p : watchers) {
+    work_serializer_.Schedule(
+        p.first,
+        [watcher = p.second]()
+            ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) {
+              watcher->OnResourceDoesNotExist();
+            },
+        DEBUG_LOCATION);
+  }
 }
 
 XdsApi::ClusterLoadReportMap XdsClient::BuildLoadReportSnapshotLocked(
@@ -1962,6 +2240,15 @@ XdsApi::ClusterLoadReportMap XdsClient::BuildLoadReportSnapshotLocked(
 
 std::string XdsClient::DumpClientConfigBinary() {
   MutexLock lock(&mu_);
+  return DumpClientConfigLocked(/*cached_resources_only=*/false);
+}
+
+std::string XdsClient::DumpResourceCacheBinary() {
+  MutexLock lock(&mu_);
+  return DumpClientConfigLocked(/*cached_resources_only=*/true);
+}
+
+std::string XdsClient::DumpClientConfigLocked(bool cached_resources_only) {
   XdsApi::ResourceTypeMetadataMap resource_type_metadata_map;
   for (const auto& a : authority_state_map_) {  // authority
     const std::string& authority = a.first;
@@ -1972,6 +2259,9 @@ std::string XdsClient::DumpClientConfigBinary() {
       for (const auto& r : t.second) {  // resource id
         const XdsResourceKey& resource_key = r.first;
         const ResourceState& resource_state = r.second;
+        if (cached_resources_only && resource_state.resource == nullptr) {
+          continue;
+        }
         resource_metadata_map[ConstructFullXdsResourceName(
             authority, type->type_url(), resource_key)] = &resource_state.meta;
       }
@@ -1981,4 +2271,60 @@ std::string XdsClient::DumpClientConfigBinary() {
   return api_.AssembleClientConfig(resource_type_metadata_map);
 }
 
+absl::Status XdsClient::SeedResourceCache(
+    absl::string_view serialized_client_config) {
+  std::vector<XdsApi::ClientConfigResource> resources;
+  absl::Status status =
+      api_.ParseClientConfig(serialized_client_config, &resources);
+  if (!status.ok()) return status;
+  MutexLock lock(&mu_);
+  for (auto& resource : resources) {
+    auto key = std::make_pair(resource.type_url, resource.name);
+    resource_seeds_[std::move(key)] = std::move(resource);
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO, "[xds_client %p] seeded %" PRIuPTR " resources", this,
+            resources.size());
+  }
+  return absl::OkStatus();
+}
+
+void XdsClient::MaybeSeedResourceLocked(
+    const XdsResourceType* type, const XdsResourceName& name,
+    const XdsBootstrap::XdsServer& xds_server, ResourceState* resource_state) {
+  auto it = resource_seeds_.find(std::make_pair(
+      std::string(type->type_url()),
+      ConstructFullXdsResourceName(name.authority, type->type_url(),
+                                   name.key)));
+  if (it == resource_seeds_.end()) return;
+  XdsApi::ClientConfigResource seed = std::move(it->second);
+  resource_seeds_.erase(it);
+  upb::Arena arena;
+  XdsResourceType::DecodeContext context = {
+      this, xds_server, &grpc_xds_client_trace, symtab_.ptr(), arena.ptr()};
+  XdsResourceType::DecodeResult result =
+      type->Decode(context, seed.serialized_proto);
+  if (!result.resource.ok()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+      gpr_log(GPR_INFO, "[xds_client %p] ignoring invalid seed for %s: %s",
+              this, seed.name.c_str(),
+              result.resource.status().ToString().c_str());
+    }
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO, "[xds_client %p] using seeded %s resource %s", this,
+            seed.type_url.c_str(), seed.name.c_str());
+  }
+  // Treat the seed as if it had been received, so that the server's copy
+  // of the same bytes is recognized as unchanged.
+  ReindexSerializedResourceLocked(type, name,
+                                  resource_state->meta.serialized_proto,
+                                  seed.serialized_proto);
+  resource_state->resource = std::move(*result.resource);
+  resource_state->meta = CreateResourceMetadataAcked(
+      std::move(seed.serialized_proto), std::move(seed.version),
+      Timestamp::Now());
+}
+
 }  // namespace grpc_core
@@ -19,10 +19,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -145,10 +148,26 @@ class XdsClient : public DualRefCounted<XdsClient> {
   // implementation.
   std::string DumpClientConfigBinary();
 
+  // Dumps the resources in the cache, in the same format as
+  // DumpClientConfigBinary() but without the resources that have not been
+  // received.  The result can be used to seed another XdsClient.
+  std::string DumpResourceCacheBinary();
+
+  // Seeds the cache from the output of DumpResourceCacheBinary(),
+  // typically from another process.  The first watch for a seeded
+  // resource gets the seeded value as if it had come from the xDS server;
+  // the server's responses then replace it as usual.
+  absl::Status SeedResourceCache(absl::string_view serialized_client_config);
+
   grpc_event_engine::experimental::EventEngine* engine() {
     return engine_.get();
   }
 
+ protected:
+  // Called after an ADS response added, changed or deleted resources in
+  // the cache.  Invoked without holding any locks.
+  virtual void OnResourceCacheChanged() {}
+
  private:
   struct XdsResourceKey {
     std::string id;
@@ -283,6 +302,25 @@ class XdsClient : public DualRefCounted<XdsClient> {
   void MaybeRegisterResourceTypeLocked(const XdsResourceType* resource_type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Updates serialized_resource_index_ when the serialized form of a
+  // cached resource changes.  Either may be empty.
+  void ReindexSerializedResourceLocked(const XdsResourceType* type,
+                                       const XdsResourceName& name,
+                                       absl::string_view old_serialized,
+                                       absl::string_view new_serialized)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // If there is a seed for the named resource, decodes it into
+  // resource_state and drops the seed.
+  void MaybeSeedResourceLocked(const XdsResourceType* type,
+                               const XdsResourceName& name,
+                               const XdsBootstrap::XdsServer& xds_server,
+                               ResourceState* resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  std::string DumpClientConfigLocked(bool cached_resources_only)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   // Gets the type for resource_type, or null if the type is unknown.
   const XdsResourceType* GetResourceTypeLocked(absl::string_view resource_type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
@@ -306,7 +344,10 @@ class XdsClient : public DualRefCounted<XdsClient> {
   const Duration request_timeout_;
   const bool xds_federation_enabled_;
   XdsApi api_;
-  WorkSerializer work_serializer_;
+  // Watcher notifications are sharded by watcher, so that each watcher sees
+  // its notifications in order while independent watchers (e.g., different
+  // clusters) are not serialized behind each other.
+  KeyedWorkSerializer work_serializer_;
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
 
   Mutex mu_;
@@ -324,6 +365,18 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<std::string /*authority*/, AuthorityState> authority_state_map_
       ABSL_GUARDED_BY(mu_);
 
+  // For each resource type, maps the hash of the serialized form of each
+  // cached resource to the resource's name, so that a resource that has
+  // not changed can be recognized without decoding it.
+  std::map<const XdsResourceType*,
+           std::unordered_map<size_t /*hash*/, XdsResourceName>>
+      serialized_resource_index_ ABSL_GUARDED_BY(mu_);
+
+  // Resources from SeedResourceCache() that have not been watched yet.
+  std::map<std::pair<std::string /*type_url*/, std::string /*name*/>,
+           XdsApi::ClientConfigResource>
+      resource_seeds_ ABSL_GUARDED_BY(mu_);
+
   // Key is owned by the bootstrap config.
   std::map<const XdsBootstrap::XdsServer*, LoadReportServer>
       xds_load_report_server_map_ ABSL_GUARDED_BY(mu_);
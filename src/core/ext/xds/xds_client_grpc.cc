@@ -18,6 +18,8 @@
 
 #include "src/core/ext/xds/xds_client_grpc.h"
 
+#include <stdio.h>
+
 #include <algorithm>
 #include <memory>
 #include <string>
@@ -25,6 +27,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -41,10 +44,12 @@
 #include "src/core/ext/xds/xds_transport_grpc.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/error.h"
@@ -112,6 +117,43 @@ absl::StatusOr<std::string> GetBootstrapContents(const char* fallback_config) {
       "not defined");
 }
 
+// The path of the file in which processes on the same host share the
+// resources they have received, so that a new process can start with
+// them instead of waiting for the xDS server.
+absl::optional<std::string> XdsResourceSnapshotFile() {
+  return GetEnv("GRPC_EXPERIMENTAL_XDS_RESOURCE_SNAPSHOT_FILE");
+}
+
+// Whether this process writes the snapshot file.  There should be only
+// one writer per file; every process reads it.
+bool XdsResourceSnapshotWriter() {
+  auto value = GetEnv("GRPC_EXPERIMENTAL_XDS_RESOURCE_SNAPSHOT_WRITER");
+  if (!value.has_value()) return false;
+  bool parsed_value;
+  bool parse_succeeded = gpr_parse_bool_value(value->c_str(), &parsed_value);
+  return parse_succeeded && parsed_value;
+}
+
+// Replaces the contents of the file at path.  The contents are written to
+// a temporary file that is then renamed, so that readers never see a
+// partly written file.
+absl::Status ReplaceFileContents(const std::string& path,
+                                 absl::string_view contents) {
+  const std::string tmp_path = absl::StrCat(path, ".tmp");
+  FILE* file = fopen(tmp_path.c_str(), "wb");
+  if (file == nullptr) {
+    return absl::UnavailableError(absl::StrCat("cannot open ", tmp_path));
+  }
+  bool ok =
+      fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+  ok = fclose(file) == 0 && ok;
+  if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+    remove(tmp_path.c_str());
+    return absl::UnavailableError(absl::StrCat("cannot write ", path));
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace
 
 absl::StatusOr<RefCountedPtr<GrpcXdsClient>> GrpcXdsClient::GetOrCreate(
@@ -147,6 +189,11 @@ absl::StatusOr<RefCountedPtr<GrpcXdsClient>> GrpcXdsClient::GetOrCreate(
   // Instantiate XdsClient.
   auto xds_client = MakeRefCounted<GrpcXdsClient>(
       std::move(*bootstrap), ChannelArgs::FromC(g_channel_args));
+  auto snapshot_path = XdsResourceSnapshotFile();
+  if (snapshot_path.has_value()) {
+    xds_client->InitResourceSnapshot(std::move(*snapshot_path),
+                                     XdsResourceSnapshotWriter());
+  }
   g_xds_client = xds_client.get();
   return xds_client;
 }
@@ -168,6 +215,39 @@ GrpcXdsClient::~GrpcXdsClient() {
   if (g_xds_client == this) g_xds_client = nullptr;
 }
 
+void GrpcXdsClient::InitResourceSnapshot(std::string path, bool writer) {
+  grpc_slice contents;
+  grpc_error_handle error =
+      grpc_load_file(path.c_str(), /*add_null_terminator=*/false, &contents);
+  if (error.ok()) {
+    absl::Status status = SeedResourceCache(StringViewFromSlice(contents));
+    CSliceUnref(contents);
+    if (!status.ok()) {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] ignoring invalid xDS resource snapshot %s: %s",
+              this, path.c_str(), status.ToString().c_str());
+    }
+  } else if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO, "[xds_client %p] no xDS resource snapshot read: %s",
+            this, StatusToString(error).c_str());
+  }
+  resource_snapshot_path_ = std::move(path);
+  write_resource_snapshot_ = writer;
+}
+
+void GrpcXdsClient::OnResourceCacheChanged() {
+  if (!write_resource_snapshot_) return;
+  // Serialize writers, so that the file ends up with the latest dump.
+  MutexLock lock(&resource_snapshot_mu_);
+  absl::Status status =
+      ReplaceFileContents(resource_snapshot_path_, DumpResourceCacheBinary());
+  if (!status.ok()) {
+    gpr_log(GPR_ERROR,
+            "[xds_client %p] failed to write xDS resource snapshot: %s", this,
+            status.ToString().c_str());
+  }
+}
+
 grpc_pollset_set* GrpcXdsClient::interested_parties() const {
   return reinterpret_cast<GrpcXdsTransportFactory*>(transport_factory())
       ->interested_parties();
@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <string>
 
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
@@ -33,6 +34,7 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 
 namespace grpc_core {
@@ -63,7 +65,17 @@ class GrpcXdsClient : public XdsClient {
   }
 
  private:
+  // Seeds the cache from the resource snapshot file and, if this process
+  // is the writer, keeps the file up to date.
+  void InitResourceSnapshot(std::string path, bool writer);
+
+  void OnResourceCacheChanged() override;
+
   OrphanablePtr<CertificateProviderStore> certificate_provider_store_;
+  // Set only before the first watch.
+  std::string resource_snapshot_path_;
+  bool write_resource_snapshot_ = false;
+  Mutex resource_snapshot_mu_;
 };
 
 namespace internal {
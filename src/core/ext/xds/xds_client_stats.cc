@@ -74,19 +74,35 @@ XdsClusterDropStats::~XdsClusterDropStats() {
 
 XdsClusterDropStats::Snapshot XdsClusterDropStats::GetSnapshotAndReset() {
   Snapshot snapshot;
-  snapshot.uncategorized_drops = GetAndResetCounter(&uncategorized_drops_);
-  MutexLock lock(&mu_);
-  snapshot.categorized_drops = std::move(categorized_drops_);
+  for (Drops& drops : drops_) {
+    snapshot.uncategorized_drops +=
+        GetAndResetCounter(&drops.uncategorized_drops);
+    CategorizedDropsMap categorized_drops;
+    {
+      MutexLock lock(&drops.mu);
+      categorized_drops = std::move(drops.categorized_drops);
+      drops.categorized_drops.clear();
+    }
+    if (snapshot.categorized_drops.empty()) {
+      snapshot.categorized_drops = std::move(categorized_drops);
+    } else {
+      for (const auto& p : categorized_drops) {
+        snapshot.categorized_drops[p.first] += p.second;
+      }
+    }
+  }
   return snapshot;
 }
 
 void XdsClusterDropStats::AddUncategorizedDrops() {
-  uncategorized_drops_.fetch_add(1);
+  drops_.this_cpu().uncategorized_drops.fetch_add(1,
+                                                  std::memory_order_relaxed);
 }
 
 void XdsClusterDropStats::AddCallDropped(const std::string& category) {
-  MutexLock lock(&mu_);
-  ++categorized_drops_[category];
+  Drops& drops = drops_.this_cpu();
+  MutexLock lock(&drops.mu);
+  ++drops.categorized_drops[category];
 }
 
 //
@@ -131,29 +147,37 @@ XdsClusterLocalityStats::~XdsClusterLocalityStats() {
 
 XdsClusterLocalityStats::Snapshot
 XdsClusterLocalityStats::GetSnapshotAndReset() {
-  Snapshot snapshot = {
-      GetAndResetCounter(&total_successful_requests_),
-      // Don't reset total_requests_in_progress because it's
-      // not related to a single reporting interval.
-      total_requests_in_progress_.load(std::memory_order_relaxed),
-      GetAndResetCounter(&total_error_requests_),
-      GetAndResetCounter(&total_issued_requests_),
-      {}};
+  Snapshot snapshot = {0, 0, 0, 0, {}};
+  for (Counters& counters : counters_) {
+    snapshot.total_successful_requests +=
+        GetAndResetCounter(&counters.total_successful_requests);
+    // Don't reset total_requests_in_progress because it's
+    // not related to a single reporting interval.
+    snapshot.total_requests_in_progress +=
+        counters.total_requests_in_progress.load(std::memory_order_relaxed);
+    snapshot.total_error_requests +=
+        GetAndResetCounter(&counters.total_error_requests);
+    snapshot.total_issued_requests +=
+        GetAndResetCounter(&counters.total_issued_requests);
+  }
   MutexLock lock(&backend_metrics_mu_);
   snapshot.backend_metrics = std::move(backend_metrics_);
   return snapshot;
 }
 
 void XdsClusterLocalityStats::AddCallStarted() {
-  total_issued_requests_.fetch_add(1, std::memory_order_relaxed);
-  total_requests_in_progress_.fetch_add(1, std::memory_order_relaxed);
+  Counters& counters = counters_.this_cpu();
+  counters.total_issued_requests.fetch_add(1, std::memory_order_relaxed);
+  counters.total_requests_in_progress.fetch_add(1, std::memory_order_relaxed);
 }
 
 void XdsClusterLocalityStats::AddCallFinished(bool fail) {
+  Counters& counters = counters_.this_cpu();
   std::atomic<uint64_t>& to_increment =
-      fail ? total_error_requests_ : total_successful_requests_;
+      fail ? counters.total_error_requests : counters.total_successful_requests;
   to_increment.fetch_add(1, std::memory_order_relaxed);
-  total_requests_in_progress_.fetch_add(-1, std::memory_order_acq_rel);
+  counters.total_requests_in_progress.fetch_add(-1,
+                                                std::memory_order_relaxed);
 }
 
 }  // namespace grpc_core
@@ -33,6 +33,7 @@
 
 #include "src/core/ext/xds/xds_bootstrap.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -146,12 +147,19 @@ class XdsClusterDropStats : public RefCounted<XdsClusterDropStats> {
   const XdsBootstrap::XdsServer& lrs_server_;
   absl::string_view cluster_name_;
   absl::string_view eds_service_name_;
-  std::atomic<uint64_t> uncategorized_drops_{0};
-  // Protects categorized_drops_. A mutex is necessary because the length of
-  // dropped_requests can be accessed by both the picker (from data plane
-  // mutex) and the load reporting thread (from the control plane combiner).
-  Mutex mu_;
-  CategorizedDropsMap categorized_drops_ ABSL_GUARDED_BY(mu_);
+  // Drops are counted per CPU, so that pickers on different CPUs do not
+  // contend, and summed up when a snapshot is taken.
+  struct Drops {
+    std::atomic<uint64_t> uncategorized_drops{0};
+    // Protects categorized_drops. A mutex is necessary because the length
+    // of dropped_requests can be accessed by both the picker (from data
+    // plane mutex) and the load reporting thread (from the control plane
+    // combiner).
+    Mutex mu;
+    CategorizedDropsMap categorized_drops ABSL_GUARDED_BY(mu);
+    char padding[GPR_CACHELINE_SIZE];
+  };
+  PerCpu<Drops> drops_;
 };
 
 // Locality stats for an xds cluster.
@@ -223,10 +231,18 @@ class XdsClusterLocalityStats : public RefCounted<XdsClusterLocalityStats> {
   absl::string_view eds_service_name_;
   RefCountedPtr<XdsLocalityName> name_;
 
-  std::atomic<uint64_t> total_successful_requests_{0};
-  std::atomic<uint64_t> total_requests_in_progress_{0};
-  std::atomic<uint64_t> total_error_requests_{0};
-  std::atomic<uint64_t> total_issued_requests_{0};
+  // Counted per CPU, so that calls finishing on different CPUs do not
+  // contend, and summed up when a snapshot is taken.  A call may start and
+  // finish on different CPUs, so a single CPU's requests_in_progress may
+  // wrap around; only the sum is meaningful.
+  struct Counters {
+    std::atomic<uint64_t> total_successful_requests{0};
+    std::atomic<uint64_t> total_requests_in_progress{0};
+    std::atomic<uint64_t> total_error_requests{0};
+    std::atomic<uint64_t> total_issued_requests{0};
+    char padding[GPR_CACHELINE_SIZE];
+  };
+  PerCpu<Counters> counters_;
 
   // Protects backend_metrics_. A mutex is necessary because the length of
   // backend_metrics_ can be accessed by both the callback intercepting the
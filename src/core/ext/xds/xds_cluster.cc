@@ -382,6 +382,38 @@ absl::StatusOr<XdsClusterResource> CdsResourceParse(
              }},
         },
     };
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_LEAST_REQUEST) {
+    uint32_t choice_count = 2;
+    auto* least_request_config =
+        envoy_config_cluster_v3_Cluster_least_request_lb_config(cluster);
+    if (least_request_config != nullptr) {
+      ValidationErrors::ScopedField field(&errors, ".least_request_lb_config");
+      const google_protobuf_UInt32Value* uint32_value =
+          envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_choice_count(
+              least_request_config);
+      if (uint32_value != nullptr) {
+        ValidationErrors::ScopedField field(&errors, ".choice_count");
+        choice_count = google_protobuf_UInt32Value_value(uint32_value);
+        if (choice_count < 2) errors.AddError("must be at least 2");
+      }
+    }
+    cds_update.lb_policy_config = {
+        Json::Object{
+            {"xds_wrr_locality_experimental",
+             Json::Object{
+                 {"childPolicy",
+                  Json::Array{
+                      Json::Object{
+                          {"least_request_experimental",
+                           Json::Object{
+                               {"choiceCount", choice_count},
+                           }},
+                      },
+                  }},
+             }},
+        },
+    };
   } else {
     ValidationErrors::ScopedField field(&errors, ".lb_policy");
     errors.AddError("LB policy is not supported");
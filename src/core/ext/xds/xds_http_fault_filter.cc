@@ -217,6 +217,17 @@ const grpc_channel_filter* XdsHttpFaultFilter::channel_filter() const {
   return &FaultInjectionFilter::kFilter;
 }
 
+bool XdsHttpFaultFilter::IsNoOp(const FilterConfig& config) const {
+  // Without an abort or a delay there is no fault to inject.
+  if (config.config.type() != Json::Type::OBJECT) return false;
+  const Json::Object& policy = config.config.object_value();
+  for (const char* field : {"abortCode", "abortCodeHeader", "delay",
+                            "delayHeader"}) {
+    if (policy.find(field) != policy.end()) return false;
+  }
+  return true;
+}
+
 ChannelArgs XdsHttpFaultFilter::ModifyChannelArgs(
     const ChannelArgs& args) const {
   return args.Set(GRPC_ARG_PARSE_FAULT_INJECTION_METHOD_CONFIG, 1);
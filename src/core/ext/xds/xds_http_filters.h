@@ -98,6 +98,11 @@ class XdsHttpFilterImpl {
   // C-core channel filter implementation.
   virtual const grpc_channel_filter* channel_filter() const = 0;
 
+  // Returns true if a call whose effective config is \a config passes
+  // through the channel filter untouched.  A filter for which this holds for
+  // every config a call could get is left out of the filter stack.
+  virtual bool IsNoOp(const FilterConfig& /*config*/) const { return false; }
+
   // Modifies channel args that may affect service config parsing (not
   // visible to the channel as a whole).
   virtual ChannelArgs ModifyChannelArgs(const ChannelArgs& args) const {
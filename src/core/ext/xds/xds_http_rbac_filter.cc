@@ -490,6 +490,13 @@ const grpc_channel_filter* XdsHttpRbacFilter::channel_filter() const {
   return &RbacFilter::kFilterVtable;
 }
 
+bool XdsHttpRbacFilter::IsNoOp(const FilterConfig& config) const {
+  // Without rules, no RBAC policy is enforced.
+  if (config.config.type() != Json::Type::OBJECT) return false;
+  const Json::Object& rbac = config.config.object_value();
+  return rbac.find("rules") == rbac.end();
+}
+
 ChannelArgs XdsHttpRbacFilter::ModifyChannelArgs(
     const ChannelArgs& args) const {
   return args.Set(GRPC_ARG_PARSE_RBAC_METHOD_CONFIG, 1);
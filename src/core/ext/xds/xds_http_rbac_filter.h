@@ -45,6 +45,7 @@ class XdsHttpRbacFilter : public XdsHttpFilterImpl {
       XdsExtension extension, upb_Arena* arena,
       ValidationErrors* errors) const override;
   const grpc_channel_filter* channel_filter() const override;
+  bool IsNoOp(const FilterConfig& config) const override;
   ChannelArgs ModifyChannelArgs(const ChannelArgs& args) const override;
   absl::StatusOr<ServiceConfigJsonEntry> GenerateServiceConfig(
       const FilterConfig& hcm_filter_config,
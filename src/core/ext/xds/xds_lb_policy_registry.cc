@@ -19,6 +19,7 @@
 #include "src/core/ext/xds/xds_lb_policy_registry.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <string>
 #include <utility>
@@ -92,6 +93,45 @@ class RingHashLbPolicyConfigFactory
   }
 };
 
+class LeastRequestLbPolicyConfigFactory
+    : public XdsLbPolicyRegistry::ConfigFactory {
+ public:
+  absl::StatusOr<Json::Object> ConvertXdsLbPolicyConfig(
+      const XdsResourceType::DecodeContext& context,
+      absl::string_view configuration, int /* recursion_depth */) override {
+    // The LeastRequest extension's fields we use have the same numbers and
+    // types as those of Cluster.LeastRequestLbConfig, so decode it as that.
+    const auto* resource =
+        envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_parse(
+            configuration.data(), configuration.size(), context.arena);
+    if (resource == nullptr) {
+      return absl::InvalidArgumentError(
+          "Can't decode LeastRequest loadbalancing policy");
+    }
+    Json::Object json;
+    const auto* choice_count =
+        envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_choice_count(
+            resource);
+    if (choice_count != nullptr) {
+      uint32_t value = google_protobuf_UInt32Value_value(choice_count);
+      if (value < 2) {
+        return absl::InvalidArgumentError(
+            "choice_count for LeastRequest loadbalancing policy must be at "
+            "least 2");
+      }
+      json.emplace("choiceCount", value);
+    }
+    return Json::Object{{"least_request_experimental", std::move(json)}};
+  }
+
+  absl::string_view type() override { return Type(); }
+
+  static absl::string_view Type() {
+    return "envoy.extensions.load_balancing_policies.least_request.v3."
+           "LeastRequest";
+  }
+};
+
 class RoundRobinLbPolicyConfigFactory
     : public XdsLbPolicyRegistry::ConfigFactory {
  public:
@@ -233,6 +273,9 @@ XdsLbPolicyRegistry::XdsLbPolicyRegistry() {
   policy_config_factories_.emplace(
       RingHashLbPolicyConfigFactory::Type(),
       std::make_unique<RingHashLbPolicyConfigFactory>());
+  policy_config_factories_.emplace(
+      LeastRequestLbPolicyConfigFactory::Type(),
+      std::make_unique<LeastRequestLbPolicyConfigFactory>());
   policy_config_factories_.emplace(
       RoundRobinLbPolicyConfigFactory::Type(),
       std::make_unique<RoundRobinLbPolicyConfigFactory>());
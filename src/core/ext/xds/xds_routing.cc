@@ -27,10 +27,12 @@
 #include <cctype>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/variant.h"
 
 #include <grpc/support/log.h>
 
@@ -49,41 +51,6 @@ enum MatchType {
   INVALID_MATCH,
 };
 
-// Returns true if match succeeds.
-bool DomainMatch(MatchType match_type, absl::string_view domain_pattern_in,
-                 absl::string_view expected_host_name_in) {
-  // Normalize the args to lower-case. Domain matching is case-insensitive.
-  std::string domain_pattern = std::string(domain_pattern_in);
-  std::string expected_host_name = std::string(expected_host_name_in);
-  std::transform(domain_pattern.begin(), domain_pattern.end(),
-                 domain_pattern.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
-  std::transform(expected_host_name.begin(), expected_host_name.end(),
-                 expected_host_name.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
-  if (match_type == EXACT_MATCH) {
-    return domain_pattern == expected_host_name;
-  } else if (match_type == SUFFIX_MATCH) {
-    // Asterisk must match at least one char.
-    if (expected_host_name.size() < domain_pattern.size()) return false;
-    absl::string_view pattern_suffix(domain_pattern.c_str() + 1);
-    absl::string_view host_suffix(expected_host_name.c_str() +
-                                  expected_host_name.size() -
-                                  pattern_suffix.size());
-    return pattern_suffix == host_suffix;
-  } else if (match_type == PREFIX_MATCH) {
-    // Asterisk must match at least one char.
-    if (expected_host_name.size() < domain_pattern.size()) return false;
-    absl::string_view pattern_prefix(domain_pattern.c_str(),
-                                     domain_pattern.size() - 1);
-    absl::string_view host_prefix(expected_host_name.c_str(),
-                                  pattern_prefix.size());
-    return pattern_prefix == host_prefix;
-  } else {
-    return match_type == UNIVERSE_MATCH;
-  }
-}
-
 MatchType DomainPatternMatchType(absl::string_view domain_pattern) {
   if (domain_pattern.empty()) return INVALID_MATCH;
   if (!absl::StrContains(domain_pattern, '*')) return EXACT_MATCH;
@@ -93,48 +60,106 @@ MatchType DomainPatternMatchType(absl::string_view domain_pattern) {
   return INVALID_MATCH;
 }
 
+std::string ToLower(absl::string_view str) {
+  std::string lower(str);
+  std::transform(lower.begin(), lower.end(), lower.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return lower;
+}
+
 }  // namespace
 
-absl::optional<size_t> XdsRouting::FindVirtualHostForDomain(
-    const VirtualHostListIterator& vhost_iterator, absl::string_view domain) {
-  // Find the best matched virtual host.
+XdsRouting::VirtualHostIndex::VirtualHostIndex(
+    const VirtualHostListIterator& vhost_iterator) {
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    const auto& domains = vhost_iterator.GetDomainsForVirtualHost(i);
+    for (const std::string& domain_pattern : domains) {
+      // Domain matching is case-insensitive.
+      std::string pattern = ToLower(domain_pattern);
+      // If the same pattern appears in multiple virtual hosts, the first
+      // one wins, so don't replace existing entries.
+      switch (DomainPatternMatchType(pattern)) {
+        case EXACT_MATCH:
+          exact_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          pattern.erase(0, 1);
+          suffixes_[pattern.size()].emplace(std::move(pattern), i);
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          prefixes_[pattern.size()].emplace(std::move(pattern), i);
+          break;
+        case UNIVERSE_MATCH:
+          if (!universe_.has_value()) universe_ = i;
+          break;
+        case INVALID_MATCH:
+          // This should be caught by RouteConfigParse().
+          GPR_ASSERT(false);
+      }
+    }
+  }
+}
+
+absl::optional<size_t> XdsRouting::VirtualHostIndex::Find(
+    absl::string_view domain) const {
   // The search order for 4 groups of domain patterns:
   //   1. Exact match.
   //   2. Suffix match (e.g., "*ABC").
   //   3. Prefix match (e.g., "ABC*").
   //   4. Universe match (i.e., "*").
   // Within each group, longest match wins.
-  // If the same best matched domain pattern appears in multiple virtual
-  // hosts, the first matched virtual host wins.
-  absl::optional<size_t> target_index;
-  MatchType best_match_type = INVALID_MATCH;
-  size_t longest_match = 0;
-  // Check each domain pattern in each virtual host to determine the best
-  // matched virtual host.
-  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
-    const auto& domains = vhost_iterator.GetDomainsForVirtualHost(i);
-    for (const std::string& domain_pattern : domains) {
-      // Check the match type first. Skip the pattern if it's not better
-      // than current match.
-      const MatchType match_type = DomainPatternMatchType(domain_pattern);
-      // This should be caught by RouteConfigParse().
-      GPR_ASSERT(match_type != INVALID_MATCH);
-      if (match_type > best_match_type) continue;
-      if (match_type == best_match_type &&
-          domain_pattern.size() <= longest_match) {
-        continue;
-      }
-      // Skip if match fails.
-      if (!DomainMatch(match_type, domain_pattern, domain)) continue;
-      // Choose this match.
-      target_index = i;
-      best_match_type = match_type;
-      longest_match = domain_pattern.size();
-      if (best_match_type == EXACT_MATCH) break;
+  const std::string lower_domain = ToLower(domain);
+  const absl::string_view host = lower_domain;
+  auto exact_it = exact_.find(host);
+  if (exact_it != exact_.end()) return exact_it->second;
+  // Asterisk must match at least one char.
+  for (const auto& p : suffixes_) {
+    if (host.size() <= p.first) continue;
+    auto it = p.second.find(host.substr(host.size() - p.first));
+    if (it != p.second.end()) return it->second;
+  }
+  for (const auto& p : prefixes_) {
+    if (host.size() <= p.first) continue;
+    auto it = p.second.find(host.substr(0, p.first));
+    if (it != p.second.end()) return it->second;
+  }
+  return universe_;
+}
+
+XdsRouting::RouteListIndex::RouteListIndex(
+    const RouteListIterator& route_list_iterator) {
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const StringMatcher& path_matcher =
+        route_list_iterator.GetMatchersForRoute(i).path_matcher;
+    if (!path_matcher.case_sensitive()) {
+      others_.push_back(i);
+    } else if (path_matcher.type() == StringMatcher::Type::kExact) {
+      exact_[path_matcher.string_matcher()].push_back(i);
+    } else if (path_matcher.type() == StringMatcher::Type::kPrefix) {
+      const std::string& prefix = path_matcher.string_matcher();
+      prefixes_[prefix.size()][prefix].push_back(i);
+    } else {
+      others_.push_back(i);
     }
-    if (best_match_type == EXACT_MATCH) break;
   }
-  return target_index;
+}
+
+void XdsRouting::RouteListIndex::GetCandidates(
+    absl::string_view path, CandidateLists* candidates) const {
+  auto exact_it = exact_.find(path);
+  if (exact_it != exact_.end()) candidates->push_back(&exact_it->second);
+  for (const auto& p : prefixes_) {
+    if (path.size() < p.first) break;
+    auto it = p.second.find(path.substr(0, p.first));
+    if (it != p.second.end()) candidates->push_back(&it->second);
+  }
+  if (!others_.empty()) candidates->push_back(&others_);
+}
+
+absl::optional<size_t> XdsRouting::FindVirtualHostForDomain(
+    const VirtualHostListIterator& vhost_iterator, absl::string_view domain) {
+  return VirtualHostIndex(vhost_iterator).Find(domain);
 }
 
 namespace {
@@ -160,9 +185,26 @@ bool UnderFraction(const uint32_t fraction_per_million) {
 }  // namespace
 
 absl::optional<size_t> XdsRouting::GetRouteForRequest(
-    const RouteListIterator& route_list_iterator, absl::string_view path,
+    const RouteListIterator& route_list_iterator,
+    const RouteListIndex& route_list_index, absl::string_view path,
     grpc_metadata_batch* initial_metadata) {
-  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+  RouteListIndex::CandidateLists candidates;
+  route_list_index.GetCandidates(path, &candidates);
+  absl::InlinedVector<size_t, 4> positions(candidates.size(), 0);
+  // Merge the candidate lists, so that the routes are tried in order and
+  // the first one that matches wins.
+  while (true) {
+    size_t next_list = candidates.size();
+    for (size_t j = 0; j < candidates.size(); ++j) {
+      if (positions[j] == candidates[j]->size()) continue;
+      if (next_list == candidates.size() ||
+          (*candidates[j])[positions[j]] <
+              (*candidates[next_list])[positions[next_list]]) {
+        next_list = j;
+      }
+    }
+    if (next_list == candidates.size()) return absl::nullopt;
+    const size_t i = (*candidates[next_list])[positions[next_list]++];
     const XdsRouteConfigResource::Route::Matchers& matchers =
         route_list_iterator.GetMatchersForRoute(i);
     if (matchers.path_matcher.Match(path) &&
@@ -172,7 +214,6 @@ absl::optional<size_t> XdsRouting::GetRouteForRequest(
       return i;
     }
   }
-  return absl::nullopt;
 }
 
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
@@ -218,6 +259,39 @@ const XdsHttpFilterImpl::FilterConfig* FindFilterConfigOverride(
 
 }  // namespace
 
+bool XdsRouting::IsHttpFilterNoOp(
+    const XdsHttpFilterImpl& filter_impl,
+    const XdsListenerResource::HttpConnectionManager::HttpFilter& http_filter,
+    absl::Span<const XdsRouteConfigResource::VirtualHost> virtual_hosts) {
+  if (!filter_impl.IsNoOp(http_filter.config)) return false;
+  auto override_is_no_op =
+      [&](const XdsRouteConfigResource::TypedPerFilterConfig& configs) {
+        auto it = configs.find(http_filter.name);
+        return it == configs.end() || filter_impl.IsNoOp(it->second);
+      };
+  for (const auto& vhost : virtual_hosts) {
+    if (!override_is_no_op(vhost.typed_per_filter_config)) return false;
+    for (const auto& route : vhost.routes) {
+      if (!override_is_no_op(route.typed_per_filter_config)) return false;
+      const auto* route_action =
+          absl::get_if<XdsRouteConfigResource::Route::RouteAction>(
+              &route.action);
+      if (route_action == nullptr) continue;
+      using ClusterWeight =
+          XdsRouteConfigResource::Route::RouteAction::ClusterWeight;
+      const auto* weighted_clusters =
+          absl::get_if<std::vector<ClusterWeight>>(&route_action->action);
+      if (weighted_clusters == nullptr) continue;
+      for (const auto& cluster_weight : *weighted_clusters) {
+        if (!override_is_no_op(cluster_weight.typed_per_filter_config)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
 absl::StatusOr<XdsRouting::GeneratePerHttpFilterConfigsResult>
 XdsRouting::GeneratePerHTTPFilterConfigs(
     const XdsHttpFilterRegistry& http_filter_registry,
@@ -23,13 +23,17 @@
 
 #include <stddef.h>
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 
 #include "src/core/ext/xds/xds_http_filters.h"
 #include "src/core/ext/xds/xds_listener.h"
@@ -61,14 +65,70 @@ class XdsRouting {
         size_t index) const = 0;
   };
 
+  // An index of the domain patterns of a virtual host list, built once
+  // when the list changes.  Finding the virtual host for a domain then
+  // costs one hash lookup per distinct pattern length, instead of a
+  // comparison with every pattern.
+  class VirtualHostIndex {
+   public:
+    VirtualHostIndex() = default;
+    explicit VirtualHostIndex(const VirtualHostListIterator& vhost_iterator);
+
+    // Returns the index of the selected virtual host in the list.
+    absl::optional<size_t> Find(absl::string_view domain) const;
+
+   private:
+    // Lower-cased patterns without the '*', by length from the longest,
+    // each mapped to the first virtual host that has it.
+    using WildcardMap =
+        std::map<size_t /*length*/, absl::flat_hash_map<std::string, size_t>,
+                 std::greater<size_t>>;
+
+    absl::flat_hash_map<std::string, size_t> exact_;
+    WildcardMap suffixes_;
+    WildcardMap prefixes_;
+    absl::optional<size_t> universe_;
+  };
+
+  // An index of the path matchers of a route list, built once when the
+  // list changes, so that only the routes whose path matcher can match a
+  // request's path need to be checked.
+  class RouteListIndex {
+   public:
+    // Lists of route indexes, each in increasing order.
+    using CandidateLists = absl::InlinedVector<const std::vector<size_t>*, 4>;
+
+    RouteListIndex() = default;
+    explicit RouteListIndex(const RouteListIterator& route_list_iterator);
+
+    // Adds to candidates the lists that together contain every route whose
+    // path matcher may match path.  Each route is in at most one list.
+    void GetCandidates(absl::string_view path,
+                       CandidateLists* candidates) const;
+
+   private:
+    // Routes with case-sensitive exact path matchers, by path.
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact_;
+    // Routes with case-sensitive prefix path matchers, by prefix length
+    // and prefix.
+    std::map<size_t, absl::flat_hash_map<std::string, std::vector<size_t>>>
+        prefixes_;
+    // All other routes.
+    std::vector<size_t> others_;
+  };
+
   // Returns the index of the selected virtual host in the list.
+  // Callers that look up many domains in the same list should use a
+  // VirtualHostIndex instead.
   static absl::optional<size_t> FindVirtualHostForDomain(
       const VirtualHostListIterator& vhost_iterator, absl::string_view domain);
 
   // Returns the index in route_list_iterator to use for a request with
   // the specified path and metadata, or nullopt if no route matches.
+  // route_list_index must have been built from route_list_iterator.
   static absl::optional<size_t> GetRouteForRequest(
-      const RouteListIterator& route_list_iterator, absl::string_view path,
+      const RouteListIterator& route_list_iterator,
+      const RouteListIndex& route_list_index, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
 
   // Returns true if \a domain_pattern is a valid domain pattern, false
@@ -88,6 +148,15 @@ class XdsRouting {
     ChannelArgs args;
   };
 
+  // Returns true if \a http_filter passes every call through untouched, both
+  // with its HttpConnectionManager config and with every override of it in
+  // \a virtual_hosts, so that it can be left out of the filter stack.
+  static bool IsHttpFilterNoOp(
+      const XdsHttpFilterImpl& filter_impl,
+      const XdsListenerResource::HttpConnectionManager::HttpFilter&
+          http_filter,
+      absl::Span<const XdsRouteConfigResource::VirtualHost> virtual_hosts);
+
   // Generates a map of per_filter_configs. \a args is consumed.
   static absl::StatusOr<GeneratePerHttpFilterConfigsResult>
   GeneratePerHTTPFilterConfigs(
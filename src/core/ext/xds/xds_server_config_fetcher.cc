@@ -350,6 +350,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
     std::vector<std::string> domains;
     std::vector<Route> routes;
+    XdsRouting::RouteListIndex route_list_index;
   };
 
   class VirtualHostListIterator : public XdsRouting::VirtualHostListIterator {
@@ -370,6 +371,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   };
 
   std::vector<VirtualHost> virtual_hosts_;
+  XdsRouting::VirtualHostIndex virtual_host_index_;
 };
 
 // An XdsServerConfigSelectorProvider implementation for when the
@@ -667,6 +669,20 @@ void XdsServerConfigFetcher::ListenerWatcher::
 // XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager
 //
 
+// Orders \a entries from the longest prefix range to the catch-all, so that
+// the first entry that matches an address is its longest match.
+template <typename Entry>
+void SortByPrefixLength(std::vector<Entry>* entries) {
+  auto weight = [](const Entry& entry) {
+    return entry.prefix_range.has_value() ? entry.prefix_range->prefix_len + 1
+                                          : 0;
+  };
+  std::stable_sort(entries->begin(), entries->end(),
+                   [&](const Entry& a, const Entry& b) {
+                     return weight(a) > weight(b);
+                   });
+}
+
 XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
     FilterChainMatchManager(
         RefCountedPtr<GrpcXdsClient> xds_client,
@@ -675,7 +691,17 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             default_filter_chain)
     : xds_client_(std::move(xds_client)),
       filter_chain_map_(std::move(filter_chain_map)),
-      default_filter_chain_(std::move(default_filter_chain)) {}
+      default_filter_chain_(std::move(default_filter_chain)) {
+  // Matching a connection then takes the first matching range at each level
+  // rather than a scan of all of them. Prefix ranges of the same length
+  // never overlap, so the order does not change which chain matches.
+  SortByPrefixLength(&filter_chain_map_.destination_ip_vector);
+  for (auto& destination_ip : filter_chain_map_.destination_ip_vector) {
+    for (auto& source_ip_vector : destination_ip.source_types_array) {
+      SortByPrefixLength(&source_ip_vector);
+    }
+  }
+}
 
 void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
     StartRdsWatch(RefCountedPtr<ListenerWatcher> listener_watcher) {
@@ -908,27 +934,15 @@ const XdsListenerResource::FilterChainData* FindFilterChainDataForSourcePort(
 const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceIp(
     const XdsListenerResource::FilterChainMap::SourceIpVector& source_ip_vector,
     const grpc_resolved_address* source_ip, absl::string_view port) {
-  const XdsListenerResource::FilterChainMap::SourceIp* best_match = nullptr;
+  // The entries are sorted by SortByPrefixLength(), with the catch-all last.
   for (const auto& entry : source_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
-      continue;
-    }
-    if (grpc_sockaddr_match_subnet(source_ip, &entry.prefix_range->address,
+    if (!entry.prefix_range.has_value() ||
+        grpc_sockaddr_match_subnet(source_ip, &entry.prefix_range->address,
                                    entry.prefix_range->prefix_len)) {
-      best_match = &entry;
+      return FindFilterChainDataForSourcePort(entry.ports_map, port);
     }
   }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourcePort(best_match->ports_map, port);
+  return nullptr;
 }
 
 bool IsLoopbackIp(const grpc_resolved_address* address) {
@@ -1000,7 +1014,7 @@ const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceType(
 }
 
 const XdsListenerResource::FilterChainData* FindFilterChainDataForDestinationIp(
-    const XdsListenerResource::FilterChainMap::DestinationIpVector
+    const XdsListenerResource::FilterChainMap::DestinationIpVector&
         destination_ip_vector,
     grpc_endpoint* tcp) {
   auto destination_uri = URI::Parse(grpc_endpoint_get_local_address(tcp));
@@ -1020,30 +1034,17 @@ const XdsListenerResource::FilterChainData* FindFilterChainDataForDestinationIp(
             host.c_str(), destination_addr.status().ToString().c_str());
     return nullptr;
   }
-  const XdsListenerResource::FilterChainMap::DestinationIp* best_match =
-      nullptr;
+  // The entries are sorted by SortByPrefixLength(), with the catch-all last.
   for (const auto& entry : destination_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
-      continue;
-    }
-    if (grpc_sockaddr_match_subnet(&*destination_addr,
+    if (!entry.prefix_range.has_value() ||
+        grpc_sockaddr_match_subnet(&*destination_addr,
                                    &entry.prefix_range->address,
                                    entry.prefix_range->prefix_len)) {
-      best_match = &entry;
+      return FindFilterChainDataForSourceType(entry.source_types_array, tcp,
+                                              host);
     }
   }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourceType(best_match->source_types_array, tcp,
-                                          host);
+  return nullptr;
 }
 
 absl::StatusOr<ChannelArgs> XdsServerConfigFetcher::ListenerWatcher::
@@ -1067,6 +1068,11 @@ absl::StatusOr<ChannelArgs> XdsServerConfigFetcher::ListenerWatcher::
   const auto& http_filter_registry =
       static_cast<const GrpcXdsBootstrap&>(xds_client_->bootstrap())
           .http_filter_registry();
+  // With an inline route config, we know every override a call can get, so
+  // filters that do nothing with any of them can be left out.  An RDS route
+  // config can change under the connection, so all filters stay then.
+  const auto* inline_route_config = absl::get_if<XdsRouteConfigResource>(
+      &filter_chain->http_connection_manager.route_config);
   for (const auto& http_filter :
        filter_chain->http_connection_manager.http_filters) {
     // Find filter.  This is guaranteed to succeed, because it's checked
@@ -1075,6 +1081,11 @@ absl::StatusOr<ChannelArgs> XdsServerConfigFetcher::ListenerWatcher::
         http_filter_registry.GetFilterForType(
             http_filter.config.config_proto_type_name);
     GPR_ASSERT(filter_impl != nullptr);
+    if (inline_route_config != nullptr &&
+        XdsRouting::IsHttpFilterNoOp(*filter_impl, http_filter,
+                                     inline_route_config->virtual_hosts)) {
+      continue;
+    }
     // Some filters like the router filter are no-op filters and do not have
     // an implementation.
     if (filter_impl->channel_filter() != nullptr) {
@@ -1180,7 +1191,11 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             ServiceConfigImpl::Create(result->args, json.c_str()).value();
       }
     }
+    virtual_host.route_list_index = XdsRouting::RouteListIndex(
+        VirtualHost::RouteListIterator(&virtual_host.routes));
   }
+  config_selector->virtual_host_index_ = XdsRouting::VirtualHostIndex(
+      VirtualHostListIterator(&config_selector->virtual_hosts_));
   return config_selector;
 }
 
@@ -1200,8 +1215,7 @@ ServerConfigSelector::CallConfig XdsServerConfigFetcher::ListenerWatcher::
   }
   absl::string_view authority =
       metadata->get_pointer(HttpAuthorityMetadata())->as_string_view();
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      VirtualHostListIterator(&virtual_hosts_), authority);
+  auto vhost_index = virtual_host_index_.Find(authority);
   if (!vhost_index.has_value()) {
     call_config.error = grpc_error_set_int(
         GRPC_ERROR_CREATE(absl::StrCat("could not find VirtualHost for ",
@@ -1211,7 +1225,8 @@ ServerConfigSelector::CallConfig XdsServerConfigFetcher::ListenerWatcher::
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
   auto route_index = XdsRouting::GetRouteForRequest(
-      VirtualHost::RouteListIterator(&virtual_host.routes), path, metadata);
+      VirtualHost::RouteListIterator(&virtual_host.routes),
+      virtual_host.route_list_index, path, metadata);
   if (route_index.has_value()) {
     auto& route = virtual_host.routes[route_index.value()];
     // Found the matching route
@@ -21,13 +21,18 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
+#include <utility>
+
 #include "absl/status/status.h"
 
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/support/atm.h>
 
+#include "src/core/lib/channel/context.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -35,11 +40,78 @@
 
 namespace grpc_core {
 
+// Interface for a tracer that receives the kernel timestamps of a call's
+// writes to a TCP socket, on platforms that collect them (Linux). The
+// timestamps of a write arrive once the peer has acked it, so the tracer may
+// outlive the call.
+class TcpTracerInterface {
+ public:
+  enum class Type {
+    // The write was passed to sendmsg().
+    kSendMsg,
+    // The kernel scheduled the write's last byte for sending.
+    kScheduled,
+    // The write's last byte was handed to the network interface.
+    kSent,
+    // The peer acked the write's last byte.
+    kAcked,
+  };
+
+  virtual ~TcpTracerInterface() {}
+  // \a time is in GPR_CLOCK_REALTIME. \a byte_offset is the number of bytes
+  // of the call written up to the end of the traced write.
+  virtual void RecordEvent(Type type, const gpr_timespec& time,
+                           size_t byte_offset) = 0;
+};
+
+// Owns the value of a GRPC_CONTEXT_TCP_TRACER context element.
+inline void DestroyTcpTracer(void* tracer) {
+  delete static_cast<std::shared_ptr<TcpTracerInterface>*>(tracer);
+}
+
+// Makes \a tracer the TCP tracer of the call with \a context, replacing any
+// previous one. Must be called before the call's transport stream writes.
+inline void SetTcpTracer(grpc_call_context_element* context,
+                         std::shared_ptr<TcpTracerInterface> tracer) {
+  grpc_call_context_element& element = context[GRPC_CONTEXT_TCP_TRACER];
+  if (element.destroy != nullptr) element.destroy(element.value);
+  element.value = new std::shared_ptr<TcpTracerInterface>(std::move(tracer));
+  element.destroy = DestroyTcpTracer;
+}
+
+// Returns the TCP tracer of the call with \a context, or null.
+inline std::shared_ptr<TcpTracerInterface> GetTcpTracer(
+    const grpc_call_context_element* context) {
+  if (context == nullptr || context[GRPC_CONTEXT_TCP_TRACER].value == nullptr) {
+    return nullptr;
+  }
+  return *static_cast<std::shared_ptr<TcpTracerInterface>*>(
+      context[GRPC_CONTEXT_TCP_TRACER].value);
+}
+
 // Interface for a tracer that records activities on a call. Actual attempts for
 // this call are traced with CallAttemptTracer after invoking RecordNewAttempt()
 // on the CallTracer object.
 class CallTracer {
  public:
+  // Points at which the client channel annotates a call, for a breakdown of
+  // the time the call spends before it reaches the transport. Only calls
+  // that wait in a queue see the *Queued and *Dequeued phases.
+  enum class Phase {
+    // The call is waiting for the resolver's first result.
+    kResolutionQueued,
+    // The call left the resolver queue, with a result or because it was
+    // cancelled.
+    kResolutionDequeued,
+    // The attempt's LB pick is waiting for a new picker.
+    kPickQueued,
+    // The attempt left the LB pick queue, with a pick or because it was
+    // cancelled.
+    kPickDequeued,
+    // The attempt's batches were handed to its subchannel call.
+    kSubchannelCallStarted,
+  };
+
   // Interface for a tracer that records activities on a particular call
   // attempt.
   // (A single RPC can have multiple attempts due to retry/hedging policies or
@@ -72,6 +144,23 @@ class CallTracer {
         absl::Status status, grpc_metadata_batch* recv_trailing_metadata,
         const grpc_transport_stream_stats* transport_stream_stats) = 0;
     virtual void RecordCancel(grpc_error_handle cancel_error) = 0;
+    // Optional annotation of the attempt's phases; \a when is in
+    // GPR_CLOCK_REALTIME, so that it can be lined up with TCP timestamps.
+    virtual void RecordPhase(Phase /*phase*/, const gpr_timespec& /*when*/) {}
+    // Optional: returns a tracer for the kernel timestamps of the attempt's
+    // TCP writes, called once before the attempt starts writing. Tracing
+    // every write of every call is costly, so a tracer would normally return
+    // one for a sample of attempts only.
+    virtual std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() {
+      return nullptr;
+    }
+    // Optional resource attribution, invoked just before RecordEnd().
+    // \a cpu_time is the thread CPU time spent on this attempt while
+    // starting its batches and running its completion callbacks, and
+    // \a arena_bytes is the amount of the call arena used by then. On
+    // platforms without a per-thread CPU clock, \a cpu_time is zero.
+    virtual void RecordResourceUsage(const gpr_timespec& /*cpu_time*/,
+                                     size_t /*arena_bytes*/) {}
     // Should be the last API call to the object. Once invoked, the tracer
     // library is free to destroy the object.
     virtual void RecordEnd(const gpr_timespec& latency) = 0;
@@ -79,6 +168,10 @@ class CallTracer {
 
   virtual ~CallTracer() {}
 
+  // Optional annotation of the phases that come before the call's attempts,
+  // in the same clock as CallAttemptTracer::RecordPhase().
+  virtual void RecordPhase(Phase /*phase*/, const gpr_timespec& /*when*/) {}
+
   // Records a new attempt for the associated call. \a transparent denotes
   // whether the attempt is being made as a transparent retry or as a
   // non-transparent retry/heding attempt. (There will be at least one attempt
@@ -28,6 +28,7 @@
 #include <map>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -87,7 +88,7 @@ bool ChannelArgs::operator<(const ChannelArgs& other) const {
 }
 
 bool ChannelArgs::operator==(const ChannelArgs& other) const {
-  return args_ == other.args_;
+  return hash_ == other.hash_ && args_ == other.args_;
 }
 
 bool ChannelArgs::operator!=(const ChannelArgs& other) const {
@@ -98,8 +99,24 @@ bool ChannelArgs::WantMinimalStack() const {
   return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
 }
 
-ChannelArgs::ChannelArgs(AVL<std::string, Value> args)
-    : args_(std::move(args)) {}
+ChannelArgs::ChannelArgs(AVL<std::string, Value> args, size_t hash)
+    : args_(std::move(args)), hash_(hash) {}
+
+namespace {
+
+// Hash of a single key/value pair. Pointers are compared with a function from
+// their vtable, which may consider distinct pointers equal, so they only
+// contribute their key.
+size_t EntryHash(absl::string_view key, const ChannelArgs::Value& value) {
+  return absl::HashOf(
+      key, value.index(),
+      Match(
+          value, [](int i) { return absl::HashOf(i); },
+          [](const std::string& s) { return absl::HashOf(s); },
+          [](const ChannelArgs::Pointer&) { return size_t{0}; }));
+}
+
+}  // namespace
 
 ChannelArgs ChannelArgs::Set(grpc_arg arg) const {
   switch (arg.type) {
@@ -155,7 +172,18 @@ ChannelArgs ChannelArgs::Set(absl::string_view name, int value) const {
 }
 
 ChannelArgs ChannelArgs::Set(absl::string_view key, Value value) const {
-  return ChannelArgs(args_.Add(std::string(key), std::move(value)));
+  size_t hash = hash_;
+  const Value* old_value = args_.Lookup(key);
+  if (old_value != nullptr) {
+    // Setting an int or string to the value it already has keeps the same
+    // tree, so that comparisons against the original stay trivial.
+    if (!absl::holds_alternative<Pointer>(value) && *old_value == value) {
+      return *this;
+    }
+    hash -= EntryHash(key, *old_value);
+  }
+  hash += EntryHash(key, value);
+  return ChannelArgs(args_.Add(std::string(key), std::move(value)), hash);
 }
 
 ChannelArgs ChannelArgs::Set(absl::string_view key,
@@ -172,7 +200,9 @@ ChannelArgs ChannelArgs::Set(absl::string_view key, std::string value) const {
 }
 
 ChannelArgs ChannelArgs::Remove(absl::string_view key) const {
-  return ChannelArgs(args_.Remove(key));
+  const Value* old_value = args_.Lookup(key);
+  if (old_value == nullptr) return *this;
+  return ChannelArgs(args_.Remove(key), hash_ - EntryHash(key, *old_value));
 }
 
 absl::optional<int> ChannelArgs::GetInt(absl::string_view name) const {
@@ -252,7 +282,7 @@ std::string ChannelArgs::ToString() const {
 
 ChannelArgs ChannelArgs::UnionWith(ChannelArgs other) const {
   args_.ForEach([&other](const std::string& key, const Value& value) {
-    other.args_ = other.args_.Add(key, value);
+    other = other.Set(key, value);
   });
   return other;
 }
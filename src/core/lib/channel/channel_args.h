@@ -413,18 +413,26 @@ class ChannelArgs {
   bool operator<(const ChannelArgs& other) const;
   bool operator==(const ChannelArgs& other) const;
 
+  // A hash of the contents, maintained incrementally by Set() and Remove().
+  // Equal args have equal hashes, so comparing hashes rules out most unequal
+  // args without walking either tree.
+  size_t Hash() const { return hash_; }
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
   std::string ToString() const;
 
  private:
-  explicit ChannelArgs(AVL<std::string, Value> args);
+  ChannelArgs(AVL<std::string, Value> args, size_t hash);
 
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name,
                                        Value value) const;
 
   AVL<std::string, Value> args_;
+  // Sum of the hashes of all key/value pairs, which unlike a hash of the tree
+  // does not depend on the order the args were added in.
+  size_t hash_ = 0;
 };
 
 std::ostream& operator<<(std::ostream& out, const ChannelArgs& args);
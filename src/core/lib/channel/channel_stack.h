@@ -77,6 +77,9 @@
 struct grpc_channel_element_args {
   grpc_channel_stack* channel_stack;
   const grpc_channel_args* channel_args;
+  // The same args as channel_args, so that filters that want a ChannelArgs
+  // need not each convert channel_args back.
+  const grpc_core::ChannelArgs* core_channel_args;
   int is_first;
   int is_last;
 };
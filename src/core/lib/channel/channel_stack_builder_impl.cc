@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -33,6 +34,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/error.h"
@@ -60,6 +62,9 @@ ChannelStackBuilderImpl::Build() {
     }
     stack.push_back(filter);
   }
+  if (channel_args().GetBool(GRPC_ARG_FUSE_PROMISE_FILTERS).value_or(false)) {
+    stack = FusePromiseBasedFilters(std::move(stack));
+  }
 
   // calculate the size of the channel stack
   size_t channel_stack_size =
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <memory>
 
 #include "absl/status/statusor.h"
@@ -130,6 +131,98 @@ void CallCountingHelper::PopulateCallCounts(Json::Object* json) {
   }
 }
 
+//
+// LatencyHistogram
+//
+
+void LatencyHistogram::Record(int64_t latency_ns) {
+  shards_.this_cpu().buckets[BucketFor(latency_ns)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::RecordSince(gpr_cycle_counter start) {
+  const gpr_timespec latency =
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), start);
+  Record(latency.tv_sec * GPR_NS_PER_SEC + latency.tv_nsec);
+}
+
+int LatencyHistogram::BucketFor(int64_t latency_ns) {
+  if (latency_ns < kSubBuckets) return std::max<int64_t>(latency_ns, 0);
+  uint64_t value = std::min(latency_ns, (int64_t{1} << kMaxBits) - 1);
+  // Find the most significant bit by filling in all the bits below it.
+  uint64_t smeared = value;
+  for (int i = 1; i < 64; i <<= 1) smeared |= smeared >> i;
+  const int shift = BitCount(smeared) - 1 - kSubBucketBits;
+  // value >> shift has kSubBucketBits + 1 bits, the top one set.
+  return shift * kSubBuckets + static_cast<int>(value >> shift);
+}
+
+int64_t LatencyHistogram::BucketLowerBound(int bucket) {
+  if (bucket < kSubBuckets) return bucket;
+  const int shift = bucket / kSubBuckets - 1;
+  return static_cast<int64_t>(bucket - shift * kSubBuckets) << shift;
+}
+
+Json LatencyHistogram::RenderJson() const {
+  uint64_t counts[kBuckets] = {};
+  for (const Shard& shard : shards_) {
+    for (int i = 0; i < kBuckets; ++i) {
+      counts[i] += shard.buckets[i].load(std::memory_order_relaxed);
+    }
+  }
+  uint64_t total = 0;
+  for (uint64_t count : counts) total += count;
+  if (total == 0) return Json();
+  Json::Object json = {
+      {"count", std::to_string(total)},
+  };
+  static const struct {
+    const char* name;
+    double quantile;
+  } kPercentiles[] = {
+      {"p50Nanos", 0.5},
+      {"p90Nanos", 0.9},
+      {"p99Nanos", 0.99},
+      {"p999Nanos", 0.999},
+  };
+  for (const auto& percentile : kPercentiles) {
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(percentile.quantile * total)));
+    uint64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      seen += counts[i];
+      if (seen >= rank) {
+        json[percentile.name] = std::to_string(BucketLowerBound(i));
+        break;
+      }
+    }
+  }
+  Json::Array buckets;
+  for (int i = 0; i < kBuckets; ++i) {
+    if (counts[i] == 0) continue;
+    buckets.emplace_back(Json::Object{
+        {"lowerBoundNanos", std::to_string(BucketLowerBound(i))},
+        {"count", std::to_string(counts[i])},
+    });
+  }
+  json["buckets"] = std::move(buckets);
+  return json;
+}
+
+namespace {
+
+void PopulateLatency(const char* name,
+                     const std::unique_ptr<LatencyHistogram>& histogram,
+                     Json::Object* json) {
+  if (histogram == nullptr) return;
+  Json latency = histogram->RenderJson();
+  if (latency.type() != Json::Type::JSON_NULL) {
+    (*json)[name] = std::move(latency);
+  }
+}
+
+}  // namespace
+
 //
 // ChannelNode
 //
@@ -142,6 +235,11 @@ ChannelNode::ChannelNode(std::string target, size_t channel_tracer_max_nodes,
       target_(std::move(target)),
       trace_(channel_tracer_max_nodes) {}
 
+void ChannelNode::EnableLatencyHistograms() {
+  call_latency_ = std::make_unique<LatencyHistogram>();
+  pick_latency_ = std::make_unique<LatencyHistogram>();
+}
+
 const char* ChannelNode::GetChannelConnectivityStateChangeString(
     grpc_connectivity_state state) {
   switch (state) {
@@ -180,6 +278,8 @@ Json ChannelNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  PopulateLatency("callLatency", call_latency_, &data);
+  PopulateLatency("pickLatency", pick_latency_, &data);
   // Construct outer object.
   Json::Object json = {
       {"ref",
@@ -251,6 +351,11 @@ ServerNode::ServerNode(size_t channel_tracer_max_nodes)
 
 ServerNode::~ServerNode() {}
 
+void ServerNode::EnableLatencyHistograms() {
+  call_latency_ = std::make_unique<LatencyHistogram>();
+  queue_latency_ = std::make_unique<LatencyHistogram>();
+}
+
 void ServerNode::AddChildSocket(RefCountedPtr<SocketNode> node) {
   MutexLock lock(&child_mu_);
   child_sockets_.insert(std::make_pair(node->uuid(), std::move(node)));
@@ -277,25 +382,33 @@ std::string ServerNode::RenderServerSockets(intptr_t start_socket_id,
   GPR_ASSERT(max_results >= 0);
   // If user does not set max_results, we choose 500.
   size_t pagination_limit = max_results == 0 ? 500 : max_results;
-  Json::Object object;
+  // Write the socket refs as they are visited rather than building the page
+  // as a Json first.
+  JsonWriter writer;
+  writer.StartObject();
   {
     MutexLock lock(&child_mu_);
     size_t sockets_rendered = 0;
-    // Create list of socket refs.
-    Json::Array array;
+    writer.Key("socketRef");
+    writer.StartArray();
     auto it = child_sockets_.lower_bound(start_socket_id);
     for (; it != child_sockets_.end() && sockets_rendered < pagination_limit;
          ++it, ++sockets_rendered) {
-      array.emplace_back(Json::Object{
-          {"socketId", std::to_string(it->first)},
-          {"name", it->second->name()},
-      });
+      writer.StartObject();
+      writer.Key("name");
+      writer.Value(it->second->name());
+      writer.Key("socketId");
+      writer.Value(std::to_string(it->first));
+      writer.EndObject();
+    }
+    writer.EndArray();
+    if (it == child_sockets_.end()) {
+      writer.Key("end");
+      writer.Value(true);
     }
-    object["socketRef"] = std::move(array);
-    if (it == child_sockets_.end()) object["end"] = true;
   }
-  Json json = std::move(object);
-  return json.Dump();
+  writer.EndObject();
+  return writer.TakeOutput();
 }
 
 Json ServerNode::RenderJson() {
@@ -307,6 +420,8 @@ Json ServerNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  PopulateLatency("callLatency", call_latency_, &data);
+  PopulateLatency("queueLatency", queue_latency_, &data);
   // Construct top-level object.
   Json::Object object = {
       {"ref",
@@ -461,26 +576,31 @@ SocketNode::SocketNode(std::string local, std::string remote, std::string name,
       remote_(std::move(remote)),
       security_(std::move(security)) {}
 
+void SocketNode::SetOptionsSource(OptionsSource source) {
+  MutexLock lock(&options_mu_);
+  options_source_ = std::move(source);
+}
+
 void SocketNode::RecordStreamStartedFromLocal() {
-  streams_started_.fetch_add(1, std::memory_order_relaxed);
+  Increment(&streams_started_, 1);
   last_local_stream_created_cycle_.store(gpr_get_cycle_counter(),
                                          std::memory_order_relaxed);
 }
 
 void SocketNode::RecordStreamStartedFromRemote() {
-  streams_started_.fetch_add(1, std::memory_order_relaxed);
+  Increment(&streams_started_, 1);
   last_remote_stream_created_cycle_.store(gpr_get_cycle_counter(),
                                           std::memory_order_relaxed);
 }
 
 void SocketNode::RecordMessagesSent(uint32_t num_sent) {
-  messages_sent_.fetch_add(num_sent, std::memory_order_relaxed);
+  Increment(&messages_sent_, num_sent);
   last_message_sent_cycle_.store(gpr_get_cycle_counter(),
                                  std::memory_order_relaxed);
 }
 
 void SocketNode::RecordMessageReceived() {
-  messages_received_.fetch_add(1, std::memory_order_relaxed);
+  Increment(&messages_received_, 1);
   last_message_received_cycle_.store(gpr_get_cycle_counter(),
                                      std::memory_order_relaxed);
 }
@@ -541,6 +661,25 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = std::to_string(keepalives_sent);
   }
+  if (flow_control_windows_recorded_.load(std::memory_order_relaxed)) {
+    data["localFlowControlWindow"] = std::to_string(
+        local_flow_control_window_.load(std::memory_order_relaxed));
+    data["remoteFlowControlWindow"] = std::to_string(
+        remote_flow_control_window_.load(std::memory_order_relaxed));
+  }
+  Json::Array options;
+  {
+    MutexLock lock(&options_mu_);
+    if (options_source_ != nullptr) {
+      for (auto& option : options_source_()) {
+        options.emplace_back(Json::Object{
+            {"name", std::move(option.first)},
+            {"value", std::move(option.second)},
+        });
+      }
+    }
+  }
+  if (!options.empty()) data["option"] = std::move(options);
   // Create and fill the parent object.
   Json::Object object = {
       {"ref",
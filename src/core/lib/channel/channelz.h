@@ -25,12 +25,15 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -41,6 +44,7 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -175,6 +179,39 @@ class CallCountingHelper {
   size_t num_cores_ = 0;
 };
 
+// A histogram of latencies at nanosecond resolution, kept per CPU so that
+// recording is a relaxed increment of a counter nobody else writes to.
+// Below kSubBuckets ns every nanosecond has its own bucket; above, every
+// power of two is split into kSubBuckets buckets, so that a bucket is never
+// wider than 1/kSubBuckets of the latencies it counts.
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kSubBuckets = 1 << kSubBucketBits;
+  // Latencies of 2^kMaxBits ns (about 69s) or more share the last bucket.
+  static constexpr int kMaxBits = 36;
+  static constexpr int kBuckets = (kMaxBits - kSubBucketBits + 1) * kSubBuckets;
+
+  void Record(int64_t latency_ns);
+  // Records the time elapsed since start.
+  void RecordSince(gpr_cycle_counter start);
+
+  static int BucketFor(int64_t latency_ns);
+  static int64_t BucketLowerBound(int bucket);
+
+  // Renders the count, some percentiles and the non-empty buckets, or null
+  // if nothing was recorded.  Percentiles are the lower bound of the bucket
+  // they fall into.
+  Json RenderJson() const;
+
+ private:
+  struct Shard {
+    std::atomic<uint64_t> buckets[kBuckets] = {};
+  };
+
+  PerCpu<Shard> shards_;
+};
+
 // Handles channelz bookkeeping for channels
 class ChannelNode : public BaseNode {
  public:
@@ -205,6 +242,19 @@ class ChannelNode : public BaseNode {
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
 
+  // Turns on the latency histograms.  Must be called before the node is
+  // shared.  Until then, the Record*Latency() methods do nothing.
+  void EnableLatencyHistograms();
+  // Records the latency of a call that started at call_start.
+  void RecordCallLatency(gpr_cycle_counter call_start) {
+    if (call_latency_ != nullptr) call_latency_->RecordSince(call_start);
+  }
+  // Records the time an LB call that started at pick_start took to get a
+  // subchannel picked.
+  void RecordPickLatency(gpr_cycle_counter pick_start) {
+    if (pick_latency_ != nullptr) pick_latency_->RecordSince(pick_start);
+  }
+
   void SetConnectivityState(grpc_connectivity_state state);
 
   // TODO(roth): take in a RefCountedPtr to the child channel so we can retrieve
@@ -226,6 +276,8 @@ class ChannelNode : public BaseNode {
   std::string target_;
   CallCountingHelper call_counter_;
   ChannelTrace trace_;
+  std::unique_ptr<LatencyHistogram> call_latency_;
+  std::unique_ptr<LatencyHistogram> pick_latency_;
 
   // Least significant bit indicates whether the value is set.  Remaining
   // bits are a grpc_connectivity_state value.
@@ -270,9 +322,24 @@ class ServerNode : public BaseNode {
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
 
+  // Turns on the latency histograms.  Must be called before the node is
+  // shared.  Until then, the Record*Latency() methods do nothing.
+  void EnableLatencyHistograms();
+  // Records the latency of a call that started at call_start.
+  void RecordCallLatency(gpr_cycle_counter call_start) {
+    if (call_latency_ != nullptr) call_latency_->RecordSince(call_start);
+  }
+  // Records the time a call that began waiting at queue_start waited for
+  // a matching request.
+  void RecordQueueLatency(gpr_cycle_counter queue_start) {
+    if (queue_latency_ != nullptr) queue_latency_->RecordSince(queue_start);
+  }
+
  private:
   CallCountingHelper call_counter_;
   ChannelTrace trace_;
+  std::unique_ptr<LatencyHistogram> call_latency_;
+  std::unique_ptr<LatencyHistogram> queue_latency_;
   Mutex child_mu_;  // Guards child maps below.
   std::map<intptr_t, RefCountedPtr<SocketNode>> child_sockets_;
   std::map<intptr_t, RefCountedPtr<ListenSocketNode>> child_listen_sockets_;
@@ -280,7 +347,13 @@ class ServerNode : public BaseNode {
 
 #define GRPC_ARG_CHANNELZ_SECURITY "grpc.internal.channelz_security"
 
-// Handles channelz bookkeeping for sockets
+// Handles channelz bookkeeping for sockets.
+//
+// The Record*() methods must not be called concurrently with each other for
+// the same node; chttp2 calls them from the transport's combiner. That lets
+// every counter have a single writer that updates it with a plain load and
+// store instead of a locked read-modify-write, while RenderJson() may still
+// run on any thread.
 class SocketNode : public BaseNode {
  public:
   struct Security : public RefCounted<Security> {
@@ -318,6 +391,10 @@ class SocketNode : public BaseNode {
         const grpc_channel_args* args);
   };
 
+  // Returns (name, value) pairs rendered as the options of the socket data.
+  using OptionsSource =
+      std::function<std::vector<std::pair<std::string, std::string>>()>;
+
   SocketNode(std::string local, std::string remote, std::string name,
              RefCountedPtr<Security> security);
   ~SocketNode() override {}
@@ -326,27 +403,42 @@ class SocketNode : public BaseNode {
 
   void RecordStreamStartedFromLocal();
   void RecordStreamStartedFromRemote();
-  void RecordStreamSucceeded() {
-    streams_succeeded_.fetch_add(1, std::memory_order_relaxed);
-  }
-  void RecordStreamFailed() {
-    streams_failed_.fetch_add(1, std::memory_order_relaxed);
-  }
+  void RecordStreamSucceeded() { Increment(&streams_succeeded_, 1); }
+  void RecordStreamFailed() { Increment(&streams_failed_, 1); }
   void RecordMessagesSent(uint32_t num_sent);
   void RecordMessageReceived();
-  void RecordKeepaliveSent() {
-    keepalives_sent_.fetch_add(1, std::memory_order_relaxed);
+  void RecordKeepaliveSent() { Increment(&keepalives_sent_, 1); }
+  // Records the connection level flow control windows: how much the peer may
+  // send to us, and how much we may send to the peer.
+  void RecordFlowControlWindows(int64_t local_window, int64_t remote_window) {
+    local_flow_control_window_.store(local_window, std::memory_order_relaxed);
+    remote_flow_control_window_.store(remote_window,
+                                      std::memory_order_relaxed);
+    flow_control_windows_recorded_.store(true, std::memory_order_relaxed);
   }
 
   const std::string& remote() { return remote_; }
 
+  // Sets the function queried for socket options on every render. The owner
+  // must reset it to nullptr before the state it reads is destroyed, since the
+  // node may outlive its owner while being rendered.
+  void SetOptionsSource(OptionsSource source);
+
  private:
+  static void Increment(std::atomic<int64_t>* counter, int64_t n) {
+    counter->store(counter->load(std::memory_order_relaxed) + n,
+                   std::memory_order_relaxed);
+  }
+
   std::atomic<int64_t> streams_started_{0};
   std::atomic<int64_t> streams_succeeded_{0};
   std::atomic<int64_t> streams_failed_{0};
   std::atomic<int64_t> messages_sent_{0};
   std::atomic<int64_t> messages_received_{0};
   std::atomic<int64_t> keepalives_sent_{0};
+  std::atomic<int64_t> local_flow_control_window_{0};
+  std::atomic<int64_t> remote_flow_control_window_{0};
+  std::atomic<bool> flow_control_windows_recorded_{false};
   std::atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
@@ -354,6 +446,8 @@ class SocketNode : public BaseNode {
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
+  Mutex options_mu_;
+  OptionsSource options_source_ ABSL_GUARDED_BY(options_mu_);
 };
 
 // Handles channelz bookkeeping for listen sockets
@@ -20,7 +20,10 @@
 
 #include "src/core/lib/channel/channelz_registry.h"
 
+#include <stddef.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -39,7 +42,7 @@ namespace grpc_core {
 namespace channelz {
 namespace {
 
-const int kPaginationLimit = 100;
+const size_t kPaginationLimit = 100;
 
 }  // anonymous namespace
 
@@ -49,115 +52,126 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
-  MutexLock lock(&mu_);
-  node->uuid_ = ++uuid_generator_;
-  node_map_[node->uuid_] = node;
+  node->uuid_ = uuid_generator_.fetch_add(1, std::memory_order_relaxed) + 1;
+  Shard& shard = ShardFor(node->uuid_);
+  MutexLock lock(&shard.mu);
+  shard.node_map[node->uuid_] = node;
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   GPR_ASSERT(uuid >= 1);
-  MutexLock lock(&mu_);
-  GPR_ASSERT(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  GPR_ASSERT(uuid <= uuid_generator_.load(std::memory_order_relaxed));
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  shard.node_map.erase(uuid);
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock lock(&mu_);
-  if (uuid < 1 || uuid > uuid_generator_) {
+  if (uuid < 1 || uuid > uuid_generator_.load(std::memory_order_relaxed)) {
     return nullptr;
   }
-  auto it = node_map_.find(uuid);
-  if (it == node_map_.end()) return nullptr;
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  auto it = shard.node_map.find(uuid);
+  if (it == shard.node_map.end()) return nullptr;
   // Found node.  Return only if its refcount is not zero (i.e., when we
   // know that there is no other thread about to destroy it).
   BaseNode* node = it->second;
   return node->RefIfNonZero();
 }
 
-std::string ChannelzRegistry::InternalGetTopChannels(
-    intptr_t start_channel_id) {
-  std::vector<RefCountedPtr<BaseNode>> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
+std::vector<RefCountedPtr<BaseNode>> ChannelzRegistry::Snapshot(
+    BaseNode::EntityType type, intptr_t start_id, size_t max_results) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (Shard& shard : shards_) {
+    // Each shard is ordered by uuid, so the first max_results matches overall
+    // are among the first max_results matches of every shard.
+    size_t found = 0;
+    MutexLock lock(&shard.mu);
+    for (auto it = shard.node_map.lower_bound(start_id);
+         it != shard.node_map.end() && found < max_results; ++it) {
       BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
-      }
+      if (node->type() != type) continue;
+      RefCountedPtr<BaseNode> node_ref = node->RefIfNonZero();
+      if (node_ref == nullptr) continue;
+      nodes.emplace_back(std::move(node_ref));
+      ++found;
     }
   }
-  Json::Object object;
+  // Refs beyond max_results are dropped here, outside of the shard locks,
+  // since unreffing a node may unregister it.
+  std::sort(nodes.begin(), nodes.end(),
+            [](const RefCountedPtr<BaseNode>& a,
+               const RefCountedPtr<BaseNode>& b) {
+              return a->uuid() < b->uuid();
+            });
+  if (nodes.size() > max_results) nodes.resize(max_results);
+  return nodes;
+}
+
+std::string ChannelzRegistry::InternalGetTopChannels(
+    intptr_t start_channel_id) {
+  // Ask for one node more than fits in a page to find out whether we need to
+  // set the "end" element.
+  std::vector<RefCountedPtr<BaseNode>> top_level_channels =
+      Snapshot(BaseNode::EntityType::kTopLevelChannel, start_channel_id,
+               kPaginationLimit + 1);
+  const bool end = top_level_channels.size() <= kPaginationLimit;
+  if (!end) top_level_channels.pop_back();
+  // Write each channel as it is rendered, so that only one of them is held
+  // as a Json at a time. Members are written in the order Json::Dump() would
+  // use.
+  JsonWriter writer;
+  writer.StartObject();
   if (!top_level_channels.empty()) {
-    // Create list of channels.
-    Json::Array array;
-    for (size_t i = 0; i < top_level_channels.size(); ++i) {
-      array.emplace_back(top_level_channels[i]->RenderJson());
+    writer.Key("channel");
+    writer.StartArray();
+    for (auto& channel : top_level_channels) {
+      writer.Value(channel->RenderJson());
+      channel.reset();
     }
-    object["channel"] = std::move(array);
+    writer.EndArray();
+  }
+  if (end) {
+    writer.Key("end");
+    writer.Value(true);
   }
-  if (node_after_pagination_limit == nullptr) object["end"] = true;
-  Json json(std::move(object));
-  return json.Dump();
+  writer.EndObject();
+  return writer.TakeOutput();
 }
 
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  std::vector<RefCountedPtr<BaseNode>> servers;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
-      }
-    }
+  // Ask for one node more than fits in a page to find out whether we need to
+  // set the "end" element.
+  std::vector<RefCountedPtr<BaseNode>> servers = Snapshot(
+      BaseNode::EntityType::kServer, start_server_id, kPaginationLimit + 1);
+  const bool end = servers.size() <= kPaginationLimit;
+  if (!end) servers.pop_back();
+  // See InternalGetTopChannels().
+  JsonWriter writer;
+  writer.StartObject();
+  if (end) {
+    writer.Key("end");
+    writer.Value(true);
   }
-  Json::Object object;
   if (!servers.empty()) {
-    // Create list of servers.
-    Json::Array array;
-    for (size_t i = 0; i < servers.size(); ++i) {
-      array.emplace_back(servers[i]->RenderJson());
+    writer.Key("server");
+    writer.StartArray();
+    for (auto& server : servers) {
+      writer.Value(server->RenderJson());
+      server.reset();
     }
-    object["server"] = std::move(array);
+    writer.EndArray();
   }
-  if (node_after_pagination_limit == nullptr) object["end"] = true;
-  Json json(std::move(object));
-  return json.Dump();
+  writer.EndObject();
+  return writer.TakeOutput();
 }
 
 void ChannelzRegistry::InternalLogAllEntities() {
   std::vector<RefCountedPtr<BaseNode>> nodes;
-  {
-    MutexLock lock(&mu_);
-    for (auto& p : node_map_) {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (auto& p : shard.node_map) {
       RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
       if (node != nullptr) {
         nodes.emplace_back(std::move(node));
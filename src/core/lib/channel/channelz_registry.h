@@ -21,9 +21,15 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
 
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -34,6 +40,13 @@ namespace channelz {
 
 // singleton registry object to track all objects that are needed to support
 // channelz bookkeeping. All objects share globally distributed uuids.
+//
+// Nodes are spread over kNumShards maps by uuid, each with its own lock, so
+// that registering a node only contends with operations on the same shard.
+// Exports copy out refs to the nodes they need while holding one shard lock
+// at a time and render them after all locks are released, so a scrape never
+// blocks channel or socket creation for longer than it takes to walk one
+// page of one shard.
 class ChannelzRegistry {
  public:
   static void Register(BaseNode* node) {
@@ -63,9 +76,11 @@ class ChannelzRegistry {
   // Test only helper function to reset to initial state.
   static void TestOnlyReset() {
     auto* p = Default();
-    MutexLock lock(&p->mu_);
-    p->node_map_.clear();
-    p->uuid_generator_ = 0;
+    for (Shard& shard : p->shards_) {
+      MutexLock lock(&shard.mu);
+      shard.node_map.clear();
+    }
+    p->uuid_generator_.store(0, std::memory_order_relaxed);
   }
 
  private:
@@ -88,10 +103,23 @@ class ChannelzRegistry {
 
   void InternalLogAllEntities();
 
-  // protects members
-  Mutex mu_;
-  std::map<intptr_t, BaseNode*> node_map_;
-  intptr_t uuid_generator_ = 0;
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    Mutex mu;
+    std::map<intptr_t, BaseNode*> node_map ABSL_GUARDED_BY(mu);
+  };
+
+  Shard& ShardFor(intptr_t uuid) { return shards_[uuid % kNumShards]; }
+
+  // Returns refs to the first max_results live nodes of the given type whose
+  // uuid is at least start_id, in uuid order.
+  std::vector<RefCountedPtr<BaseNode>> Snapshot(BaseNode::EntityType type,
+                                                intptr_t start_id,
+                                                size_t max_results);
+
+  std::atomic<intptr_t> uuid_generator_{0};
+  Shard shards_[kNumShards];
 };
 
 }  // namespace channelz
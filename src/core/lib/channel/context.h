@@ -45,6 +45,9 @@ typedef enum {
   /// Holds a pointer to ServiceConfigCallData associated with this call.
   GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA,
 
+  /// Value is a std::shared_ptr<TcpTracerInterface>; see call_tracer.h.
+  GRPC_CONTEXT_TCP_TRACER,
+
   GRPC_CONTEXT_COUNT
 } grpc_context_index;
 
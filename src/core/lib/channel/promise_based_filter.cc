@@ -16,17 +16,27 @@
 
 #include "src/core/lib/channel/promise_based_filter.h"
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "absl/types/variant.h"
 
 #include <grpc/status.h>
 
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice.h"
 
@@ -1280,4 +1290,283 @@ void ServerCallData::WakeInsideCombiner(Flusher* flusher) {
 void ServerCallData::OnWakeup() { abort(); }  // not implemented
 
 }  // namespace promise_filter_detail
+
+///////////////////////////////////////////////////////////////////////////////
+// FusePromiseBasedFilters
+
+namespace {
+
+struct PromiseBasedFilterKind {
+  FilterEndpoint endpoint;
+  uint8_t flags;
+};
+
+// Filters made by MakePromiseBasedFilter() differ only in their channel data:
+// their call elements come from one of a handful of instantiations, which
+// identify the endpoint and flags they were made with.
+absl::optional<PromiseBasedFilterKind> GetPromiseBasedFilterKind(
+    const grpc_channel_filter* filter) {
+  using promise_filter_detail::CallData;
+  using promise_filter_detail::CallDataFilterWithFlagsMethods;
+  using ClientAdaptor = CallData<FilterEndpoint::kClient>;
+  using ServerAdaptor = CallData<FilterEndpoint::kServer>;
+  static const struct {
+    decltype(grpc_channel_filter::init_call_elem) init_call_elem;
+    PromiseBasedFilterKind kind;
+  } kKinds[] = {
+      {CallDataFilterWithFlagsMethods<ClientAdaptor, 0>::InitCallElem,
+       {FilterEndpoint::kClient, 0}},
+      {CallDataFilterWithFlagsMethods<
+           ClientAdaptor, kFilterExaminesServerInitialMetadata>::InitCallElem,
+       {FilterEndpoint::kClient, kFilterExaminesServerInitialMetadata}},
+      {CallDataFilterWithFlagsMethods<ServerAdaptor, 0>::InitCallElem,
+       {FilterEndpoint::kServer, 0}},
+      {CallDataFilterWithFlagsMethods<
+           ServerAdaptor, kFilterExaminesServerInitialMetadata>::InitCallElem,
+       {FilterEndpoint::kServer, kFilterExaminesServerInitialMetadata}},
+  };
+  for (const auto& kind : kKinds) {
+    if (filter->init_call_elem == kind.init_call_elem) return kind.kind;
+  }
+  return absl::nullopt;
+}
+
+// The vtable of a fused filter, along with the filters it runs.
+struct FusedFilterVtable : public grpc_channel_filter {
+  FusedFilterVtable(grpc_channel_filter vtable, FilterEndpoint endpoint,
+                    std::vector<const grpc_channel_filter*> filters)
+      : grpc_channel_filter(vtable),
+        endpoint(endpoint),
+        filters(std::move(filters)) {
+    std::vector<absl::string_view> names;
+    for (const auto* filter : this->filters) names.push_back(filter->name);
+    fused_name = absl::StrCat("fused(", absl::StrJoin(names, ","), ")");
+    name = fused_name.c_str();
+  }
+
+  const FilterEndpoint endpoint;
+  const std::vector<const grpc_channel_filter*> filters;
+  std::string fused_name;
+};
+
+// Channel data of a fused filter.  Each fused filter gets a channel element
+// of its own, laid out as if it were in a channel stack, followed by one that
+// passes channel ops on to the element after the fused filter.
+class FusedFilter final : public ChannelFilter {
+ public:
+  static absl::StatusOr<FusedFilter> Create(ChannelArgs args,
+                                            ChannelFilter::Args filter_args);
+
+  FusedFilter(FusedFilter&&) = default;
+  ~FusedFilter() override;
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override;
+  void PostInit() override;
+  bool StartTransportOp(grpc_transport_op* op) override;
+  bool GetChannelInfo(const grpc_channel_info* info) override;
+
+ private:
+  FusedFilter(grpc_channel_stack* channel_stack,
+              const FusedFilterVtable* vtable);
+
+  // Chains the promises of the filters from the i-th to be called onwards.
+  NextPromiseFactory Next(size_t i, NextPromiseFactory next_promise_factory);
+
+  static const grpc_channel_filter kForwardFilter;
+
+  grpc_channel_stack* channel_stack_;
+  FilterEndpoint endpoint_;
+  std::unique_ptr<grpc_channel_element[]> elems_;
+  std::unique_ptr<char[]> channel_data_;
+  // Number of elements whose channel data has been initialized.
+  size_t count_ = 0;
+};
+
+// Terminates the elements of a fused filter: channel ops that get this far
+// continue below the fused filter, whose element is our channel data.
+const grpc_channel_filter FusedFilter::kForwardFilter = {
+    nullptr,
+    nullptr,
+    [](grpc_channel_element* elem, grpc_transport_op* op) {
+      grpc_channel_next_op(
+          static_cast<grpc_channel_element*>(elem->channel_data), op);
+    },
+    0,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    grpc_channel_stack_no_post_init,
+    nullptr,
+    [](grpc_channel_element* elem, const grpc_channel_info* info) {
+      grpc_channel_next_get_info(
+          static_cast<grpc_channel_element*>(elem->channel_data), info);
+    },
+    "fused-forward",
+};
+
+FusedFilter::FusedFilter(grpc_channel_stack* channel_stack,
+                         const FusedFilterVtable* vtable)
+    : channel_stack_(channel_stack),
+      endpoint_(vtable->endpoint),
+      elems_(new grpc_channel_element[vtable->filters.size() + 1]) {
+  size_t channel_data_size = 0;
+  for (const auto* filter : vtable->filters) {
+    channel_data_size +=
+        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter->sizeof_channel_data);
+  }
+  channel_data_.reset(new char[channel_data_size]());
+}
+
+absl::StatusOr<FusedFilter> FusedFilter::Create(
+    ChannelArgs args, ChannelFilter::Args filter_args) {
+  grpc_channel_element* outer = filter_args.uninitialized_channel_element();
+  const auto* vtable = static_cast<const FusedFilterVtable*>(outer->filter);
+  FusedFilter fused(filter_args.channel_stack(), vtable);
+  // The filters are all promise based, and so only look at the args as
+  // ChannelArgs.
+  grpc_channel_element_args elem_args;
+  elem_args.channel_stack = fused.channel_stack_;
+  elem_args.channel_args = nullptr;
+  elem_args.core_channel_args = &args;
+  elem_args.is_last = false;
+  char* channel_data = fused.channel_data_.get();
+  for (const auto* filter : vtable->filters) {
+    grpc_channel_element* elem = &fused.elems_[fused.count_];
+    elem_args.is_first =
+        fused.count_ == 0 &&
+        outer == grpc_channel_stack_element(fused.channel_stack_, 0);
+    elem->filter = filter;
+    elem->channel_data = channel_data;
+    grpc_error_handle error = filter->init_channel_elem(elem, &elem_args);
+    // A filter that fails still leaves channel data to be destroyed.
+    ++fused.count_;
+    if (!error.ok()) return error;
+    channel_data += GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter->sizeof_channel_data);
+  }
+  fused.elems_[fused.count_].filter = &kForwardFilter;
+  fused.elems_[fused.count_].channel_data = outer;
+  return std::move(fused);
+}
+
+FusedFilter::~FusedFilter() {
+  if (elems_ == nullptr) return;
+  for (size_t i = 0; i < count_; ++i) {
+    elems_[i].filter->destroy_channel_elem(&elems_[i]);
+  }
+}
+
+ArenaPromise<ServerMetadataHandle> FusedFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  return Next(0, std::move(next_promise_factory))(std::move(call_args));
+}
+
+NextPromiseFactory FusedFilter::Next(size_t i,
+                                     NextPromiseFactory next_promise_factory) {
+  if (i == count_) return next_promise_factory;
+  // Client calls run down the stack, and server calls up it.
+  grpc_channel_element* elem =
+      &elems_[endpoint_ == FilterEndpoint::kClient ? i : count_ - 1 - i];
+  return [this, i, elem, next_promise_factory](CallArgs call_args) {
+    return elem->filter->make_call_promise(elem, std::move(call_args),
+                                           Next(i + 1, next_promise_factory));
+  };
+}
+
+void FusedFilter::PostInit() {
+  for (size_t i = 0; i < count_; ++i) {
+    elems_[i].filter->post_init_channel_elem(channel_stack_, &elems_[i]);
+  }
+}
+
+bool FusedFilter::StartTransportOp(grpc_transport_op* op) {
+  elems_[0].filter->start_transport_op(&elems_[0], op);
+  return true;
+}
+
+bool FusedFilter::GetChannelInfo(const grpc_channel_info* info) {
+  elems_[0].filter->get_channel_info(&elems_[0], info);
+  return true;
+}
+
+grpc_channel_filter FusedFilterBase(FilterEndpoint endpoint, uint8_t flags) {
+  const bool examines_server_initial_metadata =
+      (flags & kFilterExaminesServerInitialMetadata) != 0;
+  switch (endpoint) {
+    case FilterEndpoint::kClient:
+      return examines_server_initial_metadata
+                 ? MakePromiseBasedFilter<FusedFilter, FilterEndpoint::kClient,
+                                          kFilterExaminesServerInitialMetadata>(
+                       "fused")
+                 : MakePromiseBasedFilter<FusedFilter,
+                                          FilterEndpoint::kClient>("fused");
+    case FilterEndpoint::kServer:
+      return examines_server_initial_metadata
+                 ? MakePromiseBasedFilter<FusedFilter, FilterEndpoint::kServer,
+                                          kFilterExaminesServerInitialMetadata>(
+                       "fused")
+                 : MakePromiseBasedFilter<FusedFilter,
+                                          FilterEndpoint::kServer>("fused");
+  }
+  GPR_UNREACHABLE_CODE(return {});
+}
+
+const grpc_channel_filter* GetFusedFilter(
+    std::vector<const grpc_channel_filter*> filters, FilterEndpoint endpoint,
+    uint8_t flags) {
+  static NoDestruct<Mutex> mu;
+  static NoDestruct<std::map<std::vector<const grpc_channel_filter*>,
+                             std::unique_ptr<FusedFilterVtable>>>
+      fused_filters;
+  MutexLock lock(mu.get());
+  auto& vtable = (*fused_filters)[filters];
+  if (vtable == nullptr) {
+    vtable = std::make_unique<FusedFilterVtable>(
+        FusedFilterBase(endpoint, flags), endpoint, std::move(filters));
+  }
+  return vtable.get();
+}
+
+}  // namespace
+
+std::vector<const grpc_channel_filter*> FusePromiseBasedFilters(
+    std::vector<const grpc_channel_filter*> filters) {
+  std::map<const grpc_channel_filter*, size_t> occurrences;
+  for (const auto* filter : filters) ++occurrences[filter];
+  auto fusable_kind = [&occurrences](const grpc_channel_filter* filter)
+      -> absl::optional<PromiseBasedFilterKind> {
+    if (occurrences[filter] != 1) return absl::nullopt;
+    return GetPromiseBasedFilterKind(filter);
+  };
+  std::vector<const grpc_channel_filter*> fused;
+  size_t i = 0;
+  while (i < filters.size()) {
+    auto kind = fusable_kind(filters[i]);
+    size_t end = i + 1;
+    uint8_t flags = 0;
+    if (kind.has_value()) {
+      flags = kind->flags;
+      for (; end < filters.size(); ++end) {
+        auto next_kind = fusable_kind(filters[end]);
+        if (!next_kind.has_value() || next_kind->endpoint != kind->endpoint) {
+          break;
+        }
+        flags |= next_kind->flags;
+      }
+    }
+    if (end - i < 2) {
+      fused.push_back(filters[i]);
+    } else {
+      fused.push_back(GetFusedFilter(
+          std::vector<const grpc_channel_filter*>(filters.begin() + i,
+                                                  filters.begin() + end),
+          kind->endpoint, flags));
+    }
+    i = end;
+  }
+  return fused;
+}
+
 }  // namespace grpc_core
@@ -32,6 +32,7 @@
 #include <new>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/meta/type_traits.h"
@@ -579,7 +580,7 @@ struct ChannelFilterWithFlagsMethods {
   static absl::Status InitChannelElem(grpc_channel_element* elem,
                                       grpc_channel_element_args* args) {
     GPR_ASSERT(args->is_last == ((kFlags & kFilterIsLast) != 0));
-    auto status = F::Create(ChannelArgs::FromC(args->channel_args),
+    auto status = F::Create(*args->core_channel_args,
                             ChannelFilter::Args(args->channel_stack, elem));
     if (!status.ok()) {
       static_assert(
@@ -639,6 +640,16 @@ MakePromiseBasedFilter(const char* name) {
   };
 }
 
+// Replaces each run of two or more adjacent filters made by
+// MakePromiseBasedFilter() with one filter that chains their promises.
+// Calls on the legacy filter stack then go through one batch adaptor (and
+// one activity) per run instead of one per filter.  A fused filter is made
+// once per distinct run and lives for the rest of the process.
+// Filters that occur more than once in the stack are left alone, since they
+// find their instance number from their position in it.
+std::vector<const grpc_channel_filter*> FusePromiseBasedFilters(
+    std::vector<const grpc_channel_filter*> filters);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_CHANNEL_PROMISE_BASED_FILTER_H
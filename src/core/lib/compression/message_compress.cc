@@ -20,11 +20,14 @@
 
 #include "src/core/lib/compression/message_compress.h"
 
+#include <stdint.h>
 #include <string.h>
 
 #include <zconf.h>
 #include <zlib.h>
 
+#include "absl/status/status.h"
+
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
@@ -33,14 +36,18 @@
 
 #define OUTPUT_BLOCK_SIZE 1024
 
+/* Fails, setting *output_too_large if it is not null, as soon as more than
+   max_output_size bytes would be appended to output. */
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     size_t max_output_size, bool* output_too_large) {
   int r = Z_STREAM_END; /* Do not fail on an empty input. */
   int flush;
   size_t i;
   grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
   const uInt uint_max = ~static_cast<uInt>(0);
+  const size_t length_before = output->length;
 
   GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
   zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
@@ -64,6 +71,12 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         gpr_log(GPR_INFO, "zlib error (%d)", r);
         goto error;
       }
+      if (output->length - length_before + GRPC_SLICE_LENGTH(outbuf) -
+              zs->avail_out >
+          max_output_size) {
+        if (output_too_large != nullptr) *output_too_large = true;
+        goto error;
+      }
     } while (zs->avail_out == 0);
     if (zs->avail_in) {
       gpr_log(GPR_INFO, "zlib: not all input consumed");
@@ -93,27 +106,61 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
-static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
-  z_stream zs;
+static void init_zlib_stream(z_stream* zs, bool compress, int gzip,
+                             int level) {
   int r;
+  memset(zs, 0, sizeof(*zs));
+  zs->zalloc = zalloc_gpr;
+  zs->zfree = zfree_gpr;
+  if (compress) {
+    r = deflateInit2(zs, level, Z_DEFLATED, 15 | (gzip ? 16 : 0), 8,
+                     Z_DEFAULT_STRATEGY);
+  } else {
+    r = inflateInit2(zs, 15 | (gzip ? 16 : 0));
+  }
+  GPR_ASSERT(r == Z_OK);
+}
+
+static void truncate_output(grpc_slice_buffer* output, size_t count_before,
+                            size_t length_before) {
   size_t i;
+  for (i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
+/* Compression is only worth it if it makes the input smaller, so this gives
+   up as soon as the output is as long as the input. */
+static int zlib_compress_with(z_stream* zs, grpc_slice_buffer* input,
+                              grpc_slice_buffer* output) {
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
+  int r = input->length > 0 && zlib_body(zs, input, output, deflate,
+                                         input->length - 1, nullptr);
+  if (!r) truncate_output(output, count_before, length_before);
+  return r;
+}
+
+static int zlib_decompress_with(z_stream* zs, grpc_slice_buffer* input,
+                                grpc_slice_buffer* output,
+                                size_t max_output_size,
+                                bool* output_too_large) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r = zlib_body(zs, input, output, inflate, max_output_size,
+                    output_too_large);
+  if (!r) truncate_output(output, count_before, length_before);
+  return r;
+}
+
+static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                         int gzip) {
+  z_stream zs;
+  int r;
+  init_zlib_stream(&zs, true, gzip, Z_DEFAULT_COMPRESSION);
+  r = zlib_compress_with(&zs, input, output);
   deflateEnd(&zs);
   return r;
 }
@@ -122,22 +169,8 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                            int gzip) {
   z_stream zs;
   int r;
-  size_t i;
-  size_t count_before = output->count;
-  size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
+  init_zlib_stream(&zs, false, gzip, Z_DEFAULT_COMPRESSION);
+  r = zlib_decompress_with(&zs, input, output, SIZE_MAX, nullptr);
   inflateEnd(&zs);
   return r;
 }
@@ -192,3 +225,112 @@ int grpc_msg_decompress(grpc_compression_algorithm algorithm,
   gpr_log(GPR_ERROR, "invalid compression algorithm %d", algorithm);
   return 0;
 }
+
+namespace grpc_core {
+
+static_assert(MessageCompressor::kDefaultZlibLevel == Z_DEFAULT_COMPRESSION,
+              "kDefaultZlibLevel must match zlib");
+
+namespace {
+
+// Returns true and sets *gzip if algorithm is implemented with zlib.
+bool UseZlib(grpc_compression_algorithm algorithm, int* gzip) {
+  switch (algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+      *gzip = 0;
+      return true;
+    case GRPC_COMPRESS_GZIP:
+      *gzip = 1;
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+MessageCompressor::~MessageCompressor() {
+  if (zs_ != nullptr) {
+    deflateEnd(zs_);
+    delete zs_;
+  }
+}
+
+bool MessageCompressor::Compress(grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output) {
+  int gzip;
+  if (!UseZlib(algorithm_, &gzip)) {
+    return grpc_msg_compress(algorithm_, input, output) != 0;
+  }
+  if (zs_ == nullptr) {
+    zs_ = new z_stream;
+    init_zlib_stream(zs_, true, gzip, zlib_level_);
+  } else {
+    GPR_ASSERT(deflateReset(zs_) == Z_OK);
+  }
+  if (!zlib_compress_with(zs_, input, output)) {
+    copy(input, output);
+    return false;
+  }
+  return true;
+}
+
+MessageDecompressor::~MessageDecompressor() {
+  if (zs_ != nullptr) {
+    inflateEnd(zs_);
+    delete zs_;
+  }
+}
+
+absl::Status MessageDecompressor::Decompress(grpc_slice_buffer* input,
+                                             grpc_slice_buffer* output,
+                                             size_t max_output_size) {
+  int gzip;
+  if (!UseZlib(algorithm_, &gzip)) {
+    if (algorithm_ == GRPC_COMPRESS_NONE && input->length > max_output_size) {
+      return absl::ResourceExhaustedError("message larger than max");
+    }
+    if (!grpc_msg_decompress(algorithm_, input, output)) {
+      return absl::InternalError("invalid compression algorithm");
+    }
+    return absl::OkStatus();
+  }
+  if (zs_ == nullptr) {
+    zs_ = new z_stream;
+    init_zlib_stream(zs_, false, gzip, Z_DEFAULT_COMPRESSION);
+  } else {
+    GPR_ASSERT(inflateReset(zs_) == Z_OK);
+  }
+  bool output_too_large = false;
+  if (!zlib_decompress_with(zs_, input, output, max_output_size,
+                            &output_too_large)) {
+    if (output_too_large) {
+      return absl::ResourceExhaustedError(
+          "decompressed message larger than max");
+    }
+    return absl::InternalError("zlib decompression failed");
+  }
+  return absl::OkStatus();
+}
+
+bool AdaptiveCompressionPolicy::ShouldCompress() {
+  if (skip_remaining_ == 0) return true;
+  --skip_remaining_;
+  return false;
+}
+
+void AdaptiveCompressionPolicy::RecordResult(size_t uncompressed_size,
+                                             size_t compressed_size) {
+  if (compressed_size * 100 <= uncompressed_size * kPoorRatioPercent) {
+    poor_results_ = 0;
+    next_skip_ = kMinSkip;
+    return;
+  }
+  if (poor_results_ < kMaxPoorResults) ++poor_results_;
+  if (poor_results_ < kMaxPoorResults) return;
+  skip_remaining_ = next_skip_;
+  next_skip_ *= 2;
+  if (next_skip_ > kMaxSkip) next_skip_ = kMaxSkip;
+}
+
+}  // namespace grpc_core
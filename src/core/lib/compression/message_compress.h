@@ -21,9 +21,15 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include "absl/status/status.h"
+
 #include <grpc/impl/codegen/compression_types.h>
 #include <grpc/slice.h>
 
+struct z_stream_s;
+
 /* compress 'input' to 'output' using 'algorithm'.
    On success, appends compressed slices to output and returns 1.
    On failure, appends uncompressed slices to output and returns 0. */
@@ -36,4 +42,86 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+namespace grpc_core {
+
+// Compresses the messages sent on one stream.  The compression state is set
+// up by the first message and reset, rather than rebuilt, for each later one,
+// so a streaming call pays for it once.  Every message is still compressed on
+// its own, as the message framing requires.
+class MessageCompressor {
+ public:
+  // zlib's Z_DEFAULT_COMPRESSION.
+  static constexpr int kDefaultZlibLevel = -1;
+
+  // zlib_level, from 1 to 9 or kDefaultZlibLevel, is used by deflate and
+  // gzip.
+  explicit MessageCompressor(grpc_compression_algorithm algorithm,
+                             int zlib_level = kDefaultZlibLevel)
+      : algorithm_(algorithm), zlib_level_(zlib_level) {}
+  ~MessageCompressor();
+
+  MessageCompressor(const MessageCompressor&) = delete;
+  MessageCompressor& operator=(const MessageCompressor&) = delete;
+
+  // Same contract as grpc_msg_compress(), except that compression gives up
+  // as soon as its output is no smaller than the input.
+  bool Compress(grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+ private:
+  const grpc_compression_algorithm algorithm_;
+  const int zlib_level_;
+  z_stream_s* zs_ = nullptr;
+};
+
+// Decompresses the messages received on one stream, with the same reuse of
+// state as MessageCompressor.
+class MessageDecompressor {
+ public:
+  explicit MessageDecompressor(grpc_compression_algorithm algorithm)
+      : algorithm_(algorithm) {}
+  ~MessageDecompressor();
+
+  MessageDecompressor(const MessageDecompressor&) = delete;
+  MessageDecompressor& operator=(const MessageDecompressor&) = delete;
+
+  // Appends the decompressed input to output.  Stops and returns a
+  // RESOURCE_EXHAUSTED status as soon as the output would get longer than
+  // max_output_size, so that a small input cannot make it allocate an
+  // arbitrary amount of memory.  On failure, output is unchanged.
+  absl::Status Decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                          size_t max_output_size);
+
+ private:
+  const grpc_compression_algorithm algorithm_;
+  z_stream_s* zs_ = nullptr;
+};
+
+// Decides, from how well the previous messages of a stream compressed,
+// whether compressing the next one is worth the CPU.  Once kMaxPoorResults
+// messages in a row compressed to more than kPoorRatioPercent of their size,
+// messages are sent uncompressed.  After a number of them, one is
+// compressed again as a probe; the number doubles, up to kMaxSkip, every
+// time a probe compresses poorly, and a good result starts over.
+class AdaptiveCompressionPolicy {
+ public:
+  static constexpr size_t kPoorRatioPercent = 90;
+  static constexpr int kMaxPoorResults = 3;
+  static constexpr int kMinSkip = 4;
+  static constexpr int kMaxSkip = 256;
+
+  // Returns false if the next message should be sent uncompressed.
+  bool ShouldCompress();
+  // Records the result of compressing a message.  compressed_size is the
+  // size that was sent, that is the uncompressed size if compression did
+  // not make the message smaller.
+  void RecordResult(size_t uncompressed_size, size_t compressed_size);
+
+ private:
+  int poor_results_ = 0;
+  int skip_remaining_ = 0;
+  int next_skip_ = kMinSkip;
+};
+
+}  // namespace grpc_core
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H */
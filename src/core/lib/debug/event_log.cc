@@ -70,6 +70,60 @@ void EventLog::AppendInternal(absl::string_view event, int64_t delta) {
   fragment.entries.push_back({gpr_get_cycle_counter(), event, delta});
 }
 
+FlightRecorder* FlightRecorder::Get() {
+  static FlightRecorder* recorder = new FlightRecorder();
+  return recorder;
+}
+
+void FlightRecorder::RecordInternal(const char* event, int64_t arg) {
+  Ring& ring = rings_.this_cpu();
+  const uint64_t seq = ring.next.fetch_add(1, std::memory_order_relaxed);
+  Entry& entry = ring.entries[seq % kEntriesPerCpu];
+  // Same protocol as a seqlock: readers that see seq change or be 0 across
+  // their read of the fields discard the entry.
+  entry.seq.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  entry.when.store(gpr_get_cycle_counter(), std::memory_order_relaxed);
+  entry.event.store(event, std::memory_order_relaxed);
+  entry.arg.store(arg, std::memory_order_relaxed);
+  entry.seq.store(seq + 1, std::memory_order_release);
+}
+
+std::string FlightRecorder::DumpCsv() {
+  struct Event {
+    gpr_cycle_counter when;
+    size_t cpu;
+    const char* event;
+    int64_t arg;
+  };
+  std::vector<Event> events;
+  size_t cpu = 0;
+  for (const Ring& ring : rings_) {
+    for (const Entry& entry : ring.entries) {
+      const uint64_t seq = entry.seq.load(std::memory_order_acquire);
+      if (seq == 0) continue;
+      Event event{entry.when.load(std::memory_order_relaxed), cpu,
+                  entry.event.load(std::memory_order_relaxed),
+                  entry.arg.load(std::memory_order_relaxed)};
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (entry.seq.load(std::memory_order_relaxed) != seq) continue;
+      events.push_back(event);
+    }
+    ++cpu;
+  }
+  std::stable_sort(
+      events.begin(), events.end(),
+      [](const Event& a, const Event& b) { return a.when < b.when; });
+  const gpr_cycle_counter now = gpr_get_cycle_counter();
+  std::string result = "age_us,cpu,event,arg\n";
+  for (const auto& event : events) {
+    gpr_timespec age = gpr_cycle_counter_sub(now, event.when);
+    absl::StrAppend(&result, age.tv_sec * 1000000 + age.tv_nsec / 1000, ",",
+                    event.cpu, ",", event.event, ",", event.arg, "\n");
+  }
+  return result;
+}
+
 std::string EventLog::EndCollectionAndReportCsv(
     absl::Span<const absl::string_view> columns) {
   auto events = EndCollection(columns);
@@ -17,6 +17,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <atomic>
@@ -76,6 +77,53 @@ class EventLog {
   static std::atomic<EventLog*> g_instance_;
 };
 
+// Always-on record of the most recent transport events, kept so that latency
+// spikes can be debugged after the fact. Unlike EventLog it needs no
+// collection window: each cpu owns a ring of kEntriesPerCpu entries that is
+// overwritten in a loop, and recording takes no locks, just a cycle counter
+// read, an atomic increment and a few relaxed stores.
+//
+// Writers racing for the same slot after a full wrap-around, or a reader
+// racing with a writer, can lose an entry; that is the price of never
+// blocking the transport.
+class FlightRecorder {
+ public:
+  static constexpr size_t kEntriesPerCpu = 1024;
+
+  // Records \a event with an event specific argument (e.g. a byte count).
+  // \a event must point to a string literal. Must be called under an
+  // ExecCtx.
+  static void Record(const char* event, int64_t arg) {
+    Get()->RecordInternal(event, arg);
+  }
+
+  static FlightRecorder* Get();
+
+  // Returns the recorded events, oldest first, as a csv with columns
+  // "age_us" (time before the dump), "cpu", "event" and "arg".
+  std::string DumpCsv();
+
+ private:
+  struct Entry {
+    // 0 while the entry is being written, else its position in the ring + 1.
+    std::atomic<uint64_t> seq{0};
+    std::atomic<gpr_cycle_counter> when{0};
+    std::atomic<const char*> event{nullptr};
+    std::atomic<int64_t> arg{0};
+  };
+
+  struct Ring {
+    std::atomic<uint64_t> next{0};
+    Entry entries[kEntriesPerCpu];
+  };
+
+  FlightRecorder() = default;
+
+  void RecordInternal(const char* event, int64_t arg);
+
+  PerCpu<Ring> rings_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_DEBUG_EVENT_LOG_H
@@ -44,6 +44,19 @@ Histogram_32768_24 operator-(const Histogram_32768_24& left,
   }
   return result;
 }
+void HistogramCollector_100_20::Collect(Histogram_100_20* result) const {
+  for (int i = 0; i < 20; i++) {
+    result->buckets_[i] += buckets_[i].load(std::memory_order_relaxed);
+  }
+}
+Histogram_100_20 operator-(const Histogram_100_20& left,
+                           const Histogram_100_20& right) {
+  Histogram_100_20 result;
+  for (int i = 0; i < 20; i++) {
+    result.buckets_[i] = left.buckets_[i] - right.buckets_[i];
+  }
+  return result;
+}
 void HistogramCollector_16777216_20::Collect(
     Histogram_16777216_20* result) const {
   for (int i = 0; i < 20; i++) {
@@ -75,34 +88,55 @@ const absl::string_view
     GlobalStats::counter_name[static_cast<int>(Counter::COUNT)] = {
         "client_calls_created",
         "server_calls_created",
+        "call_arena_zone_allocs",
         "client_channels_created",
         "client_subchannels_created",
         "server_channels_created",
+        "retry_hedged_attempts",
+        "retry_hedged_attempts_won",
+        "ssl_session_cache_hits",
+        "ssl_session_cache_misses",
+        "ssl_session_cache_evictions",
         "syscall_write",
         "syscall_read",
         "tcp_read_alloc_8k",
         "tcp_read_alloc_64k",
+        "busy_poll_hits",
         "http2_settings_writes",
         "http2_pings_sent",
         "http2_writes_begun",
         "http2_transport_stalls",
         "http2_stream_stalls",
+        "http2_coalesced_writes",
+        "http2_writes_corked",
         "cq_pluck_creates",
         "cq_next_creates",
         "cq_callback_creates",
+        "cq_callback_slow_runs",
+        "compression_adaptive_skips",
+        "dns_cache_hits",
+        "dns_cache_misses",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
     "Number of client side calls created by this process",
     "Number of server side calls created by this process",
+    "Number of call arena allocations that did not fit in the initial zone",
     "Number of client channels created",
     "Number of client subchannels created",
     "Number of server channels created",
+    "Number of hedged call attempts started after the first attempt of a call",
+    "Number of calls committed to a hedged attempt instead of their first "
+    "attempt",
+    "Number of client SSL session cache lookups that found a session",
+    "Number of client SSL session cache lookups that found no session",
+    "Number of sessions evicted from client SSL session caches to make room",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
     "process",
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of 8k allocations by the TCP subsystem for reading",
     "Number of 64k allocations by the TCP subsystem for reading",
+    "Number of busy-poll spins that found events without blocking",
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
     "Number of HTTP2 writes initiated",
@@ -110,28 +144,63 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "control window",
     "Number of times sending was completely stalled by the stream flow control "
     "window",
+    "Number of complete small calls whose frames were written as one "
+    "contiguous slice",
+    "Number of HTTP2 writes delayed by a cork timer",
     "Number of completion queues created for cq_pluck (indicates sync api "
     "usage)",
     "Number of completion queues created for cq_next (indicates cq async api "
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of callback api callbacks that ran for longer than the slow "
+    "callback budget (10ms)",
+    "Number of messages sent uncompressed because compressing the previous "
+    "messages of their stream saved too little",
+    "Number of DNS resolutions answered from the process-wide DNS result "
+    "cache, including those that joined a lookup in flight",
+    "Number of DNS resolutions that started a lookup because the "
+    "process-wide DNS result cache had no fresh result",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
-        "call_initial_size",       "tcp_write_size", "tcp_write_iov_size",
-        "tcp_read_size",           "tcp_read_offer", "tcp_read_offer_iov_size",
+        "call_initial_size",
+        "tcp_write_size",
+        "tcp_write_iov_size",
+        "tcp_write_batch_size",
+        "tcp_read_size",
+        "tcp_read_zerocopy_size",
+        "tcp_read_offer",
+        "tcp_read_offer_iov_size",
+        "busy_poll_spin_us",
         "http2_send_message_size",
+        "http2_hpack_hot_metadata_bytes_saved",
+        "http2_cork_batch_size",
+        "compression_ratio_percent",
+        "work_serializer_queue_latency_us",
 };
 const absl::string_view
     GlobalStats::histogram_doc[static_cast<int>(Histogram::COUNT)] = {
         "Initial size of the grpc_call arena created at call start",
         "Number of bytes offered to each syscall_write",
         "Number of byte segments offered to each syscall_write",
+        "Number of endpoint writes flushed together by each write coalescer "
+        "batch",
         "Number of bytes received by each syscall_read",
+        "Number of bytes mapped by each zerocopy receive",
         "Number of bytes offered to each syscall_read",
         "Number of byte segments offered to each syscall_read",
+        "Microseconds an epoll poller spent in each busy-poll spin before "
+        "events arrived or it blocked",
         "Size of messages received by HTTP2 transport",
+        "Number of header bytes saved each time learned hot metadata is sent "
+        "as an HPACK index",
+        "Number of write requests gathered into each write started by a cork "
+        "timer",
+        "Size of each compressed message as a percentage of its uncompressed "
+        "size",
+        "Microseconds each callback waited in a work serializer queue before "
+        "it ran",
 };
 namespace {
 const int kStatsTable0[25] = {
@@ -140,15 +209,19 @@ const int kStatsTable0[25] = {
 const uint8_t kStatsTable1[27] = {3,  3,  4,  5,  6,  6,  7,  8,  9,
                                   10, 11, 11, 12, 13, 14, 15, 16, 16,
                                   17, 18, 19, 20, 20, 21, 22, 23, 24};
-const int kStatsTable2[21] = {
+const int kStatsTable2[21] = {0,  1,  2,  3,  4,  5,  7,  9,  11, 14, 17,
+                              21, 25, 30, 36, 43, 51, 61, 72, 85, 100};
+const uint8_t kStatsTable3[16] = {6,  6,  7,  8,  9,  9,  10, 11,
+                                  12, 13, 14, 15, 16, 17, 18, 19};
+const int kStatsTable4[21] = {
     0,     1,      3,      8,       19,      45,      106,
     250,   588,    1383,   3252,    7646,    17976,   42262,
     99359, 233593, 549177, 1291113, 3035402, 7136218, 16777216};
-const uint8_t kStatsTable3[23] = {2,  3,  3,  4,  5,  6,  7,  8,
+const uint8_t kStatsTable5[23] = {2,  3,  3,  4,  5,  6,  7,  8,
                                   8,  9,  10, 11, 12, 12, 13, 14,
                                   15, 16, 16, 17, 18, 19, 20};
-const int kStatsTable4[11] = {0, 1, 2, 4, 7, 11, 17, 26, 38, 56, 80};
-const uint8_t kStatsTable5[9] = {3, 3, 4, 5, 6, 6, 7, 8, 9};
+const int kStatsTable6[11] = {0, 1, 2, 4, 7, 11, 17, 26, 38, 56, 80};
+const uint8_t kStatsTable7[9] = {3, 3, 4, 5, 6, 6, 7, 8, 9};
 }  // namespace
 int Histogram_32768_24::BucketFor(int value) {
   if (value < 3) {
@@ -169,6 +242,29 @@ int Histogram_32768_24::BucketFor(int value) {
     }
   }
 }
+int Histogram_100_20::BucketFor(int value) {
+  if (value < 6) {
+    if (value < 0) {
+      return 0;
+    } else {
+      return value;
+    }
+  } else {
+    if (value < 81) {
+      DblUint val;
+      val.dbl = value;
+      const int bucket =
+          kStatsTable3[((val.uint - 4618441417868443648ull) >> 50)];
+      return bucket - (value < kStatsTable2[bucket]);
+    } else {
+      if (value < 85) {
+        return 18;
+      } else {
+        return 19;
+      }
+    }
+  }
+}
 int Histogram_16777216_20::BucketFor(int value) {
   if (value < 2) {
     if (value < 0) {
@@ -181,8 +277,8 @@ int Histogram_16777216_20::BucketFor(int value) {
       DblUint val;
       val.dbl = value;
       const int bucket =
-          kStatsTable3[((val.uint - 4611686018427387904ull) >> 52)];
-      return bucket - (value < kStatsTable2[bucket]);
+          kStatsTable5[((val.uint - 4611686018427387904ull) >> 52)];
+      return bucket - (value < kStatsTable4[bucket]);
     } else {
       return 19;
     }
@@ -200,8 +296,8 @@ int Histogram_80_10::BucketFor(int value) {
       DblUint val;
       val.dbl = value;
       const int bucket =
-          kStatsTable5[((val.uint - 4613937818241073152ull) >> 51)];
-      return bucket - (value < kStatsTable4[bucket]);
+          kStatsTable7[((val.uint - 4613937818241073152ull) >> 51)];
+      return bucket - (value < kStatsTable6[bucket]);
     } else {
       if (value < 56) {
         return 8;
@@ -214,21 +310,34 @@ int Histogram_80_10::BucketFor(int value) {
 GlobalStats::GlobalStats()
     : client_calls_created{0},
       server_calls_created{0},
+      call_arena_zone_allocs{0},
       client_channels_created{0},
       client_subchannels_created{0},
       server_channels_created{0},
+      retry_hedged_attempts{0},
+      retry_hedged_attempts_won{0},
+      ssl_session_cache_hits{0},
+      ssl_session_cache_misses{0},
+      ssl_session_cache_evictions{0},
       syscall_write{0},
       syscall_read{0},
       tcp_read_alloc_8k{0},
       tcp_read_alloc_64k{0},
+      busy_poll_hits{0},
       http2_settings_writes{0},
       http2_pings_sent{0},
       http2_writes_begun{0},
       http2_transport_stalls{0},
       http2_stream_stalls{0},
+      http2_coalesced_writes{0},
+      http2_writes_corked{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
-      cq_callback_creates{0} {}
+      cq_callback_creates{0},
+      cq_callback_slow_runs{0},
+      compression_adaptive_skips{0},
+      dns_cache_hits{0},
+      dns_cache_misses{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -237,23 +346,44 @@ HistogramView GlobalStats::histogram(Histogram which) const {
       return HistogramView{&Histogram_32768_24::BucketFor, kStatsTable0, 24,
                            call_initial_size.buckets()};
     case Histogram::kTcpWriteSize:
-      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable4, 20,
                            tcp_write_size.buckets()};
     case Histogram::kTcpWriteIovSize:
-      return HistogramView{&Histogram_80_10::BucketFor, kStatsTable4, 10,
+      return HistogramView{&Histogram_80_10::BucketFor, kStatsTable6, 10,
                            tcp_write_iov_size.buckets()};
+    case Histogram::kTcpWriteBatchSize:
+      return HistogramView{&Histogram_80_10::BucketFor, kStatsTable6, 10,
+                           tcp_write_batch_size.buckets()};
     case Histogram::kTcpReadSize:
-      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable4, 20,
                            tcp_read_size.buckets()};
+    case Histogram::kTcpReadZerocopySize:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable4, 20,
+                           tcp_read_zerocopy_size.buckets()};
     case Histogram::kTcpReadOffer:
-      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable4, 20,
                            tcp_read_offer.buckets()};
     case Histogram::kTcpReadOfferIovSize:
-      return HistogramView{&Histogram_80_10::BucketFor, kStatsTable4, 10,
+      return HistogramView{&Histogram_80_10::BucketFor, kStatsTable6, 10,
                            tcp_read_offer_iov_size.buckets()};
+    case Histogram::kBusyPollSpinUs:
+      return HistogramView{&Histogram_32768_24::BucketFor, kStatsTable0, 24,
+                           busy_poll_spin_us.buckets()};
     case Histogram::kHttp2SendMessageSize:
-      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable4, 20,
                            http2_send_message_size.buckets()};
+    case Histogram::kHttp2HpackHotMetadataBytesSaved:
+      return HistogramView{&Histogram_32768_24::BucketFor, kStatsTable0, 24,
+                           http2_hpack_hot_metadata_bytes_saved.buckets()};
+    case Histogram::kHttp2CorkBatchSize:
+      return HistogramView{&Histogram_80_10::BucketFor, kStatsTable6, 10,
+                           http2_cork_batch_size.buckets()};
+    case Histogram::kCompressionRatioPercent:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable2, 20,
+                           compression_ratio_percent.buckets()};
+    case Histogram::kWorkSerializerQueueLatencyUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable4, 20,
+                           work_serializer_queue_latency_us.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -263,18 +393,32 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.client_calls_created.load(std::memory_order_relaxed);
     result->server_calls_created +=
         data.server_calls_created.load(std::memory_order_relaxed);
+    result->call_arena_zone_allocs +=
+        data.call_arena_zone_allocs.load(std::memory_order_relaxed);
     result->client_channels_created +=
         data.client_channels_created.load(std::memory_order_relaxed);
     result->client_subchannels_created +=
         data.client_subchannels_created.load(std::memory_order_relaxed);
     result->server_channels_created +=
         data.server_channels_created.load(std::memory_order_relaxed);
+    result->retry_hedged_attempts +=
+        data.retry_hedged_attempts.load(std::memory_order_relaxed);
+    result->retry_hedged_attempts_won +=
+        data.retry_hedged_attempts_won.load(std::memory_order_relaxed);
+    result->ssl_session_cache_hits +=
+        data.ssl_session_cache_hits.load(std::memory_order_relaxed);
+    result->ssl_session_cache_misses +=
+        data.ssl_session_cache_misses.load(std::memory_order_relaxed);
+    result->ssl_session_cache_evictions +=
+        data.ssl_session_cache_evictions.load(std::memory_order_relaxed);
     result->syscall_write += data.syscall_write.load(std::memory_order_relaxed);
     result->syscall_read += data.syscall_read.load(std::memory_order_relaxed);
     result->tcp_read_alloc_8k +=
         data.tcp_read_alloc_8k.load(std::memory_order_relaxed);
     result->tcp_read_alloc_64k +=
         data.tcp_read_alloc_64k.load(std::memory_order_relaxed);
+    result->busy_poll_hits +=
+        data.busy_poll_hits.load(std::memory_order_relaxed);
     result->http2_settings_writes +=
         data.http2_settings_writes.load(std::memory_order_relaxed);
     result->http2_pings_sent +=
@@ -285,19 +429,40 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.http2_transport_stalls.load(std::memory_order_relaxed);
     result->http2_stream_stalls +=
         data.http2_stream_stalls.load(std::memory_order_relaxed);
+    result->http2_coalesced_writes +=
+        data.http2_coalesced_writes.load(std::memory_order_relaxed);
+    result->http2_writes_corked +=
+        data.http2_writes_corked.load(std::memory_order_relaxed);
     result->cq_pluck_creates +=
         data.cq_pluck_creates.load(std::memory_order_relaxed);
     result->cq_next_creates +=
         data.cq_next_creates.load(std::memory_order_relaxed);
     result->cq_callback_creates +=
         data.cq_callback_creates.load(std::memory_order_relaxed);
+    result->cq_callback_slow_runs +=
+        data.cq_callback_slow_runs.load(std::memory_order_relaxed);
+    result->compression_adaptive_skips +=
+        data.compression_adaptive_skips.load(std::memory_order_relaxed);
+    result->dns_cache_hits +=
+        data.dns_cache_hits.load(std::memory_order_relaxed);
+    result->dns_cache_misses +=
+        data.dns_cache_misses.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
+    data.tcp_write_batch_size.Collect(&result->tcp_write_batch_size);
     data.tcp_read_size.Collect(&result->tcp_read_size);
+    data.tcp_read_zerocopy_size.Collect(&result->tcp_read_zerocopy_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
+    data.busy_poll_spin_us.Collect(&result->busy_poll_spin_us);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
+    data.http2_hpack_hot_metadata_bytes_saved.Collect(
+        &result->http2_hpack_hot_metadata_bytes_saved);
+    data.http2_cork_batch_size.Collect(&result->http2_cork_batch_size);
+    data.compression_ratio_percent.Collect(&result->compression_ratio_percent);
+    data.work_serializer_queue_latency_us.Collect(
+        &result->work_serializer_queue_latency_us);
   }
   return result;
 }
@@ -307,16 +472,29 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       client_calls_created - other.client_calls_created;
   result->server_calls_created =
       server_calls_created - other.server_calls_created;
+  result->call_arena_zone_allocs =
+      call_arena_zone_allocs - other.call_arena_zone_allocs;
   result->client_channels_created =
       client_channels_created - other.client_channels_created;
   result->client_subchannels_created =
       client_subchannels_created - other.client_subchannels_created;
   result->server_channels_created =
       server_channels_created - other.server_channels_created;
+  result->retry_hedged_attempts =
+      retry_hedged_attempts - other.retry_hedged_attempts;
+  result->retry_hedged_attempts_won =
+      retry_hedged_attempts_won - other.retry_hedged_attempts_won;
+  result->ssl_session_cache_hits =
+      ssl_session_cache_hits - other.ssl_session_cache_hits;
+  result->ssl_session_cache_misses =
+      ssl_session_cache_misses - other.ssl_session_cache_misses;
+  result->ssl_session_cache_evictions =
+      ssl_session_cache_evictions - other.ssl_session_cache_evictions;
   result->syscall_write = syscall_write - other.syscall_write;
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
   result->tcp_read_alloc_64k = tcp_read_alloc_64k - other.tcp_read_alloc_64k;
+  result->busy_poll_hits = busy_poll_hits - other.busy_poll_hits;
   result->http2_settings_writes =
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
@@ -324,18 +502,41 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_transport_stalls =
       http2_transport_stalls - other.http2_transport_stalls;
   result->http2_stream_stalls = http2_stream_stalls - other.http2_stream_stalls;
+  result->http2_coalesced_writes =
+      http2_coalesced_writes - other.http2_coalesced_writes;
+  result->http2_writes_corked = http2_writes_corked - other.http2_writes_corked;
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
+  result->cq_callback_slow_runs =
+      cq_callback_slow_runs - other.cq_callback_slow_runs;
+  result->compression_adaptive_skips =
+      compression_adaptive_skips - other.compression_adaptive_skips;
+  result->dns_cache_hits = dns_cache_hits - other.dns_cache_hits;
+  result->dns_cache_misses = dns_cache_misses - other.dns_cache_misses;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
+  result->tcp_write_batch_size =
+      tcp_write_batch_size - other.tcp_write_batch_size;
   result->tcp_read_size = tcp_read_size - other.tcp_read_size;
+  result->tcp_read_zerocopy_size =
+      tcp_read_zerocopy_size - other.tcp_read_zerocopy_size;
   result->tcp_read_offer = tcp_read_offer - other.tcp_read_offer;
   result->tcp_read_offer_iov_size =
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
+  result->busy_poll_spin_us = busy_poll_spin_us - other.busy_poll_spin_us;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
+  result->http2_hpack_hot_metadata_bytes_saved =
+      http2_hpack_hot_metadata_bytes_saved -
+      other.http2_hpack_hot_metadata_bytes_saved;
+  result->http2_cork_batch_size =
+      http2_cork_batch_size - other.http2_cork_batch_size;
+  result->compression_ratio_percent =
+      compression_ratio_percent - other.compression_ratio_percent;
+  result->work_serializer_queue_latency_us =
+      work_serializer_queue_latency_us - other.work_serializer_queue_latency_us;
   return result;
 }
 }  // namespace grpc_core
@@ -57,6 +57,29 @@ class HistogramCollector_32768_24 {
  private:
   std::atomic<uint64_t> buckets_[24]{};
 };
+class HistogramCollector_100_20;
+class Histogram_100_20 {
+ public:
+  static int BucketFor(int value);
+  const uint64_t* buckets() const { return buckets_; }
+  friend Histogram_100_20 operator-(const Histogram_100_20& left,
+                                    const Histogram_100_20& right);
+
+ private:
+  friend class HistogramCollector_100_20;
+  uint64_t buckets_[20]{};
+};
+class HistogramCollector_100_20 {
+ public:
+  void Increment(int value) {
+    buckets_[Histogram_100_20::BucketFor(value)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void Collect(Histogram_100_20* result) const;
+
+ private:
+  std::atomic<uint64_t> buckets_[20]{};
+};
 class HistogramCollector_16777216_20;
 class Histogram_16777216_20 {
  public:
@@ -107,31 +130,51 @@ struct GlobalStats {
   enum class Counter {
     kClientCallsCreated,
     kServerCallsCreated,
+    kCallArenaZoneAllocs,
     kClientChannelsCreated,
     kClientSubchannelsCreated,
     kServerChannelsCreated,
+    kRetryHedgedAttempts,
+    kRetryHedgedAttemptsWon,
+    kSslSessionCacheHits,
+    kSslSessionCacheMisses,
+    kSslSessionCacheEvictions,
     kSyscallWrite,
     kSyscallRead,
     kTcpReadAlloc8k,
     kTcpReadAlloc64k,
+    kBusyPollHits,
     kHttp2SettingsWrites,
     kHttp2PingsSent,
     kHttp2WritesBegun,
     kHttp2TransportStalls,
     kHttp2StreamStalls,
+    kHttp2CoalescedWrites,
+    kHttp2WritesCorked,
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
+    kCqCallbackSlowRuns,
+    kCompressionAdaptiveSkips,
+    kDnsCacheHits,
+    kDnsCacheMisses,
     COUNT
   };
   enum class Histogram {
     kCallInitialSize,
     kTcpWriteSize,
     kTcpWriteIovSize,
+    kTcpWriteBatchSize,
     kTcpReadSize,
+    kTcpReadZerocopySize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
+    kBusyPollSpinUs,
     kHttp2SendMessageSize,
+    kHttp2HpackHotMetadataBytesSaved,
+    kHttp2CorkBatchSize,
+    kCompressionRatioPercent,
+    kWorkSerializerQueueLatencyUs,
     COUNT
   };
   GlobalStats();
@@ -145,31 +188,51 @@ struct GlobalStats {
     struct {
       uint64_t client_calls_created;
       uint64_t server_calls_created;
+      uint64_t call_arena_zone_allocs;
       uint64_t client_channels_created;
       uint64_t client_subchannels_created;
       uint64_t server_channels_created;
+      uint64_t retry_hedged_attempts;
+      uint64_t retry_hedged_attempts_won;
+      uint64_t ssl_session_cache_hits;
+      uint64_t ssl_session_cache_misses;
+      uint64_t ssl_session_cache_evictions;
       uint64_t syscall_write;
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
       uint64_t tcp_read_alloc_64k;
+      uint64_t busy_poll_hits;
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
       uint64_t http2_writes_begun;
       uint64_t http2_transport_stalls;
       uint64_t http2_stream_stalls;
+      uint64_t http2_coalesced_writes;
+      uint64_t http2_writes_corked;
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
+      uint64_t cq_callback_slow_runs;
+      uint64_t compression_adaptive_skips;
+      uint64_t dns_cache_hits;
+      uint64_t dns_cache_misses;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
   Histogram_32768_24 call_initial_size;
   Histogram_16777216_20 tcp_write_size;
   Histogram_80_10 tcp_write_iov_size;
+  Histogram_80_10 tcp_write_batch_size;
   Histogram_16777216_20 tcp_read_size;
+  Histogram_16777216_20 tcp_read_zerocopy_size;
   Histogram_16777216_20 tcp_read_offer;
   Histogram_80_10 tcp_read_offer_iov_size;
+  Histogram_32768_24 busy_poll_spin_us;
   Histogram_16777216_20 http2_send_message_size;
+  Histogram_32768_24 http2_hpack_hot_metadata_bytes_saved;
+  Histogram_80_10 http2_cork_batch_size;
+  Histogram_100_20 compression_ratio_percent;
+  Histogram_16777216_20 work_serializer_queue_latency_us;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -184,6 +247,10 @@ class GlobalStatsCollector {
     data_.this_cpu().server_calls_created.fetch_add(1,
                                                     std::memory_order_relaxed);
   }
+  void IncrementCallArenaZoneAllocs() {
+    data_.this_cpu().call_arena_zone_allocs.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementClientChannelsCreated() {
     data_.this_cpu().client_channels_created.fetch_add(
         1, std::memory_order_relaxed);
@@ -196,6 +263,26 @@ class GlobalStatsCollector {
     data_.this_cpu().server_channels_created.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementRetryHedgedAttempts() {
+    data_.this_cpu().retry_hedged_attempts.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementRetryHedgedAttemptsWon() {
+    data_.this_cpu().retry_hedged_attempts_won.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslSessionCacheHits() {
+    data_.this_cpu().ssl_session_cache_hits.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslSessionCacheMisses() {
+    data_.this_cpu().ssl_session_cache_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslSessionCacheEvictions() {
+    data_.this_cpu().ssl_session_cache_evictions.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementSyscallWrite() {
     data_.this_cpu().syscall_write.fetch_add(1, std::memory_order_relaxed);
   }
@@ -208,6 +295,9 @@ class GlobalStatsCollector {
   void IncrementTcpReadAlloc64k() {
     data_.this_cpu().tcp_read_alloc_64k.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementBusyPollHits() {
+    data_.this_cpu().busy_poll_hits.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementHttp2SettingsWrites() {
     data_.this_cpu().http2_settings_writes.fetch_add(1,
                                                      std::memory_order_relaxed);
@@ -226,6 +316,14 @@ class GlobalStatsCollector {
     data_.this_cpu().http2_stream_stalls.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementHttp2CoalescedWrites() {
+    data_.this_cpu().http2_coalesced_writes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WritesCorked() {
+    data_.this_cpu().http2_writes_corked.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
   void IncrementCqPluckCreates() {
     data_.this_cpu().cq_pluck_creates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -236,6 +334,20 @@ class GlobalStatsCollector {
     data_.this_cpu().cq_callback_creates.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementCqCallbackSlowRuns() {
+    data_.this_cpu().cq_callback_slow_runs.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCompressionAdaptiveSkips() {
+    data_.this_cpu().compression_adaptive_skips.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementDnsCacheHits() {
+    data_.this_cpu().dns_cache_hits.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementDnsCacheMisses() {
+    data_.this_cpu().dns_cache_misses.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -245,45 +357,86 @@ class GlobalStatsCollector {
   void IncrementTcpWriteIovSize(int value) {
     data_.this_cpu().tcp_write_iov_size.Increment(value);
   }
+  void IncrementTcpWriteBatchSize(int value) {
+    data_.this_cpu().tcp_write_batch_size.Increment(value);
+  }
   void IncrementTcpReadSize(int value) {
     data_.this_cpu().tcp_read_size.Increment(value);
   }
+  void IncrementTcpReadZerocopySize(int value) {
+    data_.this_cpu().tcp_read_zerocopy_size.Increment(value);
+  }
   void IncrementTcpReadOffer(int value) {
     data_.this_cpu().tcp_read_offer.Increment(value);
   }
   void IncrementTcpReadOfferIovSize(int value) {
     data_.this_cpu().tcp_read_offer_iov_size.Increment(value);
   }
+  void IncrementBusyPollSpinUs(int value) {
+    data_.this_cpu().busy_poll_spin_us.Increment(value);
+  }
   void IncrementHttp2SendMessageSize(int value) {
     data_.this_cpu().http2_send_message_size.Increment(value);
   }
+  void IncrementHttp2HpackHotMetadataBytesSaved(int value) {
+    data_.this_cpu().http2_hpack_hot_metadata_bytes_saved.Increment(value);
+  }
+  void IncrementHttp2CorkBatchSize(int value) {
+    data_.this_cpu().http2_cork_batch_size.Increment(value);
+  }
+  void IncrementCompressionRatioPercent(int value) {
+    data_.this_cpu().compression_ratio_percent.Increment(value);
+  }
+  void IncrementWorkSerializerQueueLatencyUs(int value) {
+    data_.this_cpu().work_serializer_queue_latency_us.Increment(value);
+  }
 
  private:
   struct Data {
     std::atomic<uint64_t> client_calls_created{0};
     std::atomic<uint64_t> server_calls_created{0};
+    std::atomic<uint64_t> call_arena_zone_allocs{0};
     std::atomic<uint64_t> client_channels_created{0};
     std::atomic<uint64_t> client_subchannels_created{0};
     std::atomic<uint64_t> server_channels_created{0};
+    std::atomic<uint64_t> retry_hedged_attempts{0};
+    std::atomic<uint64_t> retry_hedged_attempts_won{0};
+    std::atomic<uint64_t> ssl_session_cache_hits{0};
+    std::atomic<uint64_t> ssl_session_cache_misses{0};
+    std::atomic<uint64_t> ssl_session_cache_evictions{0};
     std::atomic<uint64_t> syscall_write{0};
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
+    std::atomic<uint64_t> busy_poll_hits{0};
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
     std::atomic<uint64_t> http2_transport_stalls{0};
     std::atomic<uint64_t> http2_stream_stalls{0};
+    std::atomic<uint64_t> http2_coalesced_writes{0};
+    std::atomic<uint64_t> http2_writes_corked{0};
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
+    std::atomic<uint64_t> cq_callback_slow_runs{0};
+    std::atomic<uint64_t> compression_adaptive_skips{0};
+    std::atomic<uint64_t> dns_cache_hits{0};
+    std::atomic<uint64_t> dns_cache_misses{0};
     HistogramCollector_32768_24 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
+    HistogramCollector_80_10 tcp_write_batch_size;
     HistogramCollector_16777216_20 tcp_read_size;
+    HistogramCollector_16777216_20 tcp_read_zerocopy_size;
     HistogramCollector_16777216_20 tcp_read_offer;
     HistogramCollector_80_10 tcp_read_offer_iov_size;
+    HistogramCollector_32768_24 busy_poll_spin_us;
     HistogramCollector_16777216_20 http2_send_message_size;
+    HistogramCollector_32768_24 http2_hpack_hot_metadata_bytes_saved;
+    HistogramCollector_80_10 http2_cork_batch_size;
+    HistogramCollector_100_20 compression_ratio_percent;
+    HistogramCollector_16777216_20 work_serializer_queue_latency_us;
   };
   PerCpu<Data> data_;
 };
@@ -15,7 +15,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <stdint.h>
-#include <stdlib.h>
+#include <stddef.h>
 
 #include <memory>
 #include <new>
@@ -25,6 +25,7 @@
 #include <grpc/event_engine/memory_request.h>
 #include <grpc/slice.h>
 
+#include "src/core/lib/slice/slab_allocator.h"
 #include "src/core/lib/slice/slice_refcount.h"
 
 namespace grpc_event_engine {
@@ -48,8 +49,9 @@ class SliceRefCount : public grpc_slice_refcount {
  private:
   static void Destroy(grpc_slice_refcount* p) {
     auto* rc = static_cast<SliceRefCount*>(p);
+    size_t size = rc->size_;
     rc->~SliceRefCount();
-    free(rc);
+    grpc_core::SlabAllocator::Free(rc, size);
   }
 
   std::shared_ptr<internal::MemoryAllocatorImpl> allocator_;
@@ -60,7 +62,7 @@ class SliceRefCount : public grpc_slice_refcount {
 
 grpc_slice MemoryAllocator::MakeSlice(MemoryRequest request) {
   auto size = Reserve(request.Increase(sizeof(SliceRefCount)));
-  void* p = malloc(size);
+  void* p = grpc_core::SlabAllocator::Alloc(size);
   new (p) SliceRefCount(allocator_, size);
   grpc_slice slice;
   slice.refcount = static_cast<SliceRefCount*>(p);
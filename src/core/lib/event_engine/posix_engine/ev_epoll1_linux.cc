@@ -17,7 +17,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/status/status.h"
@@ -26,6 +28,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
@@ -42,6 +45,8 @@
 
 #include "absl/synchronization/mutex.h"
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
@@ -346,8 +351,8 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
   }
 }
 
-Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false) {
+Epoll1Poller::Epoll1Poller(Scheduler* scheduler, int busy_poll_us)
+    : scheduler_(scheduler), busy_poll_us_(busy_poll_us), was_kicked_(false) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   GPR_ASSERT(wakeup_fd_ != nullptr);
@@ -462,12 +467,40 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
-  int r;
-  do {
-    r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
-                   static_cast<int>(
-                       grpc_event_engine::experimental::Milliseconds(timeout)));
-  } while (r < 0 && errno == EINTR);
+  int r = 0;
+  int timeout_ms =
+      static_cast<int>(grpc_event_engine::experimental::Milliseconds(timeout));
+  if (timeout_ms != 0 && busy_poll_us_ > 0) {
+    // Spin no longer than the timeout allows, then block for the rest.
+    auto spin = std::chrono::microseconds(busy_poll_us_);
+    if (timeout_ms > 0) {
+      spin = std::min<std::chrono::microseconds>(
+          spin, std::chrono::milliseconds(timeout_ms));
+    }
+    auto start = std::chrono::steady_clock::now();
+    auto now = start;
+    do {
+      r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+                     0);
+      now = std::chrono::steady_clock::now();
+    } while ((r == 0 || (r < 0 && errno == EINTR)) && now - start < spin);
+    auto spun =
+        std::chrono::duration_cast<std::chrono::microseconds>(now - start);
+    grpc_core::global_stats().IncrementBusyPollSpinUs(
+        static_cast<int>(spun.count()));
+    if (r > 0) {
+      grpc_core::global_stats().IncrementBusyPollHits();
+    } else if (r == 0 && timeout_ms > 0) {
+      timeout_ms = std::max(
+          0, timeout_ms - static_cast<int>(spun.count() / GPR_US_PER_MS));
+    }
+  }
+  if (r == 0) {
+    do {
+      r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+                     timeout_ms);
+    } while (r < 0 && errno == EINTR);
+  }
   if (r < 0) {
     gpr_log(GPR_ERROR,
             "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s",
@@ -556,10 +589,10 @@ void Epoll1Poller::Kick() {
   GPR_ASSERT(wakeup_fd_->Wakeup().ok());
 }
 
-Epoll1Poller* MakeEpoll1Poller(Scheduler* scheduler) {
+Epoll1Poller* MakeEpoll1Poller(Scheduler* scheduler, int busy_poll_us) {
   static bool kEpoll1PollerSupported = InitEpoll1PollerLinux();
   if (kEpoll1PollerSupported) {
-    return new Epoll1Poller(scheduler);
+    return new Epoll1Poller(scheduler, busy_poll_us);
   }
   return nullptr;
 }
@@ -576,7 +609,7 @@ namespace posix_engine {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */, int /*busy_poll_us*/) {
   GPR_ASSERT(false && "unimplemented");
 }
 
@@ -608,7 +641,10 @@ void Epoll1Poller::Kick() { GPR_ASSERT(false && "unimplemented"); }
 
 // If GRPC_LINUX_EPOLL is not defined, it means epoll is not available. Return
 // nullptr.
-Epoll1Poller* MakeEpoll1Poller(Scheduler* /*scheduler*/) { return nullptr; }
+Epoll1Poller* MakeEpoll1Poller(Scheduler* /*scheduler*/,
+                               int /*busy_poll_us*/) {
+  return nullptr;
+}
 
 }  // namespace posix_engine
 }  // namespace grpc_event_engine
@@ -48,7 +48,9 @@ class Epoll1EventHandle;
 // Definition of epoll1 based poller.
 class Epoll1Poller : public PosixEventPoller {
  public:
-  explicit Epoll1Poller(Scheduler* scheduler);
+  // If busy_poll_us is positive, Work() spins on non-blocking epoll_wait
+  // calls for up to that many microseconds before it blocks.
+  Epoll1Poller(Scheduler* scheduler, int busy_poll_us);
   EventHandle* CreateHandle(int fd, absl::string_view name,
                             bool track_err) override;
   Poller::WorkResult Work(
@@ -112,6 +114,7 @@ class Epoll1Poller : public PosixEventPoller {
 #endif
   absl::Mutex mu_;
   Scheduler* scheduler_;
+  const int busy_poll_us_;
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
@@ -120,8 +123,8 @@ class Epoll1Poller : public PosixEventPoller {
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
-// engine.
-Epoll1Poller* MakeEpoll1Poller(Scheduler* scheduler);
+// engine. A positive busy_poll_us makes it spin that long before blocking.
+Epoll1Poller* MakeEpoll1Poller(Scheduler* scheduler, int busy_poll_us);
 
 }  // namespace posix_engine
 }  // namespace grpc_event_engine
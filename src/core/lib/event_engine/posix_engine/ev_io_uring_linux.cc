@@ -0,0 +1,652 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/iomgr/port.h"
+
+// This polling engine is only relevant on linux kernels supporting multishot
+// io_uring poll requests.
+#ifdef GRPC_LINUX_IO_URING
+#include <errno.h>
+#include <limits.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "absl/synchronization/mutex.h"
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/strerror.h"
+
+#define MAX_IO_URING_COMPLETIONS_HANDLED_PER_ITERATION 1
+
+// Completions with this tag carry no events (e.g. the result of a
+// IORING_OP_POLL_REMOVE request) and are dropped when reaping the ring.
+#define IO_URING_IGNORED_USER_DATA 0
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+using ::grpc_event_engine::posix_engine::LockfreeEvent;
+using ::grpc_event_engine::posix_engine::WakeupFd;
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        track_err_(track_err),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    track_err_ = track_err;
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+    absl::MutexLock lock(&mu_);
+    orphaned_ = false;
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  // Use the least significant bit of the request's user_data to store
+  // track_err, like the epoll1 poller does with epoll_event::data.
+  uint64_t UserData() const {
+    return static_cast<uint64_t>(reinterpret_cast<intptr_t>(this) |
+                                 (track_err_ ? 1 : 0));
+  }
+  // Arms the multishot poll request that watches this handle's fd.
+  void ArmPoll() {
+    absl::MutexLock lock(&mu_);
+    poll_armed_ = true;
+    poller_->SubmitPollAdd(fd_, UserData());
+  }
+  // Called by the poller for every completion of this handle's poll request.
+  // Returns false if the events carried by the completion must be dropped
+  // because the handle was orphaned. If the request will not generate any
+  // more completions, re-arms it or, for orphaned handles, sets *release so
+  // that the poller returns the handle to its free list.
+  bool OnPollCompletion(bool more, bool* release) {
+    absl::MutexLock lock(&mu_);
+    *release = false;
+    if (!more) {
+      poll_armed_ = false;
+      if (orphaned_) {
+        *release = true;
+      } else {
+        // The kernel ended the multishot request (for instance because the
+        // completion ring overflowed): keep watching the fd.
+        poll_armed_ = true;
+        poller_->SubmitPollAdd(fd_, UserData());
+      }
+    }
+    return !orphaned_;
+  }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions: Work(...) may be running the
+    // pending actions found by a previous instantiation in parallel.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    // These may execute in Parallel with ShutdownHandle. Thats not an issue
+    // because the lockfree event implementation should be able to handle it.
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why, bool releasing_fd)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Guards shutdown against OrphanHandle (see Epoll1Poller::ShutdownHandle),
+  // and the poll request state below.
+  absl::Mutex mu_;
+  int fd_;
+  bool track_err_;
+  // Whether the kernel may still post completions for this handle's poll
+  // request. A handle is only reused once its request has ended, so that the
+  // completions of an old request can never be mistaken for those of a new
+  // one.
+  bool poll_armed_ ABSL_GUARDED_BY(mu_) = false;
+  bool orphaned_ ABSL_GUARDED_BY(mu_) = false;
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+namespace {
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+// Number of submission ring entries. Requests are submitted as soon as they
+// are queued, so this only needs to cover concurrent submitters.
+constexpr unsigned kSubmissionRingEntries = 256;
+// Number of completion ring entries: one per watched fd that may become ready
+// between two calls to Work(...). The kernel buffers completions beyond this
+// (IORING_FEAT_NODROP), so this is only a performance knob.
+constexpr unsigned kCompletionRingEntries = 16384;
+constexpr uint32_t kRequiredFeatures =
+    IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG |
+    // Multishot poll requests were added to the same kernel release (5.13)
+    // as resource tags, which is the closest feature that can be detected
+    // without submitting a request.
+    IORING_FEAT_RSRC_TAGS;
+
+int IoUringCreate(io_uring_params* params) {
+  memset(params, 0, sizeof(*params));
+  params->flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params->cq_entries = kCompletionRingEntries;
+  int fd = IoUringSetup(kSubmissionRingEntries, params);
+  if (fd < 0) {
+    gpr_log(GPR_ERROR, "io_uring_setup unavailable: %s",
+            grpc_core::StrError(errno).c_str());
+    return -1;
+  }
+  if ((params->features & kRequiredFeatures) != kRequiredFeatures) {
+    gpr_log(GPR_ERROR, "io_uring lacks the features needed for polling");
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// It is possible that the headers know about io_uring but the underlying
+// kernel doesn't, or that io_uring is disabled (e.g. by seccomp or the
+// kernel.io_uring_disabled sysctl). Create a ring to make sure it is usable.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::posix_engine::SupportsWakeupFd()) {
+    return false;
+  }
+  io_uring_params params;
+  int fd = IoUringCreate(&params);
+  if (fd < 0) {
+    return false;
+  }
+  close(fd);
+  return true;
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  bool is_release_fd = (release_fd != nullptr);
+  bool release_now;
+  {
+    absl::MutexLock lock(&mu_);
+    if (!read_closure_->IsShutdown()) {
+      HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason),
+                             is_release_fd);
+    }
+    // Unlike epoll, io_uring poll requests hold a reference to the file, so
+    // they must be cancelled explicitly whether or not the fd gets closed.
+    if (poll_armed_) {
+      poller_->SubmitPollRemove(UserData());
+    }
+    orphaned_ = true;
+    release_now = !poll_armed_;
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (is_release_fd) {
+    *release_fd = fd_;
+  } else {
+    close(fd_);
+  }
+
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  if (release_now) {
+    absl::MutexLock lock(&poller_->mu_);
+    poller_->free_io_uring_handles_list_.push_back(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+// if 'releasing_fd' is true, it means that we are going to detach the internal
+// fd from grpc_fd structure (i.e which means we should not be calling
+// shutdown() syscall on that fd)
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why,
+                                                bool releasing_fd) {
+  if (read_closure_->SetShutdown(why)) {
+    if (!releasing_fd) {
+      shutdown(fd_, SHUT_RDWR);
+    }
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false) {
+  io_uring_params params;
+  ring_.fd = IoUringCreate(&params);
+  GPR_ASSERT(ring_.fd >= 0);
+  ring_.ring_len =
+      std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+               params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+  ring_.ring_ptr =
+      mmap(nullptr, ring_.ring_len, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQ_RING);
+  GPR_ASSERT(ring_.ring_ptr != MAP_FAILED);
+  ring_.sqes_len = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = mmap(nullptr, ring_.sqes_len, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQES);
+  GPR_ASSERT(sqes != MAP_FAILED);
+  ring_.sqes = static_cast<io_uring_sqe*>(sqes);
+  char* ring = static_cast<char*>(ring_.ring_ptr);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(ring + params.sq_off.tail);
+  ring_.sq_array = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+  ring_.sq_mask = *reinterpret_cast<unsigned*>(ring + params.sq_off.ring_mask);
+  ring_.cq_head = reinterpret_cast<unsigned*>(ring + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(ring + params.cq_off.tail);
+  ring_.cqes = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+  ring_.cq_mask = *reinterpret_cast<unsigned*>(ring + params.cq_off.ring_mask);
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", ring_.fd);
+  wakeup_fd_ = *CreateWakeupFd();
+  GPR_ASSERT(wakeup_fd_ != nullptr);
+  SubmitPollAdd(wakeup_fd_->ReadFd(),
+                static_cast<uint64_t>(
+                    reinterpret_cast<intptr_t>(wakeup_fd_.get())));
+}
+
+void IoUringPoller::Shutdown() { delete this; }
+
+IoUringPoller::~IoUringPoller() {
+  // Closing the ring cancels all outstanding poll requests.
+  if (ring_.fd >= 0) {
+    munmap(ring_.sqes, ring_.sqes_len);
+    munmap(ring_.ring_ptr, ring_.ring_len);
+    close(ring_.fd);
+    ring_.fd = -1;
+  }
+  {
+    absl::MutexLock lock(&mu_);
+    for (EventHandle* handle : all_io_uring_handles_) {
+      delete reinterpret_cast<IoUringEventHandle*>(handle);
+    }
+    all_io_uring_handles_.clear();
+    free_io_uring_handles_list_.clear();
+  }
+}
+
+void IoUringPoller::SubmitPollAdd(int fd, uint64_t user_data) {
+  absl::MutexLock lock(&sq_mu_);
+  unsigned tail = *ring_.sq_tail;
+  unsigned index = tail & ring_.sq_mask;
+  io_uring_sqe* sqe = &ring_.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  // EPOLLET makes the multishot request edge triggered, matching the
+  // semantics the lockfree events expect from epoll1.
+  sqe->poll32_events = static_cast<uint32_t>(EPOLLIN | EPOLLOUT | EPOLLET);
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = user_data;
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, 1, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    gpr_log(GPR_ERROR, "io_uring_enter failed: %s",
+            grpc_core::StrError(errno).c_str());
+  }
+}
+
+void IoUringPoller::SubmitPollRemove(uint64_t user_data) {
+  absl::MutexLock lock(&sq_mu_);
+  unsigned tail = *ring_.sq_tail;
+  unsigned index = tail & ring_.sq_mask;
+  io_uring_sqe* sqe = &ring_.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = IO_URING_IGNORED_USER_DATA;
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, 1, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    gpr_log(GPR_ERROR, "io_uring_enter failed: %s",
+            grpc_core::StrError(errno).c_str());
+  }
+}
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    absl::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, track_err, this);
+      all_io_uring_handles_.push_back(new_handle);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+  }
+  new_handle->ArmPoll();
+  return new_handle;
+}
+
+// Process the completions found by DoIoUringWait() function.
+// - cursor_ points to the index of the first completion to be processed
+// - This function then processes up-to max_completions_to_handle and
+//   updates cursor_.
+// It returns true, it there was a Kick that forced invocation of this
+// function. It also returns the list of handles whose pending actions need
+// to be executed.
+bool IoUringPoller::ProcessCompletions(int max_completions_to_handle,
+                                       Events& pending_events) {
+  int num_completions = num_completions_;
+  int cursor = cursor_;
+  bool was_kicked = false;
+  for (int idx = 0;
+       (idx < max_completions_to_handle) && cursor != num_completions; idx++) {
+    int c = cursor++;
+    const Completion& completion = completions_[c];
+    bool more = (completion.flags & IORING_CQE_F_MORE) != 0;
+    if (completion.user_data ==
+        static_cast<uint64_t>(reinterpret_cast<intptr_t>(wakeup_fd_.get()))) {
+      if (completion.res >= 0) {
+        GPR_ASSERT(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (!more) {
+        SubmitPollAdd(wakeup_fd_->ReadFd(), completion.user_data);
+      }
+      continue;
+    }
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<intptr_t>(completion.user_data) &
+        ~static_cast<intptr_t>(1));
+    bool track_err = static_cast<intptr_t>(completion.user_data) &
+                     static_cast<intptr_t>(1);
+    bool release = false;
+    bool deliver = handle->OnPollCompletion(more, &release);
+    if (release) {
+      free_io_uring_handles_list_.push_back(handle);
+    }
+    if (!deliver || completion.res < 0) {
+      // Negative results report why the request ended (e.g. -ECANCELED).
+      continue;
+    }
+    uint32_t events = static_cast<uint32_t>(completion.res);
+    bool cancel = (events & EPOLLHUP) != 0;
+    bool error = (events & EPOLLERR) != 0;
+    bool read_ev = (events & (EPOLLIN | EPOLLPRI)) != 0;
+    bool write_ev = (events & EPOLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+  }
+  cursor_ = cursor;
+  return was_kicked;
+}
+
+int IoUringPoller::ReapCompletions() {
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  int n = 0;
+  while (head != tail && n < MAX_IO_URING_COMPLETIONS) {
+    const io_uring_cqe* cqe = &ring_.cqes[head & ring_.cq_mask];
+    if (cqe->user_data != IO_URING_IGNORED_USER_DATA) {
+      completions_[n].user_data = cqe->user_data;
+      completions_[n].res = cqe->res;
+      completions_[n].flags = cqe->flags;
+      ++n;
+    }
+    ++head;
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  return n;
+}
+
+int IoUringPoller::DoIoUringWait(EventEngine::Duration timeout) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  int n = ReapCompletions();
+  while (n == 0) {
+    auto remaining = std::max(
+        std::chrono::steady_clock::duration::zero(),
+        deadline - std::chrono::steady_clock::now());
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+    auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        remaining - seconds);
+    __kernel_timespec ts;
+    ts.tv_sec = seconds.count();
+    ts.tv_nsec = nanos.count();
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ts));
+    int r = IoUringEnter(ring_.fd, 0, 1,
+                         IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                         sizeof(arg));
+    if (r < 0 && errno != EINTR && errno != ETIME) {
+      gpr_log(GPR_ERROR,
+              "(event_engine) IoUringPoller:%p encountered io_uring_enter "
+              "error: %s",
+              this, grpc_core::StrError(errno).c_str());
+      GPR_ASSERT(false);
+    }
+    n = ReapCompletions();
+    if (r < 0 && errno == ETIME) {
+      break;
+    }
+  }
+  num_completions_ = n;
+  cursor_ = 0;
+  return n;
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  absl::MutexLock lock(&mu_);
+  HandleShutdownInternal(why, false);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  if (cursor_ == num_completions_) {
+    if (DoIoUringWait(timeout) == 0) {
+      return Poller::WorkResult::kDeadlineExceeded;
+    }
+  }
+  {
+    absl::MutexLock lock(&mu_);
+    // If was_kicked_ is true, collect all pending events in this iteration.
+    if (ProcessCompletions(
+            was_kicked_ ? INT_MAX
+                        : MAX_IO_URING_COMPLETIONS_HANDLED_PER_ITERATION,
+            pending_events)) {
+      was_kicked_ = false;
+    }
+    if (pending_events.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  absl::MutexLock lock(&mu_);
+  if (was_kicked_) {
+    return;
+  }
+  was_kicked_ = true;
+  GPR_ASSERT(wakeup_fd_->Wakeup().ok());
+}
+
+IoUringPoller* MakeIoUringPoller(Scheduler* scheduler) {
+  // Fork support is only implemented by the epoll1 and poll pollers.
+  if (grpc_core::Fork::Enabled()) {
+    return nullptr;
+  }
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return new IoUringPoller(scheduler);
+  }
+  return nullptr;
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#else /* defined(GRPC_LINUX_IO_URING) */
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+// If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+// Return nullptr.
+IoUringPoller* MakeIoUringPoller(Scheduler* /*scheduler*/) { return nullptr; }
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif /* !defined(GRPC_LINUX_IO_URING) */
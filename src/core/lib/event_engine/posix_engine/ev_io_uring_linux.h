@@ -0,0 +1,152 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+
+#define MAX_IO_URING_COMPLETIONS 100
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller. Every handle is watched by a
+// multishot, edge triggered IORING_OP_POLL_ADD request, so readiness is
+// delivered through the completion ring without any epoll_ctl or epoll_wait
+// syscalls, and a single io_uring_enter both waits for and returns a batch of
+// events.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+ private:
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  friend class IoUringEventHandle;
+
+  // The parts of a completion queue entry that are needed once the entry has
+  // been handed back to the kernel.
+  struct Completion {
+    uint64_t user_data;
+    int32_t res;
+    uint32_t flags;
+  };
+
+  // The mmap'd submission and completion rings shared with the kernel.
+  struct Ring {
+    int fd = -1;
+    void* ring_ptr = nullptr;
+    size_t ring_len = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqes_len = 0;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned sq_mask = 0;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned cq_mask = 0;
+  };
+
+  // Arms a multishot poll request for fd, tagged with user_data.
+  void SubmitPollAdd(int fd, uint64_t user_data) ABSL_LOCKS_EXCLUDED(sq_mu_);
+  // Cancels the poll request tagged with user_data.
+  void SubmitPollRemove(uint64_t user_data) ABSL_LOCKS_EXCLUDED(sq_mu_);
+  // Process the completions found by DoIoUringWait() function.
+  // - cursor_ points to the index of the first completion to be processed
+  // - This function then processes up-to max_completions_to_handle and
+  //   updates cursor_.
+  // It returns true, it there was a Kick that forced invocation of this
+  // function. It also returns the list of handles whose pending actions need
+  // to be executed.
+  bool ProcessCompletions(int max_completions_to_handle,
+                          Events& pending_events);
+  // Waits until the completion ring holds at least one entry that refers to
+  // a handle or to the wakeup fd, or until timeout expires, and copies the
+  // entries into completions_. Returns the number of entries copied.
+  int DoIoUringWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Copies the available completion ring entries into completions_, skipping
+  // entries that carry no events.
+  int ReapCompletions();
+
+  absl::Mutex mu_;
+  // Serializes access to the tail of the submission ring.
+  absl::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  Ring ring_;
+  Completion completions_[MAX_IO_URING_COMPLETIONS];
+  int num_completions_ = 0;
+  int cursor_ = 0;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // Handles whose poll request has ended and that may be reused.
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Every handle created by this poller, deleted with it.
+  std::vector<EventHandle*> all_io_uring_handles_ ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified event
+// engine, or nullptr if the running kernel does not support the io_uring
+// features it needs.
+IoUringPoller* MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
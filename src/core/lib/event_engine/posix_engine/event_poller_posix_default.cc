@@ -18,14 +18,17 @@
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/port.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 GPR_GLOBAL_CONFIG_DECLARE_STRING(grpc_poll_strategy);
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_epoll_busy_poll_us);
 #endif
 
 namespace grpc_event_engine {
@@ -48,7 +51,15 @@ PosixEventPoller* MakeDefaultPoller(Scheduler* scheduler) {
   for (auto it = strings.begin(); it != strings.end() && poller == nullptr;
        it++) {
     if (PollStrategyMatches(*it, "epoll1")) {
-      poller = MakeEpoll1Poller(scheduler);
+      // The io_uring poller is a drop-in replacement for epoll1 on kernels
+      // that support it.
+      if (grpc_core::IsEventEngineIoUringPollerEnabled()) {
+        poller = MakeIoUringPoller(scheduler);
+      }
+      if (poller == nullptr) {
+        poller = MakeEpoll1Poller(
+            scheduler, GPR_GLOBAL_CONFIG_GET(grpc_epoll_busy_poll_us));
+      }
     }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
       // If epoll1 fails and if poll strategy matches "poll", use Poll poller
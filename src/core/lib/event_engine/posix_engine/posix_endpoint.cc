@@ -37,6 +37,8 @@
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
@@ -102,6 +104,7 @@ ssize_t TcpSend(int fd, const struct msghdr* msg, int* saved_errno,
                 int additional_flags = 0) {
   ssize_t sent_length;
   do {
+    grpc_core::global_stats().IncrementSyscallWrite();
     sent_length = sendmsg(fd, msg, SENDMSG_FLAGS | additional_flags);
   } while (sent_length < 0 && (*saved_errno = errno) == EINTR);
   return sent_length;
@@ -312,6 +315,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     msg.msg_flags = 0;
 
     do {
+      grpc_core::global_stats().IncrementSyscallRead();
       read_bytes = recvmsg(fd_, &msg, 0);
     } while (read_bytes < 0 && errno == EINTR);
 
@@ -323,6 +327,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
       }
       FinishEstimate();
       inq_ = 0;
+      ReleaseIdleReadSlices();
       return false;
     }
 
@@ -492,6 +497,14 @@ void PosixEndpointImpl::UpdateRcvLowat() {
   }
 }
 
+void PosixEndpointImpl::ReleaseIdleReadSlices() {
+  // MaybeMakeReadSlices() allocates the space again once the socket is
+  // readable. Bytes already read are kept in last_read_buffer_.
+  if (grpc_core::IsTcpReleaseIdleReadBuffersEnabled()) {
+    incoming_buffer_->Clear();
+  }
+}
+
 void PosixEndpointImpl::MaybeMakeReadSlices() {
   if (grpc_core::IsTcpReadChunksEnabled()) {
     static const int kBigAlloc = 64 * 1024;
@@ -576,6 +589,7 @@ void PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
   incoming_buffer_ = buffer;
   incoming_buffer_->Clear();
   incoming_buffer_->Swap(last_read_buffer_);
+  if (inq_ == 0) ReleaseIdleReadSlices();
   read_mu_.Unlock();
   if (args != nullptr && grpc_core::IsTcpFrameSizeTuningEnabled()) {
     min_progress_size_ = args->read_hint_bytes;
@@ -1074,6 +1088,68 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   }
 }
 
+void PosixEndpointImpl::CoalesceWrite(WriteCoalescer* coalescer) {
+  struct msghdr& msg = coalesced_write_->msg;
+  msg_iovlen_type iov_size;
+  for (iov_size = 0; iov_size != outgoing_buffer_->Count() &&
+                     iov_size != CoalescedWrite::kMaxIovecs;
+       iov_size++) {
+    auto slice = outgoing_buffer_->RefSlice(iov_size);
+    coalesced_write_->iov[iov_size].iov_base =
+        const_cast<uint8_t*>(slice.begin());
+    coalesced_write_->iov[iov_size].iov_len = slice.length();
+  }
+  msg.msg_name = nullptr;
+  msg.msg_namelen = 0;
+  msg.msg_iov = coalesced_write_->iov;
+  msg.msg_iovlen = iov_size;
+  msg.msg_control = nullptr;
+  msg.msg_controllen = 0;
+  msg.msg_flags = 0;
+  coalescer->Add(fd_, &msg, [this](ssize_t sent_length, int saved_errno) {
+    FinishCoalescedWrite(sent_length, saved_errno);
+  });
+}
+
+void PosixEndpointImpl::FinishCoalescedWrite(ssize_t sent_length,
+                                             int saved_errno) {
+  absl::Status status = absl::OkStatus();
+  bool flush_result;
+  if (sent_length < 0) {
+    if (saved_errno == EAGAIN || saved_errno == ENOBUFS) {
+      flush_result = false;
+    } else {
+      status = absl::InternalError(
+          absl::StrCat("sendmsg", std::strerror(saved_errno)));
+      outgoing_buffer_->Clear();
+      flush_result = true;
+    }
+  } else {
+    bytes_counter_ += sent_length;
+    // Drop what was sent, then let TcpFlush send the rest, if any.
+    size_t sent = static_cast<size_t>(sent_length);
+    while (sent > 0) {
+      size_t slice_length = outgoing_buffer_->RefSlice(0).length();
+      if (slice_length > sent) {
+        outgoing_byte_idx_ = sent;
+        break;
+      }
+      sent -= slice_length;
+      outgoing_buffer_->TakeFirst();
+    }
+    flush_result = outgoing_buffer_->Count() == 0 || TcpFlush(status);
+  }
+  if (!flush_result) {
+    GPR_DEBUG_ASSERT(status.ok());
+    handle_->NotifyOnWrite(on_write_);
+  } else {
+    absl::AnyInvocable<void(absl::Status)> cb_ = std::move(write_cb_);
+    write_cb_ = nullptr;
+    cb_(status);
+    Unref();
+  }
+}
+
 void PosixEndpointImpl::HandleWrite(absl::Status status) {
   if (!status.ok()) {
     absl::AnyInvocable<void(absl::Status)> cb_ = std::move(write_cb_);
@@ -1131,6 +1207,16 @@ void PosixEndpointImpl::Write(
     GPR_ASSERT(poller_->CanTrackErrors());
   }
 
+  // Writes that need timestamps or zerocopy are not coalesced.
+  WriteCoalescer* coalescer = WriteCoalescer::Current();
+  if (coalesced_write_ != nullptr && coalescer != nullptr &&
+      zerocopy_send_record == nullptr && outgoing_buffer_arg_ == nullptr) {
+    Ref().release();
+    write_cb_ = std::move(on_writable);
+    CoalesceWrite(coalescer);
+    return;
+  }
+
   bool flush_result = zerocopy_send_record != nullptr
                           ? TcpFlushZerocopy(zerocopy_send_record, status)
                           : TcpFlush(status);
@@ -1219,6 +1305,9 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
       options.tcp_tx_zerocopy_send_bytes_threshold);
+  if (options.tcp_write_coalescing_enabled) {
+    coalesced_write_ = std::make_unique<CoalescedWrite>();
+  }
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
@@ -42,6 +42,7 @@
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
+#include "src/core/lib/event_engine/posix_engine/write_coalescer.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/port.h"
@@ -496,6 +497,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   void HandleError(absl::Status status);
   void HandleRead(absl::Status status);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Frees the space allocated for a read that is about to wait for the
+  // socket to become readable.
+  void ReleaseIdleReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
@@ -507,6 +511,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool DoFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlush(absl::Status& status);
+  // Hands the start of outgoing_buffer_ to coalescer, which sends it when the
+  // active WriteCoalescer::Scope ends.
+  void CoalesceWrite(WriteCoalescer* coalescer);
+  void FinishCoalescedWrite(ssize_t sent_length, int saved_errno);
   void TcpShutdownTracedBufferList();
   void UnrefMaybePutZerocopySendRecord(TcpZerocopySendRecord* record);
   void ZerocopyDisableAndWaitForRemaining();
@@ -576,6 +584,15 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   std::atomic<bool> stop_error_notification_{false};
   std::unique_ptr<TcpZerocopySendCtx> tcp_zerocopy_send_ctx_;
   TcpZerocopySendRecord* current_zerocopy_send_ = nullptr;
+  // The message handed to the write coalescer. It only covers the first few
+  // slices of a write: TcpFlush sends whatever the batch did not. Only
+  // allocated if write coalescing is enabled.
+  struct CoalescedWrite {
+    static constexpr int kMaxIovecs = 16;
+    struct msghdr msg;
+    struct iovec iov[kMaxIovecs];
+  };
+  std::unique_ptr<CoalescedWrite> coalesced_write_;
   // A hint from upper layers specifying the minimum number of bytes that need
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
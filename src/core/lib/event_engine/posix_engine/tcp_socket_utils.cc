@@ -122,6 +122,7 @@ absl::Status PrepareTcpClientSocket(PosixSocketWrapper sock,
     GRPC_RETURN_IF_ERROR(sock.SetSocketLowLatency(1));
     GRPC_RETURN_IF_ERROR(sock.SetSocketReuseAddr(1));
     sock.TrySetSocketTcpUserTimeout(options, true);
+    sock.TrySetSocketBusyPoll(options);
   }
   GRPC_RETURN_IF_ERROR(sock.SetSocketNoSigpipeIfPossible());
   GRPC_RETURN_IF_ERROR(sock.ApplySocketMutatorInOptions(
@@ -158,6 +159,9 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_write_coalescing_enabled =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_WRITE_COALESCING_ENABLED)) != 0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -168,6 +172,8 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.allow_reuse_port =
       (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
        0);
+  options.busy_poll_us =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_US));
 
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
@@ -680,6 +686,33 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   }
 }
 
+// Set SO_BUSY_POLL, and SO_PREFER_BUSY_POLL where the kernel has it
+void PosixSocketWrapper::TrySetSocketBusyPoll(const PosixTcpOptions& options) {
+  if (options.busy_poll_us <= 0) {
+    return;
+  }
+#if GPR_LINUX == 1 && defined(SO_BUSY_POLL)
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &options.busy_poll_us,
+                      sizeof(options.busy_poll_us))) {
+    // Do not fail on failing to set SO_BUSY_POLL
+    gpr_log(GPR_ERROR, "setsockopt(SO_BUSY_POLL) %s",
+            grpc_core::StrError(errno).c_str());
+    return;
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  // Preferring busy polling needs CAP_NET_ADMIN; SO_BUSY_POLL works without it.
+  const int prefer = 1;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                      sizeof(prefer))) {
+    gpr_log(GPR_DEBUG, "setsockopt(SO_PREFER_BUSY_POLL) %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+#else
+  gpr_log(GPR_ERROR, "SO_BUSY_POLL unavailable on compiling system");
+#endif
+}
+
 // Set a socket using a grpc_socket_mutator
 absl::Status PosixSocketWrapper::SetSocketMutator(
     grpc_fd_usage usage, grpc_socket_mutator* mutator) {
@@ -898,6 +931,11 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   GPR_ASSERT(false && "unimplemented");
 }
 
+void PosixSocketWrapper::TrySetSocketBusyPoll(
+    const PosixTcpOptions& /*options*/) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketNoSigpipeIfPossible() {
   GPR_ASSERT(false && "unimplemented");
 }
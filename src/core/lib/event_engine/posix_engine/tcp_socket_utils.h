@@ -66,10 +66,12 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_send_bytes_threshold = kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_write_coalescing_enabled = false;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int busy_poll_us = 0;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   PosixTcpOptions() = default;
@@ -130,10 +132,12 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_write_coalescing_enabled = other.tcp_write_coalescing_enabled;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    busy_poll_us = other.busy_poll_us;
   }
 };
 
@@ -204,6 +208,10 @@ class PosixSocketWrapper {
   void TrySetSocketTcpUserTimeout(const PosixTcpOptions& options,
                                   bool is_client);
 
+  // Set SO_BUSY_POLL (and SO_PREFER_BUSY_POLL) if options.busy_poll_us is
+  // positive. Failures are logged, not returned.
+  void TrySetSocketBusyPoll(const PosixTcpOptions& options);
+
   // Tries to set SO_NOSIGPIPE if available on this platform.
   // If SO_NO_SIGPIPE is not available, returns not OK status.
   absl::Status SetSocketNoSigpipeIfPossible();
@@ -20,6 +20,7 @@
 
 #include "src/core/lib/event_engine/posix_engine/timer_manager.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -31,6 +32,9 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/thd.h"
 
 static thread_local bool g_timer_thread;
@@ -200,9 +204,24 @@ void TimerManager::Run() {
 bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager() : host_(this) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  if (grpc_core::IsEventEngineTimerWheelEnabled()) {
+    timer_list_ = std::make_unique<TimerWheel>(&host_);
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
+}
+
+void TimerManager::EnsureThreadStarted() {
+  if (thread_started_.load(std::memory_order_acquire)) return;
   grpc_core::MutexLock lock(&mu_);
-  StartThread();
+  if (thread_started_.load(std::memory_order_relaxed) || shutdown_) return;
+  thread_started_.store(true, std::memory_order_release);
+  if (forking_) {
+    // Have the thread started once the fork is over.
+    prefork_thread_count_ = std::max(prefork_thread_count_, 1);
+  } else {
+    StartThread();
+  }
 }
 
 grpc_core::Timestamp TimerManager::Host::Now() {
@@ -212,6 +231,7 @@ grpc_core::Timestamp TimerManager::Host::Now() {
 
 void TimerManager::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
                              experimental::EventEngine::Closure* closure) {
+  EnsureThreadStarted();
   timer_list_->TimerInit(timer, deadline, closure);
 }
 
@@ -270,9 +290,9 @@ void TimerManager::PostforkParent() {
 
 void TimerManager::PostforkChild() {
   grpc_core::MutexLock lock(&mu_);
-  for (int i = 0; i < prefork_thread_count_; i++) {
-    StartThread();
-  }
+  // One thread is enough to run timers set before the fork; more are started
+  // as they are needed.
+  if (prefork_thread_count_ > 0) StartThread();
   prefork_thread_count_ = 0;
   forking_ = false;
 }
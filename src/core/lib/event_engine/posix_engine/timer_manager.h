@@ -24,6 +24,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -42,6 +43,8 @@ namespace posix_engine {
 
 // Timer Manager tries to keep only one thread waiting for the next timeout at
 // all times, and thus effectively preventing the thundering herd problem.
+// Its first thread is started when the first timer is set, so that processes
+// that fork before using timers have no threads to stop.
 // TODO(ctiller): consider unifying this thread pool and the one in
 // thread_pool.{h,cc}.
 class TimerManager final : public grpc_event_engine::experimental::Forkable {
@@ -81,6 +84,8 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   };
 
   void StartThread() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Starts the first thread, unless it has been started already.
+  void EnsureThreadStarted() ABSL_LOCKS_EXCLUDED(mu_);
   static void RunThread(void* arg);
   void Run();
   void MainLoop();
@@ -130,8 +135,11 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   // number of timer wakeups
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = 0;
   // actual timer implementation
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   int prefork_thread_count_ = 0;
+  // Whether a thread has been started; only false before the first timer is
+  // set.
+  std::atomic<bool> thread_started_{false};
 };
 
 }  // namespace posix_engine
@@ -0,0 +1,232 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <grpc/support/cpu.h>
+
+#include "src/core/lib/gpr/useful.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+namespace {
+
+constexpr int64_t kNoEvent = std::numeric_limits<int64_t>::max();
+constexpr size_t kSlotMask = TimerWheel::kSlotsPerLevel - 1;
+constexpr size_t kOverflowSlot =
+    TimerWheel::kNumLevels * TimerWheel::kSlotsPerLevel;
+
+size_t SlotLevel(size_t slot) {
+  return slot == kOverflowSlot ? TimerWheel::kNumLevels
+                               : slot / TimerWheel::kSlotsPerLevel;
+}
+
+size_t SlotDigit(int64_t tick, int level) {
+  return static_cast<size_t>(tick >> (TimerWheel::kBitsPerLevel * level)) &
+         kSlotMask;
+}
+
+}  // namespace
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(kNoEvent),
+      shards_(new Shard[num_shards_]) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  for (size_t i = 0; i < num_shards_; i++) {
+    grpc_core::MutexLock lock(&shards_[i].mu);
+    shards_[i].current = now;
+    shards_[i].next_event = kNoEvent;
+  }
+}
+
+void TimerWheel::Shard::Insert(Timer* timer) {
+  const int64_t deadline = std::max(timer->deadline, current);
+  const uint64_t diff =
+      static_cast<uint64_t>(deadline) ^ static_cast<uint64_t>(current);
+  size_t slot = kOverflowSlot;
+  if ((diff >> (kBitsPerLevel * kNumLevels)) == 0) {
+    int level = kNumLevels - 1;
+    while (level > 0 && (diff >> (kBitsPerLevel * level)) == 0) --level;
+    slot = level * kSlotsPerLevel + SlotDigit(deadline, level);
+  }
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = slots[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots[slot] = timer;
+  ++level_count[SlotLevel(slot)];
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots[timer->heap_index] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  --level_count[SlotLevel(timer->heap_index)];
+}
+
+void TimerWheel::Shard::Cascade() {
+  auto refile = [this](size_t slot) {
+    Timer* timer = slots[slot];
+    slots[slot] = nullptr;
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      --level_count[SlotLevel(slot)];
+      Insert(timer);
+      timer = next;
+    }
+  };
+  for (int level = 1; level < kNumLevels; ++level) {
+    const size_t digit = SlotDigit(current, level);
+    refile(level * kSlotsPerLevel + digit);
+    if (digit != 0) return;
+  }
+  refile(kOverflowSlot);
+}
+
+void TimerWheel::Shard::Advance(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  while (current <= now) {
+    if (SlotDigit(current, 0) == 0) Cascade();
+    const size_t slot = SlotDigit(current, 0);
+    Timer* timer = slots[slot];
+    slots[slot] = nullptr;
+    while (timer != nullptr) {
+      timer->pending = false;
+      --level_count[0];
+      out->push_back(timer->closure);
+      timer = timer->next;
+    }
+    // Skip the ticks that cannot have timers: with nothing on the lowest
+    // levels, the next work is at the next slot of the lowest level in use.
+    int level = 0;
+    while (level <= kNumLevels && level_count[level] == 0) ++level;
+    if (level == 0) {
+      ++current;
+    } else if (level > kNumLevels) {
+      current = now + 1;
+    } else {
+      const int shift = kBitsPerLevel * level;
+      current = std::min(((current >> shift) + 1) << shift, now + 1);
+    }
+  }
+}
+
+int64_t TimerWheel::Shard::NextEventTick() const {
+  for (int level = 0; level <= kNumLevels; ++level) {
+    if (level_count[level] == 0) continue;
+    if (level == kNumLevels) {
+      const int shift = kBitsPerLevel * kNumLevels;
+      return ((current >> shift) + 1) << shift;
+    }
+    // Timers on this level have a digit at it above current's, or equal to
+    // it on level 0.
+    const int shift = kBitsPerLevel * level;
+    for (size_t digit = SlotDigit(current, level); digit < kSlotsPerLevel;
+         ++digit) {
+      if (slots[level * kSlotsPerLevel + digit] != nullptr) {
+        return std::max(
+            current, ((current >> (shift + kBitsPerLevel))
+                          << (shift + kBitsPerLevel)) |
+                         static_cast<int64_t>(digit << shift));
+      }
+    }
+  }
+  return kNoEvent;
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+  bool is_first_timer = false;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    shard->Insert(timer);
+    if (timer->deadline < shard->next_event) {
+      shard->next_event = std::max(timer->deadline, shard->current);
+      is_first_timer = true;
+    }
+  }
+  // As in TimerList, a TimerCheck holds mu_ from before it runs the first
+  // shard until after it publishes min_timer_, so either it saw this timer or
+  // this lowers what it published.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (timer->deadline < min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(timer->deadline, std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard->Remove(timer);
+  return true;
+}
+
+absl::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  const grpc_core::Timestamp now = host_->Now();
+  const int64_t now_ms = now.milliseconds_after_process_epoch();
+  int64_t min_timer = min_timer_.load(std::memory_order_relaxed);
+  std::vector<experimental::EventEngine::Closure*> done;
+  if (now_ms >= min_timer) {
+    if (!checker_mu_.TryLock()) return absl::nullopt;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      min_timer = kNoEvent;
+      for (size_t i = 0; i < num_shards_; i++) {
+        Shard& shard = shards_[i];
+        grpc_core::MutexLock shard_lock(&shard.mu);
+        if (shard.next_event <= now_ms) {
+          shard.Advance(now_ms, &done);
+          shard.next_event = shard.NextEventTick();
+        }
+        min_timer = std::min(min_timer, shard.next_event);
+      }
+      min_timer_.store(min_timer, std::memory_order_relaxed);
+    }
+    checker_mu_.Unlock();
+  }
+  if (next != nullptr && min_timer != kNoEvent) {
+    *next = std::min(
+        *next, grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                   min_timer));
+  }
+  return std::move(done);
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
@@ -0,0 +1,113 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+// A hierarchical timing wheel with millisecond ticks.
+//
+// Each shard has kNumLevels wheels of kSlotsPerLevel slots. A timer is filed
+// on the level of the highest base-kSlotsPerLevel digit in which its deadline
+// differs from the shard's current tick, in the slot for that digit of its
+// deadline. When the current tick reaches the start of a slot on a higher
+// level, the slot's timers are filed again, onto lower levels. Deadlines too
+// far away for the wheels wait on an overflow list.
+//
+// Unlike TimerList, adding and cancelling a timer are O(1): no heap needs to
+// be kept in order, which matters when most timers are deadlines that get
+// cancelled long before they fire. The price is paid by TimerCheck, which
+// walks the elapsed ticks of every shard holding timers that are close.
+class TimerWheel final : public TimerListInterface {
+ public:
+  static constexpr int kBitsPerLevel = 8;
+  static constexpr size_t kSlotsPerLevel = 1 << kBitsPerLevel;
+  static constexpr int kNumLevels = 4;
+
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  bool TimerCancel(Timer* timer) override;
+  absl::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  struct Shard {
+    // Files timer in the slot for its deadline.
+    void Insert(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Runs the ticks up to and including now, appending the closures of the
+    // timers that expired to out.
+    void Advance(int64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Files the timers of the higher level slots starting at current again.
+    void Cascade() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns a tick no later than the next one at which Advance has work to
+    // do, or max() if the shard is empty.
+    int64_t NextEventTick() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The next tick to run.
+    int64_t current ABSL_GUARDED_BY(mu);
+    // A bound on the deadlines of this shard's timers, as last reported to
+    // the TimerWheel.
+    int64_t next_event ABSL_GUARDED_BY(mu);
+    // Number of timers on each level; the last entry counts the overflow
+    // list.
+    size_t level_count[kNumLevels + 1] ABSL_GUARDED_BY(mu) = {};
+    // The heads of the slot lists, one level after another, then the
+    // overflow list.
+    Timer* slots[kNumLevels * kSlotsPerLevel + 1] ABSL_GUARDED_BY(mu) = {};
+  };
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // The earliest next_event over all shards.
+  std::atomic<int64_t> min_timer_;
+  // Allow only one TimerCheck to run the shards at once.
+  grpc_core::Mutex checker_mu_;
+  // Timers are spread over the shards by address.
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
@@ -0,0 +1,259 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/write_coalescer.h"
+
+#include <utility>
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <errno.h>
+
+#include <memory>
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#endif  // GRPC_LINUX_IO_URING
+
+#ifdef GRPC_HAVE_MSG_NOSIGNAL
+#define SENDMSG_FLAGS (MSG_NOSIGNAL | MSG_DONTWAIT)
+#else
+#define SENDMSG_FLAGS MSG_DONTWAIT
+#endif
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+namespace {
+
+thread_local WriteCoalescer* g_current_coalescer = nullptr;
+
+void RecordBatch(size_t batch_size, int syscalls) {
+  grpc_core::global_stats().IncrementTcpWriteBatchSize(
+      static_cast<int>(batch_size));
+  for (int i = 0; i < syscalls; ++i) {
+    grpc_core::global_stats().IncrementSyscallWrite();
+  }
+}
+
+#ifdef GRPC_LINUX_IO_URING
+
+// A small io_uring instance used by one thread to submit a batch of sendmsg
+// requests with a single syscall. Requests carry MSG_DONTWAIT, which makes
+// the kernel complete them inline with -EAGAIN instead of waiting for the
+// socket to become writable, so every request of a batch has completed when
+// io_uring_enter returns.
+class SendRing {
+ public:
+  static constexpr unsigned kEntries = 64;
+
+  // Returns the calling thread's ring, or nullptr if io_uring is unavailable.
+  static SendRing* Get() {
+    static const bool supported = [] {
+      SendRing probe;
+      return probe.ok();
+    }();
+    if (!supported) return nullptr;
+    static thread_local std::unique_ptr<SendRing> ring;
+    if (ring == nullptr) ring = std::make_unique<SendRing>();
+    return ring->ok() ? ring.get() : nullptr;
+  }
+
+  SendRing() {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kEntries, &params));
+    if (fd_ < 0) return;
+    ring_len_ =
+        std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                 params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    sqes_len_ = params.sq_entries * sizeof(io_uring_sqe);
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0 ||
+        (ring_ = mmap(nullptr, ring_len_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd_, IORING_OFF_SQ_RING)) == MAP_FAILED ||
+        (sqes_ = mmap(nullptr, sqes_len_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd_, IORING_OFF_SQES)) == MAP_FAILED) {
+      Close();
+      return;
+    }
+    char* ring = static_cast<char*>(ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(ring + params.sq_off.tail);
+    sq_array_ = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+    sq_mask_ = *reinterpret_cast<unsigned*>(ring + params.sq_off.ring_mask);
+    cq_head_ = reinterpret_cast<unsigned*>(ring + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(ring + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(ring + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+  }
+
+  ~SendRing() { Close(); }
+
+  bool ok() const { return fd_ >= 0; }
+
+  // Sends up to kEntries messages, storing their results. Returns false if
+  // the batch could not be submitted, in which case no message was sent.
+  template <typename Iterator>
+  bool Send(Iterator begin, Iterator end) {
+    unsigned tail = *sq_tail_;
+    unsigned n = 0;
+    for (Iterator it = begin; it != end; ++it, ++n) {
+      unsigned index = (tail + n) & sq_mask_;
+      io_uring_sqe* sqe = &static_cast<io_uring_sqe*>(sqes_)[index];
+      memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = IORING_OP_SENDMSG;
+      sqe->fd = it->fd;
+      sqe->addr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(it->msg));
+      sqe->len = 1;
+      sqe->msg_flags = SENDMSG_FLAGS;
+      sqe->user_data = n;
+      sq_array_[index] = index;
+    }
+    __atomic_store_n(sq_tail_, tail + n, __ATOMIC_RELEASE);
+    int r;
+    do {
+      r = static_cast<int>(syscall(__NR_io_uring_enter, fd_, n, n,
+                                   IORING_ENTER_GETEVENTS, nullptr, 0));
+    } while (r < 0 && errno == EINTR);
+    if (r < 0) {
+      // The ring is left in an unknown state: stop using it.
+      gpr_log(GPR_ERROR, "io_uring_enter failed: %d", errno);
+      Close();
+      return false;
+    }
+    unsigned head = *cq_head_;
+    for (unsigned completed = 0; completed < n;) {
+      unsigned cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      if (head == cq_tail) {
+        // Not expected with MSG_DONTWAIT, but wait rather than lose results.
+        do {
+          r = static_cast<int>(syscall(__NR_io_uring_enter, fd_, 0, 1,
+                                       IORING_ENTER_GETEVENTS, nullptr, 0));
+        } while (r < 0 && errno == EINTR);
+        GPR_ASSERT(r >= 0);
+        continue;
+      }
+      const io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+      Iterator it = begin + cqe->user_data;
+      if (cqe->res < 0) {
+        it->sent_length = -1;
+        it->saved_errno = -cqe->res;
+      } else {
+        it->sent_length = cqe->res;
+        it->saved_errno = 0;
+      }
+      ++head;
+      ++completed;
+    }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    return true;
+  }
+
+ private:
+  void Close() {
+    if (sqes_ != nullptr && sqes_ != MAP_FAILED) munmap(sqes_, sqes_len_);
+    if (ring_ != nullptr && ring_ != MAP_FAILED) munmap(ring_, ring_len_);
+    sqes_ = nullptr;
+    ring_ = nullptr;
+    if (fd_ >= 0) close(fd_);
+    fd_ = -1;
+  }
+
+  int fd_ = -1;
+  void* ring_ = nullptr;
+  size_t ring_len_ = 0;
+  void* sqes_ = nullptr;
+  size_t sqes_len_ = 0;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+#endif  // GRPC_LINUX_IO_URING
+
+}  // namespace
+
+WriteCoalescer::Scope::Scope() {
+  if (g_current_coalescer == nullptr) {
+    owned_ = new WriteCoalescer();
+    g_current_coalescer = owned_;
+  }
+}
+
+WriteCoalescer::Scope::~Scope() {
+  if (owned_ == nullptr) return;
+  owned_->Flush();
+  g_current_coalescer = nullptr;
+  delete owned_;
+}
+
+WriteCoalescer* WriteCoalescer::Current() { return g_current_coalescer; }
+
+WriteCoalescer::~WriteCoalescer() { GPR_DEBUG_ASSERT(pending_.empty()); }
+
+void WriteCoalescer::Add(int fd, const msghdr* msg, OnSent on_sent) {
+  pending_.push_back(PendingSend{fd, msg, std::move(on_sent), 0, 0});
+}
+
+void WriteCoalescer::Flush() {
+  while (!pending_.empty()) {
+    std::vector<PendingSend> batch;
+    batch.swap(pending_);
+    int syscalls = 0;
+    auto begin = batch.begin();
+#ifdef GRPC_LINUX_IO_URING
+    SendRing* ring = SendRing::Get();
+    while (ring != nullptr && begin != batch.end()) {
+      auto end = begin + std::min<size_t>(SendRing::kEntries,
+                                          batch.end() - begin);
+      if (!ring->Send(begin, end)) break;
+      ++syscalls;
+      begin = end;
+    }
+#endif  // GRPC_LINUX_IO_URING
+    for (auto it = begin; it != batch.end(); ++it) {
+      do {
+        it->sent_length = sendmsg(it->fd, it->msg, SENDMSG_FLAGS);
+      } while (it->sent_length < 0 && errno == EINTR);
+      it->saved_errno = it->sent_length < 0 ? errno : 0;
+      ++syscalls;
+    }
+    RecordBatch(batch.size(), syscalls);
+    for (PendingSend& send : batch) {
+      send.on_sent(send.sent_length, send.saved_errno);
+    }
+  }
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_POSIX_SOCKET_TCP
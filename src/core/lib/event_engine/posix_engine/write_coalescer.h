@@ -0,0 +1,102 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_COALESCER_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_COALESCER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+#include <sys/socket.h>  // IWYU pragma: keep
+#include <sys/types.h>   // IWYU pragma: keep
+#endif
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+// Collects the sendmsg calls that endpoints make for different sockets while a
+// WriteCoalescer::Scope is active on the calling thread, and sends them
+// together when the outermost scope ends.
+//
+// sendmmsg only batches messages for a single socket, and an endpoint never
+// has more than one write in flight, so batches that span sockets are
+// submitted as IORING_OP_SENDMSG requests with a single io_uring_enter on
+// kernels that support it. Elsewhere every message is sent with its own
+// sendmsg, which only defers the writes to the end of the scope.
+class WriteCoalescer {
+ public:
+  // Invoked with the result of sending the message: the number of bytes sent,
+  // or -1 and the error number.
+  using OnSent = absl::AnyInvocable<void(ssize_t sent_length, int saved_errno)>;
+
+  // Makes a coalescer current for the calling thread for the lifetime of the
+  // outermost Scope, and flushes it when that Scope is destroyed. Nested
+  // scopes share the coalescer of the outermost one.
+  class Scope {
+   public:
+    Scope();
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    WriteCoalescer* owned_ = nullptr;
+  };
+
+  // Returns the coalescer of the calling thread's active Scope, or nullptr if
+  // there is none.
+  static WriteCoalescer* Current();
+
+  // Queues \a msg to be sent on \a fd with MSG_DONTWAIT. \a msg and the
+  // buffers it points to must stay valid until \a on_sent runs, which happens
+  // on the flushing thread after every queued message has been sent.
+  void Add(int fd, const msghdr* msg, OnSent on_sent);
+
+  // Sends every queued message and runs their callbacks. Messages queued by
+  // those callbacks are sent in a following batch.
+  void Flush();
+
+  size_t size() const { return pending_.size(); }
+
+ private:
+  struct PendingSend {
+    int fd;
+    const msghdr* msg;
+    OnSent on_sent;
+    ssize_t sent_length;
+    int saved_errno;
+  };
+
+  WriteCoalescer() = default;
+  ~WriteCoalescer();
+
+  std::vector<PendingSend> pending_;
+};
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_COALESCER_H
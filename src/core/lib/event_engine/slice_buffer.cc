@@ -22,6 +22,7 @@
 #include <grpc/slice_buffer.h>
 
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 
 namespace grpc_event_engine {
 namespace experimental {
@@ -39,7 +40,7 @@ Slice SliceBuffer::TakeFirst() {
 }
 
 void SliceBuffer::Prepend(Slice slice) {
-  grpc_slice_buffer_undo_take_first(&slice_buffer_, slice.TakeCSlice());
+  grpc_slice_buffer_prepend(&slice_buffer_, slice.TakeCSlice());
 }
 
 Slice SliceBuffer::RefSlice(size_t index) {
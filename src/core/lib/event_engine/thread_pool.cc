@@ -20,6 +20,7 @@
 
 #include "src/core/lib/event_engine/thread_pool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <utility>
@@ -37,9 +38,20 @@ namespace grpc_event_engine {
 namespace experimental {
 
 namespace {
-// TODO(drfloob): Remove this, and replace it with the WorkQueue* for the
-// current thread (with nullptr indicating not a threadpool thread).
-thread_local bool g_threadpool_thread;
+// The work queue owned by the current thread, or nullptr if this is not a
+// threadpool thread.
+thread_local LockFreeWorkQueue* g_local_queue = nullptr;
+// The pool State that g_local_queue belongs to, so that work scheduled onto a
+// different pool from a threadpool thread goes to that pool's shared queue.
+thread_local const void* g_local_queue_owner = nullptr;
+
+// Default for how long work may wait before the pool adds threads.
+constexpr grpc_core::Duration kDefaultTargetQueueLatency =
+    grpc_core::Duration::Milliseconds(2);
+// How often queue latency is sampled.
+constexpr int64_t kLatencySampleIntervalMillis = 10;
+// Weight given to each new sample in the moving average.
+constexpr double kLatencySampleWeight = 0.25;
 }  // namespace
 
 void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
@@ -57,6 +69,7 @@ void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
     }
       ABSL_FALLTHROUGH_INTENDED;
     case StartThreadReason::kNoWaitersWhenFinishedStarting:
+    case StartThreadReason::kQueueLatencyAboveTarget:
       if (state->currently_starting_one_thread.exchange(
               true, std::memory_order_relaxed)) {
         state->thread_count.Remove();
@@ -76,7 +89,6 @@ void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
       "event_engine",
       [](void* arg) {
         std::unique_ptr<ThreadArg> a(static_cast<ThreadArg*>(arg));
-        g_threadpool_thread = true;
         switch (a->reason) {
           case StartThreadReason::kInitialPool:
             break;
@@ -84,6 +96,7 @@ void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
             a->state->queue.SleepIfRunning();
             ABSL_FALLTHROUGH_INTENDED;
           case StartThreadReason::kNoWaitersWhenScheduling:
+          case StartThreadReason::kQueueLatencyAboveTarget:
             // Release throttling variable
             GPR_ASSERT(a->state->currently_starting_one_thread.exchange(
                 false, std::memory_order_relaxed));
@@ -101,47 +114,187 @@ void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
 }
 
 void ThreadPool::ThreadFunc(StatePtr state) {
-  while (state->queue.Step()) {
+  LockFreeWorkQueue local_queue;
+  g_local_queue = &local_queue;
+  g_local_queue_owner = state.get();
+  state->theft_registry.Enroll(&local_queue);
+  while (state->queue.Step(&local_queue, &state->theft_registry)) {
+    MaybeGrowForLatency(state);
   }
+  // Step only returns false once the local queue has been drained, and no
+  // other thread adds to it.
+  GPR_DEBUG_ASSERT(local_queue.Empty());
+  state->theft_registry.Unenroll(&local_queue);
+  g_local_queue = nullptr;
+  g_local_queue_owner = nullptr;
   state->thread_count.Remove();
 }
 
-bool ThreadPool::Queue::Step() {
-  grpc_core::ReleasableMutexLock lock(&mu_);
-  // Wait until work is available or we are shutting down.
-  while (state_ == State::kRunning && callbacks_.empty()) {
-    // If there are too many threads waiting, then quit this thread.
-    // TODO(ctiller): wait some time in this case to be sure.
-    if (threads_waiting_ >= reserve_threads_) {
-      threads_waiting_++;
-      bool timeout = cv_.WaitWithTimeout(&mu_, absl::Seconds(30));
-      threads_waiting_--;
-      if (timeout && threads_waiting_ >= reserve_threads_) {
-        return false;
+void ThreadPool::MaybeGrowForLatency(const StatePtr& state) {
+  const auto now = grpc_core::Timestamp::Now();
+  if (!state->latency_controller.ShouldSample(now)) return;
+  const auto oldest = std::min(state->queue.OldestEnqueuedTimestamp(),
+                               state->theft_registry.OldestEnqueuedTimestamp());
+  state->latency_controller.RecordSample(
+      oldest == grpc_core::Timestamp::InfFuture()
+          ? grpc_core::Duration::Zero()
+          : now - oldest);
+  if (state->latency_controller.AboveTarget() && !state->queue.HasWaiters()) {
+    StartThread(state, StartThreadReason::kQueueLatencyAboveTarget);
+  }
+}
+
+bool ThreadPool::Queue::Step(LockFreeWorkQueue* local_queue,
+                             TheftRegistry* theft_registry) {
+  while (true) {
+    // Most recently added local work first: it is the most likely to still be
+    // in this thread's cache, and taking it needs no shared lock.
+    EventEngine::Closure* closure = local_queue->PopBack();
+    if (closure == nullptr) {
+      absl::AnyInvocable<void()> callback;
+      {
+        grpc_core::MutexLock lock(&mu_);
+        if (!callbacks_.empty()) {
+          callback = std::move(callbacks_.front().callback);
+          callbacks_.pop();
+        } else if (state_ != State::kRunning && local_queue->Empty()) {
+          return false;
+        }
+      }
+      if (callback != nullptr) {
+        callback();
+        return true;
       }
-    } else {
-      threads_waiting_++;
-      cv_.Wait(&mu_);
-      threads_waiting_--;
+      closure = theft_registry->StealOne(local_queue);
     }
+    if (closure != nullptr) {
+      closure->Run();
+      return true;
+    }
+    if (!WaitForWork(local_queue)) return false;
   }
-  switch (state_) {
-    case State::kRunning:
-      break;
-    case State::kShutdown:
-    case State::kForking:
-      if (!callbacks_.empty()) break;
+}
+
+bool ThreadPool::Queue::WaitForWork(LockFreeWorkQueue* local_queue) {
+  grpc_core::MutexLock lock(&mu_);
+  // The local queue may be non-empty if a thief held its lock when we tried to
+  // pop from it: retry rather than sleep.
+  if (state_ != State::kRunning || !callbacks_.empty() ||
+      !local_queue->Empty()) {
+    return true;
+  }
+  // Nothing is queued here, so this is a zero-latency sample.
+  if (latency_controller_->ShouldSample(grpc_core::Timestamp::Now())) {
+    latency_controller_->RecordSample(grpc_core::Duration::Zero());
+  }
+  // If there are too many threads waiting, then quit this thread once it has
+  // been idle for a while.
+  if (threads_waiting_.load(std::memory_order_relaxed) >= reserve_threads_) {
+    threads_waiting_.fetch_add(1, std::memory_order_relaxed);
+    bool timeout = cv_.WaitWithTimeout(
+        &mu_,
+        absl::Milliseconds(latency_controller_->IdleThreadTimeout().millis()));
+    threads_waiting_.fetch_sub(1, std::memory_order_relaxed);
+    if (timeout && state_ == State::kRunning && callbacks_.empty() &&
+        threads_waiting_.load(std::memory_order_relaxed) >= reserve_threads_) {
       return false;
+    }
+  } else {
+    threads_waiting_.fetch_add(1, std::memory_order_relaxed);
+    cv_.Wait(&mu_);
+    threads_waiting_.fetch_sub(1, std::memory_order_relaxed);
   }
-  GPR_ASSERT(!callbacks_.empty());
-  auto callback = std::move(callbacks_.front());
-  callbacks_.pop();
-  lock.Release();
-  callback();
   return true;
 }
 
-ThreadPool::ThreadPool() {
+bool ThreadPool::Queue::WakeIdleThread() {
+  if (threads_waiting_.load(std::memory_order_relaxed) == 0) return false;
+  grpc_core::MutexLock lock(&mu_);
+  cv_.Signal();
+  return true;
+}
+
+grpc_core::Timestamp ThreadPool::Queue::OldestEnqueuedTimestamp() {
+  grpc_core::MutexLock lock(&mu_);
+  if (callbacks_.empty()) return grpc_core::Timestamp::InfFuture();
+  return callbacks_.front().enqueued;
+}
+
+grpc_core::Duration ThreadPool::LatencyController::measured() const {
+  return grpc_core::Duration::FromSecondsAsDouble(
+      measured_millis_.load(std::memory_order_relaxed) / 1000.0);
+}
+
+bool ThreadPool::LatencyController::ShouldSample(grpc_core::Timestamp now) {
+  int64_t now_millis = now.milliseconds_after_process_epoch();
+  int64_t next = next_sample_millis_.load(std::memory_order_relaxed);
+  if (now_millis < next) return false;
+  return next_sample_millis_.compare_exchange_strong(
+      next, now_millis + kLatencySampleIntervalMillis,
+      std::memory_order_relaxed);
+}
+
+void ThreadPool::LatencyController::RecordSample(
+    grpc_core::Duration queue_latency) {
+  double measured = measured_millis_.load(std::memory_order_relaxed);
+  measured += kLatencySampleWeight *
+              (static_cast<double>(queue_latency.millis()) - measured);
+  measured_millis_.store(measured, std::memory_order_relaxed);
+}
+
+grpc_core::Duration ThreadPool::LatencyController::IdleThreadTimeout() const {
+  // While work is being picked up quickly enough, extra threads are only
+  // costing memory: let them go promptly. Otherwise keep them for longer in
+  // case the backlog returns.
+  return AboveTarget() ? grpc_core::Duration::Seconds(30)
+                       : grpc_core::Duration::Seconds(1);
+}
+
+void ThreadPool::TheftRegistry::Enroll(LockFreeWorkQueue* queue) {
+  grpc_core::MutexLock lock(&mu_);
+  queues_.emplace(queue);
+}
+
+void ThreadPool::TheftRegistry::Unenroll(LockFreeWorkQueue* queue) {
+  grpc_core::MutexLock lock(&mu_);
+  queues_.erase(queue);
+}
+
+EventEngine::Closure* ThreadPool::TheftRegistry::StealOne(
+    LockFreeWorkQueue* thief) {
+  // Holding mu_ keeps the enrolled queues alive while we look at them.
+  grpc_core::MutexLock lock(&mu_);
+  for (LockFreeWorkQueue* queue : queues_) {
+    if (queue == thief || queue->Empty()) continue;
+    EventEngine::Closure* closure = queue->PopFront();
+    if (closure != nullptr) return closure;
+  }
+  return nullptr;
+}
+
+grpc_core::Timestamp ThreadPool::TheftRegistry::OldestEnqueuedTimestamp() {
+  grpc_core::MutexLock lock(&mu_);
+  grpc_core::Timestamp oldest = grpc_core::Timestamp::InfFuture();
+  for (LockFreeWorkQueue* queue : queues_) {
+    if (queue->Empty()) continue;
+    // The queue may have been emptied since checking: ignore it then.
+    grpc_core::Timestamp queue_oldest = queue->OldestEnqueuedTimestamp();
+    if (queue_oldest == grpc_core::Timestamp::InfPast()) continue;
+    oldest = std::min(oldest, queue_oldest);
+  }
+  return oldest;
+}
+
+ThreadPool::ThreadPool() : ThreadPool(kDefaultTargetQueueLatency) {}
+
+ThreadPool::ThreadPool(grpc_core::Duration target_queue_latency)
+    : state_(std::make_shared<State>(reserve_threads_, target_queue_latency)) {}
+
+void ThreadPool::EnsureThreadsStarted() {
+  if (threads_started_.load(std::memory_order_acquire) ||
+      threads_started_.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
   for (unsigned i = 0; i < reserve_threads_; i++) {
     StartThread(state_, StartThreadReason::kInitialPool);
   }
@@ -153,8 +306,8 @@ void ThreadPool::Quiesce() {
   // Note that if this is a threadpool thread then we won't exit this thread
   // until the callstack unwinds a little, so we need to wait for just one
   // thread running instead of zero.
-  state_->thread_count.BlockUntilThreadCount(g_threadpool_thread ? 1 : 0,
-                                             "shutting down");
+  state_->thread_count.BlockUntilThreadCount(
+      g_local_queue_owner == state_.get() ? 1 : 0, "shutting down");
   quiesced_.store(true, std::memory_order_relaxed);
 }
 
@@ -164,24 +317,56 @@ ThreadPool::~ThreadPool() {
 
 void ThreadPool::Run(absl::AnyInvocable<void()> callback) {
   GPR_DEBUG_ASSERT(quiesced_.load(std::memory_order_relaxed) == false);
+  if (g_local_queue_owner == state_.get()) {
+    g_local_queue->Add(std::move(callback));
+    OnLocalWorkAdded();
+    return;
+  }
+  EnsureThreadsStarted();
   if (state_->queue.Add(std::move(callback))) {
     StartThread(state_, StartThreadReason::kNoWaitersWhenScheduling);
   }
 }
 
+ThreadPool::LatencyStats ThreadPool::GetLatencyStats() const {
+  return LatencyStats{state_->latency_controller.target(),
+                      state_->latency_controller.measured(),
+                      state_->thread_count.count()};
+}
+
 void ThreadPool::Run(EventEngine::Closure* closure) {
+  GPR_DEBUG_ASSERT(quiesced_.load(std::memory_order_relaxed) == false);
+  if (g_local_queue_owner == state_.get()) {
+    g_local_queue->Add(closure);
+    OnLocalWorkAdded();
+    return;
+  }
   Run([closure]() { closure->Run(); });
 }
 
+void ThreadPool::OnLocalWorkAdded() {
+  if (state_->queue.WakeIdleThread()) return;
+  // Every thread is busy. Check the thread start throttle here, before
+  // StartThread takes any locks, since this is on every closure's path.
+  auto time_since_last_start =
+      grpc_core::Timestamp::Now() -
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          state_->last_started_thread.load(std::memory_order_relaxed));
+  if (time_since_last_start >= grpc_core::Duration::Seconds(1)) {
+    StartThread(state_, StartThreadReason::kNoWaitersWhenScheduling);
+  }
+}
+
 bool ThreadPool::Queue::Add(absl::AnyInvocable<void()> callback) {
   grpc_core::MutexLock lock(&mu_);
   // Add works to the callbacks list
-  callbacks_.push(std::move(callback));
+  callbacks_.push({std::move(callback), grpc_core::Timestamp::Now()});
   cv_.Signal();
   switch (state_) {
     case State::kRunning:
     case State::kShutdown:
-      return callbacks_.size() > threads_waiting_;
+      return callbacks_.size() >
+             threads_waiting_.load(std::memory_order_relaxed);
     case State::kForking:
       return false;
   }
@@ -239,6 +424,11 @@ void ThreadPool::ThreadCount::Remove() {
   cv_.Signal();
 }
 
+int ThreadPool::ThreadCount::count() {
+  grpc_core::MutexLock lock(&mu_);
+  return threads_;
+}
+
 void ThreadPool::ThreadCount::BlockUntilThreadCount(int threads,
                                                     const char* why) {
   grpc_core::MutexLock lock(&mu_);
@@ -261,14 +451,23 @@ void ThreadPool::PrepareFork() {
   state_->thread_count.BlockUntilThreadCount(0, "forking");
 }
 
-void ThreadPool::PostforkParent() { Postfork(); }
-
-void ThreadPool::PostforkChild() { Postfork(); }
+void ThreadPool::PostforkParent() {
+  state_->queue.Reset();
+  if (threads_started_.load(std::memory_order_acquire)) {
+    for (unsigned i = 0; i < reserve_threads_; i++) {
+      StartThread(state_, StartThreadReason::kInitialPool);
+    }
+  }
+}
 
-void ThreadPool::Postfork() {
+void ThreadPool::PostforkChild() {
   state_->queue.Reset();
-  for (unsigned i = 0; i < reserve_threads_; i++) {
-    StartThread(state_, StartThreadReason::kInitialPool);
+  // Many children never use the pool: start threads when work arrives, or
+  // now if work was queued while forking.
+  threads_started_.store(false, std::memory_order_release);
+  if (state_->queue.OldestEnqueuedTimestamp() !=
+      grpc_core::Timestamp::InfFuture()) {
+    EnsureThreadsStarted();
   }
 }
 
@@ -28,6 +28,7 @@
 #include <queue>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
 
 #include <grpc/event_engine/event_engine.h>
@@ -35,15 +36,39 @@
 
 #include "src/core/lib/event_engine/executor/executor.h"
 #include "src/core/lib/event_engine/forkable.h"
+#include "src/core/lib/event_engine/work_queue.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
 
 namespace grpc_event_engine {
 namespace experimental {
 
+// A thread pool with a shared queue for work scheduled from outside the pool,
+// and a per-thread LockFreeWorkQueue for work scheduled from within pool
+// threads.
+// Idle threads steal work from the queues of busy threads.
+//
+// The pool grows when work waits longer than a target latency before it runs,
+// and threads beyond the reserve exit soon after going idle while the target
+// is being met.
+//
+// No threads are started until work is first run, and a forked child only
+// starts them again once it runs work, so that forking a process that is not
+// using the pool (as prefork servers do) costs little.
 class ThreadPool final : public Forkable, public Executor {
  public:
+  struct LatencyStats {
+    // How long work may wait in a queue before the pool adds threads.
+    grpc_core::Duration target;
+    // Smoothed time the oldest queued work has been waiting.
+    grpc_core::Duration measured;
+    // Number of running threads.
+    int threads;
+  };
+
   ThreadPool();
+  explicit ThreadPool(grpc_core::Duration target_queue_latency);
   // Asserts Quiesce was called.
   ~ThreadPool() override;
 
@@ -53,18 +78,68 @@ class ThreadPool final : public Forkable, public Executor {
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
 
+  LatencyStats GetLatencyStats() const;
+
   // Forkable
-  // Ensures that the thread pool is empty before forking.
+  // Ensures that the thread pool is empty before forking. This returns at
+  // once if no threads are running.
   void PrepareFork() override;
   void PostforkParent() override;
   void PostforkChild() override;
 
  private:
+  // The set of per-thread queues that idle threads may steal work from.
+  class TheftRegistry {
+   public:
+    void Enroll(LockFreeWorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(LockFreeWorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    // Returns a closure taken from any enrolled queue other than \a thief, or
+    // nullptr if no work could be found.
+    EventEngine::Closure* StealOne(LockFreeWorkQueue* thief)
+        ABSL_LOCKS_EXCLUDED(mu_);
+    // Returns the enqueue time of the oldest work in any enrolled queue, or
+    // InfFuture if they are all empty.
+    grpc_core::Timestamp OldestEnqueuedTimestamp() ABSL_LOCKS_EXCLUDED(mu_);
+
+   private:
+    grpc_core::Mutex mu_;
+    absl::flat_hash_set<LockFreeWorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+  };
+
+  // Tracks how long queued work waits before it runs, and decides from that
+  // whether the pool should grow or let idle threads go.
+  class LatencyController {
+   public:
+    explicit LatencyController(grpc_core::Duration target) : target_(target) {}
+    grpc_core::Duration target() const { return target_; }
+    grpc_core::Duration measured() const;
+    bool AboveTarget() const { return measured() > target_; }
+    // Samples are rate limited: returns true (at most once per sample
+    // interval) if the caller should measure and call RecordSample.
+    bool ShouldSample(grpc_core::Timestamp now);
+    void RecordSample(grpc_core::Duration queue_latency);
+    // How long an idle thread beyond the reserve waits for work before
+    // exiting.
+    grpc_core::Duration IdleThreadTimeout() const;
+
+   private:
+    const grpc_core::Duration target_;
+    std::atomic<int64_t> next_sample_millis_{0};
+    // Exponentially weighted moving average, only written by the thread that
+    // won ShouldSample.
+    std::atomic<double> measured_millis_{0};
+  };
+
   class Queue {
    public:
-    explicit Queue(unsigned reserve_threads)
-        : reserve_threads_(reserve_threads) {}
-    bool Step();
+    Queue(unsigned reserve_threads, LatencyController* latency_controller)
+        : reserve_threads_(reserve_threads),
+          latency_controller_(latency_controller) {}
+    // Run one piece of work: from \a local_queue if possible, then from the
+    // shared queue, then stolen from another thread via \a theft_registry.
+    // Returns false if the calling thread should exit.
+    bool Step(LockFreeWorkQueue* local_queue,
+              TheftRegistry* theft_registry);
     void SetShutdown() { SetState(State::kShutdown); }
     void SetForking() { SetState(State::kForking); }
     // Add a callback to the queue.
@@ -73,17 +148,35 @@ class ThreadPool final : public Forkable, public Executor {
     void Reset() { SetState(State::kRunning); }
     bool IsBacklogged();
     void SleepIfRunning();
+    // Wake one sleeping thread so that it can steal newly added thread-local
+    // work. Returns false (without taking the lock) if no threads are waiting.
+    bool WakeIdleThread();
+    bool HasWaiters() const {
+      return threads_waiting_.load(std::memory_order_relaxed) > 0;
+    }
+    // Returns the enqueue time of the oldest callback, or InfFuture if empty.
+    grpc_core::Timestamp OldestEnqueuedTimestamp() ABSL_LOCKS_EXCLUDED(mu_);
 
    private:
     enum class State { kRunning, kShutdown, kForking };
 
     void SetState(State state);
+    // Sleep until there may be work to do. Returns false if the calling thread
+    // should exit.
+    bool WaitForWork(LockFreeWorkQueue* local_queue);
+
+    struct QueuedCallback {
+      absl::AnyInvocable<void()> callback;
+      grpc_core::Timestamp enqueued;
+    };
 
     grpc_core::Mutex mu_;
     grpc_core::CondVar cv_;
-    std::queue<absl::AnyInvocable<void()>> callbacks_ ABSL_GUARDED_BY(mu_);
-    unsigned threads_waiting_ ABSL_GUARDED_BY(mu_) = 0;
+    std::queue<QueuedCallback> callbacks_ ABSL_GUARDED_BY(mu_);
+    // Written under mu_, read without it by WakeIdleThread.
+    std::atomic<unsigned> threads_waiting_{0};
     const unsigned reserve_threads_;
+    LatencyController* const latency_controller_;
     State state_ ABSL_GUARDED_BY(mu_) = State::kRunning;
   };
 
@@ -92,6 +185,7 @@ class ThreadPool final : public Forkable, public Executor {
     void Add();
     void Remove();
     void BlockUntilThreadCount(int threads, const char* why);
+    int count() ABSL_LOCKS_EXCLUDED(mu_);
 
    private:
     grpc_core::Mutex mu_;
@@ -100,8 +194,12 @@ class ThreadPool final : public Forkable, public Executor {
   };
 
   struct State {
-    explicit State(int reserve_threads) : queue(reserve_threads) {}
+    State(int reserve_threads, grpc_core::Duration target_queue_latency)
+        : latency_controller(target_queue_latency),
+          queue(reserve_threads, &latency_controller) {}
+    LatencyController latency_controller;
     Queue queue;
+    TheftRegistry theft_registry;
     ThreadCount thread_count;
     // After pool creation we use this to rate limit creation of threads to one
     // at a time.
@@ -115,6 +213,7 @@ class ThreadPool final : public Forkable, public Executor {
     kInitialPool,
     kNoWaitersWhenScheduling,
     kNoWaitersWhenFinishedStarting,
+    kQueueLatencyAboveTarget,
   };
 
   static void ThreadFunc(StatePtr state);
@@ -123,11 +222,21 @@ class ThreadPool final : public Forkable, public Executor {
   // not: at thread pool startup we start several threads concurrently, but
   // after that we only start one at a time.
   static void StartThread(StatePtr state, StartThreadReason reason);
-  void Postfork();
+  // Periodically measures queue latency, and starts a thread if work is
+  // waiting too long and no threads are idle.
+  static void MaybeGrowForLatency(const StatePtr& state);
+  // Starts the reserve threads, unless they have been started already.
+  void EnsureThreadsStarted();
+  // Called after work was added to the current thread's local queue: wakes an
+  // idle thread to steal it, or starts a new thread if none are idle.
+  void OnLocalWorkAdded();
 
   const unsigned reserve_threads_ =
       grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 32u);
-  const StatePtr state_ = std::make_shared<State>(reserve_threads_);
+  const StatePtr state_;
+  // Whether the reserve threads have been started since the pool was created
+  // or the process forked.
+  std::atomic<bool> threads_started_{false};
   std::atomic<bool> quiesced_{false};
 };
 
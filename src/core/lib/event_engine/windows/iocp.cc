@@ -70,54 +70,61 @@ Poller::WorkResult IOCP::Work(EventEngine::Duration timeout,
       absl::StrFormat("IOCP::%p: Received no completions", this));
   static const absl::Status kKicked =
       absl::AbortedError(absl::StrFormat("IOCP::%p: Awoken from a kick", this));
-  DWORD bytes = 0;
-  ULONG_PTR completion_key;
-  LPOVERLAPPED overlapped;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_event_engine_trace)) {
     gpr_log(GPR_DEBUG, "IOCP::%p doing work", this);
   }
-  BOOL success = GetQueuedCompletionStatus(
-      iocp_handle_, &bytes, &completion_key, &overlapped,
-      static_cast<DWORD>(Milliseconds(timeout)));
-  if (success == 0 && overlapped == NULL) {
+  // Dequeue all the completions that are ready, up to a limit, in one call.
+  OVERLAPPED_ENTRY entries[kMaxCompletionsPerWork];
+  ULONG count = 0;
+  BOOL success = GetQueuedCompletionStatusEx(
+      iocp_handle_, entries, kMaxCompletionsPerWork, &count,
+      static_cast<DWORD>(Milliseconds(timeout)), /*fAlertable=*/FALSE);
+  if (success == 0 || count == 0) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_event_engine_trace)) {
       gpr_log(GPR_DEBUG, "IOCP::%p deadline exceeded", this);
     }
     return Poller::WorkResult::kDeadlineExceeded;
   }
-  GPR_ASSERT(completion_key && overlapped);
-  if (overlapped == &kick_overlap_) {
+  bool scheduled_poll_again = false;
+  for (ULONG i = 0; i < count; i++) {
+    ULONG_PTR completion_key = entries[i].lpCompletionKey;
+    LPOVERLAPPED overlapped = entries[i].lpOverlapped;
+    GPR_ASSERT(completion_key && overlapped);
+    if (overlapped == &kick_overlap_) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_event_engine_trace)) {
+        gpr_log(GPR_DEBUG, "IOCP::%p kicked", this);
+      }
+      outstanding_kicks_.fetch_sub(1);
+      if (completion_key == (ULONG_PTR)&kick_token_) continue;
+      gpr_log(GPR_ERROR, "Unknown custom completion key: %p", completion_key);
+      abort();
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_event_engine_trace)) {
-      gpr_log(GPR_DEBUG, "IOCP::%p kicked", this);
+      gpr_log(GPR_DEBUG, "IOCP::%p got event on OVERLAPPED::%p", this,
+              overlapped);
     }
-    outstanding_kicks_.fetch_sub(1);
-    if (completion_key == (ULONG_PTR)&kick_token_) {
-      return Poller::WorkResult::kKicked;
+    if (!scheduled_poll_again) {
+      schedule_poll_again();
+      scheduled_poll_again = true;
+    }
+    WinSocket* socket = reinterpret_cast<WinSocket*>(completion_key);
+    // TODO(hork): move the following logic into the WinSocket impl.
+    WinSocket::OpState* info = socket->GetOpInfoForOverlapped(overlapped);
+    GPR_ASSERT(info != nullptr);
+    if (socket->IsShutdown()) {
+      info->SetError(WSAESHUTDOWN);
+    } else {
+      info->GetOverlappedResult();
+    }
+    if (info->closure() != nullptr) {
+      executor_->Run(info->closure());
+    } else {
+      // No callback registered. Set ready.
+      info->SetReady();
     }
-    gpr_log(GPR_ERROR, "Unknown custom completion key: %p", completion_key);
-    abort();
-  }
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_event_engine_trace)) {
-    gpr_log(GPR_DEBUG, "IOCP::%p got event on OVERLAPPED::%p", this,
-            overlapped);
-  }
-  WinSocket* socket = reinterpret_cast<WinSocket*>(completion_key);
-  // TODO(hork): move the following logic into the WinSocket impl.
-  WinSocket::OpState* info = socket->GetOpInfoForOverlapped(overlapped);
-  GPR_ASSERT(info != nullptr);
-  if (socket->IsShutdown()) {
-    info->SetError(WSAESHUTDOWN);
-  } else {
-    info->GetOverlappedResult();
-  }
-  if (info->closure() != nullptr) {
-    schedule_poll_again();
-    executor_->Run(info->closure());
-    return Poller::WorkResult::kOk;
   }
-  // No callback registered. Set ready and return an empty set
-  info->SetReady();
-  schedule_poll_again();
+  // Only report a kick if there were no events to process.
+  if (!scheduled_poll_again) return Poller::WorkResult::kKicked;
   return Poller::WorkResult::kOk;
 }
 
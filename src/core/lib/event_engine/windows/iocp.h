@@ -42,6 +42,8 @@ class IOCP final : public Poller {
 
   // interface methods
   void Shutdown();
+  // Dequeues up to kMaxCompletionsPerWork completions at once, and processes
+  // them all. Kicks dequeued together with other completions are absorbed.
   WorkResult Work(EventEngine::Duration timeout,
                   absl::FunctionRef<void()> schedule_poll_again) override;
   void Kick() override;
@@ -51,6 +53,9 @@ class IOCP final : public Poller {
   static DWORD GetDefaultSocketFlags();
 
  private:
+  // The most completions a single call to Work() dequeues.
+  static constexpr ULONG kMaxCompletionsPerWork = 64;
+
   // Initialize default flags via checking platform support
   static DWORD WSASocketFlagsInit();
 
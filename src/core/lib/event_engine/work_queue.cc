@@ -155,6 +155,7 @@ EventEngine::Closure* WorkQueue::PopLocked(bool front)
       ret = std::exchange(most_recent_element_, absl::nullopt);
     }
     most_recent_element_lock_.Unlock();
+    if (!ret.has_value()) return nullptr;
     return ret->closure();
   }
   // the queue has elements, let's pop one and update timestamps
@@ -190,5 +191,173 @@ EventEngine::Closure* WorkQueue::TryPopMostRecentElement() {
   return tmp->closure();
 }
 
+// ------ LockFreeWorkQueue ---------------------------------------------------
+
+namespace {
+int64_t NowMillis() {
+  return grpc_core::Timestamp::Now().milliseconds_after_process_epoch();
+}
+
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = 2;
+  while (result < n) result <<= 1;
+  return result;
+}
+}  // namespace
+
+LockFreeWorkQueue::LockFreeWorkQueue(size_t capacity)
+    : mask_(RoundUpToPowerOfTwo(capacity) - 1),
+      cells_(new Cell[mask_ + 1]) {
+  for (size_t i = 0; i <= mask_; i++) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool LockFreeWorkQueue::Empty() const {
+  return most_recent_element_.load(std::memory_order_relaxed) == nullptr &&
+         enqueue_pos_.load(std::memory_order_relaxed) ==
+             dequeue_pos_.load(std::memory_order_relaxed) &&
+         overflow_size_.load(std::memory_order_relaxed) == 0;
+}
+
+grpc_core::Timestamp LockFreeWorkQueue::OldestEnqueuedTimestamp() const {
+  size_t pos = dequeue_pos_.load(std::memory_order_acquire);
+  const Cell& cell = cells_[pos & mask_];
+  if (cell.sequence.load(std::memory_order_acquire) == pos + 1) {
+    int64_t enqueued = cell.enqueued.load(std::memory_order_relaxed);
+    if (enqueued != WorkQueue::kInvalidTimestamp) {
+      return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(enqueued);
+    }
+  }
+  int64_t most_recent = most_recent_element_enqueue_timestamp_.load(
+      std::memory_order_relaxed);
+  if (most_recent == WorkQueue::kInvalidTimestamp) {
+    return grpc_core::Timestamp::InfPast();
+  }
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(most_recent);
+}
+
+EventEngine::Closure* LockFreeWorkQueue::PopFront() {
+  EventEngine::Closure* closure = TryPopRing();
+  if (closure != nullptr) return closure;
+  if (overflow_size_.load(std::memory_order_relaxed) != 0) {
+    closure = TryPopOverflow();
+    if (closure != nullptr) return closure;
+  }
+  return TryPopMostRecentElement();
+}
+
+EventEngine::Closure* LockFreeWorkQueue::PopBack() {
+  EventEngine::Closure* closure = TryPopMostRecentElement();
+  if (closure != nullptr) return closure;
+  closure = TryPopRing();
+  if (closure != nullptr) return closure;
+  if (overflow_size_.load(std::memory_order_relaxed) != 0) {
+    return TryPopOverflow();
+  }
+  return nullptr;
+}
+
+void LockFreeWorkQueue::Add(EventEngine::Closure* closure) {
+  AddInternal(closure, NowMillis());
+}
+
+void LockFreeWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  AddInternal(SelfDeletingClosure::Create(std::move(invocable)), NowMillis());
+}
+
+void LockFreeWorkQueue::AddInternal(EventEngine::Closure* closure,
+                                    int64_t enqueued) {
+  int64_t previous_ts = most_recent_element_enqueue_timestamp_.exchange(
+      enqueued, std::memory_order_relaxed);
+  EventEngine::Closure* previous =
+      most_recent_element_.exchange(closure, std::memory_order_acq_rel);
+  if (previous != nullptr) Push(previous, previous_ts);
+}
+
+void LockFreeWorkQueue::Push(EventEngine::Closure* closure, int64_t enqueued) {
+  if (overflow_size_.load(std::memory_order_relaxed) == 0 &&
+      TryPushRing(closure, enqueued)) {
+    return;
+  }
+  grpc_core::MutexLock lock(&overflow_mu_);
+  overflow_.push_back({closure, enqueued});
+  overflow_size_.store(overflow_.size(), std::memory_order_relaxed);
+}
+
+bool LockFreeWorkQueue::TryPushRing(EventEngine::Closure* closure,
+                                    int64_t enqueued) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (dif == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (dif < 0) {
+      // Full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  cell->closure.store(closure, std::memory_order_relaxed);
+  cell->enqueued.store(enqueued, std::memory_order_relaxed);
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+EventEngine::Closure* LockFreeWorkQueue::TryPopRing() {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (dif == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (dif < 0) {
+      // Empty.
+      return nullptr;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  EventEngine::Closure* closure =
+      cell->closure.load(std::memory_order_relaxed);
+  cell->enqueued.store(WorkQueue::kInvalidTimestamp, std::memory_order_relaxed);
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return closure;
+}
+
+EventEngine::Closure* LockFreeWorkQueue::TryPopOverflow() {
+  grpc_core::MutexLock lock(&overflow_mu_);
+  if (overflow_.empty()) return nullptr;
+  EventEngine::Closure* closure = overflow_.front().closure;
+  overflow_.pop_front();
+  overflow_size_.store(overflow_.size(), std::memory_order_relaxed);
+  return closure;
+}
+
+EventEngine::Closure* LockFreeWorkQueue::TryPopMostRecentElement() {
+  if (most_recent_element_.load(std::memory_order_relaxed) == nullptr) {
+    return nullptr;
+  }
+  EventEngine::Closure* closure =
+      most_recent_element_.exchange(nullptr, std::memory_order_acq_rel);
+  if (closure != nullptr) {
+    most_recent_element_enqueue_timestamp_.store(WorkQueue::kInvalidTimestamp,
+                                                 std::memory_order_relaxed);
+  }
+  return closure;
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
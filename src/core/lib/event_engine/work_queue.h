@@ -18,8 +18,11 @@
 
 #include <stdint.h>
 
+#include <stddef.h>
+
 #include <atomic>
 #include <deque>
+#include <memory>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -115,6 +118,80 @@ class WorkQueue {
   grpc_core::Mutex mu_;
 };
 
+// A work queue with the same interface as WorkQueue, where Add, PopFront
+// and PopBack normally take no locks.
+//
+// The most recently added element is kept in an atomic slot for LIFO access.
+// Older elements go into a bounded lock-free ring buffer, or into a
+// mutex-guarded overflow list when the ring is full. Unlike WorkQueue, only
+// the most recently added element is popped LIFO by PopBack: older elements
+// are always taken oldest-first.
+class LockFreeWorkQueue {
+ public:
+  // Ring buffer size, rounded up to a power of two.
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  explicit LockFreeWorkQueue(size_t capacity = kDefaultCapacity);
+  ~LockFreeWorkQueue() = default;
+  LockFreeWorkQueue(const LockFreeWorkQueue&) = delete;
+  LockFreeWorkQueue& operator=(const LockFreeWorkQueue&) = delete;
+
+  // Returns whether the queue is empty
+  bool Empty() const;
+  // Returns the Timestamp of when the oldest element was enqueued, or
+  // InfPast if the queue is empty. This is approximate when other threads
+  // are concurrently modifying the queue.
+  grpc_core::Timestamp OldestEnqueuedTimestamp() const;
+  // Returns the next (oldest) element from the queue, or nullptr if empty
+  EventEngine::Closure* PopFront();
+  // Returns the most recent element from the queue if it is available, or
+  // else the oldest element, or nullptr if empty
+  EventEngine::Closure* PopBack();
+  // Adds a closure to the back of the queue
+  void Add(EventEngine::Closure* closure);
+  // Wraps an AnyInvocable and adds it to the back of the queue
+  void Add(absl::AnyInvocable<void()> invocable);
+
+ private:
+  struct Cell {
+    // Dmitry Vyukov's bounded MPMC queue protocol: a cell is writable by the
+    // producer at position p when sequence == p, and readable by the consumer
+    // at position p when sequence == p + 1.
+    std::atomic<size_t> sequence;
+    std::atomic<EventEngine::Closure*> closure{nullptr};
+    std::atomic<int64_t> enqueued{WorkQueue::kInvalidTimestamp};
+  };
+  struct OverflowElement {
+    EventEngine::Closure* closure;
+    int64_t enqueued;
+  };
+
+  void AddInternal(EventEngine::Closure* closure, int64_t enqueued);
+  // Moves an element that is no longer the most recent into the ring (or the
+  // overflow list if the ring is full).
+  void Push(EventEngine::Closure* closure, int64_t enqueued);
+  bool TryPushRing(EventEngine::Closure* closure, int64_t enqueued);
+  EventEngine::Closure* TryPopRing();
+  EventEngine::Closure* TryPopOverflow() ABSL_LOCKS_EXCLUDED(overflow_mu_);
+  EventEngine::Closure* TryPopMostRecentElement();
+
+  const size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  // Kept on separate cache lines: producers and consumers each hammer one.
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+  // The most recently enqueued element, reserved for PopBack (and PopFront
+  // once everything else is gone).
+  alignas(64) std::atomic<EventEngine::Closure*> most_recent_element_{nullptr};
+  std::atomic<int64_t> most_recent_element_enqueue_timestamp_{
+      WorkQueue::kInvalidTimestamp};
+  // Elements that did not fit in the ring. Once non-empty, new elements also
+  // go here until it drains, so that elements stay (approximately) in order.
+  std::atomic<size_t> overflow_size_{0};
+  grpc_core::Mutex overflow_mu_;
+  std::deque<OverflowElement> overflow_ ABSL_GUARDED_BY(overflow_mu_);
+};
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
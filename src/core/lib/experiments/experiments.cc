@@ -53,6 +53,25 @@ const char* const description_promise_based_client_call =
     "(ie when all filters in a stack are promise based)";
 const char* const description_posix_event_engine_enable_polling =
     "If set, enables polling on the default posix event engine.";
+const char* const description_event_engine_io_uring_poller =
+    "If set, the default posix event engine uses an io_uring based poller on "
+    "Linux kernels that support it, falling back to epoll1 otherwise.";
+const char* const description_event_engine_timer_wheel =
+    "If set, the posix event engine keeps its timers on a hierarchical timing "
+    "wheel rather than in sharded heaps.";
+const char* const description_event_engine_executor =
+    "If set, closures run on the default iomgr executor are handed to the "
+    "default EventEngine's thread pool instead of the executor's own threads. "
+    "The resolver executor stays as a separate lane for blocking work.";
+const char* const description_callback_run_to_completion =
+    "If set, callback completion queue tags and C++ callback reactions run on "
+    "the thread that completed the operation whenever it can queue callbacks, "
+    "instead of being handed to the executor. Reactions that block then block "
+    "that poller or EventEngine thread.";
+const char* const description_tcp_release_idle_read_buffers =
+    "If set, TCP endpoints free the buffers allocated for a read while the "
+    "read waits for the socket to become readable, and allocate them again "
+    "once it is, so that idle connections do not each hold on to up to 64KB.";
 #ifdef NDEBUG
 const bool kDefaultForDebugOnly = false;
 #else
@@ -81,6 +100,14 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"promise_based_client_call", description_promise_based_client_call, false},
     {"posix_event_engine_enable_polling",
      description_posix_event_engine_enable_polling, kDefaultForDebugOnly},
+    {"event_engine_io_uring_poller", description_event_engine_io_uring_poller,
+     false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel, false},
+    {"event_engine_executor", description_event_engine_executor, false},
+    {"callback_run_to_completion", description_callback_run_to_completion,
+     false},
+    {"tcp_release_idle_read_buffers",
+     description_tcp_release_idle_read_buffers, false},
 };
 
 }  // namespace grpc_core
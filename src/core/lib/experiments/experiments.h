@@ -48,6 +48,17 @@ inline bool IsPromiseBasedClientCallEnabled() {
 inline bool IsPosixEventEngineEnablePollingEnabled() {
   return IsExperimentEnabled(12);
 }
+inline bool IsEventEngineIoUringPollerEnabled() {
+  return IsExperimentEnabled(13);
+}
+inline bool IsEventEngineTimerWheelEnabled() { return IsExperimentEnabled(14); }
+inline bool IsEventEngineExecutorEnabled() { return IsExperimentEnabled(15); }
+inline bool IsCallbackRunToCompletionEnabled() {
+  return IsExperimentEnabled(16);
+}
+inline bool IsTcpReleaseIdleReadBuffersEnabled() {
+  return IsExperimentEnabled(17);
+}
 
 struct ExperimentMetadata {
   const char* name;
@@ -55,7 +66,7 @@ struct ExperimentMetadata {
   bool default_value;
 };
 
-constexpr const size_t kNumExperiments = 13;
+constexpr const size_t kNumExperiments = 18;
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
 }  // namespace grpc_core
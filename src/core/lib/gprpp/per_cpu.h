@@ -29,7 +29,13 @@ namespace grpc_core {
 template <typename T>
 class PerCpu {
  public:
-  T& this_cpu() { return data_[ExecCtx::Get()->starting_cpu()]; }
+  T& this_cpu() {
+    ExecCtx* exec_ctx = ExecCtx::Get();
+    // Threads without an ExecCtx, such as the EventEngine's, look up the CPU
+    // each time.
+    return data_[exec_ctx != nullptr ? exec_ctx->starting_cpu()
+                                     : gpr_cpu_current_cpu() % cpus_];
+  }
 
   T* begin() { return data_.get(); }
   T* end() { return data_.get() + cpus_; }
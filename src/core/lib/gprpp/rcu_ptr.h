@@ -0,0 +1,171 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_GPRPP_RCU_PTR_H
+#define GRPC_CORE_LIB_GPRPP_RCU_PTR_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "src/core/lib/gprpp/per_cpu.h"
+
+namespace grpc_core {
+
+// An owning pointer that readers can dereference without taking locks,
+// while a writer replaces it, in the style of RCU.
+//
+// Readers use the object only inside a ReadScope, which costs one atomic
+// increment and one decrement of a per-CPU counter and never blocks.
+// Store() does not wait for readers either: the replaced object is
+// retired, and Reclaim() destroys it once every reader that could have
+// seen it has left its ReadScope.  When a reader leaving its ReadScope may
+// have made a retired object reclaimable, it invokes the reclaim_requester
+// given at construction, which should arrange for Reclaim() to be called
+// in the writer's context.  The requester runs on the reader's thread, so
+// it must not destroy anything itself.
+//
+// Store(), get() and Reclaim() must be externally synchronized with each
+// other; any number of ReadScopes may run concurrently with them.
+template <typename T>
+class RcuPtr {
+ public:
+  explicit RcuPtr(std::function<void()> reclaim_requester)
+      : reclaim_requester_(std::move(reclaim_requester)) {}
+
+  // There must be no readers left.
+  ~RcuPtr() {
+    delete value_.load(std::memory_order_relaxed);
+    for (auto& retired : retired_) delete retired.value;
+  }
+
+  RcuPtr(const RcuPtr&) = delete;
+  RcuPtr& operator=(const RcuPtr&) = delete;
+
+  class ReadScope {
+   public:
+    explicit ReadScope(RcuPtr* ptr)
+        : ptr_(ptr), slot_(&ptr->slots_.this_cpu()) {
+      slot_->readers.fetch_add(1, std::memory_order_seq_cst);
+      value_ = ptr_->value_.load(std::memory_order_seq_cst);
+    }
+
+    ~ReadScope() {
+      // Read the generation before leaving: if this reader turns out to be
+      // the last one on its slot, every object retired up to that
+      // generation was retired before the slot became empty.
+      const uint64_t generation =
+          ptr_->generation_.load(std::memory_order_seq_cst);
+      if (slot_->readers.fetch_sub(1, std::memory_order_seq_cst) != 1) return;
+      uint64_t quiescent =
+          slot_->quiescent_generation.load(std::memory_order_relaxed);
+      while (quiescent < generation &&
+             !slot_->quiescent_generation.compare_exchange_weak(
+                 quiescent, generation, std::memory_order_seq_cst,
+                 std::memory_order_relaxed)) {
+      }
+      // The slot is empty now, which may be all that a pending Reclaim()
+      // was waiting for.
+      if (ptr_->oldest_retired_.load() != 0 &&
+          !ptr_->reclaim_requested_.exchange(true)) {
+        ptr_->reclaim_requester_();
+      }
+    }
+
+    ReadScope(const ReadScope&) = delete;
+    ReadScope& operator=(const ReadScope&) = delete;
+
+    T* get() const { return value_; }
+    T* operator->() const { return value_; }
+
+   private:
+    RcuPtr* const ptr_;
+    typename RcuPtr::Slot* const slot_;
+    T* value_;
+  };
+
+  // Returns the current value.  Writers only.
+  T* get() const { return value_.load(std::memory_order_relaxed); }
+
+  // Publishes value and retires the previous one.  The previous value stays
+  // alive until a later Reclaim() finds that no reader can still see it.
+  // Writers should call Reclaim() after every Store(), once it is safe to
+  // destroy the retired value; readers only request later passes.
+  void Store(std::unique_ptr<T> value) {
+    T* old_value = value_.exchange(value.release(), std::memory_order_seq_cst);
+    if (old_value == nullptr) return;
+    const uint64_t generation =
+        generation_.fetch_add(1, std::memory_order_seq_cst) + 1;
+    retired_.push_back({old_value, generation});
+    if (retired_.size() == 1) oldest_retired_.store(generation);
+  }
+
+  // Destroys the retired values that no reader can still see.
+  void Reclaim() {
+    reclaim_requested_.store(false);
+    while (!retired_.empty() && Quiescent(retired_.front().generation)) {
+      delete retired_.front().value;
+      retired_.pop_front();
+    }
+    oldest_retired_.store(retired_.empty() ? 0 : retired_.front().generation);
+  }
+
+  // Returns the number of retired values not yet destroyed.
+  size_t retired() const { return retired_.size(); }
+
+ private:
+  struct Slot {
+    std::atomic<intptr_t> readers{0};
+    // The latest generation at which this slot was seen with no readers.
+    std::atomic<uint64_t> quiescent_generation{0};
+    char padding[GPR_CACHELINE_SIZE];
+  };
+
+  struct Retired {
+    T* value;
+    uint64_t generation;
+  };
+
+  // Returns true if no reader can still see a value retired at generation.
+  bool Quiescent(uint64_t generation) {
+    for (const Slot& slot : slots_) {
+      if (slot.readers.load(std::memory_order_seq_cst) != 0 &&
+          slot.quiescent_generation.load(std::memory_order_seq_cst) <
+              generation) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::atomic<T*> value_{nullptr};
+  // Incremented by every Store() that retires a value.
+  std::atomic<uint64_t> generation_{0};
+  // The generation of the oldest retired value, or 0 if there is none.
+  std::atomic<uint64_t> oldest_retired_{0};
+  std::atomic<bool> reclaim_requested_{false};
+  std::function<void()> reclaim_requester_;
+  PerCpu<Slot> slots_;
+  std::deque<Retired> retired_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_GPRPP_RCU_PTR_H
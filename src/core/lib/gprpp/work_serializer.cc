@@ -25,12 +25,19 @@
 #include <memory>
 #include <utility>
 
+#include "absl/hash/hash.h"
+
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 
 namespace grpc_core {
 
@@ -55,6 +62,7 @@ class WorkSerializer::WorkSerializerImpl : public Orphanable {
     MultiProducerSingleConsumerQueue::Node mpscq_node;
     const std::function<void()> callback;
     const DebugLocation location;
+    const gpr_cycle_counter enqueue_time = gpr_get_cycle_counter();
   };
 
   // Callers of DrainQueueOwned should make sure to grab the lock on the
@@ -218,6 +226,13 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
               cb_wrapper, cb_wrapper->location.file(),
               cb_wrapper->location.line());
     }
+    // Stats are per-CPU and keyed off the ExecCtx, which not every caller of
+    // the work serializer has.
+    if (ExecCtx::Get() != nullptr) {
+      global_stats().IncrementWorkSerializerQueueLatencyUs(
+          gpr_timespec_to_micros(gpr_cycle_counter_sub(
+              gpr_get_cycle_counter(), cb_wrapper->enqueue_time)));
+    }
     cb_wrapper->callback();
     delete cb_wrapper;
   }
@@ -244,4 +259,32 @@ void WorkSerializer::Schedule(std::function<void()> callback,
 
 void WorkSerializer::DrainQueue() { impl_->DrainQueue(); }
 
+//
+// KeyedWorkSerializer
+//
+
+KeyedWorkSerializer::KeyedWorkSerializer(size_t num_shards)
+    : num_shards_(num_shards), shards_(new WorkSerializer[num_shards]) {
+  GPR_ASSERT(num_shards_ > 0);
+}
+
+void KeyedWorkSerializer::Run(const void* key, std::function<void()> callback,
+                              const DebugLocation& location) {
+  ShardFor(key).Run(std::move(callback), location);
+}
+
+void KeyedWorkSerializer::Schedule(const void* key,
+                                   std::function<void()> callback,
+                                   const DebugLocation& location) {
+  ShardFor(key).Schedule(std::move(callback), location);
+}
+
+void KeyedWorkSerializer::DrainQueue() {
+  for (size_t i = 0; i < num_shards_; ++i) shards_[i].DrainQueue();
+}
+
+WorkSerializer& KeyedWorkSerializer::ShardFor(const void* key) {
+  return shards_[absl::Hash<const void*>()(key) % num_shards_];
+}
+
 }  // namespace grpc_core
@@ -19,7 +19,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <functional>
+#include <memory>
 
 #include "absl/base/thread_annotations.h"
 
@@ -81,6 +84,35 @@ class ABSL_LOCKABLE WorkSerializer {
   OrphanablePtr<WorkSerializerImpl> impl_;
 };
 
+// KeyedWorkSerializer spreads callbacks over a fixed set of WorkSerializer
+// shards, chosen by a caller-supplied key. Callbacks scheduled with the same
+// key keep the FIFO and mutual exclusion guarantees of a single
+// WorkSerializer, but callbacks for keys on different shards may run
+// concurrently on different threads, so one slow key does not hold up the
+// others. There is no ordering guarantee between callbacks with different
+// keys.
+class ABSL_LOCKABLE KeyedWorkSerializer {
+ public:
+  explicit KeyedWorkSerializer(size_t num_shards = 8);
+
+  // Same as WorkSerializer::Run(), on the shard for \a key.
+  void Run(const void* key, std::function<void()> callback,
+           const DebugLocation& location);
+
+  // Same as WorkSerializer::Schedule(), on the shard for \a key.
+  void Schedule(const void* key, std::function<void()> callback,
+                const DebugLocation& location);
+  // Drains the queues of all shards. Shards that are currently owned by
+  // another thread are left for that thread to drain.
+  void DrainQueue();
+
+ private:
+  WorkSerializer& ShardFor(const void* key);
+
+  const size_t num_shards_;
+  std::unique_ptr<WorkSerializer[]> shards_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_GPRPP_WORK_SERIALIZER_H
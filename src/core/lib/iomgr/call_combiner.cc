@@ -47,7 +47,6 @@ grpc_error_handle DecodeCancelStateError(gpr_atm cancel_state) {
 
 CallCombiner::CallCombiner() {
   gpr_atm_no_barrier_store(&cancel_state_, 0);
-  gpr_atm_no_barrier_store(&size_, 0);
 #ifdef GRPC_TSAN_ENABLED
   GRPC_CLOSURE_INIT(&tsan_closure_, TsanClosure, this,
                     grpc_schedule_on_exec_ctx);
@@ -120,13 +119,15 @@ void CallCombiner::Start(grpc_closure* closure, grpc_error_handle error,
             this, closure DEBUG_FMT_ARGS, reason,
             StatusToString(error).c_str());
   }
-  size_t prev_size =
-      static_cast<size_t>(gpr_atm_full_fetch_add(&size_, (gpr_atm)1));
+  // Acquire pairs with the release in Stop(), so that when we take over the
+  // combiner we see everything the previous owner did. A closure that has
+  // to queue is handed over through queue_ and run by the owner's Stop().
+  size_t prev_size = size_.fetch_add(1, std::memory_order_acq_rel);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
     gpr_log(GPR_INFO, "  size: %" PRIdPTR " -> %" PRIdPTR, prev_size,
             prev_size + 1);
   }
-  if (prev_size == 0) {
+  if (GPR_LIKELY(prev_size == 0)) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
       gpr_log(GPR_INFO, "  EXECUTING IMMEDIATELY");
     }
@@ -148,14 +149,13 @@ void CallCombiner::Stop(DEBUG_ARGS const char* reason) {
     gpr_log(GPR_INFO, "==> CallCombiner::Stop() [%p] [" DEBUG_FMT_STR "%s]",
             this DEBUG_FMT_ARGS, reason);
   }
-  size_t prev_size =
-      static_cast<size_t>(gpr_atm_full_fetch_add(&size_, (gpr_atm)-1));
+  size_t prev_size = size_.fetch_sub(1, std::memory_order_acq_rel);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
     gpr_log(GPR_INFO, "  size: %" PRIdPTR " -> %" PRIdPTR, prev_size,
             prev_size - 1);
   }
   GPR_ASSERT(prev_size >= 1);
-  if (prev_size > 1) {
+  if (GPR_UNLIKELY(prev_size > 1)) {
     while (true) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
         gpr_log(GPR_INFO, "  checking queue");
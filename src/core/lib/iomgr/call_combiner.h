@@ -23,6 +23,8 @@
 
 #include <stddef.h>
 
+#include <atomic>
+
 #include "absl/container/inlined_vector.h"
 
 #include <grpc/support/atm.h>
@@ -106,7 +108,8 @@ class CallCombiner {
   static void TsanClosure(void* arg, grpc_error_handle error);
 #endif
 
-  gpr_atm size_ = 0;  // size_t, num closures in queue or currently executing
+  // Number of closures in the queue or currently executing.
+  std::atomic<size_t> size_{0};
   MultiProducerSingleConsumerQueue queue_;
   // Either 0 (if not cancelled and no cancellation closure set),
   // a grpc_closure* (if the lowest bit is 0),
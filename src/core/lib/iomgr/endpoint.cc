@@ -20,6 +20,14 @@
 
 #include "src/core/lib/iomgr/endpoint.h"
 
+#include "src/core/lib/iomgr/port.h"
+
+#if defined(GRPC_POSIX_SOCKET_TCP) && defined(GPR_LINUX)
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
 grpc_core::TraceFlag grpc_tcp_trace(false, "tcp");
 
 void grpc_endpoint_read(grpc_endpoint* ep, grpc_slice_buffer* slices,
@@ -62,6 +70,26 @@ absl::string_view grpc_endpoint_get_local_address(grpc_endpoint* ep) {
 
 int grpc_endpoint_get_fd(grpc_endpoint* ep) { return ep->vtable->get_fd(ep); }
 
+size_t grpc_endpoint_get_congestion_window(grpc_endpoint* ep) {
+#if defined(GRPC_POSIX_SOCKET_TCP) && defined(GPR_LINUX)
+  const int fd = grpc_endpoint_get_fd(ep);
+  if (fd < 0) return 0;
+  struct tcp_info info;
+  socklen_t len = sizeof(info);
+  if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len) != 0) return 0;
+  return static_cast<size_t>(info.tcpi_snd_cwnd) * info.tcpi_snd_mss;
+#else
+  (void)ep;
+  return 0;
+#endif
+}
+
 bool grpc_endpoint_can_track_err(grpc_endpoint* ep) {
   return ep->vtable->can_track_err(ep);
 }
+
+void grpc_endpoint_get_socket_options(
+    grpc_endpoint* ep,
+    std::vector<std::pair<std::string, std::string>>* options) {
+  ep->vtable->get_socket_options(ep, options);
+}
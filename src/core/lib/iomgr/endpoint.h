@@ -21,6 +21,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "absl/strings/string_view.h"
 
 #include <grpc/slice.h>
@@ -50,6 +54,9 @@ struct grpc_endpoint_vtable {
   absl::string_view (*get_local_address)(grpc_endpoint* ep);
   int (*get_fd)(grpc_endpoint* ep);
   bool (*can_track_err)(grpc_endpoint* ep);
+  void (*get_socket_options)(
+      grpc_endpoint* ep,
+      std::vector<std::pair<std::string, std::string>>* options);
 };
 
 /* When data is available on the connection, calls the callback with slices.
@@ -68,6 +75,12 @@ absl::string_view grpc_endpoint_get_local_address(grpc_endpoint* ep);
  */
 int grpc_endpoint_get_fd(grpc_endpoint* ep);
 
+/* Returns the current congestion window of the TCP connection underneath
+   \a ep in bytes, or 0 if it is not known (not a TCP socket, or the platform
+   does not report it). Costs a syscall, so callers should cache the result.
+ */
+size_t grpc_endpoint_get_congestion_window(grpc_endpoint* ep);
+
 /* Write slices out to the socket.
 
    If the connection is ready for more data after the end of the call, it
@@ -102,6 +115,13 @@ void grpc_endpoint_delete_from_pollset_set(grpc_endpoint* ep,
 
 bool grpc_endpoint_can_track_err(grpc_endpoint* ep);
 
+/* Append (name, value) pairs describing how \a ep currently tunes its socket,
+   such as adaptive zerocopy thresholds, to \a options. Used by channelz, so
+   it may be called concurrently with any other operation except destroy. */
+void grpc_endpoint_get_socket_options(
+    grpc_endpoint* ep,
+    std::vector<std::pair<std::string, std::string>>* options);
+
 struct grpc_endpoint {
   const grpc_endpoint_vtable* vtable;
 };
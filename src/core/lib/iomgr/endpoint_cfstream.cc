@@ -24,6 +24,8 @@
 
 #import <CoreFoundation/CoreFoundation.h>
 
+#include <algorithm>
+
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
@@ -42,6 +44,9 @@
 
 extern grpc_core::TraceFlag grpc_tcp_trace;
 
+// The most slices a single read fills with data the stream already holds.
+static constexpr size_t kMaxReadSlices = 16;
+
 struct CFStreamEndpoint {
   grpc_endpoint base;
   gpr_refcount refcount;
@@ -183,6 +188,24 @@ static void ReadAction(void* arg, grpc_error_handle error) {
     if (read_size < static_cast<CFIndex>(len)) {
       grpc_slice_buffer_trim_end(ep->read_slices, len - read_size, nullptr);
     }
+    // While slices fill up, read what the stream already holds right away,
+    // rather than waiting for another callback for it. Errors and the end of
+    // the stream are left to the next read.
+    while (read_size == static_cast<CFIndex>(len) &&
+           ep->read_slices->count < kMaxReadSlices &&
+           CFReadStreamHasBytesAvailable(ep->read_stream)) {
+      grpc_slice_buffer_add_indexed(ep->read_slices, GRPC_SLICE_MALLOC(len));
+      read_size = CFReadStreamRead(
+          ep->read_stream,
+          GRPC_SLICE_START_PTR(
+              ep->read_slices->slices[ep->read_slices->count - 1]),
+          len);
+      if (read_size < static_cast<CFIndex>(len)) {
+        grpc_slice_buffer_trim_end(ep->read_slices,
+                                   len - std::max<CFIndex>(read_size, 0),
+                                   nullptr);
+      }
+    }
     CallReadCb(ep, absl::OkStatus());
     EP_UNREF(ep, "read");
   }
@@ -197,34 +220,28 @@ static void WriteAction(void* arg, grpc_error_handle error) {
     EP_UNREF(ep, "write");
     return;
   }
-  grpc_slice slice = grpc_slice_buffer_take_first(ep->write_slices);
-  size_t slice_len = GRPC_SLICE_LENGTH(slice);
-  CFIndex write_size = CFWriteStreamWrite(
-      ep->write_stream, GRPC_SLICE_START_PTR(slice), slice_len);
-  if (write_size == -1) {
-    grpc_slice_buffer_reset_and_unref(ep->write_slices);
-    CFErrorRef stream_error = CFWriteStreamCopyError(ep->write_stream);
-    if (stream_error != nullptr) {
-      error = CFStreamAnnotateError(
-          GRPC_ERROR_CREATE_FROM_CFERROR(stream_error, "write failed."), ep);
-      CFRelease(stream_error);
-    } else {
-      error = GRPC_ERROR_CREATE("write failed.");
-    }
-    CallWriteCb(ep, error);
-    EP_UNREF(ep, "write");
-  } else {
-    if (write_size < static_cast<CFIndex>(GRPC_SLICE_LENGTH(slice))) {
-      grpc_slice_buffer_undo_take_first(
-          ep->write_slices, grpc_slice_sub(slice, write_size, slice_len));
-    }
-    if (ep->write_slices->length > 0) {
-      ep->stream_sync->NotifyOnWrite(&ep->write_action);
-    } else {
-      CallWriteCb(ep, absl::OkStatus());
+  // Write as many slices as the stream takes without blocking, rather than
+  // waiting for another callback between slices.
+  do {
+    grpc_slice slice = grpc_slice_buffer_take_first(ep->write_slices);
+    size_t slice_len = GRPC_SLICE_LENGTH(slice);
+    CFIndex write_size = CFWriteStreamWrite(
+        ep->write_stream, GRPC_SLICE_START_PTR(slice), slice_len);
+    if (write_size == -1) {
+      grpc_core::CSliceUnref(slice);
+      grpc_slice_buffer_reset_and_unref(ep->write_slices);
+      CFErrorRef stream_error = CFWriteStreamCopyError(ep->write_stream);
+      if (stream_error != nullptr) {
+        error = CFStreamAnnotateError(
+            GRPC_ERROR_CREATE_FROM_CFERROR(stream_error, "write failed."), ep);
+        CFRelease(stream_error);
+      } else {
+        error = GRPC_ERROR_CREATE("write failed.");
+      }
+      CallWriteCb(ep, error);
       EP_UNREF(ep, "write");
+      return;
     }
-
     if (grpc_tcp_trace.enabled()) {
       grpc_slice trace_slice = grpc_slice_sub(slice, 0, write_size);
       char* dump = grpc_dump_slice(trace_slice, GPR_DUMP_HEX | GPR_DUMP_ASCII);
@@ -233,8 +250,21 @@ static void WriteAction(void* arg, grpc_error_handle error) {
       gpr_free(dump);
       grpc_core::CSliceUnref(trace_slice);
     }
+    if (write_size < static_cast<CFIndex>(slice_len)) {
+      grpc_slice_buffer_undo_take_first(
+          ep->write_slices, grpc_slice_sub(slice, write_size, slice_len));
+      grpc_core::CSliceUnref(slice);
+      break;
+    }
+    grpc_core::CSliceUnref(slice);
+  } while (ep->write_slices->length > 0 &&
+           CFWriteStreamCanAcceptBytes(ep->write_stream));
+  if (ep->write_slices->length > 0) {
+    ep->stream_sync->NotifyOnWrite(&ep->write_action);
+  } else {
+    CallWriteCb(ep, absl::OkStatus());
+    EP_UNREF(ep, "write");
   }
-  grpc_core::CSliceUnref(slice);
 }
 
 static void CFStreamRead(grpc_endpoint* ep, grpc_slice_buffer* slices,
@@ -306,6 +336,10 @@ int CFStreamGetFD(grpc_endpoint* ep) { return 0; }
 
 bool CFStreamCanTrackErr(grpc_endpoint* ep) { return false; }
 
+void CFStreamGetSocketOptions(
+    grpc_endpoint* ep,
+    std::vector<std::pair<std::string, std::string>>* options) {}
+
 void CFStreamAddToPollset(grpc_endpoint* ep, grpc_pollset* pollset) {}
 void CFStreamAddToPollsetSet(grpc_endpoint* ep, grpc_pollset_set* pollset) {}
 void CFStreamDeleteFromPollsetSet(grpc_endpoint* ep,
@@ -321,7 +355,8 @@ static const grpc_endpoint_vtable vtable = {CFStreamRead,
                                             CFStreamGetPeer,
                                             CFStreamGetLocalAddress,
                                             CFStreamGetFD,
-                                            CFStreamCanTrackErr};
+                                            CFStreamCanTrackErr,
+                                            CFStreamGetSocketOptions};
 
 grpc_endpoint* grpc_cfstream_endpoint_create(CFReadStreamRef read_stream,
                                              CFWriteStreamRef write_stream,
@@ -36,6 +36,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -45,6 +46,7 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/cpu.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
@@ -93,6 +95,11 @@ typedef struct epoll_set {
 /* The global singleton epoll set */
 static epoll_set g_epoll_set;
 
+/* Microseconds the designated poller spins on non-blocking epoll_wait calls
+   before it blocks. Read from GRPC_EPOLL_BUSY_POLL_US at init; 0 disables
+   spinning. */
+static int g_busy_poll_us;
+
 static int epoll_create_and_cloexec() {
 #ifdef GRPC_LINUX_EPOLL_CREATE1
   int fd = epoll_create1(EPOLL_CLOEXEC);
@@ -695,6 +702,29 @@ static grpc_error_handle process_epoll_events(grpc_pollset* /*pollset*/) {
   return error;
 }
 
+/* Spin with non-blocking epoll_wait calls until events arrive or spin_us
+   microseconds have passed. Returns what the last epoll_wait returned: the
+   number of events, 0 if the spin ran out, or -1 with errno set. The time spent
+   is recorded in the busy_poll_spin_us histogram. */
+static int busy_poll_epoll_wait(int spin_us) {
+  gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  gpr_timespec stop =
+      gpr_time_add(start, gpr_time_from_micros(spin_us, GPR_TIMESPAN));
+  gpr_timespec now;
+  int r;
+  do {
+    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS, 0);
+    now = gpr_now(GPR_CLOCK_MONOTONIC);
+  } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+           gpr_time_cmp(now, stop) < 0);
+  gpr_timespec spun = gpr_time_sub(now, start);
+  grpc_core::global_stats().IncrementBusyPollSpinUs(
+      static_cast<int>(spun.tv_sec * GPR_US_PER_SEC +
+                       spun.tv_nsec / GPR_NS_PER_US));
+  if (r > 0) grpc_core::global_stats().IncrementBusyPollHits();
+  return r;
+}
+
 /* Do epoll_wait and store the events in g_epoll_set.events field. This does not
    "process" any of the events yet; that is done in process_epoll_events().
    *See process_epoll_events() function for more details.
@@ -704,17 +734,29 @@ static grpc_error_handle process_epoll_events(grpc_pollset* /*pollset*/) {
    no need for any synchronization when accesing fields in g_epoll_set */
 static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
                                        grpc_core::Timestamp deadline) {
-  int r;
+  int r = 0;
   int timeout = poll_deadline_to_millis_timeout(deadline);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_START_BLOCKING_REGION;
+  if (timeout != 0 && g_busy_poll_us > 0) {
+    /* Spin no longer than the deadline allows, then block for the rest. */
+    int spin_us = g_busy_poll_us;
+    if (timeout > 0 && timeout < spin_us / 1000) spin_us = timeout * 1000;
+    r = busy_poll_epoll_wait(spin_us);
+    if (r == 0) {
+      grpc_core::ExecCtx::Get()->InvalidateNow();
+      timeout = poll_deadline_to_millis_timeout(deadline);
+    }
   }
-  do {
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_END_BLOCKING_REGION;
+  if (r == 0) {
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    do {
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                     timeout);
+    } while (r < 0 && errno == EINTR);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
   }
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
@@ -1306,6 +1348,8 @@ static bool init_epoll1_linux() {
 
   fd_global_init();
 
+  g_busy_poll_us = std::max(0, GPR_GLOBAL_CONFIG_GET(grpc_epoll_busy_poll_us));
+
   if (!GRPC_LOG_IF_ERROR("pollset_global_init", pollset_global_init())) {
     fd_global_shutdown();
     epoll_set_shutdown();
@@ -44,6 +44,11 @@ GPR_GLOBAL_CONFIG_DEFINE_STRING(
     "This is a comma-separated list of engines, which are tried in priority "
     "order first -> last.")
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_epoll_busy_poll_us, 0,
+    "Microseconds an epoll1 poller keeps polling without blocking before it "
+    "sleeps in epoll_wait. Trades CPU for wakeup latency. 0 disables it.")
+
 grpc_core::DebugOnlyTraceFlag grpc_polling_trace(
     false, "polling"); /* Disabled by default */
 
@@ -54,8 +54,24 @@ static void exec_ctx_sched(grpc_closure* closure) {
 namespace grpc_core {
 
 thread_local ExecCtx* ExecCtx::exec_ctx_;
+thread_local int ExecCtx::inline_depth_;
 thread_local ApplicationCallbackExecCtx*
     ApplicationCallbackExecCtx::callback_exec_ctx_;
+std::atomic<void (*)(Duration)>
+    ApplicationCallbackExecCtx::functor_run_observer_{nullptr};
+
+void ApplicationCallbackExecCtx::RunFunctor(
+    grpc_completion_queue_functor* functor, int is_success) {
+  auto* observer = functor_run_observer_.load(std::memory_order_relaxed);
+  if (observer == nullptr) {
+    (*functor->functor_run)(functor, is_success);
+    return;
+  }
+  const gpr_cycle_counter start = gpr_get_cycle_counter();
+  (*functor->functor_run)(functor, is_success);
+  observer(Duration::FromTimespec(
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), start)));
+}
 
 bool ExecCtx::Flush() {
   bool did_something = false;
@@ -103,6 +119,46 @@ void ExecCtx::Run(const DebugLocation& location, grpc_closure* closure,
   exec_ctx_sched(closure);
 }
 
+void ExecCtx::RunInline(const DebugLocation& location, grpc_closure* closure,
+                        grpc_error_handle error) {
+  (void)location;
+  if (closure == nullptr) {
+    return;
+  }
+  if (inline_depth_ >= kMaxInlineDepth) {
+    Run(location, closure, std::move(error));
+    return;
+  }
+#ifndef NDEBUG
+  if (closure->scheduled) {
+    gpr_log(GPR_ERROR,
+            "Closure already scheduled. (closure: %p, created: [%s:%d], "
+            "previously scheduled at: [%s: %d], newly run inline at [%s: %d]",
+            closure, closure->file_created, closure->line_created,
+            closure->file_initiated, closure->line_initiated, location.file(),
+            location.line());
+    abort();
+  }
+  closure->file_initiated = location.file();
+  closure->line_initiated = location.line();
+  closure->run = true;
+  GPR_ASSERT(closure->cb != nullptr);
+  if (grpc_trace_closure.enabled()) {
+    gpr_log(GPR_DEBUG, "running closure %p inline: created [%s:%d]: [%s:%d]",
+            closure, closure->file_created, closure->line_created,
+            location.file(), location.line());
+  }
+#endif
+  ++inline_depth_;
+  closure->cb(closure->cb_arg, std::move(error));
+  --inline_depth_;
+#ifndef NDEBUG
+  if (grpc_trace_closure.enabled()) {
+    gpr_log(GPR_DEBUG, "closure %p finished", closure);
+  }
+#endif
+}
+
 void ExecCtx::RunList(const DebugLocation& location, grpc_closure_list* list) {
   (void)location;
   grpc_closure* c = list->head;
@@ -21,6 +21,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <limits>
 
 #include <grpc/impl/codegen/gpr_types.h>
@@ -192,6 +193,18 @@ class ExecCtx {
 
   static void RunList(const DebugLocation& location, grpc_closure_list* list);
 
+  /** Runs closure right away, in the caller's frame, unless
+   *  kMaxInlineDepth closures are already running inline on this thread, in
+   *  which case it is scheduled as by Run(). This skips the closure list and
+   *  the flush loop, so it is only for closures that are safe to run here:
+   *  the caller must hold no lock the closure may take, and must not use
+   *  anything the closure may free once this returns. */
+  static void RunInline(const DebugLocation& location, grpc_closure* closure,
+                        grpc_error_handle error);
+
+  /** Maximum number of RunInline() closures nested on one thread. */
+  static constexpr int kMaxInlineDepth = 16;
+
  protected:
   /** Check if ready to finish. */
   virtual bool CheckReadyToFinish() { return false; }
@@ -211,6 +224,7 @@ class ExecCtx {
 
   ScopedTimeCache time_cache_;
   static thread_local ExecCtx* exec_ctx_;
+  static thread_local int inline_depth_;
   ExecCtx* last_exec_ctx_ = Get();
 };
 
@@ -279,7 +293,7 @@ class ApplicationCallbackExecCtx {
         if (f->internal_next == nullptr) {
           tail_ = nullptr;
         }
-        (*f->functor_run)(f, f->internal_success);
+        RunFunctor(f, f->internal_success);
       }
       callback_exec_ctx_ = nullptr;
       if (!(GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD & flags_)) {
@@ -321,11 +335,24 @@ class ApplicationCallbackExecCtx {
 
   static bool Available() { return Get() != nullptr; }
 
+  /** Runs \a functor, and tells the functor run observer (if any) how long
+   *  it took. */
+  static void RunFunctor(grpc_completion_queue_functor* functor,
+                         int is_success);
+
+  /** Sets the function told how long each functor run by RunFunctor() took.
+   *  This lets the surface layer keep stats on application callbacks, which
+   *  may run on I/O threads, without this library depending on the stats. */
+  static void SetFunctorRunObserver(void (*observer)(Duration elapsed)) {
+    functor_run_observer_.store(observer, std::memory_order_relaxed);
+  }
+
  private:
   uintptr_t flags_{0u};
   grpc_completion_queue_functor* head_{nullptr};
   grpc_completion_queue_functor* tail_{nullptr};
   static thread_local ApplicationCallbackExecCtx* callback_exec_ctx_;
+  static std::atomic<void (*)(Duration)> functor_run_observer_;
 };
 
 }  // namespace grpc_core
@@ -22,6 +22,8 @@
 
 #include <string.h>
 
+#include <atomic>
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
@@ -55,14 +57,28 @@ thread_local ThreadState* g_this_thread_state;
 
 Executor* executors[static_cast<size_t>(ExecutorType::NUM_EXECUTORS)];
 
+std::atomic<Executor::Runner> g_default_runner{nullptr};
+
+void default_enqueue(grpc_closure* closure, grpc_error_handle error,
+                     bool is_short) {
+  Executor* executor = executors[static_cast<size_t>(ExecutorType::DEFAULT)];
+  Executor::Runner runner = g_default_runner.load(std::memory_order_acquire);
+  // Once threading is off (e.g. during shutdown), Enqueue() runs closures on
+  // the caller's ExecCtx, whatever the runner.
+  if (runner != nullptr && executor->IsThreaded()) {
+    EXECUTOR_TRACE("(default-executor) hand %p to the runner", closure);
+    runner(closure, error);
+    return;
+  }
+  executor->Enqueue(closure, error, is_short);
+}
+
 void default_enqueue_short(grpc_closure* closure, grpc_error_handle error) {
-  executors[static_cast<size_t>(ExecutorType::DEFAULT)]->Enqueue(
-      closure, error, true /* is_short */);
+  default_enqueue(closure, error, true /* is_short */);
 }
 
 void default_enqueue_long(grpc_closure* closure, grpc_error_handle error) {
-  executors[static_cast<size_t>(ExecutorType::DEFAULT)]->Enqueue(
-      closure, error, false /* is_short */);
+  default_enqueue(closure, error, false /* is_short */);
 }
 
 void resolver_enqueue_short(grpc_closure* closure, grpc_error_handle error) {
@@ -442,6 +458,12 @@ void Executor::SetThreadingAll(bool enable) {
   }
 }
 
+void Executor::SetDefaultRunner(Runner runner) {
+  EXECUTOR_TRACE("Executor::SetDefaultRunner(%p) called",
+                 reinterpret_cast<void*>(runner));
+  g_default_runner.store(runner, std::memory_order_release);
+}
+
 void Executor::SetThreadingDefault(bool enable) {
   EXECUTOR_TRACE("Executor::SetThreadingDefault(%d) called", enable);
   executors[static_cast<size_t>(ExecutorType::DEFAULT)]->SetThreading(enable);
@@ -103,6 +103,14 @@ class Executor {
   // Return if the DEFAULT executor is threaded
   static bool IsThreadedDefault();
 
+  // While the DEFAULT executor is threaded, hand the closures scheduled on it
+  // to \a runner instead of running them on the executor's own threads, e.g.
+  // to share a thread pool that the process has anyway. The RESOLVER executor
+  // is not affected, so blocking work keeps its own bounded set of threads.
+  // Pass nullptr to go back to the executor's threads.
+  using Runner = void (*)(grpc_closure* closure, grpc_error_handle error);
+  static void SetDefaultRunner(Runner runner);
+
  private:
   static size_t RunClosures(const char* executor_name, grpc_closure_list list);
   static void ThreadMain(void* arg);
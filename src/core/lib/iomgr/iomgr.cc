@@ -29,6 +29,8 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/global_config.h"
@@ -51,6 +53,19 @@ static int g_shutdown;
 static grpc_iomgr_object g_root_object;
 static bool g_grpc_abort_on_leaks;
 
+// Runs closures scheduled on the default executor on the default EventEngine's
+// thread pool, so the process doesn't keep a second pool just for them.
+static void run_on_default_event_engine(grpc_closure* closure,
+                                        grpc_error_handle error) {
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+      [closure, error]() {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+            GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+        grpc_core::ExecCtx exec_ctx(GRPC_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+        grpc_core::Closure::Run(DEBUG_LOCATION, closure, error);
+      });
+}
+
 void grpc_iomgr_init() {
   grpc_core::ExecCtx exec_ctx;
   if (!grpc_have_determined_iomgr_platform()) {
@@ -59,6 +74,9 @@ void grpc_iomgr_init() {
   g_shutdown = 0;
   gpr_mu_init(&g_mu);
   gpr_cv_init(&g_rcv);
+  grpc_core::Executor::SetDefaultRunner(
+      grpc_core::IsEventEngineExecutorEnabled() ? run_on_default_event_engine
+                                                : nullptr);
   grpc_core::Executor::InitAll();
   g_root_object.next = g_root_object.prev = &g_root_object;
   g_root_object.name = const_cast<char*>("root");
@@ -24,11 +24,18 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include <string>
+#include <vector>
+
+#include "absl/strings/numbers.h"
+#include "absl/types/optional.h"
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
@@ -77,6 +84,28 @@ class NativeDNSRequest {
   grpc_closure request_closure_;
 };
 
+// Parses name as an IP address literal, without going through getaddrinfo.
+// Returns nullopt if name is anything else.
+absl::optional<grpc_resolved_address> ParseIpLiteral(
+    absl::string_view name, absl::string_view default_port) {
+  std::string host;
+  std::string port;
+  if (!SplitHostPort(name, &host, &port) || host.empty()) return absl::nullopt;
+  if (port.empty()) {
+    if (default_port.empty()) return absl::nullopt;
+    port = std::string(default_port);
+  }
+  int port_num;
+  if (!absl::SimpleAtoi(port, &port_num)) return absl::nullopt;
+  const std::string hostport = JoinHostPort(host, port_num);
+  grpc_resolved_address addr;
+  if (grpc_parse_ipv4_hostport(hostport, &addr, /*log_errors=*/false) ||
+      grpc_parse_ipv6_hostport(hostport, &addr, /*log_errors=*/false)) {
+    return addr;
+  }
+  return absl::nullopt;
+}
+
 }  // namespace
 
 DNSResolver::TaskHandle NativeDNSResolver::LookupHostname(
@@ -85,6 +114,18 @@ DNSResolver::TaskHandle NativeDNSResolver::LookupHostname(
     absl::string_view name, absl::string_view default_port,
     Duration /* timeout */, grpc_pollset_set* /* interested_parties */,
     absl::string_view /* name_server */) {
+  // IP literals need no lookup, so don't queue them on the resolver executor
+  // behind getaddrinfo calls that may take a while.
+  auto literal = ParseIpLiteral(name, default_port);
+  if (literal.has_value()) {
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [on_done, addr = *literal] {
+          ApplicationCallbackExecCtx app_exec_ctx;
+          ExecCtx exec_ctx;
+          on_done(std::vector<grpc_resolved_address>{addr});
+        });
+    return kNullHandle;
+  }
   // self-deleting class
   new NativeDNSRequest(name, default_port, std::move(on_done));
   return kNullHandle;
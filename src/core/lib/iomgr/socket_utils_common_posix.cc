@@ -30,6 +30,9 @@
 
 #include "src/core/lib/iomgr/socket_utils.h"
 #include "src/core/lib/iomgr/socket_utils_posix.h"
+#if GPR_LINUX == 1
+#include <linux/filter.h>
+#endif
 #ifdef GRPC_LINUX_TCP_H
 #include <linux/tcp.h>
 #else
@@ -45,11 +48,13 @@
 
 #include <grpc/event_engine/endpoint_config.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/strerror.h"
 #include "src/core/lib/iomgr/sockaddr.h"
 
@@ -209,6 +214,59 @@ grpc_error_handle grpc_set_socket_reuse_port(int fd, int reuse) {
 #endif
 }
 
+grpc_error_handle grpc_set_socket_reuse_port_cpu_steering(int fd,
+                                                          int num_ranges) {
+#if GPR_LINUX == 1 && defined(SO_ATTACH_REUSEPORT_CBPF)
+  // The kernel falls back to hashing when the returned index is not that of
+  // a socket in the group, e.g. for CPUs brought online later.
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MUL | BPF_K, 0, 0, static_cast<uint32_t>(num_ranges)},
+      {BPF_ALU | BPF_DIV | BPF_K, 0, 0, gpr_cpu_num_cores()},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog prog;
+  prog.len = GPR_ARRAY_SIZE(code);
+  prog.filter = code;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                      sizeof(prog))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_ATTACH_REUSEPORT_CBPF)");
+  }
+  return absl::OkStatus();
+#else
+  (void)fd;
+  (void)num_ranges;
+  return GRPC_ERROR_CREATE(
+      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling system");
+#endif
+}
+
+/* set SO_BUSY_POLL, and SO_PREFER_BUSY_POLL where the kernel has it */
+grpc_error_handle grpc_set_socket_busy_poll(int fd, int busy_poll_us) {
+#if GPR_LINUX == 1 && defined(SO_BUSY_POLL)
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                      sizeof(busy_poll_us))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_BUSY_POLL)");
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  /* Preferring busy polling needs CAP_NET_ADMIN; SO_BUSY_POLL works without
+     it, so carry on. */
+  const int prefer = 1;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                      sizeof(prefer))) {
+    gpr_log(GPR_DEBUG, "setsockopt(SO_PREFER_BUSY_POLL): %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+  return absl::OkStatus();
+#else
+  (void)fd;
+  (void)busy_poll_us;
+  return GRPC_ERROR_CREATE("SO_BUSY_POLL unavailable on compiling system");
+#endif
+}
+
 static gpr_once g_probe_so_reuesport_once = GPR_ONCE_INIT;
 static int g_support_so_reuseport = false;
 
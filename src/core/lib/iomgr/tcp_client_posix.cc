@@ -109,6 +109,11 @@ static grpc_error_handle prepare_socket(
     if (!err.ok()) goto error;
     err = grpc_set_socket_tcp_user_timeout(fd, options, true /* is_client */);
     if (!err.ok()) goto error;
+    if (options.busy_poll_us > 0) {
+      /* it's not fatal, so just log it. */
+      GRPC_LOG_IF_ERROR("set SO_BUSY_POLL",
+                        grpc_set_socket_busy_poll(fd, options.busy_poll_us));
+    }
   }
   err = grpc_set_socket_no_sigpipe_if_possible(fd);
   if (!err.ok()) goto error;
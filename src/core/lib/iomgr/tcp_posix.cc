@@ -39,7 +39,10 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
@@ -63,6 +66,7 @@
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/socket_utils_posix.h"
 #include "src/core/lib/iomgr/tcp_posix.h"
+#include "src/core/lib/iomgr/unix_sockets_posix.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/trace.h"
@@ -93,6 +97,16 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// Older C library headers do not declare TCP_ZEROCOPY_RECEIVE and its
+// argument struct, in which case reads are always copied.
+#if defined(GRPC_LINUX_TCP_ZEROCOPY_RECEIVE) && !defined(TCP_ZEROCOPY_RECEIVE)
+#undef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#endif
+
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#include <sys/mman.h>
+#endif
+
 #ifdef GRPC_MSG_IOVLEN_TYPE
 typedef GRPC_MSG_IOVLEN_TYPE msg_iovlen_type;
 #else
@@ -189,12 +203,22 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
-
+  // The threshold is never raised above this many bytes.
+  static constexpr size_t kMaxSendBytesThreshold = 1024 * 1024;  // 1MB
+  // Number of completed zerocopy sendmsg() calls after which the threshold
+  // and the in-flight limit are reconsidered.
+  static constexpr uint32_t kAdaptWindowSends = 16;
+
+  // \a max_sends and \a send_bytes_threshold are the starting points for the
+  // adaptive in-flight limit and threshold: the limit never exceeds
+  // \a max_sends and the threshold never drops below \a send_bytes_threshold.
   explicit TcpZerocopySendCtx(
       int max_sends = kDefaultMaxSends,
       size_t send_bytes_threshold = kDefaultSendBytesThreshold)
       : max_sends_(max_sends),
         free_send_records_size_(max_sends),
+        max_in_flight_(max_sends),
+        min_threshold_bytes_(send_bytes_threshold),
         threshold_bytes_(send_bytes_threshold) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
         gpr_malloc(max_sends * sizeof(*send_records_)));
@@ -289,7 +313,7 @@ class TcpZerocopySendCtx {
   // After all the references to a TcpZerocopySendRecord are released, we can
   // add it back to the pool (of size max_sends_). Note that we can only have
   // max_sends_ tcp_write() instances with zerocopy enabled in flight at the
-  // same time.
+  // same time, and fewer while the in-flight limit is lowered.
   void PutSendRecord(TcpZerocopySendRecord* record) {
     GPR_DEBUG_ASSERT(record >= send_records_ &&
                      record < send_records_ + max_sends_);
@@ -318,7 +342,50 @@ class TcpZerocopySendCtx {
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
   // zerocopy is not useful for small transfers.
-  size_t threshold_bytes() const { return threshold_bytes_; }
+  size_t threshold_bytes() const {
+    return threshold_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Expected to be called by handler reading messages from the err queue, once
+  // per notification covering \a num_sends sendmsg() calls. \a copied is set
+  // when the kernel reported SO_EE_CODE_ZEROCOPY_COPIED, i.e. it copied the
+  // data anyway (e.g. because the device cannot send from user pages), so the
+  // send paid for page pinning and the notification but saved nothing.
+  //
+  // Every kAdaptWindowSends completions, the threshold is doubled if most of
+  // them were copied, and halved back towards the configured threshold if
+  // none were. A window without copies also raises the in-flight limit by one
+  // if writes fell back to copying because the limit was reached.
+  void RecordCompletions(uint32_t num_sends, bool copied) {
+    MutexLock guard(&lock_);
+    window_sends_ += num_sends;
+    if (copied) window_copied_sends_ += num_sends;
+    if (window_sends_ < kAdaptWindowSends) return;
+    copied_percent_ = 100 * window_copied_sends_ / window_sends_;
+    size_t threshold = threshold_bytes_.load(std::memory_order_relaxed);
+    if (window_copied_sends_ * 2 > window_sends_) {
+      threshold = std::min(threshold * 2, size_t{kMaxSendBytesThreshold});
+    } else if (window_copied_sends_ == 0) {
+      threshold = std::max(threshold / 2, min_threshold_bytes_);
+      if (window_limited_ && max_in_flight_ < max_sends_) ++max_in_flight_;
+    }
+    threshold_bytes_.store(threshold, std::memory_order_relaxed);
+    window_sends_ = 0;
+    window_copied_sends_ = 0;
+    window_limited_ = false;
+  }
+
+  // Appends the current adaptive state, for channelz.
+  void GetSocketOptions(
+      std::vector<std::pair<std::string, std::string>>* options) {
+    MutexLock guard(&lock_);
+    options->emplace_back("tcp_tx_zerocopy_threshold_bytes",
+                          std::to_string(threshold_bytes()));
+    options->emplace_back("tcp_tx_zerocopy_max_in_flight",
+                          std::to_string(max_in_flight_));
+    options->emplace_back("tcp_tx_zerocopy_copied_percent",
+                          std::to_string(copied_percent_));
+  }
 
   // Expected to be called by handler reading messages from the err queue.
   // It is used to indicate that some OMem meory is now available. It returns
@@ -392,6 +459,9 @@ class TcpZerocopySendCtx {
         return true;
       } else {
         zcopy_enobuf_state_ = OMemState::FULL;
+        // The buffers pinned by in-flight sends exhausted the socket's
+        // optmem: allow fewer of them until completions show headroom again.
+        max_in_flight_ = std::max(1, max_in_flight_ / 2);
       }
     } else if (zcopy_enobuf_state_ != OMemState::OPEN) {
       zcopy_enobuf_state_ = OMemState::OPEN;
@@ -436,6 +506,10 @@ class TcpZerocopySendCtx {
     if (free_send_records_size_ == 0) {
       return nullptr;
     }
+    if (max_sends_ - free_send_records_size_ >= max_in_flight_) {
+      window_limited_ = true;
+      return nullptr;
+    }
     free_send_records_size_--;
     return free_send_records_[free_send_records_size_];
   }
@@ -451,10 +525,16 @@ class TcpZerocopySendCtx {
   int max_sends_;
   int free_send_records_size_;
   Mutex lock_;
+  int max_in_flight_;
+  uint32_t window_sends_ = 0;
+  uint32_t window_copied_sends_ = 0;
+  bool window_limited_ = false;
+  uint32_t copied_percent_ = 0;
   uint32_t last_send_ = 0;
   std::atomic<bool> shutdown_{false};
   bool enabled_ = false;
-  size_t threshold_bytes_ = kDefaultSendBytesThreshold;
+  const size_t min_threshold_bytes_;
+  std::atomic<size_t> threshold_bytes_;
   std::unordered_map<uint32_t, TcpZerocopySendRecord*> ctx_lookup_;
   bool memory_limited_ = false;
   bool is_in_write_ = false;
@@ -472,6 +552,8 @@ struct grpc_tcp {
   explicit grpc_tcp(const grpc_core::PosixTcpOptions& tcp_options)
       : min_read_chunk_size(tcp_options.tcp_min_read_chunk_size),
         max_read_chunk_size(tcp_options.tcp_max_read_chunk_size),
+        rx_zerocopy_recv_bytes_threshold(
+            tcp_options.tcp_rx_zerocopy_recv_bytes_threshold),
         tcp_zerocopy_send_ctx(
             tcp_options.tcp_tx_zerocopy_max_simultaneous_sends,
             tcp_options.tcp_tx_zerocopy_send_bytes_threshold) {}
@@ -490,6 +572,14 @@ struct grpc_tcp {
   int min_read_chunk_size;
   int max_read_chunk_size;
   int set_rcvlowat = 0;
+  /* Set for AF_UNIX sockets, which skip the TCP-only tuning below. */
+  bool is_unix_socket = false;
+
+  /* Whether reads of at least rx_zerocopy_recv_bytes_threshold bytes map the
+   * received pages instead of copying them. Cleared if the socket turns out
+   * not to support it. */
+  bool rx_zerocopy_enabled = false;
+  int rx_zerocopy_recv_bytes_threshold;
 
   /* garbage after the last read */
   grpc_slice_buffer last_read_buffer;
@@ -830,6 +920,8 @@ static void tcp_trace_read(grpc_tcp* tcp, grpc_error_handle error)
 static void update_rcvlowat(grpc_tcp* tcp)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(tcp->read_mu) {
   if (!grpc_core::IsTcpRcvLowatEnabled()) return;
+  // Wakeups on unix sockets do not honor SO_RCVLOWAT.
+  if (tcp->is_unix_socket) return;
 
   // TODO(ctiller): Check if supported by OS.
   // TODO(ctiller): Allow some adjustments instead of hardcoding things.
@@ -871,6 +963,82 @@ static void update_rcvlowat(grpc_tcp* tcp)
   tcp->set_rcvlowat = remaining;
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+namespace {
+struct ZerocopyRecvRegion {
+  void* address;
+  size_t length;
+};
+
+void DestroyZerocopyRecvRegion(void* arg) {
+  ZerocopyRecvRegion* region = static_cast<ZerocopyRecvRegion*>(arg);
+  // Unmapping the region hands the pages back to the kernel.
+  munmap(region->address, region->length);
+  delete region;
+}
+}  // namespace
+
+/* Maps up to wanted_length bytes from the head of the receive queue into a
+ * new read-only region with TCP_ZEROCOPY_RECEIVE. Only whole pages are mapped;
+ * the remaining bytes are left for recvmsg. Returns a slice over the mapped
+ * bytes, or an empty slice if nothing was mapped. */
+static grpc_slice tcp_receive_zerocopy(grpc_tcp* tcp, size_t wanted_length)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(tcp->read_mu) {
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t region_length = wanted_length - wanted_length % page_size;
+  if (region_length == 0) {
+    return grpc_empty_slice();
+  }
+  void* address =
+      mmap(nullptr, region_length, PROT_READ, MAP_SHARED, tcp->fd, 0);
+  if (address == MAP_FAILED) {
+    gpr_log(GPR_DEBUG, "TCP:%p cannot mmap fd=%d for rx zerocopy: %s", tcp,
+            tcp->fd, grpc_core::StrError(errno).c_str());
+    tcp->rx_zerocopy_enabled = false;
+    return grpc_empty_slice();
+  }
+  struct tcp_zerocopy_receive zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uintptr_t>(address);
+  zc.length = static_cast<uint32_t>(region_length);
+  socklen_t zc_len = sizeof(zc);
+  int err;
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    err = getsockopt(tcp->fd, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0 && errno != EAGAIN) {
+    // Errors on the connection itself are reported by the recvmsg that
+    // follows; anything else means the socket cannot do zerocopy receives.
+    if (errno == EINVAL || errno == EOPNOTSUPP || errno == ENOPROTOOPT) {
+      tcp->rx_zerocopy_enabled = false;
+    }
+  }
+  if (err < 0 || zc.length == 0) {
+    munmap(address, region_length);
+    return grpc_empty_slice();
+  }
+  if (zc.length < region_length) {
+    // zc.length is a multiple of the page size: release the unused tail now.
+    munmap(static_cast<char*>(address) + zc.length, region_length - zc.length);
+  }
+  grpc_core::global_stats().IncrementTcpReadZerocopySize(zc.length);
+  return grpc_slice_new_with_user_data(
+      address, zc.length, DestroyZerocopyRecvRegion,
+      new ZerocopyRecvRegion{address, zc.length});
+}
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+
+/* Frees the space allocated for a read that is about to wait for the socket
+ * to become readable; maybe_make_read_slices() allocates it again once it
+ * is. Bytes already read into the buffer are kept in last_read_buffer. */
+static void release_idle_read_slices(grpc_tcp* tcp)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(tcp->read_mu) {
+  if (grpc_core::IsTcpReleaseIdleReadBuffersEnabled()) {
+    grpc_slice_buffer_reset_and_unref(tcp->incoming_buffer);
+  }
+}
+
 /* Returns true if data available to read or error other than EAGAIN. */
 #define MAX_READ_IOVEC 64
 static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
@@ -882,8 +1050,34 @@ static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
   struct iovec iov[MAX_READ_IOVEC];
   ssize_t read_bytes;
   size_t total_read_bytes = 0;
-  size_t iov_len =
-      std::min<size_t>(MAX_READ_IOVEC, tcp->incoming_buffer->count);
+  /* Index of the first slice of incoming_buffer to read into. */
+  size_t first_read_slice = 0;
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  if (tcp->rx_zerocopy_enabled) {
+    /* The bytes needed to make progress, or known to be pending, or usually
+     * read in a round, whichever is largest. */
+    size_t wanted_length = std::max(
+        {static_cast<size_t>(tcp->min_progress_size),
+         static_cast<size_t>(tcp->inq),
+         static_cast<size_t>(tcp->target_length)});
+    wanted_length =
+        std::min(wanted_length, static_cast<size_t>(tcp->max_read_chunk_size));
+    if (wanted_length >=
+        static_cast<size_t>(tcp->rx_zerocopy_recv_bytes_threshold)) {
+      grpc_slice mapped = tcp_receive_zerocopy(tcp, wanted_length);
+      if (!GRPC_SLICE_IS_EMPTY(mapped)) {
+        /* The mapped bytes become the first bytes read in this round, and the
+         * copying reads below fill the slices that follow them. */
+        total_read_bytes = GRPC_SLICE_LENGTH(mapped);
+        add_to_estimate(tcp, total_read_bytes);
+        grpc_slice_buffer_undo_take_first(tcp->incoming_buffer, mapped);
+        first_read_slice = 1;
+      }
+    }
+  }
+#endif /* GRPC_LINUX_TCP_ZEROCOPY_RECEIVE */
+  size_t iov_len = std::min<size_t>(
+      MAX_READ_IOVEC, tcp->incoming_buffer->count - first_read_slice);
 #ifdef GRPC_LINUX_ERRQUEUE
   constexpr size_t cmsg_alloc_space =
       CMSG_SPACE(sizeof(grpc_core::scm_timestamping)) + CMSG_SPACE(sizeof(int));
@@ -892,8 +1086,9 @@ static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
 #endif /* GRPC_LINUX_ERRQUEUE */
   char cmsgbuf[cmsg_alloc_space];
   for (size_t i = 0; i < iov_len; i++) {
-    iov[i].iov_base = GRPC_SLICE_START_PTR(tcp->incoming_buffer->slices[i]);
-    iov[i].iov_len = GRPC_SLICE_LENGTH(tcp->incoming_buffer->slices[i]);
+    grpc_slice& slice = tcp->incoming_buffer->slices[first_read_slice + i];
+    iov[i].iov_base = GRPC_SLICE_START_PTR(slice);
+    iov[i].iov_len = GRPC_SLICE_LENGTH(slice);
   }
 
   GPR_ASSERT(tcp->incoming_buffer->length != 0);
@@ -936,6 +1131,7 @@ static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
       }
       finish_estimate(tcp);
       tcp->inq = 0;
+      release_idle_read_slices(tcp);
       return false;
     }
 
@@ -961,6 +1157,7 @@ static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
     }
 
     grpc_core::global_stats().IncrementTcpReadSize(read_bytes);
+    grpc_core::FlightRecorder::Record("tcp-read", read_bytes);
     add_to_estimate(tcp, static_cast<size_t>(read_bytes));
     GPR_DEBUG_ASSERT((size_t)read_bytes <=
                      tcp->incoming_buffer->length - total_read_bytes);
@@ -1163,6 +1360,7 @@ static void tcp_read(grpc_endpoint* ep, grpc_slice_buffer* incoming_buffer,
     notify_on_read(tcp);
   } else if (!urgent && tcp->inq == 0) {
     update_rcvlowat(tcp);
+    release_idle_read_slices(tcp);
     tcp->read_mu.Unlock();
     /* Upper layer asked to read more but we know there is no pending data
      * to read from previous reads. So, wait for POLLIN.
@@ -1309,6 +1507,8 @@ static void process_zerocopy(grpc_tcp* tcp, struct cmsghdr* cmsg) {
     GPR_DEBUG_ASSERT(record);
     UnrefMaybePutZerocopySendRecord(tcp, record, seq, "CALLBACK RCVD");
   }
+  tcp->tcp_zerocopy_send_ctx.RecordCompletions(
+      hi - lo + 1, (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0);
   if (tcp->tcp_zerocopy_send_ctx.UpdateZeroCopyOMemStateAfterFree()) {
     grpc_fd_set_writable(tcp->em_fd);
   }
@@ -1643,6 +1843,7 @@ static bool do_tcp_flush_zerocopy(grpc_tcp* tcp, TcpZerocopySendRecord* record,
       }
     }
     grpc_core::EventLog::Append("tcp-write-outstanding", -sent_length);
+    grpc_core::FlightRecorder::Record("tcp-write", sent_length);
     tcp->bytes_counter += sent_length;
     record->UpdateOffsetForBytesSent(sending_length,
                                      static_cast<size_t>(sent_length));
@@ -1761,6 +1962,7 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
 
     GPR_ASSERT(tcp->outgoing_byte_idx == 0);
     grpc_core::EventLog::Append("tcp-write-outstanding", -sent_length);
+    grpc_core::FlightRecorder::Record("tcp-write", sent_length);
     tcp->bytes_counter += sent_length;
     trailing = sending_length - static_cast<size_t>(sent_length);
     while (trailing > 0) {
@@ -1936,6 +2138,15 @@ static bool tcp_can_track_err(grpc_endpoint* ep) {
   return addr.sa_family == AF_INET || addr.sa_family == AF_INET6;
 }
 
+static void tcp_get_socket_options(
+    grpc_endpoint* ep,
+    std::vector<std::pair<std::string, std::string>>* options) {
+  grpc_tcp* tcp = reinterpret_cast<grpc_tcp*>(ep);
+  if (tcp->tcp_zerocopy_send_ctx.enabled()) {
+    tcp->tcp_zerocopy_send_ctx.GetSocketOptions(options);
+  }
+}
+
 static const grpc_endpoint_vtable vtable = {tcp_read,
                                             tcp_write,
                                             tcp_add_to_pollset,
@@ -1946,7 +2157,8 @@ static const grpc_endpoint_vtable vtable = {tcp_read,
                                             tcp_get_peer,
                                             tcp_get_local_address,
                                             tcp_get_fd,
-                                            tcp_can_track_err};
+                                            tcp_can_track_err,
+                                            tcp_get_socket_options};
 
 grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                                const grpc_core::PosixTcpOptions& options,
@@ -1970,22 +2182,31 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
     tcp->local_address = "";
   } else {
     tcp->local_address = addr_uri.value();
+    tcp->is_unix_socket = grpc_is_unix_socket(&resolved_local_addr) != 0;
   }
   tcp->read_cb = nullptr;
   tcp->write_cb = nullptr;
   tcp->current_zerocopy_send = nullptr;
   tcp->release_fd_cb = nullptr;
   tcp->release_fd = nullptr;
-  tcp->target_length = static_cast<double>(options.tcp_read_chunk_size);
+  // Local peers can deliver as fast as we read, so start unix sockets at the
+  // largest read size rather than growing into it.
+  tcp->target_length = static_cast<double>(
+      tcp->is_unix_socket ? options.tcp_max_read_chunk_size
+                          : options.tcp_read_chunk_size);
   tcp->bytes_read_this_round = 0;
   /* Will be set to false by the very first endpoint read function */
   tcp->is_first_read = true;
   tcp->bytes_counter = -1;
   tcp->socket_ts_enabled = false;
-  tcp->ts_capable = true;
+  tcp->ts_capable = !tcp->is_unix_socket;
   tcp->outgoing_buffer_arg = nullptr;
   tcp->min_progress_size = 1;
-  if (options.tcp_tx_zero_copy_enabled &&
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  tcp->rx_zerocopy_enabled =
+      options.tcp_rx_zero_copy_enabled && !tcp->is_unix_socket;
+#endif
+  if (options.tcp_tx_zero_copy_enabled && !tcp->is_unix_socket &&
       !tcp->tcp_zerocopy_send_ctx.memory_limited()) {
 #ifdef GRPC_LINUX_ERRQUEUE
     const int enable = 1;
@@ -2022,7 +2243,9 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   tcp->inq = 1;
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
-  if (setsockopt(tcp->fd, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
+  if (tcp->is_unix_socket) {
+    tcp->inq_capable = false;
+  } else if (setsockopt(tcp->fd, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
     tcp->inq_capable = true;
   } else {
     gpr_log(GPR_DEBUG, "cannot set inq fd=%d errno=%d", tcp->fd, errno);
@@ -38,6 +38,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/strings/str_cat.h"
@@ -81,6 +82,10 @@ static grpc_error_handle tcp_server_create(grpc_closure* shutdown_complete,
   if (value.has_value()) {
     s->expand_wildcard_addrs = (*value != 0);
   }
+  value = config.GetInt(GRPC_ARG_REUSEPORT_CPU_STEERING);
+  if (value.has_value()) {
+    s->reuseport_cpu_steering = std::max(*value, 0);
+  }
   gpr_ref_init(&s->refs, 1);
   gpr_mu_init(&s->mu);
   s->active_ports = 0;
@@ -262,10 +267,18 @@ static void on_read(void* arg, grpc_error_handle err) {
     std::string name = absl::StrCat("tcp-server-connection:", addr_uri.value());
     grpc_fd* fdobj = grpc_fd_create(fd, name.c_str(), true);
 
-    read_notifier_pollset = (*(sp->server->pollsets))
-        [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
-             &sp->server->next_pollset_to_assign, 1)) %
-         sp->server->pollsets->size()];
+    if (sp->server->reuseport_cpu_steering > 0 &&
+        sp->clone_index < static_cast<unsigned>(
+                              sp->server->reuseport_cpu_steering)) {
+      // The connection was steered to this listener for its CPU: keep it on
+      // the pollset the listener belongs to.
+      read_notifier_pollset = (*(sp->server->pollsets))[sp->clone_index];
+    } else {
+      read_notifier_pollset = (*(sp->server->pollsets))
+          [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
+               &sp->server->next_pollset_to_assign, 1)) %
+           sp->server->pollsets->size()];
+    }
 
     grpc_pollset_add_fd(read_notifier_pollset, fdobj);
 
@@ -361,6 +374,7 @@ static grpc_error_handle add_wildcard_addrs_to_server(grpc_tcp_server* s,
 static grpc_error_handle clone_port(grpc_tcp_listener* listener,
                                     unsigned count) {
   grpc_tcp_listener* sp = nullptr;
+  grpc_tcp_listener* prev = listener;
   absl::StatusOr<std::string> addr_str;
   grpc_error_handle err;
 
@@ -384,13 +398,16 @@ static grpc_error_handle clone_port(grpc_tcp_listener* listener,
       return GRPC_ERROR_CREATE(addr_str.status().ToString());
     }
     sp = static_cast<grpc_tcp_listener*>(gpr_malloc(sizeof(grpc_tcp_listener)));
-    sp->next = listener->next;
-    listener->next = sp;
+    /* Clones follow the original in the order they were created, which is
+       the order they joined the SO_REUSEPORT group. */
+    sp->next = prev->next;
+    prev->next = sp;
     /* sp (the new listener) is a sibling of 'listener' (the original
        listener). */
     sp->is_sibling = 1;
-    sp->sibling = listener->sibling;
-    listener->sibling = sp;
+    sp->sibling = prev->sibling;
+    prev->sibling = sp;
+    prev = sp;
     sp->server = listener->server;
     sp->fd = fd;
     sp->emfd = grpc_fd_create(
@@ -401,7 +418,8 @@ static grpc_error_handle clone_port(grpc_tcp_listener* listener,
     memcpy(&sp->addr, &listener->addr, sizeof(grpc_resolved_address));
     sp->port = port;
     sp->port_index = listener->port_index;
-    sp->fd_index = listener->fd_index + count - i;
+    sp->fd_index = listener->fd_index + i + 1;
+    sp->clone_index = i + 1;
     GPR_ASSERT(sp->emfd);
     while (listener->server->tail->next != nullptr) {
       listener->server->tail = listener->server->tail->next;
@@ -523,6 +541,13 @@ static void tcp_server_start(grpc_tcp_server* s,
         pollsets->size() > 1) {
       GPR_ASSERT(GRPC_LOG_IF_ERROR(
           "clone_port", clone_port(sp, (unsigned)(pollsets->size() - 1))));
+      if (s->reuseport_cpu_steering > 0) {
+        /* Without the program the kernel hashes connections over the
+           listeners, which is still balanced. */
+        GRPC_LOG_IF_ERROR("reuseport_cpu_steering",
+                          grpc_set_socket_reuse_port_cpu_steering(
+                              sp->fd, s->reuseport_cpu_steering));
+      }
       for (i = 0; i < pollsets->size(); i++) {
         grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
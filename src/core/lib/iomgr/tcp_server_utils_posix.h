@@ -36,6 +36,9 @@ typedef struct grpc_tcp_listener {
   int port;
   unsigned port_index;
   unsigned fd_index;
+  /* index among the SO_REUSEPORT clones of the listener for this address: 0
+     for the original listener, i for the i-th clone */
+  unsigned clone_index;
   grpc_closure read_closure;
   grpc_closure destroyed_closure;
   struct grpc_tcp_listener* next;
@@ -71,6 +74,8 @@ struct grpc_tcp_server {
   bool so_reuseport = false;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs = false;
+  /* number of CPU ranges to steer cloned listeners' connections by, or 0 */
+  int reuseport_cpu_steering = 0;
 
   /* linked list of server ports */
   grpc_tcp_listener* head = nullptr;
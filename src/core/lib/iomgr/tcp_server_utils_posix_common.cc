@@ -116,6 +116,7 @@ static grpc_error_handle add_socket_to_server(grpc_tcp_server* s, int fd,
   sp->port = port;
   sp->port_index = port_index;
   sp->fd_index = fd_index;
+  sp->clone_index = 0;
   sp->is_sibling = 0;
   sp->sibling = nullptr;
   GPR_ASSERT(sp->emfd);
@@ -180,6 +181,11 @@ grpc_error_handle grpc_tcp_server_prepare_socket(
     err =
         grpc_set_socket_tcp_user_timeout(fd, s->options, false /* is_client */);
     if (!err.ok()) goto error;
+    if (s->options.busy_poll_us > 0) {
+      /* it's not fatal, so just log it. Accepted sockets inherit it. */
+      GRPC_LOG_IF_ERROR("set SO_BUSY_POLL",
+                        grpc_set_socket_busy_poll(fd, s->options.busy_poll_us));
+    }
   }
   err = grpc_set_socket_no_sigpipe_if_possible(fd);
   if (!err.ok()) goto error;
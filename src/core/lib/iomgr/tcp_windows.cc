@@ -485,6 +485,10 @@ static int win_get_fd(grpc_endpoint* ep) { return -1; }
 
 static bool win_can_track_err(grpc_endpoint* ep) { return false; }
 
+static void win_get_socket_options(
+    grpc_endpoint* ep,
+    std::vector<std::pair<std::string, std::string>>* options) {}
+
 static grpc_endpoint_vtable vtable = {win_read,
                                       win_write,
                                       win_add_to_pollset,
@@ -495,7 +499,8 @@ static grpc_endpoint_vtable vtable = {win_read,
                                       win_get_peer,
                                       win_get_local_address,
                                       win_get_fd,
-                                      win_can_track_err};
+                                      win_can_track_err,
+                                      win_get_socket_options};
 
 grpc_endpoint* grpc_tcp_create(grpc_winsocket* socket,
                                absl::string_view peer_string) {
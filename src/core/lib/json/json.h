@@ -19,6 +19,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
 #include <map>
 #include <string>
 #include <utility>
@@ -241,6 +243,47 @@ class Json {
   Array array_value_;
 };
 
+// Writes JSON text a piece at a time, so that a large document need not be
+// built as a Json before it is dumped. The writer does not check that the
+// calls form valid JSON: each member of an object must be preceded by Key(),
+// and each Start call must be matched by the corresponding End call.
+class JsonWriter {
+ public:
+  explicit JsonWriter(int indent = 0) : indent_(indent) {}
+
+  void StartObject();
+  void EndObject();
+  void StartArray();
+  void EndArray();
+  void Key(absl::string_view key);
+  void Value(const Json& value);
+
+  // Moves out the text written so far.
+  std::string TakeOutput() { return std::exchange(output_, std::string()); }
+
+ private:
+  void OutputCheck(size_t needed);
+  void OutputChar(char c);
+  void OutputString(absl::string_view str);
+  void OutputIndent();
+  void ValueEnd();
+  void EscapeUtf16(uint16_t utf16);
+  void EscapeString(absl::string_view string);
+  void ContainerBegins(Json::Type type);
+  void ContainerEnds(Json::Type type);
+  void ValueRaw(absl::string_view string);
+  void ValueString(absl::string_view string);
+
+  void DumpObject(const Json::Object& object);
+  void DumpArray(const Json::Array& array);
+
+  int indent_;
+  int depth_ = 0;
+  bool container_empty_ = true;
+  bool got_key_ = false;
+  std::string output_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_JSON_JSON_H
@@ -105,6 +105,7 @@ class JsonReader {
 
   GRPC_MUST_USE_RESULT bool StringAddChar(uint32_t c);
   GRPC_MUST_USE_RESULT bool StringAddUtf32(uint32_t c);
+  void StringAddAsciiRun();
 
   Json* CreateAndLinkValue();
   bool StartContainer(Json::Type type);
@@ -216,6 +217,23 @@ bool JsonReader::StringAddUtf32(uint32_t c) {
   }
 }
 
+void JsonReader::StringAddAsciiRun() {
+  // Printable ASCII other than quotes and backslashes needs no validation or
+  // unescaping, and makes up most of the strings in typical configs, so copy
+  // all of it up to the next special character at once instead of running
+  // each character through the state machine.
+  const uint8_t* end = input_;
+  const uint8_t* const limit = input_ + remaining_input_;
+  while (end != limit && *end >= 0x20 && *end < 0x80 && *end != '"' &&
+         *end != '\\') {
+    ++end;
+  }
+  const size_t n = end - input_;
+  string_.append(reinterpret_cast<const char*>(input_), n);
+  input_ = end;
+  remaining_input_ -= n;
+}
+
 uint32_t JsonReader::ReadChar() {
   if (remaining_input_ == 0) return GRPC_JSON_READ_CHAR_EOF;
   const uint32_t r = *input_++;
@@ -515,6 +533,7 @@ JsonReader::Status JsonReader::Run() {
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
               if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
+              if (utf8_bytes_remaining_ == 0) StringAddAsciiRun();
             }
             break;
 
@@ -533,6 +552,7 @@ JsonReader::Status JsonReader::Run() {
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
               if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
+              if (utf8_bytes_remaining_ == 0) StringAddAsciiRun();
             }
             break;
 
@@ -32,8 +32,6 @@
 
 namespace grpc_core {
 
-namespace {
-
 /* The idea of the writer is basically symmetrical of the reader. While the
  * reader emits various calls to your code, the writer takes basically the
  * same calls and emit json out of it. It doesn't try to make any check on
@@ -45,36 +43,6 @@ namespace {
  * cut the conversion short, before any invalid UTF-8 sequence, thus forming
  * a valid UTF-8 string overall.
  */
-class JsonWriter {
- public:
-  static std::string Dump(const Json& value, int indent);
-
- private:
-  explicit JsonWriter(int indent) : indent_(indent) {}
-
-  void OutputCheck(size_t needed);
-  void OutputChar(char c);
-  void OutputString(const absl::string_view str);
-  void OutputIndent();
-  void ValueEnd();
-  void EscapeUtf16(uint16_t utf16);
-  void EscapeString(const std::string& string);
-  void ContainerBegins(Json::Type type);
-  void ContainerEnds(Json::Type type);
-  void ObjectKey(const std::string& string);
-  void ValueRaw(const std::string& string);
-  void ValueString(const std::string& string);
-
-  void DumpObject(const Json::Object& object);
-  void DumpArray(const Json::Array& array);
-  void DumpValue(const Json& value);
-
-  int indent_;
-  int depth_ = 0;
-  bool container_empty_ = true;
-  bool got_key_ = false;
-  std::string output_;
-};
 
 /* This function checks if there's enough space left in the output buffer,
  * and will enlarge it if necessary. We're only allocating chunks of 256
@@ -94,7 +62,7 @@ void JsonWriter::OutputChar(char c) {
   output_.push_back(c);
 }
 
-void JsonWriter::OutputString(const absl::string_view str) {
+void JsonWriter::OutputString(absl::string_view str) {
   OutputCheck(str.size());
   output_.append(str.data(), str.size());
 }
@@ -141,7 +109,7 @@ void JsonWriter::EscapeUtf16(uint16_t utf16) {
   OutputChar(hex[(utf16)&0x0f]);
 }
 
-void JsonWriter::EscapeString(const std::string& string) {
+void JsonWriter::EscapeString(absl::string_view string) {
   OutputChar('"');
   for (size_t idx = 0; idx < string.size(); ++idx) {
     uint8_t c = static_cast<uint8_t>(string[idx]);
@@ -258,22 +226,14 @@ void JsonWriter::ContainerEnds(Json::Type type) {
   got_key_ = false;
 }
 
-void JsonWriter::ObjectKey(const std::string& string) {
-  ValueEnd();
-  OutputIndent();
-  EscapeString(string);
-  OutputChar(':');
-  got_key_ = true;
-}
-
-void JsonWriter::ValueRaw(const std::string& string) {
+void JsonWriter::ValueRaw(absl::string_view string) {
   if (!got_key_) ValueEnd();
   OutputIndent();
   OutputString(string);
   got_key_ = false;
 }
 
-void JsonWriter::ValueString(const std::string& string) {
+void JsonWriter::ValueString(absl::string_view string) {
   if (!got_key_) ValueEnd();
   OutputIndent();
   EscapeString(string);
@@ -281,23 +241,39 @@ void JsonWriter::ValueString(const std::string& string) {
 }
 
 void JsonWriter::DumpObject(const Json::Object& object) {
-  ContainerBegins(Json::Type::OBJECT);
+  StartObject();
   for (const auto& p : object) {
-    ObjectKey(p.first.data());
-    DumpValue(p.second);
+    Key(p.first);
+    Value(p.second);
   }
-  ContainerEnds(Json::Type::OBJECT);
+  EndObject();
 }
 
 void JsonWriter::DumpArray(const Json::Array& array) {
-  ContainerBegins(Json::Type::ARRAY);
+  StartArray();
   for (const auto& v : array) {
-    DumpValue(v);
+    Value(v);
   }
-  ContainerEnds(Json::Type::ARRAY);
+  EndArray();
 }
 
-void JsonWriter::DumpValue(const Json& value) {
+void JsonWriter::StartObject() { ContainerBegins(Json::Type::OBJECT); }
+
+void JsonWriter::EndObject() { ContainerEnds(Json::Type::OBJECT); }
+
+void JsonWriter::StartArray() { ContainerBegins(Json::Type::ARRAY); }
+
+void JsonWriter::EndArray() { ContainerEnds(Json::Type::ARRAY); }
+
+void JsonWriter::Key(absl::string_view key) {
+  ValueEnd();
+  OutputIndent();
+  EscapeString(key);
+  OutputChar(':');
+  got_key_ = true;
+}
+
+void JsonWriter::Value(const Json& value) {
   switch (value.type()) {
     case Json::Type::OBJECT:
       DumpObject(value.object_value());
@@ -312,29 +288,23 @@ void JsonWriter::DumpValue(const Json& value) {
       ValueRaw(value.string_value());
       break;
     case Json::Type::JSON_TRUE:
-      ValueRaw(std::string("true", 4));
+      ValueRaw("true");
       break;
     case Json::Type::JSON_FALSE:
-      ValueRaw(std::string("false", 5));
+      ValueRaw("false");
       break;
     case Json::Type::JSON_NULL:
-      ValueRaw(std::string("null", 4));
+      ValueRaw("null");
       break;
     default:
       GPR_UNREACHABLE_CODE(abort());
   }
 }
 
-std::string JsonWriter::Dump(const Json& value, int indent) {
-  JsonWriter writer(indent);
-  writer.DumpValue(value);
-  return std::move(writer.output_);
-}
-
-}  // namespace
-
 std::string Json::Dump(int indent) const {
-  return JsonWriter::Dump(*this, indent);
+  JsonWriter writer(indent);
+  writer.Value(*this);
+  return writer.TakeOutput();
 }
 
 }  // namespace grpc_core
@@ -47,6 +47,7 @@
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/load_balancing/subchannel_interface.h"
 #include "src/core/lib/resolver/server_address.h"
+#include "src/core/lib/slice/slice.h"
 
 namespace grpc_core {
 
@@ -127,6 +128,10 @@ class LoadBalancingPolicy : public InternallyRefCounted<LoadBalancingPolicy> {
     /// until the call ends.  If desired, they may be allocated via
     /// CallState::Alloc().
     virtual void Add(absl::string_view key, absl::string_view value) = 0;
+    /// Adds a key/value pair whose value is kept alive by a ref to the
+    /// slice, so that a value shared by many calls (for example one owned
+    /// by a serverlist) does not need to be copied for each of them.
+    virtual void Add(absl::string_view key, Slice value) = 0;
 
     /// Produce a vector of metadata key/value strings for tests.
     virtual std::vector<std::pair<std::string, std::string>>
@@ -262,6 +267,21 @@ class LoadBalancingPolicy : public InternallyRefCounted<LoadBalancingPolicy> {
     virtual ~SubchannelPicker() = default;
 
     virtual PickResult Pick(PickArgs args) = 0;
+
+    /// If this picker forwards every pick unchanged to another picker that
+    /// it owns, returns that picker, so that a parent policy holding this
+    /// picker can call the other one directly and skip a layer.
+    virtual SubchannelPicker* PassThroughTarget() { return nullptr; }
+
+    /// Returns the first picker, starting from this one, that is not a
+    /// pass-through. It lives as long as this picker does.
+    SubchannelPicker* Innermost() {
+      SubchannelPicker* picker = this;
+      while (SubchannelPicker* target = picker->PassThroughTarget()) {
+        picker = target;
+      }
+      return picker;
+    }
   };
 
   /// A proxy object implemented by the client channel and used by the
@@ -19,9 +19,12 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <string>
 
+#include "absl/base/call_once.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
@@ -34,6 +37,15 @@
 namespace grpc_core {
 
 class LoadBalancingPolicyRegistry {
+ private:
+  // A factory registered with RegisterLazyLoadBalancingPolicyFactory.
+  // Defined here so that it can be used in Builder.
+  struct LazyFactory {
+    std::function<std::unique_ptr<LoadBalancingPolicyFactory>()> create;
+    absl::once_flag once;
+    std::unique_ptr<LoadBalancingPolicyFactory> factory;
+  };
+
  public:
   /// Methods used to create and populate the LoadBalancingPolicyRegistry.
   /// NOT THREAD SAFE -- to be used only during global gRPC
@@ -45,11 +57,21 @@ class LoadBalancingPolicyRegistry {
     void RegisterLoadBalancingPolicyFactory(
         std::unique_ptr<LoadBalancingPolicyFactory> factory);
 
+    /// Registers an LB policy named \a name whose factory is only created,
+    /// by calling \a create, when a policy of that name is first looked up.
+    /// This keeps policies that most processes never use off the startup
+    /// path. The created factory's name must be \a name.
+    void RegisterLazyLoadBalancingPolicyFactory(
+        absl::string_view name,
+        std::function<std::unique_ptr<LoadBalancingPolicyFactory>()> create);
+
     LoadBalancingPolicyRegistry Build();
 
    private:
     std::map<absl::string_view, std::unique_ptr<LoadBalancingPolicyFactory>>
         factories_;
+    std::map<std::string, std::unique_ptr<LazyFactory>, std::less<>>
+        lazy_factories_;
   };
 
   /// Creates an LB policy of the type specified by \a name.
@@ -75,6 +97,8 @@ class LoadBalancingPolicyRegistry {
 
   std::map<absl::string_view, std::unique_ptr<LoadBalancingPolicyFactory>>
       factories_;
+  std::map<std::string, std::unique_ptr<LazyFactory>, std::less<>>
+      lazy_factories_;
 };
 
 }  // namespace grpc_core
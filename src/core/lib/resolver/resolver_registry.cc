@@ -39,17 +39,28 @@ void ResolverRegistry::Builder::SetDefaultPrefix(std::string default_prefix) {
 
 void ResolverRegistry::Builder::RegisterResolverFactory(
     std::unique_ptr<ResolverFactory> factory) {
-  auto p = state_.factories.emplace(factory->scheme(), std::move(factory));
-  GPR_ASSERT(p.second);
+  GPR_ASSERT(!HasResolverFactory(factory->scheme()));
+  state_.factories.emplace(factory->scheme(), std::move(factory));
+}
+
+void ResolverRegistry::Builder::RegisterLazyResolverFactory(
+    absl::string_view scheme,
+    std::function<std::unique_ptr<ResolverFactory>()> create) {
+  GPR_ASSERT(!HasResolverFactory(scheme));
+  auto lazy_factory = std::make_unique<LazyFactory>();
+  lazy_factory->create = std::move(create);
+  state_.lazy_factories.emplace(std::string(scheme), std::move(lazy_factory));
 }
 
 bool ResolverRegistry::Builder::HasResolverFactory(
     absl::string_view scheme) const {
-  return state_.factories.find(scheme) != state_.factories.end();
+  return state_.factories.find(scheme) != state_.factories.end() ||
+         state_.lazy_factories.find(scheme) != state_.lazy_factories.end();
 }
 
 void ResolverRegistry::Builder::Reset() {
   state_.factories.clear();
+  state_.lazy_factories.clear();
   state_.default_prefix = "dns:///";
 }
 
@@ -108,8 +119,15 @@ std::string ResolverRegistry::AddDefaultPrefixIfNeeded(
 ResolverFactory* ResolverRegistry::LookupResolverFactory(
     absl::string_view scheme) const {
   auto it = state_.factories.find(scheme);
-  if (it == state_.factories.end()) return nullptr;
-  return it->second.get();
+  if (it != state_.factories.end()) return it->second.get();
+  auto lazy_it = state_.lazy_factories.find(scheme);
+  if (lazy_it == state_.lazy_factories.end()) return nullptr;
+  LazyFactory* lazy_factory = lazy_it->second.get();
+  absl::call_once(lazy_factory->once, [lazy_factory, scheme]() {
+    lazy_factory->factory = lazy_factory->create();
+    GPR_ASSERT(lazy_factory->factory->scheme() == scheme);
+  });
+  return lazy_factory->factory.get();
 }
 
 // Returns the factory for the scheme of \a target.  If \a target does
@@ -19,11 +19,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "absl/base/call_once.h"
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/channel/channel_args.h"
@@ -37,9 +39,18 @@ namespace grpc_core {
 
 class ResolverRegistry {
  private:
+  // A factory registered with RegisterLazyResolverFactory.
+  struct LazyFactory {
+    std::function<std::unique_ptr<ResolverFactory>()> create;
+    absl::once_flag once;
+    std::unique_ptr<ResolverFactory> factory;
+  };
+
   // Forward declaration needed to use this in Builder.
   struct State {
     std::map<absl::string_view, std::unique_ptr<ResolverFactory>> factories;
+    std::map<std::string, std::unique_ptr<LazyFactory>, std::less<>>
+        lazy_factories;
     std::string default_prefix;
   };
 
@@ -58,6 +69,13 @@ class ResolverRegistry {
     /// resolver for any URI whose scheme matches that of the factory.
     void RegisterResolverFactory(std::unique_ptr<ResolverFactory> factory);
 
+    /// Registers a resolver for \a scheme whose factory is only created, by
+    /// calling \a create, when the scheme is first looked up. The created
+    /// factory's scheme must be \a scheme.
+    void RegisterLazyResolverFactory(
+        absl::string_view scheme,
+        std::function<std::unique_ptr<ResolverFactory>()> create);
+
     /// Returns true iff scheme already has a registered factory.
     bool HasResolverFactory(absl::string_view scheme) const;
 
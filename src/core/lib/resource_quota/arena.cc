@@ -89,6 +89,15 @@ size_t Arena::Destroy() {
   return size;
 }
 
+size_t Arena::ZoneAllocations() const {
+  size_t count = 0;
+  for (Zone* z = last_zone_.load(std::memory_order_relaxed); z != nullptr;
+       z = z->prev) {
+    ++count;
+  }
+  return count;
+}
+
 void* Arena::AllocZone(size_t size) {
   // If the allocation isn't able to end in the initial zone, create a new
   // zone for this allocation, and any unused space in the initial zone is
@@ -116,22 +125,43 @@ void Arena::ManagedNewObject::Link(std::atomic<ManagedNewObject*>* head) {
   }
 }
 
-void* Arena::AllocPooled(size_t alloc_size, std::atomic<FreePoolNode*>* head) {
-  FreePoolNode* p = head->load(std::memory_order_acquire);
+const void* Arena::CurrentThread() {
+  static thread_local char token;
+  return &token;
+}
+
+void* Arena::AllocPooled(size_t alloc_size, FreePool* pool) {
+  if (CurrentThread() == owner_thread_) {
+    FreePoolNode* p = pool->local;
+    if (p == nullptr) {
+      p = pool->remote.exchange(nullptr, std::memory_order_acquire);
+      if (p == nullptr) return Alloc(alloc_size);
+    }
+    pool->local = p->next;
+    return p;
+  }
+  FreePoolNode* p = pool->remote.load(std::memory_order_acquire);
   while (p != nullptr) {
-    if (head->compare_exchange_weak(p, p->next, std::memory_order_acq_rel,
-                                    std::memory_order_relaxed)) {
+    if (pool->remote.compare_exchange_weak(p, p->next,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
       return p;
     }
   }
   return Alloc(alloc_size);
 }
 
-void Arena::FreePooled(void* p, std::atomic<FreePoolNode*>* head) {
+void Arena::FreePooled(void* p, FreePool* pool) {
   FreePoolNode* node = static_cast<FreePoolNode*>(p);
-  node->next = head->load(std::memory_order_acquire);
-  while (!head->compare_exchange_weak(
-      node->next, node, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+  if (CurrentThread() == owner_thread_) {
+    node->next = pool->local;
+    pool->local = node;
+    return;
+  }
+  node->next = pool->remote.load(std::memory_order_acquire);
+  while (!pool->remote.compare_exchange_weak(node->next, node,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_relaxed)) {
   }
 }
 
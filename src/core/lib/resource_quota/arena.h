@@ -99,6 +99,13 @@ class Arena {
 
   // Destroy an arena, returning the total number of bytes allocated.
   size_t Destroy();
+  // Returns the number of allocations so far that did not fit in the initial
+  // zone, and so needed an allocation of their own.
+  size_t ZoneAllocations() const;
+  // Returns the number of bytes handed out by the arena so far.
+  size_t TotalUsedBytes() const {
+    return total_used_.load(std::memory_order_relaxed);
+  }
   // Allocate \a size bytes from the arena.
   void* Alloc(size_t size) {
     static constexpr size_t base_size =
@@ -196,6 +203,7 @@ class Arena {
                  MemoryAllocator* memory_allocator)
       : total_used_(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_alloc)),
         initial_zone_size_(initial_size),
+        owner_thread_(CurrentThread()),
         memory_allocator_(memory_allocator) {}
 
   ~Arena();
@@ -213,8 +221,20 @@ class Arena {
     FreePoolNode* next;
   };
 
-  void* AllocPooled(size_t alloc_size, std::atomic<FreePoolNode*>* head);
-  static void FreePooled(void* p, std::atomic<FreePoolNode*>* head);
+  // Free objects of one pool size class. Objects freed by the thread that
+  // created the arena go on a plain list that only that thread touches;
+  // objects freed by other threads go on a lock-free list, which the owning
+  // thread takes over in a single exchange once its own list runs dry.
+  struct FreePool {
+    FreePoolNode* local = nullptr;
+    std::atomic<FreePoolNode*> remote{nullptr};
+  };
+
+  // Returns a token identifying the calling thread.
+  static const void* CurrentThread();
+
+  void* AllocPooled(size_t alloc_size, FreePool* pool);
+  void FreePooled(void* p, FreePool* pool);
 
   // Keep track of the total used size. We use this in our call sizing
   // hysteresis.
@@ -228,7 +248,9 @@ class Arena {
   // last zone; the zone list is reverse-walked during arena destruction only.
   std::atomic<Zone*> last_zone_{nullptr};
   std::atomic<ManagedNewObject*> managed_new_head_{nullptr};
-  std::atomic<FreePoolNode*> pools_[PoolSizes::size()]{};
+  FreePool pools_[PoolSizes::size()];
+  // The thread that created the arena, and owns the local free lists.
+  const void* const owner_thread_;
   // The backing memory quota
   MemoryAllocator* const memory_allocator_;
 };
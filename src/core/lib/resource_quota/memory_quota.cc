@@ -25,15 +25,19 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 
+#include <grpc/support/cpu.h>
+
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/mpscq.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/resource_quota/trace.h"
+#include "src/core/lib/slice/slab_allocator.h"
 
 namespace grpc_core {
 
@@ -347,9 +351,28 @@ void BasicMemoryQuota::Start() {
   auto reclamation_loop = Loop(Seq(
       [self]() -> Poll<int> {
         // If there's free memory we no longer need to reclaim memory!
-        if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
+        // (Unless this is a sub-quota over its share of an overcommitted
+        // parent.)
+        if (self->free_bytes_.load(std::memory_order_acquire) > 0 &&
+            !self->ParentNeedsReclamation()) {
+          return Pending{};
+        }
+        // Credit cached per CPU is free memory too: reconcile it before
+        // asking anyone to give memory up.
+        if (self->FlushCredit() > 0 &&
+            self->free_bytes_.load(std::memory_order_acquire) > 0 &&
+            !self->ParentNeedsReclamation()) {
           return Pending{};
         }
+        // Slice storage cached for reuse is not charged to any quota, but
+        // under memory pressure it should go back to the system before any
+        // reclaimer is asked to give something up.
+        size_t released = SlabAllocator::ReleaseCachedSlabs();
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace) &&
+            released > 0) {
+          gpr_log(GPR_INFO, "RQ: %s released %zu bytes of cached slabs",
+                  self->name_.c_str(), released);
+        }
         return 0;
       },
       [self]() {
@@ -400,33 +423,81 @@ void BasicMemoryQuota::Start() {
                    [](absl::Status status) {
                      GPR_ASSERT(status.code() == absl::StatusCode::kCancelled);
                    });
+  if (parent_ != nullptr) parent_->AddChild(this);
 }
 
-void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
+void BasicMemoryQuota::Stop() {
+  if (parent_ != nullptr) parent_->RemoveChild(this);
+  reclaimer_activity_.reset();
+}
+
+BasicMemoryQuota::~BasicMemoryQuota() {
+  // Credit cached here is still charged to the parent.
+  FlushCredit();
+}
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
+  credit_limit_.store(std::min(size_t{kMaxCreditPerCpu},
+                               new_size / (64 * gpr_cpu_num_cores())),
+                      std::memory_order_relaxed);
+  FlushCredit();
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
+  // The size bounds this quota only: memory charged to a parent is unchanged.
   if (old_size < new_size) {
     // We're growing the quota.
-    Return(new_size - old_size);
+    ReturnLocal(new_size - old_size);
   } else {
     // We're shrinking the quota.
-    Take(old_size - new_size);
+    TakeLocal(old_size - new_size);
   }
 }
 
 void BasicMemoryQuota::Take(size_t amount) {
   // If there's a request for nothing, then do nothing!
+  if (amount == 0) return;
+  // Credit was never returned to free_bytes_ (nor to the parent).
+  if (TakeCredit(amount)) return;
+  TakeLocal(amount);
+  if (parent_ != nullptr) parent_->Take(amount);
+  flush_credit_.Tick([this](Duration) { FlushCredit(); });
+}
+
+void BasicMemoryQuota::TakeLocal(size_t amount) {
   if (amount == 0) return;
   GPR_DEBUG_ASSERT(amount <= std::numeric_limits<intptr_t>::max());
   // Grab memory from the quota.
   auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
+  // If we push into overcommit, awake the reclaimer, and those of any
+  // sub-quotas that may now be over their share.
   if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
     if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+    MutexLock lock(&children_mu_);
+    for (BasicMemoryQuota* child : children_) {
+      child->reclaimer_activity_->ForceWakeup();
+    }
   }
 }
 
+bool BasicMemoryQuota::ParentNeedsReclamation() const {
+  if (parent_ == nullptr) return false;
+  if (parent_->free_bytes_.load(std::memory_order_acquire) > 0) return false;
+  const intptr_t used =
+      static_cast<intptr_t>(quota_size_.load(std::memory_order_relaxed)) -
+      free_bytes_.load(std::memory_order_relaxed);
+  return used >
+         static_cast<intptr_t>(min_share_.load(std::memory_order_relaxed));
+}
+
+void BasicMemoryQuota::AddChild(BasicMemoryQuota* child) {
+  MutexLock lock(&children_mu_);
+  children_.push_back(child);
+}
+
+void BasicMemoryQuota::RemoveChild(BasicMemoryQuota* child) {
+  MutexLock lock(&children_mu_);
+  children_.erase(std::find(children_.begin(), children_.end(), child));
+}
+
 void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
   uint64_t current = reclamation_counter_.load(std::memory_order_relaxed);
   if (current != token) return;
@@ -446,6 +517,60 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (ReturnCredit(amount)) return;
+  ReturnLocal(amount);
+  if (parent_ != nullptr) parent_->Return(amount);
+  flush_credit_.Tick([this](Duration) { FlushCredit(); });
+}
+
+bool BasicMemoryQuota::TakeCredit(size_t amount) {
+  // PerCpu needs the ExecCtx to know which CPU we are on.
+  if (ExecCtx::Get() == nullptr) return false;
+  std::atomic<size_t>& credit = credit_.this_cpu().bytes;
+  size_t available = credit.load(std::memory_order_relaxed);
+  while (available >= amount) {
+    if (credit.compare_exchange_weak(available, available - amount,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BasicMemoryQuota::ReturnCredit(size_t amount) {
+  const size_t limit = credit_limit_.load(std::memory_order_relaxed);
+  if (amount > limit || ExecCtx::Get() == nullptr) return false;
+  // Never hide free memory from a quota that is in overcommit.
+  if (free_bytes_.load(std::memory_order_relaxed) <= 0) return false;
+  if (parent_ != nullptr &&
+      parent_->free_bytes_.load(std::memory_order_relaxed) <= 0) {
+    return false;
+  }
+  std::atomic<size_t>& credit = credit_.this_cpu().bytes;
+  size_t cached = credit.load(std::memory_order_relaxed);
+  while (cached + amount <= limit) {
+    if (credit.compare_exchange_weak(cached, cached + amount,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t BasicMemoryQuota::FlushCredit() {
+  size_t flushed = 0;
+  for (CpuCredit& credit : credit_) {
+    flushed += credit.bytes.exchange(0, std::memory_order_acq_rel);
+  }
+  if (flushed == 0) return 0;
+  ReturnLocal(flushed);
+  if (parent_ != nullptr) parent_->Return(flushed);
+  return flushed;
+}
+
+void BasicMemoryQuota::ReturnLocal(size_t amount) {
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
@@ -466,6 +591,19 @@ BasicMemoryQuota::PressureInfo BasicMemoryQuota::GetPressureInfo() {
         std::min(pressure_info.instantaneous_pressure, 1.0);
   }
   pressure_info.max_recommended_allocation_size = quota_size / 16;
+  if (parent_ != nullptr) {
+    // Buffers of a sub-quota should shrink as either it or its parent fills.
+    const PressureInfo parent_info = parent_->GetPressureInfo();
+    pressure_info.instantaneous_pressure = std::max(
+        pressure_info.instantaneous_pressure,
+        parent_info.instantaneous_pressure);
+    pressure_info.pressure_control_value = std::max(
+        pressure_info.pressure_control_value,
+        parent_info.pressure_control_value);
+    pressure_info.max_recommended_allocation_size =
+        std::min(pressure_info.max_recommended_allocation_size,
+                 parent_info.max_recommended_allocation_size);
+  }
   return pressure_info;
 }
 
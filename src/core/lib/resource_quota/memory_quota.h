@@ -25,6 +25,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
@@ -36,6 +37,7 @@
 
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
@@ -288,7 +290,10 @@ class BasicMemoryQuota final
     size_t max_recommended_allocation_size;
   };
 
-  explicit BasicMemoryQuota(std::string name) : name_(std::move(name)) {}
+  explicit BasicMemoryQuota(std::string name,
+                            std::shared_ptr<BasicMemoryQuota> parent = nullptr)
+      : parent_(std::move(parent)), name_(std::move(name)) {}
+  ~BasicMemoryQuota();
 
   // Start the reclamation activity.
   void Start();
@@ -300,12 +305,17 @@ class BasicMemoryQuota final
 
   // Resize the quota to new_size.
   void SetSize(size_t new_size);
-  // Forcefully take some memory from the quota, potentially entering
-  // overcommit.
+  // Set the number of bytes of a sub-quota that are shielded from its
+  // parent's memory pressure: see MemoryQuota::SetMinShare.
+  void SetMinShare(size_t min_share) {
+    min_share_.store(min_share, std::memory_order_relaxed);
+  }
+  // Forcefully take some memory from the quota (and its parent, if any),
+  // potentially entering overcommit.
   void Take(size_t amount);
   // Finish reclamation pass.
   void FinishReclamation(uint64_t token, Waker waker);
-  // Return some memory to the quota.
+  // Return some memory to the quota (and its parent, if any).
   void Return(size_t amount);
   // Instantaneous memory pressure approximation.
   PressureInfo GetPressureInfo();
@@ -320,6 +330,35 @@ class BasicMemoryQuota final
   class WaitForSweepPromise;
 
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
+  // Upper bound on the credit cached per CPU.
+  static constexpr size_t kMaxCreditPerCpu = 64 * 1024;
+
+  // Bytes that were returned to the quota but kept on the CPU that returned
+  // them, so that memory released and taken again on one CPU does not bounce
+  // the cache line holding free_bytes_ between cores. Cached credit still
+  // counts as used in free_bytes_ (and in the parent's), which keeps pressure
+  // estimates conservative.
+  struct CpuCredit {
+    std::atomic<size_t> bytes{0};
+    // Keeps neighbouring CPUs' credit off each other's cache lines.
+    char padding[GPR_CACHELINE_SIZE];
+  };
+  // Try to satisfy a Take() from, or absorb a Return() into, this CPU's
+  // credit. Both return false if the shared counters must be used instead.
+  bool TakeCredit(size_t amount);
+  bool ReturnCredit(size_t amount);
+  // Return all cached credit to free_bytes_. Returns the number of bytes.
+  size_t FlushCredit();
+
+  // Adjust the free bytes of this quota only, leaving the parent untouched.
+  void TakeLocal(size_t amount);
+  void ReturnLocal(size_t amount);
+  // True if this sub-quota should give memory back even though it is within
+  // its own size: its parent is in overcommit and this quota uses more than
+  // its minimum share.
+  bool ParentNeedsReclamation() const;
+  void AddChild(BasicMemoryQuota* child);
+  void RemoveChild(BasicMemoryQuota* child);
 
   // The amount of memory that's free in this quota.
   // We use intptr_t as a reasonable proxy for ssize_t that's portable.
@@ -342,6 +381,23 @@ class BasicMemoryQuota final
   std::atomic<uint64_t> reclamation_counter_{0};
   // Memory pressure smoothing
   memory_quota_detail::PressureTracker pressure_tracker_;
+  // Per-CPU cached credit, and the most each CPU may hold: a small fraction
+  // of the quota so that caching cannot by itself cause memory pressure.
+  PerCpu<CpuCredit> credit_;
+  std::atomic<size_t> credit_limit_{kMaxCreditPerCpu};
+  // Cached credit is also reconciled with free_bytes_ about once a second
+  // from the (already slow) paths that touch free_bytes_.
+  PeriodicUpdate flush_credit_{Duration::Seconds(1)};
+  // For sub-quotas: the quota that all memory taken from this one is also
+  // charged to.
+  const std::shared_ptr<BasicMemoryQuota> parent_;
+  // For sub-quotas: usage up to this many bytes is not reclaimed when only the
+  // parent is in overcommit.
+  std::atomic<size_t> min_share_{0};
+  // Started sub-quotas, whose reclaimers are woken when this quota enters
+  // overcommit.
+  Mutex children_mu_;
+  std::vector<BasicMemoryQuota*> children_ ABSL_GUARDED_BY(children_mu_);
   // The name of this quota - used for debugging/tracing/etc..
   std::string name_;
 };
@@ -493,6 +549,16 @@ class MemoryQuota final
       : memory_quota_(std::make_shared<BasicMemoryQuota>(std::move(name))) {
     memory_quota_->Start();
   }
+  // Create a sub-quota of parent. Memory used through the sub-quota also
+  // counts against parent, while SetSize() on the sub-quota caps its own
+  // share. When parent runs out of memory, only sub-quotas using more than
+  // their minimum share (see SetMinShare()) are asked to reclaim, so one
+  // tenant cannot push the others into destructive reclamation.
+  MemoryQuota(std::string name, const MemoryQuota& parent)
+      : memory_quota_(std::make_shared<BasicMemoryQuota>(
+            std::move(name), parent.memory_quota_)) {
+    memory_quota_->Start();
+  }
   ~MemoryQuota() override {
     if (memory_quota_ != nullptr) memory_quota_->Stop();
   }
@@ -508,6 +574,12 @@ class MemoryQuota final
   // Resize the quota to new_size.
   void SetSize(size_t new_size) { memory_quota_->SetSize(new_size); }
 
+  // For sub-quotas: protect the first min_share bytes of usage from
+  // reclamation caused by memory pressure in the parent quota.
+  void SetMinShare(size_t min_share) {
+    memory_quota_->SetMinShare(min_share);
+  }
+
   // Return true if the instantaneous memory pressure is high.
   bool IsMemoryPressureHigh() const {
     static constexpr double kMemoryPressureHighThreshold = 1.0;
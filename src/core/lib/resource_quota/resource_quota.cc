@@ -16,12 +16,20 @@
 
 #include "src/core/lib/resource_quota/resource_quota.h"
 
+#include <memory>
+#include <utility>
+
 namespace grpc_core {
 
 ResourceQuota::ResourceQuota(std::string name)
     : memory_quota_(MakeMemoryQuota(std::move(name))),
       thread_quota_(MakeRefCounted<ThreadQuota>()) {}
 
+ResourceQuota::ResourceQuota(std::string name, const ResourceQuota& parent)
+    : memory_quota_(std::make_shared<MemoryQuota>(std::move(name),
+                                                  *parent.memory_quota_)),
+      thread_quota_(parent.thread_quota_) {}
+
 ResourceQuota::~ResourceQuota() = default;
 
 ResourceQuotaRefPtr ResourceQuota::Default() {
@@ -41,6 +41,9 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
                       public CppImplOf<ResourceQuota, grpc_resource_quota> {
  public:
   explicit ResourceQuota(std::string name);
+  // Create a sub-quota of parent: its memory usage also counts against
+  // parent's memory quota (see MemoryQuota), and it shares parent's threads.
+  ResourceQuota(std::string name, const ResourceQuota& parent);
   ~ResourceQuota() override;
 
   ResourceQuota(const ResourceQuota&) = delete;
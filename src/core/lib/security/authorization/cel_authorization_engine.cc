@@ -19,6 +19,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <initializer_list>
 #include <utility>
 
 #include "absl/strings/string_view.h"
@@ -44,6 +45,107 @@ constexpr char kDestinationPort[] = "destination_port";
 constexpr char kSpiffeId[] = "spiffe_id";
 constexpr char kCertServerName[] = "cert_server_name";
 
+// The CEL function for indexing, as in headers["key"].
+constexpr char kIndexFunction[] = "_[_]";
+
+bool IsEnvoyAttribute(absl::string_view name) {
+  for (absl::string_view attribute :
+       {kUrlPath, kHost, kMethod, kHeaders, kSourceAddress, kSourcePort,
+        kDestinationAddress, kDestinationPort, kSpiffeId, kCertServerName}) {
+    if (name == attribute) return true;
+  }
+  return false;
+}
+
+absl::string_view StringViewFromUpb(upb_StringView str) {
+  return absl::string_view(str.data, str.size);
+}
+
+// Returns the name of the identifier that \a expr is, or an empty string if
+// it is not one.
+absl::string_view IdentName(const google_api_expr_v1alpha1_Expr* expr) {
+  if (expr == nullptr || !google_api_expr_v1alpha1_Expr_has_ident_expr(expr)) {
+    return "";
+  }
+  return StringViewFromUpb(google_api_expr_v1alpha1_Expr_Ident_name(
+      google_api_expr_v1alpha1_Expr_ident_expr(expr)));
+}
+
+// Adds the attributes that \a expr refers to to \a attributes, and the keys
+// of the headers it looks up to \a header_keys, so that requests are only
+// asked for what the conditions use.
+void CollectAttributes(const google_api_expr_v1alpha1_Expr* expr,
+                       absl::flat_hash_set<std::string>* attributes,
+                       absl::flat_hash_set<std::string>* header_keys) {
+  if (expr == nullptr) return;
+  if (google_api_expr_v1alpha1_Expr_has_ident_expr(expr)) {
+    // Other identifiers are comprehension variables.
+    absl::string_view name = IdentName(expr);
+    if (IsEnvoyAttribute(name)) attributes->emplace(name);
+  } else if (google_api_expr_v1alpha1_Expr_has_select_expr(expr)) {
+    const auto* select = google_api_expr_v1alpha1_Expr_select_expr(expr);
+    const auto* operand = google_api_expr_v1alpha1_Expr_Select_operand(select);
+    if (IdentName(operand) == kHeaders) {
+      header_keys->emplace(StringViewFromUpb(
+          google_api_expr_v1alpha1_Expr_Select_field(select)));
+    }
+    CollectAttributes(operand, attributes, header_keys);
+  } else if (google_api_expr_v1alpha1_Expr_has_call_expr(expr)) {
+    const auto* call = google_api_expr_v1alpha1_Expr_call_expr(expr);
+    size_t num_args;
+    const google_api_expr_v1alpha1_Expr* const* args =
+        google_api_expr_v1alpha1_Expr_Call_args(call, &num_args);
+    if (StringViewFromUpb(google_api_expr_v1alpha1_Expr_Call_function(call)) ==
+            kIndexFunction &&
+        num_args == 2 && IdentName(args[0]) == kHeaders &&
+        google_api_expr_v1alpha1_Expr_has_const_expr(args[1])) {
+      const auto* key = google_api_expr_v1alpha1_Expr_const_expr(args[1]);
+      if (google_api_expr_v1alpha1_Constant_has_string_value(key)) {
+        header_keys->emplace(StringViewFromUpb(
+            google_api_expr_v1alpha1_Constant_string_value(key)));
+      }
+    }
+    CollectAttributes(google_api_expr_v1alpha1_Expr_Call_target(call),
+                      attributes, header_keys);
+    for (size_t i = 0; i < num_args; ++i) {
+      CollectAttributes(args[i], attributes, header_keys);
+    }
+  } else if (google_api_expr_v1alpha1_Expr_has_list_expr(expr)) {
+    size_t num_elements;
+    const google_api_expr_v1alpha1_Expr* const* elements =
+        google_api_expr_v1alpha1_Expr_CreateList_elements(
+            google_api_expr_v1alpha1_Expr_list_expr(expr), &num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+      CollectAttributes(elements[i], attributes, header_keys);
+    }
+  } else if (google_api_expr_v1alpha1_Expr_has_struct_expr(expr)) {
+    size_t num_entries;
+    const google_api_expr_v1alpha1_Expr_CreateStruct_Entry* const* entries =
+        google_api_expr_v1alpha1_Expr_CreateStruct_entries(
+            google_api_expr_v1alpha1_Expr_struct_expr(expr), &num_entries);
+    for (size_t i = 0; i < num_entries; ++i) {
+      CollectAttributes(
+          google_api_expr_v1alpha1_Expr_CreateStruct_Entry_map_key(entries[i]),
+          attributes, header_keys);
+      CollectAttributes(
+          google_api_expr_v1alpha1_Expr_CreateStruct_Entry_value(entries[i]),
+          attributes, header_keys);
+    }
+  } else if (google_api_expr_v1alpha1_Expr_has_comprehension_expr(expr)) {
+    const auto* comprehension =
+        google_api_expr_v1alpha1_Expr_comprehension_expr(expr);
+    for (const auto* sub_expr :
+         {google_api_expr_v1alpha1_Expr_Comprehension_iter_range(comprehension),
+          google_api_expr_v1alpha1_Expr_Comprehension_accu_init(comprehension),
+          google_api_expr_v1alpha1_Expr_Comprehension_loop_condition(
+              comprehension),
+          google_api_expr_v1alpha1_Expr_Comprehension_loop_step(comprehension),
+          google_api_expr_v1alpha1_Expr_Comprehension_result(comprehension)}) {
+      CollectAttributes(sub_expr, attributes, header_keys);
+    }
+  }
+}
+
 }  // namespace
 
 std::unique_ptr<CelAuthorizationEngine>
@@ -91,6 +193,9 @@ CelAuthorizationEngine::CelAuthorizationEngine(
       const google_api_expr_v1alpha1_Expr* parsed_condition =
           google_api_expr_v1alpha1_Expr_parse(serialized, serial_len,
                                               arena_.ptr());
+      // Work out once which attributes the condition needs, rather than
+      // extracting every attribute from each request.
+      CollectAttributes(parsed_condition, &envoy_attributes_, &header_keys_);
       if (envoy_config_rbac_v3_RBAC_action(rbac_policy) == kAllow) {
         allow_if_matched_.insert(std::make_pair(policy_name, parsed_condition));
       } else {
@@ -102,7 +207,7 @@ CelAuthorizationEngine::CelAuthorizationEngine(
 
 std::unique_ptr<mock_cel::Activation> CelAuthorizationEngine::CreateActivation(
     const EvaluateArgs& args) {
-  std::unique_ptr<mock_cel::Activation> activation;
+  auto activation = std::make_unique<mock_cel::Activation>();
   for (const auto& elem : envoy_attributes_) {
     if (elem == kUrlPath) {
       absl::string_view url_path(args.GetPath());
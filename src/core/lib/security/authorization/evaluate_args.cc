@@ -67,8 +67,26 @@ EvaluateArgs::PerChannelArgs::Address ParseEndpointUri(
   return address;
 }
 
+// Bounds the cache of a connection whose engines are replaced many times.
+constexpr size_t kMaxMatchCacheEntries = 1024;
+
 }  // namespace
 
+absl::optional<bool> EvaluateArgs::PerChannelArgs::MatchCache::Get(
+    uint64_t key) {
+  MutexLock lock(&mu_);
+  auto it = results_.find(key);
+  if (it == results_.end()) return absl::nullopt;
+  return it->second;
+}
+
+void EvaluateArgs::PerChannelArgs::MatchCache::Set(uint64_t key,
+                                                   bool matches) {
+  MutexLock lock(&mu_);
+  if (results_.size() >= kMaxMatchCacheEntries) results_.clear();
+  results_[key] = matches;
+}
+
 EvaluateArgs::PerChannelArgs::PerChannelArgs(grpc_auth_context* auth_context,
                                              grpc_endpoint* endpoint) {
   if (auth_context != nullptr) {
@@ -218,4 +236,11 @@ absl::string_view EvaluateArgs::GetSubject() const {
   return channel_args_->subject;
 }
 
+EvaluateArgs::PerChannelArgs::MatchCache* EvaluateArgs::GetMatchCache() const {
+  if (channel_args_ == nullptr) {
+    return nullptr;
+  }
+  return channel_args_->match_cache.get();
+}
+
 }  // namespace grpc_core
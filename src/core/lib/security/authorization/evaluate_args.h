@@ -17,14 +17,20 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include <grpc/grpc_security.h>
 
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -44,6 +50,19 @@ class EvaluateArgs {
       int port = 0;
     };
 
+    // Remembers the results of matchers that only depend on the connection,
+    // so that they are evaluated once per connection rather than per call.
+    // Keys are allocated by the authorization engines.
+    class MatchCache {
+     public:
+      absl::optional<bool> Get(uint64_t key);
+      void Set(uint64_t key, bool matches);
+
+     private:
+      Mutex mu_;
+      absl::flat_hash_map<uint64_t, bool> results_ ABSL_GUARDED_BY(mu_);
+    };
+
     PerChannelArgs(grpc_auth_context* auth_context, grpc_endpoint* endpoint);
 
     absl::string_view transport_security_type;
@@ -54,6 +73,8 @@ class EvaluateArgs {
     absl::string_view subject;
     Address local_address;
     Address peer_address;
+    // Shared so that PerChannelArgs stays movable.
+    std::shared_ptr<MatchCache> match_cache = std::make_shared<MatchCache>();
   };
 
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
@@ -84,6 +105,8 @@ class EvaluateArgs {
   std::vector<absl::string_view> GetDnsSans() const;
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
+  // Returns nullptr if there are no per-channel args.
+  PerChannelArgs::MatchCache* GetMatchCache() const;
 
  private:
   grpc_metadata_batch* metadata_;
@@ -17,39 +17,99 @@
 #include "src/core/lib/security/authorization/grpc_authorization_engine.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <utility>
 
+#include "absl/types/optional.h"
+
 namespace grpc_core {
 
+namespace {
+
+// Hands out match cache keys, which must never be reused by another engine
+// while a connection may still hold results for them.
+std::atomic<uint64_t> g_next_cache_key{1};
+
+// Returns true if the principal depends on nothing but the connection.
+bool IsConnectionPrincipal(const Rbac::Principal& principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kAnd:
+    case Rbac::Principal::RuleType::kOr:
+    case Rbac::Principal::RuleType::kNot:
+      return std::all_of(
+          principal.principals.begin(), principal.principals.end(),
+          [](const std::unique_ptr<Rbac::Principal>& principal) {
+            return IsConnectionPrincipal(*principal);
+          });
+    case Rbac::Principal::RuleType::kAny:
+    case Rbac::Principal::RuleType::kPrincipalName:
+    case Rbac::Principal::RuleType::kSourceIp:
+    case Rbac::Principal::RuleType::kDirectRemoteIp:
+    case Rbac::Principal::RuleType::kRemoteIp:
+    case Rbac::Principal::RuleType::kMetadata:
+      return true;
+    case Rbac::Principal::RuleType::kHeader:
+    case Rbac::Principal::RuleType::kPath:
+      return false;
+  }
+  return false;
+}
+
+}  // namespace
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
-    : action_(policy.action) {
+    : action_(policy.action),
+      first_cache_key_(g_next_cache_key.fetch_add(policy.policies.size())) {
   for (auto& sub_policy : policy.policies) {
     Policy policy;
     policy.name = sub_policy.first;
-    policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
-        std::move(sub_policy.second));
+    policy.cache_principals =
+        IsConnectionPrincipal(sub_policy.second.principals);
+    policy.permissions = AuthorizationMatcher::Create(
+        std::move(sub_policy.second.permissions));
+    policy.principals = AuthorizationMatcher::Create(
+        std::move(sub_policy.second.principals));
     policies_.push_back(std::move(policy));
   }
 }
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : action_(other.action_), policies_(std::move(other.policies_)) {}
+    : action_(other.action_),
+      policies_(std::move(other.policies_)),
+      first_cache_key_(other.first_cache_key_) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  first_cache_key_ = other.first_cache_key_;
   return *this;
 }
 
+bool GrpcAuthorizationEngine::PrincipalsMatch(const Policy& policy,
+                                              size_t index,
+                                              const EvaluateArgs& args) const {
+  EvaluateArgs::PerChannelArgs::MatchCache* cache =
+      policy.cache_principals ? args.GetMatchCache() : nullptr;
+  if (cache == nullptr) return policy.principals->Matches(args);
+  const uint64_t key = first_cache_key_ + index;
+  absl::optional<bool> cached = cache->Get(key);
+  if (cached.has_value()) return *cached;
+  bool matches = policy.principals->Matches(args);
+  cache->Set(key, matches);
+  return matches;
+}
+
 AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
   bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
+  for (size_t i = 0; i < policies_.size(); ++i) {
+    const Policy& policy = policies_[i];
+    // Principals first, since their result is usually cached.
+    if (PrincipalsMatch(policy, i, args) && policy.permissions->Matches(args)) {
       matches = true;
       decision.matching_policy_name = policy.name;
       break;
@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <string>
@@ -58,10 +59,20 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
  private:
   struct Policy {
     std::string name;
-    std::unique_ptr<AuthorizationMatcher> matcher;
+    std::unique_ptr<AuthorizationMatcher> permissions;
+    std::unique_ptr<AuthorizationMatcher> principals;
+    // Whether the principals only depend on the connection, in which case
+    // their result is cached in the connection's EvaluateArgs.
+    bool cache_principals = false;
   };
+
+  bool PrincipalsMatch(const Policy& policy, size_t index,
+                       const EvaluateArgs& args) const;
+
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  // The match cache key of the first policy; the others follow it.
+  uint64_t first_cache_key_ = 0;
 };
 
 }  // namespace grpc_core
@@ -33,6 +33,15 @@
 
 namespace grpc_core {
 
+namespace {
+
+bool IsExactCaseSensitive(const StringMatcher& matcher) {
+  return matcher.type() == StringMatcher::Type::kExact &&
+         matcher.case_sensitive();
+}
+
+}  // namespace
+
 std::unique_ptr<AuthorizationMatcher> AuthorizationMatcher::Create(
     Rbac::Permission permission) {
   switch (permission.type) {
@@ -45,9 +54,20 @@ std::unique_ptr<AuthorizationMatcher> AuthorizationMatcher::Create(
     }
     case Rbac::Permission::RuleType::kOr: {
       std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
+      // Exact paths are looked up in a single set instead of one by one.
+      absl::flat_hash_set<std::string> paths;
       for (const auto& rule : permission.permissions) {
+        if (rule->type == Rbac::Permission::RuleType::kPath &&
+            IsExactCaseSensitive(rule->string_matcher)) {
+          paths.insert(rule->string_matcher.string_matcher());
+          continue;
+        }
         matchers.push_back(AuthorizationMatcher::Create(std::move(*rule)));
       }
+      if (!paths.empty()) {
+        matchers.push_back(
+            std::make_unique<PathSetAuthorizationMatcher>(std::move(paths)));
+      }
       return std::make_unique<OrAuthorizationMatcher>(std::move(matchers));
     }
     case Rbac::Permission::RuleType::kNot:
@@ -87,9 +107,23 @@ std::unique_ptr<AuthorizationMatcher> AuthorizationMatcher::Create(
     }
     case Rbac::Principal::RuleType::kOr: {
       std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
+      // Exact principal names are looked up in a single set instead of one by
+      // one.
+      absl::flat_hash_set<std::string> names;
       for (const auto& id : principal.principals) {
+        if (id->type == Rbac::Principal::RuleType::kPrincipalName &&
+            id->string_matcher.has_value() &&
+            IsExactCaseSensitive(*id->string_matcher)) {
+          names.insert(id->string_matcher->string_matcher());
+          continue;
+        }
         matchers.push_back(AuthorizationMatcher::Create(std::move(*id)));
       }
+      if (!names.empty()) {
+        matchers.push_back(
+            std::make_unique<AuthenticatedSetAuthorizationMatcher>(
+                std::move(names)));
+      }
       return std::make_unique<OrAuthorizationMatcher>(std::move(matchers));
     }
     case Rbac::Principal::RuleType::kNot:
@@ -217,6 +251,22 @@ bool AuthenticatedAuthorizationMatcher::Matches(
   return matcher_->Match(args.GetSubject());
 }
 
+bool AuthenticatedSetAuthorizationMatcher::Matches(
+    const EvaluateArgs& args) const {
+  if (args.GetTransportSecurityType() != GRPC_SSL_TRANSPORT_SECURITY_TYPE &&
+      args.GetTransportSecurityType() != GRPC_TLS_TRANSPORT_SECURITY_TYPE) {
+    // Connection is not authenticated.
+    return false;
+  }
+  for (const auto& uri : args.GetUriSans()) {
+    if (names_.contains(uri)) return true;
+  }
+  for (const auto& dns : args.GetDnsSans()) {
+    if (names_.contains(dns)) return true;
+  }
+  return names_.contains(args.GetSubject());
+}
+
 bool ReqServerNameAuthorizationMatcher::Matches(const EvaluateArgs&) const {
   // Currently we only support matching against an empty string.
   return matcher_.Match("");
@@ -230,6 +280,11 @@ bool PathAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return false;
 }
 
+bool PathSetAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
+  absl::string_view path = args.GetPath();
+  return !path.empty() && paths_.contains(path);
+}
+
 bool PolicyAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return permissions_->Matches(args) && principals_->Matches(args);
 }
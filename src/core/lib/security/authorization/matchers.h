@@ -20,9 +20,11 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_set.h"
 #include "absl/types/optional.h"
 
 #include "src/core/lib/iomgr/resolved_address.h"
@@ -169,6 +171,21 @@ class AuthenticatedAuthorizationMatcher : public AuthorizationMatcher {
   const absl::optional<StringMatcher> matcher_;
 };
 
+// Matches the principal name like AuthenticatedAuthorizationMatcher, against a
+// set of exact names at once. Used in place of an OR of exact, case-sensitive
+// principal name matchers.
+class AuthenticatedSetAuthorizationMatcher : public AuthorizationMatcher {
+ public:
+  explicit AuthenticatedSetAuthorizationMatcher(
+      absl::flat_hash_set<std::string> names)
+      : names_(std::move(names)) {}
+
+  bool Matches(const EvaluateArgs& args) const override;
+
+ private:
+  const absl::flat_hash_set<std::string> names_;
+};
+
 // Perform a match against the request server from the client's connection
 // request. This is typically TLS SNI. Currently unsupported.
 class ReqServerNameAuthorizationMatcher : public AuthorizationMatcher {
@@ -195,6 +212,19 @@ class PathAuthorizationMatcher : public AuthorizationMatcher {
   const StringMatcher matcher_;
 };
 
+// Matches the path header against a set of exact paths at once. Used in place
+// of an OR of exact, case-sensitive path matchers.
+class PathSetAuthorizationMatcher : public AuthorizationMatcher {
+ public:
+  explicit PathSetAuthorizationMatcher(absl::flat_hash_set<std::string> paths)
+      : paths_(std::move(paths)) {}
+
+  bool Matches(const EvaluateArgs& args) const override;
+
+ private:
+  const absl::flat_hash_set<std::string> paths_;
+};
+
 // Performs a match for policy field in RBAC, which is a collection of
 // permission and principal matchers. Policy matches iff, we find a match in one
 // of its permissions and a match in one of its principals.
@@ -253,15 +253,19 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
   // Update cache and grab list of pending requests.
   gpr_mu_lock(&mu_);
   token_fetch_pending_ = false;
-  if (access_token_value.has_value()) {
-    access_token_value_ = access_token_value->Ref();
-  } else {
-    access_token_value_ = absl::nullopt;
+  if (status == GRPC_CREDENTIALS_OK) {
+    const grpc_core::Duration refresh_threshold =
+        grpc_core::Duration::Seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS);
+    const grpc_core::Timestamp expiration =
+        grpc_core::Timestamp::Now() + token_lifetime;
+    auto token = std::make_unique<CachedToken>();
+    token->value = access_token_value->Ref();
+    token->refresh_after = expiration - refresh_threshold * 2;
+    token->usable_until = expiration - refresh_threshold;
+    cached_token_.Store(std::move(token));
+    cached_token_.Reclaim();
   }
-  token_expiration_ = status == GRPC_CREDENTIALS_OK
-                          ? gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
-                                         token_lifetime.as_timespec())
-                          : gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  // On failure, the current token stays in use until it is no longer usable.
   grpc_oauth2_pending_get_request_metadata* pending_request = pending_requests_;
   pending_requests_ = nullptr;
   gpr_mu_unlock(&mu_);
@@ -292,18 +296,21 @@ grpc_core::ArenaPromise<absl::StatusOr<grpc_core::ClientMetadataHandle>>
 grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
     grpc_core::ClientMetadataHandle initial_metadata,
     const grpc_call_credentials::GetRequestMetadataArgs*) {
-  // Check if we can use the cached token.
+  // Check if we can use the cached token, without taking mu_.
   absl::optional<grpc_core::Slice> cached_access_token_value;
-  gpr_mu_lock(&mu_);
-  if (access_token_value_.has_value() &&
-      gpr_time_cmp(
-          gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC)),
-          gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
-                                GPR_TIMESPAN)) > 0) {
-    cached_access_token_value = access_token_value_->Ref();
+  bool refresh = false;
+  {
+    grpc_core::RcuPtr<CachedToken>::ReadScope token(&cached_token_);
+    const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+    if (token.get() != nullptr && now < token->usable_until) {
+      cached_access_token_value = token->value.Ref();
+      refresh = now >= token->refresh_after;
+    }
   }
   if (cached_access_token_value.has_value()) {
-    gpr_mu_unlock(&mu_);
+    // Fetch the next token before this one expires, so that calls do not
+    // have to wait for it.
+    if (refresh) MaybeStartBackgroundFetch();
     initial_metadata->Append(
         GRPC_AUTHORIZATION_METADATA_KEY, std::move(*cached_access_token_value),
         [](absl::string_view, const grpc_core::Slice&) { abort(); });
@@ -315,6 +322,7 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
       grpc_core::Duration::Seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS);
   auto pending_request =
       grpc_core::MakeRefCounted<grpc_oauth2_pending_get_request_metadata>();
+  gpr_mu_lock(&mu_);
   pending_request->pollent = grpc_core::GetContext<grpc_polling_entity>();
   pending_request->waker = grpc_core::Activity::current()->MakeNonOwningWaker();
   grpc_polling_entity_add_to_pollset_set(
@@ -343,9 +351,22 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
       };
 }
 
+void grpc_oauth2_token_fetcher_credentials::MaybeStartBackgroundFetch() {
+  gpr_mu_lock(&mu_);
+  bool start_fetch = !token_fetch_pending_;
+  token_fetch_pending_ = true;
+  gpr_mu_unlock(&mu_);
+  if (start_fetch) {
+    fetch_oauth2(new grpc_credentials_metadata_request(Ref()), &pollent_,
+                 on_oauth2_token_fetcher_http_response,
+                 grpc_core::Timestamp::Now() +
+                     grpc_core::Duration::Seconds(
+                         GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS));
+  }
+}
+
 grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials()
-    : token_expiration_(gpr_inf_past(GPR_CLOCK_MONOTONIC)),
-      pollent_(grpc_polling_entity_create_from_pollset_set(
+    : pollent_(grpc_polling_entity_create_from_pollset_set(
           grpc_pollset_set_create())) {
   gpr_mu_init(&mu_);
 }
@@ -34,6 +34,7 @@
 
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/rcu_ptr.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/time.h"
@@ -130,15 +131,28 @@ class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
                             grpc_core::Timestamp deadline) = 0;
 
  private:
+  // The current token, which calls read without taking mu_.
+  struct CachedToken {
+    grpc_core::Slice value;
+    // From then on, calls still use the token but start fetching a new one.
+    grpc_core::Timestamp refresh_after;
+    // From then on, calls wait for a new token.
+    grpc_core::Timestamp usable_until;
+  };
+
   int cmp_impl(const grpc_call_credentials* other) const override {
     // TODO(yashykt): Check if we can do something better here
     return grpc_core::QsortCompare(
         static_cast<const grpc_call_credentials*>(this), other);
   }
 
+  // Starts fetching a new token unless a fetch is already pending.
+  void MaybeStartBackgroundFetch();
+
   gpr_mu mu_;
-  absl::optional<grpc_core::Slice> access_token_value_;
-  gpr_timespec token_expiration_;
+  // Stored under mu_, which also reclaims replaced tokens on every store, so
+  // readers need not request reclamation.
+  grpc_core::RcuPtr<CachedToken> cached_token_{[]() {}};
   bool token_fetch_pending_ = false;
   grpc_oauth2_pending_get_request_metadata* pending_requests_ = nullptr;
   grpc_polling_entity pollent_;
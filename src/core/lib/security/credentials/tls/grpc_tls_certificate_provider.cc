@@ -22,6 +22,7 @@
 #include <time.h>
 
 #include <algorithm>
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -32,15 +33,18 @@
 #include <openssl/x509.h>
 
 #include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 
-#include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/slice.h>
 #include <grpc/support/log.h>
-#include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/stat.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/load_file.h"
@@ -109,14 +113,80 @@ UniqueTypeName StaticDataCertificateProvider::type() const {
   return kFactory.Create();
 }
 
-namespace {
+// Refreshes every FileWatcherCertificateProvider of the process on its own
+// interval from a single thread, so that processes with many providers do
+// not run a thread for each. The thread runs while there are providers.
+class FileWatcherRefresher {
+ public:
+  static FileWatcherRefresher* Get() {
+    static NoDestruct<FileWatcherRefresher> refresher;
+    return refresher.get();
+  }
 
-gpr_timespec TimeoutSecondsToDeadline(int64_t seconds) {
-  return gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
-                      gpr_time_from_seconds(seconds, GPR_TIMESPAN));
-}
+  void Add(FileWatcherCertificateProvider* provider) {
+    MutexLock lock(&mu_);
+    providers_.emplace(provider, absl::Now() + RefreshInterval(provider));
+    if (!thread_running_) {
+      thread_running_ = true;
+      // The thread outlives any provider but not the process, so it is
+      // detached rather than joined by the last provider to go.
+      Thread("FileWatcherCertificateProvider_refreshing_thread",
+             [](void* arg) { static_cast<FileWatcherRefresher*>(arg)->Run(); },
+             this, nullptr, Thread::Options().set_joinable(false))
+          .Start();
+    }
+    cv_.SignalAll();
+  }
 
-}  // namespace
+  // Once this returns, \a provider is not being refreshed and will not be.
+  void Remove(FileWatcherCertificateProvider* provider) {
+    MutexLock lock(&mu_);
+    providers_.erase(provider);
+    while (refreshing_ == provider) cv_.Wait(&mu_);
+    cv_.SignalAll();
+  }
+
+ private:
+  static absl::Duration RefreshInterval(
+      const FileWatcherCertificateProvider* provider) {
+    return absl::Seconds(provider->refresh_interval_sec_);
+  }
+
+  void Run() {
+    MutexLock lock(&mu_);
+    while (!providers_.empty()) {
+      auto next = providers_.begin();
+      for (auto it = providers_.begin(); it != providers_.end(); ++it) {
+        if (it->second < next->second) next = it;
+      }
+      if (absl::Now() < next->second) {
+        cv_.WaitWithDeadline(&mu_, next->second);
+        continue;
+      }
+      FileWatcherCertificateProvider* provider = next->first;
+      refreshing_ = provider;
+      mu_.Unlock();
+      provider->ForceUpdate();
+      mu_.Lock();
+      refreshing_ = nullptr;
+      auto it = providers_.find(provider);
+      if (it != providers_.end()) {
+        it->second = absl::Now() + RefreshInterval(provider);
+      }
+      cv_.SignalAll();
+    }
+    thread_running_ = false;
+  }
+
+  Mutex mu_;
+  CondVar cv_;
+  // Each provider and when it is next due for a refresh.
+  std::map<FileWatcherCertificateProvider*, absl::Time> providers_
+      ABSL_GUARDED_BY(mu_);
+  // The provider being refreshed, if any.
+  FileWatcherCertificateProvider* refreshing_ ABSL_GUARDED_BY(mu_) = nullptr;
+  bool thread_running_ ABSL_GUARDED_BY(mu_) = false;
+};
 
 FileWatcherCertificateProvider::FileWatcherCertificateProvider(
     std::string private_key_path, std::string identity_certificate_path,
@@ -130,25 +200,8 @@ FileWatcherCertificateProvider::FileWatcherCertificateProvider(
   GPR_ASSERT(private_key_path_.empty() == identity_certificate_path_.empty());
   // Must be watching either root or identity certs.
   GPR_ASSERT(!private_key_path_.empty() || !root_cert_path_.empty());
-  gpr_event_init(&shutdown_event_);
   ForceUpdate();
-  auto thread_lambda = [](void* arg) {
-    FileWatcherCertificateProvider* provider =
-        static_cast<FileWatcherCertificateProvider*>(arg);
-    GPR_ASSERT(provider != nullptr);
-    while (true) {
-      void* value = gpr_event_wait(
-          &provider->shutdown_event_,
-          TimeoutSecondsToDeadline(provider->refresh_interval_sec_));
-      if (value != nullptr) {
-        return;
-      };
-      provider->ForceUpdate();
-    }
-  };
-  refresh_thread_ = Thread("FileWatcherCertificateProvider_refreshing_thread",
-                           thread_lambda, this);
-  refresh_thread_.Start();
+  FileWatcherRefresher::Get()->Add(this);
   distributor_->SetWatchStatusCallback([this](std::string cert_name,
                                               bool root_being_watched,
                                               bool identity_being_watched) {
@@ -196,8 +249,7 @@ FileWatcherCertificateProvider::~FileWatcherCertificateProvider() {
   // Reset distributor's callback to make sure the callback won't be invoked
   // again after this object(provider) is destroyed.
   distributor_->SetWatchStatusCallback(nullptr);
-  gpr_event_set(&shutdown_event_, reinterpret_cast<void*>(1));
-  refresh_thread_.Join();
+  FileWatcherRefresher::Get()->Remove(this);
 }
 
 UniqueTypeName FileWatcherCertificateProvider::type() const {
@@ -31,13 +31,11 @@
 
 #include <grpc/grpc_security.h>
 #include <grpc/support/log.h>
-#include <grpc/support/sync.h>
 
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
-#include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_distributor.h"
@@ -135,6 +133,7 @@ class StaticDataCertificateProvider final
 };
 
 // A provider class that will watch the credential changes on the file system.
+// All providers of a process are refreshed by a single shared thread.
 class FileWatcherCertificateProvider final
     : public grpc_tls_certificate_provider {
  public:
@@ -152,6 +151,8 @@ class FileWatcherCertificateProvider final
   UniqueTypeName type() const override;
 
  private:
+  friend class FileWatcherRefresher;
+
   struct WatcherInfo {
     bool root_being_watched = false;
     bool identity_being_watched = false;
@@ -181,8 +182,6 @@ class FileWatcherCertificateProvider final
   int64_t refresh_interval_sec_ = 0;
 
   RefCountedPtr<grpc_tls_certificate_distributor> distributor_;
-  Thread refresh_thread_;
-  gpr_event shutdown_event_;
 
   // Guards members below.
   Mutex mu_;
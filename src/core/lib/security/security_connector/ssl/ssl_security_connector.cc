@@ -23,9 +23,12 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -37,6 +40,8 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -74,6 +79,125 @@ grpc_error_handle ssl_check_peer(
   return absl::OkStatus();
 }
 
+// A client handshaker factory shared by all channels whose SSL credentials
+// have the same contents, so that they also share its SSL_CTX and the parsed
+// root certificates in it.
+class SharedClientHandshakerFactory
+    : public grpc_core::RefCounted<SharedClientHandshakerFactory> {
+ public:
+  struct Key {
+    std::string pem_root_certs;
+    const tsi_ssl_root_certs_store* root_store;
+    std::string private_key;
+    std::string cert_chain;
+    grpc_tls_version min_tls_version;
+    grpc_tls_version max_tls_version;
+    tsi_ssl_session_cache* session_cache;
+
+    bool operator<(const Key& other) const {
+      return std::tie(pem_root_certs, root_store, private_key, cert_chain,
+                      min_tls_version, max_tls_version, session_cache) <
+             std::tie(other.pem_root_certs, other.root_store,
+                      other.private_key, other.cert_chain,
+                      other.min_tls_version, other.max_tls_version,
+                      other.session_cache);
+    }
+  };
+
+  // Returns the factory for \a config, creating it if no channel is using
+  // one, or null if it cannot be created.
+  static grpc_core::RefCountedPtr<SharedClientHandshakerFactory> Get(
+      const grpc_ssl_config* config, const char* pem_root_certs,
+      const tsi_ssl_root_certs_store* root_store,
+      tsi_ssl_session_cache* ssl_session_cache);
+
+  SharedClientHandshakerFactory(Key key,
+                                tsi_ssl_client_handshaker_factory* factory)
+      : key_(std::move(key)), factory_(factory) {}
+
+  ~SharedClientHandshakerFactory() override {
+    Registry* registry = GetRegistry();
+    {
+      grpc_core::MutexLock lock(&registry->mu);
+      auto it = registry->factories.find(key_);
+      // The entry may already have been replaced by a new factory.
+      if (it != registry->factories.end() && it->second == this) {
+        registry->factories.erase(it);
+      }
+    }
+    tsi_ssl_client_handshaker_factory_unref(factory_);
+  }
+
+  tsi_ssl_client_handshaker_factory* factory() const { return factory_; }
+
+ private:
+  struct Registry {
+    grpc_core::Mutex mu;
+    // Entries are removed by the factories' destructors.
+    std::map<Key, SharedClientHandshakerFactory*> factories
+        ABSL_GUARDED_BY(mu);
+  };
+
+  static Registry* GetRegistry() {
+    static grpc_core::NoDestruct<Registry> registry;
+    return registry.get();
+  }
+
+  const Key key_;
+  tsi_ssl_client_handshaker_factory* const factory_;
+};
+
+grpc_core::RefCountedPtr<SharedClientHandshakerFactory>
+SharedClientHandshakerFactory::Get(const grpc_ssl_config* config,
+                                   const char* pem_root_certs,
+                                   const tsi_ssl_root_certs_store* root_store,
+                                   tsi_ssl_session_cache* ssl_session_cache) {
+  bool has_key_cert_pair = config->pem_key_cert_pair != nullptr &&
+                           config->pem_key_cert_pair->private_key != nullptr &&
+                           config->pem_key_cert_pair->cert_chain != nullptr;
+  GPR_DEBUG_ASSERT(pem_root_certs != nullptr);
+  Key key{pem_root_certs,
+          root_store,
+          has_key_cert_pair ? config->pem_key_cert_pair->private_key : "",
+          has_key_cert_pair ? config->pem_key_cert_pair->cert_chain : "",
+          config->min_tls_version,
+          config->max_tls_version,
+          ssl_session_cache};
+  Registry* registry = GetRegistry();
+  grpc_core::MutexLock lock(&registry->mu);
+  auto it = registry->factories.find(key);
+  if (it != registry->factories.end()) {
+    auto shared = it->second->RefIfNonZero();
+    if (shared != nullptr) return shared;
+  }
+  tsi_ssl_client_handshaker_options options;
+  options.pem_root_certs = pem_root_certs;
+  options.root_store = root_store;
+  options.alpn_protocols =
+      grpc_fill_alpn_protocol_strings(&options.num_alpn_protocols);
+  if (has_key_cert_pair) {
+    options.pem_key_cert_pair = config->pem_key_cert_pair;
+  }
+  options.cipher_suites = grpc_get_ssl_cipher_suites();
+  options.session_cache = ssl_session_cache;
+  options.min_tls_version = grpc_get_tsi_tls_version(config->min_tls_version);
+  options.max_tls_version = grpc_get_tsi_tls_version(config->max_tls_version);
+  tsi_ssl_client_handshaker_factory* factory = nullptr;
+  const tsi_result result =
+      tsi_create_ssl_client_handshaker_factory_with_options(&options,
+                                                            &factory);
+  gpr_free(options.alpn_protocols);
+  if (result != TSI_OK) {
+    gpr_log(GPR_ERROR, "Handshaker factory creation failed with %s.",
+            tsi_result_to_string(result));
+    return nullptr;
+  }
+  auto shared = grpc_core::MakeRefCounted<SharedClientHandshakerFactory>(
+      std::move(key), factory);
+  registry->factories[shared->key_] = shared.get();
+  return shared;
+}
+
 class grpc_ssl_channel_security_connector final
     : public grpc_channel_security_connector {
  public:
@@ -94,41 +218,14 @@ class grpc_ssl_channel_security_connector final
     target_name_ = std::string(host);
   }
 
-  ~grpc_ssl_channel_security_connector() override {
-    tsi_ssl_client_handshaker_factory_unref(client_handshaker_factory_);
-  }
-
   grpc_security_status InitializeHandshakerFactory(
       const grpc_ssl_config* config, const char* pem_root_certs,
       const tsi_ssl_root_certs_store* root_store,
       tsi_ssl_session_cache* ssl_session_cache) {
-    bool has_key_cert_pair =
-        config->pem_key_cert_pair != nullptr &&
-        config->pem_key_cert_pair->private_key != nullptr &&
-        config->pem_key_cert_pair->cert_chain != nullptr;
-    tsi_ssl_client_handshaker_options options;
-    GPR_DEBUG_ASSERT(pem_root_certs != nullptr);
-    options.pem_root_certs = pem_root_certs;
-    options.root_store = root_store;
-    options.alpn_protocols =
-        grpc_fill_alpn_protocol_strings(&options.num_alpn_protocols);
-    if (has_key_cert_pair) {
-      options.pem_key_cert_pair = config->pem_key_cert_pair;
-    }
-    options.cipher_suites = grpc_get_ssl_cipher_suites();
-    options.session_cache = ssl_session_cache;
-    options.min_tls_version = grpc_get_tsi_tls_version(config->min_tls_version);
-    options.max_tls_version = grpc_get_tsi_tls_version(config->max_tls_version);
-    const tsi_result result =
-        tsi_create_ssl_client_handshaker_factory_with_options(
-            &options, &client_handshaker_factory_);
-    gpr_free(options.alpn_protocols);
-    if (result != TSI_OK) {
-      gpr_log(GPR_ERROR, "Handshaker factory creation failed with %s.",
-              tsi_result_to_string(result));
-      return GRPC_SECURITY_ERROR;
-    }
-    return GRPC_SECURITY_OK;
+    client_handshaker_factory_ = SharedClientHandshakerFactory::Get(
+        config, pem_root_certs, root_store, ssl_session_cache);
+    return client_handshaker_factory_ == nullptr ? GRPC_SECURITY_ERROR
+                                                 : GRPC_SECURITY_OK;
   }
 
   void add_handshakers(const grpc_core::ChannelArgs& args,
@@ -137,7 +234,7 @@ class grpc_ssl_channel_security_connector final
     // Instantiate TSI handshaker.
     tsi_handshaker* tsi_hs = nullptr;
     tsi_result result = tsi_ssl_client_handshaker_factory_create_handshaker(
-        client_handshaker_factory_,
+        client_handshaker_factory_->factory(),
         overridden_target_name_.empty() ? target_name_.c_str()
                                         : overridden_target_name_.c_str(),
         /*network_bio_buf_size=*/0,
@@ -204,7 +301,8 @@ class grpc_ssl_channel_security_connector final
   }
 
  private:
-  tsi_ssl_client_handshaker_factory* client_handshaker_factory_;
+  grpc_core::RefCountedPtr<SharedClientHandshakerFactory>
+      client_handshaker_factory_;
   std::string target_name_;
   std::string overridden_target_name_;
   const verify_peer_options* verify_options_;
@@ -25,6 +25,9 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
@@ -61,6 +64,8 @@
 #include "src/core/tsi/transport_security_interface.h"
 
 #define STAGING_BUFFER_SIZE 8192
+// The largest write staging buffer allocated for a large write.
+#define MAX_WRITE_STAGING_BUFFER_SIZE (128 * 1024)
 
 static void on_read(void* user_data, grpc_error_handle error);
 
@@ -370,12 +375,21 @@ static void endpoint_read(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
                      /*min_progress_size=*/ep->min_progress_size);
 }
 
+// Starts a new write staging buffer.  remaining is the number of bytes
+// still to be written in this write.  Large writes get staging buffers
+// that hold several protected frames, so that they reach the wrapped
+// endpoint as a few large slices rather than many small ones; the memory
+// quota may hand out less than that under pressure.
 static void flush_write_staging_buffer(secure_endpoint* ep, uint8_t** cur,
-                                       uint8_t** end)
+                                       uint8_t** end, size_t remaining)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(ep->write_mu) {
   grpc_slice_buffer_add_indexed(&ep->output_buffer, ep->write_staging_buffer);
+  // Leave some room for the framing overhead of the protector.
+  const size_t wanted = std::min<size_t>(remaining + remaining / 128,
+                                         MAX_WRITE_STAGING_BUFFER_SIZE);
   ep->write_staging_buffer =
-      ep->memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+      ep->memory_owner.MakeSlice(grpc_core::MemoryRequest(
+          STAGING_BUFFER_SIZE, std::max<size_t>(wanted, STAGING_BUFFER_SIZE)));
   *cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
   *end = GRPC_SLICE_END_PTR(ep->write_staging_buffer);
   maybe_post_reclaimer(ep);
@@ -426,6 +440,7 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
       grpc_slice_buffer_reset_and_unref(&ep->protector_staging_buffer);
     } else {
       // Use frame protector to protect.
+      size_t remaining = slices->length;
       for (i = 0; i < slices->count; i++) {
         grpc_slice plain = slices->slices[i];
         uint8_t* message_bytes = GRPC_SLICE_START_PTR(plain);
@@ -445,10 +460,11 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
           }
           message_bytes += processed_message_size;
           message_size -= processed_message_size;
+          remaining -= processed_message_size;
           cur += protected_buffer_size_to_send;
 
           if (cur == end) {
-            flush_write_staging_buffer(ep, &cur, &end);
+            flush_write_staging_buffer(ep, &cur, &end, remaining);
           }
         }
         if (result != TSI_OK) break;
@@ -465,7 +481,7 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
           if (result != TSI_OK) break;
           cur += protected_buffer_size_to_send;
           if (cur == end) {
-            flush_write_staging_buffer(ep, &cur, &end);
+            flush_write_staging_buffer(ep, &cur, &end, still_pending_size);
           }
         } while (still_pending_size > 0);
         if (cur != GRPC_SLICE_START_PTR(ep->write_staging_buffer)) {
@@ -542,6 +558,13 @@ static bool endpoint_can_track_err(grpc_endpoint* secure_ep) {
   return grpc_endpoint_can_track_err(ep->wrapped_ep);
 }
 
+static void endpoint_get_socket_options(
+    grpc_endpoint* secure_ep,
+    std::vector<std::pair<std::string, std::string>>* options) {
+  secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
+  grpc_endpoint_get_socket_options(ep->wrapped_ep, options);
+}
+
 static const grpc_endpoint_vtable vtable = {endpoint_read,
                                             endpoint_write,
                                             endpoint_add_to_pollset,
@@ -552,7 +575,8 @@ static const grpc_endpoint_vtable vtable = {endpoint_read,
                                             endpoint_get_peer,
                                             endpoint_get_local_address,
                                             endpoint_get_fd,
-                                            endpoint_can_track_err};
+                                            endpoint_can_track_err,
+                                            endpoint_get_socket_options};
 
 grpc_endpoint* grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
@@ -26,9 +26,13 @@
 
 #include <algorithm>
 #include <memory>
+#include <queue>
 #include <string>
+#include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -39,15 +43,18 @@
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/fork.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -71,6 +78,61 @@ namespace grpc_core {
 
 namespace {
 
+// A process-wide pool of threads that runs TSI handshaker steps, so that
+// their crypto does not hold up the I/O threads.
+class HandshakeOffloader {
+ public:
+  static HandshakeOffloader* Get() {
+    static HandshakeOffloader* offloader = new HandshakeOffloader();
+    return offloader;
+  }
+
+  // Queues \a fn to run on a pool thread with an ExecCtx.  Returns false
+  // without queueing it when too many steps are already waiting, in which
+  // case the caller should run it inline.
+  bool TryRun(absl::AnyInvocable<void()> fn) {
+    MutexLock lock(&mu_);
+    if (queue_.size() >= max_pending_) return false;
+    queue_.push(std::move(fn));
+    cv_.Signal();
+    return true;
+  }
+
+ private:
+  HandshakeOffloader()
+      : num_threads_(std::max(2u, gpr_cpu_num_cores() / 2)),
+        max_pending_(64 * num_threads_) {
+    for (unsigned i = 0; i < num_threads_; ++i) {
+      Thread(
+          "grpc_handshake_offload",
+          [](void* arg) { static_cast<HandshakeOffloader*>(arg)->RunWorker(); },
+          this, nullptr,
+          Thread::Options().set_joinable(false).set_tracked(false))
+          .Start();
+    }
+  }
+
+  void RunWorker() {
+    while (true) {
+      absl::AnyInvocable<void()> fn;
+      {
+        MutexLock lock(&mu_);
+        while (queue_.empty()) cv_.Wait(&mu_);
+        fn = std::move(queue_.front());
+        queue_.pop();
+      }
+      ExecCtx exec_ctx;
+      fn();
+    }
+  }
+
+  const unsigned num_threads_;
+  const size_t max_pending_;
+  Mutex mu_;
+  CondVar cv_;
+  std::queue<absl::AnyInvocable<void()>> queue_ ABSL_GUARDED_BY(mu_);
+};
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -86,6 +148,10 @@ class SecurityHandshaker : public Handshaker {
  private:
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size);
+  grpc_error_handle InvokeHandshakerNextLocked(
+      const unsigned char* bytes_received, size_t bytes_received_size);
+  void OnOffloadedHandshakerNext(const unsigned char* bytes_received,
+                                 size_t bytes_received_size);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -132,6 +198,10 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  // Whether to try to hand record protection over to the kernel.
+  const bool kernel_protection_;
+  // Whether to run TSI handshaker steps on the HandshakeOffloader.
+  const bool offload_;
   std::string tsi_handshake_error_;
 };
 
@@ -144,7 +214,13 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
       max_frame_size_(
-          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {
+          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))),
+      kernel_protection_(
+          args.GetBool(GRPC_ARG_EXPERIMENTAL_KERNEL_TLS).value_or(false)),
+      // Detached threads would not survive a fork.
+      offload_(args.GetBool(GRPC_ARG_EXPERIMENTAL_HANDSHAKE_OFFLOAD)
+                   .value_or(false) &&
+               !Fork::Enabled()) {
   grpc_slice_buffer_init(&outgoing_);
   GRPC_CLOSURE_INIT(&on_peer_checked_, &SecurityHandshaker::OnPeerCheckedFn,
                     this, grpc_schedule_on_exec_ctx);
@@ -278,6 +354,7 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
   }
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
+  bool kernel_protected = false;
   switch (frame_protector_type) {
     case TSI_FRAME_PROTECTOR_ZERO_COPY:
       ABSL_FALLTHROUGH_INTENDED;
@@ -294,6 +371,26 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
       }
       break;
     case TSI_FRAME_PROTECTOR_NORMAL:
+      // If requested, let the kernel protect records, so that the endpoint
+      // does not need to be wrapped.  Unused bytes would have to be
+      // decrypted here, so don't try if there are any.
+      if (kernel_protection_ && unused_bytes_size == 0) {
+        int fd = grpc_endpoint_get_fd(args_->endpoint);
+        if (fd >= 0) {
+          result = tsi_handshaker_result_enable_kernel_protection(
+              handshaker_result_, fd);
+          if (result == TSI_OK) {
+            kernel_protected = true;
+            break;
+          }
+          if (result != TSI_UNIMPLEMENTED) {
+            HandshakeFailedLocked(grpc_set_tsi_error_result(
+                GRPC_ERROR_CREATE("Kernel record protection setup failed"),
+                result));
+            return;
+          }
+        }
+      }
       // Create normal frame protector.
       result = tsi_handshaker_result_create_frame_protector(
           handshaker_result_, max_frame_size_ == 0 ? nullptr : &max_frame_size_,
@@ -333,8 +430,8 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
   args_->args = args_->args.SetObject(auth_context_);
-  // Add channelz channel args only if frame protector is created.
-  if (has_frame_protector) {
+  // Add channelz channel args only if the connection is protected.
+  if (has_frame_protector || kernel_protected) {
     args_->args = args_->args.SetObject(
         MakeChannelzSecurityFromAuthContext(auth_context_.get()));
   }
@@ -446,6 +543,35 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  // The pending step owns the caller's ref, as it does for TSI_ASYNC.
+  if (offload_ &&
+      HandshakeOffloader::Get()->TryRun(
+          [this, bytes_received, bytes_received_size]() {
+            OnOffloadedHandshakerNext(bytes_received, bytes_received_size);
+          })) {
+    return absl::OkStatus();
+  }
+  return InvokeHandshakerNextLocked(bytes_received, bytes_received_size);
+}
+
+void SecurityHandshaker::OnOffloadedHandshakerNext(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
+  RefCountedPtr<SecurityHandshaker> h(this);
+  MutexLock lock(&h->mu_);
+  // No need to run the crypto if the handshake was shut down meanwhile.
+  grpc_error_handle error =
+      h->is_shutdown_
+          ? GRPC_ERROR_CREATE("Handshaker shutdown")
+          : h->InvokeHandshakerNextLocked(bytes_received, bytes_received_size);
+  if (!error.ok()) {
+    h->HandshakeFailedLocked(error);
+  } else {
+    h.release();  // Avoid unref
+  }
+}
+
+grpc_error_handle SecurityHandshaker::InvokeHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
@@ -18,8 +18,6 @@
 
 #include "src/core/lib/service_config/service_config_impl.h"
 
-#include <string.h>
-
 #include <map>
 #include <string>
 #include <utility>
@@ -28,11 +26,11 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/support/log.h>
 
 #include "src/core/lib/config/core_configuration.h"
-#include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/service_config/service_config_parser.h"
 #include "src/core/lib/slice/slice.h"
@@ -45,31 +43,32 @@ absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
   auto json = Json::Parse(json_string);
   if (!json.ok()) return json.status();
   absl::Status status;
+  // The parsed tree is freed once the configs have been populated from it.
   auto service_config = MakeRefCounted<ServiceConfigImpl>(
-      args, std::string(json_string), std::move(*json), &status);
+      args, std::string(json_string), *json, &status);
   if (!status.ok()) return status;
   return service_config;
 }
 
 ServiceConfigImpl::ServiceConfigImpl(const ChannelArgs& args,
-                                     std::string json_string, Json json,
-                                     absl::Status* status)
-    : json_string_(std::move(json_string)), json_(std::move(json)) {
+                                     std::string json_string,
+                                     const Json& json, absl::Status* status)
+    : json_string_(std::move(json_string)) {
   GPR_DEBUG_ASSERT(status != nullptr);
-  if (json_.type() != Json::Type::OBJECT) {
+  if (json.type() != Json::Type::OBJECT) {
     *status = absl::InvalidArgumentError("JSON value is not an object");
     return;
   }
   std::vector<std::string> errors;
   auto parsed_global_configs =
       CoreConfiguration::Get().service_config_parser().ParseGlobalParameters(
-          args, json_);
+          args, json);
   if (!parsed_global_configs.ok()) {
     errors.emplace_back(parsed_global_configs.status().message());
   } else {
     parsed_global_configs_ = std::move(*parsed_global_configs);
   }
-  absl::Status local_status = ParsePerMethodParams(args);
+  absl::Status local_status = ParsePerMethodParams(args, json);
   if (!local_status.ok()) errors.emplace_back(local_status.message());
   if (!errors.empty()) {
     *status = absl::InvalidArgumentError(absl::StrCat(
@@ -77,12 +76,6 @@ ServiceConfigImpl::ServiceConfigImpl(const ChannelArgs& args,
   }
 }
 
-ServiceConfigImpl::~ServiceConfigImpl() {
-  for (auto& p : parsed_method_configs_map_) {
-    CSliceUnref(p.first);
-  }
-}
-
 absl::Status ServiceConfigImpl::ParseJsonMethodConfig(const ChannelArgs& args,
                                                       const Json& json,
                                                       size_t index) {
@@ -120,16 +113,10 @@ absl::Status ServiceConfigImpl::ParseJsonMethodConfig(const ChannelArgs& args,
             }
             default_method_config_vector_ = vector_ptr;
           } else {
-            grpc_slice key = grpc_slice_from_cpp_string(std::move(*path));
-            // If the key is not already present in the map, this will
-            // store a ref to the key in the map.
-            auto& value = parsed_method_configs_map_[key];
+            auto& value = parsed_method_configs_map_[std::move(*path)];
             if (value != nullptr) {
               errors.emplace_back(
                   "field:name error:multiple method configs with same name");
-              // The map entry already existed, so we need to unref the
-              // key we just created.
-              CSliceUnref(key);
             } else {
               value = vector_ptr;
             }
@@ -145,9 +132,10 @@ absl::Status ServiceConfigImpl::ParseJsonMethodConfig(const ChannelArgs& args,
   return absl::OkStatus();
 }
 
-absl::Status ServiceConfigImpl::ParsePerMethodParams(const ChannelArgs& args) {
-  auto it = json_.object_value().find("methodConfig");
-  if (it == json_.object_value().end()) return absl::OkStatus();
+absl::Status ServiceConfigImpl::ParsePerMethodParams(const ChannelArgs& args,
+                                                     const Json& json) {
+  auto it = json.object_value().find("methodConfig");
+  if (it == json.object_value().end()) return absl::OkStatus();
   if (it->second.type() != Json::Type::ARRAY) {
     return absl::InvalidArgumentError("field must be of type array");
   }
@@ -219,16 +207,15 @@ ServiceConfigImpl::GetMethodParsedConfigVector(const grpc_slice& path) const {
     return default_method_config_vector_;
   }
   // Try looking up the full path in the map.
-  auto it = parsed_method_configs_map_.find(path);
+  absl::string_view path_view = StringViewFromSlice(path);
+  auto it = parsed_method_configs_map_.find(path_view);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // If we didn't find a match for the path, try looking for a wildcard
   // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
-  it = parsed_method_configs_map_.find(wildcard_path);
+  size_t sep = path_view.rfind('/');
+  // Shouldn't ever happen.
+  if (sep == absl::string_view::npos) return nullptr;
+  it = parsed_method_configs_map_.find(path_view.substr(0, sep + 1));
   if (it != parsed_method_configs_map_.end()) return it->second;
   // Try default method config, if set.
   return default_method_config_vector_;
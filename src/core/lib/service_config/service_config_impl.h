@@ -23,9 +23,9 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
@@ -72,9 +72,10 @@ class ServiceConfigImpl final : public ServiceConfig {
   static absl::StatusOr<RefCountedPtr<ServiceConfig>> Create(
       const ChannelArgs& args, absl::string_view json_string);
 
-  ServiceConfigImpl(const ChannelArgs& args, std::string json_string, Json json,
-                    absl::Status* status);
-  ~ServiceConfigImpl() override;
+  // \a json is only used during construction and need not outlive it.
+  ServiceConfigImpl(const ChannelArgs& args, std::string json_string,
+                    const Json& json, absl::Status* status);
+  ~ServiceConfigImpl() override = default;
 
   absl::string_view json_string() const override { return json_string_; }
 
@@ -95,7 +96,7 @@ class ServiceConfigImpl final : public ServiceConfig {
 
  private:
   // Helper functions for parsing the method configs.
-  absl::Status ParsePerMethodParams(const ChannelArgs& args);
+  absl::Status ParsePerMethodParams(const ChannelArgs& args, const Json& json);
   absl::Status ParseJsonMethodConfig(const ChannelArgs& args, const Json& json,
                                      size_t index);
 
@@ -104,15 +105,15 @@ class ServiceConfigImpl final : public ServiceConfig {
   static absl::StatusOr<std::string> ParseJsonMethodName(const Json& json);
 
   std::string json_string_;
-  Json json_;
 
   std::vector<std::unique_ptr<ServiceConfigParser::ParsedConfig>>
       parsed_global_configs_;
   // A map from the method name to the parsed config vector. Note that we are
   // using a raw pointer and not a unique pointer so that we can use the same
-  // vector for multiple names.
-  std::unordered_map<grpc_slice, const ServiceConfigParser::ParsedConfigVector*,
-                     SliceHash>
+  // vector for multiple names. Looked up by string_view, so that neither the
+  // full path of a call nor its "/service/" prefix has to be copied.
+  absl::flat_hash_map<std::string,
+                      const ServiceConfigParser::ParsedConfigVector*>
       parsed_method_configs_map_;
   // Default method config.
   const ServiceConfigParser::ParsedConfigVector* default_method_config_vector_ =
@@ -0,0 +1,144 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/slice/slab_allocator.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+namespace {
+
+struct FreeSlab {
+  FreeSlab* next;
+};
+
+// Cached storage for one CPU. Shards are only contended when a thread
+// migrates between looking up its CPU and taking the lock, so the mutex is
+// nearly always free.
+struct Shard {
+  Mutex mu;
+  FreeSlab* free_slabs[SlabAllocator::kNumSizeClasses] ABSL_GUARDED_BY(mu) =
+      {};
+  size_t cached_bytes ABSL_GUARDED_BY(mu) = 0;
+  // Keeps neighbouring shards off each other's cache lines.
+  char padding[GPR_CACHELINE_SIZE];
+};
+
+struct Shards {
+  Shards() : num_shards(gpr_cpu_num_cores()), shards(new Shard[num_shards]) {}
+  const unsigned num_shards;
+  Shard* const shards;
+};
+
+// Never destroyed: slices may be freed during static destruction.
+Shards* GetShards() {
+  static Shards* shards = new Shards();
+  return shards;
+}
+
+Shard* CurrentShard() {
+  Shards* shards = GetShards();
+  return &shards->shards[gpr_cpu_current_cpu() % shards->num_shards];
+}
+
+}  // namespace
+
+void* SlabAllocator::Alloc(size_t size) {
+  int size_class = SizeClass(size);
+  if (size_class < 0) return gpr_malloc(size);
+  return AllocSizeClass(size_class);
+}
+
+void SlabAllocator::Free(void* p, size_t size) {
+  int size_class = SizeClass(size);
+  if (size_class < 0) {
+    gpr_free(p);
+    return;
+  }
+  FreeSizeClass(p, size_class);
+}
+
+void* SlabAllocator::AllocSizeClass(int size_class) {
+  Shard* shard = CurrentShard();
+  {
+    MutexLock lock(&shard->mu);
+    FreeSlab* slab = shard->free_slabs[size_class];
+    if (slab != nullptr) {
+      shard->free_slabs[size_class] = slab->next;
+      shard->cached_bytes -= SizeClassBytes(size_class);
+      return slab;
+    }
+  }
+  return gpr_malloc(SizeClassBytes(size_class));
+}
+
+void SlabAllocator::FreeSizeClass(void* p, int size_class) {
+  const size_t bytes = SizeClassBytes(size_class);
+  Shard* shard = CurrentShard();
+  {
+    MutexLock lock(&shard->mu);
+    if (shard->cached_bytes + bytes <= kMaxCachedBytesPerCpu) {
+      FreeSlab* slab = static_cast<FreeSlab*>(p);
+      slab->next = shard->free_slabs[size_class];
+      shard->free_slabs[size_class] = slab;
+      shard->cached_bytes += bytes;
+      return;
+    }
+  }
+  gpr_free(p);
+}
+
+size_t SlabAllocator::ReleaseCachedSlabs() {
+  Shards* shards = GetShards();
+  size_t released = 0;
+  for (unsigned i = 0; i < shards->num_shards; ++i) {
+    Shard* shard = &shards->shards[i];
+    FreeSlab* free_slabs[kNumSizeClasses];
+    {
+      MutexLock lock(&shard->mu);
+      for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+        free_slabs[size_class] = shard->free_slabs[size_class];
+        shard->free_slabs[size_class] = nullptr;
+      }
+      released += shard->cached_bytes;
+      shard->cached_bytes = 0;
+    }
+    for (FreeSlab* slab : free_slabs) {
+      while (slab != nullptr) {
+        FreeSlab* next = slab->next;
+        gpr_free(slab);
+        slab = next;
+      }
+    }
+  }
+  return released;
+}
+
+size_t SlabAllocator::CachedBytes() {
+  Shards* shards = GetShards();
+  size_t cached = 0;
+  for (unsigned i = 0; i < shards->num_shards; ++i) {
+    MutexLock lock(&shards->shards[i].mu);
+    cached += shards->shards[i].cached_bytes;
+  }
+  return cached;
+}
+
+}  // namespace grpc_core
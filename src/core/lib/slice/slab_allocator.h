@@ -0,0 +1,80 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_SLICE_SLAB_ALLOCATOR_H
+#define GRPC_CORE_LIB_SLICE_SLAB_ALLOCATOR_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+namespace grpc_core {
+
+// A process wide cache of freed slice storage.
+//
+// Allocations are rounded up to a size class: a power of two between
+// kMinSlabSize and kMaxSlabSize, plus kSlabHeaderSize bytes so that a slice
+// refcount placed in front of a power of two payload (the transports' 8KiB
+// and 64KiB read buffers, for instance) still fits. Freed buffers are cached
+// per CPU and handed back to allocations of the same size class on that CPU,
+// which keeps the churn of slice storage away from the system allocator.
+// Smaller and larger allocations go straight to gpr_malloc, so that no
+// allocation is rounded up by more than a factor of two.
+//
+// The cache is bounded per CPU, and ReleaseCachedSlabs() empties it; memory
+// quotas do so when they come under pressure.
+class SlabAllocator {
+ public:
+  static constexpr size_t kSlabHeaderSize = 64;
+  static constexpr size_t kMinSlabSize = 512;
+  static constexpr size_t kMaxSlabSize = 64 * 1024;
+  static constexpr int kNumSizeClasses = 8;
+  // Bytes of storage cached for each CPU.
+  static constexpr size_t kMaxCachedBytesPerCpu = 512 * 1024;
+
+  // Returns the size class for an allocation of \a size bytes, or -1 if such
+  // allocations are not cached.
+  static int SizeClass(size_t size) {
+    if (size <= kMinSlabSize / 2 + kSlabHeaderSize ||
+        size > kMaxSlabSize + kSlabHeaderSize) {
+      return -1;
+    }
+    int size_class = 0;
+    while ((kMinSlabSize << size_class) + kSlabHeaderSize < size) {
+      ++size_class;
+    }
+    return size_class;
+  }
+  // Returns the number of bytes allocated for \a size_class.
+  static constexpr size_t SizeClassBytes(int size_class) {
+    return (kMinSlabSize << size_class) + kSlabHeaderSize;
+  }
+
+  // Allocates at least \a size bytes.
+  static void* Alloc(size_t size);
+  // Frees \a p, which was returned by Alloc(size).
+  static void Free(void* p, size_t size);
+  // Like Alloc() and Free(), for an allocation whose size class is known.
+  static void* AllocSizeClass(int size_class);
+  static void FreeSizeClass(void* p, int size_class);
+
+  // Frees all cached storage. Returns the number of bytes released.
+  static size_t ReleaseCachedSlabs();
+  // Returns the number of bytes currently cached.
+  static size_t CachedBytes();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_SLICE_SLAB_ALLOCATOR_H
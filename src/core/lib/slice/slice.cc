@@ -24,11 +24,14 @@
 
 #include <new>
 
+#include "absl/utility/utility.h"
+
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/slice/slab_allocator.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_refcount.h"
 
@@ -220,11 +223,39 @@ grpc_slice grpc_slice_from_cpp_string(std::string str) {
   return slice;
 }
 
+namespace {
+
+template <int kSizeClass>
+void DestroySlabSlice(grpc_slice_refcount* p) {
+  grpc_core::SlabAllocator::FreeSizeClass(p, kSizeClass);
+}
+
+template <int... kSizeClasses>
+grpc_slice_refcount::DestroyerFn SlabSliceDestroyer(
+    int size_class, absl::integer_sequence<int, kSizeClasses...>) {
+  static const grpc_slice_refcount::DestroyerFn kDestroyers[] = {
+      DestroySlabSlice<kSizeClasses>...};
+  return kDestroyers[size_class];
+}
+
+}  // namespace
+
 grpc_slice grpc_slice_malloc_large(size_t length) {
   grpc_slice slice;
-  uint8_t* memory = new uint8_t[sizeof(grpc_slice_refcount) + length];
-  slice.refcount = new (memory) grpc_slice_refcount(
-      [](grpc_slice_refcount* p) { delete[] reinterpret_cast<uint8_t*>(p); });
+  const size_t size = sizeof(grpc_slice_refcount) + length;
+  const int size_class = grpc_core::SlabAllocator::SizeClass(size);
+  uint8_t* memory;
+  if (size_class < 0) {
+    memory = static_cast<uint8_t*>(gpr_malloc(size));
+    slice.refcount = new (memory)
+        grpc_slice_refcount([](grpc_slice_refcount* p) { gpr_free(p); });
+  } else {
+    memory = static_cast<uint8_t*>(
+        grpc_core::SlabAllocator::AllocSizeClass(size_class));
+    slice.refcount = new (memory) grpc_slice_refcount(SlabSliceDestroyer(
+        size_class, absl::make_integer_sequence<
+                        int, grpc_core::SlabAllocator::kNumSizeClasses>()));
+  }
   slice.data.refcounted.bytes = memory + sizeof(grpc_slice_refcount);
   slice.data.refcounted.length = length;
   return slice;
@@ -22,6 +22,7 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 
@@ -47,7 +48,7 @@ Slice SliceBuffer::TakeFirst() {
 }
 
 void SliceBuffer::Prepend(Slice slice) {
-  grpc_slice_buffer_undo_take_first(&slice_buffer_, slice.TakeCSlice());
+  grpc_slice_buffer_prepend(&slice_buffer_, slice.TakeCSlice());
 }
 
 Slice SliceBuffer::RefSlice(size_t index) const {
@@ -77,8 +78,11 @@ std::string SliceBuffer::JoinIntoString() const {
 static void GPR_ATTRIBUTE_NOINLINE do_embiggen(grpc_slice_buffer* sb,
                                                const size_t slice_count,
                                                const size_t slice_offset) {
-  if (slice_offset != 0) {
-    /* Make room by moving elements if there's still space unused */
+  if (slice_offset != 0 && slice_offset >= sb->count) {
+    /* Make room by moving elements if there's still space unused. Only do so
+     * once at least as many slices have been taken as are left, so that a
+     * buffer used as a queue pays for each move with the takes before it
+     * rather than moving all of its slices on every add. */
     memmove(sb->base_slices, sb->slices, sb->count * sizeof(grpc_slice));
     sb->slices = sb->base_slices;
   } else {
@@ -470,3 +474,44 @@ void grpc_slice_buffer_undo_take_first(grpc_slice_buffer* sb,
   sb->count++;
   sb->length += GRPC_SLICE_LENGTH(slice);
 }
+
+void grpc_slice_buffer_prepend(grpc_slice_buffer* sb, grpc_slice slice) {
+  if (sb->count != 0 && slice.refcount != nullptr &&
+      slice.refcount == sb->slices[0].refcount &&
+      GRPC_SLICE_END_PTR(slice) == GRPC_SLICE_START_PTR(sb->slices[0])) {
+    // Contiguous with the first slice and sharing its refcount: extend the
+    // first slice backwards instead.
+    sb->slices[0].data.refcounted.bytes = slice.data.refcounted.bytes;
+    sb->slices[0].data.refcounted.length += slice.data.refcounted.length;
+    sb->length += slice.data.refcounted.length;
+    grpc_core::CSliceUnref(slice);
+    return;
+  }
+  if (sb->slices == sb->base_slices) {
+    if (sb->count == 0) {
+      // Nothing to move: put the slice at the back so that there's room for
+      // more prepends in front of it.
+      sb->slices = sb->base_slices + sb->capacity;
+    } else {
+      // Leave as much room at the front as there are slices, so that the
+      // move is paid for by the prepends that fill that room.
+      const size_t headroom = sb->count;
+      const size_t needed = sb->count + headroom;
+      if (needed > sb->capacity) {
+        const size_t new_capacity = std::max(needed, GROW(sb->capacity));
+        grpc_slice* new_slices = static_cast<grpc_slice*>(
+            gpr_malloc(new_capacity * sizeof(grpc_slice)));
+        memcpy(new_slices + headroom, sb->slices,
+               sb->count * sizeof(grpc_slice));
+        if (sb->base_slices != sb->inlined) gpr_free(sb->base_slices);
+        sb->base_slices = new_slices;
+        sb->capacity = new_capacity;
+      } else {
+        memmove(sb->base_slices + headroom, sb->slices,
+                sb->count * sizeof(grpc_slice));
+      }
+      sb->slices = sb->base_slices + headroom;
+    }
+  }
+  grpc_slice_buffer_undo_take_first(sb, slice);
+}
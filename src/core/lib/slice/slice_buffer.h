@@ -80,13 +80,20 @@ class SliceBuffer {
     grpc_slice_buffer_move_first_into_buffer(&slice_buffer_, n, dst);
   }
 
+  /// Move the first n bytes of the SliceBuffer into the other SliceBuffer; a
+  /// slice straddling the boundary is split, not copied.
+  void MoveFirstNBytesIntoSliceBuffer(size_t n, SliceBuffer& other) {
+    grpc_slice_buffer_move_first(&slice_buffer_, n, &other.slice_buffer_);
+  }
+
   /// Removes and unrefs all slices in the SliceBuffer.
   void Clear() { grpc_slice_buffer_reset_and_unref(&slice_buffer_); }
 
   /// Removes the first slice in the SliceBuffer and returns it.
   Slice TakeFirst();
 
-  /// Prepends the slice to the the front of the SliceBuffer.
+  /// Prepends the slice to the the front of the SliceBuffer. Runs in amortized
+  /// constant time, whether or not a slice was taken from the front before.
   void Prepend(Slice slice);
 
   /// Increased the ref-count of slice at the specified index and returns the
@@ -134,4 +141,10 @@ class SliceBuffer {
 void grpc_slice_buffer_copy_first_into_buffer(grpc_slice_buffer* src, size_t n,
                                               void* dst);
 
+// Add slice to the front of sb. Unlike grpc_slice_buffer_undo_take_first,
+// this does not need a slice to have been taken first: when there is no room
+// at the front, room is made for as many slices as sb holds. A slice that
+// ends where the first slice of sb begins is merged into it.
+void grpc_slice_buffer_prepend(grpc_slice_buffer* sb, grpc_slice slice);
+
 #endif  // GRPC_CORE_LIB_SLICE_SLICE_BUFFER_H
@@ -42,7 +42,12 @@ struct grpc_slice_refcount {
 
   void Ref() { ref_.fetch_add(1, std::memory_order_relaxed); }
   void Unref() {
-    if (ref_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // Most slices are dropped by the only thread that ever saw them. Holding
+    // the last reference means nobody else can take a new one, so the
+    // read-modify-write can be skipped: the acquire load still orders this
+    // thread after the other holders' releasing decrements.
+    if (ref_.load(std::memory_order_acquire) == 1 ||
+        ref_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
       destroyer_fn_(this);
     }
   }
@@ -52,6 +57,10 @@ struct grpc_slice_refcount {
   // instance, no other instance could be created during this call.
   bool IsUnique() const { return ref_.load(std::memory_order_relaxed) == 1; }
 
+  // The function this refcount was created with, which identifies the kind
+  // of storage behind the slices that use it.
+  DestroyerFn destroyer_fn() const { return destroyer_fn_; }
+
  private:
   std::atomic<size_t> ref_{1};
   DestroyerFn destroyer_fn_ = nullptr;
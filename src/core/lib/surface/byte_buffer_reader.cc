@@ -82,6 +82,12 @@ int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
 }
 
 grpc_slice grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader) {
+  grpc_slice_buffer* slice_buffer = &reader->buffer_out->data.raw.slice_buffer;
+  // A buffer that is already a single slice needs no merging: share it.
+  if (reader->current.index == 0 && slice_buffer->count == 1) {
+    reader->current.index = 1;
+    return grpc_core::CSliceRef(slice_buffer->slices[0]);
+  }
   grpc_slice in_slice;
   size_t bytes_read = 0;
   const size_t input_size = grpc_byte_buffer_length(reader->buffer_out);
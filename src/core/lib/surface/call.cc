@@ -25,6 +25,7 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <memory>
@@ -126,6 +127,7 @@ class Call : public CppImplOf<Call, grpc_call> {
                                      void* notify_tag,
                                      bool is_notify_tag_closure) = 0;
   virtual bool failed_before_recv_message() const = 0;
+  virtual bool recv_message_is_partial() const = 0;
   virtual bool is_trailers_only() const = 0;
   virtual absl::string_view GetServerAuthority() const = 0;
   virtual void ExternalRef() = 0;
@@ -173,8 +175,9 @@ class Call : public CppImplOf<Call, grpc_call> {
   };
 
   Call(Arena* arena, bool is_client, Timestamp send_deadline,
-       RefCountedPtr<Channel> channel)
+       RefCountedPtr<Channel> channel, RegisteredCall* registered_call)
       : channel_(std::move(channel)),
+        registered_call_(registered_call),
         arena_(arena),
         send_deadline_(send_deadline),
         is_client_(is_client) {
@@ -206,6 +209,7 @@ class Call : public CppImplOf<Call, grpc_call> {
 
  private:
   RefCountedPtr<Channel> channel_;
+  RegisteredCall* const registered_call_;
   Arena* const arena_;
   std::atomic<ParentCall*> parent_call_{nullptr};
   ChildCall* child_ = nullptr;
@@ -345,9 +349,18 @@ char* Call::GetPeer() {
 
 void Call::DeleteThis() {
   RefCountedPtr<Channel> channel = std::move(channel_);
+  // Owned by the channel's registration table, which outlives the call.
+  RegisteredCall* registered_call = registered_call_;
   Arena* arena = arena_;
   this->~Call();
-  channel->UpdateCallSizeEstimate(arena->Destroy());
+  for (size_t i = arena->ZoneAllocations(); i > 0; --i) {
+    global_stats().IncrementCallArenaZoneAllocs();
+  }
+  size_t size = arena->Destroy();
+  channel->UpdateCallSizeEstimate(size);
+  if (registered_call != nullptr) {
+    registered_call->call_size_estimator.UpdateCallSizeEstimate(size);
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -423,6 +436,10 @@ class FilterStackCall final : public Call {
     return call_failed_before_recv_message_;
   }
 
+  bool recv_message_is_partial() const override {
+    return recv_message_is_partial_;
+  }
+
   absl::string_view GetServerAuthority() const override {
     const Slice* authority_metadata =
         recv_initial_metadata_.get_pointer(HttpAuthorityMetadata());
@@ -496,7 +513,7 @@ class FilterStackCall final : public Call {
 
   FilterStackCall(Arena* arena, const grpc_call_create_args& args)
       : Call(arena, args.server_transport_data == nullptr, args.send_deadline,
-             args.channel->Ref()),
+             args.channel->Ref(), args.registered_call),
         cq_(args.cq),
         stream_op_payload_(context_) {}
 
@@ -575,6 +592,8 @@ class FilterStackCall final : public Call {
   uint32_t receiving_stream_flags_;
 
   bool call_failed_before_recv_message_ = false;
+  // Whether the last message received is followed by more of it.
+  bool recv_message_is_partial_ = false;
   grpc_byte_buffer** receiving_buffer_ = nullptr;
   grpc_slice receiving_slice_ = grpc_empty_slice();
   grpc_closure receiving_stream_ready_;
@@ -637,7 +656,7 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
   FilterStackCall* call;
   grpc_error_handle error;
   grpc_channel_stack* channel_stack = channel->channel_stack();
-  size_t initial_size = channel->CallSizeEstimate();
+  size_t initial_size = channel->CallSizeEstimate(args->registered_call);
   global_stats().IncrementCallInitialSize(initial_size);
   size_t call_alloc_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(FilterStackCall)) +
@@ -828,8 +847,9 @@ static void done_termination(void* arg, grpc_error_handle /*error*/) {
   CancelState* state = static_cast<CancelState*>(arg);
   GRPC_CALL_COMBINER_STOP(state->call->call_combiner(),
                           "on_complete for cancel_stream op");
+  // The state lives in the call's arena, so it must not be touched after the
+  // call is unreffed.
   state->call->InternalUnref("termination");
-  delete state;
 }
 
 void FilterStackCall::CancelWithError(grpc_error_handle error) {
@@ -843,7 +863,7 @@ void FilterStackCall::CancelWithError(grpc_error_handle error) {
   // combiner.  This ensures that the cancel_stream batch can be sent
   // down the filter stack in a timely manner.
   call_combiner_.Cancel(error);
-  CancelState* state = new CancelState;
+  CancelState* state = arena()->New<CancelState>();
   state->call = this;
   GRPC_CLOSURE_INIT(&state->finish_batch, done_termination, state,
                     grpc_schedule_on_exec_ctx);
@@ -874,6 +894,7 @@ void FilterStackCall::SetFinalStatus(grpc_error_handle error) {
       } else {
         channelz_channel->RecordCallSucceeded();
       }
+      channelz_channel->RecordCallLatency(start_time_);
     }
   } else {
     *final_op_.server.cancelled =
@@ -886,6 +907,7 @@ void FilterStackCall::SetFinalStatus(grpc_error_handle error) {
       } else {
         channelz_node->RecordCallSucceeded();
       }
+      channelz_node->RecordCallLatency(start_time_);
     }
   }
 }
@@ -1168,6 +1190,9 @@ void FilterStackCall::BatchControl::ProcessDataAfterMetadata() {
     FinishStep();
   } else {
     call->test_only_last_message_flags_ = call->receiving_stream_flags_;
+    call->recv_message_is_partial_ =
+        (call->receiving_stream_flags_ & GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE) !=
+        0;
     if ((call->receiving_stream_flags_ & GRPC_WRITE_INTERNAL_COMPRESS) &&
         (call->incoming_compression_algorithm_ != GRPC_COMPRESS_NONE)) {
       *call->receiving_buffer_ = grpc_raw_compressed_byte_buffer_create(
@@ -1327,6 +1352,54 @@ void FilterStackCall::BatchControl::FinishBatch(grpc_error_handle error) {
 }
 
 namespace {
+constexpr uint32_t kNumOpTypes = GRPC_OP_RECV_CLOSE_ON_SERVER + 1;
+
+constexpr uint32_t OpBit(grpc_op_type op) { return 1u << op; }
+
+constexpr uint32_t kSendOps =
+    OpBit(GRPC_OP_SEND_INITIAL_METADATA) | OpBit(GRPC_OP_SEND_MESSAGE) |
+    OpBit(GRPC_OP_SEND_CLOSE_FROM_CLIENT) |
+    OpBit(GRPC_OP_SEND_STATUS_FROM_SERVER);
+constexpr uint32_t kClientOnlyOps = OpBit(GRPC_OP_SEND_CLOSE_FROM_CLIENT) |
+                                    OpBit(GRPC_OP_RECV_STATUS_ON_CLIENT);
+constexpr uint32_t kServerOnlyOps = OpBit(GRPC_OP_SEND_STATUS_FROM_SERVER) |
+                                    OpBit(GRPC_OP_RECV_CLOSE_ON_SERVER);
+
+// What FilterStackCall::StartBatch needs to know about a batch that depends
+// only on the set of ops in it; precomputed for every set, so that checking
+// and counting the ops of a batch is a single lookup.
+struct BatchShape {
+  grpc_call_error client_error;
+  grpc_call_error server_error;
+  // The number of steps the batch takes to complete: one for all the send
+  // ops together, and one per receive op.
+  uint8_t num_steps;
+  bool has_send_ops;
+};
+
+constexpr BatchShape MakeBatchShape(uint32_t ops) {
+  uint8_t num_recv_ops = 0;
+  for (uint32_t op = 0; op < kNumOpTypes; op++) {
+    if ((ops & ~kSendOps & (1u << op)) != 0) ++num_recv_ops;
+  }
+  const bool has_send_ops = (ops & kSendOps) != 0;
+  return BatchShape{(ops & kServerOnlyOps) != 0 ? GRPC_CALL_ERROR_NOT_ON_CLIENT
+                                                : GRPC_CALL_OK,
+                    (ops & kClientOnlyOps) != 0 ? GRPC_CALL_ERROR_NOT_ON_SERVER
+                                                : GRPC_CALL_OK,
+                    static_cast<uint8_t>(num_recv_ops + (has_send_ops ? 1 : 0)),
+                    has_send_ops};
+}
+
+template <size_t... kOps>
+constexpr std::array<BatchShape, sizeof...(kOps)> MakeBatchShapes(
+    std::index_sequence<kOps...>) {
+  return {{MakeBatchShape(kOps)...}};
+}
+
+constexpr std::array<BatchShape, 1u << kNumOpTypes> kBatchShapes =
+    MakeBatchShapes(std::make_index_sequence<1u << kNumOpTypes>());
+
 void EndOpImmediately(grpc_completion_queue* cq, void* notify_tag,
                       bool is_notify_tag_closure) {
   if (!is_notify_tag_closure) {
@@ -1350,19 +1423,23 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
   size_t i;
   const grpc_op* op;
   BatchControl* bctl;
-  bool has_send_ops = false;
-  int num_recv_ops = 0;
   grpc_call_error error = GRPC_CALL_OK;
   grpc_transport_stream_op_batch* stream_op;
   grpc_transport_stream_op_batch_payload* stream_op_payload;
   uint32_t seen_ops = 0;
 
   for (i = 0; i < nops; i++) {
+    if (static_cast<uint32_t>(ops[i].op) >= kNumOpTypes) {
+      return GRPC_CALL_ERROR;
+    }
     if (seen_ops & (1u << ops[i].op)) {
       return GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
     }
     seen_ops |= (1u << ops[i].op);
   }
+  const BatchShape& shape = kBatchShapes[seen_ops];
+  error = is_client() ? shape.client_error : shape.server_error;
+  if (error != GRPC_CALL_OK) return error;
 
   GRPC_CALL_LOG_BATCH(GPR_INFO, ops, nops);
 
@@ -1463,7 +1540,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           stream_op_payload->send_initial_metadata.peer_string =
               peer_string_atm_ptr();
         }
-        has_send_ops = true;
         break;
       }
       case GRPC_OP_SEND_MESSAGE: {
@@ -1495,7 +1571,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
             send_slice_buffer_.c_slice_buffer());
         stream_op_payload->send_message.flags = flags;
         stream_op_payload->send_message.send_message = &send_slice_buffer_;
-        has_send_ops = true;
         break;
       }
       case GRPC_OP_SEND_CLOSE_FROM_CLIENT: {
@@ -1504,10 +1579,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           error = GRPC_CALL_ERROR_INVALID_FLAGS;
           goto done_with_error;
         }
-        if (!is_client()) {
-          error = GRPC_CALL_ERROR_NOT_ON_SERVER;
-          goto done_with_error;
-        }
         if (sent_final_op_) {
           error = GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
           goto done_with_error;
@@ -1516,7 +1587,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
         sent_final_op_ = true;
         stream_op_payload->send_trailing_metadata.send_trailing_metadata =
             &send_trailing_metadata_;
-        has_send_ops = true;
         break;
       }
       case GRPC_OP_SEND_STATUS_FROM_SERVER: {
@@ -1525,10 +1595,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           error = GRPC_CALL_ERROR_INVALID_FLAGS;
           goto done_with_error;
         }
-        if (is_client()) {
-          error = GRPC_CALL_ERROR_NOT_ON_CLIENT;
-          goto done_with_error;
-        }
         if (sent_final_op_) {
           error = GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
           goto done_with_error;
@@ -1580,7 +1646,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
             &send_trailing_metadata_;
         stream_op_payload->send_trailing_metadata.sent =
             &sent_server_trailing_metadata_;
-        has_send_ops = true;
         break;
       }
       case GRPC_OP_RECV_INITIAL_METADATA: {
@@ -1615,12 +1680,11 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           stream_op_payload->recv_initial_metadata.peer_string =
               peer_string_atm_ptr();
         }
-        ++num_recv_ops;
         break;
       }
       case GRPC_OP_RECV_MESSAGE: {
-        /* Flag validation: currently allow no flags */
-        if (op->flags != 0) {
+        /* Flag validation: only allow partial messages */
+        if ((op->flags & ~GRPC_RECV_MESSAGE_ALLOW_PARTIAL) != 0) {
           error = GRPC_CALL_ERROR_INVALID_FLAGS;
           goto done_with_error;
         }
@@ -1637,6 +1701,9 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
         stream_op_payload->recv_message.flags = &receiving_stream_flags_;
         stream_op_payload->recv_message.call_failed_before_recv_message =
             &call_failed_before_recv_message_;
+        stream_op_payload->recv_message.allow_partial =
+            (op->flags & GRPC_RECV_MESSAGE_ALLOW_PARTIAL) != 0;
+        recv_message_is_partial_ = false;
         GRPC_CLOSURE_INIT(
             &receiving_stream_ready_,
             [](void* bctlp, grpc_error_handle error) {
@@ -1651,7 +1718,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
             bctl, grpc_schedule_on_exec_ctx);
         stream_op_payload->recv_message.recv_message_ready =
             &receiving_stream_ready_;
-        ++num_recv_ops;
         break;
       }
       case GRPC_OP_RECV_STATUS_ON_CLIENT: {
@@ -1660,10 +1726,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           error = GRPC_CALL_ERROR_INVALID_FLAGS;
           goto done_with_error;
         }
-        if (!is_client()) {
-          error = GRPC_CALL_ERROR_NOT_ON_SERVER;
-          goto done_with_error;
-        }
         if (requested_final_op_) {
           error = GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
           goto done_with_error;
@@ -1690,7 +1752,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
             bctl, grpc_schedule_on_exec_ctx);
         stream_op_payload->recv_trailing_metadata.recv_trailing_metadata_ready =
             &receiving_trailing_metadata_ready_;
-        ++num_recv_ops;
         break;
       }
       case GRPC_OP_RECV_CLOSE_ON_SERVER: {
@@ -1699,10 +1760,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           error = GRPC_CALL_ERROR_INVALID_FLAGS;
           goto done_with_error;
         }
-        if (is_client()) {
-          error = GRPC_CALL_ERROR_NOT_ON_CLIENT;
-          goto done_with_error;
-        }
         if (requested_final_op_) {
           error = GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
           goto done_with_error;
@@ -1723,7 +1780,6 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
             bctl, grpc_schedule_on_exec_ctx);
         stream_op_payload->recv_trailing_metadata.recv_trailing_metadata_ready =
             &receiving_trailing_metadata_ready_;
-        ++num_recv_ops;
         break;
       }
     }
@@ -1733,9 +1789,9 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
   if (!is_notify_tag_closure) {
     GPR_ASSERT(grpc_cq_begin_op(cq_, notify_tag));
   }
-  bctl->set_num_steps_to_complete((has_send_ops ? 1 : 0) + num_recv_ops);
+  bctl->set_num_steps_to_complete(shape.num_steps);
 
-  if (has_send_ops) {
+  if (shape.has_send_ops) {
     GRPC_CLOSURE_INIT(
         &bctl->finish_batch_,
         [](void* bctl, grpc_error_handle error) {
@@ -2186,8 +2242,9 @@ grpc_error_handle MakePromiseBasedCall(grpc_call_create_args* args,
                                        grpc_call** out_call) {
   Channel* channel = args->channel.get();
 
-  auto alloc = Arena::CreateWithAlloc(channel->CallSizeEstimate(), sizeof(T),
-                                      channel->allocator());
+  auto alloc = Arena::CreateWithAlloc(
+      channel->CallSizeEstimate(args->registered_call), sizeof(T),
+      channel->allocator());
   PromiseBasedCall* call = new (alloc.second) T(alloc.first, args);
   *out_call = call->c_ptr();
   GPR_DEBUG_ASSERT(Call::FromC(*out_call) == call);
@@ -2197,7 +2254,7 @@ grpc_error_handle MakePromiseBasedCall(grpc_call_create_args* args,
 PromiseBasedCall::PromiseBasedCall(Arena* arena,
                                    const grpc_call_create_args& args)
     : Call(arena, args.server_transport_data == nullptr, args.send_deadline,
-           args.channel->Ref()),
+           args.channel->Ref(), args.registered_call),
       cq_(args.cq) {
   if (args.cq != nullptr) {
     GPR_ASSERT(args.pollset_set_alternative == nullptr &&
@@ -2404,6 +2461,8 @@ class ClientPromiseBasedCall final : public PromiseBasedCall {
     return is_trailers_only_;
   }
   bool failed_before_recv_message() const override { abort(); }
+  // Messages are always received whole.
+  bool recv_message_is_partial() const override { return false; }
 
   grpc_call_error StartBatch(const grpc_op* ops, size_t nops, void* notify_tag,
                              bool is_notify_tag_closure) override;
@@ -2504,8 +2563,12 @@ grpc_call_error ClientPromiseBasedCall::ValidateBatch(const grpc_op* ops,
           return GRPC_CALL_ERROR_INVALID_FLAGS;
         }
         break;
-      case GRPC_OP_RECV_INITIAL_METADATA:
       case GRPC_OP_RECV_MESSAGE:
+        if ((op.flags & ~GRPC_RECV_MESSAGE_ALLOW_PARTIAL) != 0) {
+          return GRPC_CALL_ERROR_INVALID_FLAGS;
+        }
+        break;
+      case GRPC_OP_RECV_INITIAL_METADATA:
       case GRPC_OP_SEND_CLOSE_FROM_CLIENT:
       case GRPC_OP_RECV_STATUS_ON_CLIENT:
         if (op.flags != 0) return GRPC_CALL_ERROR_INVALID_FLAGS;
@@ -3002,6 +3065,10 @@ int grpc_call_failed_before_recv_message(const grpc_call* c) {
   return grpc_core::Call::FromC(c)->failed_before_recv_message();
 }
 
+int grpc_call_recv_message_is_partial(const grpc_call* c) {
+  return grpc_core::Call::FromC(c)->recv_message_is_partial();
+}
+
 absl::string_view grpc_call_server_authority(const grpc_call* call) {
   return grpc_core::Call::FromC(call)->GetServerAuthority();
 }
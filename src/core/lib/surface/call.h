@@ -68,6 +68,8 @@ typedef struct grpc_call_create_args {
 
   absl::optional<grpc_core::Slice> path;
   absl::optional<grpc_core::Slice> authority;
+  /* if not NULL, the method called: sizes the arena of the call */
+  grpc_core::RegisteredCall* registered_call;
 
   grpc_core::Timestamp send_deadline;
 } grpc_call_create_args;
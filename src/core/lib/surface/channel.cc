@@ -27,8 +27,11 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <utility>
 
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/compression.h>
 #include <grpc/grpc.h>
@@ -70,8 +73,8 @@ Channel::Channel(bool is_client, bool is_promising, std::string target,
     : is_client_(is_client),
       is_promising_(is_promising),
       compression_options_(compression_options),
-      call_size_estimate_(channel_stack->call_stack_size +
-                          grpc_call_get_initial_size_estimate()),
+      call_size_estimator_(channel_stack->call_stack_size +
+                           grpc_call_get_initial_size_estimate()),
       channelz_node_(channel_args.GetObjectRef<channelz::ChannelNode>()),
       allocator_(channel_args.GetObject<ResourceQuota>()
                      ->memory_quota()
@@ -209,6 +212,9 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::Create(
           MakeRefCounted<channelz::ChannelNode>(channelz_node_target,
                                                 channel_tracer_max_memory,
                                                 is_internal_channel);
+      if (args.GetBool(GRPC_ARG_CHANNELZ_LATENCY_HISTOGRAMS).value_or(false)) {
+        channelz_node->EnableLatencyHistograms();
+      }
       channelz_node->AddTraceEvent(
           channelz::ChannelTrace::Severity::Info,
           grpc_slice_from_static_string("Channel created"));
@@ -230,7 +236,7 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::Create(
   return CreateWithBuilder(&builder);
 }
 
-void Channel::UpdateCallSizeEstimate(size_t size) {
+void CallSizeEstimator::UpdateCallSizeEstimate(size_t size) {
   size_t cur = call_size_estimate_.load(std::memory_order_relaxed);
   if (cur < size) {
     // size grew: update estimate
@@ -283,7 +289,7 @@ static grpc_call* grpc_channel_create_call_internal(
     grpc_channel* c_channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
     grpc_core::Slice path, absl::optional<grpc_core::Slice> authority,
-    grpc_core::Timestamp deadline) {
+    grpc_core::Timestamp deadline, grpc_core::RegisteredCall* registered_call) {
   auto channel = grpc_core::Channel::FromC(c_channel)->Ref();
   GPR_ASSERT(channel->is_client());
   GPR_ASSERT(!(cq != nullptr && pollset_set_alternative != nullptr));
@@ -298,6 +304,7 @@ static grpc_call* grpc_channel_create_call_internal(
   args.server_transport_data = nullptr;
   args.path = std::move(path);
   args.authority = std::move(authority);
+  args.registered_call = registered_call;
   args.send_deadline = deadline;
 
   grpc_call* call;
@@ -320,7 +327,7 @@ grpc_call* grpc_channel_create_call(grpc_channel* channel,
       host != nullptr
           ? absl::optional<grpc_core::Slice>(grpc_core::CSliceRef(*host))
           : absl::nullopt,
-      grpc_core::Timestamp::FromTimespecRoundUp(deadline));
+      grpc_core::Timestamp::FromTimespecRoundUp(deadline), nullptr);
 
   return call;
 }
@@ -336,12 +343,14 @@ grpc_call* grpc_channel_create_pollset_set_call(
       host != nullptr
           ? absl::optional<grpc_core::Slice>(grpc_core::CSliceRef(*host))
           : absl::nullopt,
-      deadline);
+      deadline, nullptr);
 }
 
 namespace grpc_core {
 
-RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg) {
+RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg,
+                               size_t call_size_estimate)
+    : call_size_estimator(call_size_estimate) {
   path = Slice::FromCopiedString(method_arg);
   if (host_arg != nullptr && host_arg[0] != 0) {
     authority = Slice::FromCopiedString(host_arg);
@@ -349,7 +358,7 @@ RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg) {
 }
 
 RegisteredCall::RegisteredCall(const RegisteredCall& other)
-    : path(other.path.Ref()) {
+    : path(other.path.Ref()), call_size_estimator(other.call_size_estimator) {
   if (other.authority.has_value()) {
     authority = other.authority->Ref();
   }
@@ -372,18 +381,56 @@ void* grpc_channel_register_call(grpc_channel* channel, const char* method,
 
 namespace grpc_core {
 
-RegisteredCall* Channel::RegisterCall(const char* method, const char* host) {
-  MutexLock lock(&registration_table_.mu);
-  registration_table_.method_registration_attempts++;
-  auto key = std::make_pair(std::string(host != nullptr ? host : ""),
-                            std::string(method != nullptr ? method : ""));
-  auto rc_posn = registration_table_.map.find(key);
-  if (rc_posn != registration_table_.map.end()) {
-    return &rc_posn->second;
+CallRegistrationTable::~CallRegistrationTable() {
+  for (auto& bucket : buckets_) {
+    Entry* entry = bucket.load(std::memory_order_relaxed);
+    while (entry != nullptr) {
+      Entry* next = entry->next;
+      delete entry;
+      entry = next;
+    }
+  }
+}
+
+CallRegistrationTable::Entry* CallRegistrationTable::Find(
+    Entry* head, absl::string_view method, absl::string_view host) {
+  for (Entry* entry = head; entry != nullptr; entry = entry->next) {
+    if (entry->method == method && entry->host == host) return entry;
   }
-  auto insertion_result = registration_table_.map.insert(
-      {std::move(key), RegisteredCall(method, host)});
-  return &insertion_result.first->second;
+  return nullptr;
+}
+
+RegisteredCall* CallRegistrationTable::Register(const char* method,
+                                                const char* host,
+                                                size_t call_size_estimate) {
+  registration_attempts_.fetch_add(1, std::memory_order_relaxed);
+  absl::string_view method_view = method != nullptr ? method : "";
+  absl::string_view host_view = host != nullptr ? host : "";
+  std::atomic<Entry*>& bucket =
+      buckets_[absl::Hash<std::pair<absl::string_view, absl::string_view>>()(
+                   {method_view, host_view}) %
+               kNumBuckets];
+  // Entries are published with a release store of the bucket head and never
+  // change afterwards, so this sees every field of those it finds.
+  Entry* head = bucket.load(std::memory_order_acquire);
+  Entry* entry = Find(head, method_view, host_view);
+  if (entry != nullptr) return &entry->call;
+  MutexLock lock(&mu_);
+  Entry* locked_head = bucket.load(std::memory_order_relaxed);
+  if (locked_head != head) {
+    entry = Find(locked_head, method_view, host_view);
+    if (entry != nullptr) return &entry->call;
+  }
+  entry = new Entry(std::string(method_view), std::string(host_view),
+                    call_size_estimate, locked_head);
+  bucket.store(entry, std::memory_order_release);
+  size_.fetch_add(1, std::memory_order_relaxed);
+  return &entry->call;
+}
+
+RegisteredCall* Channel::RegisterCall(const char* method, const char* host) {
+  return registration_table_.Register(
+      method, host, call_size_estimator_.RawCallSizeEstimate());
 }
 
 }  // namespace grpc_core
@@ -414,7 +461,7 @@ grpc_call* grpc_channel_create_registered_call(
       rc->authority.has_value()
           ? absl::optional<grpc_core::Slice>(rc->authority->Ref())
           : absl::nullopt,
-      grpc_core::Timestamp::FromTimespecRoundUp(deadline));
+      grpc_core::Timestamp::FromTimespecRoundUp(deadline), rc);
 
   return call;
 }
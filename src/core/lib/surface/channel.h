@@ -25,7 +25,6 @@
 #include <stdint.h>
 
 #include <atomic>
-#include <map>
 #include <string>
 #include <utility>
 
@@ -85,25 +84,101 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
 
 namespace grpc_core {
 
+// Tracks the arena sizes of finished calls to size the arenas of new ones.
+class CallSizeEstimator {
+ public:
+  explicit CallSizeEstimator(size_t initial_estimate)
+      : call_size_estimate_(initial_estimate) {}
+  CallSizeEstimator(const CallSizeEstimator& other)
+      : call_size_estimate_(
+            other.call_size_estimate_.load(std::memory_order_relaxed)) {}
+  CallSizeEstimator& operator=(const CallSizeEstimator&) = delete;
+
+  size_t CallSizeEstimate() const {
+    // We round up our current estimate to the NEXT value of kRoundUpSize.
+    // This ensures:
+    //  1. a consistent size allocation when our estimate is drifting slowly
+    //     (which is common) - which tends to help most allocators reuse memory
+    //  2. a small amount of allowed growth over the estimate without hitting
+    //     the arena size doubling case, reducing overall memory usage
+    static constexpr size_t kRoundUpSize = 256;
+    return (call_size_estimate_.load(std::memory_order_relaxed) +
+            2 * kRoundUpSize) &
+           ~(kRoundUpSize - 1);
+  }
+
+  // Returns the estimate before rounding.
+  size_t RawCallSizeEstimate() const {
+    return call_size_estimate_.load(std::memory_order_relaxed);
+  }
+
+  void UpdateCallSizeEstimate(size_t size);
+
+ private:
+  std::atomic<size_t> call_size_estimate_;
+};
+
 struct RegisteredCall {
   Slice path;
   absl::optional<Slice> authority;
+  // Arena sizes of the calls to this method: methods with large metadata or
+  // payloads would otherwise overflow arenas sized for the whole channel.
+  CallSizeEstimator call_size_estimator;
 
-  explicit RegisteredCall(const char* method_arg, const char* host_arg);
+  RegisteredCall(const char* method_arg, const char* host_arg,
+                 size_t call_size_estimate);
   RegisteredCall(const RegisteredCall& other);
   RegisteredCall& operator=(const RegisteredCall&) = delete;
 
   ~RegisteredCall();
 };
 
-struct CallRegistrationTable {
-  Mutex mu;
-  // The map key should be owned strings rather than unowned char*'s to
-  // guarantee that it outlives calls on the core channel (which may outlast the
-  // C++ or other wrapped language Channel that registered these calls).
-  std::map<std::pair<std::string, std::string>, RegisteredCall> map
-      ABSL_GUARDED_BY(mu);
-  int method_registration_attempts ABSL_GUARDED_BY(mu) = 0;
+// The calls registered on a channel. Registrations last as long as the
+// channel, so the table only ever grows: lookups walk its buckets without
+// taking the lock, which only guards adding new registrations.
+class CallRegistrationTable {
+ public:
+  CallRegistrationTable() = default;
+  ~CallRegistrationTable();
+  CallRegistrationTable(const CallRegistrationTable&) = delete;
+  CallRegistrationTable& operator=(const CallRegistrationTable&) = delete;
+
+  // Returns the registration of \a method with \a host (either may be
+  // null), creating it with \a call_size_estimate if there is none yet.
+  RegisteredCall* Register(const char* method, const char* host,
+                           size_t call_size_estimate);
+
+  int size() const { return size_.load(std::memory_order_relaxed); }
+  int registration_attempts() const {
+    return registration_attempts_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_t kNumBuckets = 64;
+
+  struct Entry {
+    Entry(std::string method, std::string host, size_t call_size_estimate,
+          Entry* next)
+        : method(std::move(method)),
+          host(std::move(host)),
+          call(this->method.c_str(), this->host.c_str(), call_size_estimate),
+          next(next) {}
+
+    // Owned strings rather than the caller's char*'s: the registration may
+    // outlive the C++ or other wrapped language Channel that made it.
+    const std::string method;
+    const std::string host;
+    RegisteredCall call;
+    Entry* const next;
+  };
+
+  static Entry* Find(Entry* head, absl::string_view method,
+                     absl::string_view host);
+
+  Mutex mu_;
+  std::atomic<Entry*> buckets_[kNumBuckets]{};
+  std::atomic<int> size_{0};
+  std::atomic<int> registration_attempts_{0};
 };
 
 class Channel : public RefCounted<Channel>,
@@ -126,33 +201,28 @@ class Channel : public RefCounted<Channel>,
   channelz::ChannelNode* channelz_node() const { return channelz_node_.get(); }
 
   size_t CallSizeEstimate() {
-    // We round up our current estimate to the NEXT value of kRoundUpSize.
-    // This ensures:
-    //  1. a consistent size allocation when our estimate is drifting slowly
-    //     (which is common) - which tends to help most allocators reuse memory
-    //  2. a small amount of allowed growth over the estimate without hitting
-    //     the arena size doubling case, reducing overall memory usage
-    static constexpr size_t kRoundUpSize = 256;
-    return (call_size_estimate_.load(std::memory_order_relaxed) +
-            2 * kRoundUpSize) &
-           ~(kRoundUpSize - 1);
+    return call_size_estimator_.CallSizeEstimate();
+  }
+  // Estimate for a call to \a registered_call, or to an unregistered method
+  // if it is null.
+  size_t CallSizeEstimate(const RegisteredCall* registered_call) {
+    if (registered_call == nullptr) return CallSizeEstimate();
+    return registered_call->call_size_estimator.CallSizeEstimate();
   }
 
-  void UpdateCallSizeEstimate(size_t size);
+  void UpdateCallSizeEstimate(size_t size) {
+    call_size_estimator_.UpdateCallSizeEstimate(size);
+  }
   absl::string_view target() const { return target_; }
   MemoryAllocator* allocator() { return &allocator_; }
   bool is_client() const { return is_client_; }
   bool is_promising() const { return is_promising_; }
   RegisteredCall* RegisterCall(const char* method, const char* host);
 
-  int TestOnlyRegisteredCalls() {
-    MutexLock lock(&registration_table_.mu);
-    return registration_table_.map.size();
-  }
+  int TestOnlyRegisteredCalls() { return registration_table_.size(); }
 
   int TestOnlyRegistrationAttempts() {
-    MutexLock lock(&registration_table_.mu);
-    return registration_table_.method_registration_attempts;
+    return registration_table_.registration_attempts();
   }
 
   grpc_event_engine::experimental::EventEngine* event_engine() const {
@@ -168,7 +238,7 @@ class Channel : public RefCounted<Channel>,
   const bool is_client_;
   const bool is_promising_;
   const grpc_compression_options compression_options_;
-  std::atomic<size_t> call_size_estimate_;
+  CallSizeEstimator call_size_estimator_;
   CallRegistrationTable registration_table_;
   RefCountedPtr<channelz::ChannelNode> channelz_node_;
   MemoryAllocator allocator_;
@@ -42,7 +42,9 @@
 
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/atomic_utils.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -215,6 +217,9 @@ struct cq_vtable {
                  void* done_arg, grpc_cq_completion* storage, bool internal);
   grpc_event (*next)(grpc_completion_queue* cq, gpr_timespec deadline,
                      void* reserved);
+  size_t (*next_batch)(grpc_completion_queue* cq, grpc_event* events,
+                       size_t max_events, gpr_timespec deadline,
+                       void* reserved);
   grpc_event (*pluck)(grpc_completion_queue* cq, void* tag,
                       gpr_timespec deadline, void* reserved);
 };
@@ -238,6 +243,9 @@ class CqEventQueue {
 
   bool Push(grpc_cq_completion* c);
   grpc_cq_completion* Pop();
+  /* Pops up to max_items completions into items, taking the consumer lock
+     once. Returns the number popped. */
+  size_t PopMany(grpc_cq_completion** items, size_t max_items);
 
  private:
   /* Spinlock to serialize consumers i.e pop() operations */
@@ -400,6 +408,10 @@ static void cq_end_op_for_callback(
 static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
                           void* reserved);
 
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved);
+
 static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
                            gpr_timespec deadline, void* reserved);
 
@@ -419,15 +431,15 @@ static const cq_vtable g_cq_vtable[] = {
     /* GRPC_CQ_NEXT */
     {GRPC_CQ_NEXT, sizeof(cq_next_data), cq_init_next, cq_shutdown_next,
      cq_destroy_next, cq_begin_op_for_next, cq_end_op_for_next, cq_next,
-     nullptr},
+     cq_next_batch, nullptr},
     /* GRPC_CQ_PLUCK */
     {GRPC_CQ_PLUCK, sizeof(cq_pluck_data), cq_init_pluck, cq_shutdown_pluck,
      cq_destroy_pluck, cq_begin_op_for_pluck, cq_end_op_for_pluck, nullptr,
-     cq_pluck},
+     nullptr, cq_pluck},
     /* GRPC_CQ_CALLBACK */
     {GRPC_CQ_CALLBACK, sizeof(cq_callback_data), cq_init_callback,
      cq_shutdown_callback, cq_destroy_callback, cq_begin_op_for_callback,
-     cq_end_op_for_callback, nullptr, nullptr},
+     cq_end_op_for_callback, nullptr, nullptr, nullptr},
 };
 
 #define DATA_FROM_CQ(cq) ((void*)((cq) + 1))
@@ -502,6 +514,38 @@ grpc_cq_completion* CqEventQueue::Pop() {
   return c;
 }
 
+size_t CqEventQueue::PopMany(grpc_cq_completion** items, size_t max_items) {
+  size_t n = 0;
+
+  if (gpr_spinlock_trylock(&queue_lock_)) {
+    bool is_empty = false;
+    while (n < max_items) {
+      grpc_cq_completion* c = reinterpret_cast<grpc_cq_completion*>(
+          queue_.PopAndCheckEnd(&is_empty));
+      if (c == nullptr) break;
+      items[n++] = c;
+    }
+    gpr_spinlock_unlock(&queue_lock_);
+  }
+
+  if (n > 0) {
+    num_queue_items_.fetch_sub(n, std::memory_order_relaxed);
+  }
+
+  return n;
+}
+
+// Counts the application callbacks that run for longer than this. They may
+// run on I/O threads, where a slow one holds up every call on that thread.
+static constexpr grpc_core::Duration kSlowCallbackBudget =
+    grpc_core::Duration::Milliseconds(10);
+
+static void observe_callback_run(grpc_core::Duration elapsed) {
+  if (elapsed > kSlowCallbackBudget) {
+    grpc_core::global_stats().IncrementCqCallbackSlowRuns();
+  }
+}
+
 grpc_completion_queue* grpc_completion_queue_create_internal(
     grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
     grpc_completion_queue_functor* shutdown_callback) {
@@ -521,6 +565,8 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
       break;
     case GRPC_CQ_CALLBACK:
       grpc_core::global_stats().IncrementCqCallbackCreates();
+      grpc_core::ApplicationCallbackExecCtx::SetFunctorRunObserver(
+          observe_callback_run);
       break;
   }
 
@@ -818,7 +864,7 @@ static void cq_end_op_for_pluck(
 
 static void functor_callback(void* arg, grpc_error_handle error) {
   auto* functor = static_cast<grpc_completion_queue_functor*>(arg);
-  functor->functor_run(functor, error.ok());
+  grpc_core::ApplicationCallbackExecCtx::RunFunctor(functor, error.ok());
 }
 
 /* Complete an event on a completion queue of type GRPC_CQ_CALLBACK */
@@ -857,8 +903,12 @@ static void cq_end_op_for_callback(
   // 2. The callback is marked inlineable and there is an ACEC available
   // 3. We are already running in a background poller thread (which always has
   //    an ACEC available at the base of the stack).
+  // 4. The callback_run_to_completion experiment is on and there is an ACEC
+  //    available, so that the callback runs on the thread that completed the
+  //    operation rather than hopping to an executor thread.
   auto* functor = static_cast<grpc_completion_queue_functor*>(tag);
-  if (((internal || functor->inlineable) &&
+  if (((internal || functor->inlineable ||
+        grpc_core::IsCallbackRunToCompletionEnabled()) &&
        grpc_core::ApplicationCallbackExecCtx::Available()) ||
       grpc_iomgr_is_any_background_poller_thread()) {
     grpc_core::ApplicationCallbackExecCtx::Enqueue(functor, (error.ok()));
@@ -940,21 +990,37 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  grpc_event ret;
-  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+/* Pops the completions that are already queued, up to max_events, without
+   blocking. */
+static size_t cq_pop_ready_events(cq_next_data* cqd, grpc_event* events,
+                                  size_t max_events) {
+  grpc_cq_completion* popped[16];
+  size_t num_events = 0;
+  while (num_events < max_events) {
+    const size_t max_popped =
+        std::min(max_events - num_events, GPR_ARRAY_SIZE(popped));
+    const size_t num_popped = cqd->queue.PopMany(popped, max_popped);
+    for (size_t i = 0; i < num_popped; i++) {
+      grpc_cq_completion* c = popped[i];
+      grpc_event* ev = &events[num_events++];
+      ev->type = GRPC_OP_COMPLETE;
+      ev->success = c->next & 1u;
+      ev->tag = c->tag;
+      c->done(c->done_arg, c);
+    }
+    if (num_popped < max_popped) break;
+  }
+  return num_events;
+}
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_next("
-      "cq=%p, "
-      "deadline=gpr_timespec { tv_sec: %" PRId64
-      ", tv_nsec: %d, clock_type: %d }, "
-      "reserved=%p)",
-      5,
-      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
-       reserved));
-  GPR_ASSERT(!reserved);
+/* Waits for the first event like grpc_completion_queue_next, and if it is a
+   completion, adds the completions queued behind it, up to max_events in all.
+   The pollset lock and kick are paid once for the whole batch. */
+static size_t cq_next_events(grpc_completion_queue* cq, grpc_event* events,
+                             size_t max_events, gpr_timespec deadline) {
+  grpc_event& ret = events[0];
+  size_t num_events = 1;
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
   dump_pending_tags(cq);
 
@@ -980,6 +1046,7 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       ret.success = c->next & 1u;
       ret.tag = c->tag;
       c->done(c->done_arg, c);
+      num_events += cq_pop_ready_events(cqd, events + 1, max_events - 1);
       break;
     }
 
@@ -990,6 +1057,7 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       ret.success = c->next & 1u;
       ret.tag = c->tag;
       c->done(c->done_arg, c);
+      num_events += cq_pop_ready_events(cqd, events + 1, max_events - 1);
       break;
     } else {
       /* If c == NULL it means either the queue is empty OR in an transient
@@ -1057,14 +1125,52 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  for (size_t i = 0; i < num_events; i++) {
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &events[i]);
+  }
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   GPR_ASSERT(is_finished_arg.stolen_completion == nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next("
+      "cq=%p, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      5,
+      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
+       reserved));
+  GPR_ASSERT(!reserved);
+
+  grpc_event ret;
+  cq_next_events(cq, &ret, 1, deadline);
   return ret;
 }
 
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch("
+      "cq=%p, events=%p, max_events=%" PRIuPTR
+      ", deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  GPR_ASSERT(!reserved);
+  GPR_ASSERT(max_events > 0);
+
+  return cq_next_events(cq, events, max_events, deadline);
+}
+
 /* Finishes the completion queue shutdown. This means that there are no more
    completion events / tags expected from the completion queue
    - Must be called under completion queue lock
@@ -1112,6 +1218,13 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline,
+                                        void* reserved) {
+  return cq->vtable->next_batch(cq, events, max_events, deadline, reserved);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -24,9 +24,9 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <list>
 #include <new>
-#include <queue>
 #include <utility>
 #include <vector>
 
@@ -50,6 +50,7 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/call.h"
@@ -97,6 +98,9 @@ struct Server::RequestedCall {
 
   MultiProducerSingleConsumerQueue::Node mpscq_node;
   const Type type;
+  // Set when the request was allocated in the matched call's arena, in which
+  // case it is released along with the call instead of being deleted.
+  bool in_call_arena = false;
   void* const tag;
   grpc_completion_queue* const cq_bound_to_call;
   grpc_call** const call;
@@ -185,6 +189,10 @@ class Server::RequestMatcherInterface {
   virtual void MatchOrQueue(size_t start_request_queue_index,
                             CallData* calld) = 0;
 
+  // Reports how long the application took to finish a call it was handed
+  // by this matcher.
+  virtual void RecordHandlerLatency(Duration /*latency*/) {}
+
   // Returns the server associated with this request matcher
   virtual Server* server() const = 0;
 };
@@ -197,7 +205,15 @@ class Server::RequestMatcherInterface {
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        shed_late_calls_(server->channel_args()
+                             .GetBool(GRPC_ARG_SERVER_SHED_LATE_CALLS)
+                             .value_or(false)),
+        earliest_deadline_first_(
+            server->channel_args()
+                .GetBool(GRPC_ARG_SERVER_EARLIEST_DEADLINE_FIRST)
+                .value_or(false)),
+        requests_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
@@ -210,7 +226,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       CallData* calld = pending_.front();
       calld->SetState(CallData::CallState::ZOMBIED);
       calld->KillZombie();
-      pending_.pop();
+      pending_.pop_front();
+      num_pending_.fetch_sub(1, std::memory_order_relaxed);
     }
   }
 
@@ -232,21 +249,28 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
       /* this was the first queued request: we need to lock and start
-         matching calls */
+         matching calls, unless there are none to match.  Pairs with the
+         fence in MatchOrQueue: either that call sees this request when it
+         scans the queues, or we see the call counted here. */
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (num_pending_.load(std::memory_order_relaxed) == 0) return;
       struct PendingCall {
         RequestedCall* rc = nullptr;
         CallData* calld;
+        std::vector<CallData*> late;
       };
       auto pop_next_pending = [this, request_queue_index] {
         PendingCall pending_call;
         {
           MutexLock lock(&server_->mu_call_);
+          PopLateLocked(&pending_call.late);
           if (!pending_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
             if (pending_call.rc != nullptr) {
               pending_call.calld = pending_.front();
-              pending_.pop();
+              pending_.pop_front();
+              num_pending_.fetch_sub(1, std::memory_order_relaxed);
             }
           }
         }
@@ -254,6 +278,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       };
       while (true) {
         PendingCall next_pending = pop_next_pending();
+        for (CallData* calld : next_pending.late) calld->KillLate();
         if (next_pending.rc == nullptr) break;
         if (!next_pending.calld->MaybeActivate()) {
           // Zombied Call
@@ -287,6 +312,11 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     size_t loop_count;
     {
       MutexLock lock(&server_->mu_call_);
+      // Count the call before looking at the queues, so that a request
+      // pushed to a queue we have already looked at takes the lock to match
+      // it.
+      num_pending_.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -297,19 +327,73 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       }
       if (rc == nullptr) {
         calld->SetState(CallData::CallState::PENDING);
-        pending_.push(calld);
+        QueuePendingLocked(calld);
         return;
       }
+      num_pending_.fetch_sub(1, std::memory_order_relaxed);
     }
     calld->SetState(CallData::CallState::ACTIVATED);
     calld->Publish(cq_idx, rc);
   }
 
+  void RecordHandlerLatency(Duration latency) override {
+    if (!shed_late_calls_) return;
+    // Concurrent updates may lose a sample, which does not matter for an
+    // estimate.
+    int64_t average = handler_latency_ms_.load(std::memory_order_relaxed);
+    handler_latency_ms_.store(average + (latency.millis() - average) / 8,
+                              std::memory_order_relaxed);
+  }
+
   Server* server() const override { return server_; }
 
  private:
+  void QueuePendingLocked(CallData* calld)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(server_->mu_call_) {
+    if (!earliest_deadline_first_) {
+      pending_.push_back(calld);
+      return;
+    }
+    // Calls with equal deadlines stay in arrival order.
+    pending_.insert(std::upper_bound(pending_.begin(), pending_.end(), calld,
+                                     [](CallData* a, CallData* b) {
+                                       return a->deadline() < b->deadline();
+                                     }),
+                    calld);
+  }
+
+  // Moves the calls at the front of the pending queue that would miss their
+  // deadline, given how long the application has recently taken to handle
+  // calls, to \a late. Only the front is looked at: in arrival order the
+  // other calls are checked when they get there, and in deadline order
+  // none of them can be late if the front is not.
+  void PopLateLocked(std::vector<CallData*>* late)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(server_->mu_call_) {
+    if (!shed_late_calls_) return;
+    const Timestamp cutoff =
+        Timestamp::Now() +
+        Duration::Milliseconds(
+            handler_latency_ms_.load(std::memory_order_relaxed));
+    while (!pending_.empty() && pending_.front()->deadline() <= cutoff) {
+      late->push_back(pending_.front());
+      pending_.pop_front();
+      num_pending_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
   Server* const server_;
-  std::queue<CallData*> pending_;
+  // GRPC_ARG_SERVER_SHED_LATE_CALLS.
+  const bool shed_late_calls_;
+  // GRPC_ARG_SERVER_EARLIEST_DEADLINE_FIRST.
+  const bool earliest_deadline_first_;
+  // Recent average time the application took to finish a call, in
+  // milliseconds; only tracked when shedding late calls.
+  std::atomic<int64_t> handler_latency_ms_{0};
+  std::deque<CallData*> pending_;
+  // Calls in pending_, plus the one being queued if any.  Changed only
+  // under the server's mu_call_, but read without it so that requests need
+  // not take the lock when there are no calls waiting for them.
+  std::atomic<size_t> num_pending_{0};
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
 };
 
@@ -375,7 +459,7 @@ class Server::AllocatingRequestMatcherBatch
       GPR_ASSERT(server()->ValidateServerRequest(
                      cq(), static_cast<void*>(call_info.tag), nullptr,
                      nullptr) == GRPC_CALL_OK);
-      RequestedCall* rc = new RequestedCall(
+      RequestedCall* rc = calld->NewArenaRequestedCall(
           static_cast<void*>(call_info.tag), call_info.cq, call_info.call,
           call_info.initial_metadata, call_info.details);
       calld->SetState(CallData::CallState::ACTIVATED);
@@ -408,10 +492,10 @@ class Server::AllocatingRequestMatcherRegistered
       GPR_ASSERT(server()->ValidateServerRequest(
                      cq(), call_info.tag, call_info.optional_payload,
                      registered_method_) == GRPC_CALL_OK);
-      RequestedCall* rc =
-          new RequestedCall(call_info.tag, call_info.cq, call_info.call,
-                            call_info.initial_metadata, registered_method_,
-                            call_info.deadline, call_info.optional_payload);
+      RequestedCall* rc = calld->NewArenaRequestedCall(
+          call_info.tag, call_info.cq, call_info.call,
+          call_info.initial_metadata, registered_method_, call_info.deadline,
+          call_info.optional_payload);
       calld->SetState(CallData::CallState::ACTIVATED);
       calld->Publish(cq_idx(), rc);
     } else {
@@ -518,6 +602,9 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
                .value_or(GRPC_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE_DEFAULT));
     channelz_node =
         MakeRefCounted<channelz::ServerNode>(channel_tracer_max_memory);
+    if (args.GetBool(GRPC_ARG_CHANNELZ_LATENCY_HISTOGRAMS).value_or(false)) {
+      channelz_node->EnableLatencyHistograms();
+    }
     channelz_node->AddTraceEvent(
         channelz::ChannelTrace::Severity::Info,
         grpc_slice_from_static_string("Server created"));
@@ -1096,6 +1183,7 @@ void Server::ChannelData::AcceptStream(void* arg, grpc_transport* /*transport*/,
   args.cq = nullptr;
   args.pollset_set_alternative = nullptr;
   args.server_transport_data = transport_server_data;
+  args.registered_call = nullptr;
   args.send_deadline = Timestamp::InfFuture();
   grpc_call* call;
   grpc_error_handle error = grpc_call_create(&args, &call);
@@ -1187,6 +1275,18 @@ bool Server::CallData::MaybeActivate() {
                                         std::memory_order_relaxed);
 }
 
+void Server::CallData::KillLate() {
+  CallState expected = CallState::PENDING;
+  if (state_.compare_exchange_strong(expected, CallState::ZOMBIED,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed)) {
+    grpc_call_cancel_with_status(call_, GRPC_STATUS_DEADLINE_EXCEEDED,
+                                 "Deadline cannot be met", nullptr);
+  }
+  // Otherwise the call failed while it was queued.
+  KillZombie();
+}
+
 void Server::CallData::FailCallCreation() {
   CallState expected_not_started = CallState::NOT_STARTED;
   CallState expected_pending = CallState::PENDING;
@@ -1216,6 +1316,9 @@ void Server::CallData::Start(grpc_call_element* elem) {
 }
 
 void Server::CallData::Publish(size_t cq_idx, RequestedCall* rc) {
+  channelz::ServerNode* channelz_node = server_->channelz_node();
+  if (channelz_node != nullptr) channelz_node->RecordQueueLatency(queue_start_);
+  publish_time_ = Timestamp::Now();
   grpc_call_set_completion_queue(call_, rc->cq_bound_to_call);
   *rc->call = call_;
   cq_new_ = server_->cqs_[cq_idx];
@@ -1240,10 +1343,23 @@ void Server::CallData::Publish(size_t cq_idx, RequestedCall* rc) {
     default:
       GPR_UNREACHABLE_CODE(return );
   }
-  grpc_cq_end_op(cq_new_, rc->tag, absl::OkStatus(), Server::DoneRequestEvent,
+  // An arena-allocated request stays valid until its completion is done: the
+  // application cannot release the call before it has seen this event.
+  grpc_cq_end_op(cq_new_, rc->tag, absl::OkStatus(),
+                 rc->in_call_arena ? Server::DoneArenaRequestEvent
+                                   : Server::DoneRequestEvent,
                  rc, &rc->completion, true);
 }
 
+template <typename... Args>
+Server::RequestedCall* Server::CallData::NewArenaRequestedCall(
+    Args&&... args) {
+  RequestedCall* rc = grpc_call_get_arena(call_)->New<RequestedCall>(
+      std::forward<Args>(args)...);
+  rc->in_call_arena = true;
+  return rc;
+}
+
 void Server::CallData::PublishNewRpc(void* arg, grpc_error_handle error) {
   grpc_call_element* call_elem = static_cast<grpc_call_element*>(arg);
   auto* calld = static_cast<Server::CallData*>(call_elem->call_data);
@@ -1255,6 +1371,7 @@ void Server::CallData::PublishNewRpc(void* arg, grpc_error_handle error) {
     calld->KillZombie();
     return;
   }
+  calld->queue_start_ = gpr_get_cycle_counter();
   rm->MatchOrQueue(chand->cq_idx(), calld);
 }
 
@@ -1333,6 +1450,10 @@ void Server::CallData::StartTransportStreamOpBatchImpl(
     batch->payload->recv_initial_metadata.recv_initial_metadata_ready =
         &recv_initial_metadata_ready_;
   }
+  if (batch->send_trailing_metadata &&
+      publish_time_ != Timestamp::InfPast()) {
+    matcher_->RecordHandlerLatency(Timestamp::Now() - publish_time_);
+  }
   if (batch->recv_trailing_metadata) {
     original_recv_trailing_metadata_ready_ =
         batch->payload->recv_trailing_metadata.recv_trailing_metadata_ready;
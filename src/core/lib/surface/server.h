@@ -45,6 +45,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/cpp_impl_of.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
 #include "src/core/lib/gprpp/notification.h"
@@ -287,10 +288,22 @@ class Server : public InternallyRefCounted<Server>,
     // on success.
     bool MaybeActivate();
 
+    // Fails a call taken off the pending queue because it can no longer
+    // meet its deadline, and releases it.
+    void KillLate();
+
+    Timestamp deadline() const { return deadline_; }
+
     // Publishes an incoming call to the application after it has been
     // matched.
     void Publish(size_t cq_idx, RequestedCall* rc);
 
+    // Creates a RequestedCall in this call's arena rather than on the heap.
+    // Used by request matchers that only create the request once the call is
+    // already known.
+    template <typename... Args>
+    RequestedCall* NewArenaRequestedCall(Args&&... args);
+
     void KillZombie();
 
     void FailCallCreation();
@@ -330,6 +343,10 @@ class Server : public InternallyRefCounted<Server>,
     grpc_completion_queue* cq_new_ = nullptr;
 
     RequestMatcherInterface* matcher_ = nullptr;
+    // When the call started waiting for a matching request.
+    gpr_cycle_counter queue_start_ = 0;
+    // When the call was published to the application.
+    Timestamp publish_time_ = Timestamp::InfPast();
     grpc_byte_buffer* payload_ = nullptr;
 
     grpc_closure kill_zombie_closure_;
@@ -376,6 +393,8 @@ class Server : public InternallyRefCounted<Server>,
   }
 
   static void DoneRequestEvent(void* req, grpc_cq_completion* completion);
+  static void DoneArenaRequestEvent(void* /*req*/,
+                                    grpc_cq_completion* /*completion*/) {}
 
   void FailCall(size_t cq_idx, RequestedCall* rc, grpc_error_handle error);
   grpc_call_error QueueRequestedCall(size_t cq_idx, RequestedCall* rc);
@@ -37,6 +37,7 @@ BdpEstimator::BdpEstimator(const char* name)
       inter_ping_delay_(Duration::Milliseconds(100)),  // start at 100ms
       stable_estimate_count_(0),
       bw_est_(0),
+      last_ping_rtt_(0),
       name_(name) {}
 
 Timestamp BdpEstimator::CompletePing() {
@@ -44,6 +45,7 @@ Timestamp BdpEstimator::CompletePing() {
   gpr_timespec dt_ts = gpr_time_sub(now, ping_start_time_);
   double dt = static_cast<double>(dt_ts.tv_sec) +
               1e-9 * static_cast<double>(dt_ts.tv_nsec);
+  last_ping_rtt_ = dt;
   double bw = dt > 0 ? (static_cast<double>(accumulator_) / dt) : 0;
   Duration start_inter_ping_delay = inter_ping_delay_;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_bdp_estimator_trace)) {
@@ -41,6 +41,8 @@ class BdpEstimator {
 
   int64_t EstimateBdp() const { return estimate_; }
   double EstimateBandwidth() const { return bw_est_; }
+  // Round trip time of the last completed ping, in seconds.
+  double LastPingRtt() const { return last_ping_rtt_; }
 
   void AddIncomingBytes(int64_t num_bytes) { accumulator_ += num_bytes; }
 
@@ -86,6 +88,7 @@ class BdpEstimator {
   Duration inter_ping_delay_;
   int stable_estimate_count_;
   double bw_est_;
+  double last_ping_rtt_;
   const char* name_;
 };
 
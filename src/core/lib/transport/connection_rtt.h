@@ -0,0 +1,74 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_TRANSPORT_CONNECTION_RTT_H
+#define GRPC_CORE_LIB_TRANSPORT_CONNECTION_RTT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_core {
+
+// Smoothed round trip time of a single connection, as measured by the
+// transport from its ping round trips. The creator of the connection passes an
+// instance to the transport through channel args; the transport is the only
+// writer, while any thread may read the current estimate.
+class ConnectionRtt : public RefCounted<ConnectionRtt> {
+ public:
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.connection_rtt";
+  }
+  static int ChannelArgsCompare(const ConnectionRtt* a,
+                                const ConnectionRtt* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Folds one round trip sample into the estimate, using the smoothing
+  // from RFC 6298 (srtt = 7/8 srtt + 1/8 sample).
+  void AddSample(double seconds) {
+    if (seconds < 0) return;
+    const int64_t sample_us = static_cast<int64_t>(seconds * 1e6);
+    int64_t srtt_us = srtt_us_.load(std::memory_order_relaxed);
+    if (srtt_us < 0) {
+      srtt_us = sample_us;
+    } else {
+      srtt_us += (sample_us - srtt_us) / 8;
+    }
+    srtt_us_.store(srtt_us, std::memory_order_relaxed);
+  }
+
+  // The current estimate, or nullopt until the first sample arrives.
+  absl::optional<Duration> smoothed_rtt() const {
+    const int64_t srtt_us = srtt_us_.load(std::memory_order_relaxed);
+    if (srtt_us < 0) return absl::nullopt;
+    return Duration::MicrosecondsRoundUp(srtt_us);
+  }
+
+ private:
+  std::atomic<int64_t> srtt_us_{-1};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_TRANSPORT_CONNECTION_RTT_H
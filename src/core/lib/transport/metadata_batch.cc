@@ -19,11 +19,15 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 
+#include "absl/hash/hash.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 
 namespace grpc_core {
@@ -34,11 +38,83 @@ void DebugStringBuilder::Add(absl::string_view key, absl::string_view value) {
   absl::StrAppend(&out_, absl::CEscape(key), ": ", absl::CEscape(value));
 }
 
+namespace {
+
+// Insert-only open addressing table of registered custom keys. Half of the
+// slots always stay empty, so probes terminate quickly. Lookups are lock free;
+// registrations are serialized by a mutex.
+constexpr size_t kCustomKeySlots = 2 * CustomMetadataKeys::kMaxKeys;
+std::atomic<const CustomMetadataKeys::Key*> g_custom_keys[kCustomKeySlots];
+std::atomic<size_t> g_num_custom_keys{0};
+
+size_t CustomKeySlot(absl::string_view key) {
+  return absl::Hash<absl::string_view>()(key) % kCustomKeySlots;
+}
+
+}  // namespace
+
+const CustomMetadataKeys::Key* CustomMetadataKeys::Find(
+    absl::string_view key) {
+  if (g_num_custom_keys.load(std::memory_order_acquire) == 0) return nullptr;
+  for (size_t i = CustomKeySlot(key);; i = (i + 1) % kCustomKeySlots) {
+    const Key* entry = g_custom_keys[i].load(std::memory_order_acquire);
+    if (entry == nullptr) return nullptr;
+    if (entry->key.as_string_view() == key) return entry;
+  }
+}
+
+bool CustomMetadataKeys::Register(absl::string_view key) {
+  static NoDestruct<Mutex> mu;
+  MutexLock lock(mu.get());
+  if (Find(key) != nullptr) return true;
+  const size_t n = g_num_custom_keys.load(std::memory_order_relaxed);
+  if (n == kMaxKeys) return false;
+  // Registered keys live for the rest of the process, so they can be handed
+  // out as static slices and shared without refcounting.
+  const std::string* interned = new std::string(key);
+  const Key* entry =
+      new Key{Slice::FromStaticString(*interned), uint64_t{1} << n};
+  size_t i = CustomKeySlot(key);
+  while (g_custom_keys[i].load(std::memory_order_relaxed) != nullptr) {
+    i = (i + 1) % kCustomKeySlots;
+  }
+  g_custom_keys[i].store(entry, std::memory_order_release);
+  g_num_custom_keys.store(n + 1, std::memory_order_release);
+  return true;
+}
+
+uint64_t CustomMetadataKeys::RegisteredBits() {
+  const size_t n = g_num_custom_keys.load(std::memory_order_acquire);
+  return n == kMaxKeys ? ~uint64_t{0} : (uint64_t{1} << n) - 1;
+}
+
 void UnknownMap::Append(absl::string_view key, Slice value) {
+  const CustomMetadataKeys::Key* registered = CustomMetadataKeys::Find(key);
+  if (registered != nullptr) {
+    registered_present_ |= registered->bit;
+    unknown_.EmplaceBack(registered->key.Ref(), value.Ref());
+    return;
+  }
   unknown_.EmplaceBack(Slice::FromCopiedString(key), value.Ref());
 }
 
+void UnknownMap::Append(Slice key, Slice value) {
+  const CustomMetadataKeys::Key* registered =
+      CustomMetadataKeys::Find(key.as_string_view());
+  if (registered != nullptr) {
+    registered_present_ |= registered->bit;
+  }
+  unknown_.EmplaceBack(std::move(key), std::move(value));
+}
+
 void UnknownMap::Remove(absl::string_view key) {
+  const CustomMetadataKeys::Key* registered = CustomMetadataKeys::Find(key);
+  if (registered != nullptr) {
+    if ((registered_tracked_ & ~registered_present_ & registered->bit) != 0) {
+      return;
+    }
+    registered_present_ &= ~registered->bit;
+  }
   unknown_.SetEnd(std::remove_if(unknown_.begin(), unknown_.end(),
                                  [key](const std::pair<Slice, Slice>& p) {
                                    return p.first.as_string_view() == key;
@@ -47,6 +123,11 @@ void UnknownMap::Remove(absl::string_view key) {
 
 absl::optional<absl::string_view> UnknownMap::GetStringValue(
     absl::string_view key, std::string* backing) const {
+  const CustomMetadataKeys::Key* registered = CustomMetadataKeys::Find(key);
+  if (registered != nullptr &&
+      (registered_tracked_ & ~registered_present_ & registered->bit) != 0) {
+    return absl::nullopt;
+  }
   absl::optional<absl::string_view> out;
   for (const auto& p : unknown_) {
     if (p.first.as_string_view() == key) {
@@ -288,4 +369,8 @@ std::string WaitForReady::DisplayValue(ValueType x) {
                       x.explicitly_set ? " (explicit)" : "");
 }
 
+std::string GrpcStreamWriteWeight::DisplayValue(ValueType x) {
+  return absl::StrCat(x);
+}
+
 }  // namespace grpc_core
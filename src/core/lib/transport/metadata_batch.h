@@ -406,6 +406,15 @@ struct WaitForReady {
   static std::string DisplayValue(ValueType x);
 };
 
+// Annotation added by client channel code from the service config to set the
+// relative share of each connection write that the transport gives a stream.
+struct GrpcStreamWriteWeight {
+  static absl::string_view DebugKey() { return "GrpcStreamWriteWeight"; }
+  static constexpr bool kRepeatable = false;
+  using ValueType = uint32_t;
+  static std::string DisplayValue(ValueType x);
+};
+
 namespace metadata_detail {
 
 // Build a key/value formatted debug string.
@@ -490,6 +499,28 @@ struct ParseValue {
   }
 };
 
+// Registry of custom (non-trait-based) metadata keys that applications
+// expect to see on most calls. See RegisterCustomMetadataKey().
+class CustomMetadataKeys {
+ public:
+  static constexpr size_t kMaxKeys = 64;
+
+  struct Key {
+    // Interned copy of the key, backed by static storage.
+    Slice key;
+    // Bit identifying this key in UnknownMap::registered_present_.
+    uint64_t bit;
+  };
+
+  // Returns the registered entry for \a key, or nullptr if \a key was never
+  // registered. Lock free.
+  static const Key* Find(absl::string_view key);
+  // Registers \a key. Returns false if the registry is full.
+  static bool Register(absl::string_view key);
+  // Returns the union of the bits of all keys registered so far.
+  static uint64_t RegisteredBits();
+};
+
 // This is an "Op" type for NameLookup.
 // Used for MetadataMap::Parse, its Found/NotFound methods turn a slice into a
 // ParsedMetadata object.
@@ -511,6 +542,13 @@ class ParseHelper {
 
   GPR_ATTRIBUTE_NOINLINE ParsedMetadata<Container> NotFound(
       absl::string_view key) {
+    // Registered custom keys share one interned slice instead of copying the
+    // key for every header parsed.
+    const CustomMetadataKeys::Key* registered = CustomMetadataKeys::Find(key);
+    if (registered != nullptr) {
+      return ParsedMetadata<Container>(registered->key.Ref(),
+                                       std::move(value_));
+    }
     return ParsedMetadata<Container>(Slice::FromCopiedString(key),
                                      std::move(value_));
   }
@@ -831,7 +869,7 @@ class CopySink {
   }
 
   void Encode(const Slice& key, const Slice& value) {
-    dst_->unknown_.Append(key.as_string_view(), value.Ref());
+    dst_->unknown_.Append(key.Ref(), value.Ref());
   }
 
  private:
@@ -901,11 +939,15 @@ class TransportSizeEncoder {
 // Handle unknown (non-trait-based) fields in the metadata map.
 class UnknownMap {
  public:
-  explicit UnknownMap(Arena* arena) : unknown_(arena) {}
+  explicit UnknownMap(Arena* arena)
+      : unknown_(arena),
+        registered_tracked_(CustomMetadataKeys::RegisteredBits()) {}
 
   using BackingType = ChunkedVector<std::pair<Slice, Slice>, 10>;
 
   void Append(absl::string_view key, Slice value);
+  // As above, but shares an existing key slice instead of copying the key.
+  void Append(Slice key, Slice value);
   void Remove(absl::string_view key);
   absl::optional<absl::string_view> GetStringValue(absl::string_view key,
                                                    std::string* backing) const;
@@ -915,16 +957,39 @@ class UnknownMap {
 
   bool empty() const { return unknown_.empty(); }
   size_t size() const { return unknown_.size(); }
-  void Clear() { unknown_.Clear(); }
+  void Clear() {
+    unknown_.Clear();
+    registered_present_ = 0;
+    registered_tracked_ = CustomMetadataKeys::RegisteredBits();
+  }
   Arena* arena() const { return unknown_.arena(); }
 
  private:
   // Backing store for added metadata.
   ChunkedVector<std::pair<Slice, Slice>, 10> unknown_;
+  // Bits of the registered custom keys that may be present in unknown_. For
+  // keys in registered_tracked_ a clear bit guarantees absence, which lets
+  // lookups and removals of absent registered keys skip the scan.
+  uint64_t registered_present_ = 0;
+  // Keys that were already registered when this map was created (or last
+  // cleared). Keys registered later may have been appended before they were
+  // registered, so their presence bits cannot be trusted.
+  uint64_t registered_tracked_;
 };
 
 }  // namespace metadata_detail
 
+// Registers a custom metadata key (e.g. a tenant or routing header) that is
+// expected on many calls. Metadata maps store registered keys without copying
+// them, and looking up or removing a registered key that is not present costs
+// O(1) rather than a scan of all custom metadata. Meant to be called at
+// startup, before calls are made. At most
+// metadata_detail::CustomMetadataKeys::kMaxKeys keys can be registered;
+// returns false if the registry is full.
+inline bool RegisterCustomMetadataKey(absl::string_view key) {
+  return metadata_detail::CustomMetadataKeys::Register(key);
+}
+
 // Helper function for encoders
 // Given a metadata trait, convert the value to a slice.
 template <typename Which>
@@ -1222,6 +1287,13 @@ class MetadataMap {
     metadata_detail::NameLookup<void, Traits...>::Lookup(key, &helper);
   }
 
+  // Append a key/value pair whose key is known not to name any trait, e.g.
+  // one encoded from another map's unknown metadata. Skips the trait lookup
+  // and shares the key slice rather than copying it.
+  void AppendUnknown(Slice key, Slice value) {
+    unknown_.Append(std::move(key), std::move(value));
+  }
+
   void Clear();
   size_t TransportSize() const;
   Derived Copy() const;
@@ -1317,7 +1389,7 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     // Non-encodable things
     grpc_core::GrpcStreamNetworkState, grpc_core::PeerString,
     grpc_core::GrpcStatusContext, grpc_core::GrpcStatusFromWire,
-    grpc_core::WaitForReady>;
+    grpc_core::WaitForReady, grpc_core::GrpcStreamWriteWeight>;
 
 struct grpc_metadata_batch : public grpc_metadata_batch_base {
   using grpc_metadata_batch_base::grpc_metadata_batch_base;
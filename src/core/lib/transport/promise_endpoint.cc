@@ -0,0 +1,111 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/transport/promise_endpoint.h"
+
+#include <stdint.h>
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+PromiseEndpoint::PromiseEndpoint(std::unique_ptr<Endpoint> endpoint,
+                                 SliceBuffer already_received)
+    : endpoint_(std::move(endpoint)) {
+  MutexLock lock(&state_->mu);
+  state_->read_buffer = std::move(already_received);
+}
+
+// Destroying endpoint_ fails any read or write still in flight; their
+// callbacks hold their own refs to state_.
+PromiseEndpoint::~PromiseEndpoint() = default;
+
+void PromiseEndpoint::StartWrite(SliceBuffer data) {
+  {
+    MutexLock lock(&state_->mu);
+    GPR_ASSERT(!state_->write_in_flight);
+    state_->write_in_flight = true;
+    state_->write_waker = Activity::current()->MakeOwningWaker();
+  }
+  state_->write_buffer = std::move(data);
+  endpoint_->Write(
+      [state = state_](absl::Status status) {
+        Waker waker;
+        {
+          MutexLock lock(&state->mu);
+          state->write_in_flight = false;
+          state->write_result = std::move(status);
+          waker = std::move(state->write_waker);
+        }
+        waker.Wakeup();
+      },
+      &state_->write_buffer, nullptr);
+}
+
+Poll<absl::Status> PromiseEndpoint::PollWrite() {
+  MutexLock lock(&state_->mu);
+  if (state_->write_in_flight) {
+    state_->write_waker = Activity::current()->MakeOwningWaker();
+    return Pending{};
+  }
+  return state_->write_result;
+}
+
+Poll<absl::StatusOr<PromiseEndpoint::SliceBuffer>> PromiseEndpoint::PollRead(
+    size_t num_bytes) {
+  ReleasableMutexLock lock(&state_->mu);
+  if (state_->read_in_flight) {
+    state_->read_waker = Activity::current()->MakeOwningWaker();
+    return Pending{};
+  }
+  if (state_->read_buffer.Length() >= num_bytes) {
+    SliceBuffer result;
+    state_->read_buffer.MoveFirstNBytesIntoSliceBuffer(num_bytes, result);
+    return absl::StatusOr<SliceBuffer>(std::move(result));
+  }
+  if (!state_->read_error.ok()) {
+    return absl::StatusOr<SliceBuffer>(state_->read_error);
+  }
+  state_->read_in_flight = true;
+  state_->read_waker = Activity::current()->MakeOwningWaker();
+  Endpoint::ReadArgs args;
+  args.read_hint_bytes =
+      static_cast<int64_t>(num_bytes - state_->read_buffer.Length());
+  // The endpoint may run the callback before Read() returns, which takes
+  // the lock.
+  lock.Release();
+  endpoint_->Read(
+      [state = state_](absl::Status status) {
+        Waker waker;
+        {
+          MutexLock lock(&state->mu);
+          grpc_slice_buffer_move_into(
+              state->pending_read_buffer.c_slice_buffer(),
+              state->read_buffer.c_slice_buffer());
+          state->read_in_flight = false;
+          state->read_error = std::move(status);
+          waker = std::move(state->read_waker);
+        }
+        // Wakes this activity, which polls again and either returns the
+        // bytes or starts another read for the rest of them.
+        waker.Wakeup();
+      },
+      &state_->pending_read_buffer, &args);
+  return Pending{};
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,121 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_TRANSPORT_PROMISE_ENDPOINT_H
+#define GRPC_CORE_LIB_TRANSPORT_PROMISE_ENDPOINT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/poll.h"
+
+namespace grpc_core {
+
+// Wraps an EventEngine endpoint so that transports built on the promise
+// library can read and write it directly from their activities, without
+// going through grpc_endpoint, closures and a combiner.
+//
+// At most one read and one write may be in progress at a time, as with the
+// underlying endpoint. Destroying the PromiseEndpoint destroys the endpoint,
+// which fails any operation that is still in progress.
+class PromiseEndpoint {
+ public:
+  using SliceBuffer = grpc_event_engine::experimental::SliceBuffer;
+  using Endpoint = grpc_event_engine::experimental::EventEngine::Endpoint;
+  using ResolvedAddress =
+      grpc_event_engine::experimental::EventEngine::ResolvedAddress;
+
+  // already_received holds bytes read from the connection before it was
+  // handed over (e.g. by a handshaker); reads return them first.
+  PromiseEndpoint(std::unique_ptr<Endpoint> endpoint,
+                  SliceBuffer already_received);
+  ~PromiseEndpoint();
+
+  PromiseEndpoint(const PromiseEndpoint&) = delete;
+  PromiseEndpoint& operator=(const PromiseEndpoint&) = delete;
+
+  // Returns a promise that writes all of data and resolves to the result
+  // once the endpoint is ready for more.
+  auto Write(SliceBuffer data) {
+    return [this, data = std::move(data),
+            started = false]() mutable -> Poll<absl::Status> {
+      if (!started) {
+        started = true;
+        StartWrite(std::move(data));
+      }
+      return PollWrite();
+    };
+  }
+
+  // Returns a promise that resolves to exactly num_bytes bytes. Bytes that
+  // arrive beyond those are kept for the next read, which lets a transport
+  // read a frame header and then exactly the frame it announces.
+  auto Read(size_t num_bytes) {
+    return [this, num_bytes]() { return PollRead(num_bytes); };
+  }
+
+  const ResolvedAddress& GetPeerAddress() const {
+    return endpoint_->GetPeerAddress();
+  }
+  const ResolvedAddress& GetLocalAddress() const {
+    return endpoint_->GetLocalAddress();
+  }
+
+ private:
+  // Shared with the endpoint callbacks, which may run after the
+  // PromiseEndpoint is gone.
+  struct State : public RefCounted<State> {
+    Mutex mu;
+
+    bool write_in_flight ABSL_GUARDED_BY(mu) = false;
+    absl::Status write_result ABSL_GUARDED_BY(mu);
+    Waker write_waker ABSL_GUARDED_BY(mu);
+    // Handed to the endpoint while a write is in flight.
+    SliceBuffer write_buffer;
+
+    bool read_in_flight ABSL_GUARDED_BY(mu) = false;
+    absl::Status read_error ABSL_GUARDED_BY(mu);
+    Waker read_waker ABSL_GUARDED_BY(mu);
+    // Bytes received but not yet returned by a read.
+    SliceBuffer read_buffer ABSL_GUARDED_BY(mu);
+    // Handed to the endpoint while a read is in flight.
+    SliceBuffer pending_read_buffer;
+  };
+
+  void StartWrite(SliceBuffer data);
+  Poll<absl::Status> PollWrite();
+  Poll<absl::StatusOr<SliceBuffer>> PollRead(size_t num_bytes);
+
+  RefCountedPtr<State> state_ = MakeRefCounted<State>();
+  std::unique_ptr<Endpoint> endpoint_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_TRANSPORT_PROMISE_ENDPOINT_H
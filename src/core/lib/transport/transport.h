@@ -77,9 +77,15 @@ struct grpc_transport_stream_op_batch_payload;
  * to be decompressed by the message_decompress filter. (Does not apply for
  * stream compression.) */
 #define GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED (0x40000000u)
+/** Internal bit flag set by the transport on a received message that is only
+ * part of the message sent: the rest follows in the next received messages.
+ * Only set if the recv_message op allowed it. */
+#define GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE (0x20000000u)
 /** Mask of all valid internal flags. */
-#define GRPC_WRITE_INTERNAL_USED_MASK \
-  (GRPC_WRITE_INTERNAL_COMPRESS | GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED)
+#define GRPC_WRITE_INTERNAL_USED_MASK               \
+  (GRPC_WRITE_INTERNAL_COMPRESS |                   \
+   GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED |   \
+   GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE)
 
 namespace grpc_core {
 
@@ -403,6 +409,11 @@ struct grpc_transport_stream_op_batch_payload {
     bool* call_failed_before_recv_message = nullptr;
     /** Should be enqueued when one message is ready to be processed. */
     grpc_closure* recv_message_ready = nullptr;
+    // If true, the transport may complete the op with the part of an
+    // uncompressed message received so far, flagged with
+    // GRPC_WRITE_INTERNAL_PARTIAL_MESSAGE, rather than wait for all of it.
+    // Transports are free to ignore this.
+    bool allow_partial = false;
   } recv_message;
 
   struct {
@@ -70,6 +70,52 @@ static tsi_result alts_grpc_privacy_integrity_protect(
   return TSI_OK;
 }
 
+static tsi_result alts_grpc_privacy_integrity_protect_frames(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* staging_slices,
+    grpc_slice_buffer* protected_slices) {
+  /* Allocates one buffer for all the output frames, instead of one per frame.
+   * There is always at least one frame, even if it is empty.  */
+  size_t frame_overhead =
+      rp->header_length +
+      alts_iovec_record_protocol_get_tag_length(rp->iovec_rp);
+  size_t num_frames =
+      unprotected_slices->length == 0
+          ? 1
+          : (unprotected_slices->length + max_unprotected_data_size - 1) /
+                max_unprotected_data_size;
+  grpc_slice protected_slice = GRPC_SLICE_MALLOC(
+      unprotected_slices->length + num_frames * frame_overhead);
+  uint8_t* protected_data = GRPC_SLICE_START_PTR(protected_slice);
+  /* Seals each frame into its part of the buffer, reusing the crypter.  */
+  for (size_t i = 0; i < num_frames; ++i) {
+    grpc_slice_buffer* frame_slices = unprotected_slices;
+    if (unprotected_slices->length > max_unprotected_data_size) {
+      grpc_slice_buffer_move_first(unprotected_slices,
+                                   max_unprotected_data_size, staging_slices);
+      frame_slices = staging_slices;
+    }
+    size_t frame_size = frame_slices->length + frame_overhead;
+    iovec_t protected_iovec = {protected_data, frame_size};
+    char* error_details = nullptr;
+    alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp, frame_slices);
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect(
+            rp->iovec_rp, rp->iovec_buf, frame_slices->count, protected_iovec,
+            &error_details);
+    grpc_slice_buffer_reset_and_unref(frame_slices);
+    if (status != GRPC_STATUS_OK) {
+      gpr_log(GPR_ERROR, "Failed to protect, %s", error_details);
+      gpr_free(error_details);
+      grpc_core::CSliceUnref(protected_slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    protected_data += frame_size;
+  }
+  grpc_slice_buffer_add(protected_slices, protected_slice);
+  return TSI_OK;
+}
+
 static tsi_result alts_grpc_privacy_integrity_unprotect(
     alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
@@ -119,7 +165,8 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect, nullptr,
+        alts_grpc_privacy_integrity_protect_frames};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
@@ -50,6 +50,29 @@ tsi_result alts_grpc_record_protocol_protect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+/**
+ * This methods performs protect operation on unprotected data of any length,
+ * splitting it into as many frames as needed, and appends the protected frames
+ * to protected_slices. It is equivalent to calling
+ * alts_grpc_record_protocol_protect on consecutive chunks of at most
+ * max_unprotected_data_size bytes, but implementations may seal all the frames
+ * into a single buffer. The input unprotected data slice buffer will be
+ * cleared.
+ *
+ * - self: an alts_grpc_record_protocol instance.
+ * - unprotected_slices: the unprotected data to be protected.
+ * - max_unprotected_data_size: maximum unprotected data size per frame.
+ * - staging_slices: an empty slice buffer used to hold each frame's data.
+ * - protected_slices: slice buffer where the protected frames are appended.
+ *
+ * This method returns TSI_OK in case of success or a specific error code in
+ * case of failure.
+ */
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* staging_slices,
+    grpc_slice_buffer* protected_slices);
+
 /**
  * This methods performs unprotect operation on a full frame of protected data
  * and appends unprotected data to unprotected_slices. It is the caller's
@@ -134,6 +134,35 @@ tsi_result alts_grpc_record_protocol_protect(
   return self->vtable->protect(self, unprotected_slices, protected_slices);
 }
 
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* staging_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (grpc_core::ExecCtx::Get() == nullptr || self == nullptr ||
+      self->vtable == nullptr || unprotected_slices == nullptr ||
+      staging_slices == nullptr || protected_slices == nullptr ||
+      max_unprotected_data_size == 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_frames != nullptr) {
+    return self->vtable->protect_frames(self, unprotected_slices,
+                                        max_unprotected_data_size,
+                                        staging_slices, protected_slices);
+  }
+  /* Falls back to protecting one frame at a time.  */
+  while (unprotected_slices->length > max_unprotected_data_size) {
+    grpc_slice_buffer_move_first(unprotected_slices, max_unprotected_data_size,
+                                 staging_slices);
+    tsi_result status = alts_grpc_record_protocol_protect(
+        self, staging_slices, protected_slices);
+    if (status != TSI_OK) {
+      return status;
+    }
+  }
+  return alts_grpc_record_protocol_protect(self, unprotected_slices,
+                                           protected_slices);
+}
+
 tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
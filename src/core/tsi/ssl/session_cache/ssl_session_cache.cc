@@ -20,15 +20,32 @@
 
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
+#include <functional>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 
 namespace tsi {
 
+namespace {
+
+// Caches smaller than this use a single shard, so that their eviction order
+// stays close to LRU.
+constexpr size_t kMinShardCapacity = 64;
+constexpr size_t kMaxShards = 16;
+
+}  // namespace
+
 /// Node for single cached session.
 class SslSessionLRUCache::Node {
  public:
@@ -42,8 +59,9 @@ class SslSessionLRUCache::Node {
 
   const std::string& key() const { return key_; }
 
-  /// Returns a copy of the node's cache session.
-  SslSessionPtr CopySession() const { return session_->CopySession(); }
+  /// Returns the node's cached session, which stays valid after the node is
+  /// updated or destroyed.
+  std::shared_ptr<SslCachedSession> session() const { return session_; }
 
   /// Set the \a session (which is moved) for the node.
   void SetSession(SslSessionPtr session) {
@@ -54,126 +72,112 @@ class SslSessionLRUCache::Node {
   friend class SslSessionLRUCache;
 
   std::string key_;
-  std::unique_ptr<SslCachedSession> session_;
-
-  Node* next_ = nullptr;
-  Node* prev_ = nullptr;
+  std::shared_ptr<SslCachedSession> session_;
+  // Set when the node is used, cleared when the clock hand passes it.
+  bool referenced_ = true;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
-  GPR_ASSERT(capacity > 0);
-}
-
-SslSessionLRUCache::~SslSessionLRUCache() {
-  Node* node = use_order_list_head_;
-  while (node) {
-    Node* next = node->next_;
-    delete node;
-    node = next;
+/// A part of the cache, holding the sessions whose keys hash to it.
+class SslSessionLRUCache::Shard {
+ public:
+  explicit Shard(size_t capacity) : capacity_(capacity) {
+    GPR_ASSERT(capacity > 0);
+    nodes_.reserve(capacity);
   }
-}
 
-size_t SslSessionLRUCache::Size() {
-  grpc_core::MutexLock lock(&lock_);
-  return use_order_list_size_;
-}
-
-SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
-    const std::string& key) {
-  auto it = entry_by_key_.find(key);
-  if (it == entry_by_key_.end()) {
-    return nullptr;
+  size_t Size() {
+    grpc_core::MutexLock lock(&lock_);
+    return nodes_.size();
   }
-  Node* node = it->second;
-  // Move to the beginning.
-  Remove(node);
-  PushFront(node);
-  AssertInvariants();
-  return node;
-}
 
-void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
-  grpc_core::MutexLock lock(&lock_);
-  Node* node = FindLocked(key);
-  if (node != nullptr) {
-    node->SetSession(std::move(session));
-    return;
-  }
-  node = new Node(key, std::move(session));
-  PushFront(node);
-  entry_by_key_.emplace(key, node);
-  AssertInvariants();
-  if (use_order_list_size_ > capacity_) {
-    GPR_ASSERT(use_order_list_tail_);
-    node = use_order_list_tail_;
-    Remove(node);
+  void Put(const std::string& key, SslSessionPtr session) {
+    // Destroy any session this replaces or evicts after releasing the lock.
+    std::unique_ptr<Node> evicted;
+    std::shared_ptr<SslCachedSession> replaced;
+    grpc_core::MutexLock lock(&lock_);
+    auto it = entry_by_key_.find(key);
+    if (it != entry_by_key_.end()) {
+      replaced = it->second->session();
+      it->second->SetSession(std::move(session));
+      it->second->referenced_ = true;
+      return;
+    }
+    auto node = std::make_unique<Node>(key, std::move(session));
+    entry_by_key_.emplace(key, node.get());
+    if (nodes_.size() < capacity_) {
+      nodes_.push_back(std::move(node));
+      return;
+    }
+    // Evict the first node the hand finds unused since it last passed,
+    // giving the used ones a second chance.
+    while (nodes_[hand_]->referenced_) {
+      nodes_[hand_]->referenced_ = false;
+      hand_ = (hand_ + 1) % capacity_;
+    }
     // Order matters, key is destroyed after deleting node.
-    entry_by_key_.erase(node->key());
-    delete node;
-    AssertInvariants();
+    entry_by_key_.erase(nodes_[hand_]->key());
+    evicted = std::exchange(nodes_[hand_], std::move(node));
+    hand_ = (hand_ + 1) % capacity_;
+    grpc_core::global_stats().IncrementSslSessionCacheEvictions();
   }
-}
 
-SslSessionPtr SslSessionLRUCache::Get(const char* key) {
-  grpc_core::MutexLock lock(&lock_);
-  // Key is only used for lookups.
-  Node* node = FindLocked(key);
-  if (node == nullptr) {
-    return nullptr;
+  std::shared_ptr<SslCachedSession> Get(const std::string& key) {
+    grpc_core::MutexLock lock(&lock_);
+    auto it = entry_by_key_.find(key);
+    if (it == entry_by_key_.end()) return nullptr;
+    it->second->referenced_ = true;
+    return it->second->session();
   }
-  return node->CopySession();
-}
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
-  if (node->prev_ == nullptr) {
-    use_order_list_head_ = node->next_;
-  } else {
-    node->prev_->next_ = node->next_;
-  }
-  if (node->next_ == nullptr) {
-    use_order_list_tail_ = node->prev_;
-  } else {
-    node->next_->prev_ = node->prev_;
+ private:
+  grpc_core::Mutex lock_;
+  const size_t capacity_;
+  // The nodes in the order the clock hand visits them.
+  std::vector<std::unique_ptr<Node>> nodes_ ABSL_GUARDED_BY(lock_);
+  size_t hand_ ABSL_GUARDED_BY(lock_) = 0;
+  std::map<std::string, Node*> entry_by_key_ ABSL_GUARDED_BY(lock_);
+};
+
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity) {
+  GPR_ASSERT(capacity > 0);
+  const size_t num_shards = grpc_core::Clamp<size_t>(
+      capacity / kMinShardCapacity, 1, kMaxShards);
+  for (size_t i = 0; i < num_shards; ++i) {
+    // Spread the capacity over the shards, giving the remainder to the
+    // first ones.
+    shards_.push_back(std::make_unique<Shard>(
+        capacity / num_shards + (i < capacity % num_shards ? 1 : 0)));
   }
-  GPR_ASSERT(use_order_list_size_ >= 1);
-  use_order_list_size_--;
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
-  if (use_order_list_head_ == nullptr) {
-    use_order_list_head_ = node;
-    use_order_list_tail_ = node;
-    node->next_ = nullptr;
-    node->prev_ = nullptr;
-  } else {
-    node->next_ = use_order_list_head_;
-    node->next_->prev_ = node;
-    use_order_list_head_ = node;
-    node->prev_ = nullptr;
-  }
-  use_order_list_size_++;
+SslSessionLRUCache::~SslSessionLRUCache() = default;
+
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardFor(
+    const std::string& key) {
+  return *shards_[std::hash<std::string>()(key) % shards_.size()];
 }
 
-#ifndef NDEBUG
-void SslSessionLRUCache::AssertInvariants() {
+size_t SslSessionLRUCache::Size() {
   size_t size = 0;
-  Node* prev = nullptr;
-  Node* current = use_order_list_head_;
-  while (current != nullptr) {
-    size++;
-    GPR_ASSERT(current->prev_ == prev);
-    auto it = entry_by_key_.find(current->key());
-    GPR_ASSERT(it != entry_by_key_.end());
-    GPR_ASSERT(it->second == current);
-    prev = current;
-    current = current->next_;
+  for (auto& shard : shards_) size += shard->Size();
+  return size;
+}
+
+void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
+  std::string key_str(key);
+  ShardFor(key_str).Put(key_str, std::move(session));
+}
+
+SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+  // Key is only used for lookups.
+  std::string key_str(key);
+  std::shared_ptr<SslCachedSession> session = ShardFor(key_str).Get(key_str);
+  if (session == nullptr) {
+    grpc_core::global_stats().IncrementSslSessionCacheMisses();
+    return nullptr;
   }
-  GPR_ASSERT(prev == use_order_list_tail_);
-  GPR_ASSERT(size == use_order_list_size_);
-  GPR_ASSERT(entry_by_key_.size() == use_order_list_size_);
+  grpc_core::global_stats().IncrementSslSessionCacheHits();
+  return session->CopySession();
 }
-#else
-void SslSessionLRUCache::AssertInvariants() {}
-#endif
 
 }  // namespace tsi
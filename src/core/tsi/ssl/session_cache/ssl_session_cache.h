@@ -21,7 +21,12 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <openssl/ssl.h>
 
@@ -37,10 +42,14 @@
 
 /// Cache for SSL sessions for sessions resumption.
 ///
-/// Older sessions may be evicted from the cache using LRU policy if capacity
-/// limit is hit. All sessions are associated with some key, usually server
-/// name. Note that servers are required to share session ticket encryption keys
-/// in order for cache to be effective.
+/// Older sessions may be evicted from the cache using an approximation of LRU
+/// (the CLOCK algorithm) if capacity limit is hit. All sessions are associated
+/// with some key, usually server name. Note that servers are required to share
+/// session ticket encryption keys in order for cache to be effective.
+///
+/// Large caches are split into shards by key hash, each with its own lock and
+/// its share of the capacity. A hit only marks the entry as used, and the
+/// session is copied outside of the lock.
 ///
 /// This class is thread safe.
 
@@ -79,19 +88,11 @@ class SslSessionLRUCache
 
  private:
   class Node;
+  class Shard;
 
-  Node* FindLocked(const std::string& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
-
-  grpc_core::Mutex lock_;
-  size_t capacity_;
+  Shard& ShardFor(const std::string& key);
 
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  std::map<std::string, Node*> entry_by_key_;
+  std::vector<std::unique_ptr<Shard>> shards_;
 };
 
 }  // namespace tsi
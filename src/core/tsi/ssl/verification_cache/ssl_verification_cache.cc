@@ -0,0 +1,144 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include <openssl/asn1.h>
+#include <openssl/crypto.h>
+#include <openssl/sha.h>
+
+namespace tsi {
+
+namespace {
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+bool AddToDigest(SHA256_CTX* sha, X509* cert) {
+  unsigned char* der = nullptr;
+  int len = i2d_X509(cert, &der);
+  if (len <= 0) return false;
+  SHA256_Update(sha, der, static_cast<size_t>(len));
+  OPENSSL_free(der);
+  return true;
+}
+
+// Returns how many seconds are left until the first certificate of \a chain
+// expires, or -1 if that cannot be determined.
+int64_t SecondsUntilChainExpires(STACK_OF(X509) * chain) {
+  if (chain == nullptr) return -1;
+  int64_t remaining = INT64_MAX;
+  for (int i = 0; i < static_cast<int>(sk_X509_num(chain)); ++i) {
+    int days;
+    int seconds;
+    if (!ASN1_TIME_diff(&days, &seconds, nullptr,
+                        X509_get0_notAfter(sk_X509_value(chain, i)))) {
+      return -1;
+    }
+    remaining = std::min(remaining,
+                         static_cast<int64_t>(days) * 86400 + seconds);
+  }
+  return remaining;
+}
+#endif  // OPENSSL_VERSION_NUMBER >= 0x10100000
+
+}  // namespace
+
+int SslVerificationCache::VerifyCallback(X509_STORE_CTX* ctx, void* arg) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  auto* cache = static_cast<SslVerificationCache*>(arg);
+  std::string key = KeyFor(ctx);
+  if (!key.empty() && cache->Lookup(key)) return 1;
+  int result = X509_verify_cert(ctx);
+  if (result == 1 && !key.empty()) {
+    int64_t lifetime = std::min(
+        SecondsUntilChainExpires(X509_STORE_CTX_get0_chain(ctx)),
+        kMaxEntryAgeSeconds);
+    if (lifetime > 0) {
+      cache->Add(std::move(key),
+                 gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                              gpr_time_from_seconds(lifetime,
+                                                    GPR_TIMESPAN)));
+    }
+  }
+  return result;
+#else
+  (void)arg;
+  return X509_verify_cert(ctx);
+#endif
+}
+
+size_t SslVerificationCache::Size() {
+  grpc_core::MutexLock lock(&mu_);
+  return entries_.size();
+}
+
+std::string SslVerificationCache::KeyFor(X509_STORE_CTX* ctx) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  X509* leaf = X509_STORE_CTX_get0_cert(ctx);
+  if (leaf == nullptr) return "";
+  SHA256_CTX sha;
+  SHA256_Init(&sha);
+  if (!AddToDigest(&sha, leaf)) return "";
+  // The certificates the peer sent along with its own; they may change which
+  // path verification finds.
+  STACK_OF(X509)* untrusted = X509_STORE_CTX_get0_untrusted(ctx);
+  if (untrusted != nullptr) {
+    for (int i = 0; i < static_cast<int>(sk_X509_num(untrusted)); ++i) {
+      if (!AddToDigest(&sha, sk_X509_value(untrusted, i))) return "";
+    }
+  }
+  unsigned char digest[SHA256_DIGEST_LENGTH];
+  SHA256_Final(digest, &sha);
+  return std::string(reinterpret_cast<const char*>(digest), sizeof(digest));
+#else
+  (void)ctx;
+  return "";
+#endif
+}
+
+bool SslVerificationCache::Lookup(const std::string& key) {
+  grpc_core::MutexLock lock(&mu_);
+  auto it = index_.find(key);
+  if (it == index_.end()) return false;
+  if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), it->second->expiry) >= 0) {
+    entries_.erase(it->second);
+    index_.erase(it);
+    return false;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return true;
+}
+
+void SslVerificationCache::Add(std::string key, gpr_timespec expiry) {
+  grpc_core::MutexLock lock(&mu_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    it->second->expiry = expiry;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+  entries_.push_front(Entry{key, expiry});
+  index_.emplace(std::move(key), entries_.begin());
+  if (entries_.size() > capacity_) {
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace tsi
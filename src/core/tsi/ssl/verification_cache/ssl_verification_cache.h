@@ -0,0 +1,100 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
+#define GRPC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <list>
+#include <string>
+#include <utility>
+
+#include <openssl/x509.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace tsi {
+
+/// Remembers peer certificate chains that passed X.509 verification, so that
+/// a peer that reconnects does not pay for path building and signature
+/// checks again.
+///
+/// Entries are keyed by a SHA-256 digest of the DER encoding of the chain the
+/// peer sent, and expire when the first certificate of the verified chain
+/// does (or after a maximum age, whichever comes first). A cache is only
+/// valid for the trust settings it was created with: it belongs to a single
+/// handshaker factory, which is rebuilt whenever the root certificates
+/// change. The least recently used entry is dropped when the cache is full.
+///
+/// This class is thread safe.
+class SslVerificationCache
+    : public grpc_core::RefCounted<SslVerificationCache> {
+ public:
+  /// How long an entry may be used, even if the chain is valid for longer.
+  static constexpr int64_t kMaxEntryAgeSeconds = 3600;
+
+  static grpc_core::RefCountedPtr<SslVerificationCache> Create(
+      size_t capacity) {
+    return grpc_core::MakeRefCounted<SslVerificationCache>(capacity);
+  }
+
+  // Use Create function instead of using this directly.
+  explicit SslVerificationCache(size_t capacity) : capacity_(capacity) {}
+
+  // Not copyable nor movable.
+  SslVerificationCache(const SslVerificationCache&) = delete;
+  SslVerificationCache& operator=(const SslVerificationCache&) = delete;
+
+  /// Verifies the chain in \a ctx, from the cache if possible. Has the same
+  /// contract as X509_verify_cert(), which it calls on a miss, and can be
+  /// installed with SSL_CTX_set_cert_verify_callback().
+  static int VerifyCallback(X509_STORE_CTX* ctx, void* arg);
+
+  /// Returns the number of entries in the cache.
+  size_t Size();
+
+ private:
+  struct Entry {
+    std::string key;
+    gpr_timespec expiry;
+  };
+
+  // Returns the cache key for the chain \a ctx is about to verify, or an
+  // empty string if it cannot be computed.
+  static std::string KeyFor(X509_STORE_CTX* ctx);
+
+  bool Lookup(const std::string& key);
+  void Add(std::string key, gpr_timespec expiry);
+
+  const size_t capacity_;
+  grpc_core::Mutex mu_;
+  // Most recently used first.
+  std::list<Entry> entries_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, std::list<Entry>::iterator> index_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
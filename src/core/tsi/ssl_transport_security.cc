@@ -44,6 +44,29 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+/* Kernel TLS needs the traffic keys and sequence numbers of the connection,
+   which only BoringSSL exports. */
+#if defined(OPENSSL_IS_BORINGSSL) && defined(GPR_LINUX) && \
+    defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#define TSI_SSL_KERNEL_TLS_SUPPORT 1
+#endif
+#endif
+
+#ifdef TSI_SSL_KERNEL_TLS_SUPPORT
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/hkdf.h>
+#include <openssl/nid.h>
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#endif
+
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -58,6 +81,7 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
 
@@ -98,6 +122,7 @@ struct tsi_ssl_client_handshaker_factory {
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  grpc_core::RefCountedPtr<tsi::SslVerificationCache> verification_cache;
 };
 
 struct tsi_ssl_server_handshaker_factory {
@@ -111,6 +136,8 @@ struct tsi_ssl_server_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  // Shared by all of ssl_contexts.
+  grpc_core::RefCountedPtr<tsi::SslVerificationCache> verification_cache;
 };
 
 struct tsi_ssl_handshaker {
@@ -567,7 +594,7 @@ static tsi_result do_ssl_read(SSL* ssl, unsigned char* unprotected_bytes,
 }
 
 /* Performs an SSL_write and handle errors. */
-static tsi_result do_ssl_write(SSL* ssl, unsigned char* unprotected_bytes,
+static tsi_result do_ssl_write(SSL* ssl, const unsigned char* unprotected_bytes,
                                size_t unprotected_bytes_size) {
   GPR_ASSERT(unprotected_bytes_size <= INT_MAX);
   ERR_clear_error();
@@ -1078,6 +1105,25 @@ static tsi_result ssl_protector_protect(tsi_frame_protector* self,
     return TSI_OK;
   }
 
+  /* If nothing is buffered and the input holds at least a full frame, seal
+     the frame straight from the input instead of copying it into our
+     internal buffer first. */
+  if (impl->buffer_offset == 0 &&
+      *unprotected_bytes_size >= impl->buffer_size) {
+    result = do_ssl_write(impl->ssl, unprotected_bytes, impl->buffer_size);
+    if (result != TSI_OK) return result;
+    GPR_ASSERT(*protected_output_frames_size <= INT_MAX);
+    read_from_ssl = BIO_read(impl->network_io, protected_output_frames,
+                             static_cast<int>(*protected_output_frames_size));
+    if (read_from_ssl < 0) {
+      gpr_log(GPR_ERROR, "Could not read from BIO after SSL_write.");
+      return TSI_INTERNAL_ERROR;
+    }
+    *protected_output_frames_size = static_cast<size_t>(read_from_ssl);
+    *unprotected_bytes_size = impl->buffer_size;
+    return TSI_OK;
+  }
+
   /* Now see if we can send a complete frame. */
   available = impl->buffer_size - impl->buffer_offset;
   if (available > *unprotected_bytes_size) {
@@ -1396,6 +1442,216 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+#ifdef TSI_SSL_KERNEL_TLS_SUPPORT
+
+/* Record protection state for one direction of a connection, as the kernel
+   wants it. */
+struct ssl_kernel_tls_keys {
+  unsigned char key[32];
+  size_t key_size;
+  unsigned char salt[4];
+  unsigned char iv[8];
+  unsigned char rec_seq[8];
+};
+
+static void ssl_store_sequence(uint64_t seq, unsigned char out[8]) {
+  for (int i = 7; i >= 0; --i) {
+    out[i] = static_cast<unsigned char>(seq & 0xff);
+    seq >>= 8;
+  }
+}
+
+/* HKDF-Expand-Label from RFC 8446, with an empty context. */
+static bool ssl_tls13_hkdf_expand_label(const EVP_MD* digest,
+                                        bssl::Span<const uint8_t> secret,
+                                        absl::string_view label,
+                                        unsigned char* out, size_t out_len) {
+  static const char kLabelPrefix[] = "tls13 ";
+  std::string info;
+  info.push_back(static_cast<char>(out_len >> 8));
+  info.push_back(static_cast<char>(out_len & 0xff));
+  info.push_back(static_cast<char>(strlen(kLabelPrefix) + label.size()));
+  info.append(kLabelPrefix);
+  info.append(label.data(), label.size());
+  info.push_back(0);
+  return HKDF_expand(out, out_len, digest, secret.data(), secret.size(),
+                     reinterpret_cast<const uint8_t*>(info.data()),
+                     info.size()) == 1;
+}
+
+/* Gets the TLS 1.2 traffic keys from the key block (RFC 5246 section 6.3).
+   AES-GCM has no MAC keys, and the implicit part of its nonce is the salt. */
+static bool ssl_get_tls12_keys(SSL* ssl, size_t key_size,
+                               ssl_kernel_tls_keys* read_keys,
+                               ssl_kernel_tls_keys* write_keys) {
+  unsigned char block[2 * (32 + 4)];
+  const size_t block_size = 2 * (key_size + 4);
+  if (static_cast<size_t>(SSL_get_key_block_len(ssl)) != block_size ||
+      !SSL_generate_key_block(ssl, block, block_size)) {
+    return false;
+  }
+  const unsigned char* client_key = block;
+  const unsigned char* server_key = block + key_size;
+  const unsigned char* client_salt = block + 2 * key_size;
+  const unsigned char* server_salt = client_salt + 4;
+  const bool is_server = SSL_is_server(ssl);
+  memcpy(read_keys->key, is_server ? client_key : server_key, key_size);
+  memcpy(read_keys->salt, is_server ? client_salt : server_salt, 4);
+  memcpy(write_keys->key, is_server ? server_key : client_key, key_size);
+  memcpy(write_keys->salt, is_server ? server_salt : client_salt, 4);
+  /* BoringSSL uses the sequence number as the explicit nonce. */
+  memcpy(read_keys->iv, read_keys->rec_seq, 8);
+  memcpy(write_keys->iv, write_keys->rec_seq, 8);
+  OPENSSL_cleanse(block, sizeof(block));
+  return true;
+}
+
+/* Derives the TLS 1.3 traffic keys from the traffic secrets (RFC 8446
+   section 7.3).  The first four bytes of the nonce are passed as salt. */
+static bool ssl_get_tls13_keys(SSL* ssl, const SSL_CIPHER* cipher,
+                               size_t key_size,
+                               ssl_kernel_tls_keys* read_keys,
+                               ssl_kernel_tls_keys* write_keys) {
+  const EVP_MD* digest = SSL_CIPHER_get_handshake_digest(cipher);
+  bssl::Span<const uint8_t> read_secret;
+  bssl::Span<const uint8_t> write_secret;
+  if (digest == nullptr ||
+      !bssl::SSL_get_traffic_secrets(ssl, &read_secret, &write_secret)) {
+    return false;
+  }
+  unsigned char nonce[12];
+  for (auto* keys : {read_keys, write_keys}) {
+    bssl::Span<const uint8_t> secret =
+        keys == read_keys ? read_secret : write_secret;
+    if (!ssl_tls13_hkdf_expand_label(digest, secret, "key", keys->key,
+                                     key_size) ||
+        !ssl_tls13_hkdf_expand_label(digest, secret, "iv", nonce,
+                                     sizeof(nonce))) {
+      return false;
+    }
+    memcpy(keys->salt, nonce, 4);
+    memcpy(keys->iv, nonce + 4, 8);
+  }
+  OPENSSL_cleanse(nonce, sizeof(nonce));
+  return true;
+}
+
+template <typename CryptoInfo>
+static bool ssl_set_kernel_crypto_info(int fd, int direction,
+                                       uint16_t version, uint16_t cipher_type,
+                                       const ssl_kernel_tls_keys& keys) {
+  CryptoInfo info;
+  memset(&info, 0, sizeof(info));
+  info.info.version = version;
+  info.info.cipher_type = cipher_type;
+  GPR_ASSERT(keys.key_size == sizeof(info.key));
+  memcpy(info.key, keys.key, sizeof(info.key));
+  memcpy(info.salt, keys.salt, sizeof(info.salt));
+  memcpy(info.iv, keys.iv, sizeof(info.iv));
+  memcpy(info.rec_seq, keys.rec_seq, sizeof(info.rec_seq));
+  const bool ok = setsockopt(fd, SOL_TLS, direction, &info, sizeof(info)) == 0;
+  OPENSSL_cleanse(&info, sizeof(info));
+  return ok;
+}
+
+static bool ssl_set_kernel_keys(int fd, int direction, uint16_t version,
+                                const ssl_kernel_tls_keys& keys) {
+  if (keys.key_size == 16) {
+    return ssl_set_kernel_crypto_info<tls12_crypto_info_aes_gcm_128>(
+        fd, direction, version, TLS_CIPHER_AES_GCM_128, keys);
+  }
+#ifdef TLS_CIPHER_AES_GCM_256
+  return ssl_set_kernel_crypto_info<tls12_crypto_info_aes_gcm_256>(
+      fd, direction, version, TLS_CIPHER_AES_GCM_256, keys);
+#else
+  return false;
+#endif
+}
+
+#endif /* TSI_SSL_KERNEL_TLS_SUPPORT */
+
+/* Moves record protection to the kernel with Linux kernel TLS.  Only
+   AES-GCM with TLS 1.2, or TLS 1.3 on the server side, is supported: a TLS
+   1.3 client receives session tickets after the handshake, which the kernel
+   does not pass along as data. */
+static tsi_result ssl_handshaker_result_enable_kernel_protection(
+    tsi_handshaker_result* self, int fd) {
+#ifdef TSI_SSL_KERNEL_TLS_SUPPORT
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(self);
+  SSL* ssl = impl->ssl;
+  if (ssl == nullptr) return TSI_FAILED_PRECONDITION;
+  /* Records that OpenSSL has received but not yet decrypted cannot be
+     handed to the kernel. */
+  if (impl->unused_bytes_size > 0 || SSL_pending(ssl) > 0 ||
+      BIO_pending(SSL_get_rbio(ssl)) > 0 || BIO_pending(impl->network_io) > 0) {
+    return TSI_UNIMPLEMENTED;
+  }
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr) return TSI_UNIMPLEMENTED;
+  size_t key_size;
+  switch (SSL_CIPHER_get_cipher_nid(cipher)) {
+    case NID_aes_128_gcm:
+      key_size = 16;
+      break;
+#ifdef TLS_CIPHER_AES_GCM_256
+    case NID_aes_256_gcm:
+      key_size = 32;
+      break;
+#endif
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  ssl_kernel_tls_keys read_keys;
+  ssl_kernel_tls_keys write_keys;
+  memset(&read_keys, 0, sizeof(read_keys));
+  memset(&write_keys, 0, sizeof(write_keys));
+  read_keys.key_size = write_keys.key_size = key_size;
+  ssl_store_sequence(SSL_get_read_sequence(ssl), read_keys.rec_seq);
+  ssl_store_sequence(SSL_get_write_sequence(ssl), write_keys.rec_seq);
+  uint16_t version = 0;
+  bool have_keys = false;
+  switch (SSL_version(ssl)) {
+    case TLS1_2_VERSION:
+      version = TLS_1_2_VERSION;
+      have_keys = ssl_get_tls12_keys(ssl, key_size, &read_keys, &write_keys);
+      break;
+#ifdef TLS_1_3_VERSION
+    case TLS1_3_VERSION:
+      version = TLS_1_3_VERSION;
+      have_keys = SSL_is_server(ssl) &&
+                  ssl_get_tls13_keys(ssl, cipher, key_size, &read_keys,
+                                     &write_keys);
+      break;
+#endif
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  tsi_result result = TSI_UNIMPLEMENTED;
+  /* Until keys are installed, the TLS ULP passes data through unchanged, so
+     failing to install the receive keys leaves the connection usable.  The
+     receive keys go first because kernels support them less widely. */
+  if (have_keys &&
+      setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0 &&
+      ssl_set_kernel_keys(fd, TLS_RX, version, read_keys)) {
+    if (ssl_set_kernel_keys(fd, TLS_TX, version, write_keys)) {
+      result = TSI_OK;
+    } else {
+      gpr_log(GPR_ERROR,
+              "Kernel TLS accepted the receive keys but not the send keys.");
+      result = TSI_INTERNAL_ERROR;
+    }
+  }
+  OPENSSL_cleanse(&read_keys, sizeof(read_keys));
+  OPENSSL_cleanse(&write_keys, sizeof(write_keys));
+  return result;
+#else
+  (void)self;
+  (void)fd;
+  return TSI_UNIMPLEMENTED;
+#endif
+}
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -1412,6 +1668,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_enable_kernel_protection,
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1819,6 +2076,7 @@ static void tsi_ssl_client_handshaker_factory_destroy(
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->session_cache.reset();
   self->key_logger.reset();
+  self->verification_cache.reset();
   gpr_free(self);
 }
 
@@ -1869,6 +2127,7 @@ static void tsi_ssl_server_handshaker_factory_destroy(
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->key_logger.reset();
+  self->verification_cache.reset();
   gpr_free(self);
 }
 
@@ -2160,6 +2419,19 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
       gpr_log(GPR_INFO, "enabled client side CRL checking.");
     }
   }
+
+  // A cached result could miss a revocation, so CRL checking always
+  // verifies the chain.
+  if (options->verification_cache_size > 0 &&
+      !options->skip_server_certificate_verification &&
+      (options->crl_directory == nullptr ||
+       strcmp(options->crl_directory, "") == 0)) {
+    impl->verification_cache =
+        tsi::SslVerificationCache::Create(options->verification_cache_size);
+    SSL_CTX_set_cert_verify_callback(ssl_context,
+                                     tsi::SslVerificationCache::VerifyCallback,
+                                     impl->verification_cache.get());
+  }
 #endif
 
   *factory = impl;
@@ -2343,6 +2615,24 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
           gpr_log(GPR_INFO, "enabled server CRL checking.");
         }
       }
+
+      // A cached result could miss a revocation, so CRL checking always
+      // verifies the chain.
+      if (options->verification_cache_size > 0 &&
+          (options->client_certificate_request ==
+               TSI_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY ||
+           options->client_certificate_request ==
+               TSI_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_AND_VERIFY) &&
+          (options->crl_directory == nullptr ||
+           strcmp(options->crl_directory, "") == 0)) {
+        if (impl->verification_cache == nullptr) {
+          impl->verification_cache = tsi::SslVerificationCache::Create(
+              options->verification_cache_size);
+        }
+        SSL_CTX_set_cert_verify_callback(
+            impl->ssl_contexts[i], tsi::SslVerificationCache::VerifyCallback,
+            impl->verification_cache.get());
+      }
 #endif
 
       result = tsi_ssl_extract_x509_subject_names_from_pem_cert(
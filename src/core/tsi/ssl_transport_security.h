@@ -63,7 +63,14 @@ void tsi_ssl_root_certs_store_destroy(tsi_ssl_root_certs_store* self);
 
 /* --- tsi_ssl_session_cache object ---
 
-   Cache for SSL sessions for sessions resumption.  */
+   Cache for SSL sessions for sessions resumption.
+
+   A resumed handshake still takes a full round trip before application data
+   can be sent: TLS 1.3 early data is never offered nor accepted. Supporting
+   it would need the handshaker to complete (and the peer to be checked)
+   while the handshake is still in flight, the frame protector to resend
+   data the server rejects, and the transport to hold back calls that are
+   not safe to replay until the handshake is confirmed.  */
 
 typedef struct tsi_ssl_session_cache tsi_ssl_session_cache;
 
@@ -179,6 +186,12 @@ struct tsi_ssl_client_handshaker_options {
      > 1.1 is supported for CRL checking*/
   const char* crl_directory;
 
+  /* The number of verified server certificate chains to remember, so that
+     reconnecting to the same server skips verifying its chain again. 0
+     disables the cache. The cache is not used when CRL checking is enabled.
+     Only OpenSSL version >= 1.1 is supported. */
+  size_t verification_cache_size;
+
   tsi_ssl_client_handshaker_options()
       : pem_key_cert_pair(nullptr),
         pem_root_certs(nullptr),
@@ -191,7 +204,8 @@ struct tsi_ssl_client_handshaker_options {
         skip_server_certificate_verification(false),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
-        crl_directory(nullptr) {}
+        crl_directory(nullptr),
+        verification_cache_size(0) {}
 };
 
 /* Creates a client handshaker factory.
@@ -322,6 +336,12 @@ struct tsi_ssl_server_handshaker_options {
    * crl checking. Only OpenSSL version > 1.1 is supported for CRL checking */
   const char* crl_directory;
 
+  /* The number of verified client certificate chains to remember, so that
+   * a reconnecting client skips verifying its chain again. 0 disables the
+   * cache. The cache is not used when CRL checking is enabled. Only OpenSSL
+   * version >= 1.1 is supported. */
+  size_t verification_cache_size;
+
   tsi_ssl_server_handshaker_options()
       : pem_key_cert_pairs(nullptr),
         num_key_cert_pairs(0),
@@ -335,7 +355,8 @@ struct tsi_ssl_server_handshaker_options {
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
         key_logger(nullptr),
-        crl_directory(nullptr) {}
+        crl_directory(nullptr),
+        verification_cache_size(0) {}
 };
 
 /* Creates a server handshaker factory.
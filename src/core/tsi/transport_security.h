@@ -118,6 +118,9 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  /* May be null if the implementation cannot hand record protection over
+     to the kernel. */
+  tsi_result (*enable_kernel_protection)(tsi_handshaker_result* self, int fd);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
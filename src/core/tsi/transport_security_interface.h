@@ -271,6 +271,15 @@ tsi_result tsi_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector);
 
+/* This method hands record protection for the connection over to the kernel
+   for the socket fd, for example with Linux kernel TLS.  On TSI_OK, data
+   read from and written to fd is plaintext and no frame protector must be
+   created.  It returns TSI_UNIMPLEMENTED, leaving the connection untouched,
+   if this implementation, the negotiated protocol or the kernel does not
+   support it, and another error if the connection can no longer be used. */
+tsi_result tsi_handshaker_result_enable_kernel_protection(
+    tsi_handshaker_result* self, int fd);
+
 /* This method returns the unused bytes from the handshake. It returns TSI_OK
    assuming there is no fatal error.
    Ownership of the bytes is retained by the handshaker result. As a
@@ -74,6 +74,10 @@ Channel::~Channel() {
 
 namespace {
 
+// Beyond this many method and authority pairs, calls with a per-call
+// authority go through the unregistered path.
+constexpr size_t kMaxAuthorityRegistrations = 1000;
+
 inline grpc_slice SliceFromArray(const char* arr, size_t len) {
   return g_core_codegen_interface->grpc_slice_from_copied_buffer(arr, len);
 }
@@ -116,13 +120,17 @@ void ChannelResetConnectionBackoff(Channel* channel) {
 grpc::internal::Call Channel::CreateCallInternal(
     const grpc::internal::RpcMethod& method, grpc::ClientContext* context,
     grpc::CompletionQueue* cq, size_t interceptor_pos) {
-  const bool kRegistered = method.channel_tag() && context->authority().empty();
+  void* registered_tag = method.channel_tag();
+  if (registered_tag != nullptr && !context->authority().empty()) {
+    registered_tag =
+        RegisteredMethodWithAuthority(method, context->authority());
+  }
   grpc_call* c_call = nullptr;
-  if (kRegistered) {
+  if (registered_tag != nullptr) {
     c_call = grpc_channel_create_registered_call(
         c_channel_, context->propagate_from_call_,
-        context->propagation_options_.c_bitmask(), cq->cq(),
-        method.channel_tag(), context->raw_deadline(), nullptr);
+        context->propagation_options_.c_bitmask(), cq->cq(), registered_tag,
+        context->raw_deadline(), nullptr);
   } else {
     const ::std::string* host_str = nullptr;
     if (!context->authority_.empty()) {
@@ -176,6 +184,24 @@ void* Channel::RegisterMethod(const char* method) {
       c_channel_, method, host_.empty() ? nullptr : host_.c_str(), nullptr);
 }
 
+void* Channel::RegisteredMethodWithAuthority(
+    const grpc::internal::RpcMethod& method, const std::string& authority) {
+  grpc::internal::MutexLock lock(&authority_registrations_mu_);
+  auto it = authority_registrations_.find(authority);
+  if (it != authority_registrations_.end()) {
+    auto tag = it->second.find(method.channel_tag());
+    if (tag != it->second.end()) return tag->second;
+  }
+  if (num_authority_registrations_ >= kMaxAuthorityRegistrations) {
+    return nullptr;
+  }
+  ++num_authority_registrations_;
+  void* tag = grpc_channel_register_call(c_channel_, method.name(),
+                                         authority.c_str(), nullptr);
+  authority_registrations_[authority][method.channel_tag()] = tag;
+  return tag;
+}
+
 grpc_connectivity_state Channel::GetState(bool try_to_connect) {
   return grpc_channel_check_connectivity_state(c_channel_, try_to_connect);
 }
@@ -42,6 +42,9 @@
 #include <grpcpp/server_context.h>
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/config.h>
+#include <grpcpp/support/tcp_tracer.h>
+
+#include "src/cpp/common/tcp_tracer.h"
 
 namespace grpc {
 
@@ -130,6 +133,7 @@ void ClientContext::set_call(grpc_call* call,
   GPR_ASSERT(call_ == nullptr);
   call_ = call;
   channel_ = channel;
+  if (tcp_tracer_ != nullptr) internal::SetTcpTracer(call_, tcp_tracer_);
   if (creds_ && !creds_->ApplyToCall(call_)) {
     // TODO(yashykt): should interceptors also see this status?
     SendCancelToInterceptors();
@@ -165,6 +169,35 @@ void ClientContext::TryCancel() {
   }
 }
 
+void ClientContext::Reset() {
+  g_client_callbacks->Destructor(this);
+  if (call_ != nullptr) {
+    grpc_call_unref(call_);
+    call_ = nullptr;
+  }
+  channel_.reset();
+  initial_metadata_received_ = false;
+  wait_for_ready_ = false;
+  wait_for_ready_explicitly_set_ = false;
+  call_canceled_ = false;
+  deadline_ = gpr_inf_future(GPR_CLOCK_REALTIME);
+  authority_.clear();
+  creds_.reset();
+  auth_context_.reset();
+  census_context_ = nullptr;
+  tcp_tracer_.reset();
+  send_initial_metadata_.clear();
+  recv_initial_metadata_.Reset();
+  trailing_metadata_.Reset();
+  propagate_from_call_ = nullptr;
+  propagation_options_ = PropagationOptions();
+  compression_algorithm_ = GRPC_COMPRESS_NONE;
+  initial_metadata_corked_ = false;
+  debug_error_string_.clear();
+  rpc_info_ = grpc::experimental::ClientRpcInfo();
+  g_client_callbacks->DefaultConstructor(this);
+}
+
 void ClientContext::SendCancelToInterceptors() {
   internal::CancelInterceptorBatchMethods cancel_methods;
   for (size_t i = 0; i < rpc_info_.interceptors_.size(); i++) {
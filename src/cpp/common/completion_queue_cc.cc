@@ -15,6 +15,7 @@
  *
  */
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -167,6 +168,38 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+CompletionQueue::NextStatus CompletionQueue::AsyncNextBatchInternal(
+    void** tags, bool* oks, size_t max_events, size_t* num_events,
+    gpr_timespec deadline) {
+  grpc_event events[64];
+  max_events = std::min(max_events, GPR_ARRAY_SIZE(events));
+  for (;;) {
+    size_t n = grpc_completion_queue_next_batch(cq_, events, max_events,
+                                                deadline, nullptr);
+    switch (events[0].type) {
+      case GRPC_QUEUE_TIMEOUT:
+        return TIMEOUT;
+      case GRPC_QUEUE_SHUTDOWN:
+        return SHUTDOWN;
+      case GRPC_OP_COMPLETE:
+        break;
+    }
+    *num_events = 0;
+    for (size_t i = 0; i < n; i++) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[*num_events] = tag;
+        oks[*num_events] = ok;
+        ++*num_events;
+      }
+    }
+    if (*num_events > 0) return GOT_EVENT;
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
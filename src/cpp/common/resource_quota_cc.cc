@@ -24,6 +24,8 @@
 #include <grpcpp/resource_quota.h>
 #include <grpcpp/support/config.h>
 
+#include "src/core/lib/resource_quota/resource_quota.h"
+
 namespace grpc {
 
 ResourceQuota::ResourceQuota() : impl_(grpc_resource_quota_create(nullptr)) {}
@@ -31,6 +33,12 @@ ResourceQuota::ResourceQuota() : impl_(grpc_resource_quota_create(nullptr)) {}
 ResourceQuota::ResourceQuota(const std::string& name)
     : impl_(grpc_resource_quota_create(name.c_str())) {}
 
+ResourceQuota::ResourceQuota(const std::string& name,
+                             const ResourceQuota& parent)
+    : impl_((new grpc_core::ResourceQuota(
+                 name, *grpc_core::ResourceQuota::FromC(parent.impl_)))
+                ->c_ptr()) {}
+
 ResourceQuota::~ResourceQuota() { grpc_resource_quota_unref(impl_); }
 
 ResourceQuota& ResourceQuota::Resize(size_t new_size) {
@@ -42,4 +50,10 @@ ResourceQuota& ResourceQuota::SetMaxThreads(int new_max_threads) {
   grpc_resource_quota_set_max_threads(impl_, new_max_threads);
   return *this;
 }
+
+ResourceQuota& ResourceQuota::SetMinShare(size_t min_bytes) {
+  grpc_core::ResourceQuota::FromC(impl_)->memory_quota()->SetMinShare(
+      min_bytes);
+  return *this;
+}
 }  // namespace grpc
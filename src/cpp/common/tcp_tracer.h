@@ -0,0 +1,37 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_INTERNAL_CPP_COMMON_TCP_TRACER_H
+#define GRPC_INTERNAL_CPP_COMMON_TCP_TRACER_H
+
+#include <memory>
+
+#include <grpc/grpc.h>
+#include <grpcpp/support/tcp_tracer.h>
+
+namespace grpc {
+namespace internal {
+
+// Makes \a tracer the TCP tracer of \a call, in place of any previous one.
+void SetTcpTracer(grpc_call* call,
+                  std::shared_ptr<experimental::TcpTracer> tracer);
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPC_INTERNAL_CPP_COMMON_TCP_TRACER_H
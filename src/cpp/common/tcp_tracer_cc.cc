@@ -0,0 +1,70 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/cpp/common/tcp_tracer.h"
+
+#include <stddef.h>
+
+#include <utility>
+
+#include <grpc/impl/codegen/gpr_types.h>
+
+#include "src/core/lib/channel/call_tracer.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/surface/call.h"
+
+namespace grpc {
+namespace internal {
+
+namespace {
+
+class TcpTracerAdapter : public grpc_core::TcpTracerInterface {
+ public:
+  explicit TcpTracerAdapter(std::shared_ptr<experimental::TcpTracer> tracer)
+      : tracer_(std::move(tracer)) {}
+
+  void RecordEvent(Type type, const gpr_timespec& time,
+                   size_t byte_offset) override {
+    tracer_->RecordEvent(static_cast<experimental::TcpTracer::Event>(type),
+                         time, byte_offset);
+  }
+
+ private:
+  std::shared_ptr<experimental::TcpTracer> tracer_;
+};
+
+static_assert(static_cast<int>(experimental::TcpTracer::Event::kAcked) ==
+                  static_cast<int>(grpc_core::TcpTracerInterface::Type::kAcked),
+              "TcpTracer::Event must match TcpTracerInterface::Type");
+
+}  // namespace
+
+void SetTcpTracer(grpc_call* call,
+                  std::shared_ptr<experimental::TcpTracer> tracer) {
+  std::shared_ptr<grpc_core::TcpTracerInterface> adapter;
+  if (tracer != nullptr) {
+    adapter = std::make_shared<TcpTracerAdapter>(std::move(tracer));
+  }
+  grpc_call_context_set(
+      call, GRPC_CONTEXT_TCP_TRACER,
+      new std::shared_ptr<grpc_core::TcpTracerInterface>(std::move(adapter)),
+      grpc_core::DestroyTcpTracer);
+}
+
+}  // namespace internal
+}  // namespace grpc
@@ -70,6 +70,11 @@ void TlsCredentialsOptions::set_crl_directory(const std::string& path) {
                                                  path.c_str());
 }
 
+void TlsCredentialsOptions::set_verification_cache_size(size_t size) {
+  grpc_tls_credentials_options_set_verification_cache_size(
+      c_credentials_options_, size);
+}
+
 void TlsCredentialsOptions::set_tls_session_key_log_file_path(
     const std::string& tls_session_key_log_file_path) {
   grpc_tls_credentials_options_set_tls_session_key_log_file_path(
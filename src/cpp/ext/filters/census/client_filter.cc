@@ -126,10 +126,8 @@ OpenCensusCallTracer::OpenCensusCallAttemptTracer::OpenCensusCallAttemptTracer(
     context_.AddSpanAttribute("transparent-retry", is_transparent_retry);
   }
   if (OpenCensusStatsEnabled()) {
-    std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-        context_.tags().tags();
-    tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-    ::opencensus::stats::Record({{RpcClientStartedRpcs(), 1}}, tags);
+    ::opencensus::stats::Record({{RpcClientStartedRpcs(), 1}},
+                                parent_->StatsTags(context_, absl::nullopt));
   }
 }
 
@@ -191,21 +189,10 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
     return;
   }
   if (OpenCensusStatsEnabled()) {
-    uint64_t elapsed_time = 0;
-    FilterTrailingMetadata(recv_trailing_metadata, &elapsed_time);
-    std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-        context_.tags().tags();
-    tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-    std::string final_status = absl::StatusCodeToString(status_code_);
-    tags.emplace_back(ClientStatusTagKey(), final_status);
-    ::opencensus::stats::Record(
-        {{RpcClientSentBytesPerRpc(),
-          static_cast<double>(transport_stream_stats->outgoing.data_bytes)},
-         {RpcClientReceivedBytesPerRpc(),
-          static_cast<double>(transport_stream_stats->incoming.data_bytes)},
-         {RpcClientServerLatency(),
-          ToDoubleMilliseconds(absl::Nanoseconds(elapsed_time))}},
-        tags);
+    FilterTrailingMetadata(recv_trailing_metadata, &server_elapsed_ns_);
+    has_transport_stats_ = true;
+    sent_bytes_ = transport_stream_stats->outgoing.data_bytes;
+    received_bytes_ = transport_stream_stats->incoming.data_bytes;
   }
 }
 
@@ -214,19 +201,40 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordCancel(
   status_code_ = absl::StatusCode::kCancelled;
 }
 
+void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordResourceUsage(
+    const gpr_timespec& cpu_time, size_t arena_bytes) {
+  cpu_time_ms_ = cpu_time.tv_sec * 1e3 + cpu_time.tv_nsec / 1e6;
+  arena_bytes_ = arena_bytes;
+}
+
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordEnd(
     const gpr_timespec& /*latency*/) {
   if (OpenCensusStatsEnabled()) {
     double latency_ms = absl::ToDoubleMilliseconds(absl::Now() - start_time_);
-    std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-        context_.tags().tags();
-    tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-    tags.emplace_back(ClientStatusTagKey(), StatusCodeToString(status_code_));
-    ::opencensus::stats::Record(
-        {{RpcClientRoundtripLatency(), latency_ms},
-         {RpcClientSentMessagesPerRpc(), sent_message_count_},
-         {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
-        tags);
+    // Everything measured for the attempt goes into a single Record() call,
+    // since each one takes opencensus' global lock.
+    if (has_transport_stats_) {
+      ::opencensus::stats::Record(
+          {{RpcClientRoundtripLatency(), latency_ms},
+           {RpcClientSentMessagesPerRpc(), sent_message_count_},
+           {RpcClientReceivedMessagesPerRpc(), recv_message_count_},
+           {RpcClientCpuTimePerRpc(), cpu_time_ms_},
+           {RpcClientArenaBytesPerRpc(), arena_bytes_},
+           {RpcClientSentBytesPerRpc(), static_cast<double>(sent_bytes_)},
+           {RpcClientReceivedBytesPerRpc(),
+            static_cast<double>(received_bytes_)},
+           {RpcClientServerLatency(),
+            ToDoubleMilliseconds(absl::Nanoseconds(server_elapsed_ns_))}},
+          parent_->StatsTags(context_, status_code_));
+    } else {
+      ::opencensus::stats::Record(
+          {{RpcClientRoundtripLatency(), latency_ms},
+           {RpcClientSentMessagesPerRpc(), sent_message_count_},
+           {RpcClientReceivedMessagesPerRpc(), recv_message_count_},
+           {RpcClientCpuTimePerRpc(), cpu_time_ms_},
+           {RpcClientArenaBytesPerRpc(), arena_bytes_}},
+          parent_->StatsTags(context_, status_code_));
+    }
     grpc_core::MutexLock lock(&parent_->mu_);
     if (--parent_->num_active_rpcs_ == 0) {
       parent_->time_at_last_attempt_end_ = absl::Now();
@@ -256,18 +264,19 @@ OpenCensusCallTracer::OpenCensusCallTracer(const grpc_call_element_args* args,
       path_(grpc_slice_ref(args->path)),
       method_(GetMethod(path_)),
       arena_(args->arena),
-      tracing_enabled_(tracing_enabled) {}
+      tracing_enabled_(tracing_enabled) {
+  if (OpenCensusStatsEnabled()) {
+    method_tags_ = MethodTagsCache::Client().Get(method_);
+  }
+}
 
 OpenCensusCallTracer::~OpenCensusCallTracer() {
-  std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-      context_.tags().tags();
   if (OpenCensusStatsEnabled()) {
-    tags.emplace_back(ClientMethodTagKey(), std::string(method_));
     ::opencensus::stats::Record(
         {{RpcClientRetriesPerCall(), retries_ - 1},  // exclude first attempt
          {RpcClientTransparentRetriesPerCall(), transparent_retries_},
          {RpcClientRetryDelayPerCall(), ToDoubleMilliseconds(retry_delay_)}},
-        tags);
+        StatsTags(context_, absl::nullopt));
   }
   if (OpenCensusTracingEnabled() && tracing_enabled_) {
     context_.EndSpan();
@@ -312,6 +321,23 @@ OpenCensusCallTracer::StartNewAttempt(bool is_transparent_retry) {
       this, attempt_num, is_transparent_retry, false /* arena_allocated */);
 }
 
+opencensus::tags::TagMap OpenCensusCallTracer::StatsTags(
+    const experimental::CensusContext& context,
+    absl::optional<absl::StatusCode> status) const {
+  if (method_tags_ != nullptr && context.tags().tags().empty()) {
+    if (!status.has_value()) return method_tags_->method();
+    return method_tags_->method_and_status(
+        static_cast<grpc_status_code>(*status));
+  }
+  std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
+      context.tags().tags();
+  tags.emplace_back(ClientMethodTagKey(), std::string(method_));
+  if (status.has_value()) {
+    tags.emplace_back(ClientStatusTagKey(), StatusCodeToString(*status));
+  }
+  return opencensus::tags::TagMap(std::move(tags));
+}
+
 CensusContext OpenCensusCallTracer::CreateCensusContextForCallAttempt() {
   if (!OpenCensusTracingEnabled() || !tracing_enabled_) return CensusContext();
   GPR_DEBUG_ASSERT(context_.Context().IsValid());
@@ -21,6 +21,9 @@
 #include "src/cpp/ext/filters/census/context.h"
 
 #include <new>
+#include <utility>
+
+#include "absl/hash/hash.h"
 
 #include "opencensus/tags/context_util.h"
 #include "opencensus/tags/tag_map.h"
@@ -28,6 +31,7 @@
 #include "opencensus/trace/propagation/grpc_trace_bin.h"
 
 #include "src/core/lib/transport/transport.h"
+#include "src/cpp/ext/filters/census/grpc_plugin.h"
 #include "src/cpp/ext/filters/census/rpc_encoding.h"
 
 namespace grpc {
@@ -160,4 +164,51 @@ absl::string_view StatusCodeToString(grpc_status_code code) {
   }
 }
 
+MethodTagsCache::MethodTags::MethodTags(
+    const opencensus::tags::TagKey& method_key,
+    const opencensus::tags::TagKey& status_key, absl::string_view method)
+    : method_({{method_key, method}}) {
+  for (int code = GRPC_STATUS_OK; code <= GRPC_STATUS_UNAUTHENTICATED;
+       ++code) {
+    method_and_status_.emplace_back(TagMap(
+        {{method_key, method},
+         {status_key,
+          StatusCodeToString(static_cast<grpc_status_code>(code))}}));
+  }
+}
+
+const TagMap& MethodTagsCache::MethodTags::method_and_status(
+    grpc_status_code code) const {
+  if (code < GRPC_STATUS_OK ||
+      static_cast<size_t>(code) >= method_and_status_.size()) {
+    code = GRPC_STATUS_UNKNOWN;
+  }
+  return method_and_status_[code];
+}
+
+MethodTagsCache& MethodTagsCache::Client() {
+  static MethodTagsCache* cache =
+      new MethodTagsCache(ClientMethodTagKey(), ClientStatusTagKey());
+  return *cache;
+}
+
+MethodTagsCache& MethodTagsCache::Server() {
+  static MethodTagsCache* cache =
+      new MethodTagsCache(ServerMethodTagKey(), ServerStatusTagKey());
+  return *cache;
+}
+
+const MethodTagsCache::MethodTags* MethodTagsCache::Get(
+    absl::string_view method) {
+  Shard& shard = shards_[absl::Hash<absl::string_view>()(method) % kNumShards];
+  grpc_core::MutexLock lock(&shard.mu);
+  auto it = shard.methods.find(method);
+  if (it != shard.methods.end()) return it->second.get();
+  if (shard.methods.size() >= kMaxMethodsPerShard) return nullptr;
+  auto tags = std::make_unique<MethodTags>(method_key_, status_key_, method);
+  const MethodTags* result = tags.get();
+  shard.methods.emplace(std::string(method), std::move(tags));
+  return result;
+}
+
 }  // namespace grpc
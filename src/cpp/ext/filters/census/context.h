@@ -24,8 +24,17 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "opencensus/tags/tag_key.h"
+#include "opencensus/tags/tag_map.h"
 #include "opencensus/trace/span.h"
 #include "opencensus/trace/span_context.h"
 
@@ -35,6 +44,7 @@
 #include <grpcpp/opencensus.h>
 
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice.h"
 
 namespace grpc {
@@ -96,6 +106,57 @@ inline absl::string_view GetMethod(const grpc_core::Slice& path) {
   return absl::StripPrefix(path.as_string_view(), "/");
 }
 
+// Tag maps for the stats the census filters record, built the first time a
+// method is seen. Calls whose census context carries no tags of its own can
+// then hand a ready-made TagMap to opencensus::stats::Record() instead of
+// assembling and sorting a new tag vector for every record.
+class MethodTagsCache {
+ public:
+  class MethodTags {
+   public:
+    MethodTags(const opencensus::tags::TagKey& method_key,
+               const opencensus::tags::TagKey& status_key,
+               absl::string_view method);
+
+    // {method_key: method}
+    const opencensus::tags::TagMap& method() const { return method_; }
+    // {method_key: method, status_key: StatusCodeToString(code)}
+    const opencensus::tags::TagMap& method_and_status(
+        grpc_status_code code) const;
+
+   private:
+    opencensus::tags::TagMap method_;
+    std::vector<opencensus::tags::TagMap> method_and_status_;
+  };
+
+  // Caches for the client and server filters respectively.
+  static MethodTagsCache& Client();
+  static MethodTagsCache& Server();
+
+  // Returns the tags for \a method, which stay valid for the lifetime of the
+  // process. Returns nullptr if the cache is full, which keeps a peer sending
+  // arbitrary method names from growing it without bound.
+  const MethodTags* Get(absl::string_view method);
+
+ private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kMaxMethodsPerShard = 64;
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    std::map<std::string, std::unique_ptr<MethodTags>, std::less<>> methods
+        ABSL_GUARDED_BY(mu);
+  };
+
+  MethodTagsCache(opencensus::tags::TagKey method_key,
+                  opencensus::tags::TagKey status_key)
+      : method_key_(method_key), status_key_(status_key) {}
+
+  const opencensus::tags::TagKey method_key_;
+  const opencensus::tags::TagKey status_key_;
+  Shard shards_[kNumShards];
+};
+
 }  // namespace grpc
 
 #endif /* GRPC_INTERNAL_CPP_EXT_FILTERS_CENSUS_CONTEXT_H */
@@ -62,6 +62,8 @@ void RegisterOpenCensusPlugin() {
   RpcClientRetriesPerCall();
   RpcClientTransparentRetriesPerCall();
   RpcClientRetryDelayPerCall();
+  RpcClientCpuTimePerRpc();
+  RpcClientArenaBytesPerRpc();
 
   RpcServerSentBytesPerRpc();
   RpcServerReceivedBytesPerRpc();
@@ -144,6 +146,12 @@ ABSL_CONST_INIT const absl::string_view
 ABSL_CONST_INIT const absl::string_view kRpcClientRetryDelayPerCallMeasureName =
     "grpc.io/client/retry_delay_per_call";
 
+ABSL_CONST_INIT const absl::string_view kRpcClientCpuTimePerRpcMeasureName =
+    "grpc.io/client/cpu_time_per_rpc";
+
+ABSL_CONST_INIT const absl::string_view kRpcClientArenaBytesPerRpcMeasureName =
+    "grpc.io/client/arena_bytes_per_rpc";
+
 // Server
 ABSL_CONST_INIT const absl::string_view
     kRpcServerSentMessagesPerRpcMeasureName =
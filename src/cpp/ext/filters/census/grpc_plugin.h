@@ -32,6 +32,8 @@ using experimental::ClientStatusTagKey;  // NOLINT
 using experimental::ServerMethodTagKey;  // NOLINT
 using experimental::ServerStatusTagKey;  // NOLINT
 
+using experimental::kRpcClientArenaBytesPerRpcMeasureName;           // NOLINT
+using experimental::kRpcClientCpuTimePerRpcMeasureName;              // NOLINT
 using experimental::kRpcClientReceivedBytesPerRpcMeasureName;        // NOLINT
 using experimental::kRpcClientReceivedMessagesPerRpcMeasureName;     // NOLINT
 using experimental::kRpcClientRetriesPerCallMeasureName;             // NOLINT
@@ -50,7 +52,9 @@ using experimental::kRpcServerSentMessagesPerRpcMeasureName;      // NOLINT
 using experimental::kRpcServerServerLatencyMeasureName;           // NOLINT
 using experimental::kRpcServerStartedRpcsMeasureName;             // NOLINT
 
+using experimental::ClientArenaBytesPerRpcCumulative;           // NOLINT
 using experimental::ClientCompletedRpcsCumulative;              // NOLINT
+using experimental::ClientCpuTimePerRpcCumulative;              // NOLINT
 using experimental::ClientReceivedBytesPerRpcCumulative;        // NOLINT
 using experimental::ClientReceivedMessagesPerRpcCumulative;     // NOLINT
 using experimental::ClientRetriesCumulative;                    // NOLINT
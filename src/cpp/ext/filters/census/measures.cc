@@ -124,6 +124,22 @@ MeasureDouble RpcClientRetryDelayPerCall() {
   return measure;
 }
 
+MeasureDouble RpcClientCpuTimePerRpc() {
+  static const auto measure = MeasureDouble::Register(
+      experimental::kRpcClientCpuTimePerRpcMeasureName,
+      "Thread CPU time spent by gRPC starting the operations of an RPC "
+      "attempt and running their completion callbacks",
+      kUnitMilliseconds);
+  return measure;
+}
+
+MeasureInt64 RpcClientArenaBytesPerRpc() {
+  static const auto measure = MeasureInt64::Register(
+      experimental::kRpcClientArenaBytesPerRpcMeasureName,
+      "Bytes of per-call arena memory used by an RPC attempt", kUnitBytes);
+  return measure;
+}
+
 // Server
 MeasureDouble RpcServerSentBytesPerRpc() {
   static const auto measure = MeasureDouble::Register(
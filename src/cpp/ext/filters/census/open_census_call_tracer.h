@@ -27,6 +27,8 @@
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/time.h"
+#include "absl/types/optional.h"
+#include "opencensus/tags/tag_map.h"
 
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/support/atm.h>
@@ -42,6 +44,7 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/cpp/ext/filters/census/context.h"
 
 // TODO(yashykt): This might not be the right place for this channel arg, but we
 // don't have a better place for this right now.
@@ -80,6 +83,8 @@ class OpenCensusCallTracer : public grpc_core::CallTracer {
         absl::Status status, grpc_metadata_batch* recv_trailing_metadata,
         const grpc_transport_stream_stats* transport_stream_stats) override;
     void RecordCancel(grpc_error_handle cancel_error) override;
+    void RecordResourceUsage(const gpr_timespec& cpu_time,
+                             size_t arena_bytes) override;
     void RecordEnd(const gpr_timespec& /*latency*/) override;
 
     experimental::CensusContext* context() { return &context_; }
@@ -97,6 +102,15 @@ class OpenCensusCallTracer : public grpc_core::CallTracer {
     // Number of messages in this RPC.
     uint64_t recv_message_count_ = 0;
     uint64_t sent_message_count_ = 0;
+    // Resources used by this attempt, from RecordResourceUsage().
+    double cpu_time_ms_ = 0;
+    uint64_t arena_bytes_ = 0;
+    // Transport stats from RecordReceivedTrailingMetadata(), recorded
+    // together with the rest in RecordEnd().
+    bool has_transport_stats_ = false;
+    uint64_t sent_bytes_ = 0;
+    uint64_t received_bytes_ = 0;
+    uint64_t server_elapsed_ns_ = 0;
     // End status code
     absl::StatusCode status_code_;
   };
@@ -112,10 +126,18 @@ class OpenCensusCallTracer : public grpc_core::CallTracer {
  private:
   experimental::CensusContext CreateCensusContextForCallAttempt();
 
+  // Returns the tags to record stats for this call with: the tags of
+  // \a context plus the method and, if given, the status.
+  opencensus::tags::TagMap StatsTags(
+      const experimental::CensusContext& context,
+      absl::optional<absl::StatusCode> status) const;
+
   const grpc_call_context_element* call_context_;
   // Client method.
   grpc_core::Slice path_;
   absl::string_view method_;
+  // Prebuilt tags for method_, or nullptr if stats are disabled.
+  const MethodTagsCache::MethodTags* method_tags_ = nullptr;
   experimental::CensusContext context_;
   grpc_core::Arena* arena_;
   bool tracing_enabled_;
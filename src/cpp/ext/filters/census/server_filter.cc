@@ -30,6 +30,7 @@
 #include "absl/types/optional.h"
 #include "opencensus/stats/stats.h"
 #include "opencensus/tags/tag_key.h"
+#include "opencensus/tags/tag_map.h"
 
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
@@ -115,8 +116,14 @@ void CensusServerCallData::OnDoneRecvInitialMetadataCb(
           calld->gc_, reinterpret_cast<census_context*>(&calld->context_));
     }
     if (OpenCensusStatsEnabled()) {
-      ::opencensus::stats::Record({{RpcServerStartedRpcs(), 1}},
-                                  {{ServerMethodTagKey(), calld->method_}});
+      calld->method_tags_ = MethodTagsCache::Server().Get(calld->method_);
+      if (calld->method_tags_ != nullptr) {
+        ::opencensus::stats::Record({{RpcServerStartedRpcs(), 1}},
+                                    calld->method_tags_->method());
+      } else {
+        ::opencensus::stats::Record({{RpcServerStartedRpcs(), 1}},
+                                    {{ServerMethodTagKey(), calld->method_}});
+      }
     }
   }
   grpc_core::Closure::Run(DEBUG_LOCATION,
@@ -184,8 +191,12 @@ void CensusServerCallData::Destroy(grpc_call_element* /*elem*/,
          {RpcServerServerLatency(), elapsed_time_ms},
          {RpcServerSentMessagesPerRpc(), sent_message_count_},
          {RpcServerReceivedMessagesPerRpc(), recv_message_count_}},
-        {{ServerMethodTagKey(), method_},
-         {ServerStatusTagKey(), StatusCodeToString(final_info->final_status)}});
+        method_tags_ != nullptr
+            ? method_tags_->method_and_status(final_info->final_status)
+            : opencensus::tags::TagMap(
+                  {{ServerMethodTagKey(), method_},
+                   {ServerStatusTagKey(),
+                    StatusCodeToString(final_info->final_status)}}));
   }
   if (OpenCensusTracingEnabled()) {
     context_.EndSpan();
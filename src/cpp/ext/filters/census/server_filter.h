@@ -43,6 +43,7 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/cpp/common/channel_filter.h"
+#include "src/cpp/ext/filters/census/context.h"
 
 namespace grpc {
 
@@ -86,6 +87,9 @@ class CensusServerCallData : public CallData {
   experimental::CensusContext context_;
   // server method
   absl::string_view method_;
+  // Prebuilt tags for method_, or nullptr if stats are disabled or the cache
+  // is full.
+  const MethodTagsCache::MethodTags* method_tags_ = nullptr;
   std::string qualified_method_;
   grpc_core::Slice path_;
   // Pointer to the grpc_call element
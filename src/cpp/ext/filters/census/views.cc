@@ -220,6 +220,26 @@ const ViewDescriptor& ClientRetryDelayPerCallCumulative() {
   return descriptor;
 }
 
+const ViewDescriptor& ClientCpuTimePerRpcCumulative() {
+  const static ViewDescriptor descriptor =
+      ViewDescriptor()
+          .set_name("grpc.io/client/cpu_time_per_rpc/cumulative")
+          .set_measure(kRpcClientCpuTimePerRpcMeasureName)
+          .set_aggregation(MillisDistributionAggregation())
+          .add_column(ClientMethodTagKey());
+  return descriptor;
+}
+
+const ViewDescriptor& ClientArenaBytesPerRpcCumulative() {
+  const static ViewDescriptor descriptor =
+      ViewDescriptor()
+          .set_name("grpc.io/client/arena_bytes_per_rpc/cumulative")
+          .set_measure(kRpcClientArenaBytesPerRpcMeasureName)
+          .set_aggregation(BytesDistributionAggregation())
+          .add_column(ClientMethodTagKey());
+  return descriptor;
+}
+
 // server cumulative
 const ViewDescriptor& ServerSentBytesPerRpcCumulative() {
   const static ViewDescriptor descriptor =
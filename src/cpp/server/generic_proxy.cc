@@ -0,0 +1,227 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpcpp/generic/generic_proxy.h>
+
+#include <map>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/status.h>
+#include <grpcpp/support/string_ref.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc {
+namespace experimental {
+
+namespace {
+
+// Metadata that the transports generate themselves and that must not be
+// copied from one call to the other.
+bool IsReservedMetadata(grpc::string_ref key) {
+  absl::string_view k(key.data(), key.size());
+  return absl::StartsWith(k, "grpc-") || k == "user-agent" || k == "te" ||
+         k == "content-type";
+}
+
+// Ties the call from the caller (the server side of the proxy) to the call
+// to the backend (the client side). Messages flow in two pipelines:
+//
+//   upstream:   server read -> client write -> server read -> ...
+//   downstream: client read -> server write -> client read -> ...
+//
+// Each pipeline has at most one operation in flight, so a side that stops
+// reading stops the other side's reads too and flow control reaches the
+// original sender. The backend's status is passed on with Finish() from the
+// client side's OnDone(), which always runs before the server side's.
+//
+// The client side holds one hold per pipeline, so that OnDone() does not run
+// while a pipeline may still start an operation on it. The downstream hold
+// is released when the backend stops sending; the upstream one when the
+// caller stops sending or, if that comes first, when the backend is done, so
+// that a caller that keeps its side open does not hold up the status.
+class ProxyReactor : public ServerGenericBidiReactor {
+ public:
+  ProxyReactor(GenericCallbackServerContext* ctx, GenericStub* stub)
+      : ctx_(ctx), backend_(this) {
+    client_context_.set_deadline(ctx->raw_deadline());
+    for (const auto& md : ctx->client_metadata()) {
+      if (IsReservedMetadata(md.first)) continue;
+      client_context_.AddMetadata(std::string(md.first.data(), md.first.size()),
+                                  std::string(md.second.data(),
+                                              md.second.size()));
+    }
+    stub->PrepareBidiStreamingCall(&client_context_, ctx->method(),
+                                   StubOptions(), &backend_);
+    backend_.AddMultipleHolds(2);
+    backend_.StartCall();
+    StartRead(&upstream_message_);
+  }
+
+  // Caller to backend.
+  void OnReadDone(bool ok) override {
+    bool write = false;
+    bool release = false;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      if (!upstream_released_) {
+        if (ok) {
+          upstream_writing_ = true;
+          write = true;
+        } else {
+          // The caller half-closed or went away.
+          upstream_released_ = true;
+          release = true;
+        }
+      }
+    }
+    if (write) backend_.StartWrite(&upstream_message_);
+    if (release) {
+      backend_.StartWritesDone();
+      backend_.RemoveHold();
+    }
+  }
+
+  void OnUpstreamWriteDone(bool ok) {
+    bool release = false;
+    bool read_more = false;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      upstream_writing_ = false;
+      if (upstream_released_) {
+        // The backend finished while the write was in flight.
+        release = true;
+      } else if (!ok) {
+        upstream_released_ = true;
+        release = true;
+      } else {
+        read_more = true;
+      }
+    }
+    if (release) backend_.RemoveHold();
+    if (read_more) StartRead(&upstream_message_);
+  }
+
+  // Backend to caller.
+  void OnBackendInitialMetadataDone(bool ok) {
+    if (!ok) {
+      DownstreamDone();
+      return;
+    }
+    for (const auto& md : client_context_.GetServerInitialMetadata()) {
+      if (IsReservedMetadata(md.first)) continue;
+      ctx_->AddInitialMetadata(std::string(md.first.data(), md.first.size()),
+                               std::string(md.second.data(), md.second.size()));
+    }
+    StartSendInitialMetadata();
+    backend_.StartRead(&downstream_message_);
+  }
+
+  void OnBackendReadDone(bool ok) {
+    if (ok) {
+      StartWrite(&downstream_message_);
+    } else {
+      DownstreamDone();
+    }
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (ok) {
+      backend_.StartRead(&downstream_message_);
+    } else {
+      // The caller went away; OnCancel() cancels the backend call.
+      backend_.RemoveHold();
+    }
+  }
+
+  void OnBackendDone(const grpc::Status& status) {
+    for (const auto& md : client_context_.GetServerTrailingMetadata()) {
+      if (IsReservedMetadata(md.first)) continue;
+      ctx_->AddTrailingMetadata(
+          std::string(md.first.data(), md.first.size()),
+          std::string(md.second.data(), md.second.size()));
+    }
+    Finish(status);
+  }
+
+  void OnCancel() override { client_context_.TryCancel(); }
+
+  void OnDone() override { delete this; }
+
+ private:
+  class BackendReactor : public ClientBidiReactor<ByteBuffer, ByteBuffer> {
+   public:
+    explicit BackendReactor(ProxyReactor* proxy) : proxy_(proxy) {}
+
+    void OnReadInitialMetadataDone(bool ok) override {
+      proxy_->OnBackendInitialMetadataDone(ok);
+    }
+    void OnReadDone(bool ok) override { proxy_->OnBackendReadDone(ok); }
+    void OnWriteDone(bool ok) override { proxy_->OnUpstreamWriteDone(ok); }
+    void OnDone(const grpc::Status& s) override { proxy_->OnBackendDone(s); }
+
+   private:
+    ProxyReactor* const proxy_;
+  };
+
+  // The backend will not send anything more: release the downstream hold,
+  // and the upstream one unless a write is using it.
+  void DownstreamDone() {
+    bool release_upstream = false;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      if (!upstream_released_) {
+        upstream_released_ = true;
+        release_upstream = !upstream_writing_;
+      }
+    }
+    if (release_upstream) backend_.RemoveHold();
+    backend_.RemoveHold();
+  }
+
+  GenericCallbackServerContext* const ctx_;
+  ClientContext client_context_;
+  BackendReactor backend_;
+  ByteBuffer upstream_message_;
+  ByteBuffer downstream_message_;
+
+  grpc_core::Mutex mu_;
+  // Whether the upstream hold has been or is about to be released. No
+  // client write is started once it is set.
+  bool upstream_released_ ABSL_GUARDED_BY(mu_) = false;
+  // Whether a client write is in flight; its completion releases the
+  // upstream hold if the backend finished in the meantime.
+  bool upstream_writing_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+}  // namespace
+
+ServerGenericBidiReactor* CallbackGenericProxyService::CreateReactor(
+    GenericCallbackServerContext* ctx) {
+  return new ProxyReactor(ctx, &stub_);
+}
+
+}  // namespace experimental
+}  // namespace grpc
@@ -120,6 +120,9 @@ DefaultHealthCheckService::GetHealthCheckService() {
 
 void DefaultHealthCheckService::ServiceData::SetServingStatus(
     ServingStatus status) {
+  // Watchers are only told about changes, so repeatedly setting the same
+  // status does not cost a write on every open Watch stream.
+  if (status == status_) return;
   status_ = status;
   for (const auto& p : watchers_) {
     p.first->SendHealth(status);
@@ -148,6 +151,9 @@ const char kHealthWatchMethodName[] = "/grpc.health.v1.Health/Watch";
 DefaultHealthCheckService::HealthCheckServiceImpl::HealthCheckServiceImpl(
     DefaultHealthCheckService* database)
     : database_(database) {
+  for (ServingStatus status : {NOT_FOUND, SERVING, NOT_SERVING}) {
+    EncodeResponse(status, &encoded_responses_[status]);
+  }
   // Add Check() method.
   AddMethod(new internal::RpcServiceMethod(
       kHealthCheckMethodName, internal::RpcMethod::NORMAL_RPC, nullptr));
@@ -246,6 +252,15 @@ bool DefaultHealthCheckService::HealthCheckServiceImpl::EncodeResponse(
   return true;
 }
 
+bool DefaultHealthCheckService::HealthCheckServiceImpl::GetEncodedResponse(
+    ServingStatus status, ByteBuffer* response) const {
+  const ByteBuffer& encoded = encoded_responses_[status];
+  if (!encoded.Valid()) return false;
+  // Only takes a ref on the encoded slice.
+  *response = encoded;
+  return true;
+}
+
 //
 // DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor
 //
@@ -300,7 +315,7 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
     }
   }
   // Send response.
-  bool success = EncodeResponse(status, &response_);
+  bool success = service_->GetEncodedResponse(status, &response_);
   if (!success) {
     MaybeFinishLocked(
         Status(StatusCode::INTERNAL, "could not encode response"));
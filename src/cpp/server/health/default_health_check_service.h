@@ -93,7 +93,13 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
                               std::string* service_name);
     static bool EncodeResponse(ServingStatus status, ByteBuffer* response);
 
+    // Returns the response for \a status, which is encoded only once and
+    // then shared by all calls.  Returns false if it could not be encoded.
+    bool GetEncodedResponse(ServingStatus status, ByteBuffer* response) const;
+
     DefaultHealthCheckService* database_;
+    // Indexed by ServingStatus.
+    ByteBuffer encoded_responses_[3];
 
     grpc::internal::Mutex mu_;
     grpc::internal::CondVar shutdown_condition_;
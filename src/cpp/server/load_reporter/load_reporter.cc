@@ -406,6 +406,7 @@ void LoadReporter::ProcessViewDataCallStart(
     const CensusViewProvider::ViewDataMap& view_data_map) {
   auto it = view_data_map.find(kViewStartCount);
   if (it != view_data_map.end()) {
+    grpc_core::MutexLock lock(&store_mu_);
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const uint64_t start_count = static_cast<uint64_t>(p.second);
@@ -414,10 +415,7 @@ void LoadReporter::ProcessViewDataCallStart(
       const std::string& user_id = tag_values[2];
       LoadRecordKey key(client_ip_and_token, user_id);
       LoadRecordValue value = LoadRecordValue(start_count);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      load_data_store_.MergeRow(host, key, value);
     }
   }
 }
@@ -428,6 +426,7 @@ void LoadReporter::ProcessViewDataCallEnd(
   uint64_t total_error_count = 0;
   auto it = view_data_map.find(kViewEndCount);
   if (it != view_data_map.end()) {
+    grpc_core::MutexLock lock(&store_mu_);
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const uint64_t end_count = static_cast<uint64_t>(p.second);
@@ -466,10 +465,7 @@ void LoadReporter::ProcessViewDataCallEnd(
       }
       LoadRecordValue value = LoadRecordValue(
           0, ok_count, error_count, bytes_sent, bytes_received, latency_ms);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      load_data_store_.MergeRow(host, key, value);
     }
   }
   AppendNewFeedbackRecord(total_end_count, total_error_count);
@@ -479,6 +475,7 @@ void LoadReporter::ProcessViewDataOtherCallMetrics(
     const CensusViewProvider::ViewDataMap& view_data_map) {
   auto it = view_data_map.find(kViewOtherCallMetricCount);
   if (it != view_data_map.end()) {
+    grpc_core::MutexLock lock(&store_mu_);
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const int64_t num_calls = p.second;
@@ -493,10 +490,7 @@ void LoadReporter::ProcessViewDataOtherCallMetrics(
               sizeof(kViewOtherCallMetricValue) - 1, tag_values);
       LoadRecordValue value = LoadRecordValue(
           metric_name, static_cast<uint64_t>(num_calls), total_metric_value);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      load_data_store_.MergeRow(host, key, value);
     }
   }
 }
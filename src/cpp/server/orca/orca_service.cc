@@ -16,6 +16,8 @@
 
 #include <stddef.h>
 
+#include <cmath>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -45,6 +47,7 @@
 #include <grpcpp/support/status.h>
 
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -128,11 +131,31 @@ class OrcaService::Reactor : public ServerWriteReactor<ByteBuffer>,
     grpc::internal::MutexLock lock(&timer_mu_);
     if (cancelled_) return false;
     timer_handle_ = engine_->RunAfter(
-        report_interval_,
+        NextReportDelay(),
         [self = Ref(DEBUG_LOCATION, "Orca Service")] { self->OnTimer(); });
     return true;
   }
 
+  // Reports are due on ticks shared by all streams in the process, so that
+  // the timers of the streams with the same interval fire together instead of
+  // each waking up on its own. A tick is a tenth of the interval, up to a
+  // second, and the next report is due on the first tick at least one
+  // interval from now.
+  grpc_core::Duration NextReportDelay() const {
+    const int64_t tick =
+        grpc_core::Clamp<int64_t>(report_interval_.millis() / 10, 1, 1000);
+    const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+    const uint64_t due =
+        (now + report_interval_).milliseconds_after_process_epoch();
+    if (due > static_cast<uint64_t>(std::numeric_limits<int64_t>::max() -
+                                    tick)) {
+      return report_interval_;
+    }
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+               (due + tick - 1) / tick * tick) -
+           now;
+  }
+
   bool MaybeCancelTimer() {
     grpc::internal::MutexLock lock(&timer_mu_);
     cancelled_ = true;
@@ -203,6 +226,18 @@ void OrcaService::DeleteMemoryUtilization() {
   response_slice_.reset();
 }
 
+void OrcaService::SetQps(double qps) {
+  grpc::internal::MutexLock lock(&mu_);
+  qps_ = qps;
+  response_slice_.reset();
+}
+
+void OrcaService::DeleteQps() {
+  grpc::internal::MutexLock lock(&mu_);
+  qps_ = -1;
+  response_slice_.reset();
+}
+
 void OrcaService::SetNamedUtilization(std::string name, double utilization) {
   grpc::internal::MutexLock lock(&mu_);
   named_utilization_[std::move(name)] = utilization;
@@ -236,6 +271,10 @@ Slice OrcaService::GetOrCreateSerializedResponse() {
       xds_data_orca_v3_OrcaLoadReport_set_mem_utilization(response,
                                                           memory_utilization_);
     }
+    if (qps_ != -1) {
+      xds_data_orca_v3_OrcaLoadReport_set_rps(
+          response, static_cast<uint64_t>(std::llround(qps_)));
+    }
     for (const auto& p : named_utilization_) {
       xds_data_orca_v3_OrcaLoadReport_utilization_set(
           response,
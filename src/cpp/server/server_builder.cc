@@ -51,6 +51,7 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/cpp/server/external_connection_acceptor_impl.h"
+#include "src/cpp/thread_manager/thread_manager.h"
 
 namespace grpc {
 
@@ -181,6 +182,12 @@ ServerBuilder& ServerBuilder::SetSyncServerOption(
     case CQ_TIMEOUT_MSEC:
       sync_server_settings_.cq_timeout_msec = val;
       break;
+    case NUM_CPU_SHARDS:
+      sync_server_settings_.num_cpu_shards = val;
+      break;
+    case NUMA_AWARE:
+      sync_server_settings_.numa_aware = val != 0;
+      break;
   }
   return *this;
 }
@@ -333,6 +340,32 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     grpc_cq_polling_type polling_type =
         is_hybrid_server ? GRPC_CQ_NON_POLLING : GRPC_CQ_DEFAULT_POLLING;
 
+    if (sync_server_settings_.numa_aware &&
+        sync_server_settings_.num_cpu_shards <= 0) {
+      sync_server_settings_.num_cpu_shards =
+          static_cast<int>(ThreadManager::NumaNodeCpus().size());
+    }
+    if (sync_server_settings_.num_cpu_shards > 0) {
+      sync_server_settings_.num_cqs = sync_server_settings_.num_cpu_shards;
+      // The sync server completion queues are registered first, so their
+      // pollsets are the first ones the TCP server clones listeners for.
+      // Steer each connection to the shard that owns the CPU it arrived on,
+      // unless the application chose otherwise.
+      if (!is_hybrid_server && !sync_server_settings_.numa_aware) {
+        const grpc_channel_args c_args = args.c_channel_args();
+        bool steering_set = false;
+        for (size_t i = 0; i < c_args.num_args; i++) {
+          if (strcmp(c_args.args[i].key, GRPC_ARG_REUSEPORT_CPU_STEERING) ==
+              0) {
+            steering_set = true;
+          }
+        }
+        if (!steering_set) {
+          args.SetInt(GRPC_ARG_REUSEPORT_CPU_STEERING,
+                      sync_server_settings_.num_cpu_shards);
+        }
+      }
+    }
     // Create completion queues to listen to incoming rpc requests
     for (int i = 0; i < sync_server_settings_.num_cqs; i++) {
       sync_server_cqs->emplace_back(
@@ -370,6 +403,10 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
       std::move(acceptors_), server_config_fetcher_, resource_quota_,
       std::move(creators)));
 
+  if (has_sync_methods && sync_server_settings_.num_cpu_shards > 0) {
+    server->ShardSyncServerAcrossCpus(sync_server_settings_.numa_aware);
+  }
+
   ServerInitializer* initializer = server->initializer();
 
   // Register all the completion queues with the server. i.e
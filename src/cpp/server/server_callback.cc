@@ -19,6 +19,7 @@
 
 #include <grpcpp/support/server_callback.h>
 
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -27,8 +28,19 @@
 namespace grpc {
 namespace internal {
 
+namespace {
+
+// Whether a reaction that is not inlineable may still run on this thread
+// rather than on an executor thread.
+bool RunToCompletion() {
+  return grpc_core::IsCallbackRunToCompletionEnabled() &&
+         grpc_core::ApplicationCallbackExecCtx::Available();
+}
+
+}  // namespace
+
 void ServerCallbackCall::ScheduleOnDone(bool inline_ondone) {
-  if (inline_ondone) {
+  if (inline_ondone || non_blocking_reactions_ || RunToCompletion()) {
     CallOnDone();
   } else {
     // Unlike other uses of closure, do not Ref or Unref here since at this
@@ -54,7 +66,8 @@ void ServerCallbackCall::ScheduleOnDone(bool inline_ondone) {
 }
 
 void ServerCallbackCall::CallOnCancel(ServerReactor* reactor) {
-  if (reactor->InternalInlineable()) {
+  if (reactor->InternalInlineable() || non_blocking_reactions_ ||
+      RunToCompletion()) {
     reactor->OnCancel();
   } else {
     // Ref to make sure that the closure executes before the whole call gets
@@ -28,6 +28,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 
 #include <grpc/byte_buffer.h>
@@ -35,6 +36,7 @@
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/slice.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -287,6 +289,48 @@ bool ServerInterface::GenericAsyncRequest::FinalizeResult(void** tag,
 }
 
 namespace {
+// Keeps the memory of up to max_free CallbackRequest objects of one method
+// once their calls are done, so that the next calls to the method do not
+// need to allocate. Shared by the method's allocator and its requests.
+class CallbackRequestPool {
+ public:
+  CallbackRequestPool(size_t object_size, size_t max_free)
+      : object_size_(object_size), max_free_(max_free) {}
+
+  ~CallbackRequestPool() {
+    for (void* p : free_) ::operator delete(p);
+  }
+
+  void* Allocate() {
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (!free_.empty()) {
+        void* p = free_.back();
+        free_.pop_back();
+        return p;
+      }
+    }
+    return ::operator new(object_size_);
+  }
+
+  void Free(void* p) {
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (free_.size() < max_free_) {
+        free_.push_back(p);
+        return;
+      }
+    }
+    ::operator delete(p);
+  }
+
+ private:
+  const size_t object_size_;
+  const size_t max_free_;
+  grpc::internal::Mutex mu_;
+  std::vector<void*> free_ ABSL_GUARDED_BY(mu_);
+};
+
 class ShutdownCallback : public grpc_completion_queue_functor {
  public:
   ShutdownCallback() {
@@ -543,8 +587,10 @@ class Server::CallbackRequest final
   // is nullptr since these services don't have pre-defined methods.
   CallbackRequest(Server* server, grpc::internal::RpcServiceMethod* method,
                   grpc::CompletionQueue* cq,
-                  grpc_core::Server::RegisteredCallAllocation* data)
+                  grpc_core::Server::RegisteredCallAllocation* data,
+                  std::shared_ptr<CallbackRequestPool> pool)
       : server_(server),
+        pool_(std::move(pool)),
         method_(method),
         has_request_payload_(method->method_type() ==
                                  grpc::internal::RpcMethod::NORMAL_RPC ||
@@ -563,8 +609,10 @@ class Server::CallbackRequest final
   // For generic services, method is nullptr since these services don't have
   // pre-defined methods.
   CallbackRequest(Server* server, grpc::CompletionQueue* cq,
-                  grpc_core::Server::BatchCallAllocation* data)
+                  grpc_core::Server::BatchCallAllocation* data,
+                  std::shared_ptr<CallbackRequestPool> pool)
       : server_(server),
+        pool_(std::move(pool)),
         method_(nullptr),
         has_request_payload_(false),
         call_details_(new grpc_call_details),
@@ -591,6 +639,25 @@ class Server::CallbackRequest final
     server_->UnrefWithPossibleNotify();
   }
 
+  // Creates a request in memory from pool.
+  template <class... Args>
+  static CallbackRequest* Create(std::shared_ptr<CallbackRequestPool> pool,
+                                 Args&&... args) {
+    void* storage = pool->Allocate();
+    return new (storage)
+        CallbackRequest(std::forward<Args>(args)..., std::move(pool));
+  }
+
+  // Destroys the request and returns its memory to its pool. Used instead of
+  // delete.
+  void Destroy() {
+    // The pool must outlive the destructor, which may drop the last ref to
+    // the server.
+    std::shared_ptr<CallbackRequestPool> pool = std::move(pool_);
+    this->~CallbackRequest();
+    pool->Free(this);
+  }
+
   // Needs specialization to account for different processing of metadata
   // in generic API
   bool FinalizeResult(void** tag, bool* status) override;
@@ -634,7 +701,7 @@ class Server::CallbackRequest final
       if (!ok) {
         // The call has been shutdown.
         // Delete its contents to free up the request.
-        delete req_;
+        req_->Destroy();
         return;
       }
 
@@ -643,6 +710,8 @@ class Server::CallbackRequest final
       req_->ctx_->cq_ = req_->cq_;
       req_->ctx_->BindDeadlineAndMetadata(req_->deadline_,
                                           &req_->request_metadata_);
+      req_->ctx_->callback_reactors_non_blocking_ =
+          req_->server_->callback_reactors_non_blocking_;
       req_->request_metadata_.count = 0;
 
       // Create a C++ Call to control the underlying core call
@@ -695,7 +764,7 @@ class Server::CallbackRequest final
                           : req_->server_->generic_handler_.get();
       handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
           call_, req_->ctx_, req_->request_, req_->request_status_,
-          req_->handler_data_, [this] { delete req_; }));
+          req_->handler_data_, [this] { req_->Destroy(); }));
     }
   };
 
@@ -716,6 +785,7 @@ class Server::CallbackRequest final
   }
 
   Server* const server_;
+  std::shared_ptr<CallbackRequestPool> pool_;
   grpc::internal::RpcServiceMethod* const method_;
   const bool has_request_payload_;
   grpc_byte_buffer* request_payload_ = nullptr;
@@ -940,6 +1010,16 @@ Server::Server(
         strcmp(channel_args.args[i].key, GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)) {
       max_receive_message_size_ = channel_args.args[i].value.integer;
     }
+    if (0 == strcmp(channel_args.args[i].key,
+                    GRPC_ARG_CALLBACK_REQUEST_POOL_SIZE)) {
+      callback_request_pool_size_ =
+          std::max(channel_args.args[i].value.integer, 0);
+    }
+    if (0 == strcmp(channel_args.args[i].key,
+                    GRPC_ARG_CALLBACK_REACTORS_NON_BLOCKING)) {
+      callback_reactors_non_blocking_ =
+          channel_args.args[i].value.integer != 0;
+    }
   }
   server_ = grpc_server_create(&channel_args, nullptr);
   grpc_server_set_config_fetcher(server_, server_config_fetcher);
@@ -1055,11 +1135,15 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
       grpc::internal::RpcServiceMethod* method_value = method.get();
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
+      auto pool = std::make_shared<CallbackRequestPool>(
+          sizeof(CallbackRequest<grpc::CallbackServerContext>),
+          callback_request_pool_size_);
       grpc_core::Server::FromC(server_)->SetRegisteredMethodAllocator(
-          cq->cq(), method_registration_tag, [this, cq, method_value] {
+          cq->cq(), method_registration_tag,
+          [this, cq, method_value, pool = std::move(pool)] {
             grpc_core::Server::RegisteredCallAllocation result;
-            new CallbackRequest<grpc::CallbackServerContext>(this, method_value,
-                                                             cq, &result);
+            CallbackRequest<grpc::CallbackServerContext>::Create(
+                pool, this, method_value, cq, &result);
             return result;
           });
     }
@@ -1096,12 +1180,16 @@ void Server::RegisterCallbackGenericService(
   generic_handler_.reset(service->Handler());
 
   grpc::CompletionQueue* cq = CallbackCQ();
-  grpc_core::Server::FromC(server_)->SetBatchMethodAllocator(cq->cq(), [this,
-                                                                        cq] {
-    grpc_core::Server::BatchCallAllocation result;
-    new CallbackRequest<grpc::GenericCallbackServerContext>(this, cq, &result);
-    return result;
-  });
+  auto pool = std::make_shared<CallbackRequestPool>(
+      sizeof(CallbackRequest<grpc::GenericCallbackServerContext>),
+      callback_request_pool_size_);
+  grpc_core::Server::FromC(server_)->SetBatchMethodAllocator(
+      cq->cq(), [this, cq, pool = std::move(pool)] {
+        grpc_core::Server::BatchCallAllocation result;
+        CallbackRequest<grpc::GenericCallbackServerContext>::Create(
+            pool, this, cq, &result);
+        return result;
+      });
 }
 
 int Server::AddListeningPort(const std::string& addr,
@@ -1219,6 +1307,42 @@ void Server::Start(grpc::ServerCompletionQueue** cqs, size_t num_cqs) {
   }
 }
 
+void Server::ShardSyncServerAcrossCpus(bool numa_aware) {
+  const int num_shards = static_cast<int>(sync_req_mgrs_.size());
+  if (num_shards == 0) return;
+  std::vector<std::vector<int>> nodes;
+  if (numa_aware) {
+    nodes = ThreadManager::NumaNodeCpus();
+  } else {
+    nodes.emplace_back();
+    for (unsigned cpu = 0; cpu < gpr_cpu_num_cores(); cpu++) {
+      nodes.back().push_back(static_cast<int>(cpu));
+    }
+  }
+  const int num_nodes = static_cast<int>(nodes.size());
+  for (int shard = 0; shard < num_shards; shard++) {
+    // Neighbouring shards go to different nodes, so that the listeners the
+    // TCP server clones for each completion queue are spread over the nodes
+    // too. Within a node, shards get contiguous CPU ranges, so that a shard
+    // tends to stay within one cache domain. The ranges are those
+    // GRPC_ARG_REUSEPORT_CPU_STEERING steers connections by. With more
+    // shards than CPUs, shards share CPUs round-robin.
+    const std::vector<int>& node_cpus = nodes[shard % num_nodes];
+    const int num_cpus = static_cast<int>(node_cpus.size());
+    const int node_shard = shard / num_nodes;
+    const int node_shards = (num_shards - shard % num_nodes + num_nodes - 1) /
+                            num_nodes;
+    std::vector<int> cpus;
+    for (int i = 0; i < num_cpus; i++) {
+      if (i * node_shards / num_cpus == node_shard) {
+        cpus.push_back(node_cpus[i]);
+      }
+    }
+    if (cpus.empty()) cpus.push_back(node_cpus[node_shard % num_cpus]);
+    sync_req_mgrs_[shard]->SetCpuAffinity(std::move(cpus));
+  }
+}
+
 void Server::ShutdownInternal(gpr_timespec deadline) {
   grpc::internal::MutexLock lock(&mu_);
   if (shutdown_) {
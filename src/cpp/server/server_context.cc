@@ -55,11 +55,13 @@
 #include <grpcpp/support/server_callback.h>
 #include <grpcpp/support/server_interceptor.h>
 #include <grpcpp/support/string_ref.h>
+#include <grpcpp/support/tcp_tracer.h>
 
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/surface/call.h"
+#include "src/cpp/common/tcp_tracer.h"
 
 namespace grpc {
 
@@ -415,4 +417,9 @@ grpc::string_ref ServerContextBase::ExperimentalGetAuthority() const {
   return grpc::string_ref(authority.data(), authority.size());
 }
 
+void ServerContextBase::ExperimentalSetTcpTracer(
+    std::shared_ptr<grpc::experimental::TcpTracer> tracer) {
+  internal::SetTcpTracer(call_.call, std::move(tracer));
+}
+
 }  // namespace grpc
@@ -21,7 +21,21 @@
 #include <stdlib.h>
 
 #include <climits>
+#include <fstream>
+#include <string>
+#include <utility>
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -30,6 +44,34 @@
 
 namespace grpc {
 
+namespace {
+
+void PinCurrentThreadToCpus(const std::vector<int>& cpus) {
+  if (cpus.empty()) return;
+#ifdef GPR_LINUX
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) CPU_SET(cpu, &cpu_set);
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (err != 0) {
+    gpr_log(GPR_ERROR, "Could not set grpcpp_sync_server thread affinity: %d",
+            err);
+  }
+#endif
+}
+
+#ifdef GPR_LINUX
+// Reads a CPU or node list file from sysfs, as parsed by ParseCpuList.
+std::vector<int> ReadSysfsList(const std::string& path) {
+  std::ifstream file(path);
+  std::string contents;
+  if (!std::getline(file, contents)) return {};
+  return ThreadManager::ParseCpuList(contents);
+}
+#endif
+
+}  // namespace
+
 ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
     : thd_mgr_(thd_mgr) {
   // Make thread creation exclusive with respect to its join happening in
@@ -44,6 +86,7 @@ ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
 }
 
 void ThreadManager::WorkerThread::Run() {
+  PinCurrentThreadToCpus(thd_mgr_->cpu_affinity_);
   thd_mgr_->MainWorkLoop();
   thd_mgr_->MarkAsCompleted(this);
 }
@@ -73,6 +116,50 @@ ThreadManager::~ThreadManager() {
   CleanupCompletedThreads();
 }
 
+void ThreadManager::SetCpuAffinity(std::vector<int> cpus) {
+  cpu_affinity_ = std::move(cpus);
+}
+
+std::vector<std::vector<int>> ThreadManager::NumaNodeCpus() {
+  std::vector<std::vector<int>> nodes;
+#ifdef GPR_LINUX
+  for (int node : ReadSysfsList("/sys/devices/system/node/online")) {
+    std::vector<int> cpus = ReadSysfsList(
+        absl::StrCat("/sys/devices/system/node/node", node, "/cpulist"));
+    // Memory-only nodes have no CPUs to run threads on.
+    if (!cpus.empty()) nodes.push_back(std::move(cpus));
+  }
+#endif
+  if (nodes.empty()) {
+    std::vector<int> cpus;
+    for (unsigned cpu = 0; cpu < gpr_cpu_num_cores(); cpu++) {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+    nodes.push_back(std::move(cpus));
+  }
+  return nodes;
+}
+
+std::vector<int> ThreadManager::ParseCpuList(absl::string_view list) {
+  std::vector<int> cpus;
+  list = absl::StripTrailingAsciiWhitespace(list);
+  if (list.empty()) return cpus;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(bounds.first, &first)) return {};
+    if (range.find('-') == absl::string_view::npos) {
+      last = first;
+    } else if (!absl::SimpleAtoi(bounds.second, &last) || last < first) {
+      return {};
+    }
+    for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
 void ThreadManager::Wait() {
   grpc_core::MutexLock lock(&mu_);
   while (num_threads_ != 0) {
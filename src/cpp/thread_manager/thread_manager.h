@@ -20,6 +20,9 @@
 #define GRPC_INTERNAL_CPP_THREAD_MANAGER_H
 
 #include <list>
+#include <vector>
+
+#include "absl/strings/string_view.h"
 
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
@@ -34,6 +37,19 @@ class ThreadManager {
                          int min_pollers, int max_pollers);
   virtual ~ThreadManager();
 
+  // Restricts the threads of this ThreadManager to the given CPUs. Must be
+  // called before Initialize(). Ignored on platforms without thread affinity
+  // support.
+  void SetCpuAffinity(std::vector<int> cpus);
+
+  // Returns the CPUs of each NUMA node, in node order. Where the topology is
+  // not known, all CPUs are reported as a single node.
+  static std::vector<std::vector<int>> NumaNodeCpus();
+
+  // Parses a Linux CPU list such as "0-3,8,10-11". Returns an empty vector if
+  // the list is malformed.
+  static std::vector<int> ParseCpuList(absl::string_view list);
+
   // Initializes and Starts the Rpc Manager threads
   void Initialize();
 
@@ -172,6 +188,10 @@ class ThreadManager {
 
   grpc_core::Mutex list_mu_;
   std::list<WorkerThread*> completed_threads_;
+
+  // CPUs that worker threads are pinned to; empty means no pinning. Only set
+  // before any threads start.
+  std::vector<int> cpu_affinity_;
 };
 
 }  // namespace grpc
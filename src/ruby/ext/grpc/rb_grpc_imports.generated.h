@@ -116,6 +116,9 @@ extern grpc_completion_queue_create_type grpc_completion_queue_create_import;
 typedef grpc_event(*grpc_completion_queue_next_type)(grpc_completion_queue* cq, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_next_type grpc_completion_queue_next_import;
 #define grpc_completion_queue_next grpc_completion_queue_next_import
+typedef size_t(*grpc_completion_queue_next_batch_type)(grpc_completion_queue* cq, grpc_event* events, size_t max_events, gpr_timespec deadline, void* reserved);
+extern grpc_completion_queue_next_batch_type grpc_completion_queue_next_batch_import;
+#define grpc_completion_queue_next_batch grpc_completion_queue_next_batch_import
 typedef grpc_event(*grpc_completion_queue_pluck_type)(grpc_completion_queue* cq, void* tag, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_pluck_type grpc_completion_queue_pluck_import;
 #define grpc_completion_queue_pluck grpc_completion_queue_pluck_import
@@ -200,6 +203,9 @@ extern grpc_call_cancel_with_status_type grpc_call_cancel_with_status_import;
 typedef int(*grpc_call_failed_before_recv_message_type)(const grpc_call* c);
 extern grpc_call_failed_before_recv_message_type grpc_call_failed_before_recv_message_import;
 #define grpc_call_failed_before_recv_message grpc_call_failed_before_recv_message_import
+typedef int(*grpc_call_recv_message_is_partial_type)(const grpc_call* c);
+extern grpc_call_recv_message_is_partial_type grpc_call_recv_message_is_partial_import;
+#define grpc_call_recv_message_is_partial grpc_call_recv_message_is_partial_import
 typedef void(*grpc_call_ref_type)(grpc_call* call);
 extern grpc_call_ref_type grpc_call_ref_import;
 #define grpc_call_ref grpc_call_ref_import
@@ -503,6 +509,9 @@ extern grpc_tls_credentials_options_set_cert_request_type_type grpc_tls_credenti
 typedef void(*grpc_tls_credentials_options_set_crl_directory_type)(grpc_tls_credentials_options* options, const char* crl_directory);
 extern grpc_tls_credentials_options_set_crl_directory_type grpc_tls_credentials_options_set_crl_directory_import;
 #define grpc_tls_credentials_options_set_crl_directory grpc_tls_credentials_options_set_crl_directory_import
+typedef void(*grpc_tls_credentials_options_set_verification_cache_size_type)(grpc_tls_credentials_options* options, size_t verification_cache_size);
+extern grpc_tls_credentials_options_set_verification_cache_size_type grpc_tls_credentials_options_set_verification_cache_size_import;
+#define grpc_tls_credentials_options_set_verification_cache_size grpc_tls_credentials_options_set_verification_cache_size_import
 typedef void(*grpc_tls_credentials_options_set_verify_server_cert_type)(grpc_tls_credentials_options* options, int verify_server_cert);
 extern grpc_tls_credentials_options_set_verify_server_cert_type grpc_tls_credentials_options_set_verify_server_cert_import;
 #define grpc_tls_credentials_options_set_verify_server_cert grpc_tls_credentials_options_set_verify_server_cert_import
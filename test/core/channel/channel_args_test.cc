@@ -73,6 +73,20 @@ TEST(ChannelArgsTest, SetGetRemove) {
   gpr_free(ptr);
 }
 
+TEST(ChannelArgsTest, HashIgnoresInsertionOrder) {
+  ChannelArgs a = ChannelArgs().Set("a", 1).Set("b", "two").Set("c", 3);
+  ChannelArgs b = ChannelArgs().Set("c", 3).Set("a", 1).Set("b", "two");
+  EXPECT_EQ(a.Hash(), b.Hash());
+  EXPECT_EQ(a, b);
+  ChannelArgs c = b.Set("c", 4);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(c.Set("c", 3).Hash(), a.Hash());
+  EXPECT_EQ(a.Remove("b").Set("b", "two").Hash(), a.Hash());
+  EXPECT_EQ(ChannelArgs().Set("a", 1).Remove("a").Hash(),
+            ChannelArgs().Hash());
+  EXPECT_EQ(a.UnionWith(ChannelArgs().Set("d", 5)), a.Set("d", 5));
+}
+
 TEST(ChannelArgsTest, StoreRefCountedPtr) {
   struct Test : public RefCounted<Test> {
     explicit Test(int n) : n(n) {}
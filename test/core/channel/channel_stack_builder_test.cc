@@ -22,20 +22,27 @@
 #include <string.h>
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
 #include <grpc/grpc_security.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/surface/channel_init.h"
+#include "src/core/lib/transport/transport.h"
 #include "test/core/util/test_config.h"
 
 namespace grpc_core {
@@ -118,6 +125,60 @@ bool AddOriginalFilter(ChannelStackBuilder* builder) {
   return true;
 }
 
+class PassThroughFilter : public ChannelFilter {
+ public:
+  static absl::StatusOr<PassThroughFilter> Create(
+      ChannelArgs /*args*/, ChannelFilter::Args /*filter_args*/) {
+    return PassThroughFilter();
+  }
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override {
+    return next_promise_factory(std::move(call_args));
+  }
+};
+
+const grpc_channel_filter pass_through_a =
+    MakePromiseBasedFilter<PassThroughFilter, FilterEndpoint::kClient>(
+        "pass_through_a");
+const grpc_channel_filter pass_through_b =
+    MakePromiseBasedFilter<PassThroughFilter, FilterEndpoint::kClient,
+                           kFilterExaminesServerInitialMetadata>(
+        "pass_through_b");
+const grpc_channel_filter pass_through_c =
+    MakePromiseBasedFilter<PassThroughFilter, FilterEndpoint::kClient>(
+        "pass_through_c");
+
+TEST(ChannelStackBuilderTest, FusesAdjacentPromiseBasedFilters) {
+  auto fused = FusePromiseBasedFilters(
+      {&pass_through_a, &pass_through_b, &original_filter, &pass_through_c});
+  ASSERT_EQ(fused.size(), 3u);
+  EXPECT_STREQ(fused[0]->name, "fused(pass_through_a,pass_through_b)");
+  EXPECT_EQ(fused[1], &original_filter);
+  EXPECT_EQ(fused[2], &pass_through_c);
+  // The same run is always fused into the same filter.
+  EXPECT_EQ(FusePromiseBasedFilters({&pass_through_a, &pass_through_b})[0],
+            fused[0]);
+}
+
+TEST(ChannelStackBuilderTest, DoesNotFuseRepeatedFilters) {
+  std::vector<const grpc_channel_filter*> filters = {
+      &pass_through_a, &pass_through_b, &pass_through_a};
+  EXPECT_EQ(FusePromiseBasedFilters(filters), filters);
+}
+
+TEST(ChannelStackBuilderTest, CreatesChannelWithFusedFilters) {
+  grpc_arg arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_FUSE_PROMISE_FILTERS), 1);
+  grpc_channel_args args = {1, &arg};
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  grpc_channel* channel =
+      grpc_channel_create("target name isn't used", creds, &args);
+  grpc_channel_credentials_release(creds);
+  ASSERT_NE(channel, nullptr);
+  grpc_channel_destroy(channel);
+}
+
 TEST(ChannelStackBuilder, UnknownTarget) {
   ChannelStackBuilderImpl builder("alpha-beta-gamma", GRPC_CLIENT_CHANNEL,
                                   ChannelArgs());
@@ -21,6 +21,8 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <set>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -128,6 +130,33 @@ TEST_F(ChannelzRegistryTest, TestUnregistration) {
   }
 }
 
+TEST_F(ChannelzRegistryTest, ConcurrentRegistration) {
+  const int kThreads = 8;
+  const int kNodesPerThread = 100;
+  std::vector<std::vector<RefCountedPtr<BaseNode>>> nodes(kThreads);
+  std::vector<std::thread> threads;
+  threads.reserve(kThreads);
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&nodes, t]() {
+      for (int i = 0; i < kNodesPerThread; i++) {
+        nodes[t].push_back(CreateTestNode());
+        // Drop every other node again to exercise unregistration as well.
+        if (i % 2 == 1) nodes[t].pop_back();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::set<intptr_t> uuids;
+  for (const auto& thread_nodes : nodes) {
+    for (const auto& node : thread_nodes) {
+      EXPECT_TRUE(uuids.insert(node->uuid()).second)
+          << "Uuids must be unique";
+      EXPECT_EQ(ChannelzRegistry::Get(node->uuid()), node);
+    }
+  }
+  EXPECT_EQ(uuids.size(), static_cast<size_t>(kThreads * kNodesPerThread / 2));
+}
+
 }  // namespace testing
 }  // namespace channelz
 }  // namespace grpc_core
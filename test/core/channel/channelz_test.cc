@@ -22,6 +22,9 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -542,6 +545,88 @@ TEST_F(ChannelzRegistryBasedTest, ManyServersTest) {
   ValidateGetServers(10);
 }
 
+TEST(ChannelzLatencyHistogramTest, BucketsBoundTheirLatencies) {
+  for (int64_t latency : {0, 1, 7, 8, 9, 15, 16, 17, 1000, 123456789}) {
+    const int bucket = LatencyHistogram::BucketFor(latency);
+    EXPECT_LE(LatencyHistogram::BucketLowerBound(bucket), latency);
+    EXPECT_GT(LatencyHistogram::BucketLowerBound(bucket + 1), latency);
+  }
+  EXPECT_EQ(LatencyHistogram::BucketFor(int64_t{1} << 40),
+            LatencyHistogram::kBuckets - 1);
+}
+
+TEST(ChannelzLatencyHistogramTest, RendersPercentiles) {
+  ExecCtx exec_ctx;
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.RenderJson().type(), Json::Type::JSON_NULL);
+  for (int i = 0; i < 99; ++i) histogram.Record(1000);
+  histogram.Record(1000000);
+  Json json = histogram.RenderJson();
+  ASSERT_EQ(json.type(), Json::Type::OBJECT);
+  const Json::Object& object = json.object_value();
+  EXPECT_EQ(object.at("count").string_value(), "100");
+  EXPECT_EQ(object.at("p50Nanos").string_value(),
+            std::to_string(LatencyHistogram::BucketLowerBound(
+                LatencyHistogram::BucketFor(1000))));
+  EXPECT_EQ(object.at("p999Nanos").string_value(),
+            std::to_string(LatencyHistogram::BucketLowerBound(
+                LatencyHistogram::BucketFor(1000000))));
+  EXPECT_EQ(object.at("buckets").array_value().size(), 2u);
+}
+
+TEST(ChannelzServerTest, LatencyHistogramsOffByDefault) {
+  ExecCtx exec_ctx;
+  ServerFixture server(10);
+  ServerNode* channelz_server = Server::FromC(server.server())->channelz_node();
+  channelz_server->RecordCallLatency(gpr_get_cycle_counter());
+  Json json = channelz_server->RenderJson();
+  const Json::Object& data = json.object_value().at("data").object_value();
+  EXPECT_EQ(data.find("callLatency"), data.end());
+}
+
+TEST(ChannelzSocketTest, RendersOptionsFromSource) {
+  ExecCtx exec_ctx;
+  auto socket = MakeRefCounted<SocketNode>("ipv4:127.0.0.1:1",
+                                           "ipv4:127.0.0.1:2", "test", nullptr);
+  auto get_data = [&socket]() {
+    auto json = Json::Parse(socket->RenderJsonString());
+    EXPECT_TRUE(json.ok()) << json.status();
+    return (*json->mutable_object())["data"];
+  };
+  EXPECT_EQ(get_data().object_value().count("option"), 0);
+  socket->SetOptionsSource([]() {
+    return std::vector<std::pair<std::string, std::string>>{
+        {"tcp_tx_zerocopy_threshold_bytes", "32768"}};
+  });
+  Json data = get_data();
+  const Json::Array& options = data.object_value().at("option").array_value();
+  ASSERT_EQ(options.size(), 1);
+  EXPECT_EQ(options[0].object_value().at("name").string_value(),
+            "tcp_tx_zerocopy_threshold_bytes");
+  EXPECT_EQ(options[0].object_value().at("value").string_value(), "32768");
+  socket->SetOptionsSource(nullptr);
+  EXPECT_EQ(get_data().object_value().count("option"), 0);
+}
+
+TEST(ChannelzSocketTest, RendersFlowControlWindows) {
+  ExecCtx exec_ctx;
+  auto socket = MakeRefCounted<SocketNode>("ipv4:127.0.0.1:1",
+                                           "ipv4:127.0.0.1:2", "test", nullptr);
+  auto get_data = [&socket]() {
+    auto json = Json::Parse(socket->RenderJsonString());
+    EXPECT_TRUE(json.ok()) << json.status();
+    return (*json->mutable_object())["data"];
+  };
+  EXPECT_EQ(get_data().object_value().count("localFlowControlWindow"), 0);
+  EXPECT_EQ(get_data().object_value().count("remoteFlowControlWindow"), 0);
+  socket->RecordFlowControlWindows(131072, 65535);
+  Json data = get_data();
+  EXPECT_EQ(data.object_value().at("localFlowControlWindow").string_value(),
+            "131072");
+  EXPECT_EQ(data.object_value().at("remoteFlowControlWindow").string_value(),
+            "65535");
+}
+
 INSTANTIATE_TEST_SUITE_P(ChannelzChannelTestSweep, ChannelzChannelTest,
                          ::testing::Values(0, 8, 64, 1024, 1024 * 1024));
 
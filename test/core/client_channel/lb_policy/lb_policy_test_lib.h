@@ -61,6 +61,7 @@
 #include "src/core/lib/load_balancing/lb_policy_registry.h"
 #include "src/core/lib/load_balancing/subchannel_interface.h"
 #include "src/core/lib/resolver/server_address.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/uri/uri_parser.h"
 
@@ -266,6 +267,10 @@ class LoadBalancingPolicyTest : public ::testing::Test {
       metadata_[std::string(key)] = std::string(value);
     }
 
+    void Add(absl::string_view key, Slice value) override {
+      metadata_[std::string(key)] = std::string(value.as_string_view());
+    }
+
     std::vector<std::pair<std::string, std::string>> TestOnlyCopyToVector()
         override {
       return {};  // Not used.
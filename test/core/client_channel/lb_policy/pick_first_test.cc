@@ -17,6 +17,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <utility>
@@ -25,12 +26,17 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
 
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
@@ -46,6 +52,38 @@ class PickFirstTest : public LoadBalancingPolicyTest {
  protected:
   PickFirstTest() : lb_policy_(MakeLbPolicy("pick_first")) {}
 
+  // Sends an update with the addresses and channel args.
+  void SendUpdate(absl::Span<const absl::string_view> address_uris,
+                  const ChannelArgs& args) {
+    LoadBalancingPolicy::UpdateArgs update_args;
+    update_args.args = args;
+    update_args.addresses.emplace();
+    for (absl::string_view address_uri : address_uris) {
+      update_args.addresses->emplace_back(MakeAddress(address_uri),
+                                          ChannelArgs());
+    }
+    absl::Status status = ApplyUpdate(std::move(update_args), lb_policy_.get());
+    EXPECT_TRUE(status.ok()) << status;
+  }
+
+  // Returns the state of the subchannel that pick_first created for the
+  // address, given the channel args of the update.
+  SubchannelState* FindSubchannel(absl::string_view address_uri,
+                                  const ChannelArgs& args) {
+    SubchannelKey key(MakeAddress(address_uri),
+                      args.Set(GRPC_ARG_INHIBIT_HEALTH_CHECKING, true));
+    auto it = subchannel_pool_.find(key);
+    if (it == subchannel_pool_.end()) return nullptr;
+    return &it->second;
+  }
+
+  // Waits for work already queued on the WorkSerializer to finish.
+  void FlushWorkSerializer() {
+    absl::Notification notification;
+    work_serializer_->Run([&]() { notification.Notify(); }, DEBUG_LOCATION);
+    notification.WaitForNotification();
+  }
+
   OrphanablePtr<LoadBalancingPolicy> lb_policy_;
 };
 
@@ -86,6 +124,68 @@ TEST_F(PickFirstTest, Basic) {
   }
 }
 
+TEST_F(PickFirstTest, HappyEyeballsStartsNextAttemptAfterDelay) {
+  constexpr std::array<absl::string_view, 2> kAddressUris = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  const ChannelArgs args = ChannelArgs().Set(
+      GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS, 100);
+  SendUpdate(kAddressUris, args);
+  auto picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get());
+  SubchannelState* first = FindSubchannel(kAddressUris[0], args);
+  ASSERT_NE(first, nullptr);
+  SubchannelState* second = FindSubchannel(kAddressUris[1], args);
+  ASSERT_NE(second, nullptr);
+  // LB policy should have started connecting to the first address only.
+  EXPECT_TRUE(first->ConnectionRequested());
+  EXPECT_FALSE(second->ConnectionRequested());
+  first->SetConnectivityState(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get());
+  // While the first attempt hangs, the LB policy should start on the
+  // second address once the delay has passed.
+  const absl::Time deadline =
+      absl::Now() + absl::Seconds(5 * grpc_test_slowdown_factor());
+  while (!second->ConnectionRequested()) {
+    ASSERT_LT(absl::Now(), deadline);
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  FlushWorkSerializer();
+  // The first attempt to succeed is used.
+  second->SetConnectivityState(GRPC_CHANNEL_READY, absl::OkStatus());
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ExpectPickComplete(picker.get(), kAddressUris[1]);
+}
+
+TEST_F(PickFirstTest, HappyEyeballsInterleavesAddressFamilies) {
+  constexpr std::array<absl::string_view, 3> kAddressUris = {
+      "ipv6:[::1]:443", "ipv6:[::1]:444", "ipv4:127.0.0.1:443"};
+  // Use a delay long enough that only failures move the attempt along.
+  const ChannelArgs args = ChannelArgs().Set(
+      GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS, 100000);
+  SendUpdate(kAddressUris, args);
+  auto picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get());
+  SubchannelState* first_ipv6 = FindSubchannel(kAddressUris[0], args);
+  ASSERT_NE(first_ipv6, nullptr);
+  SubchannelState* second_ipv6 = FindSubchannel(kAddressUris[1], args);
+  ASSERT_NE(second_ipv6, nullptr);
+  SubchannelState* ipv4 = FindSubchannel(kAddressUris[2], args);
+  ASSERT_NE(ipv4, nullptr);
+  EXPECT_TRUE(first_ipv6->ConnectionRequested());
+  first_ipv6->SetConnectivityState(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get());
+  // When the first IPv6 address fails, the IPv4 address is tried next.
+  first_ipv6->SetConnectivityState(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                                   absl::UnavailableError("failed"));
+  EXPECT_TRUE(ipv4->ConnectionRequested());
+  EXPECT_FALSE(second_ipv6->ConnectionRequested());
+  ipv4->SetConnectivityState(GRPC_CHANNEL_READY, absl::OkStatus());
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ExpectPickComplete(picker.get(), kAddressUris[2]);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -0,0 +1,160 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy_registry.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+std::vector<RingHashLookupTable::Endpoint> MakeEndpoints(size_t count) {
+  std::vector<RingHashLookupTable::Endpoint> endpoints;
+  for (size_t i = 0; i < count; ++i) {
+    endpoints.push_back({absl::StrCat("10.0.0.", i, ":443"), 1});
+  }
+  return endpoints;
+}
+
+RingHashConfig MaglevConfig() {
+  RingHashConfig config;
+  config.lookup_table = RingHashConfig::LookupTable::kMaglev;
+  return config;
+}
+
+std::vector<size_t> EntriesPerEndpoint(const RingHashLookupTable& table,
+                                       size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (size_t i = 0; i < table.size(); ++i) ++counts[table.EndpointIndex(i)];
+  return counts;
+}
+
+TEST(RingHashLookupTableTest, RingFindWrapsAround) {
+  RingHashConfig config;
+  RingHashLookupTable table(config, MakeEndpoints(3));
+  EXPECT_GE(table.size(), config.min_ring_size);
+  EXPECT_EQ(table.Find(0), 0u);
+  EXPECT_EQ(table.Find(std::numeric_limits<uint64_t>::max()), 0u);
+}
+
+TEST(RingHashLookupTableTest, MaglevSpreadsEntriesEvenly) {
+  const RingHashConfig config = MaglevConfig();
+  RingHashLookupTable table(config, MakeEndpoints(10));
+  ASSERT_EQ(table.size(), config.maglev_table_size);
+  for (size_t count : EntriesPerEndpoint(table, 10)) {
+    EXPECT_NEAR(count, config.maglev_table_size / 10,
+                config.maglev_table_size / 100);
+  }
+}
+
+TEST(RingHashLookupTableTest, MaglevHonorsWeights) {
+  auto endpoints = MakeEndpoints(2);
+  endpoints[1].weight = 3;
+  RingHashLookupTable table(MaglevConfig(), endpoints);
+  auto counts = EntriesPerEndpoint(table, 2);
+  EXPECT_NEAR(static_cast<double>(counts[1]) / counts[0], 3.0, 0.01);
+}
+
+TEST(RingHashLookupTableTest, MaglevIgnoresEndpointOrder) {
+  auto endpoints = MakeEndpoints(5);
+  RingHashLookupTable table(MaglevConfig(), endpoints);
+  std::reverse(endpoints.begin(), endpoints.end());
+  RingHashLookupTable reversed_table(MaglevConfig(), endpoints);
+  for (size_t i = 0; i < table.size(); ++i) {
+    ASSERT_EQ(table.EndpointIndex(i), 4 - reversed_table.EndpointIndex(i));
+  }
+}
+
+TEST(RingHashLookupTableTest, MaglevRemovalMostlyKeepsOtherEntries) {
+  auto endpoints = MakeEndpoints(20);
+  RingHashLookupTable table(MaglevConfig(), endpoints);
+  endpoints.pop_back();
+  RingHashLookupTable smaller_table(MaglevConfig(), endpoints);
+  size_t moved = 0;
+  for (size_t i = 0; i < table.size(); ++i) {
+    if (table.EndpointIndex(i) != 19 &&
+        table.EndpointIndex(i) != smaller_table.EndpointIndex(i)) {
+      ++moved;
+    }
+  }
+  // Only a small fraction of the entries of surviving endpoints move.
+  EXPECT_LT(moved, table.size() / 20);
+}
+
+TEST(RingHashLookupTableTest, Matches) {
+  const auto endpoints = MakeEndpoints(3);
+  RingHashLookupTable table(MaglevConfig(), endpoints);
+  EXPECT_TRUE(table.Matches(MaglevConfig(), endpoints));
+  EXPECT_FALSE(table.Matches(RingHashConfig(), endpoints));
+  EXPECT_FALSE(table.Matches(MaglevConfig(), MakeEndpoints(4)));
+  auto reweighted = endpoints;
+  reweighted[0].weight = 2;
+  EXPECT_FALSE(table.Matches(MaglevConfig(), reweighted));
+}
+
+absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>> ParseConfig(
+    Json::Object config) {
+  return CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+      Json::Array{Json::Object{{"ring_hash_experimental", std::move(config)}}});
+}
+
+TEST(RingHashConfigTest, MaglevConfig) {
+  auto config = ParseConfig(
+      {{"lookup_table", "maglev"}, {"maglev_table_size", 5000011}});
+  EXPECT_TRUE(config.ok()) << config.status();
+}
+
+TEST(RingHashConfigTest, InvalidLookupTable) {
+  auto config = ParseConfig({{"lookup_table", "jump"}});
+  EXPECT_FALSE(config.ok());
+}
+
+TEST(RingHashConfigTest, MaglevTableSizeMustBePrime) {
+  auto config =
+      ParseConfig({{"lookup_table", "maglev"}, {"maglev_table_size", 65536}});
+  EXPECT_FALSE(config.ok());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,155 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/load_balancing/lb_policy_registry.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class WeightedRoundRobinTest : public LoadBalancingPolicyTest {
+ protected:
+  class ConfigBuilder {
+   public:
+    ConfigBuilder& SetEnableOobLoadReport(bool value) {
+      json_["enableOobLoadReport"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetBlackoutPeriod(Duration duration) {
+      json_["blackoutPeriod"] = duration.ToJsonString();
+      return *this;
+    }
+    ConfigBuilder& SetWeightUpdatePeriod(Duration duration) {
+      json_["weightUpdatePeriod"] = duration.ToJsonString();
+      return *this;
+    }
+    ConfigBuilder& SetErrorUtilizationPenalty(float value) {
+      json_["errorUtilizationPenalty"] = value;
+      return *this;
+    }
+
+    Json BuildJson() const {
+      return Json::Array{Json::Object{{"weighted_round_robin", json_}}};
+    }
+
+    RefCountedPtr<LoadBalancingPolicy::Config> Build() {
+      return MakeConfig(BuildJson());
+    }
+
+   private:
+    Json::Object json_;
+  };
+
+  WeightedRoundRobinTest()
+      : lb_policy_(MakeLbPolicy("weighted_round_robin")) {}
+
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+};
+
+TEST_F(WeightedRoundRobinTest, Basic) {
+  constexpr absl::string_view kAddressUri = "ipv4:127.0.0.1:443";
+  const grpc_resolved_address address = MakeAddress(kAddressUri);
+  // Send an update containing one address.
+  LoadBalancingPolicy::UpdateArgs update_args;
+  update_args.config = ConfigBuilder().Build();
+  update_args.addresses.emplace();
+  update_args.addresses->emplace_back(address, ChannelArgs());
+  absl::Status status = ApplyUpdate(std::move(update_args), lb_policy_.get());
+  EXPECT_TRUE(status.ok()) << status;
+  // LB policy should have reported CONNECTING state.
+  auto picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get());
+  // LB policy should have created a subchannel for the address.
+  SubchannelKey key(address, ChannelArgs());
+  auto it = subchannel_pool_.find(key);
+  ASSERT_NE(it, subchannel_pool_.end());
+  auto& subchannel_state = it->second;
+  // LB policy should have requested a connection on this subchannel.
+  EXPECT_TRUE(subchannel_state.ConnectionRequested());
+  // Tell subchannel to report CONNECTING.
+  subchannel_state.SetConnectivityState(GRPC_CHANNEL_CONNECTING,
+                                        absl::OkStatus());
+  // LB policy should again report CONNECTING.
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get());
+  // Tell subchannel to report READY.
+  subchannel_state.SetConnectivityState(GRPC_CHANNEL_READY, absl::OkStatus());
+  // LB policy should eventually report READY.
+  picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  // With no load reports yet, the picker falls back to round robin and
+  // returns the only subchannel repeatedly.
+  for (size_t i = 0; i < 3; ++i) {
+    ExpectPickComplete(picker.get(), kAddressUri);
+  }
+}
+
+TEST_F(WeightedRoundRobinTest, OobConfigAccepted) {
+  auto config = CoreConfiguration::Get()
+                    .lb_policy_registry()
+                    .ParseLoadBalancingConfig(
+                        ConfigBuilder()
+                            .SetEnableOobLoadReport(true)
+                            .SetBlackoutPeriod(Duration::Seconds(1))
+                            .SetWeightUpdatePeriod(Duration::Milliseconds(10))
+                            .BuildJson());
+  EXPECT_TRUE(config.ok()) << config.status();
+}
+
+TEST_F(WeightedRoundRobinTest, NegativeErrorUtilizationPenaltyRejected) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          ConfigBuilder().SetErrorUtilizationPenalty(-1).BuildJson());
+  EXPECT_FALSE(config.ok());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
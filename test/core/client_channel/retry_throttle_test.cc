@@ -128,6 +128,32 @@ TEST(ServerRetryThrottleMap, Replacement) {
   EXPECT_FALSE(throttle_data->RecordFailure());
 }
 
+TEST(AdaptiveThrottleData, AcceptsWhileServerAccepts) {
+  auto throttle_data = MakeRefCounted<AdaptiveThrottleData>(2.0);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_FALSE(throttle_data->ShouldReject());
+    throttle_data->RecordAccepted();
+  }
+}
+
+TEST(AdaptiveThrottleData, RejectsWhileServerRejects) {
+  auto throttle_data = MakeRefCounted<AdaptiveThrottleData>(2.0);
+  // The server accepts 10 calls, then rejects all.  With k=2, up to 20
+  // calls are sent before any is rejected locally.
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE(throttle_data->ShouldReject());
+    throttle_data->RecordAccepted();
+  }
+  for (int i = 0; i < 10; ++i) EXPECT_FALSE(throttle_data->ShouldReject());
+  int rejected = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (throttle_data->ShouldReject()) ++rejected;
+  }
+  // The rejection probability approaches 1 - 20 / requests.
+  EXPECT_GT(rejected, 850);
+  EXPECT_LT(rejected, 1000);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc_core
@@ -19,9 +19,11 @@
 #include "src/core/lib/compression/message_compress.h"
 
 #include <inttypes.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "absl/status/status.h"
 #include "gtest/gtest.h"
 
 #include <grpc/compression.h>
@@ -301,6 +303,131 @@ TEST(MessageCompressTest, BadDecompressionAlgorithm) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, CodecReusedAcrossMessages) {
+  const test_value values[] = {ONE_KB_A, ONE_MB_A, ONE_A, ONE_KB_A};
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP}) {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_core::MessageCompressor compressor(algorithm);
+    grpc_core::MessageDecompressor decompressor(algorithm);
+    for (test_value id : values) {
+      grpc_slice value = create_test_value(id);
+      grpc_slice_buffer input;
+      grpc_slice_buffer compressed;
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&input);
+      grpc_slice_buffer_init(&compressed);
+      grpc_slice_buffer_init(&output);
+      grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+      const bool was_compressed = compressor.Compress(&input, &compressed);
+      EXPECT_EQ(was_compressed,
+                get_compressability(id, algorithm) == SHOULD_COMPRESS);
+      if (was_compressed) {
+        EXPECT_TRUE(
+            decompressor.Decompress(&compressed, &output, SIZE_MAX).ok());
+      } else {
+        grpc_slice_buffer_swap(&compressed, &output);
+      }
+      grpc_slice final = grpc_slice_merge(output.slices, output.count);
+      EXPECT_TRUE(grpc_slice_eq(value, final));
+      grpc_slice_unref(final);
+      grpc_slice_unref(value);
+      grpc_slice_buffer_destroy(&input);
+      grpc_slice_buffer_destroy(&compressed);
+      grpc_slice_buffer_destroy(&output);
+    }
+  }
+}
+
+TEST(MessageCompressTest, CompressorHonorsZlibLevel) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer fast;
+  grpc_slice_buffer small;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&fast);
+  grpc_slice_buffer_init(&small);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_TRUE(grpc_core::MessageCompressor(GRPC_COMPRESS_GZIP, 1)
+                  .Compress(&input, &fast));
+  ASSERT_TRUE(grpc_core::MessageCompressor(GRPC_COMPRESS_GZIP, 9)
+                  .Compress(&input, &small));
+  EXPECT_LT(small.length, fast.length);
+  /* the level does not matter to the decompressor */
+  grpc_core::MessageDecompressor decompressor(GRPC_COMPRESS_GZIP);
+  EXPECT_TRUE(decompressor.Decompress(&fast, &output, SIZE_MAX).ok());
+  EXPECT_EQ(input.length, output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&fast);
+  grpc_slice_buffer_destroy(&small);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(MessageCompressTest, DecompressorEnforcesMaxSize) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  ASSERT_EQ(1, grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &compressed));
+  grpc_core::MessageDecompressor decompressor(GRPC_COMPRESS_GZIP);
+  /* one byte short: fails without keeping any output */
+  absl::Status status =
+      decompressor.Decompress(&compressed, &output, input.length - 1);
+  EXPECT_TRUE(absl::IsResourceExhausted(status)) << status;
+  EXPECT_EQ(0, output.length);
+  /* the same decompressor can be used again */
+  status = decompressor.Decompress(&compressed, &output, input.length);
+  EXPECT_TRUE(status.ok()) << status;
+  EXPECT_EQ(input.length, output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
+TEST(AdaptiveCompressionPolicyTest, BacksOffWhileCompressionIsPoor) {
+  using grpc_core::AdaptiveCompressionPolicy;
+  AdaptiveCompressionPolicy policy;
+  /* a few poor results in a row are tolerated */
+  for (int i = 0; i < AdaptiveCompressionPolicy::kMaxPoorResults; i++) {
+    ASSERT_TRUE(policy.ShouldCompress());
+    policy.RecordResult(1000, 950);
+  }
+  /* then messages are skipped, with longer pauses after each poor probe */
+  int skip = AdaptiveCompressionPolicy::kMinSkip;
+  for (int probe = 0; probe < 3; probe++) {
+    for (int i = 0; i < skip; i++) EXPECT_FALSE(policy.ShouldCompress());
+    ASSERT_TRUE(policy.ShouldCompress());
+    policy.RecordResult(1000, 1000);
+    skip *= 2;
+  }
+  /* a good probe resumes compression */
+  for (int i = 0; i < skip; i++) EXPECT_FALSE(policy.ShouldCompress());
+  ASSERT_TRUE(policy.ShouldCompress());
+  policy.RecordResult(1000, 100);
+  for (int i = 0; i < 10; i++) EXPECT_TRUE(policy.ShouldCompress());
+}
+
+TEST(AdaptiveCompressionPolicyTest, GoodResultResetsPoorStreak) {
+  grpc_core::AdaptiveCompressionPolicy policy;
+  for (int i = 0; i < 10; i++) {
+    policy.RecordResult(1000, 950);
+    policy.RecordResult(1000, 500);
+    EXPECT_TRUE(policy.ShouldCompress());
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
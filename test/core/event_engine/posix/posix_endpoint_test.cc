@@ -15,7 +15,9 @@
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <list>
 #include <memory>
 #include <string>
@@ -39,6 +41,7 @@
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/posix_engine/write_coalescer.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
 #include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/memory.h"
@@ -57,12 +60,15 @@ namespace posix_engine {
 
 namespace {
 
+using ::grpc_event_engine::experimental::AppendStringToSliceBuffer;
 using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::ExtractSliceBufferIntoString;
 using ::grpc_event_engine::experimental::GetNextSendMessage;
 using ::grpc_event_engine::experimental::Poller;
 using ::grpc_event_engine::experimental::PosixEventEngine;
 using ::grpc_event_engine::experimental::PosixOracleEventEngine;
+using ::grpc_event_engine::experimental::SliceBuffer;
 using ::grpc_event_engine::experimental::URIToResolvedAddress;
 using ::grpc_event_engine::experimental::WaitForSingleOwner;
 using Endpoint = ::grpc_event_engine::experimental::EventEngine::Endpoint;
@@ -82,7 +88,8 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    bool is_write_coalescing_enabled = false) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>("bar");
   std::string target_addr = absl::StrCat(
@@ -107,6 +114,9 @@ std::list<Connection> CreateConnectedEndpoints(
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
   }
+  if (is_write_coalescing_enabled) {
+    args = args.Set(GRPC_ARG_TCP_WRITE_COALESCING_ENABLED, 1);
+  }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
       std::move(accept_cb),
@@ -148,6 +158,30 @@ std::list<Connection> CreateConnectedEndpoints(
   return connections;
 }
 
+// Reads exactly num_bytes from endpoint.
+std::string ReadBytes(Endpoint* endpoint, int num_bytes) {
+  grpc_core::Notification read_signal;
+  SliceBuffer read_slice_buf;
+  SliceBuffer read_store_buf;
+  EventEngine::Endpoint::ReadArgs args = {num_bytes};
+  std::function<void(absl::Status)> read_cb;
+  read_cb = [endpoint, &read_slice_buf, &read_store_buf, &read_cb,
+             &read_signal, &args](absl::Status status) {
+    GPR_ASSERT(status.ok());
+    args.read_hint_bytes -= read_slice_buf.Length();
+    read_slice_buf.MoveFirstNBytesIntoSliceBuffer(read_slice_buf.Length(),
+                                                  read_store_buf);
+    if (args.read_hint_bytes == 0) {
+      read_signal.Notify();
+      return;
+    }
+    endpoint->Read(read_cb, &read_slice_buf, &args);
+  };
+  endpoint->Read(read_cb, &read_slice_buf, &args);
+  read_signal.WaitForNotification();
+  return ExtractSliceBufferIntoString(&read_store_buf);
+}
+
 }  // namespace
 
 std::string TestScenarioName(const ::testing::TestParamInfo<bool>& info) {
@@ -331,6 +365,51 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
+// Issue one write on each of N connections inside a single WriteCoalescer
+// scope and verify that every write completes once the scope ends.
+TEST_P(PosixEndpointTest, CoalescedWritesTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), kNumConnections, GetPosixEE(),
+        GetOracleEE(), /*is_write_coalescing_enabled=*/true);
+    std::vector<std::string> messages;
+    std::vector<SliceBuffer> write_slice_bufs(kNumConnections);
+    std::atomic<int> pending_writes{kNumConnections};
+    grpc_core::Notification write_signal;
+    {
+      WriteCoalescer::Scope scope;
+      int i = 0;
+      for (auto& connection : connections) {
+        messages.push_back(GetNextSendMessage());
+        AppendStringToSliceBuffer(&write_slice_bufs[i], messages.back());
+        connection.client_endpoint->Write(
+            [&pending_writes, &write_signal](absl::Status status) {
+              GPR_ASSERT(status.ok());
+              if (--pending_writes == 0) {
+                write_signal.Notify();
+              }
+            },
+            &write_slice_bufs[i], nullptr);
+        ++i;
+      }
+    }
+    int i = 0;
+    for (auto& connection : connections) {
+      EXPECT_EQ(ReadBytes(connection.server_endpoint.get(),
+                          static_cast<int>(messages[i].size())),
+                messages[i]);
+      ++i;
+    }
+    write_signal.WaitForNotification();
+  }
+  worker->Wait();
+}
+
 // Test with zero copy enabled and disabled.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
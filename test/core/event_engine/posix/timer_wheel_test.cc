@@ -0,0 +1,203 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <stdint.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+namespace {
+
+class FakeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now);
+  }
+  void Kick() override { ++kicks; }
+
+  int64_t now = 0;
+  int kicks = 0;
+};
+
+class RecordingClosure : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { fired_at = *now; }
+
+  const int64_t* now = nullptr;
+  int64_t fired_at = -1;
+};
+
+// Runs the closures of the timers that were due, returning how many fired,
+// or -1 if the check did not run.
+int RunCheck(TimerWheel* wheel, grpc_core::Timestamp* next = nullptr) {
+  auto result = wheel->TimerCheck(next);
+  if (!result.has_value()) return -1;
+  for (auto* closure : *result) closure->Run();
+  return result->size();
+}
+
+grpc_core::Timestamp Millis(int64_t ms) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(ms);
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, Add) {
+  FakeHost host;
+  host.now = 100;
+  TimerWheel wheel(&host);
+  Timer timers[20];
+  RecordingClosure closures[20];
+  for (int i = 0; i < 20; i++) {
+    closures[i].now = &host.now;
+    wheel.TimerInit(&timers[i], Millis(i < 10 ? 110 : 1110), &closures[i]);
+  }
+  EXPECT_GT(host.kicks, 0);
+
+  host.now = 600;
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(RunCheck(&wheel, &next), 10);
+  EXPECT_LE(next, Millis(1110));
+  for (int i = 0; i < 10; i++) EXPECT_EQ(closures[i].fired_at, 600);
+  host.now = 700;
+  EXPECT_EQ(RunCheck(&wheel), 0);
+  host.now = 1500;
+  EXPECT_EQ(RunCheck(&wheel), 10);
+  for (int i = 10; i < 20; i++) EXPECT_EQ(closures[i].fired_at, 1500);
+  host.now = 1600;
+  EXPECT_EQ(RunCheck(&wheel), 0);
+}
+
+TEST(TimerWheelTest, Cancel) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  Timer timers[5];
+  RecordingClosure closures[5];
+  const int64_t deadlines[] = {100, 3, 100, 3, 1};
+  for (int i = 0; i < 5; i++) {
+    closures[i].now = &host.now;
+    wheel.TimerInit(&timers[i], Millis(deadlines[i]), &closures[i]);
+  }
+  host.now = 2;
+  EXPECT_EQ(RunCheck(&wheel), 1);
+  EXPECT_EQ(closures[4].fired_at, 2);
+  EXPECT_FALSE(wheel.TimerCancel(&timers[4]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[3]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[1]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[1]));
+  host.now = 1000;
+  EXPECT_EQ(RunCheck(&wheel), 1);
+  EXPECT_EQ(closures[2].fired_at, 1000);
+  for (int i : {0, 1, 3}) EXPECT_EQ(closures[i].fired_at, -1);
+}
+
+// Deadlines on every level and on the overflow list, including ones that
+// never come, fire on the first check at or after them.
+TEST(TimerWheelTest, CascadesAcrossLevels) {
+  const int64_t kStart = grpc_core::Duration::Hours(25 * 24).millis() + 12345;
+  FakeHost host;
+  host.now = kStart;
+  TimerWheel wheel(&host);
+  const int64_t kDelays[] = {
+      0, 1, 255, 256, 257, 65535, 65536, 70000, 1 << 24, 1 << 25,
+      int64_t{1} << 33};
+  constexpr size_t kNumTimers = sizeof(kDelays) / sizeof(kDelays[0]);
+  Timer timers[kNumTimers + 1];
+  RecordingClosure closures[kNumTimers + 1];
+  for (size_t i = 0; i < kNumTimers; i++) {
+    closures[i].now = &host.now;
+    wheel.TimerInit(&timers[i], Millis(kStart + kDelays[i]), &closures[i]);
+  }
+  wheel.TimerInit(&timers[kNumTimers],
+                  Millis(std::numeric_limits<int64_t>::max() - 1),
+                  &closures[kNumTimers]);
+  for (size_t i = 0; i < kNumTimers; i++) {
+    host.now = kStart + kDelays[i];
+    if (i > 0 && kDelays[i] > kDelays[i - 1] + 1) {
+      host.now -= 1;
+      EXPECT_EQ(RunCheck(&wheel), 0) << kDelays[i];
+      host.now += 1;
+    }
+    EXPECT_EQ(RunCheck(&wheel), 1) << kDelays[i];
+    EXPECT_EQ(closures[i].fired_at, kStart + kDelays[i]);
+  }
+  EXPECT_TRUE(wheel.TimerCancel(&timers[kNumTimers]));
+}
+
+// Timers with random deadlines, checked at random intervals, fire at the first
+// check at or after their deadline, and never before.
+TEST(TimerWheelTest, RandomDeadlines) {
+  std::mt19937 rng(42);
+  FakeHost host;
+  host.now = 1000;
+  TimerWheel wheel(&host);
+  constexpr int kNumTimers = 2000;
+  std::vector<Timer> timers(kNumTimers);
+  std::vector<RecordingClosure> closures(kNumTimers);
+  std::vector<int64_t> deadlines(kNumTimers);
+  std::vector<bool> cancelled(kNumTimers);
+  std::uniform_int_distribution<int64_t> delay(0, 200000);
+  for (int i = 0; i < kNumTimers; i++) {
+    closures[i].now = &host.now;
+    deadlines[i] = host.now + delay(rng);
+    wheel.TimerInit(&timers[i], Millis(deadlines[i]), &closures[i]);
+  }
+  for (int i = 0; i < kNumTimers; i += 7) {
+    cancelled[i] = wheel.TimerCancel(&timers[i]);
+    EXPECT_TRUE(cancelled[i]);
+  }
+  std::uniform_int_distribution<int64_t> step(1, 3000);
+  int64_t last_check = host.now;
+  while (host.now <= 201000) {
+    host.now += step(rng);
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    ASSERT_GE(RunCheck(&wheel, &next), 0);
+    for (int i = 0; i < kNumTimers; i++) {
+      if (cancelled[i]) {
+        ASSERT_EQ(closures[i].fired_at, -1);
+      } else if (deadlines[i] <= last_check) {
+        ASSERT_NE(closures[i].fired_at, -1);
+      } else if (deadlines[i] <= host.now) {
+        ASSERT_EQ(closures[i].fired_at, host.now);
+      } else {
+        ASSERT_EQ(closures[i].fired_at, -1);
+        ASSERT_LE(next, Millis(deadlines[i]));
+      }
+    }
+    last_check = host.now;
+  }
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/write_coalescer.h"
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace grpc_event_engine {
+namespace posix_engine {
+namespace {
+
+constexpr int kNumSockets = 10;
+
+class SocketPair {
+ public:
+  SocketPair() {
+    GPR_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds_) == 0);
+    GPR_ASSERT(fcntl(fds_[0], F_SETFL, O_NONBLOCK) == 0);
+    GPR_ASSERT(fcntl(fds_[1], F_SETFL, O_NONBLOCK) == 0);
+  }
+  ~SocketPair() {
+    close(fds_[0]);
+    close(fds_[1]);
+  }
+  int write_fd() const { return fds_[0]; }
+  std::string ReadAll() const {
+    std::string result;
+    char buf[1024];
+    ssize_t n;
+    while ((n = read(fds_[1], buf, sizeof(buf))) > 0) {
+      result.append(buf, n);
+    }
+    return result;
+  }
+
+ private:
+  int fds_[2];
+};
+
+struct Message {
+  explicit Message(std::string data) : data(std::move(data)) {
+    iov.iov_base = &this->data[0];
+    iov.iov_len = this->data.size();
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+  }
+  std::string data;
+  iovec iov;
+  msghdr msg;
+};
+
+TEST(WriteCoalescerTest, NoCoalescerOutsideScope) {
+  EXPECT_EQ(WriteCoalescer::Current(), nullptr);
+  {
+    WriteCoalescer::Scope scope;
+    EXPECT_NE(WriteCoalescer::Current(), nullptr);
+  }
+  EXPECT_EQ(WriteCoalescer::Current(), nullptr);
+}
+
+TEST(WriteCoalescerTest, FlushesWhenOutermostScopeEnds) {
+  grpc_core::ExecCtx exec_ctx;
+  auto stats_before = grpc_core::global_stats().Collect();
+  std::vector<std::unique_ptr<SocketPair>> sockets;
+  std::vector<std::unique_ptr<Message>> messages;
+  std::vector<ssize_t> results(kNumSockets, 0);
+  for (int i = 0; i < kNumSockets; ++i) {
+    sockets.push_back(std::make_unique<SocketPair>());
+    messages.push_back(std::make_unique<Message>(absl::StrCat("message ", i)));
+  }
+  {
+    WriteCoalescer::Scope scope;
+    WriteCoalescer* coalescer = WriteCoalescer::Current();
+    {
+      WriteCoalescer::Scope nested_scope;
+      EXPECT_EQ(WriteCoalescer::Current(), coalescer);
+      for (int i = 0; i < kNumSockets; ++i) {
+        coalescer->Add(sockets[i]->write_fd(), &messages[i]->msg,
+                       [&results, i](ssize_t sent_length, int saved_errno) {
+                         EXPECT_EQ(saved_errno, 0);
+                         results[i] = sent_length;
+                       });
+      }
+    }
+    // Nothing is sent before the outermost scope ends.
+    EXPECT_EQ(coalescer->size(), kNumSockets);
+    EXPECT_EQ(sockets[0]->ReadAll(), "");
+  }
+  for (int i = 0; i < kNumSockets; ++i) {
+    EXPECT_EQ(results[i], static_cast<ssize_t>(messages[i]->data.size()));
+    EXPECT_EQ(sockets[i]->ReadAll(), messages[i]->data);
+  }
+  auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  EXPECT_EQ(
+      stats->histogram(grpc_core::GlobalStats::Histogram::kTcpWriteBatchSize)
+          .Count(),
+      1);
+}
+
+TEST(WriteCoalescerTest, SendsMessagesQueuedByCallbacks) {
+  SocketPair sockets;
+  Message first("first");
+  Message second("second");
+  bool second_sent = false;
+  {
+    WriteCoalescer::Scope scope;
+    WriteCoalescer::Current()->Add(
+        sockets.write_fd(), &first.msg,
+        [&](ssize_t /*sent_length*/, int /*saved_errno*/) {
+          WriteCoalescer::Current()->Add(
+              sockets.write_fd(), &second.msg,
+              [&](ssize_t sent_length, int /*saved_errno*/) {
+                EXPECT_EQ(sent_length,
+                          static_cast<ssize_t>(second.data.size()));
+                second_sent = true;
+              });
+        });
+  }
+  EXPECT_TRUE(second_sent);
+  EXPECT_EQ(sockets.ReadAll(), "firstsecond");
+}
+
+TEST(WriteCoalescerTest, ReportsErrors) {
+  Message message("message");
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  close(fds[1]);
+  ssize_t result = 0;
+  int error = 0;
+  {
+    WriteCoalescer::Scope scope;
+    WriteCoalescer::Current()->Add(fds[0], &message.msg,
+                                   [&](ssize_t sent_length, int saved_errno) {
+                                     result = sent_length;
+                                     error = saved_errno;
+                                   });
+  }
+  close(fds[0]);
+  EXPECT_EQ(result, -1);
+  EXPECT_EQ(error, EPIPE);
+}
+
+}  // namespace
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+#else  // GRPC_POSIX_SOCKET_TCP
+
+int main(int /*argc*/, char** /*argv*/) { return 0; }
+
+#endif  // GRPC_POSIX_SOCKET_TCP
@@ -16,6 +16,7 @@
 
 #include <stdlib.h>
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 
@@ -81,6 +82,34 @@ TEST(ThreadPoolTest, CanSurviveFork) {
   p.Quiesce();
 }
 
+TEST(ThreadPoolTest, StartsThreadsOnFirstUse) {
+  ThreadPool p;
+  EXPECT_EQ(p.GetLatencyStats().threads, 0);
+  // Nothing is running, so there is nothing to wait for.
+  p.PrepareFork();
+  p.PostforkChild();
+  EXPECT_EQ(p.GetLatencyStats().threads, 0);
+  grpc_core::Notification n;
+  p.Run([&n] { n.Notify(); });
+  EXPECT_GT(p.GetLatencyStats().threads, 0);
+  n.WaitForNotification();
+  p.Quiesce();
+}
+
+TEST(ThreadPoolTest, ChildRestartsThreadsOnFirstUse) {
+  ThreadPool p;
+  grpc_core::Notification n;
+  p.Run([&n] { n.Notify(); });
+  n.WaitForNotification();
+  p.PrepareFork();
+  p.PostforkChild();
+  EXPECT_EQ(p.GetLatencyStats().threads, 0);
+  grpc_core::Notification n2;
+  p.Run([&n2] { n2.Notify(); });
+  n2.WaitForNotification();
+  p.Quiesce();
+}
+
 void ScheduleSelf(ThreadPool* p) {
   p->Run([p] { ScheduleSelf(p); });
 }
@@ -116,6 +145,67 @@ TEST(ThreadPoolTest, CanStartLotsOfClosures) {
   p.Quiesce();
 }
 
+TEST(ThreadPoolTest, IdleThreadsStealLocalWork) {
+  ThreadPool p;
+  grpc_core::Notification n;
+  p.Run([&p, &n] {
+    // Both closures land in this thread's local queue, and this thread blocks
+    // until they have run: they must be stolen by other threads.
+    grpc_core::Notification child1;
+    grpc_core::Notification child2;
+    p.Run([&child1] { child1.Notify(); });
+    p.Run([&child2] { child2.Notify(); });
+    child1.WaitForNotification();
+    child2.WaitForNotification();
+    n.Notify();
+  });
+  n.WaitForNotification();
+  p.Quiesce();
+}
+
+TEST(ThreadPoolTest, RunFromAnotherPoolUsesThatPool) {
+  ThreadPool p1;
+  ThreadPool p2;
+  grpc_core::Notification n;
+  p1.Run([&p2, &n] {
+    grpc_core::Notification child;
+    p2.Run([&child] { child.Notify(); });
+    child.WaitForNotification();
+    n.Notify();
+  });
+  n.WaitForNotification();
+  p1.Quiesce();
+  p2.Quiesce();
+}
+
+TEST(ThreadPoolTest, GrowsWhenQueueLatencyIsAboveTarget) {
+  ThreadPool p(grpc_core::Duration::Milliseconds(1));
+  EXPECT_EQ(p.GetLatencyStats().target, grpc_core::Duration::Milliseconds(1));
+  // Start the reserve threads.
+  grpc_core::Notification started;
+  p.Run([&started] { started.Notify(); });
+  started.WaitForNotification();
+  const int initial_threads = p.GetLatencyStats().threads;
+  constexpr int kCallbacks = 200;
+  std::atomic<int> remaining{kCallbacks};
+  std::atomic<int> max_threads{0};
+  grpc_core::Notification n;
+  for (int i = 0; i < kCallbacks; i++) {
+    p.Run([&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      int threads = p.GetLatencyStats().threads;
+      int prev = max_threads.load();
+      while (threads > prev &&
+             !max_threads.compare_exchange_weak(prev, threads)) {
+      }
+      if (remaining.fetch_sub(1) == 1) n.Notify();
+    });
+  }
+  n.WaitForNotification();
+  EXPECT_GT(max_threads.load(), initial_threads);
+  p.Quiesce();
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
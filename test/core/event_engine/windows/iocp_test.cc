@@ -112,18 +112,16 @@ TEST_F(IOCPTest, ClientReceivesNotificationOfServerSend) {
     });
     wrapped_server_socket->NotifyOnWrite(on_write);
   }
-  // Doing work for WSASend
+  // Doing work for WSASend and WSARecv, which may be dequeued together
   bool cb_invoked = false;
   auto work_result = iocp.Work(std::chrono::seconds(10),
                                [&cb_invoked]() { cb_invoked = true; });
   ASSERT_TRUE(work_result == Poller::WorkResult::kOk);
   ASSERT_TRUE(cb_invoked);
-  // Doing work for WSARecv
-  cb_invoked = false;
-  work_result = iocp.Work(std::chrono::seconds(10),
-                          [&cb_invoked]() { cb_invoked = true; });
-  ASSERT_TRUE(work_result == Poller::WorkResult::kOk);
-  ASSERT_TRUE(cb_invoked);
+  while (work_result != Poller::WorkResult::kDeadlineExceeded) {
+    work_result = iocp.Work(std::chrono::milliseconds(100), []() {});
+    ASSERT_TRUE(work_result != Poller::WorkResult::kKicked);
+  }
   // wait for the callbacks to run
   read_called.WaitForNotification();
   write_called.WaitForNotification();
@@ -234,15 +232,11 @@ TEST_F(IOCPTest, KickThenShutdownCasusesNextWorkerToBeKicked) {
   iocp.Kick();
   iocp.Kick();
   bool cb_invoked = false;
-  // Assert the next two WorkResults are kicks
+  // Assert the next WorkResult is a kick: both kicks are dequeued together
   auto result = iocp.Work(std::chrono::milliseconds(1),
                           [&cb_invoked]() { cb_invoked = true; });
   ASSERT_TRUE(result == Poller::WorkResult::kKicked);
   ASSERT_FALSE(cb_invoked);
-  result = iocp.Work(std::chrono::milliseconds(1),
-                     [&cb_invoked]() { cb_invoked = true; });
-  ASSERT_TRUE(result == Poller::WorkResult::kKicked);
-  ASSERT_FALSE(cb_invoked);
   // followed by a DeadlineExceeded
   result = iocp.Work(std::chrono::milliseconds(1),
                      [&cb_invoked]() { cb_invoked = true; });
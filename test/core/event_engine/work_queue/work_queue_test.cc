@@ -32,15 +32,22 @@
 namespace {
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::LockFreeWorkQueue;
 using ::grpc_event_engine::experimental::WorkQueue;
 
-TEST(WorkQueueTest, StartsEmpty) {
-  WorkQueue queue;
+template <typename T>
+class WorkQueueTest : public testing::Test {};
+
+using WorkQueueTypes = testing::Types<WorkQueue, LockFreeWorkQueue>;
+TYPED_TEST_SUITE(WorkQueueTest, WorkQueueTypes);
+
+TYPED_TEST(WorkQueueTest, StartsEmpty) {
+  TypeParam queue;
   ASSERT_TRUE(queue.Empty());
 }
 
-TEST(WorkQueueTest, TakesClosures) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, TakesClosures) {
+  TypeParam queue;
   bool ran = false;
   AnyInvocableClosure closure([&ran] { ran = true; });
   queue.Add(&closure);
@@ -52,8 +59,8 @@ TEST(WorkQueueTest, TakesClosures) {
   ASSERT_TRUE(queue.Empty());
 }
 
-TEST(WorkQueueTest, TakesAnyInvocables) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, TakesAnyInvocables) {
+  TypeParam queue;
   bool ran = false;
   queue.Add([&ran] { ran = true; });
   ASSERT_FALSE(queue.Empty());
@@ -64,8 +71,8 @@ TEST(WorkQueueTest, TakesAnyInvocables) {
   ASSERT_TRUE(queue.Empty());
 }
 
-TEST(WorkQueueTest, BecomesEmptyOnPopBack) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, BecomesEmptyOnPopBack) {
+  TypeParam queue;
   bool ran = false;
   queue.Add([&ran] { ran = true; });
   ASSERT_FALSE(queue.Empty());
@@ -76,8 +83,8 @@ TEST(WorkQueueTest, BecomesEmptyOnPopBack) {
   ASSERT_TRUE(queue.Empty());
 }
 
-TEST(WorkQueueTest, PopFrontIsFIFO) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, PopFrontIsFIFO) {
+  TypeParam queue;
   int flag = 0;
   queue.Add([&flag] { flag |= 1; });
   queue.Add([&flag] { flag |= 2; });
@@ -90,8 +97,8 @@ TEST(WorkQueueTest, PopFrontIsFIFO) {
   ASSERT_TRUE(queue.Empty());
 }
 
-TEST(WorkQueueTest, PopBackIsLIFO) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, PopBackIsLIFO) {
+  TypeParam queue;
   int flag = 0;
   queue.Add([&flag] { flag |= 1; });
   queue.Add([&flag] { flag |= 2; });
@@ -104,8 +111,8 @@ TEST(WorkQueueTest, PopBackIsLIFO) {
   ASSERT_TRUE(queue.Empty());
 }
 
-TEST(WorkQueueTest, OldestEnqueuedTimestampIsSane) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, OldestEnqueuedTimestampIsSane) {
+  TypeParam queue;
   ASSERT_EQ(queue.OldestEnqueuedTimestamp(), grpc_core::Timestamp::InfPast());
   queue.Add([] {});
   ASSERT_LE(queue.OldestEnqueuedTimestamp(), grpc_core::Timestamp::Now());
@@ -115,8 +122,8 @@ TEST(WorkQueueTest, OldestEnqueuedTimestampIsSane) {
   delete popped;
 }
 
-TEST(WorkQueueTest, OldestEnqueuedTimestampOrderingIsCorrect) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, OldestEnqueuedTimestampOrderingIsCorrect) {
+  TypeParam queue;
   AnyInvocableClosure closure([] {});
   queue.Add(&closure);
   absl::SleepFor(absl::Milliseconds(2));
@@ -139,8 +146,8 @@ TEST(WorkQueueTest, OldestEnqueuedTimestampOrderingIsCorrect) {
   ASSERT_GT(youngest_ts, oldest_ts);
 }
 
-TEST(WorkQueueTest, ThreadedStress) {
-  WorkQueue queue;
+TYPED_TEST(WorkQueueTest, ThreadedStress) {
+  TypeParam queue;
   constexpr int thd_count = 33;
   constexpr int element_count_per_thd = 3333;
   std::vector<std::thread> threads;
@@ -167,6 +174,28 @@ TEST(WorkQueueTest, ThreadedStress) {
   EXPECT_TRUE(queue.Empty());
 }
 
+TEST(LockFreeWorkQueueTest, OverflowKeepsFifoOrder) {
+  LockFreeWorkQueue queue(/*capacity=*/2);
+  std::vector<int> ran;
+  for (int i = 0; i < 10; i++) {
+    queue.Add([&ran, i] { ran.push_back(i); });
+  }
+  while (auto* c = queue.PopFront()) c->Run();
+  EXPECT_EQ(ran, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(LockFreeWorkQueueTest, PopBackPrefersMostRecent) {
+  LockFreeWorkQueue queue(/*capacity=*/2);
+  std::vector<int> ran;
+  for (int i = 0; i < 5; i++) {
+    queue.Add([&ran, i] { ran.push_back(i); });
+  }
+  while (auto* c = queue.PopBack()) c->Run();
+  EXPECT_EQ(ran, std::vector<int>({4, 0, 1, 2, 3}));
+  EXPECT_TRUE(queue.Empty());
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
@@ -0,0 +1,95 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+AdaptiveConcurrencyLimit::Options TestOptions() {
+  AdaptiveConcurrencyLimit::Options options;
+  options.initial_limit = 10;
+  options.min_limit = 2;
+  options.max_limit = 100;
+  return options;
+}
+
+// Admits the current limit's worth of calls and completes them all with
+// \a latency.
+void RunFullBatch(AdaptiveConcurrencyLimit* limit, Duration latency) {
+  int admitted = 0;
+  while (limit->TryAcquire()) ++admitted;
+  for (int i = 0; i < admitted; ++i) limit->Release(latency);
+}
+
+TEST(AdaptiveConcurrencyLimitTest, RejectsBeyondLimit) {
+  AdaptiveConcurrencyLimit limit(TestOptions());
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(limit.TryAcquire());
+  EXPECT_FALSE(limit.TryAcquire());
+  EXPECT_EQ(limit.in_flight(), 10);
+  limit.Release(absl::nullopt);
+  EXPECT_TRUE(limit.TryAcquire());
+}
+
+TEST(AdaptiveConcurrencyLimitTest, GrowsWhileLatencyIsSteady) {
+  AdaptiveConcurrencyLimit limit(TestOptions());
+  for (int i = 0; i < 50; ++i) {
+    RunFullBatch(&limit, Duration::Milliseconds(10));
+  }
+  EXPECT_EQ(limit.limit(), 100);
+  EXPECT_EQ(limit.in_flight(), 0);
+}
+
+TEST(AdaptiveConcurrencyLimitTest, ShrinksWhenLatencyRises) {
+  AdaptiveConcurrencyLimit limit(TestOptions());
+  for (int i = 0; i < 50; ++i) {
+    RunFullBatch(&limit, Duration::Milliseconds(10));
+  }
+  for (int i = 0; i < 50; ++i) {
+    RunFullBatch(&limit, Duration::Milliseconds(100));
+  }
+  EXPECT_LT(limit.limit(), 20);
+  EXPECT_GE(limit.limit(), 2);
+  EXPECT_GE(limit.PushbackDelay(), Duration::Milliseconds(10));
+}
+
+TEST(AdaptiveConcurrencyLimitTest, IgnoresLatencyWhenMostlyIdle) {
+  AdaptiveConcurrencyLimit limit(TestOptions());
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(limit.TryAcquire());
+    limit.Release(Duration::Milliseconds(10));
+  }
+  EXPECT_EQ(limit.limit(), 10);
+}
+
+TEST(AdaptiveConcurrencyLimitTest, SharedPerMethod) {
+  auto a = AdaptiveConcurrencyLimit::ForMethod("/svc/A", TestOptions());
+  auto b = AdaptiveConcurrencyLimit::ForMethod("/svc/B", TestOptions());
+  EXPECT_EQ(a, AdaptiveConcurrencyLimit::ForMethod("/svc/A", TestOptions()));
+  EXPECT_NE(a, b);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/codegen/grpc_types.h>
+
+#include "src/core/ext/filters/deadline/deadline_filter.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// A call waiting for its deadline.
+class TestCall {
+ public:
+  TestCall() {
+    GRPC_CLOSURE_INIT(&on_deadline_, OnDeadline, this, nullptr);
+    entry_.on_deadline = &on_deadline_;
+  }
+
+  DeadlineTimerBuckets::Entry* entry() { return &entry_; }
+  Notification& done() { return done_; }
+  Timestamp fired_at() const { return fired_at_; }
+
+ private:
+  static void OnDeadline(void* arg, grpc_error_handle error) {
+    EXPECT_TRUE(error.ok());
+    auto* self = static_cast<TestCall*>(arg);
+    self->fired_at_ = Timestamp::Now();
+    self->done_.Notify();
+  }
+
+  DeadlineTimerBuckets::Entry entry_;
+  grpc_closure on_deadline_;
+  Timestamp fired_at_;
+  Notification done_;
+};
+
+TEST(DeadlineTimerBucketsTest, DisabledByDefault) {
+  EXPECT_EQ(DeadlineTimerBuckets::CreateFromChannelArgs(ChannelArgs()),
+            nullptr);
+  EXPECT_EQ(DeadlineTimerBuckets::CreateFromChannelArgs(ChannelArgs().Set(
+                GRPC_ARG_DEADLINE_TIMER_GRANULARITY_MS, 0)),
+            nullptr);
+  EXPECT_NE(DeadlineTimerBuckets::CreateFromChannelArgs(ChannelArgs().Set(
+                GRPC_ARG_DEADLINE_TIMER_GRANULARITY_MS, 10)),
+            nullptr);
+}
+
+TEST(DeadlineTimerBucketsTest, FiresNoEarlierThanDeadline) {
+  auto buckets = MakeOrphanable<DeadlineTimerBuckets>(Duration::Seconds(1));
+  TestCall calls[3];
+  Timestamp deadlines[3];
+  {
+    ExecCtx exec_ctx;
+    const Timestamp now = Timestamp::Now();
+    for (int i = 0; i < 3; i++) {
+      deadlines[i] = now + Duration::Milliseconds(100 + 300 * i);
+      buckets->Add(calls[i].entry(), deadlines[i]);
+    }
+  }
+  for (int i = 0; i < 3; i++) {
+    calls[i].done().WaitForNotification();
+    // Deadlines are rounded up to the granularity before they are waited for.
+    const int64_t millis = deadlines[i].milliseconds_after_process_epoch();
+    EXPECT_GE(calls[i].fired_at(),
+              Timestamp::FromMillisecondsAfterProcessEpoch(
+                  (millis + 999) / 1000 * 1000));
+    EXPECT_FALSE(buckets->Cancel(calls[i].entry()));
+  }
+}
+
+TEST(DeadlineTimerBucketsTest, CancelledCallsDoNotFire) {
+  auto buckets =
+      MakeOrphanable<DeadlineTimerBuckets>(Duration::Milliseconds(50));
+  TestCall cancelled;
+  TestCall kept;
+  {
+    ExecCtx exec_ctx;
+    const Timestamp deadline = Timestamp::Now() + Duration::Milliseconds(100);
+    buckets->Add(cancelled.entry(), deadline);
+    buckets->Add(kept.entry(), deadline);
+    EXPECT_TRUE(buckets->Cancel(cancelled.entry()));
+    EXPECT_FALSE(buckets->Cancel(cancelled.entry()));
+  }
+  kept.done().WaitForNotification();
+  EXPECT_FALSE(cancelled.done().HasBeenNotified());
+}
+
+TEST(DeadlineTimerBucketsTest, OrphanWithEmptyBuckets) {
+  auto buckets =
+      MakeOrphanable<DeadlineTimerBuckets>(Duration::Milliseconds(10));
+  TestCall call;
+  ExecCtx exec_ctx;
+  buckets->Add(call.entry(), Timestamp::Now() + Duration::Hours(1));
+  EXPECT_TRUE(buckets->Cancel(call.entry()));
+  buckets.reset();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
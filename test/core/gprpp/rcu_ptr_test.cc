@@ -0,0 +1,178 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/rcu_ptr.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Counts live instances, so tests can tell when a value is destroyed.
+class Value {
+ public:
+  Value(int value, std::atomic<int>* live) : value_(value), live_(live) {
+    live_->fetch_add(1);
+  }
+  ~Value() { live_->fetch_sub(1); }
+
+  int value() const { return value_; }
+
+ private:
+  const int value_;
+  std::atomic<int>* const live_;
+};
+
+TEST(RcuPtrTest, StartsEmpty) {
+  ExecCtx exec_ctx;
+  RcuPtr<Value> ptr([]() {});
+  EXPECT_EQ(ptr.get(), nullptr);
+  RcuPtr<Value>::ReadScope scope(&ptr);
+  EXPECT_EQ(scope.get(), nullptr);
+}
+
+TEST(RcuPtrTest, ReclaimWithoutReaders) {
+  ExecCtx exec_ctx;
+  std::atomic<int> live{0};
+  RcuPtr<Value> ptr([]() {});
+  ptr.Store(std::make_unique<Value>(1, &live));
+  EXPECT_EQ(ptr.retired(), 0u);
+  ptr.Store(std::make_unique<Value>(2, &live));
+  EXPECT_EQ(live.load(), 2);
+  EXPECT_EQ(ptr.retired(), 1u);
+  ptr.Reclaim();
+  EXPECT_EQ(live.load(), 1);
+  EXPECT_EQ(ptr.retired(), 0u);
+  EXPECT_EQ(ptr.get()->value(), 2);
+}
+
+TEST(RcuPtrTest, ReaderDefersReclaim) {
+  ExecCtx exec_ctx;
+  std::atomic<int> live{0};
+  int requests = 0;
+  RcuPtr<Value> ptr([&requests]() { ++requests; });
+  ptr.Store(std::make_unique<Value>(1, &live));
+  {
+    RcuPtr<Value>::ReadScope scope(&ptr);
+    ptr.Store(std::make_unique<Value>(2, &live));
+    ptr.Reclaim();
+    // The reader still sees the value it started with.
+    EXPECT_EQ(scope->value(), 1);
+    EXPECT_EQ(live.load(), 2);
+    EXPECT_EQ(ptr.retired(), 1u);
+    EXPECT_EQ(requests, 0);
+  }
+  // Leaving the scope asked for another pass, which can now reclaim.
+  EXPECT_EQ(requests, 1);
+  ptr.Reclaim();
+  EXPECT_EQ(live.load(), 1);
+  EXPECT_EQ(ptr.retired(), 0u);
+}
+
+TEST(RcuPtrTest, NewReaderDoesNotDeferReclaim) {
+  ExecCtx exec_ctx;
+  std::atomic<int> live{0};
+  RcuPtr<Value> ptr([]() {});
+  ptr.Store(std::make_unique<Value>(1, &live));
+  {
+    RcuPtr<Value>::ReadScope old_scope(&ptr);
+    ptr.Store(std::make_unique<Value>(2, &live));
+  }
+  // A reader that started after the Store() cannot see the retired value.
+  RcuPtr<Value>::ReadScope new_scope(&ptr);
+  EXPECT_EQ(new_scope->value(), 2);
+  ptr.Reclaim();
+  EXPECT_EQ(live.load(), 1);
+}
+
+TEST(RcuPtrTest, DestructorFreesRetiredValues) {
+  std::atomic<int> live{0};
+  {
+    ExecCtx exec_ctx;
+    RcuPtr<Value> ptr([]() {});
+    ptr.Store(std::make_unique<Value>(1, &live));
+    {
+      RcuPtr<Value>::ReadScope scope(&ptr);
+      ptr.Store(std::make_unique<Value>(2, &live));
+      ptr.Reclaim();
+    }
+    EXPECT_EQ(live.load(), 2);
+  }
+  EXPECT_EQ(live.load(), 0);
+}
+
+TEST(RcuPtrTest, ConcurrentReadersAndWriter) {
+  constexpr int kReaders = 8;
+  constexpr int kStores = 2000;
+  std::atomic<int> live{0};
+  std::atomic<bool> done{false};
+  std::atomic<bool> reclaim_requested{false};
+  RcuPtr<Value> ptr([&reclaim_requested]() { reclaim_requested = true; });
+  {
+    ExecCtx exec_ctx;
+    ptr.Store(std::make_unique<Value>(0, &live));
+  }
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kReaders; ++i) {
+    readers.emplace_back([&ptr, &done]() {
+      ExecCtx exec_ctx;
+      int last = 0;
+      while (!done.load()) {
+        RcuPtr<Value>::ReadScope scope(&ptr);
+        // Values are stored in increasing order and must not be destroyed
+        // while in use.
+        int value = scope->value();
+        EXPECT_GE(value, last);
+        last = value;
+      }
+    });
+  }
+  {
+    ExecCtx exec_ctx;
+    for (int i = 1; i <= kStores; ++i) {
+      ptr.Store(std::make_unique<Value>(i, &live));
+      ptr.Reclaim();
+      if (reclaim_requested.exchange(false)) ptr.Reclaim();
+    }
+    done = true;
+    for (auto& reader : readers) reader.join();
+    ptr.Reclaim();
+    EXPECT_EQ(ptr.retired(), 0u);
+    EXPECT_EQ(live.load(), 1);
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int retval = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return retval;
+}
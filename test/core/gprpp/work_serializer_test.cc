@@ -235,6 +235,53 @@ TEST(WorkSerializerTest, WorkSerializerDestructionRaceMultipleThreads) {
   }
 }
 
+TEST(KeyedWorkSerializerTest, SameKeyRunsInOrder) {
+  grpc_core::KeyedWorkSerializer lock;
+  int key;
+  std::vector<int> order;
+  for (int i = 0; i < 100; ++i) {
+    lock.Schedule(&key, [&order, i]() { order.push_back(i); }, DEBUG_LOCATION);
+  }
+  EXPECT_TRUE(order.empty());
+  lock.DrainQueue();
+  ASSERT_EQ(order.size(), 100u);
+  EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+
+TEST(KeyedWorkSerializerTest, ExecuteManyPerKeyInOrder) {
+  grpc_core::KeyedWorkSerializer lock(4);
+  constexpr int kNumKeys = 16;
+  constexpr int kNumThreads = 8;
+  constexpr int kPerThread = 1000;
+  std::vector<std::vector<int>> seen(kNumKeys);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < kPerThread; ++i) {
+        const int k = (t + i) % kNumKeys;
+        // Each thread contributes an increasing sequence to every key; the
+        // per-key order of a single thread's callbacks must be preserved.
+        lock.Run(
+            &seen[k],
+            [&seen, k, t, i]() { seen[k].push_back(t * kPerThread + i); },
+            DEBUG_LOCATION);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  lock.DrainQueue();
+  size_t total = 0;
+  for (const auto& per_key : seen) {
+    total += per_key.size();
+    std::vector<int> last(kNumThreads, -1);
+    for (int v : per_key) {
+      EXPECT_GT(v % kPerThread, last[v / kPerThread]);
+      last[v / kPerThread] = v % kPerThread;
+    }
+  }
+  EXPECT_EQ(total, static_cast<size_t>(kNumThreads * kPerThread));
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
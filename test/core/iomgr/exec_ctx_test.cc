@@ -0,0 +1,93 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/iomgr/closure.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(ExecCtxTest, RunQueuesUntilFlush) {
+  ExecCtx exec_ctx;
+  bool ran = false;
+  ExecCtx::Run(DEBUG_LOCATION, NewClosure([&ran](absl::Status) { ran = true; }),
+               absl::OkStatus());
+  EXPECT_FALSE(ran);
+  exec_ctx.Flush();
+  EXPECT_TRUE(ran);
+}
+
+TEST(ExecCtxTest, RunInlineRunsBeforeReturning) {
+  ExecCtx exec_ctx;
+  absl::Status seen;
+  ExecCtx::RunInline(
+      DEBUG_LOCATION,
+      NewClosure([&seen](absl::Status error) { seen = std::move(error); }),
+      absl::CancelledError("inline"));
+  EXPECT_EQ(seen, absl::CancelledError("inline"));
+  EXPECT_FALSE(exec_ctx.HasWork());
+}
+
+struct Chain {
+  grpc_closure closure;
+  int remaining;
+  int depth = 0;
+  int max_depth = 0;
+  int runs = 0;
+};
+
+void ChainStep(void* arg, grpc_error_handle /*error*/) {
+  Chain* chain = static_cast<Chain*>(arg);
+  ++chain->runs;
+  chain->max_depth = std::max(chain->max_depth, ++chain->depth);
+  if (--chain->remaining > 0) {
+    ExecCtx::RunInline(DEBUG_LOCATION, &chain->closure, absl::OkStatus());
+  }
+  --chain->depth;
+}
+
+TEST(ExecCtxTest, RunInlineDepthIsBounded) {
+  ExecCtx exec_ctx;
+  Chain chain;
+  chain.remaining = 3 * ExecCtx::kMaxInlineDepth;
+  GRPC_CLOSURE_INIT(&chain.closure, ChainStep, &chain, nullptr);
+  ExecCtx::RunInline(DEBUG_LOCATION, &chain.closure, absl::OkStatus());
+  // The step past the depth limit was queued instead of run.
+  EXPECT_EQ(chain.runs, ExecCtx::kMaxInlineDepth);
+  EXPECT_TRUE(exec_ctx.HasWork());
+  exec_ctx.Flush();
+  EXPECT_EQ(chain.runs, 3 * ExecCtx::kMaxInlineDepth);
+  // A queued step is run by Flush() and starts a new inline chain below it.
+  EXPECT_EQ(chain.max_depth, ExecCtx::kMaxInlineDepth + 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int retval = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return retval;
+}
@@ -156,6 +156,10 @@ TEST(SocketUtilsTest, MainTest) {
                                 grpc_set_socket_low_latency(sock, 1)));
   ASSERT_TRUE(GRPC_LOG_IF_ERROR("set_socket_low_latency",
                                 grpc_set_socket_low_latency(sock, 0)));
+#ifdef GPR_LINUX
+  ASSERT_TRUE(GRPC_LOG_IF_ERROR("set_socket_busy_poll",
+                                grpc_set_socket_busy_poll(sock, 0)));
+#endif
 
   test_with_vtable(&mutator_vtable);
   test_with_vtable(&mutator_vtable2);
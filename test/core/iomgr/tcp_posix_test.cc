@@ -31,6 +31,12 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
@@ -276,8 +282,10 @@ static void read_test(size_t num_bytes, size_t slice_size,
 }
 
 /* Write to a socket until it fills up, then read from it using the grpc_tcp
-   API. */
-static void large_read_test(size_t slice_size, int min_progress_size) {
+   API. If rx_zerocopy is true, the sockets are TCP sockets and the endpoint
+   maps large reads with TCP_ZEROCOPY_RECEIVE where the kernel supports it. */
+static void large_read_test(size_t slice_size, int min_progress_size,
+                            bool rx_zerocopy) {
   int sv[2];
   grpc_endpoint* ep;
   struct read_socket_state state;
@@ -286,11 +294,17 @@ static void large_read_test(size_t slice_size, int min_progress_size) {
       grpc_timeout_seconds_to_deadline(20));
   grpc_core::ExecCtx exec_ctx;
 
-  gpr_log(GPR_INFO, "Start large read test, slice size %" PRIuPTR, slice_size);
+  gpr_log(GPR_INFO,
+          "Start large read test, slice size %" PRIuPTR ", rx zerocopy %d",
+          slice_size, rx_zerocopy);
 
-  create_sockets(sv);
+  if (rx_zerocopy) {
+    create_inet_sockets(sv);
+  } else {
+    create_sockets(sv);
+  }
 
-  grpc_arg a[2];
+  grpc_arg a[4];
   a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
   a[0].type = GRPC_ARG_INTEGER;
   a[0].value.integer = static_cast<int>(slice_size);
@@ -298,6 +312,12 @@ static void large_read_test(size_t slice_size, int min_progress_size) {
   a[1].type = GRPC_ARG_POINTER;
   a[1].value.pointer.p = grpc_resource_quota_create("test");
   a[1].value.pointer.vtable = grpc_resource_quota_arg_vtable();
+  a[2].key = const_cast<char*>(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED);
+  a[2].type = GRPC_ARG_INTEGER;
+  a[2].value.integer = rx_zerocopy;
+  a[3].key = const_cast<char*>(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD);
+  a[3].type = GRPC_ARG_INTEGER;
+  a[3].value.integer = 4096;
   grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
   ep = grpc_tcp_create(
       grpc_fd_create(sv[1], "large_read_test", false),
@@ -523,6 +543,105 @@ static void write_test(size_t num_bytes, size_t slice_size,
       static_cast<grpc_resource_quota*>(a[1].value.pointer.p));
 }
 
+static std::string get_socket_option(grpc_endpoint* ep,
+                                     absl::string_view name) {
+  std::vector<std::pair<std::string, std::string>> options;
+  grpc_endpoint_get_socket_options(ep, &options);
+  for (auto& option : options) {
+    if (option.first == name) return option.second;
+  }
+  return "";
+}
+
+/* Write zerocopy-eligible buffers over loopback, where the kernel copies the
+   data anyway and reports SO_EE_CODE_ZEROCOPY_COPIED, and check that the
+   endpoint raises its zerocopy threshold in response. */
+static void zerocopy_threshold_adapts_test() {
+  constexpr size_t kThreshold = 16 * 1024;
+  constexpr size_t kWriteSize = 64 * 1024;
+  constexpr int kNumWrites = 64;
+  int sv[2];
+  struct write_socket_state state;
+  grpc_closure write_done_closure;
+  grpc_core::ExecCtx exec_ctx;
+
+  if (!grpc_event_engine_can_track_errors()) {
+    return;
+  }
+  gpr_log(GPR_INFO, "Start zerocopy threshold adapts test");
+  create_inet_sockets(sv);
+
+  grpc_arg a[3];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED);
+  a[0].type = GRPC_ARG_INTEGER;
+  a[0].value.integer = 1;
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD);
+  a[1].type = GRPC_ARG_INTEGER;
+  a[1].value.integer = static_cast<int>(kThreshold);
+  a[2].key = const_cast<char*>(GRPC_ARG_RESOURCE_QUOTA);
+  a[2].type = GRPC_ARG_POINTER;
+  a[2].value.pointer.p = grpc_resource_quota_create("test");
+  a[2].value.pointer.vtable = grpc_resource_quota_arg_vtable();
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  grpc_endpoint* ep = grpc_tcp_create(
+      grpc_fd_create(sv[1], "zerocopy_threshold_adapts_test", true),
+      TcpOptionsFromEndpointConfig(
+          grpc_event_engine::experimental::ChannelArgsEndpointConfig(
+              grpc_core::ChannelArgs::FromC(&args))),
+      "test");
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+  if (get_socket_option(ep, "tcp_tx_zerocopy_threshold_bytes").empty()) {
+    gpr_log(GPR_INFO, "TX zerocopy is unavailable, skipping");
+  } else {
+    GPR_ASSERT(get_socket_option(ep, "tcp_tx_zerocopy_threshold_bytes") ==
+               std::to_string(kThreshold));
+    state.ep = ep;
+    GRPC_CLOSURE_INIT(&write_done_closure, write_done, &state,
+                      grpc_schedule_on_exec_ctx);
+    uint8_t current_data = 0;
+    for (int i = 0; i < kNumWrites; ++i) {
+      size_t num_blocks;
+      grpc_slice* slices =
+          allocate_blocks(kWriteSize, kWriteSize, &num_blocks, &current_data);
+      grpc_slice_buffer outgoing;
+      grpc_slice_buffer_init(&outgoing);
+      grpc_slice_buffer_addn(&outgoing, slices, num_blocks);
+      state.write_done = 0;
+      grpc_endpoint_write(ep, &outgoing, &write_done_closure, nullptr,
+                          /*max_frame_size=*/INT_MAX);
+      drain_socket_blocking(sv[0], kWriteSize, kWriteSize);
+      exec_ctx.Flush();
+      gpr_mu_lock(g_mu);
+      while (!state.write_done) {
+        grpc_pollset_worker* worker = nullptr;
+        GPR_ASSERT(GRPC_LOG_IF_ERROR(
+            "pollset_work",
+            grpc_pollset_work(g_pollset, &worker,
+                              grpc_core::Timestamp::FromTimespecRoundUp(
+                                  grpc_timeout_milliseconds_to_deadline(10)))));
+        gpr_mu_unlock(g_mu);
+        exec_ctx.Flush();
+        gpr_mu_lock(g_mu);
+      }
+      gpr_mu_unlock(g_mu);
+      grpc_slice_buffer_destroy(&outgoing);
+      gpr_free(slices);
+    }
+    // Once the threshold reaches kWriteSize no more zerocopy sends are made.
+    gpr_log(GPR_INFO, "zerocopy threshold %s, copied percent %s",
+            get_socket_option(ep, "tcp_tx_zerocopy_threshold_bytes").c_str(),
+            get_socket_option(ep, "tcp_tx_zerocopy_copied_percent").c_str());
+    GPR_ASSERT(get_socket_option(ep, "tcp_tx_zerocopy_threshold_bytes") ==
+               std::to_string(kWriteSize));
+    GPR_ASSERT(get_socket_option(ep, "tcp_tx_zerocopy_copied_percent") ==
+               "100");
+  }
+  grpc_endpoint_destroy(ep);
+  close(sv[0]);
+  grpc_resource_quota_unref(
+      static_cast<grpc_resource_quota*>(a[2].value.pointer.p));
+}
+
 void on_fd_released(void* arg, grpc_error_handle /*errors*/) {
   int* done = static_cast<int*>(arg);
   *done = 1;
@@ -627,8 +746,9 @@ void run_tests(void) {
     read_test(10000, 8192, i);
     read_test(10000, 137, i);
     read_test(10000, 1, i);
-    large_read_test(8192, i);
-    large_read_test(1, i);
+    large_read_test(8192, i, false);
+    large_read_test(1, i, false);
+    large_read_test(8192, i, true);
   }
   write_test(100, 8192, false);
   write_test(100, 1, false);
@@ -647,6 +767,8 @@ void run_tests(void) {
     write_test(40320, i, true);
   }
 
+  zerocopy_threshold_adapts_test();
+
   release_fd_test(100, 8192);
 }
 
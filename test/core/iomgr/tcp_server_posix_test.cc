@@ -28,6 +28,10 @@
 #include <errno.h>
 #include <ifaddrs.h>
 #include <netinet/in.h>
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
 #include <stdio.h>
 #include <string.h>
 #include <sys/socket.h>
@@ -38,17 +42,20 @@
 
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/strerror.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/resolve_address.h"
+#include "src/core/lib/iomgr/socket_utils_posix.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "test/core/util/port.h"
@@ -467,6 +474,92 @@ static void test_connect(size_t num_connects,
   ASSERT_EQ(weak_ref.server, nullptr);
 }
 
+#ifdef GPR_LINUX
+static void pin_to_cpu(int cpu) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  ASSERT_EQ(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set),
+            0);
+}
+
+/* Returns true if a classic BPF program can be attached to a SO_REUSEPORT
+   group here; sandboxes may not allow it. */
+static bool cpu_steering_supported(void) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return false;
+  bool supported =
+      grpc_set_socket_reuse_port(fd, 1).ok() &&
+      grpc_set_socket_reuse_port_cpu_steering(fd, 2).ok();
+  close(fd);
+  return supported;
+}
+
+/* Tests that with GRPC_ARG_REUSEPORT_CPU_STEERING, the loopback connections
+   made from the first and last CPUs are accepted by the first and last
+   listener clones. */
+static void test_cpu_steering(void) {
+  grpc_core::ExecCtx exec_ctx;
+  const int num_cpus = static_cast<int>(gpr_cpu_num_cores());
+  if (num_cpus < 2 || !grpc_is_socket_reuse_port_supported() ||
+      !cpu_steering_supported()) {
+    gpr_log(GPR_INFO, "Skipping test_cpu_steering");
+    return;
+  }
+  LOG_TEST("test_cpu_steering");
+  cpu_set_t old_cpu_set;
+  ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(old_cpu_set),
+                                   &old_cpu_set),
+            0);
+  grpc_arg arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_REUSEPORT_CPU_STEERING), 2);
+  const grpc_channel_args channel_args = {1, &arg};
+  grpc_tcp_server* s;
+  ASSERT_EQ(absl::OkStatus(),
+            grpc_tcp_server_create(
+                nullptr,
+                grpc_event_engine::experimental::ChannelArgsEndpointConfig(
+                    grpc_core::CoreConfiguration::Get()
+                        .channel_args_preconditioning()
+                        .PreconditionChannelArgs(&channel_args)),
+                &s));
+  grpc_resolved_address resolved_addr;
+  memset(&resolved_addr, 0, sizeof(resolved_addr));
+  struct sockaddr_in* addr =
+      reinterpret_cast<struct sockaddr_in*>(resolved_addr.addr);
+  addr->sin_family = AF_INET;
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  resolved_addr.len = static_cast<socklen_t>(sizeof(*addr));
+  int port;
+  ASSERT_EQ(grpc_tcp_server_add_port(s, &resolved_addr, &port),
+            absl::OkStatus());
+  // Both listener clones are polled on g_pollset, so that tcp_connect() sees
+  // every connection.
+  std::vector<grpc_pollset*> pollsets = {g_pollset, g_pollset};
+  grpc_tcp_server_start(s, &pollsets, on_connect, nullptr);
+  ASSERT_EQ(grpc_tcp_server_port_fd_count(s, 0), 2);
+  test_addr dst;
+  dst.addr = resolved_addr;
+  ASSERT_TRUE(grpc_sockaddr_set_port(&dst.addr, port));
+  test_addr_init_str(&dst);
+  const int cpus[] = {0, num_cpus - 1};
+  for (unsigned listener = 0; listener < 2; ++listener) {
+    pin_to_cpu(cpus[listener]);
+    for (int i = 0; i < 5; ++i) {
+      on_connect_result result;
+      on_connect_result_init(&result);
+      ASSERT_TRUE(GRPC_LOG_IF_ERROR("tcp_connect", tcp_connect(&dst, &result)));
+      ASSERT_EQ(result.fd_index, listener);
+    }
+  }
+  ASSERT_EQ(pthread_setaffinity_np(pthread_self(), sizeof(old_cpu_set),
+                                   &old_cpu_set),
+            0);
+  grpc_tcp_server_unref(s);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+#endif /* GPR_LINUX */
+
 static void destroy_pollset(void* p, grpc_error_handle /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
@@ -538,6 +631,10 @@ TEST(TcpServerPosixTest, MainTest) {
     /* Test connect(2) with dst_addrs. */
     test_connect(10, &channel_args, dst_addrs, false);
 
+#ifdef GPR_LINUX
+    test_cpu_steering();
+#endif
+
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
     grpc_pollset_shutdown(g_pollset, &destroyed);
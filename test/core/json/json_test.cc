@@ -310,6 +310,28 @@ TEST(Json, Equality) {
   EXPECT_NE(Json(1), Json());
 }
 
+TEST(Json, WriterMatchesDump) {
+  const Json element = Json::Object{{"a", Json::Array{1, "x\n"}}, {"b", true}};
+  const Json json = Json::Object{
+      {"list", Json::Array{element, Json::Object{}, Json::Array{}}},
+      {"end", false}};
+  for (int indent : {0, 2}) {
+    JsonWriter writer(indent);
+    writer.StartObject();
+    writer.Key("end");
+    writer.Value(false);
+    writer.Key("list");
+    writer.StartArray();
+    writer.Value(element);
+    writer.StartObject();
+    writer.EndObject();
+    writer.Value(Json::Array{});
+    writer.EndArray();
+    writer.EndObject();
+    EXPECT_EQ(writer.TakeOutput(), json.Dump(indent));
+  }
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
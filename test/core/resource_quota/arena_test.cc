@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "absl/strings/str_join.h"
@@ -60,6 +61,20 @@ TEST(ArenaTest, ManagedNew) {
   arena->Destroy();
 }
 
+TEST(ArenaTest, CountsZoneAllocations) {
+  ExecCtx exec_ctx;
+  Arena* arena = Arena::Create(64, g_memory_allocator);
+  arena->Alloc(32);
+  EXPECT_EQ(arena->ZoneAllocations(), 0);
+  arena->Alloc(32);
+  EXPECT_EQ(arena->ZoneAllocations(), 0);
+  arena->Alloc(32);
+  EXPECT_EQ(arena->ZoneAllocations(), 1);
+  arena->Alloc(1024);
+  EXPECT_EQ(arena->ZoneAllocations(), 2);
+  arena->Destroy();
+}
+
 struct AllocShape {
   size_t initial_size;
   std::vector<size_t> allocs;
@@ -185,6 +200,27 @@ TEST(ArenaTest, PooledObjectsArePooled) {
   EXPECT_EQ(p, obj.get());
 }
 
+TEST(ArenaTest, PooledObjectsFreedByOtherThreadsArePooled) {
+  struct TestObj {
+    char a[100];
+  };
+
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  auto obj = arena->MakePooled<TestObj>();
+  void* p = obj.get();
+  std::thread([&obj] { obj.reset(); }).join();
+  obj = arena->MakePooled<TestObj>();
+  EXPECT_EQ(p, obj.get());
+  // Objects freed by the owning thread are only reused by that thread.
+  obj.reset();
+  std::thread([&arena, p] {
+    auto other = arena->MakePooled<TestObj>();
+    EXPECT_NE(p, other.get());
+  }).join();
+  obj = arena->MakePooled<TestObj>();
+  EXPECT_EQ(p, obj.get());
+}
+
 TEST(ArenaTest, CreateManyObjects) {
   struct TestObj {
     char a[100];
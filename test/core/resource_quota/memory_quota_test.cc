@@ -109,6 +109,41 @@ TEST(MemoryQuotaTest, CreateSomeObjectsAndExpectReclamation) {
   EXPECT_EQ(object2.get(), nullptr);
 }
 
+TEST(MemoryQuotaTest, SubQuotaChargesParentAndRespectsMinShare) {
+  ExecCtx exec_ctx;
+
+  MemoryQuota parent("parent");
+  parent.SetSize(8192);
+  MemoryQuota greedy("greedy", parent);
+  MemoryQuota modest("modest", parent);
+  modest.SetMinShare(8192);
+  auto greedy_owner = greedy.CreateMemoryOwner("greedy_owner");
+  auto modest_owner = modest.CreateMemoryOwner("modest_owner");
+  auto modest_object = modest_owner.MakeUnique<Sized<2048>>();
+  auto greedy_object = greedy_owner.MakeUnique<Sized<2048>>();
+
+  // The modest sub-quota is within its minimum share, so the parent running
+  // out of memory must not reclaim from it.
+  modest_owner.PostReclaimer(
+      ReclamationPass::kDestructive,
+      [&modest_object](absl::optional<ReclamationSweep> sweep) {
+        if (sweep.has_value()) modest_object.reset();
+      });
+  auto checker = CallChecker::Make();
+  greedy_owner.PostReclaimer(
+      ReclamationPass::kDestructive,
+      [&greedy_object, checker](absl::optional<ReclamationSweep> sweep) {
+        checker->Called();
+        EXPECT_TRUE(sweep.has_value());
+        greedy_object.reset();
+      });
+  // Push the parent into overcommit through the greedy sub-quota only.
+  auto greedy_object2 = greedy_owner.MakeUnique<Sized<4096>>();
+  exec_ctx.Flush();
+  EXPECT_EQ(greedy_object.get(), nullptr);
+  EXPECT_NE(modest_object.get(), nullptr);
+}
+
 TEST(MemoryQuotaTest, ReserveRangeNoPressure) {
   MemoryQuota memory_quota("foo");
   auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
@@ -203,6 +203,70 @@ TEST_F(AuthorizationMatchersTest,
   EXPECT_FALSE(matcher.Matches(args));
 }
 
+TEST_F(AuthorizationMatchersTest, OrOfExactPathsSuccessfulMatch) {
+  args_.AddPairToMetadata(":path", "/foo.Bar/Baz");
+  EvaluateArgs args = args_.MakeEvaluateArgs();
+  std::vector<std::unique_ptr<Rbac::Permission>> rules;
+  for (const char* path : {"/foo.Bar/Qux", "/foo.Bar/Baz"}) {
+    rules.push_back(
+        std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kExact, path).value())));
+  }
+  rules.push_back(std::make_unique<Rbac::Permission>(
+      Rbac::Permission::MakeDestPortPermission(/*port=*/456)));
+  auto matcher = AuthorizationMatcher::Create(
+      Rbac::Permission(Rbac::Permission::MakeOrPermission(std::move(rules))));
+  EXPECT_TRUE(matcher->Matches(args));
+}
+
+TEST_F(AuthorizationMatchersTest, OrOfExactPathsFailedMatch) {
+  args_.AddPairToMetadata(":path", "/foo.Bar/baz");
+  EvaluateArgs args = args_.MakeEvaluateArgs();
+  std::vector<std::unique_ptr<Rbac::Permission>> rules;
+  for (const char* path : {"/foo.Bar/Qux", "/foo.Bar/Baz"}) {
+    rules.push_back(
+        std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kExact, path).value())));
+  }
+  auto matcher = AuthorizationMatcher::Create(
+      Rbac::Permission(Rbac::Permission::MakeOrPermission(std::move(rules))));
+  // Exact path matching is case sensitive.
+  EXPECT_FALSE(matcher->Matches(args));
+}
+
+TEST_F(AuthorizationMatchersTest, OrOfExactPrincipalNamesSuccessfulMatch) {
+  args_.AddPropertyToAuthContext(GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+                                 GRPC_TLS_TRANSPORT_SECURITY_TYPE);
+  args_.AddPropertyToAuthContext(GRPC_PEER_DNS_PROPERTY_NAME,
+                                 "foo.domain.com");
+  EvaluateArgs args = args_.MakeEvaluateArgs();
+  std::vector<std::unique_ptr<Rbac::Principal>> ids;
+  for (const char* name : {"spiffe://foo.abc", "foo.domain.com"}) {
+    ids.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact, name).value())));
+  }
+  auto matcher = AuthorizationMatcher::Create(
+      Rbac::Principal(Rbac::Principal::MakeOrPrincipal(std::move(ids))));
+  EXPECT_TRUE(matcher->Matches(args));
+}
+
+TEST_F(AuthorizationMatchersTest, OrOfExactPrincipalNamesUnauthenticated) {
+  args_.AddPropertyToAuthContext(GRPC_PEER_DNS_PROPERTY_NAME,
+                                 "foo.domain.com");
+  EvaluateArgs args = args_.MakeEvaluateArgs();
+  std::vector<std::unique_ptr<Rbac::Principal>> ids;
+  for (const char* name : {"spiffe://foo.abc", "foo.domain.com"}) {
+    ids.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact, name).value())));
+  }
+  auto matcher = AuthorizationMatcher::Create(
+      Rbac::Principal(Rbac::Principal::MakeOrPrincipal(std::move(ids))));
+  // The connection is not authenticated.
+  EXPECT_FALSE(matcher->Matches(args));
+}
+
 TEST_F(AuthorizationMatchersTest, PathAuthorizationMatcherSuccessfulMatch) {
   args_.AddPairToMetadata(":path", "expected/path");
   EvaluateArgs args = args_.MakeEvaluateArgs();
@@ -19,6 +19,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <grpc/grpc_security_constants.h>
+
 namespace grpc_core {
 
 TEST(GrpcAuthorizationEngineTest, AllowEngineWithMatchingPolicy) {
@@ -54,6 +56,34 @@ TEST(GrpcAuthorizationEngineTest, AllowEngineWithNoMatchingPolicy) {
   EXPECT_TRUE(decision.matching_policy_name.empty());
 }
 
+Rbac MakeAllowPrincipalNameRbac(absl::string_view name) {
+  Rbac::Policy policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakeAuthenticatedPrincipal(
+          StringMatcher::Create(StringMatcher::Type::kExact, name).value()));
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy"] = std::move(policy);
+  return Rbac(Rbac::Action::kAllow, std::move(policies));
+}
+
+TEST(GrpcAuthorizationEngineTest, ConnectionPrincipalsAreCached) {
+  EvaluateArgs::PerChannelArgs channel_args(nullptr, nullptr);
+  channel_args.transport_security_type = GRPC_TLS_TRANSPORT_SECURITY_TYPE;
+  channel_args.subject = "foo";
+  GrpcAuthorizationEngine engine(MakeAllowPrincipalNameRbac("foo"));
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // Principals are assumed not to change during a connection, so the result
+  // of the first call is reused.
+  channel_args.subject = "bar";
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // Another engine does not see the results of the first one.
+  GrpcAuthorizationEngine other_engine(MakeAllowPrincipalNameRbac("foo"));
+  EXPECT_EQ(other_engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+}
+
 TEST(GrpcAuthorizationEngineTest, AllowEngineWithEmptyPolicies) {
   GrpcAuthorizationEngine engine(Rbac::Action::kAllow);
   AuthorizationEngine::Decision decision =
@@ -0,0 +1,109 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/slab_allocator.h"
+
+#include <string.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/cpu.h>
+
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(SlabAllocatorTest, SizeClasses) {
+  EXPECT_EQ(SlabAllocator::SizeClass(16), -1);
+  EXPECT_EQ(SlabAllocator::SizeClass(SlabAllocator::kMinSlabSize / 2 +
+                                     SlabAllocator::kSlabHeaderSize),
+            -1);
+  EXPECT_EQ(SlabAllocator::SizeClass(SlabAllocator::kMinSlabSize / 2 +
+                                     SlabAllocator::kSlabHeaderSize + 1),
+            0);
+  EXPECT_EQ(SlabAllocator::SizeClass(SlabAllocator::SizeClassBytes(0)), 0);
+  EXPECT_EQ(SlabAllocator::SizeClass(SlabAllocator::SizeClassBytes(0) + 1), 1);
+  EXPECT_EQ(SlabAllocator::SizeClass(8192 + 16), 4);
+  EXPECT_EQ(SlabAllocator::SizeClass(SlabAllocator::kMaxSlabSize +
+                                     SlabAllocator::kSlabHeaderSize),
+            SlabAllocator::kNumSizeClasses - 1);
+  EXPECT_EQ(SlabAllocator::SizeClass(SlabAllocator::kMaxSlabSize +
+                                     SlabAllocator::kSlabHeaderSize + 1),
+            -1);
+}
+
+TEST(SlabAllocatorTest, FreedStorageIsCachedAndReleased) {
+  SlabAllocator::ReleaseCachedSlabs();
+  std::vector<void*> allocated;
+  for (int i = 0; i < 16; ++i) {
+    void* p = SlabAllocator::Alloc(4096);
+    memset(p, 1, 4096);
+    allocated.push_back(p);
+  }
+  for (void* p : allocated) SlabAllocator::Free(p, 4096);
+  EXPECT_GT(SlabAllocator::CachedBytes(), 0);
+  EXPECT_LE(SlabAllocator::CachedBytes(),
+            allocated.size() *
+                SlabAllocator::SizeClassBytes(SlabAllocator::SizeClass(4096)));
+  size_t cached = SlabAllocator::CachedBytes();
+  EXPECT_EQ(SlabAllocator::ReleaseCachedSlabs(), cached);
+  EXPECT_EQ(SlabAllocator::CachedBytes(), 0);
+}
+
+TEST(SlabAllocatorTest, UncachedSizesAreNotCached) {
+  SlabAllocator::ReleaseCachedSlabs();
+  SlabAllocator::Free(SlabAllocator::Alloc(64), 64);
+  SlabAllocator::Free(SlabAllocator::Alloc(1024 * 1024), 1024 * 1024);
+  EXPECT_EQ(SlabAllocator::CachedBytes(), 0);
+}
+
+TEST(SlabAllocatorTest, CacheIsBounded) {
+  SlabAllocator::ReleaseCachedSlabs();
+  const size_t kSize = SlabAllocator::kMaxSlabSize;
+  const size_t kCount =
+      2 * gpr_cpu_num_cores() * SlabAllocator::kMaxCachedBytesPerCpu / kSize;
+  std::vector<void*> allocated;
+  for (size_t i = 0; i < kCount; ++i) {
+    allocated.push_back(SlabAllocator::Alloc(kSize));
+  }
+  for (void* p : allocated) SlabAllocator::Free(p, kSize);
+  EXPECT_LE(SlabAllocator::CachedBytes(),
+            gpr_cpu_num_cores() * SlabAllocator::kMaxCachedBytesPerCpu);
+  SlabAllocator::ReleaseCachedSlabs();
+}
+
+TEST(SlabAllocatorTest, SliceStorageIsCached) {
+  SlabAllocator::ReleaseCachedSlabs();
+  grpc_slice slice = grpc_slice_malloc(8192);
+  memset(GRPC_SLICE_START_PTR(slice), 1, GRPC_SLICE_LENGTH(slice));
+  grpc_slice_unref(slice);
+  EXPECT_EQ(SlabAllocator::CachedBytes(), SlabAllocator::SizeClassBytes(4));
+  slice = grpc_slice_malloc(100);
+  grpc_slice_unref(slice);
+  EXPECT_EQ(SlabAllocator::CachedBytes(), SlabAllocator::SizeClassBytes(4));
+  SlabAllocator::ReleaseCachedSlabs();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,6 +18,7 @@
 
 #include <string.h>
 
+#include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -27,6 +28,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 
 using ::grpc_core::Slice;
 using ::grpc_core::SliceBuffer;
@@ -78,6 +80,52 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, PrependWithoutTakeTest) {
+  SliceBuffer sb;
+  for (int i = 0; i < 100; i++) {
+    sb.Prepend(Slice::FromCopiedString(std::to_string(i % 10)));
+    if (i == 0) sb.Append(Slice::FromCopiedString("end"));
+  }
+  ASSERT_EQ(sb.Length(), 103);
+  std::string expected;
+  for (int i = 99; i >= 0; i--) expected += std::to_string(i % 10);
+  ASSERT_EQ(sb.JoinIntoString(), expected + "end");
+}
+
+TEST(SliceBufferTest, PrependMergesContiguousSliceTest) {
+  SliceBuffer sb;
+  Slice slice = MakeSlice(2 * kNewSliceLength);
+  grpc_slice c_slice = slice.TakeCSlice();
+  grpc_slice head = grpc_slice_split_head(&c_slice, kNewSliceLength);
+  sb.Append(Slice(c_slice));
+  sb.Prepend(Slice(head));
+  ASSERT_EQ(sb.Count(), 1);
+  ASSERT_EQ(sb.Length(), 2 * kNewSliceLength);
+}
+
+TEST(SliceBufferTest, UsedAsQueueTest) {
+  SliceBuffer sb;
+  for (int i = 0; i < 16; i++) sb.Append(MakeSlice(kNewSliceLength));
+  for (int i = 0; i < 1000; i++) {
+    sb.Append(MakeSlice(kNewSliceLength));
+    sb.TakeFirst();
+    ASSERT_EQ(sb.Count(), 16);
+  }
+  ASSERT_LE(sb.c_slice_buffer()->capacity, 64);
+}
+
+TEST(SliceBufferTest, MoveFirstNBytesIntoSliceBufferTest) {
+  SliceBuffer src;
+  SliceBuffer dst;
+  src.Append(MakeSlice(kNewSliceLength));
+  src.Append(MakeSlice(kNewSliceLength));
+  src.MoveFirstNBytesIntoSliceBuffer(kNewSliceLength + 1, dst);
+  ASSERT_EQ(src.Length(), kNewSliceLength - 1);
+  ASSERT_EQ(src.Count(), 1);
+  ASSERT_EQ(dst.Length(), kNewSliceLength + 1);
+  ASSERT_EQ(dst.Count(), 2);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -224,6 +224,31 @@ TEST(GrpcByteBufferReaderTest, TestReadall) {
   grpc_byte_buffer_destroy(buffer);
 }
 
+TEST(GrpcByteBufferReaderTest, TestReadallOneSlice) {
+  grpc_slice slice;
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice slice_out;
+
+  LOG_TEST("test_readall_one_slice");
+
+  /* use a slice large enough to overflow inlining */
+  slice = grpc_slice_malloc(1024);
+  memset(GRPC_SLICE_START_PTR(slice), 'a', 1024);
+  buffer = grpc_raw_byte_buffer_create(&slice, 1);
+
+  ASSERT_TRUE(grpc_byte_buffer_reader_init(&reader, buffer) &&
+              "Couldn't init byte buffer reader");
+  slice_out = grpc_byte_buffer_reader_readall(&reader);
+
+  /* a single slice is returned without copying it */
+  ASSERT_EQ(GRPC_SLICE_START_PTR(slice_out), GRPC_SLICE_START_PTR(slice));
+  ASSERT_EQ(GRPC_SLICE_LENGTH(slice_out), 1024);
+  grpc_slice_unref(slice);
+  grpc_slice_unref(slice_out);
+  grpc_byte_buffer_destroy(buffer);
+}
+
 TEST(GrpcByteBufferReaderTest, TestByteBufferCopy) {
   char* lotsa_as[512];
   char* lotsa_bs[1024];
@@ -170,6 +170,63 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_event events[8];
+  grpc_completion_queue* cc;
+  grpc_cq_completion completions[12];
+  void* tags[12];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr;
+
+  LOG_TEST("test_next_batch");
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    size_t n = grpc_completion_queue_next_batch(
+        cc, events, GPR_ARRAY_SIZE(events), gpr_inf_past(GPR_CLOCK_REALTIME),
+        nullptr);
+    ASSERT_EQ(n, 1u);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(completions); j++) {
+      tags[j] = create_test_tag();
+      ASSERT_TRUE(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], absl::OkStatus(), do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    // The events come back in order, at most as many as asked for at a time.
+    size_t num_events = 0;
+    while (num_events < GPR_ARRAY_SIZE(completions)) {
+      n = grpc_completion_queue_next_batch(cc, events, GPR_ARRAY_SIZE(events),
+                                           gpr_inf_past(GPR_CLOCK_REALTIME),
+                                           nullptr);
+      ASSERT_GE(n, 1u);
+      ASSERT_LE(n, GPR_ARRAY_SIZE(events));
+      for (size_t j = 0; j < n; j++) {
+        ASSERT_EQ(events[j].type, GRPC_OP_COMPLETE);
+        ASSERT_EQ(events[j].tag, tags[num_events++]);
+        ASSERT_TRUE(events[j].success);
+      }
+    }
+
+    grpc_completion_queue_shutdown(cc);
+    n = grpc_completion_queue_next_batch(cc, events, GPR_ARRAY_SIZE(events),
+                                         gpr_inf_past(GPR_CLOCK_REALTIME),
+                                         nullptr);
+    ASSERT_EQ(n, 1u);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cc);
+  }
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -174,6 +174,27 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+TEST(BinEncoderTest, KeepsBase64HuffmanForm) {
+  const char decoded[] = "foobar";
+  grpc_slice input = grpc_slice_from_static_string(decoded);
+  grpc_slice wire = grpc_chttp2_base64_encode_and_huffman_compress(input);
+  grpc_slice value = grpc_chttp2_slice_with_base64_huffman_form(
+      reinterpret_cast<const uint8_t*>(decoded), strlen(decoded),
+      GRPC_SLICE_START_PTR(wire), GRPC_SLICE_LENGTH(wire));
+  EXPECT_TRUE(grpc_slice_eq(value, input));
+  grpc_slice got;
+  ASSERT_TRUE(grpc_chttp2_get_base64_huffman_form(value, &got));
+  EXPECT_TRUE(grpc_slice_eq(got, wire));
+  grpc_slice_unref(got);
+  // A part of the value no longer matches the saved wire form.
+  grpc_slice part = grpc_slice_sub(value, 1, 3);
+  EXPECT_FALSE(grpc_chttp2_get_base64_huffman_form(part, &got));
+  EXPECT_FALSE(grpc_chttp2_get_base64_huffman_form(input, &got));
+  grpc_slice_unref(part);
+  grpc_slice_unref(value);
+  grpc_slice_unref(wire);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -33,6 +34,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/call_tracer.h"
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -167,6 +169,45 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
   exec_ctx.Flush();
 }
 
+class FakeTcpTracer : public TcpTracerInterface {
+ public:
+  void RecordEvent(Type type, const gpr_timespec& /*time*/,
+                   size_t byte_offset) override {
+    types.push_back(type);
+    byte_offsets.push_back(byte_offset);
+  }
+
+  std::vector<Type> types;
+  std::vector<size_t> byte_offsets;
+};
+
+// A TcpTracerInterface gets the timestamps instead of the write timestamps
+// callback, whose verifier would fail on the null context.
+TEST_F(ContextListTest, TcpTracerGetsTimestamps) {
+  ContextList* list = nullptr;
+  ExecCtx exec_ctx;
+  auto tracer = std::make_shared<FakeTcpTracer>();
+  ContextList::Append(&list, tracer, kByteOffset);
+  Timestamps ts;
+  ContextList::Execute(list, &ts, absl::OkStatus());
+  using Type = TcpTracerInterface::Type;
+  EXPECT_EQ(tracer->types, std::vector<Type>({Type::kSendMsg, Type::kScheduled,
+                                              Type::kSent, Type::kAcked}));
+  EXPECT_EQ(tracer->byte_offsets, std::vector<size_t>(4, kByteOffset));
+  exec_ctx.Flush();
+}
+
+// Writes that never got timestamps are not reported.
+TEST_F(ContextListTest, TcpTracerWithoutTimestamps) {
+  ContextList* list = nullptr;
+  ExecCtx exec_ctx;
+  auto tracer = std::make_shared<FakeTcpTracer>();
+  ContextList::Append(&list, tracer, kByteOffset);
+  ContextList::Execute(list, nullptr, absl::CancelledError());
+  EXPECT_TRUE(tracer->types.empty());
+  exec_ctx.Flush();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -165,6 +165,63 @@ TEST(FlowControl, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST(FlowControl, MemoryBudgetFollowsBdp) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, g_memory_owner);
+  tfc.EnableBdpMemoryBudget();
+  EXPECT_TRUE(tfc.bdp_memory_budget());
+  FlowControlAction action = tfc.PeriodicUpdate();
+  // The initial BDP estimate is 64k: streams get twice that.
+  EXPECT_EQ(action.send_initial_window_update(),
+            FlowControlAction::Urgency::QUEUE_UPDATE);
+  EXPECT_EQ(action.initial_window_size(), 131072);
+  EXPECT_EQ(tfc.sent_init_window(), 131072);
+  EXPECT_EQ(tfc.busy_streams(), 0);
+  EXPECT_EQ(tfc.memory_budget(), 131072);
+  EXPECT_EQ(tfc.target_window(), 131072);
+}
+
+TEST(FlowControl, MemoryBudgetNeedsBdpProbe) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", false, g_memory_owner);
+  tfc.EnableBdpMemoryBudget();
+  EXPECT_FALSE(tfc.bdp_memory_budget());
+  EXPECT_EQ(tfc.PeriodicUpdate(), FlowControlAction());
+}
+
+TEST(FlowControl, MemoryBudgetIsLentToBusyStreams) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, g_memory_owner);
+  tfc.EnableBdpMemoryBudget();
+  tfc.PeriodicUpdate();
+  StreamFlowControl busy(&tfc);
+  StreamFlowControl waiting(&tfc);
+  StreamFlowControl idle(&tfc);
+  for (StreamFlowControl* sfc : {&busy, &waiting}) {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(sfc);
+    sfc_upd.SetMinProgressSize(1024 * 1024);
+    sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(tfc.busy_streams(), 2);
+  EXPECT_EQ(tfc.memory_budget(), 2 * 131072);
+  // The first stream to announce may borrow the share of the other waiting
+  // stream, which leaves nothing beyond the initial window for the second.
+  EXPECT_EQ(busy.MaybeSendUpdate(), 131072);
+  EXPECT_EQ(waiting.MaybeSendUpdate(), 0);
+  EXPECT_EQ(idle.MaybeSendUpdate(), 0);
+  EXPECT_EQ(tfc.target_window(), 2 * 131072);
+  // Once the first reader has what it asked for the stream stops counting
+  // towards the budget.
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&busy);
+    EXPECT_EQ(sfc_upd.RecvData(1024), absl::OkStatus());
+    sfc_upd.SetMinProgressSize(0);
+    sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(tfc.busy_streams(), 1);
+  EXPECT_EQ(tfc.memory_budget(), 131072);
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
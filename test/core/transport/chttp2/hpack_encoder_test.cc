@@ -32,6 +32,8 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -154,10 +156,8 @@ static void CrashOnAppendError(absl::string_view, const grpc_core::Slice&) {
 
 grpc_slice EncodeHeaderIntoBytes(
     bool is_eof,
-    const std::vector<std::pair<std::string, std::string>>& header_fields) {
-  std::unique_ptr<grpc_core::HPackCompressor> compressor =
-      std::make_unique<grpc_core::HPackCompressor>();
-
+    const std::vector<std::pair<std::string, std::string>>& header_fields,
+    grpc_core::HPackCompressor* compressor) {
   auto arena = grpc_core::MakeScopedArena(1024, g_memory_allocator);
   grpc_metadata_batch b(arena.get());
 
@@ -187,6 +187,13 @@ grpc_slice EncodeHeaderIntoBytes(
   return ret;
 }
 
+grpc_slice EncodeHeaderIntoBytes(
+    bool is_eof,
+    const std::vector<std::pair<std::string, std::string>>& header_fields) {
+  grpc_core::HPackCompressor compressor;
+  return EncodeHeaderIntoBytes(is_eof, header_fields, &compressor);
+}
+
 /* verify that the output generated by encoding the stream matches the
    hexstring passed in */
 static void verify(
@@ -301,6 +308,56 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+MATCHER(HasIndexedHeaderField, "") {
+  constexpr size_t kHttp2FrameHeaderSize = 9u;
+  /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.1
+  return (GRPC_SLICE_START_PTR(arg)[kHttp2FrameHeaderSize] & 0x80) != 0;
+}
+
+TEST(HpackEncoderTest, HotMetadataIndexing) {
+  grpc_core::ExecCtx exec_ctx;
+  const std::vector<std::pair<std::string, std::string>> fields = {
+      {"x-hot-metadata", "some-token"}};
+  auto stats_before = grpc_core::global_stats().Collect();
+
+  // Custom metadata is not indexed until the process has sent it repeatedly.
+  grpc_core::HPackCompressor first;
+  first.SetIndexHotMetadata(true);
+  grpc_slice encoded = EncodeHeaderIntoBytes(false, fields, &first);
+  EXPECT_THAT(encoded, HasLiteralHeaderFieldNewNameFlagNoIndexing());
+  int sends = 1;
+  while (GRPC_SLICE_START_PTR(encoded)[9] == 0x00 && sends < 100) {
+    grpc_slice_unref(encoded);
+    encoded = EncodeHeaderIntoBytes(false, fields, &first);
+    ++sends;
+  }
+  EXPECT_THAT(encoded, HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  EXPECT_LT(sends, 100);
+  grpc_slice_unref(encoded);
+  encoded = EncodeHeaderIntoBytes(false, fields, &first);
+  EXPECT_THAT(encoded, HasIndexedHeaderField());
+  grpc_slice_unref(encoded);
+
+  // New connections index it on first use.
+  grpc_core::HPackCompressor second;
+  second.SetIndexHotMetadata(true);
+  encoded = EncodeHeaderIntoBytes(false, fields, &second);
+  EXPECT_THAT(encoded, HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  grpc_slice_unref(encoded);
+
+  // Unless they did not opt in.
+  encoded = EncodeHeaderIntoBytes(false, fields);
+  EXPECT_THAT(encoded, HasLiteralHeaderFieldNewNameFlagNoIndexing());
+  grpc_slice_unref(encoded);
+
+  auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  EXPECT_EQ(stats
+                ->histogram(grpc_core::GlobalStats::Histogram::
+                                kHttp2HpackHotMetadataBytesSaved)
+                .Count(),
+            1);
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   auto arena = grpc_core::MakeScopedArena(1024, g_memory_allocator);
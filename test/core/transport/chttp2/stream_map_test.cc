@@ -18,6 +18,11 @@
 
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include <grpc/support/log.h>
@@ -73,14 +78,14 @@ static void test_basic_add_find(uint32_t n) {
 
 /* verify that for_each gets the right values during test_delete_evens_XXX */
 static void verify_for_each(void* user_data, uint32_t stream_id, void* ptr) {
-  uint32_t* for_each_check = static_cast<uint32_t*>(user_data);
-  ASSERT_TRUE(ptr);
-  ASSERT_EQ(*for_each_check, stream_id);
-  *for_each_check += 2;
+  uint32_t* for_each_count = static_cast<uint32_t*>(user_data);
+  ASSERT_EQ(stream_id, reinterpret_cast<uintptr_t>(ptr));
+  ASSERT_EQ(stream_id & 1, 1);
+  ++*for_each_count;
 }
 
 static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
-  uint32_t for_each_check = 1;
+  uint32_t for_each_count = 0;
   uint32_t i;
   size_t got;
 
@@ -95,12 +100,8 @@ static void check_delete_evens(grpc_chttp2_stream_map* map, uint32_t n) {
     }
   }
 
-  grpc_chttp2_stream_map_for_each(map, verify_for_each, &for_each_check);
-  if (n & 1) {
-    ASSERT_EQ(for_each_check, n + 2);
-  } else {
-    ASSERT_EQ(for_each_check, n + 1);
-  }
+  grpc_chttp2_stream_map_for_each(map, verify_for_each, &for_each_count);
+  ASSERT_EQ(for_each_count, (n + 1) / 2);
 }
 
 /* add a bunch of keys, delete the even ones, and make sure the map is
@@ -169,6 +170,96 @@ static void test_periodic_compaction(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
+/* add client stream ids and make sure rand only returns live entries */
+static void test_rand(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+  uintptr_t got;
+
+  LOG_TEST("test_rand");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  ASSERT_EQ(nullptr, grpc_chttp2_stream_map_rand(&map));
+  for (i = 1; i <= n; i++) {
+    grpc_chttp2_stream_map_add(&map, 2 * i - 1,
+                               reinterpret_cast<void*>(2 * i - 1));
+  }
+  for (i = 1; i < n; i++) {
+    grpc_chttp2_stream_map_delete(&map, 2 * i - 1);
+    got = reinterpret_cast<uintptr_t>(grpc_chttp2_stream_map_rand(&map));
+    ASSERT_GE(got, 2 * i + 1);
+    ASSERT_EQ(got & 1, 1);
+  }
+  ASSERT_EQ(2 * n - 1,
+            reinterpret_cast<uintptr_t>(grpc_chttp2_stream_map_rand(&map)));
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
+static void delete_in_for_each(void* user_data, uint32_t stream_id,
+                               void* /*ptr*/) {
+  grpc_chttp2_stream_map* map = static_cast<grpc_chttp2_stream_map*>(user_data);
+  ASSERT_EQ(reinterpret_cast<void*>(stream_id),
+            grpc_chttp2_stream_map_delete(map, stream_id));
+}
+
+/* delete every entry from within for_each, as transport shutdown does */
+static void test_delete_in_for_each(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+
+  LOG_TEST("test_delete_in_for_each");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (i = 1; i <= n; i++) {
+    grpc_chttp2_stream_map_add(&map, 2 * i - 1,
+                               reinterpret_cast<void*>(2 * i - 1));
+  }
+  grpc_chttp2_stream_map_for_each(&map, delete_in_for_each, &map);
+  ASSERT_EQ(0, grpc_chttp2_stream_map_size(&map));
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
+/* open client streams and close random ones, checking the map against the
+   set of streams that should be alive */
+static void test_random_churn(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  std::vector<uint32_t> live;
+  uint32_t next_id = 1;
+  uint32_t i;
+
+  LOG_TEST("test_random_churn");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (i = 0; i < 4 * n; i++) {
+    if (live.empty() || rand() % 3 != 0) {
+      grpc_chttp2_stream_map_add(&map, next_id,
+                                 reinterpret_cast<void*>(next_id));
+      live.push_back(next_id);
+      next_id += 2;
+    } else {
+      size_t victim = static_cast<size_t>(rand()) % live.size();
+      ASSERT_EQ(reinterpret_cast<void*>(live[victim]),
+                grpc_chttp2_stream_map_delete(&map, live[victim]));
+      live[victim] = live.back();
+      live.pop_back();
+    }
+  }
+  ASSERT_EQ(live.size(), grpc_chttp2_stream_map_size(&map));
+  for (uint32_t id : live) {
+    ASSERT_EQ(reinterpret_cast<void*>(id),
+              grpc_chttp2_stream_map_find(&map, id));
+  }
+  for (i = 1; i < next_id; i += 2) {
+    if (std::find(live.begin(), live.end(), i) == live.end()) {
+      ASSERT_EQ(nullptr, grpc_chttp2_stream_map_find(&map, i));
+    }
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
 TEST(StreamMapTest, MainTest) {
   uint32_t n = 1;
   uint32_t prev = 1;
@@ -182,6 +273,9 @@ TEST(StreamMapTest, MainTest) {
     test_delete_evens_sweep(n);
     test_delete_evens_incremental(n);
     test_periodic_compaction(n);
+    test_rand(n);
+    test_delete_in_for_each(n);
+    if (n < 10000) test_random_churn(n);
 
     tmp = n;
     n += prev;
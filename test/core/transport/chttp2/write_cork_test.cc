@@ -0,0 +1,199 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stdint.h>
+#include <string.h>
+
+#include <memory>
+#include <set>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include <grpc/byte_buffer.h>
+#include <grpc/byte_buffer_reader.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/codegen/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kNumCalls = 8;
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+std::string ReadPayload(grpc_byte_buffer* payload) {
+  grpc_byte_buffer_reader reader;
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, payload));
+  grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+  std::string result(StringViewFromSlice(slice));
+  grpc_slice_unref(slice);
+  grpc_byte_buffer_reader_destroy(&reader);
+  return result;
+}
+
+class WriteCorkTest : public ::testing::Test {
+ protected:
+  WriteCorkTest() {
+    // BDP pings would start writes of their own.
+    auto args = ChannelArgs()
+                    .Set(GRPC_ARG_HTTP2_WRITE_CORK_DELAY_US, 10000)
+                    .Set(GRPC_ARG_HTTP2_BDP_PROBE, 0);
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    server_ = grpc_server_create(args.ToC().get(), nullptr);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    std::string address = JoinHostPort("[::1]", grpc_pick_unused_port_or_die());
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    GPR_ASSERT(
+        grpc_server_add_http2_port(server_, address.c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+    grpc_server_start(server_);
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    channel_ = grpc_channel_create(absl::StrCat("ipv6:", address).c_str(),
+                                   creds, args.ToC().get());
+    grpc_channel_credentials_release(creds);
+  }
+
+  ~WriteCorkTest() override {
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    grpc_server_cancel_all_calls(server_);
+    cqv_->Expect(Tag(1000), true);
+    cqv_->Verify();
+    grpc_server_destroy(server_);
+    grpc_channel_destroy(channel_);
+    cqv_.reset();
+    grpc_completion_queue_shutdown(cq_);
+    while (grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  grpc_completion_queue* cq_;
+  std::unique_ptr<CqVerifier> cqv_;
+  grpc_server* server_;
+  grpc_channel* channel_;
+};
+
+TEST_F(WriteCorkTest, MessagesOfManyStreamsShareCorkedWrites) {
+  grpc_call* client_calls[kNumCalls];
+  grpc_call* server_calls[kNumCalls];
+  grpc_call_details call_details[kNumCalls];
+  grpc_metadata_array request_metadata[kNumCalls];
+  grpc_byte_buffer* received[kNumCalls];
+  // Start the streams: their headers are written right away.
+  for (int i = 0; i < kNumCalls; ++i) {
+    client_calls[i] = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, cq_,
+        grpc_slice_from_static_string("/foo"), nullptr,
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    grpc_op op;
+    memset(&op, 0, sizeof(op));
+    op.op = GRPC_OP_SEND_INITIAL_METADATA;
+    EXPECT_EQ(grpc_call_start_batch(client_calls[i], &op, 1, Tag(100 + i),
+                                    nullptr),
+              GRPC_CALL_OK);
+    grpc_call_details_init(&call_details[i]);
+    grpc_metadata_array_init(&request_metadata[i]);
+    EXPECT_EQ(grpc_server_request_call(server_, &server_calls[i],
+                                       &call_details[i], &request_metadata[i],
+                                       cq_, cq_, Tag(200 + i)),
+              GRPC_CALL_OK);
+    cqv_->Expect(Tag(100 + i), true);
+    cqv_->Expect(Tag(200 + i), true);
+  }
+  cqv_->Verify();
+  // Send a small message on every stream in quick succession: they should be
+  // held back and written together.
+  auto before = global_stats().Collect();
+  for (int i = 0; i < kNumCalls; ++i) {
+    grpc_slice payload_slice =
+        grpc_slice_from_cpp_string(absl::StrCat("message ", i));
+    grpc_byte_buffer* payload = grpc_raw_byte_buffer_create(&payload_slice, 1);
+    grpc_slice_unref(payload_slice);
+    grpc_op op;
+    memset(&op, 0, sizeof(op));
+    op.op = GRPC_OP_SEND_MESSAGE;
+    op.data.send_message.send_message = payload;
+    EXPECT_EQ(grpc_call_start_batch(client_calls[i], &op, 1, Tag(300 + i),
+                                    nullptr),
+              GRPC_CALL_OK);
+    grpc_byte_buffer_destroy(payload);
+    cqv_->Expect(Tag(300 + i), true);
+  }
+  for (int i = 0; i < kNumCalls; ++i) {
+    grpc_op op;
+    memset(&op, 0, sizeof(op));
+    op.op = GRPC_OP_RECV_MESSAGE;
+    op.data.recv_message.recv_message = &received[i];
+    EXPECT_EQ(grpc_call_start_batch(server_calls[i], &op, 1, Tag(400 + i),
+                                    nullptr),
+              GRPC_CALL_OK);
+    cqv_->Expect(Tag(400 + i), true);
+  }
+  cqv_->Verify();
+  auto stats = global_stats().Collect()->Diff(*before);
+  // The server does not necessarily match calls in the order they started.
+  std::set<std::string> expected_payloads;
+  std::set<std::string> payloads;
+  for (int i = 0; i < kNumCalls; ++i) {
+    expected_payloads.insert(absl::StrCat("message ", i));
+    ASSERT_NE(received[i], nullptr);
+    payloads.insert(ReadPayload(received[i]));
+    grpc_byte_buffer_destroy(received[i]);
+  }
+  EXPECT_EQ(payloads, expected_payloads);
+  EXPECT_GE(stats->http2_writes_corked, 1);
+  EXPECT_LT(stats->http2_writes_corked, kNumCalls);
+  EXPECT_GE(
+      stats->histogram(GlobalStats::Histogram::kHttp2CorkBatchSize).Count(),
+      1);
+  for (int i = 0; i < kNumCalls; ++i) {
+    grpc_call_cancel(client_calls[i], nullptr);
+    grpc_call_unref(client_calls[i]);
+    grpc_call_unref(server_calls[i]);
+    grpc_call_details_destroy(&call_details[i]);
+    grpc_metadata_array_destroy(&request_metadata[i]);
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
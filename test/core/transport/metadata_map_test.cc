@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
 #include "absl/types/optional.h"
@@ -138,6 +139,92 @@ TEST(MetadataMapTest, NonEncodableTrait) {
   EXPECT_EQ(map.DebugString(), "GrpcStreamNetworkState: not sent on wire");
 }
 
+// Records the data pointer of each unknown key it is given.
+class KeyPointerEncoder {
+ public:
+  void Encode(const Slice& key, const Slice&) { keys_.push_back(key.data()); }
+
+  const std::vector<const uint8_t*>& keys() const { return keys_; }
+
+ private:
+  std::vector<const uint8_t*> keys_;
+};
+
+TEST(MetadataMapTest, RegisteredCustomKeys) {
+  auto on_error = [](absl::string_view, const Slice&) { abort(); };
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  EmptyMetadataMap before_registration(arena.get());
+  before_registration.Append("x-late-tenant", Slice::FromCopiedString("a"),
+                             on_error);
+  ASSERT_TRUE(RegisterCustomMetadataKey("x-tenant"));
+  ASSERT_TRUE(RegisterCustomMetadataKey("x-late-tenant"));
+  // Registering again is a no-op.
+  ASSERT_TRUE(RegisterCustomMetadataKey("x-tenant"));
+  // Keys appended before they were registered are still found.
+  std::string buffer;
+  EXPECT_EQ(before_registration.GetStringValue("x-late-tenant", &buffer), "a");
+  EmptyMetadataMap map1(arena.get());
+  EmptyMetadataMap map2(arena.get());
+  EXPECT_EQ(map1.GetStringValue("x-tenant", &buffer), absl::nullopt);
+  map1.Append("x-tenant", Slice::FromCopiedString("a"), on_error);
+  map1.Append("x-tenant", Slice::FromCopiedString("b"), on_error);
+  map1.Append("x-other", Slice::FromCopiedString("c"), on_error);
+  map2.Append("x-tenant", Slice::FromCopiedString("d"), on_error);
+  EXPECT_EQ(map1.GetStringValue("x-tenant", &buffer), "a,b");
+  EXPECT_EQ(map2.GetStringValue("x-tenant", &buffer), "d");
+  // Both maps share the interned key rather than holding copies.
+  KeyPointerEncoder encoder1;
+  KeyPointerEncoder encoder2;
+  map1.Encode(&encoder1);
+  map2.Encode(&encoder2);
+  ASSERT_EQ(encoder1.keys().size(), 3u);
+  ASSERT_EQ(encoder2.keys().size(), 1u);
+  EXPECT_EQ(encoder1.keys()[0], encoder2.keys()[0]);
+  EXPECT_EQ(encoder1.keys()[1], encoder2.keys()[0]);
+  map1.Remove("x-tenant");
+  EXPECT_EQ(map1.GetStringValue("x-tenant", &buffer), absl::nullopt);
+  EXPECT_EQ(map1.GetStringValue("x-other", &buffer), "c");
+  map1.Append("x-tenant", Slice::FromCopiedString("e"), on_error);
+  EXPECT_EQ(map1.GetStringValue("x-tenant", &buffer), "e");
+}
+
+TEST(MetadataMapTest, ParseSharesRegisteredCustomKey) {
+  auto on_error = [](absl::string_view, const Slice&) { abort(); };
+  ASSERT_TRUE(RegisterCustomMetadataKey("x-parsed-tenant"));
+  auto md1 = EmptyMetadataMap::Parse(
+      "x-parsed-tenant", Slice::FromCopiedString("a"), 0, on_error);
+  auto md2 = EmptyMetadataMap::Parse(
+      "x-parsed-tenant", Slice::FromCopiedString("b"), 0, on_error);
+  EXPECT_EQ(md1.key(), "x-parsed-tenant");
+  EXPECT_EQ(md1.key().data(), md2.key().data());
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  EmptyMetadataMap map(arena.get());
+  map.Set(md1);
+  std::string buffer;
+  EXPECT_EQ(map.GetStringValue("x-parsed-tenant", &buffer), "a");
+}
+
+TEST(MetadataMapTest, CopyAndAppendUnknownShareKeys) {
+  auto on_error = [](absl::string_view, const Slice&) { abort(); };
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  EmptyMetadataMap map(arena.get());
+  map.Append("x-unregistered", Slice::FromCopiedString("a"), on_error);
+  EmptyMetadataMap copy = map.Copy();
+  EmptyMetadataMap appended(arena.get());
+  appended.AppendUnknown(Slice::FromCopiedString("x-appended"),
+                         Slice::FromCopiedString("b"));
+  std::string buffer;
+  EXPECT_EQ(copy.GetStringValue("x-unregistered", &buffer), "a");
+  EXPECT_EQ(appended.GetStringValue("x-appended", &buffer), "b");
+  KeyPointerEncoder original_keys;
+  KeyPointerEncoder copied_keys;
+  map.Encode(&original_keys);
+  copy.Encode(&copied_keys);
+  ASSERT_EQ(original_keys.keys().size(), 1u);
+  ASSERT_EQ(copied_keys.keys().size(), 1u);
+  EXPECT_EQ(original_keys.keys()[0], copied_keys.keys()[0]);
+}
+
 TEST(DebugStringBuilderTest, AddOne) {
   metadata_detail::DebugStringBuilder b;
   b.Add("a", "b");
@@ -0,0 +1,174 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/transport/promise_endpoint.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include "src/core/lib/promise/activity.h"
+#include "test/core/promise/test_wakeup_schedulers.h"
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::Slice;
+using grpc_event_engine::experimental::SliceBuffer;
+
+namespace grpc_core {
+namespace {
+
+// Holds on to the callbacks of the reads and writes it is given, so that
+// tests can complete them when they like.
+class FakeEndpoint : public EventEngine::Endpoint {
+ public:
+  void Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            SliceBuffer* buffer, const ReadArgs* /*args*/) override {
+    ASSERT_EQ(on_read_, nullptr);
+    on_read_ = std::move(on_read);
+    read_buffer_ = buffer;
+    ++reads;
+  }
+  void Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data, const WriteArgs* /*args*/) override {
+    ASSERT_EQ(on_writable_, nullptr);
+    on_writable_ = std::move(on_writable);
+    written = data->Length();
+  }
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return address_;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return address_;
+  }
+
+  void CompleteRead(absl::string_view data, absl::Status status) {
+    read_buffer_->Append(Slice::FromCopiedString(data));
+    std::exchange(on_read_, nullptr)(std::move(status));
+  }
+  void CompleteWrite(absl::Status status) {
+    std::exchange(on_writable_, nullptr)(std::move(status));
+  }
+
+  int reads = 0;
+  size_t written = 0;
+
+ private:
+  absl::AnyInvocable<void(absl::Status)> on_read_;
+  SliceBuffer* read_buffer_ = nullptr;
+  absl::AnyInvocable<void(absl::Status)> on_writable_;
+  EventEngine::ResolvedAddress address_;
+};
+
+std::string ToString(SliceBuffer& buffer) {
+  std::string out;
+  for (size_t i = 0; i < buffer.Count(); ++i) {
+    out.append(std::string(buffer.RefSlice(i).as_string_view()));
+  }
+  return out;
+}
+
+SliceBuffer FromString(absl::string_view data) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(data));
+  return buffer;
+}
+
+TEST(PromiseEndpointTest, ReadsAlreadyReceivedBytesFirst) {
+  auto* fake = new FakeEndpoint();
+  PromiseEndpoint endpoint(std::unique_ptr<FakeEndpoint>(fake),
+                           FromString("hello world"));
+  absl::optional<std::string> got;
+  auto activity = MakeActivity(
+      endpoint.Read(5), InlineWakeupScheduler(),
+      [&got](absl::StatusOr<SliceBuffer> result) {
+        ASSERT_TRUE(result.ok());
+        got = ToString(*result);
+      });
+  EXPECT_EQ(got, "hello");
+  EXPECT_EQ(fake->reads, 0);
+}
+
+TEST(PromiseEndpointTest, ReadsUntilEnoughBytesArrived) {
+  auto* fake = new FakeEndpoint();
+  PromiseEndpoint endpoint(std::unique_ptr<FakeEndpoint>(fake),
+                           SliceBuffer());
+  absl::optional<std::string> got;
+  auto activity = MakeActivity(
+      endpoint.Read(6), InlineWakeupScheduler(),
+      [&got](absl::StatusOr<SliceBuffer> result) {
+        ASSERT_TRUE(result.ok());
+        got = ToString(*result);
+      });
+  EXPECT_EQ(fake->reads, 1);
+  fake->CompleteRead("abc", absl::OkStatus());
+  EXPECT_FALSE(got.has_value());
+  EXPECT_EQ(fake->reads, 2);
+  fake->CompleteRead("defgh", absl::OkStatus());
+  EXPECT_EQ(got, "abcdef");
+  // The bytes beyond the read are kept for the next one.
+  auto next = MakeActivity(
+      endpoint.Read(2), InlineWakeupScheduler(),
+      [&got](absl::StatusOr<SliceBuffer> result) {
+        ASSERT_TRUE(result.ok());
+        got = ToString(*result);
+      });
+  EXPECT_EQ(got, "gh");
+  EXPECT_EQ(fake->reads, 2);
+}
+
+TEST(PromiseEndpointTest, ReadFailure) {
+  auto* fake = new FakeEndpoint();
+  PromiseEndpoint endpoint(std::unique_ptr<FakeEndpoint>(fake),
+                           SliceBuffer());
+  absl::optional<absl::Status> status;
+  auto activity = MakeActivity(
+      endpoint.Read(4), InlineWakeupScheduler(),
+      [&status](absl::StatusOr<SliceBuffer> result) {
+        status = result.status();
+      });
+  fake->CompleteRead("ab", absl::UnavailableError("connection reset"));
+  EXPECT_EQ(status, absl::UnavailableError("connection reset"));
+}
+
+TEST(PromiseEndpointTest, Write) {
+  auto* fake = new FakeEndpoint();
+  PromiseEndpoint endpoint(std::unique_ptr<FakeEndpoint>(fake),
+                           SliceBuffer());
+  absl::optional<absl::Status> status;
+  auto activity = MakeActivity(
+      endpoint.Write(FromString("payload")), InlineWakeupScheduler(),
+      [&status](absl::Status result) { status = std::move(result); });
+  EXPECT_EQ(fake->written, 7);
+  EXPECT_FALSE(status.has_value());
+  fake->CompleteWrite(absl::OkStatus());
+  EXPECT_EQ(status, absl::OkStatus());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,6 +18,7 @@
 
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 
@@ -26,6 +27,8 @@
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "test/core/util/test_config.h"
 
 namespace grpc_core {
@@ -142,6 +145,55 @@ TEST(SslSessionCacheTest, LruCache) {
   EXPECT_EQ(tracker.AliveCount(), 0);
 }
 
+TEST(SslSessionCacheTest, ShardedCache) {
+  constexpr size_t kCapacity = 1000;
+  SessionTracker tracker;
+  {
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(kCapacity);
+    for (size_t id = 0; id < kCapacity; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+    }
+    // Every shard has its share of the capacity, so nothing is evicted
+    // until the whole capacity is used...
+    EXPECT_EQ(cache->Size(), kCapacity);
+    EXPECT_EQ(tracker.AliveCount(), kCapacity);
+    for (size_t id = 0; id < kCapacity; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      EXPECT_TRUE(cache->Get(domain.c_str())) << domain;
+    }
+    // ...and it is never exceeded.
+    for (size_t id = kCapacity; id < 2 * kCapacity; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+    }
+    EXPECT_LE(cache->Size(), kCapacity);
+    EXPECT_EQ(tracker.AliveCount(), cache->Size());
+  }
+  EXPECT_EQ(tracker.AliveCount(), 0);
+}
+
+TEST(SslSessionCacheTest, Stats) {
+  SessionTracker tracker;
+  std::unique_ptr<GlobalStats> before = global_stats().Collect();
+  {
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(1);
+    EXPECT_FALSE(cache->Get("first.dropbox.com"));
+    cache->Put("first.dropbox.com", tracker.NewSession(1));
+    EXPECT_TRUE(cache->Get("first.dropbox.com"));
+    EXPECT_TRUE(cache->Get("first.dropbox.com"));
+    cache->Put("second.dropbox.com", tracker.NewSession(2));
+    EXPECT_FALSE(tracker.IsAlive(1));
+  }
+  std::unique_ptr<GlobalStats> diff =
+      global_stats().Collect()->Diff(*before);
+  EXPECT_EQ(diff->ssl_session_cache_hits, 2u);
+  EXPECT_EQ(diff->ssl_session_cache_misses, 1u);
+  EXPECT_EQ(diff->ssl_session_cache_evictions, 1u);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -32,7 +32,7 @@ class MockAuthorizationEndpoint : public grpc_endpoint {
       : local_address_(local_uri), peer_address_(peer_uri) {
     static constexpr grpc_endpoint_vtable vtable = {
         nullptr, nullptr, nullptr,         nullptr, nullptr, nullptr,
-        nullptr, GetPeer, GetLocalAddress, nullptr, nullptr};
+        nullptr, GetPeer, GetLocalAddress, nullptr, nullptr, nullptr};
     grpc_endpoint::vtable = &vtable;
   }
 
@@ -105,6 +105,10 @@ static int me_get_fd(grpc_endpoint* /*ep*/) { return -1; }
 
 static bool me_can_track_err(grpc_endpoint* /*ep*/) { return false; }
 
+static void me_get_socket_options(
+    grpc_endpoint* /*ep*/,
+    std::vector<std::pair<std::string, std::string>>* /*options*/) {}
+
 static const grpc_endpoint_vtable vtable = {me_read,
                                             me_write,
                                             me_add_to_pollset,
@@ -115,7 +119,8 @@ static const grpc_endpoint_vtable vtable = {me_read,
                                             me_get_peer,
                                             me_get_local_address,
                                             me_get_fd,
-                                            me_can_track_err};
+                                            me_can_track_err,
+                                            me_get_socket_options};
 
 grpc_endpoint* grpc_mock_endpoint_create(void (*on_write)(grpc_slice slice)) {
   mock_endpoint* m = static_cast<mock_endpoint*>(gpr_malloc(sizeof(*m)));
@@ -384,6 +384,10 @@ static int me_get_fd(grpc_endpoint* /*ep*/) { return -1; }
 
 static bool me_can_track_err(grpc_endpoint* /*ep*/) { return false; }
 
+static void me_get_socket_options(
+    grpc_endpoint* /*ep*/,
+    std::vector<std::pair<std::string, std::string>>* /*options*/) {}
+
 static const grpc_endpoint_vtable vtable = {
     me_read,
     me_write,
@@ -396,6 +400,7 @@ static const grpc_endpoint_vtable vtable = {
     me_get_local_address,
     me_get_fd,
     me_can_track_err,
+    me_get_socket_options,
 };
 
 static void half_init(half* m, passthru_endpoint* parent,
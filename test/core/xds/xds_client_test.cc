@@ -20,9 +20,11 @@
 
 #include "src/core/ext/xds/xds_client.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
@@ -61,6 +63,8 @@
 // IWYU pragma: no_include <google/protobuf/unknown_field_set.h>
 // IWYU pragma: no_include <google/protobuf/util/json_util.h>
 
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 
@@ -119,10 +123,12 @@ class XdsClientTest : public ::testing::Test {
       bool IgnoreResourceDeletion() const override {
         return ignore_resource_deletion_;
       }
+      bool UseDeltaXds() const override { return use_delta_xds_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return server_uri_ == o.server_uri_ &&
-               ignore_resource_deletion_ == o.ignore_resource_deletion_;
+               ignore_resource_deletion_ == o.ignore_resource_deletion_ &&
+               use_delta_xds_ == o.use_delta_xds_;
       }
 
       void set_server_uri(std::string server_uri) {
@@ -131,10 +137,14 @@ class XdsClientTest : public ::testing::Test {
       void set_ignore_resource_deletion(bool ignore_resource_deletion) {
         ignore_resource_deletion_ = ignore_resource_deletion;
       }
+      void set_use_delta_xds(bool use_delta_xds) {
+        use_delta_xds_ = use_delta_xds;
+      }
 
      private:
       std::string server_uri_ = "default_xds_server";
       bool ignore_resource_deletion_ = false;
+      bool use_delta_xds_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -155,6 +165,10 @@ class XdsClientTest : public ::testing::Test {
      public:
       Builder() { node_.emplace(); }
 
+      Builder& set_server(FakeXdsServer server) {
+        server_ = std::move(server);
+        return *this;
+      }
       Builder& set_node_id(std::string id) {
         if (!node_.has_value()) node_.emplace();
         node_->set_id(std::move(id));
@@ -335,6 +349,7 @@ class XdsClientTest : public ::testing::Test {
     XdsResourceType::DecodeResult Decode(
         const XdsResourceType::DecodeContext& /*context*/,
         absl::string_view serialized_resource) const override {
+      num_decodes_.fetch_add(1);
       auto json = Json::Parse(serialized_resource);
       XdsResourceType::DecodeResult result;
       if (!json.ok()) {
@@ -357,6 +372,9 @@ class XdsClientTest : public ::testing::Test {
     }
     void InitUpbSymtab(XdsClient*, upb_DefPool* /*symtab*/) const override {}
 
+    // Returns the number of times Decode() has been called.
+    size_t num_decodes() const { return num_decodes_.load(); }
+
     static google::protobuf::Any EncodeAsAny(const ResourceStruct& resource) {
       google::protobuf::Any any;
       any.set_type_url(
@@ -364,6 +382,9 @@ class XdsClientTest : public ::testing::Test {
       any.set_value(resource.AsJsonString());
       return any;
     }
+
+   private:
+    mutable std::atomic<size_t> num_decodes_{0};
   };
 
   // A fake "Foo" xDS resource type.
@@ -491,6 +512,42 @@ class XdsClientTest : public ::testing::Test {
     DiscoveryResponse response_;
   };
 
+  // A helper class to build and serialize a DeltaDiscoveryResponse.
+  class DeltaResponseBuilder {
+   public:
+    explicit DeltaResponseBuilder(absl::string_view type_url) {
+      response_.set_type_url(absl::StrCat("type.googleapis.com/", type_url));
+    }
+
+    DeltaResponseBuilder& set_nonce(absl::string_view nonce) {
+      response_.set_nonce(std::string(nonce));
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddFooResource(const XdsFooResource& resource,
+                                         absl::string_view version) {
+      auto* res = response_.add_resources();
+      res->set_name(resource.name);
+      res->set_version(std::string(version));
+      *res->mutable_resource() = XdsFooResourceType::EncodeAsAny(resource);
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddRemovedResource(absl::string_view name) {
+      response_.add_removed_resources(std::string(name));
+      return *this;
+    }
+
+    std::string Serialize() {
+      std::string serialized_response;
+      EXPECT_TRUE(response_.SerializeToString(&serialized_response));
+      return serialized_response;
+    }
+
+   private:
+    DeltaDiscoveryResponse response_;
+  };
+
   class ScopedExperimentalEnvVar {
    public:
     explicit ScopedExperimentalEnvVar(const char* env_var) : env_var_(env_var) {
@@ -516,6 +573,15 @@ class XdsClientTest : public ::testing::Test {
                                             resource_request_timeout);
   }
 
+  // Returns a bootstrap builder whose server uses delta xDS.
+  static FakeXdsBootstrap::Builder DeltaXdsBootstrap() {
+    FakeXdsBootstrap::FakeXdsServer server;
+    server.set_use_delta_xds(true);
+    FakeXdsBootstrap::Builder builder;
+    builder.set_server(std::move(server));
+    return builder;
+  }
+
   // Starts and cancels a watch for a Foo resource.
   RefCountedPtr<XdsFooResourceType::Watcher> StartFooWatch(
       absl::string_view resource_name) {
@@ -566,6 +632,14 @@ class XdsClientTest : public ::testing::Test {
     return WaitForAdsStream(xds_client_->bootstrap().server(), timeout);
   }
 
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall>
+  WaitForDeltaAdsStream(absl::Duration timeout = absl::Seconds(5)) {
+    return transport_factory_->WaitForStream(
+        xds_client_->bootstrap().server(),
+        FakeXdsTransportFactory::kDeltaAdsMethod,
+        timeout * grpc_test_slowdown_factor());
+  }
+
   // Gets the latest request sent to the fake xDS server.
   absl::optional<DiscoveryRequest> WaitForRequest(
       FakeXdsTransportFactory::FakeStreamingCall* stream,
@@ -610,6 +684,59 @@ class XdsClientTest : public ::testing::Test {
         << location.file() << ":" << location.line();
   }
 
+  // Gets the latest delta request sent to the fake xDS server.
+  absl::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream,
+      absl::Duration timeout = absl::Seconds(3),
+      SourceLocation location = SourceLocation()) {
+    auto message =
+        stream->WaitForMessageFromClient(timeout * grpc_test_slowdown_factor());
+    if (!message.has_value()) return absl::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest at "
+                         << location.file() << ":" << location.line();
+    if (!success) return absl::nullopt;
+    return std::move(request);
+  }
+
+  // Helper function to check the fields of a DeltaDiscoveryRequest.
+  void CheckDeltaRequest(
+      const DeltaDiscoveryRequest& request, absl::string_view type_url,
+      absl::string_view response_nonce, absl::Status error_detail,
+      std::set<absl::string_view> subscribe,
+      std::set<absl::string_view> unsubscribe,
+      std::map<std::string, std::string> initial_resource_versions = {},
+      SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(request.type_url(),
+              absl::StrCat("type.googleapis.com/", type_url))
+        << location.file() << ":" << location.line();
+    EXPECT_EQ(request.response_nonce(), response_nonce)
+        << location.file() << ":" << location.line();
+    if (error_detail.ok()) {
+      EXPECT_FALSE(request.has_error_detail())
+          << location.file() << ":" << location.line();
+    } else {
+      EXPECT_EQ(request.error_detail().code(),
+                static_cast<int>(error_detail.code()))
+          << location.file() << ":" << location.line();
+      EXPECT_EQ(request.error_detail().message(), error_detail.message())
+          << location.file() << ":" << location.line();
+    }
+    EXPECT_THAT(request.resource_names_subscribe(),
+                ::testing::UnorderedElementsAreArray(subscribe))
+        << location.file() << ":" << location.line();
+    EXPECT_THAT(request.resource_names_unsubscribe(),
+                ::testing::UnorderedElementsAreArray(unsubscribe))
+        << location.file() << ":" << location.line();
+    std::map<std::string, std::string> actual_versions;
+    for (const auto& p : request.initial_resource_versions()) {
+      actual_versions.emplace(p.first, p.second);
+    }
+    EXPECT_EQ(actual_versions, initial_resource_versions)
+        << location.file() << ":" << location.line();
+  }
+
   // Helper function to check the contents of the node message in a
   // request against the client's node info.
   void CheckRequestNode(const DiscoveryRequest& request,
@@ -1048,6 +1175,129 @@ TEST_F(XdsClientTest, UpdateContainsOnlyChangedResource) {
   }
 }
 
+TEST_F(XdsClientTest, UnchangedResourceNotDecodedAgain) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server sends the resource, which is decoded.
+  size_t num_decodes = XdsFooResourceType::Get()->num_decodes();
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes + 1);
+  // Server resends the same bytes in a new version.  The resource is
+  // not decoded again, but the new version is still ACKed.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"B",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes + 1);
+  EXPECT_FALSE(watcher->HasEvent());
+  // A change is decoded and delivered as usual.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("3")
+          .set_nonce("C")
+          .AddFooResource(XdsFooResource("foo1", 7))
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 7);
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes + 2);
+  CancelFooWatch(watcher.get(), "foo1");
+}
+
+TEST_F(XdsClientTest, SeededResourceReturnedBeforeServerResponds) {
+  InitXdsClient();
+  // Get "foo1" from the server and dump the cache.
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Start a watch for "foo2", which is not received, so it is not dumped.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  std::string dump = xds_client_->DumpResourceCacheBinary();
+  CancelFooWatch(watcher.get(), "foo1");
+  CancelFooWatch(watcher2.get(), "foo2");
+  stream.reset();
+  // A new XdsClient seeded with the dump returns "foo1" right away.
+  InitXdsClient();
+  ASSERT_TRUE(xds_client_->SeedResourceCache(dump).ok());
+  watcher = StartFooWatch("foo1");
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // The watch is still sent to the server, which confirms the resource.
+  stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  size_t num_decodes = XdsFooResourceType::Get()->num_decodes();
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The server's copy is identical, so the watcher is not notified again.
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes);
+  EXPECT_FALSE(watcher->HasEvent());
+  // "foo2" was not seeded.
+  watcher2 = StartFooWatch("foo2");
+  EXPECT_FALSE(watcher2->HasEvent());
+  CancelFooWatch(watcher.get(), "foo1");
+  CancelFooWatch(watcher2.get(), "foo2");
+}
+
+TEST_F(XdsClientTest, SeedResourceCacheRejectsInvalidInput) {
+  InitXdsClient();
+  EXPECT_FALSE(xds_client_->SeedResourceCache("\xff\xff\xff").ok());
+}
+
 TEST_F(XdsClientTest, ResourceValidationFailure) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -2349,6 +2599,120 @@ TEST_F(XdsClientTest, FederationChannelFailureReportedToWatchers) {
   }
 }
 
+TEST_F(XdsClientTest, DeltaSubscriptionsAndUpdates) {
+  InitXdsClient(DeltaXdsBootstrap());
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream.
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // The first request subscribes to the resource and carries the node.
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  EXPECT_EQ(request->node().id(), xds_client_->bootstrap().node()->id());
+  // Server sends the resource.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // The ACK carries the nonce but no subscription changes.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  EXPECT_FALSE(request->has_node());
+  // Start a watch for "foo2".  Only the new name is sent, and since this
+  // is not an ACK, there is no nonce.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo2"}, /*unsubscribe=*/{});
+  // Server sends only foo2, which does not affect foo1.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo2", 7), "v1")
+          .Serialize());
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo2");
+  EXPECT_EQ(resource->value, 7);
+  EXPECT_FALSE(watcher->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // Server removes foo1.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("C")
+          .AddRemovedResource("foo1")
+          .Serialize());
+  EXPECT_TRUE(watcher->WaitForDoesNotExist(absl::Seconds(1)));
+  EXPECT_FALSE(watcher2->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // Cancelling the watch for foo1 sends only the unsubscription.
+  CancelFooWatch(watcher.get(), "foo1");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{"foo1"});
+  CancelFooWatch(watcher2.get(), "foo2");
+}
+
+TEST_F(XdsClientTest, DeltaNewStreamSendsInitialResourceVersions) {
+  InitXdsClient(DeltaXdsBootstrap());
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v3")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server closes the stream.
+  stream->MaybeSendStatusToClient(absl::OkStatus());
+  auto error = watcher->WaitForNextError();
+  ASSERT_TRUE(error.has_value());
+  // The first request on the new stream resubscribes and tells the
+  // server which version is cached, so that it need not be resent.
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{},
+                    /*initial_resource_versions=*/{{"foo1", "v3"}});
+  CancelFooWatch(watcher.get(), "foo1");
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
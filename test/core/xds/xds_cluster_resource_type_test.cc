@@ -714,6 +714,72 @@ TEST_F(LbPolicyTest, LbPolicyRingHashUnsupportedHashFunction) {
       << decode_result.resource.status();
 }
 
+TEST_F(LbPolicyTest, LbPolicyLeastRequest) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.LEAST_REQUEST);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.resource.ok()) << decode_result.resource.status();
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  auto& resource = static_cast<XdsClusterResource&>(**decode_result.resource);
+  EXPECT_EQ(Json{resource.lb_policy_config}.Dump(),
+            "[{\"xds_wrr_locality_experimental\":{\"childPolicy\":["
+            "{\"least_request_experimental\":{\"choiceCount\":2}}]}}]");
+}
+
+TEST_F(LbPolicyTest, LbPolicyLeastRequestSetChoiceCount) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.LEAST_REQUEST);
+  cluster.mutable_least_request_lb_config()->mutable_choice_count()->set_value(
+      4);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.resource.ok()) << decode_result.resource.status();
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  auto& resource = static_cast<XdsClusterResource&>(**decode_result.resource);
+  EXPECT_EQ(Json{resource.lb_policy_config}.Dump(),
+            "[{\"xds_wrr_locality_experimental\":{\"childPolicy\":["
+            "{\"least_request_experimental\":{\"choiceCount\":4}}]}}]");
+}
+
+TEST_F(LbPolicyTest, LbPolicyLeastRequestChoiceCountTooSmall) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.LEAST_REQUEST);
+  cluster.mutable_least_request_lb_config()->mutable_choice_count()->set_value(
+      1);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  EXPECT_EQ(decode_result.resource.status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(decode_result.resource.status().message(),
+            "errors validating Cluster resource: ["
+            "field:least_request_lb_config.choice_count "
+            "error:must be at least 2]")
+      << decode_result.resource.status();
+}
+
 TEST_F(LbPolicyTest, UnsupportedPolicy) {
   Cluster cluster;
   cluster.set_name("foo");
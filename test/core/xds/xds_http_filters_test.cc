@@ -240,6 +240,16 @@ TEST_F(XdsFaultInjectionFilterTest, ModifyChannelArgs) {
   EXPECT_EQ(*value, 1);
 }
 
+TEST_F(XdsFaultInjectionFilterTest, IsNoOp) {
+  XdsHttpFilterImpl::FilterConfig config;
+  config.config = Json::Object{{"maxFaults", 3}};
+  EXPECT_TRUE(filter_->IsNoOp(config));
+  config.config = Json::Object{{"abortCode", "UNAVAILABLE"}};
+  EXPECT_FALSE(filter_->IsNoOp(config));
+  config.config = Json::Object{{"delayHeader", "x-envoy-fault-delay-request"}};
+  EXPECT_FALSE(filter_->IsNoOp(config));
+}
+
 TEST_F(XdsFaultInjectionFilterTest, GenerateServiceConfigTopLevelConfig) {
   XdsHttpFilterImpl::FilterConfig config;
   config.config = Json::Object{{"foo", "bar"}};
@@ -437,6 +447,14 @@ TEST_F(XdsRbacFilterTest, ModifyChannelArgs) {
   EXPECT_EQ(*value, 1);
 }
 
+TEST_F(XdsRbacFilterTest, IsNoOp) {
+  XdsHttpFilterImpl::FilterConfig config;
+  config.config = Json::Object();
+  EXPECT_TRUE(filter_->IsNoOp(config));
+  config.config = Json::Object{{"rules", Json::Object{{"action", 0}}}};
+  EXPECT_FALSE(filter_->IsNoOp(config));
+}
+
 TEST_F(XdsRbacFilterTest, GenerateFilterConfig) {
   XdsExtension extension = MakeXdsExtension(RBAC());
   auto config = filter_->GenerateFilterConfig(std::move(extension),
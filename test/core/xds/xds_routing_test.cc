@@ -0,0 +1,180 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/xds/xds_routing.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include "src/core/ext/xds/xds_http_fault_filter.h"
+#include "src/core/ext/xds/xds_listener.h"
+#include "src/core/ext/xds/xds_route_config.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/matchers/matchers.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class VirtualHostList : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+class RouteList : public XdsRouting::RouteListIterator {
+ public:
+  // Adds a route whose only matcher is a path matcher.
+  RouteList& Add(StringMatcher::Type type, absl::string_view path,
+                 bool case_sensitive = true) {
+    routes_.emplace_back();
+    routes_.back().path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    return *this;
+  }
+
+  size_t Size() const override { return routes_.size(); }
+
+  const XdsRouteConfigResource::Route::Matchers& GetMatchersForRoute(
+      size_t index) const override {
+    return routes_[index];
+  }
+
+  absl::optional<size_t> Find(absl::string_view path) const {
+    return XdsRouting::GetRouteForRequest(
+        *this, XdsRouting::RouteListIndex(*this), path,
+        /*initial_metadata=*/nullptr);
+  }
+
+ private:
+  std::vector<XdsRouteConfigResource::Route::Matchers> routes_;
+};
+
+TEST(VirtualHostIndexTest, MatchTypePrecedence) {
+  VirtualHostList vhosts({{"*"},
+                          {"foo.*"},
+                          {"*.example.com"},
+                          {"*.foo.example.com"},
+                          {"foo.example.com", "foo.example.com:443"}});
+  XdsRouting::VirtualHostIndex index(vhosts);
+  EXPECT_EQ(index.Find("foo.example.com"), 4);
+  EXPECT_EQ(index.Find("FOO.Example.COM:443"), 4);
+  // The longest suffix wins.
+  EXPECT_EQ(index.Find("bar.foo.example.com"), 3);
+  EXPECT_EQ(index.Find("bar.example.com"), 2);
+  // Suffixes win over prefixes.
+  EXPECT_EQ(index.Find("foo.bar.example.com"), 2);
+  EXPECT_EQ(index.Find("foo.bar"), 1);
+  EXPECT_EQ(index.Find("bar"), 0);
+}
+
+TEST(VirtualHostIndexTest, WildcardMatchesAtLeastOneChar) {
+  VirtualHostList vhosts({{"*.example.com"}, {"example.*"}});
+  XdsRouting::VirtualHostIndex index(vhosts);
+  EXPECT_EQ(index.Find(".example.com"), absl::nullopt);
+  EXPECT_EQ(index.Find("a.example.com"), 0);
+  EXPECT_EQ(index.Find("example."), absl::nullopt);
+  EXPECT_EQ(index.Find("example.a"), 1);
+}
+
+TEST(VirtualHostIndexTest, FirstVirtualHostWinsForSamePattern) {
+  VirtualHostList vhosts({{"a.com"}, {"*.com", "A.com"}, {"*.COM"}});
+  XdsRouting::VirtualHostIndex index(vhosts);
+  EXPECT_EQ(index.Find("a.com"), 0);
+  EXPECT_EQ(index.Find("b.com"), 1);
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, "b.com"), 1);
+}
+
+TEST(RouteListIndexTest, FirstMatchingRouteWins) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/svc/")
+      .Add(StringMatcher::Type::kExact, "/svc/Method")
+      .Add(StringMatcher::Type::kExact, "/other/Method")
+      .Add(StringMatcher::Type::kPrefix, "");
+  EXPECT_EQ(routes.Find("/svc/Method"), 0);
+  EXPECT_EQ(routes.Find("/other/Method"), 2);
+  EXPECT_EQ(routes.Find("/other/Other"), 3);
+}
+
+TEST(RouteListIndexTest, MixedMatcherTypes) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/svc/Method")
+      .Add(StringMatcher::Type::kPrefix, "/SVC/", /*case_sensitive=*/false)
+      .Add(StringMatcher::Type::kSafeRegex, "/other/.*")
+      .Add(StringMatcher::Type::kPrefix, "/other/")
+      .Add(StringMatcher::Type::kSuffix, "/Method");
+  EXPECT_EQ(routes.Find("/svc/Method"), 0);
+  EXPECT_EQ(routes.Find("/Svc/Method"), 1);
+  EXPECT_EQ(routes.Find("/other/Method"), 2);
+  EXPECT_EQ(routes.Find("/third/Method"), 4);
+  EXPECT_EQ(routes.Find("/third/Other"), absl::nullopt);
+  EXPECT_EQ(routes.Find("/svc"), absl::nullopt);
+}
+
+TEST(RouteListIndexTest, Empty) {
+  RouteList routes;
+  EXPECT_EQ(routes.Find("/svc/Method"), absl::nullopt);
+}
+
+TEST(IsHttpFilterNoOpTest, AnyActiveOverrideKeepsFilter) {
+  XdsHttpFaultFilter filter;
+  XdsListenerResource::HttpConnectionManager::HttpFilter http_filter;
+  http_filter.name = "fault";
+  http_filter.config.config = Json::Object();
+  std::vector<XdsRouteConfigResource::VirtualHost> vhosts(1);
+  vhosts[0].routes.emplace_back();
+  vhosts[0].typed_per_filter_config["fault"].config = Json::Object();
+  EXPECT_TRUE(XdsRouting::IsHttpFilterNoOp(filter, http_filter, vhosts));
+  vhosts[0].routes[0].typed_per_filter_config["fault"].config =
+      Json::Object{{"delay", "1s"}};
+  EXPECT_FALSE(XdsRouting::IsHttpFilterNoOp(filter, http_filter, vhosts));
+}
+
+TEST(IsHttpFilterNoOpTest, ActiveTopLevelConfigKeepsFilter) {
+  XdsHttpFaultFilter filter;
+  XdsListenerResource::HttpConnectionManager::HttpFilter http_filter;
+  http_filter.name = "fault";
+  http_filter.config.config = Json::Object{{"abortCode", "UNAVAILABLE"}};
+  EXPECT_FALSE(XdsRouting::IsHttpFilterNoOp(filter, http_filter, {}));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,10 @@
  *
  */
 
+#include <string>
+#include <vector>
+
+#include <google/protobuf/wrappers.pb.h>
 #include <gtest/gtest.h>
 
 #include <grpc/impl/codegen/byte_buffer.h>
@@ -23,6 +27,7 @@
 #include <grpcpp/impl/codegen/grpc_library.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/impl/grpc_library.h>
+#include <grpcpp/support/lazy_message.h>
 
 #include "test/core/util/test_config.h"
 
@@ -185,6 +190,100 @@ TEST_F(WriterTest, LargeBlockLargeBackup) {
   BufferWriterTest(4096, 8192, 4095);
 }
 
+// Serializes a message of about \a size bytes and returns the number of
+// slices it was serialized into, after checking that it round trips.
+size_t SerializedSliceCount(size_t size) {
+  google::protobuf::StringValue msg;
+  msg.set_value(std::string(size, 'a'));
+  ByteBuffer bb;
+  bool own_buffer;
+  EXPECT_TRUE((GenericSerialize<ProtoBufferWriter,
+                                google::protobuf::StringValue>(msg, &bb,
+                                                               &own_buffer)
+                   .ok()));
+  EXPECT_EQ(bb.Length(), msg.ByteSizeLong());
+  std::vector<Slice> slices;
+  EXPECT_TRUE(bb.Dump(&slices).ok());
+  google::protobuf::StringValue parsed;
+  EXPECT_TRUE(
+      (GenericDeserialize<ProtoBufferReader, google::protobuf::StringValue>(
+           &bb, &parsed)
+           .ok()));
+  EXPECT_EQ(parsed.value(), msg.value());
+  return slices.size();
+}
+
+TEST_F(ProtoUtilsTest, SerializesIntoOneSlice) {
+  EXPECT_EQ(SerializedSliceCount(0), 1u);
+  EXPECT_EQ(SerializedSliceCount(8), 1u);
+  EXPECT_EQ(SerializedSliceCount(64 * 1024), 1u);
+  EXPECT_EQ(SerializedSliceCount(kProtoBufferWriterMaxBufferLength - 16), 1u);
+  EXPECT_GT(SerializedSliceCount(4 * kProtoBufferWriterMaxBufferLength), 1u);
+}
+
+TEST_F(ProtoUtilsTest, LazyMessageForwardsReceivedSlices) {
+  google::protobuf::StringValue msg;
+  msg.set_value("routing-key");
+  ByteBuffer received;
+  bool own_buffer;
+  ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Serialize(
+                  msg, &received, &own_buffer)
+                  .ok());
+  std::vector<Slice> received_slices;
+  ASSERT_TRUE(received.Dump(&received_slices).ok());
+
+  experimental::LazyMessage<google::protobuf::StringValue> lazy;
+  ASSERT_TRUE(
+      (SerializationTraits<experimental::LazyMessage<
+           google::protobuf::StringValue>>::Deserialize(&received, &lazy)
+           .ok()));
+  EXPECT_FALSE(lazy.parsed());
+  ASSERT_NE(lazy.message(), nullptr);
+  EXPECT_TRUE(lazy.parsed());
+  EXPECT_EQ(lazy.message()->value(), "routing-key");
+
+  // Reading the message must not stop the original bytes from being reused.
+  ByteBuffer forwarded;
+  ASSERT_TRUE((SerializationTraits<experimental::LazyMessage<
+                   google::protobuf::StringValue>>::Serialize(lazy, &forwarded,
+                                                              &own_buffer)
+                   .ok()));
+  std::vector<Slice> forwarded_slices;
+  ASSERT_TRUE(forwarded.Dump(&forwarded_slices).ok());
+  ASSERT_EQ(forwarded_slices.size(), received_slices.size());
+  for (size_t i = 0; i < forwarded_slices.size(); ++i) {
+    EXPECT_EQ(forwarded_slices[i].begin(), received_slices[i].begin());
+  }
+}
+
+TEST_F(ProtoUtilsTest, LazyMessageReserializesAfterMutation) {
+  google::protobuf::StringValue msg;
+  msg.set_value("before");
+  experimental::LazyMessage<google::protobuf::StringValue> lazy(msg);
+  ASSERT_NE(lazy.mutable_message(), nullptr);
+  lazy.mutable_message()->set_value("after");
+  ByteBuffer bb;
+  bool own_buffer;
+  ASSERT_TRUE((SerializationTraits<experimental::LazyMessage<
+                   google::protobuf::StringValue>>::Serialize(lazy, &bb,
+                                                              &own_buffer)
+                   .ok()));
+  google::protobuf::StringValue parsed;
+  ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Deserialize(
+                  &bb, &parsed)
+                  .ok());
+  EXPECT_EQ(parsed.value(), "after");
+}
+
+TEST_F(ProtoUtilsTest, LazyMessageReportsMalformedBytesOnAccess) {
+  Slice garbage(std::string("\xff\xff\xff"));
+  ByteBuffer bb(&garbage, 1);
+  experimental::LazyMessage<google::protobuf::StringValue> lazy(bb);
+  EXPECT_EQ(lazy.message(), nullptr);
+  EXPECT_FALSE(lazy.status().ok());
+  EXPECT_EQ(lazy.mutable_message(), nullptr);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc
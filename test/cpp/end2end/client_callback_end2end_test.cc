@@ -919,13 +919,17 @@ class ReadClient : public grpc::ClientReadReactor<EchoResponse> {
  public:
   ReadClient(grpc::testing::EchoTestService::Stub* stub,
              ServerTryCancelRequestPhase server_try_cancel,
-             ClientCancelInfo client_cancel = {})
+             ClientCancelInfo client_cancel = {},
+             bool server_write_batch = false)
       : server_try_cancel_(server_try_cancel), client_cancel_{client_cancel} {
     if (server_try_cancel_ != DO_NOT_CANCEL) {
       // Send server_try_cancel value in the client metadata
       context_.AddMetadata(kServerTryCancelRequest,
                            std::to_string(server_try_cancel));
     }
+    if (server_write_batch) {
+      context_.AddMetadata(kServerUseWriteBatch, "1");
+    }
     request_.set_message("Hello client ");
     stub->async()->ResponseStream(&context_, &request_, this);
     if (client_cancel_.cancel &&
@@ -1025,6 +1029,13 @@ TEST_P(ClientCallbackEnd2endTest, ResponseStream) {
   }
 }
 
+TEST_P(ClientCallbackEnd2endTest, ResponseStreamWithWriteBatch) {
+  ResetStub();
+  ReadClient test{stub_.get(), DO_NOT_CANCEL, ClientCancelInfo{},
+                  /*server_write_batch=*/true};
+  test.Await();
+}
+
 TEST_P(ClientCallbackEnd2endTest, ClientCancelsResponseStream) {
   ResetStub();
   ReadClient test{stub_.get(), DO_NOT_CANCEL, ClientCancelInfo{2}};
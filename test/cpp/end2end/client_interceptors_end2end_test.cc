@@ -16,6 +16,7 @@
  *
  */
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -710,6 +711,50 @@ class LoggingInterceptorFactory
   }
 };
 
+// Stateless interceptor that only acts on the initial metadata sent, shared
+// by every RPC of its channel.
+class SendInitialMetadataInterceptor : public experimental::Interceptor {
+ public:
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    EXPECT_TRUE(methods->QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_SEND_INITIAL_METADATA));
+    num_times_run_.fetch_add(1, std::memory_order_relaxed);
+    methods->Proceed();
+  }
+
+  uint32_t InterceptedHookPoints() const override {
+    return experimental::HookPointBit(
+        experimental::InterceptionHookPoints::PRE_SEND_INITIAL_METADATA);
+  }
+
+  int num_times_run() const {
+    return num_times_run_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int> num_times_run_{0};
+};
+
+class SharedInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  explicit SharedInterceptorFactory(experimental::Interceptor* interceptor)
+      : interceptor_(interceptor) {}
+
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* /*info*/) override {
+    ADD_FAILURE() << "a shared interceptor must not be created per RPC";
+    return nullptr;
+  }
+
+  experimental::Interceptor* GetSharedClientInterceptor() override {
+    return interceptor_;
+  }
+
+ private:
+  experimental::Interceptor* const interceptor_;
+};
+
 class TestScenario {
  public:
   explicit TestScenario(const ChannelType& channel_type,
@@ -945,6 +990,24 @@ TEST_F(ClientInterceptorsEnd2endTest,
   EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 12);
 }
 
+TEST_F(ClientInterceptorsEnd2endTest,
+       SharedInterceptorOnlySeesItsHookPoints) {
+  ChannelArguments args;
+  SendInitialMetadataInterceptor interceptor;
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<SharedInterceptorFactory>(&interceptor));
+  creators.push_back(std::make_unique<LoggingInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  MakeCall(channel);
+  LoggingInterceptor::VerifyUnaryCall();
+  MakeCall(channel);
+  // Once per RPC, although each RPC also runs batches for the message, the
+  // close and the results.
+  EXPECT_EQ(interceptor.num_times_run(), 2);
+}
+
 class ClientInterceptorsCallbackEnd2endTest : public ::testing::Test {
  protected:
   ClientInterceptorsCallbackEnd2endTest() {
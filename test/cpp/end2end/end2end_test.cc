@@ -22,6 +22,7 @@
 #include "absl/memory/memory.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 
 #include <grpc/grpc.h>
@@ -835,6 +836,28 @@ TEST_P(End2endTest, SimpleRpcWithCustomUserAgentPrefix) {
   EXPECT_TRUE(iter->second.starts_with(expected_prefix)) << iter->second;
 }
 
+TEST_P(End2endTest, ResetClientContextBetweenRpcs) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.mutable_param()->set_echo_metadata(true);
+  ClientContext context;
+  for (int i = 0; i < 3; ++i) {
+    request.set_message(absl::StrCat("Hello ", i));
+    context.AddMetadata("custom-key", absl::StrCat("value-", i));
+    Status s = stub_->Echo(&context, request, &response);
+    EXPECT_TRUE(s.ok());
+    EXPECT_EQ(response.message(), request.message());
+    // Only this rpc's metadata is sent and received.
+    const auto& trailing_metadata = context.GetServerTrailingMetadata();
+    EXPECT_EQ(trailing_metadata.count("custom-key"), 1u);
+    auto iter = trailing_metadata.find("custom-key");
+    ASSERT_TRUE(iter != trailing_metadata.end());
+    EXPECT_EQ(ToString(iter->second), absl::StrCat("value-", i));
+    context.Reset();
+  }
+}
+
 TEST_P(End2endTest, MultipleRpcsWithVariedBinaryMetadataValue) {
   ResetStub();
   std::vector<std::thread> threads;
@@ -977,6 +1000,27 @@ TEST_P(End2endTest, RequestStreamTwoRequests) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(End2endTest, RequestStreamWithServerReadAhead) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+  // Only the callback server reads ahead; the others ignore this.
+  context.AddMetadata(kServerReadAhead, "1");
+
+  auto stream = stub_->RequestStream(&context, &response);
+  std::string expected;
+  for (int i = 0; i < 10; ++i) {
+    request.set_message(absl::StrCat("hello", i));
+    expected += request.message();
+    EXPECT_TRUE(stream->Write(request));
+  }
+  stream->WritesDone();
+  Status s = stream->Finish();
+  EXPECT_EQ(response.message(), expected);
+  EXPECT_TRUE(s.ok());
+}
+
 TEST_P(End2endTest, RequestStreamTwoRequestsWithWriteThrough) {
   ResetStub();
   EchoRequest request;
@@ -1760,6 +1804,23 @@ TEST_P(SecureEnd2endTest, SimpleRpcWithHost) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(SecureEnd2endTest, RpcsWithHostReuseRegistration) {
+  ResetStub();
+  ChannelTestPeer peer(channel_.get());
+  int registered_calls_pre = peer.registered_calls();
+  for (int i = 0; i < 10; ++i) {
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message("Hello");
+    ClientContext context;
+    context.set_authority("foo.test.youtube.com");
+    Status s = stub_->Echo(&context, request, &response);
+    EXPECT_TRUE(s.ok());
+    EXPECT_EQ("special", response.param().host());
+  }
+  EXPECT_EQ(peer.registered_calls(), registered_calls_pre + 1);
+}
+
 bool MetadataContains(
     const std::multimap<grpc::string_ref, grpc::string_ref>& metadata,
     const std::string& key, const std::string& value) {
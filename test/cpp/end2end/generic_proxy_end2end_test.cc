@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/generic/generic_proxy.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+class GenericProxyEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::string backend_address =
+        absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+    ServerBuilder backend_builder;
+    backend_builder.AddListeningPort(backend_address,
+                                     InsecureServerCredentials());
+    backend_builder.RegisterService(&backend_service_);
+    backend_ = backend_builder.BuildAndStart();
+
+    proxy_service_ =
+        std::make_unique<experimental::CallbackGenericProxyService>(
+            grpc::CreateChannel(backend_address,
+                                InsecureChannelCredentials()));
+    std::string proxy_address =
+        absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+    ServerBuilder proxy_builder;
+    proxy_builder.AddListeningPort(proxy_address, InsecureServerCredentials());
+    proxy_builder.RegisterCallbackGenericService(proxy_service_.get());
+    proxy_ = proxy_builder.BuildAndStart();
+
+    stub_ = EchoTestService::NewStub(
+        grpc::CreateChannel(proxy_address, InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    proxy_->Shutdown();
+    backend_->Shutdown();
+  }
+
+  TestServiceImpl backend_service_;
+  std::unique_ptr<Server> backend_;
+  std::unique_ptr<experimental::CallbackGenericProxyService> proxy_service_;
+  std::unique_ptr<Server> proxy_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(GenericProxyEnd2endTest, UnaryRpcWithMetadata) {
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("hello");
+  request.mutable_param()->set_echo_metadata(true);
+  ClientContext context;
+  context.AddMetadata("custom-key", "custom-value");
+  Status s = stub_->Echo(&context, request, &response);
+  ASSERT_TRUE(s.ok()) << s.error_message();
+  EXPECT_EQ(response.message(), "hello");
+  auto it = context.GetServerTrailingMetadata().find("custom-key");
+  ASSERT_NE(it, context.GetServerTrailingMetadata().end());
+  EXPECT_EQ(it->second, "custom-value");
+}
+
+TEST_F(GenericProxyEnd2endTest, BackendStatusIsForwarded) {
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("hello");
+  request.mutable_param()->mutable_expected_error()->set_code(
+      StatusCode::FAILED_PRECONDITION);
+  request.mutable_param()->mutable_expected_error()->set_error_message(
+      "backend error");
+  ClientContext context;
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(s.error_code(), StatusCode::FAILED_PRECONDITION);
+  EXPECT_EQ(s.error_message(), "backend error");
+}
+
+TEST_F(GenericProxyEnd2endTest, BidiStreaming) {
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  EchoRequest request;
+  EchoResponse response;
+  for (int i = 0; i < 10; ++i) {
+    request.set_message(absl::StrCat("message ", i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  stream->WritesDone();
+  EXPECT_FALSE(stream->Read(&response));
+  Status s = stream->Finish();
+  EXPECT_TRUE(s.ok()) << s.error_message();
+}
+
+// The backend finishes while the caller still has its side of the stream
+// open; the status must reach the caller anyway.
+TEST_F(GenericProxyEnd2endTest, BackendFinishesFirst) {
+  ClientContext context;
+  context.AddMetadata(kServerFinishAfterNReads, "2");
+  auto stream = stub_->BidiStream(&context);
+  EchoRequest request;
+  EchoResponse response;
+  for (int i = 0; i < 2; ++i) {
+    request.set_message(absl::StrCat("message ", i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  EXPECT_FALSE(stream->Read(&response));
+  Status s = stream->Finish();
+  EXPECT_TRUE(s.ok()) << s.error_message();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
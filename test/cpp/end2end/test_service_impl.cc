@@ -20,6 +20,7 @@
 
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -380,6 +381,10 @@ ServerReadReactor<EchoRequest>* CallbackTestServiceImpl::RequestStream(
         ctx->TryCancel();
         // Don't wait for it here
       }
+      if (internal::GetIntValueFromMetadata(
+              kServerReadAhead, ctx->client_metadata(), 0) != 0) {
+        EnableReadAhead();
+      }
       StartRead(&request_);
       setup_done_ = true;
     }
@@ -456,6 +461,8 @@ ServerWriteReactor<EchoResponse>* CallbackTestServiceImpl::ResponseStream(
         : ctx_(ctx), request_(request), server_try_cancel_(server_try_cancel) {
       server_coalescing_api_ = internal::GetIntValueFromMetadata(
           kServerUseCoalescingApi, ctx->client_metadata(), 0);
+      server_write_batch_ = internal::GetIntValueFromMetadata(
+          kServerUseWriteBatch, ctx->client_metadata(), 0);
       server_responses_to_send_ = internal::GetIntValueFromMetadata(
           kServerResponseStreamsToSend, ctx->client_metadata(),
           kServerDefaultResponseStreamsToSend);
@@ -499,6 +506,21 @@ ServerWriteReactor<EchoResponse>* CallbackTestServiceImpl::ResponseStream(
     }
 
     void NextWrite() {
+      if (server_write_batch_ != 0) {
+        // Write all the responses as a single batch.
+        batch_responses_.resize(server_responses_to_send_);
+        for (int i = 0; i < server_responses_to_send_; ++i) {
+          batch_responses_[i].set_message(request_->message() +
+                                          std::to_string(i));
+          batch_.push_back(&batch_responses_[i]);
+        }
+        std::lock_guard<std::mutex> l(finish_mu_);
+        if (!finished_) {
+          num_msgs_sent_ = server_responses_to_send_;
+          StartWriteBatch(batch_.data(), batch_.size(), WriteOptions());
+        }
+        return;
+      }
       response_.set_message(request_->message() +
                             std::to_string(num_msgs_sent_));
       if (num_msgs_sent_ == server_responses_to_send_ - 1 &&
@@ -526,7 +548,10 @@ ServerWriteReactor<EchoResponse>* CallbackTestServiceImpl::ResponseStream(
     int num_msgs_sent_{0};
     int server_try_cancel_;
     int server_coalescing_api_;
+    int server_write_batch_;
     int server_responses_to_send_;
+    std::vector<EchoResponse> batch_responses_;
+    std::vector<const EchoResponse*> batch_;
     std::mutex finish_mu_;
     bool finished_{false};
     bool setup_done_{false};
@@ -425,6 +425,45 @@ TEST_F(StatsPluginEnd2EndTest, Latency) {
                                   ::testing::DoubleEq(client_elapsed_time))))));
 }
 
+TEST_F(StatsPluginEnd2EndTest, ResourceUsagePerRpc) {
+  View client_cpu_time_view(ClientCpuTimePerRpcCumulative());
+  View client_arena_bytes_view(ClientArenaBytesPerRpcCumulative());
+
+  const absl::Time start_time = absl::Now();
+  {
+    EchoRequest request;
+    request.set_message("foo");
+    EchoResponse response;
+    grpc::ClientContext context;
+    grpc::Status status = stub_->Echo(&context, request, &response);
+    ASSERT_TRUE(status.ok());
+    EXPECT_EQ("foo", response.message());
+  }
+  // CPU time is only charged for the threads running the RPC, so it cannot
+  // exceed the wall time spent making it.
+  const double max_time = absl::ToDoubleMilliseconds(absl::Now() - start_time);
+
+  absl::SleepFor(absl::Milliseconds(500 * grpc_test_slowdown_factor()));
+  TestUtils::Flush();
+
+  EXPECT_THAT(
+      client_cpu_time_view.GetData().distribution_data(),
+      ::testing::UnorderedElementsAre(::testing::Pair(
+          ::testing::ElementsAre(client_method_name_),
+          ::testing::AllOf(
+              ::testing::Property(&Distribution::count, 1),
+              ::testing::Property(&Distribution::mean, ::testing::Ge(0.0)),
+              ::testing::Property(&Distribution::mean,
+                                  ::testing::Lt(max_time))))));
+  EXPECT_THAT(
+      client_arena_bytes_view.GetData().distribution_data(),
+      ::testing::UnorderedElementsAre(::testing::Pair(
+          ::testing::ElementsAre(client_method_name_),
+          ::testing::AllOf(
+              ::testing::Property(&Distribution::count, 1),
+              ::testing::Property(&Distribution::mean, ::testing::Gt(0.0))))));
+}
+
 TEST_F(StatsPluginEnd2EndTest, StartedRpcs) {
   View client_started_rpcs_view(ClientStartedRpcsCumulative());
   View server_started_rpcs_view(ServerStartedRpcsCumulative());
@@ -20,6 +20,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <thread>
+#include <vector>
+
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/util/test_config.h"
@@ -66,6 +69,47 @@ static void BM_Arena_Batch(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
 
+struct PooledObject {
+  char data[200];
+};
+
+static void BM_Arena_PooledAllocFree(benchmark::State& state) {
+  Arena* a = Arena::Create(1024, g_memory_allocator);
+  for (auto _ : state) {
+    auto p = a->MakePooled<PooledObject>();
+    benchmark::DoNotOptimize(p.get());
+  }
+  a->Destroy();
+}
+BENCHMARK(BM_Arena_PooledAllocFree);
+
+// Allocates and frees pooled objects on a thread other than the one that
+// created the arena.
+static void BM_Arena_PooledAllocFreeOffThread(benchmark::State& state) {
+  Arena* a = nullptr;
+  std::thread([&a] { a = Arena::Create(1024, g_memory_allocator); }).join();
+  for (auto _ : state) {
+    auto p = a->MakePooled<PooledObject>();
+    benchmark::DoNotOptimize(p.get());
+  }
+  a->Destroy();
+}
+BENCHMARK(BM_Arena_PooledAllocFreeOffThread);
+
+static void BM_Arena_PooledBatch(benchmark::State& state) {
+  Arena* a = Arena::Create(1024, g_memory_allocator);
+  std::vector<Arena::PoolPtr<PooledObject>> objects;
+  objects.reserve(state.range(0));
+  for (auto _ : state) {
+    for (int i = 0; i < state.range(0); i++) {
+      objects.emplace_back(a->MakePooled<PooledObject>());
+    }
+    objects.clear();
+  }
+  a->Destroy();
+}
+BENCHMARK(BM_Arena_PooledBatch)->Range(1, 64);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
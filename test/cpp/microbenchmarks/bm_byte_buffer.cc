@@ -25,6 +25,8 @@
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/support/byte_buffer.h>
 
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -32,6 +34,8 @@
 namespace grpc {
 namespace testing {
 
+static const char kFragment[32] = {};
+
 static void BM_ByteBuffer_Copy(benchmark::State& state) {
   int num_slices = state.range(0);
   size_t slice_size = state.range(1);
@@ -115,6 +119,54 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+// A fragmented buffer used as a queue, the way transports use their
+// outgoing buffers: small slices are appended at the back while the front is
+// consumed.
+static void BM_SliceBuffer_FragmentedQueue(benchmark::State& state) {
+  const int num_slices = state.range(0);
+  grpc_core::SliceBuffer sb;
+  for (int i = 0; i < num_slices; ++i) {
+    sb.Append(grpc_core::Slice::FromCopiedBuffer(kFragment, sizeof(kFragment)));
+  }
+  for (auto _ : state) {
+    sb.Append(grpc_core::Slice::FromCopiedBuffer(kFragment, sizeof(kFragment)));
+    sb.TakeFirst();
+  }
+}
+BENCHMARK(BM_SliceBuffer_FragmentedQueue)->Range(16, 4096);
+
+static void BM_SliceBuffer_FragmentedMoveFirst(benchmark::State& state) {
+  const int num_slices = state.range(0);
+  grpc_core::SliceBuffer src;
+  grpc_core::SliceBuffer dst;
+  for (int i = 0; i < num_slices; ++i) {
+    src.Append(
+        grpc_core::Slice::FromCopiedBuffer(kFragment, sizeof(kFragment)));
+  }
+  // Move a little more than half, so that a slice is split in both
+  // directions.
+  const size_t n = src.Length() / 2 + 1;
+  for (auto _ : state) {
+    src.MoveFirstNBytesIntoSliceBuffer(n, dst);
+    src.Swap(&dst);
+  }
+}
+BENCHMARK(BM_SliceBuffer_FragmentedMoveFirst)->Range(16, 4096);
+
+static void BM_SliceBuffer_Prepend(benchmark::State& state) {
+  const int num_slices = state.range(0);
+  grpc_core::SliceBuffer sb;
+  for (auto _ : state) {
+    for (int i = 0; i < num_slices; ++i) {
+      sb.Prepend(
+          grpc_core::Slice::FromCopiedBuffer(kFragment, sizeof(kFragment)));
+    }
+    sb.Clear();
+  }
+  state.SetItemsProcessed(state.iterations() * num_slices);
+}
+BENCHMARK(BM_SliceBuffer_Prepend)->Range(16, 4096);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -49,6 +49,15 @@ static void StreamingPingPongMsgsNumberArgs(benchmark::internal::Benchmark* b) {
   }
 }
 
+// Replace "benchmark::internal::Benchmark" with "::testing::Benchmark" to use
+// internal microbenchmarking tooling
+static void StreamingPumpArgs(benchmark::internal::Benchmark* b) {
+  for (int batch_size = 1; batch_size <= 64; batch_size *= 8) {
+    b->Args({0, 1024, batch_size});
+    b->Args({1024, 1024, batch_size});
+  }
+}
+
 // Streaming with different message size
 BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess, NoOpMutator,
                    NoOpMutator)
@@ -119,6 +128,12 @@ BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess, NoOpMutator,
                    Server_AddInitialMetadata<RandomAsciiMetadata<10>, 100>)
     ->Args({0, 1});
 
+// Server streaming pump, with and without write batching
+BENCHMARK_TEMPLATE(BM_CallbackServerStreamingPump, InProcess)
+    ->Apply(StreamingPumpArgs);
+BENCHMARK_TEMPLATE(BM_CallbackServerStreamingPump, MinInProcess)
+    ->Apply(StreamingPumpArgs);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -20,6 +20,7 @@
 #include <benchmark/benchmark.h>
 
 #include "absl/container/btree_map.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpcpp/support/channel_arguments.h>
 
@@ -82,6 +83,42 @@ void BM_ChannelArgsAsKeyIntoBTree(benchmark::State& state) {
 }
 BENCHMARK(BM_ChannelArgsAsKeyIntoBTree);
 
+// Args with about as many entries as a client channel ends up with.
+grpc_core::ChannelArgs ManyArgs() {
+  grpc_core::ChannelArgs args;
+  for (int i = 0; i < 30; i++) {
+    args = args.Set(absl::StrCat("grpc.some_arg_", i), i);
+  }
+  return args;
+}
+
+void BM_ChannelArgsGetInt(benchmark::State& state) {
+  grpc_core::ChannelArgs args = ManyArgs();
+  for (auto s : state) {
+    benchmark::DoNotOptimize(args.GetInt("grpc.some_arg_17"));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetInt);
+
+void BM_ChannelArgsCompareEqual(benchmark::State& state) {
+  // Built separately so that the trees don't share nodes.
+  grpc_core::ChannelArgs a = ManyArgs();
+  grpc_core::ChannelArgs b = ManyArgs();
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_ChannelArgsCompareEqual);
+
+void BM_ChannelArgsCompareUnequal(benchmark::State& state) {
+  grpc_core::ChannelArgs a = ManyArgs();
+  grpc_core::ChannelArgs b = ManyArgs().Set("grpc.some_arg_29", -1);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_ChannelArgsCompareUnequal);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
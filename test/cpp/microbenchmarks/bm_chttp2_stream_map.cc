@@ -0,0 +1,108 @@
+//
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Microbenchmarks around the CHTTP2 stream map
+
+#include <stdint.h>
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/ext/transport/chttp2/transport/stream_map.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/util/test_config.h"
+
+// Client stream ids are odd.
+static uint32_t StreamId(int64_t i) { return static_cast<uint32_t>(2 * i + 1); }
+
+// A map holding the given number of consecutive client streams.
+class StreamMap {
+ public:
+  explicit StreamMap(int64_t streams) {
+    grpc_chttp2_stream_map_init(&map_, 8);
+    for (int64_t i = 0; i < streams; i++) Add(i);
+  }
+  ~StreamMap() { grpc_chttp2_stream_map_destroy(&map_); }
+
+  void Add(int64_t i) {
+    grpc_chttp2_stream_map_add(&map_, StreamId(i),
+                               reinterpret_cast<void*>(StreamId(i)));
+  }
+
+  grpc_chttp2_stream_map* map() { return &map_; }
+
+ private:
+  grpc_chttp2_stream_map map_;
+};
+
+// Looks up streams the way parsing every incoming frame does.
+static void BM_StreamMapFind(benchmark::State& state) {
+  const int64_t streams = state.range(0);
+  StreamMap map(streams);
+  int64_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        grpc_chttp2_stream_map_find(map.map(), StreamId(i)));
+    // Step through the streams in an order unrelated to their ids.
+    i = (i + 7919) % streams;
+  }
+}
+BENCHMARK(BM_StreamMapFind)->Range(1, 16384);
+
+// Opens a new stream and closes the oldest one, keeping a steady number of
+// streams alive.
+static void BM_StreamMapChurn(benchmark::State& state) {
+  const int64_t streams = state.range(0);
+  StreamMap map(streams);
+  int64_t next = streams;
+  for (auto _ : state) {
+    map.Add(next);
+    benchmark::DoNotOptimize(
+        grpc_chttp2_stream_map_delete(map.map(), StreamId(next - streams)));
+    next++;
+  }
+}
+BENCHMARK(BM_StreamMapChurn)->Range(1, 16384);
+
+// Picks a random stream while streams are closed in id order, as the
+// destructive memory reclaimer does.
+static void BM_StreamMapRand(benchmark::State& state) {
+  const int64_t streams = state.range(0);
+  StreamMap map(streams);
+  int64_t next = streams;
+  for (auto _ : state) {
+    map.Add(next);
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_rand(map.map()));
+    grpc_chttp2_stream_map_delete(map.map(), StreamId(next - streams));
+    next++;
+  }
+}
+BENCHMARK(BM_StreamMapRand)->Range(1, 16384);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -20,12 +20,16 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <memory>
 #include <queue>
 #include <sstream>
+#include <string>
 
 #include <benchmark/benchmark.h>
 
+#include "absl/types/optional.h"
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
@@ -35,6 +39,7 @@
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/resource_quota/api.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
@@ -61,7 +66,8 @@ class PhonyEndpoint : public grpc_endpoint {
                                                    get_peer,
                                                    get_local_address,
                                                    get_fd,
-                                                   can_track_err};
+                                                   can_track_err,
+                                                   get_socket_options};
     grpc_endpoint::vtable = &my_vtable;
   }
 
@@ -130,6 +136,9 @@ class PhonyEndpoint : public grpc_endpoint {
   }
   static int get_fd(grpc_endpoint* /*ep*/) { return 0; }
   static bool can_track_err(grpc_endpoint* /*ep*/) { return false; }
+  static void get_socket_options(
+      grpc_endpoint* /*ep*/,
+      std::vector<std::pair<std::string, std::string>>* /*options*/) {}
 };
 
 class Fixture {
@@ -404,6 +413,131 @@ static void BM_TransportEmptyOp(benchmark::State& state) {
 }
 BENCHMARK(BM_TransportEmptyOp);
 
+// Frames a gRPC message of the given length into DATA frames for stream 1 of at
+// most frame_size bytes each, and returns them as a single slice.
+static grpc_slice CreateIncomingDataSlice(size_t length, size_t frame_size) {
+  std::string unframed(5, '\0');
+  unframed[1] = static_cast<char>(length >> 24);
+  unframed[2] = static_cast<char>(length >> 16);
+  unframed[3] = static_cast<char>(length >> 8);
+  unframed[4] = static_cast<char>(length);
+  unframed.append(length, 'a');
+  std::string framed;
+  for (size_t offset = 0; offset < unframed.size(); offset += frame_size) {
+    const size_t n = std::min(frame_size, unframed.size() - offset);
+    const char header[9] = {static_cast<char>(n >> 16),
+                            static_cast<char>(n >> 8),
+                            static_cast<char>(n),
+                            0 /* DATA */,
+                            0 /* flags */,
+                            0,
+                            0,
+                            0,
+                            1 /* stream id */};
+    framed.append(header, sizeof(header));
+    framed.append(unframed, offset, n);
+  }
+  return grpc_slice_from_cpp_string(std::move(framed));
+}
+
+// Receives messages on a client stream, reporting how many bytes of each
+// message did not reference the slices read from the endpoint.
+static void BM_TransportStreamRecv(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  Fixture f(grpc::ChannelArguments(), true);
+  auto* s = new Stream(&f);
+  s->Init(state);
+  grpc_transport_stream_op_batch op;
+  grpc_transport_stream_op_batch_payload op_payload(nullptr);
+  auto reset_op = [&]() {
+    op = {};
+    op.payload = &op_payload;
+  };
+
+  auto arena = grpc_core::MakeScopedArena(1024, g_memory_allocator);
+  grpc_metadata_batch send_initial_metadata(arena.get());
+  grpc_metadata_batch recv_initial_metadata(arena.get());
+  RepresentativeClientInitialMetadata::Prepare(&send_initial_metadata);
+
+  // Start the stream, then deliver the server's SETTINGS and response
+  // HEADERS (":status: 200" from the static table).
+  std::unique_ptr<TestClosure> noop =
+      MakeTestClosure([](grpc_error_handle /*error*/) {});
+  reset_op();
+  op.send_initial_metadata = true;
+  op.payload->send_initial_metadata.send_initial_metadata =
+      &send_initial_metadata;
+  op.recv_initial_metadata = true;
+  op.payload->recv_initial_metadata.recv_initial_metadata =
+      &recv_initial_metadata;
+  op.payload->recv_initial_metadata.recv_initial_metadata_ready = noop.get();
+  op.on_complete = noop.get();
+  s->Op(&op);
+  f.FlushExecCtx();
+  const char kSettingsAndHeaders[] = {
+      0, 0, 0, 4 /* SETTINGS */, 0, 0, 0, 0, 0,
+      0, 0, 1, 1 /* HEADERS */,  4 /* END_HEADERS */,
+      0, 0, 0, 1, static_cast<char>(0x88)};
+  f.PushInput(grpc_slice_from_copied_buffer(kSettingsAndHeaders,
+                                            sizeof(kSettingsAndHeaders)));
+  f.FlushExecCtx();
+
+  const size_t length = state.range(0);
+  grpc_slice incoming = CreateIncomingDataSlice(length, 16384);
+  const uint8_t* incoming_begin = GRPC_SLICE_START_PTR(incoming);
+  const uint8_t* incoming_end = GRPC_SLICE_END_PTR(incoming);
+  absl::optional<grpc_core::SliceBuffer> recv_message;
+  uint32_t recv_flags;
+  std::unique_ptr<TestClosure> recv_message_ready =
+      MakeTestClosure([](grpc_error_handle error) { GPR_ASSERT(error.ok()); });
+  size_t bytes_copied = 0;
+  for (auto _ : state) {
+    reset_op();
+    op.recv_message = true;
+    op.payload->recv_message.recv_message = &recv_message;
+    op.payload->recv_message.flags = &recv_flags;
+    op.payload->recv_message.recv_message_ready = recv_message_ready.get();
+    s->Op(&op);
+    f.PushInput(grpc_slice_ref(incoming));
+    f.FlushExecCtx();
+    GPR_ASSERT(recv_message.has_value());
+    GPR_ASSERT(recv_message->Length() == length);
+    const grpc_slice_buffer* message = recv_message->c_slice_buffer();
+    for (size_t i = 0; i < message->count; i++) {
+      const uint8_t* p = GRPC_SLICE_START_PTR(message->slices[i]);
+      if (p < incoming_begin || p >= incoming_end) {
+        bytes_copied += GRPC_SLICE_LENGTH(message->slices[i]);
+      }
+    }
+    recv_message.reset();
+  }
+  state.counters["bytes_copied_per_message"] = benchmark::Counter(
+      static_cast<double>(bytes_copied), benchmark::Counter::kAvgIterations);
+  state.SetBytesProcessed(state.iterations() * length);
+  grpc_slice_unref(incoming);
+
+  reset_op();
+  op.cancel_stream = true;
+  op_payload.cancel_stream.cancel_error = absl::CancelledError();
+  gpr_event* stream_cancel_done = new gpr_event;
+  gpr_event_init(stream_cancel_done);
+  std::unique_ptr<TestClosure> stream_cancel_closure =
+      MakeTestClosure([&](grpc_error_handle error) {
+        GPR_ASSERT(error.ok());
+        gpr_event_set(stream_cancel_done, reinterpret_cast<void*>(1));
+      });
+  op.on_complete = stream_cancel_closure.get();
+  s->Op(&op);
+  f.FlushExecCtx();
+  gpr_event_wait(stream_cancel_done, gpr_inf_future(GPR_CLOCK_REALTIME));
+  done_events.emplace_back(stream_cancel_done);
+  s->DestroyThen(
+      MakeOnceClosure([s](grpc_error_handle /*error*/) { delete s; }));
+  f.FlushExecCtx();
+}
+BENCHMARK(BM_TransportStreamRecv)->Arg(0)->Arg(128)->Arg(4096)->Arg(16000)
+    ->Arg(60000);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
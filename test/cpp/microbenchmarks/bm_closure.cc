@@ -128,6 +128,31 @@ static void BM_ClosureSched2OnExecCtx(benchmark::State& state) {
 }
 BENCHMARK(BM_ClosureSched2OnExecCtx);
 
+static void BM_ClosureRunInlineOnExecCtx(benchmark::State& state) {
+  grpc_closure c;
+  GRPC_CLOSURE_INIT(&c, DoNothing, nullptr, grpc_schedule_on_exec_ctx);
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    grpc_core::ExecCtx::RunInline(DEBUG_LOCATION, &c, absl::OkStatus());
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+}
+BENCHMARK(BM_ClosureRunInlineOnExecCtx);
+
+static void BM_ClosureRunInline2OnExecCtx(benchmark::State& state) {
+  grpc_closure c1;
+  grpc_closure c2;
+  GRPC_CLOSURE_INIT(&c1, DoNothing, nullptr, grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&c2, DoNothing, nullptr, grpc_schedule_on_exec_ctx);
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    grpc_core::ExecCtx::RunInline(DEBUG_LOCATION, &c1, absl::OkStatus());
+    grpc_core::ExecCtx::RunInline(DEBUG_LOCATION, &c2, absl::OkStatus());
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+}
+BENCHMARK(BM_ClosureRunInline2OnExecCtx);
+
 static void BM_ClosureSched3OnExecCtx(benchmark::State& state) {
   grpc_closure c1;
   grpc_closure c2;
@@ -305,6 +330,11 @@ class Rescheduler {
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::OkStatus());
   }
 
+  void ScheduleFirstInline() {
+    inline_ = true;
+    grpc_core::ExecCtx::RunInline(DEBUG_LOCATION, &closure_, absl::OkStatus());
+  }
+
   void ScheduleFirstAgainstDifferentScheduler() {
     grpc_core::ExecCtx::Run(DEBUG_LOCATION,
                             GRPC_CLOSURE_CREATE(Step, this, nullptr),
@@ -314,12 +344,18 @@ class Rescheduler {
  private:
   benchmark::State& state_;
   grpc_closure closure_;
+  bool inline_ = false;
 
   static void Step(void* arg, grpc_error_handle /*error*/) {
     Rescheduler* self = static_cast<Rescheduler*>(arg);
     if (self->state_.KeepRunning()) {
-      grpc_core::ExecCtx::Run(DEBUG_LOCATION, &self->closure_,
-                              absl::OkStatus());
+      if (self->inline_) {
+        grpc_core::ExecCtx::RunInline(DEBUG_LOCATION, &self->closure_,
+                                      absl::OkStatus());
+      } else {
+        grpc_core::ExecCtx::Run(DEBUG_LOCATION, &self->closure_,
+                                absl::OkStatus());
+      }
     }
   }
 };
@@ -332,6 +368,16 @@ static void BM_ClosureReschedOnExecCtx(benchmark::State& state) {
 }
 BENCHMARK(BM_ClosureReschedOnExecCtx);
 
+// Each step runs the next inline until the depth limit queues one on the
+// ExecCtx, so this measures the mix a chain of inline continuations gets.
+static void BM_ClosureReschedInlineOnExecCtx(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  Rescheduler r(state);
+  r.ScheduleFirstInline();
+  grpc_core::ExecCtx::Get()->Flush();
+}
+BENCHMARK(BM_ClosureReschedInlineOnExecCtx);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
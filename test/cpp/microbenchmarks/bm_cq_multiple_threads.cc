@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include <atomic>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -42,6 +43,7 @@ static gpr_mu g_mu;
 static gpr_cv g_cv;
 static int g_threads_active;
 static bool g_active;
+static int g_events_per_work = 1;
 
 namespace grpc {
 namespace testing {
@@ -68,7 +70,7 @@ static void cq_done_cb(void* /*done_arg*/, grpc_cq_completion* cq_completion) {
   gpr_free(cq_completion);
 }
 
-/* Queues a completion tag if deadline is > 0.
+/* Queues g_events_per_work completion tags if deadline is > 0.
  * Does nothing if deadline is 0 (i.e gpr_time_0(GPR_CLOCK_MONOTONIC)) */
 static grpc_error_handle pollset_work(grpc_pollset* ps,
                                       grpc_pollset_worker** /*worker*/,
@@ -81,10 +83,12 @@ static grpc_error_handle pollset_work(grpc_pollset* ps,
   gpr_mu_unlock(&ps->mu);
 
   void* tag = reinterpret_cast<void*>(10);  // Some random number
-  GPR_ASSERT(grpc_cq_begin_op(g_cq, tag));
-  grpc_cq_end_op(
-      g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
-      static_cast<grpc_cq_completion*>(gpr_malloc(sizeof(grpc_cq_completion))));
+  for (int i = 0; i < g_events_per_work; i++) {
+    GPR_ASSERT(grpc_cq_begin_op(g_cq, tag));
+    grpc_cq_end_op(g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
+                   static_cast<grpc_cq_completion*>(
+                       gpr_malloc(sizeof(grpc_cq_completion))));
+  }
   grpc_core::ExecCtx::Get()->Flush();
   gpr_mu_lock(&ps->mu);
   return absl::OkStatus();
@@ -114,7 +118,8 @@ static grpc_event_engine_vtable make_engine_vtable(const char* name) {
   return vtable;
 }
 
-static void setup() {
+static void setup(int events_per_work) {
+  g_events_per_work = events_per_work;
   grpc_init();
   GPR_ASSERT(strcmp(grpc_get_poll_strategy_name(), "none") == 0 ||
              strcmp(grpc_get_poll_strategy_name(), "bm_cq_multiple_threads") ==
@@ -157,14 +162,12 @@ static void teardown() {
  and its Finish call must take place before grpc_shutdown so that it can use
  grpc_stats).
 */
-static void BM_Cq_Throughput(benchmark::State& state) {
+static void start_threads(benchmark::State& state, int events_per_work) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
-  auto thd_idx = state.thread_index();
-
   gpr_mu_lock(&g_mu);
   g_threads_active++;
-  if (thd_idx == 0) {
-    setup();
+  if (state.thread_index() == 0) {
+    setup(events_per_work);
     g_active = true;
     gpr_cv_broadcast(&g_cv);
   } else {
@@ -173,14 +176,10 @@ static void BM_Cq_Throughput(benchmark::State& state) {
     }
   }
   gpr_mu_unlock(&g_mu);
+}
 
-  for (auto _ : state) {
-    GPR_ASSERT(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
-               GRPC_OP_COMPLETE);
-  }
-
-  state.SetItemsProcessed(state.iterations());
-
+static void stop_threads(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
   gpr_mu_lock(&g_mu);
   g_threads_active--;
   if (g_threads_active == 0) {
@@ -192,14 +191,53 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
   gpr_mu_unlock(&g_mu);
 
-  if (thd_idx == 0) {
+  if (state.thread_index() == 0) {
     teardown();
     g_active = false;
   }
 }
 
+static void BM_Cq_Throughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  start_threads(state, 1);
+
+  for (auto _ : state) {
+    GPR_ASSERT(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+               GRPC_OP_COMPLETE);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  stop_threads(state);
+}
+
 BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
 
+/* Each poll queues state.range(0) events, which are read in batches of up to
+   as many with grpc_completion_queue_next_batch. */
+static void BM_Cq_ThroughputBatch(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  const int batch_size = state.range(0);
+  std::vector<grpc_event> events(batch_size);
+  start_threads(state, batch_size);
+
+  int64_t num_events = 0;
+  for (auto _ : state) {
+    size_t n = grpc_completion_queue_next_batch(g_cq, events.data(),
+                                                batch_size, deadline, nullptr);
+    GPR_ASSERT(events[0].type == GRPC_OP_COMPLETE);
+    num_events += n;
+  }
+
+  state.SetItemsProcessed(num_events);
+  stop_threads(state);
+}
+
+BENCHMARK(BM_Cq_ThroughputBatch)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
     grpc::testing::make_engine_vtable("none");
@@ -0,0 +1,334 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks for EventEngine endpoints connected over loopback TCP: ping-pong
+// latency, streaming throughput, and many connections streaming into one
+// process. The poller is picked as usual with GRPC_POLL_STRATEGY, so pollers
+// are compared by running the benchmarks once with each (for example epoll1
+// and poll). Each benchmark takes whether to enable zerocopy sends as its
+// last argument.
+//
+// Besides time, each benchmark reports the read and write syscalls per
+// message from the stats counters, and the process CPU time per byte.
+
+#include <stdint.h>
+
+#include <chrono>
+#include <ctime>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/event_engine/test_suite/event_engine_test_utils.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+using ::grpc_event_engine::experimental::Slice;
+using ::grpc_event_engine::experimental::SliceBuffer;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+using Endpoint = ::grpc_event_engine::experimental::EventEngine::Endpoint;
+using Listener = ::grpc_event_engine::experimental::EventEngine::Listener;
+
+// A listener and the endpoints connected to it.
+class Connector {
+ public:
+  explicit Connector(bool zerocopy)
+      : engine_(GetDefaultEventEngine()),
+        config_(grpc_core::ChannelArgs()
+                    .Set(GRPC_ARG_RESOURCE_QUOTA,
+                         grpc_core::ResourceQuota::Default())
+                    .Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED,
+                         static_cast<int>(zerocopy))),
+        address_(URIToResolvedAddress(
+            absl::StrCat("ipv4:127.0.0.1:", grpc_pick_unused_port_or_die()))),
+        memory_quota_("bm_event_engine_endpoint") {
+    auto listener = engine_->CreateListener(
+        [this](std::unique_ptr<Endpoint> endpoint,
+               grpc_core::MemoryAllocator /*memory_allocator*/) {
+          grpc_core::MutexLock lock(&mu_);
+          accepted_.push_back(std::move(endpoint));
+          cv_.Signal();
+        },
+        [](absl::Status /*status*/) {}, config_,
+        std::make_unique<grpc_core::MemoryQuota>("bm_listener"));
+    GPR_ASSERT(listener.ok());
+    listener_ = std::move(*listener);
+    GPR_ASSERT(listener_->Bind(address_).ok());
+    GPR_ASSERT(listener_->Start().ok());
+  }
+
+  // Returns a connected client endpoint and the server endpoint it is
+  // connected to.
+  std::pair<std::unique_ptr<Endpoint>, std::unique_ptr<Endpoint>> Connect() {
+    grpc_core::Notification connected;
+    std::unique_ptr<Endpoint> client;
+    engine_->Connect(
+        [&](absl::StatusOr<std::unique_ptr<Endpoint>> endpoint) {
+          GPR_ASSERT(endpoint.ok());
+          client = std::move(*endpoint);
+          connected.Notify();
+        },
+        address_, config_,
+        memory_quota_.CreateMemoryAllocator("bm_client"),
+        std::chrono::seconds(10));
+    connected.WaitForNotification();
+    grpc_core::MutexLock lock(&mu_);
+    while (accepted_.empty()) cv_.Wait(&mu_);
+    std::unique_ptr<Endpoint> server = std::move(accepted_.front());
+    accepted_.pop_front();
+    return {std::move(client), std::move(server)};
+  }
+
+ private:
+  std::shared_ptr<EventEngine> engine_;
+  ChannelArgsEndpointConfig config_;
+  EventEngine::ResolvedAddress address_;
+  grpc_core::MemoryQuota memory_quota_;
+  std::unique_ptr<Listener> listener_;
+  grpc_core::Mutex mu_;
+  grpc_core::CondVar cv_;
+  std::deque<std::unique_ptr<Endpoint>> accepted_ ABSL_GUARDED_BY(mu_);
+};
+
+// Writes \a size bytes to \a endpoint and waits for the write to complete.
+void WriteAndWait(Endpoint* endpoint, size_t size) {
+  SliceBuffer data;
+  data.Append(Slice::FromCopiedString(std::string(size, 'a')));
+  grpc_core::Notification written;
+  endpoint->Write(
+      [&written](absl::Status status) {
+        GPR_ASSERT(status.ok());
+        written.Notify();
+      },
+      &data, nullptr);
+  written.WaitForNotification();
+}
+
+// Keeps reading from an endpoint until it is shut down, optionally writing
+// back everything it reads. Must be destroyed after the endpoint.
+class Reader {
+ public:
+  Reader(Endpoint* endpoint, bool echo) : endpoint_(endpoint), echo_(echo) {
+    StartRead();
+  }
+
+  ~Reader() { done_.WaitForNotification(); }
+
+  // Waits until \a bytes in all have been read.
+  void WaitForBytes(int64_t bytes) {
+    grpc_core::MutexLock lock(&mu_);
+    while (bytes_read_ < bytes) cv_.Wait(&mu_);
+  }
+
+ private:
+  void StartRead() {
+    endpoint_->Read([this](absl::Status status) { OnRead(status); },
+                    &buffer_, nullptr);
+  }
+
+  void OnRead(absl::Status status) {
+    if (!status.ok()) {
+      done_.Notify();
+      return;
+    }
+    {
+      grpc_core::MutexLock lock(&mu_);
+      bytes_read_ += buffer_.Length();
+      cv_.Signal();
+    }
+    if (!echo_) {
+      buffer_.Clear();
+      StartRead();
+      return;
+    }
+    echo_buffer_.Clear();
+    buffer_.Swap(echo_buffer_);
+    endpoint_->Write(
+        [this](absl::Status status) {
+          if (!status.ok()) {
+            done_.Notify();
+            return;
+          }
+          StartRead();
+        },
+        &echo_buffer_, nullptr);
+  }
+
+  Endpoint* const endpoint_;
+  const bool echo_;
+  SliceBuffer buffer_;
+  SliceBuffer echo_buffer_;
+  grpc_core::Notification done_;
+  grpc_core::Mutex mu_;
+  grpc_core::CondVar cv_;
+  int64_t bytes_read_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+// Reports the syscalls and CPU time spent from its creation to Report().
+class CostCounter {
+ public:
+  CostCounter()
+      : stats_before_(grpc_core::global_stats().Collect()),
+        cpu_before_(std::clock()) {}
+
+  void Report(benchmark::State& state, int64_t messages, int64_t bytes) {
+    const std::clock_t cpu = std::clock() - cpu_before_;
+    auto stats = grpc_core::global_stats().Collect();
+    const double reads = stats->syscall_read - stats_before_->syscall_read;
+    const double writes = stats->syscall_write - stats_before_->syscall_write;
+    state.counters["read_syscalls_per_message"] = reads / messages;
+    state.counters["write_syscalls_per_message"] = writes / messages;
+    state.counters["cpu_ns_per_byte"] =
+        1e9 * cpu / CLOCKS_PER_SEC / static_cast<double>(bytes);
+    state.SetItemsProcessed(messages);
+    state.SetBytesProcessed(bytes);
+  }
+
+ private:
+  std::unique_ptr<grpc_core::GlobalStats> stats_before_;
+  std::clock_t cpu_before_;
+};
+
+// Sends a message and waits for it to be echoed back. Arguments: message
+// size, zerocopy.
+void BM_EndpointPingPong(benchmark::State& state) {
+  const size_t size = state.range(0);
+  Connector connector(state.range(1));
+  auto endpoints = connector.Connect();
+  auto echo = std::make_unique<Reader>(endpoints.second.get(), true);
+  auto reader = std::make_unique<Reader>(endpoints.first.get(), false);
+  int64_t messages = 0;
+  CostCounter cost;
+  for (auto _ : state) {
+    WriteAndWait(endpoints.first.get(), size);
+    reader->WaitForBytes(++messages * size);
+  }
+  // Each round trip is two messages.
+  cost.Report(state, 2 * messages, 2 * messages * size);
+  endpoints.first.reset();
+  endpoints.second.reset();
+}
+BENCHMARK(BM_EndpointPingPong)
+    ->ArgsProduct({{1, 1024, 64 * 1024}, {false, true}})
+    ->UseRealTime();
+
+// Streams messages in one direction and waits for all to be read. Arguments:
+// message size, zerocopy.
+void BM_EndpointStreaming(benchmark::State& state) {
+  constexpr int kMessagesPerIteration = 100;
+  const size_t size = state.range(0);
+  Connector connector(state.range(1));
+  auto endpoints = connector.Connect();
+  auto reader = std::make_unique<Reader>(endpoints.second.get(), false);
+  int64_t messages = 0;
+  CostCounter cost;
+  for (auto _ : state) {
+    for (int i = 0; i < kMessagesPerIteration; ++i) {
+      WriteAndWait(endpoints.first.get(), size);
+    }
+    messages += kMessagesPerIteration;
+    reader->WaitForBytes(messages * size);
+  }
+  cost.Report(state, messages, messages * size);
+  endpoints.first.reset();
+  endpoints.second.reset();
+}
+BENCHMARK(BM_EndpointStreaming)
+    ->ArgsProduct({{64, 1024, 64 * 1024}, {false, true}})
+    ->UseRealTime();
+
+// Streams messages from many connections into one process. Arguments:
+// number of connections, message size, zerocopy.
+void BM_EndpointFanIn(benchmark::State& state) {
+  const int connections = state.range(0);
+  const size_t size = state.range(1);
+  Connector connector(state.range(2));
+  std::vector<std::unique_ptr<Endpoint>> clients;
+  std::vector<std::unique_ptr<Endpoint>> servers;
+  std::vector<std::unique_ptr<Reader>> readers;
+  for (int i = 0; i < connections; ++i) {
+    auto endpoints = connector.Connect();
+    clients.push_back(std::move(endpoints.first));
+    servers.push_back(std::move(endpoints.second));
+    readers.push_back(std::make_unique<Reader>(servers.back().get(), false));
+  }
+  int64_t messages_per_connection = 0;
+  CostCounter cost;
+  for (auto _ : state) {
+    for (auto& client : clients) WriteAndWait(client.get(), size);
+    ++messages_per_connection;
+    for (auto& reader : readers) {
+      reader->WaitForBytes(messages_per_connection * size);
+    }
+  }
+  const int64_t messages = messages_per_connection * connections;
+  cost.Report(state, messages, messages * size);
+  clients.clear();
+  servers.clear();
+}
+BENCHMARK(BM_EndpointFanIn)
+    ->ArgsProduct({{10, 100}, {64, 1024}, {false, true}})
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  // The PosixEventEngine only does its own I/O with this experiment on.
+  grpc_core::ForceEnableExperiment("posix_event_engine_enable_polling", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,123 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Timer churn: most timers are deadlines that get cancelled long before they
+// fire, while many others are outstanding.
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+using ::grpc_event_engine::posix_engine::Timer;
+using ::grpc_event_engine::posix_engine::TimerList;
+using ::grpc_event_engine::posix_engine::TimerListHost;
+using ::grpc_event_engine::posix_engine::TimerWheel;
+
+class NoopClosure : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+class FixedTimeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  }
+  void Kick() override {}
+};
+
+// Adds and cancels a timer with state.range(0) others outstanding, on the
+// timer list alone.
+template <typename TimerListType>
+void BM_TimerList_InitCancel(benchmark::State& state) {
+  FixedTimeHost host;
+  TimerListType timer_list(&host);
+  NoopClosure closure;
+  const grpc_core::Timestamp now = host.Now();
+  std::vector<Timer> outstanding(state.range(0));
+  for (size_t i = 0; i < outstanding.size(); i++) {
+    timer_list.TimerInit(
+        &outstanding[i],
+        now + grpc_core::Duration::Milliseconds(1 + i % 600000), &closure);
+  }
+  std::vector<Timer> timers(64);
+  size_t n = 0;
+  for (auto _ : state) {
+    Timer* timer = &timers[n++ % timers.size()];
+    timer_list.TimerInit(timer, now + grpc_core::Duration::Seconds(20),
+                         &closure);
+    benchmark::DoNotOptimize(timer_list.TimerCancel(timer));
+  }
+  for (auto& timer : outstanding) {
+    benchmark::DoNotOptimize(timer_list.TimerCancel(&timer));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_TimerList_InitCancel, TimerList)->Range(1, 1 << 17);
+BENCHMARK_TEMPLATE(BM_TimerList_InitCancel, TimerWheel)->Range(1, 1 << 17);
+
+// RunAfter followed by Cancel on the default EventEngine, with
+// state.range(0) other timers outstanding.
+void BM_EventEngine_RunAfterCancel(benchmark::State& state) {
+  auto engine = GetDefaultEventEngine();
+  std::vector<EventEngine::TaskHandle> outstanding;
+  outstanding.reserve(state.range(0));
+  for (int i = 0; i < state.range(0); i++) {
+    outstanding.push_back(
+        engine->RunAfter(std::chrono::seconds(600 + i % 600), []() {}));
+  }
+  for (auto _ : state) {
+    auto handle = engine->RunAfter(std::chrono::seconds(20), []() {});
+    benchmark::DoNotOptimize(engine->Cancel(handle));
+  }
+  for (auto handle : outstanding) engine->Cancel(handle);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventEngine_RunAfterCancel)->Range(1, 1 << 17);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -45,6 +45,24 @@ BENCHMARK(BM_ExecCtx_Run)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+void BM_ExecCtx_RunInline(benchmark::State& state) {
+  int cb_count = state.range(0);
+  grpc_closure cb;
+  GRPC_CLOSURE_INIT(&cb, NoOpCb, nullptr, nullptr);
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    for (int i = 0; i < cb_count; i++) {
+      exec_ctx.RunInline(DEBUG_LOCATION, &cb, absl::OkStatus());
+      exec_ctx.Flush();
+    }
+  }
+  state.SetItemsProcessed(cb_count * state.iterations());
+}
+BENCHMARK(BM_ExecCtx_RunInline)
+    ->Range(100, 10000)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 struct CountingCbData {
   std::atomic_int cnt{0};
   grpc_core::Notification* signal;
@@ -0,0 +1,77 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark memory quota reservations */
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+static grpc_core::MemoryQuota* g_memory_quota =
+    grpc_core::ResourceQuota::Default()->memory_quota().get();
+
+// Each thread reserves and releases through its own allocator; the quota is
+// only touched when the allocator's local pool runs dry or overflows.
+static void BM_MemoryAllocator_ReserveRelease(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  auto allocator = g_memory_quota->CreateMemoryAllocator("bm");
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    size_t n = allocator.Reserve(grpc_core::MemoryRequest(size));
+    allocator.Release(n);
+  }
+}
+BENCHMARK(BM_MemoryAllocator_ReserveRelease)
+    ->RangeMultiplier(16)
+    ->Range(64, 1024 * 1024)
+    ->ThreadRange(1, 64);
+
+// Short lived allocators (e.g. per call) take from and return to the shared
+// quota on every iteration.
+static void BM_MemoryAllocator_CreateReserveDestroy(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    auto allocator = g_memory_quota->CreateMemoryAllocator("bm");
+    size_t n = allocator.Reserve(grpc_core::MemoryRequest(size));
+    allocator.Release(n);
+  }
+}
+BENCHMARK(BM_MemoryAllocator_CreateReserveDestroy)
+    ->RangeMultiplier(16)
+    ->Range(64, 64 * 1024)
+    ->ThreadRange(1, 64);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
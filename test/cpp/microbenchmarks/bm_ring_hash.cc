@@ -0,0 +1,136 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Building and querying the ring_hash lookup tables, which happens on every
+// address update and every pick respectively.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_core::MakeRefCounted;
+using grpc_core::RefCountedPtr;
+using grpc_core::RingHashConfig;
+using grpc_core::RingHashLookupTable;
+
+std::vector<RingHashLookupTable::Endpoint> MakeEndpoints(size_t count) {
+  std::vector<RingHashLookupTable::Endpoint> endpoints;
+  endpoints.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    endpoints.push_back(
+        {absl::StrCat("10.", i / 65536, ".", (i / 256) % 256, ".", i % 256,
+                      ":443"),
+         1});
+  }
+  return endpoints;
+}
+
+RingHashConfig MakeConfig(RingHashConfig::LookupTable lookup_table) {
+  RingHashConfig config;
+  config.lookup_table = lookup_table;
+  // The ring sizes seen with large clusters.
+  config.min_ring_size = 262144;
+  config.max_ring_size = 8388608;
+  config.maglev_table_size = 655373;
+  return config;
+}
+
+void BuildTable(benchmark::State& state,
+                RingHashConfig::LookupTable lookup_table) {
+  const RingHashConfig config = MakeConfig(lookup_table);
+  const auto endpoints = MakeEndpoints(state.range(0));
+  for (auto _ : state) {
+    auto table = MakeRefCounted<RingHashLookupTable>(config, endpoints);
+    benchmark::DoNotOptimize(table->size());
+  }
+}
+
+void BM_RingBuild(benchmark::State& state) {
+  BuildTable(state, RingHashConfig::LookupTable::kRing);
+}
+BENCHMARK(BM_RingBuild)->Arg(16)->Arg(512)->Arg(5000);
+
+void BM_MaglevBuild(benchmark::State& state) {
+  BuildTable(state, RingHashConfig::LookupTable::kMaglev);
+}
+BENCHMARK(BM_MaglevBuild)->Arg(16)->Arg(512)->Arg(5000);
+
+// What an update whose endpoints are unchanged costs instead of a build.
+void BM_TableReuseCheck(benchmark::State& state) {
+  const RingHashConfig config =
+      MakeConfig(RingHashConfig::LookupTable::kMaglev);
+  const auto endpoints = MakeEndpoints(state.range(0));
+  auto table = MakeRefCounted<RingHashLookupTable>(config, endpoints);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table->Matches(config, endpoints));
+  }
+}
+BENCHMARK(BM_TableReuseCheck)->Arg(16)->Arg(512)->Arg(5000);
+
+void FindInTable(benchmark::State& state,
+                 RingHashConfig::LookupTable lookup_table) {
+  auto table = MakeRefCounted<RingHashLookupTable>(
+      MakeConfig(lookup_table), MakeEndpoints(state.range(0)));
+  absl::BitGen bitgen;
+  std::vector<uint64_t> hashes(4096);
+  for (uint64_t& hash : hashes) hash = absl::Uniform<uint64_t>(bitgen);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        table->EndpointIndex(table->Find(hashes[i++ % hashes.size()])));
+  }
+}
+
+void BM_RingFind(benchmark::State& state) {
+  FindInTable(state, RingHashConfig::LookupTable::kRing);
+}
+BENCHMARK(BM_RingFind)->Arg(16)->Arg(5000);
+
+void BM_MaglevFind(benchmark::State& state) {
+  FindInTable(state, RingHashConfig::LookupTable::kMaglev);
+}
+BENCHMARK(BM_MaglevFind)->Arg(16)->Arg(5000);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
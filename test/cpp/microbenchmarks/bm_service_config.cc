@@ -0,0 +1,79 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks parsing and applying large service configs.
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/service_config/service_config_impl.h"
+
+// A service config with one methodConfig entry per method, spread over
+// services of 100 methods each.
+std::string LargeServiceConfig(int num_methods) {
+  std::string json =
+      "{\"loadBalancingConfig\":[{\"round_robin\":{}}],\"methodConfig\":[";
+  for (int i = 0; i < num_methods; i++) {
+    absl::StrAppend(&json, i == 0 ? "" : ",",
+                    "{\"name\":[{\"service\":\"grpc.testing.Service", i / 100,
+                    "\",\"method\":\"Method", i,
+                    "\"}],\"timeout\":\"1.5s\",\"waitForReady\":true,"
+                    "\"maxRequestMessageBytes\":1048576}");
+  }
+  absl::StrAppend(&json, "]}");
+  return json;
+}
+
+void BM_JsonParse(benchmark::State& state) {
+  const std::string json = LargeServiceConfig(state.range(0));
+  for (auto s : state) {
+    auto parsed = grpc_core::Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonParse)->Arg(10)->Arg(1000)->Arg(10000);
+
+void BM_ServiceConfigCreate(benchmark::State& state) {
+  const std::string json = LargeServiceConfig(state.range(0));
+  for (auto s : state) {
+    auto service_config =
+        grpc_core::ServiceConfigImpl::Create(grpc_core::ChannelArgs(), json);
+    GPR_ASSERT(service_config.ok());
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ServiceConfigCreate)->Arg(10)->Arg(1000)->Arg(10000);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark what a process that makes a single RPC pays before the RPC:
+// building the core configuration, and initializing the library and creating
+// the first channel.
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+
+#include "src/core/lib/config/core_configuration.h"
+
+void BM_BuildCoreConfiguration(benchmark::State& state) {
+  for (auto s : state) {
+    grpc_core::CoreConfiguration::Reset();
+    benchmark::DoNotOptimize(&grpc_core::CoreConfiguration::Get());
+  }
+}
+BENCHMARK(BM_BuildCoreConfiguration);
+
+void BM_InitAndCreateFirstChannel(benchmark::State& state) {
+  for (auto s : state) {
+    grpc_core::CoreConfiguration::Reset();
+    grpc_init();
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    grpc_channel* channel =
+        grpc_channel_create("localhost:1234", creds, nullptr);
+    grpc_channel_credentials_release(creds);
+    grpc_channel_destroy(channel);
+    grpc_shutdown_blocking();
+  }
+}
+BENCHMARK(BM_InitAndCreateFirstChannel);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
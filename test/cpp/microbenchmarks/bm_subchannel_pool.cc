@@ -0,0 +1,142 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Creating and destroying subchannels in the global subchannel pool from
+// many threads at once, as happens when many channels are created at the
+// same time.
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include "src/core/ext/filters/client_channel/connector.h"
+#include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
+#include "src/core/ext/filters/client_channel/subchannel.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_args_preconditioning.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_core::ChannelArgs;
+using grpc_core::CoreConfiguration;
+using grpc_core::ExecCtx;
+using grpc_core::GlobalSubchannelPool;
+using grpc_core::MakeOrphanable;
+using grpc_core::RefCountedPtr;
+using grpc_core::Subchannel;
+using grpc_core::SubchannelConnector;
+using grpc_core::SubchannelPoolInterface;
+
+// The subchannels are never connected.
+class NoOpConnector : public SubchannelConnector {
+ public:
+  void Connect(const Args& /*args*/, Result* /*result*/,
+               grpc_closure* /*notify*/) override {}
+  void Shutdown(grpc_error_handle /*error*/) override {}
+};
+
+ChannelArgs MakeArgs() {
+  return CoreConfiguration::Get()
+      .channel_args_preconditioning()
+      .PreconditionChannelArgs(nullptr)
+      .SetObject<SubchannelPoolInterface>(GlobalSubchannelPool::instance());
+}
+
+std::vector<grpc_resolved_address> MakeAddresses(size_t first, size_t count) {
+  std::vector<grpc_resolved_address> addresses;
+  addresses.reserve(count);
+  for (size_t i = first; i < first + count; ++i) {
+    addresses.push_back(*grpc_core::StringToSockaddr(
+        absl::StrCat("10.", i / 65536, ".", (i / 256) % 256, ".", i % 256),
+        443));
+  }
+  return addresses;
+}
+
+RefCountedPtr<Subchannel> CreateSubchannel(
+    const grpc_resolved_address& address, const ChannelArgs& args) {
+  return Subchannel::Create(MakeOrphanable<NoOpConnector>(), address, args);
+}
+
+// Each thread creates and destroys subchannels for its own addresses, so
+// every iteration registers and unregisters a subchannel.
+void BM_SubchannelCreateDestroy(benchmark::State& state) {
+  constexpr size_t kAddressesPerThread = 256;
+  ExecCtx exec_ctx;
+  const ChannelArgs args = MakeArgs();
+  const auto addresses = MakeAddresses(
+      state.thread_index() * kAddressesPerThread, kAddressesPerThread);
+  size_t i = 0;
+  for (auto _ : state) {
+    auto subchannel = CreateSubchannel(addresses[i++ % addresses.size()], args);
+    benchmark::DoNotOptimize(subchannel.get());
+    subchannel.reset();
+    exec_ctx.Flush();
+  }
+}
+BENCHMARK(BM_SubchannelCreateDestroy)->ThreadRange(1, 16)->UseRealTime();
+
+// All threads look up subchannels that already exist and are shared, as
+// channels to the same backends do.
+void BM_SubchannelFindExisting(benchmark::State& state) {
+  constexpr size_t kAddresses = 64;
+  ExecCtx exec_ctx;
+  const ChannelArgs args = MakeArgs();
+  const auto addresses = MakeAddresses(0, kAddresses);
+  // Each thread holds its own refs, so that the subchannels stay alive
+  // until every thread is done.
+  std::vector<RefCountedPtr<Subchannel>> held;
+  for (const auto& address : addresses) {
+    held.push_back(CreateSubchannel(address, args));
+  }
+  size_t i = state.thread_index();
+  for (auto _ : state) {
+    auto subchannel = CreateSubchannel(addresses[i++ % addresses.size()], args);
+    benchmark::DoNotOptimize(subchannel.get());
+  }
+  held.clear();
+  exec_ctx.Flush();
+}
+BENCHMARK(BM_SubchannelFindExisting)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -99,6 +99,70 @@ BENCHMARK(BM_ThreadPool_RunClosure)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+// Many external threads scheduling onto one pool. Work scheduled from outside
+// the pool goes through the shared queue, so this shows how that queue scales
+// with the number of producers.
+void BM_ThreadPool_ExternalProducers(benchmark::State& state) {
+  static ThreadPool* pool = nullptr;
+  if (state.thread_index() == 0) pool = new ThreadPool();
+  const int cb_count = state.range(0);
+  for (auto _ : state) {
+    grpc_core::Notification signal;
+    std::atomic_int count{0};
+    for (int i = 0; i < cb_count; i++) {
+      pool->Run([&signal, &count, cb_count]() {
+        if (++count == cb_count) signal.Notify();
+      });
+    }
+    signal.WaitForNotification();
+  }
+  state.SetItemsProcessed(cb_count * state.iterations());
+  if (state.thread_index() == 0) {
+    pool->Quiesce();
+    delete pool;
+  }
+}
+BENCHMARK(BM_ThreadPool_ExternalProducers)
+    ->Arg(1000)
+    ->ThreadRange(1, 64)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
+// A few closures scheduled from outside the pool each schedule many children
+// from a pool thread. The children land in one thread's local queue, and must
+// be stolen by idle threads for the work to spread across the pool.
+void BM_ThreadPool_WorkStealing(benchmark::State& state) {
+  const int seeds = state.range(0);
+  const int children = state.range(1);
+  const int total = seeds * children;
+  ThreadPool pool;
+  for (auto _ : state) {
+    grpc_core::Notification signal;
+    std::atomic_int count{0};
+    for (int i = 0; i < seeds; i++) {
+      pool.Run([&pool, &signal, &count, children, total]() {
+        for (int j = 0; j < children; j++) {
+          pool.Run([&signal, &count, total]() {
+            // Enough work per closure that stealing pays off.
+            benchmark::DoNotOptimize(std::pow(count.load(), 1.5));
+            if (++count == total) signal.Notify();
+          });
+        }
+      });
+    }
+    signal.WaitForNotification();
+  }
+  state.SetItemsProcessed(total * state.iterations());
+  pool.Quiesce();
+}
+BENCHMARK(BM_ThreadPool_WorkStealing)
+    ->Args({1, 4096})
+    ->Args({4, 1024})
+    ->Args({16, 256})
+    ->Args({64, 64})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 void FanoutTestArguments(benchmark::internal::Benchmark* b) {
   // TODO(hork): enable when the engines are fast enough to run these:
   // ->Args({10000, 1})  // chain of callbacks scheduling callbacks
@@ -33,6 +33,7 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::LockFreeWorkQueue;
 using ::grpc_event_engine::experimental::WorkQueue;
 
 grpc_core::Mutex globalMu;
@@ -116,6 +117,81 @@ BENCHMARK(BM_MultithreadedWorkQueuePopBack)
     ->Threads(4)
     ->ThreadPerCpu();
 
+// Every thread both adds to and pops from the front of one shared queue.
+template <typename Queue>
+void BM_MultiProducerMultiConsumer(benchmark::State& state) {
+  static Queue* queue;
+  if (state.thread_index() == 0) queue = new Queue();
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  for (auto _ : state) {
+    for (int i = 0; i < element_count; i++) queue->Add(&closure);
+    int cnt = 0;
+    while (cnt < element_count) {
+      if (queue->PopFront() != nullptr) ++cnt;
+    }
+  }
+  state.counters["Added"] = element_count * state.iterations();
+  state.counters["Popped"] = state.counters["Added"];
+  state.counters["Steal Rate"] =
+      benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
+  if (state.thread_index() == 0) delete queue;
+}
+BENCHMARK_TEMPLATE(BM_MultiProducerMultiConsumer, WorkQueue)
+    ->Range(1, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(1)
+    ->Threads(4)
+    ->ThreadPerCpu();
+BENCHMARK_TEMPLATE(BM_MultiProducerMultiConsumer, LockFreeWorkQueue)
+    ->Range(1, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(1)
+    ->Threads(4)
+    ->ThreadPerCpu();
+
+// One owner thread adds and pops LIFO from its queue while the other threads
+// steal from the front, like the ThreadPool's per-thread queues.
+template <typename Queue>
+void BM_OwnerWithThieves(benchmark::State& state) {
+  static Queue* queue;
+  if (state.thread_index() == 0) queue = new Queue();
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      for (int i = 0; i < element_count; i++) {
+        queue->Add(&closure);
+        if (i % 2 == 0) queue->PopBack();
+      }
+    } else {
+      for (int i = 0; i < element_count; i++) queue->PopFront();
+    }
+  }
+  state.counters["Steal Attempts"] = element_count * state.iterations();
+  state.counters["Steal Rate"] = benchmark::Counter(
+      state.counters["Steal Attempts"], benchmark::Counter::kIsRate);
+  if (state.thread_index() == 0) {
+    while (queue->PopFront() != nullptr) {
+    }
+    delete queue;
+  }
+}
+BENCHMARK_TEMPLATE(BM_OwnerWithThieves, WorkQueue)
+    ->Range(8, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(4)
+    ->ThreadPerCpu();
+BENCHMARK_TEMPLATE(BM_OwnerWithThieves, LockFreeWorkQueue)
+    ->Range(8, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(4)
+    ->ThreadPerCpu();
+
 void BM_WorkQueueClosureExecution(benchmark::State& state) {
   WorkQueue queue;
   int element_count = state.range(0);
@@ -118,6 +118,77 @@ class BidiClient : public grpc::ClientBidiReactor<EchoRequest, EchoResponse> {
   bool done = false;
 };
 
+// Reads a server stream to completion, then starts the next one.
+class ServerStreamingClient : public grpc::ClientReadReactor<EchoResponse> {
+ public:
+  ServerStreamingClient(benchmark::State* state, EchoTestService::Stub* stub,
+                        ClientContext* cli_ctx, EchoRequest* request,
+                        EchoResponse* response)
+      : state_{state},
+        stub_{stub},
+        cli_ctx_{cli_ctx},
+        request_{request},
+        response_{response} {
+    msgs_size_ = state->range(0);
+    msgs_to_receive_ = state->range(1);
+    write_batch_size_ = state->range(2);
+    StartNewRpc();
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) return;
+    reads_complete_++;
+    StartRead(response_);
+  }
+
+  void OnDone(const Status& s) override {
+    GPR_ASSERT(s.ok());
+    GPR_ASSERT(reads_complete_ == msgs_to_receive_);
+    if (state_->KeepRunning()) {
+      reads_complete_ = 0;
+      StartNewRpc();
+    } else {
+      std::unique_lock<std::mutex> l(mu);
+      done = true;
+      cv.notify_one();
+    }
+  }
+
+  void StartNewRpc() {
+    cli_ctx_->~ClientContext();
+    new (cli_ctx_) ClientContext();
+    cli_ctx_->AddMetadata(kServerMessageSize, std::to_string(msgs_size_));
+    cli_ctx_->AddMetadata(kServerMessagesToSend,
+                          std::to_string(msgs_to_receive_));
+    cli_ctx_->AddMetadata(kServerWriteBatchSize,
+                          std::to_string(write_batch_size_));
+    stub_->async()->ResponseStream(cli_ctx_, request_, this);
+    StartRead(response_);
+    StartCall();
+  }
+
+  void Await() {
+    std::unique_lock<std::mutex> l(mu);
+    while (!done) {
+      cv.wait(l);
+    }
+  }
+
+ private:
+  benchmark::State* state_;
+  EchoTestService::Stub* stub_;
+  ClientContext* cli_ctx_;
+  EchoRequest* request_;
+  EchoResponse* response_;
+  int reads_complete_{0};
+  int msgs_to_receive_;
+  int msgs_size_;
+  int write_batch_size_;
+  std::mutex mu;
+  std::condition_variable cv;
+  bool done = false;
+};
+
 template <class Fixture, class ClientContextMutator, class ServerContextMutator>
 static void BM_CallbackBidiStreaming(benchmark::State& state) {
   int message_size = state.range(0);
@@ -143,6 +214,29 @@ static void BM_CallbackBidiStreaming(benchmark::State& state) {
                           state.iterations());
 }
 
+// Server streaming pump: the server writes range(1) messages of range(0)
+// bytes each, range(2) messages per StartWriteBatch (1 means plain
+// StartWrite).
+template <class Fixture>
+static void BM_CallbackServerStreamingPump(benchmark::State& state) {
+  int message_size = state.range(0);
+  int messages = state.range(1);
+  CallbackStreamingTestService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub_(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext cli_ctx;
+  if (state.KeepRunning()) {
+    ServerStreamingClient test{&state, stub_.get(), &cli_ctx, &request,
+                               &response};
+    test.Await();
+  }
+  fixture.reset();
+  state.SetBytesProcessed(message_size * messages * state.iterations());
+}
+
 }  // namespace testing
 }  // namespace grpc
 #endif  // TEST_CPP_MICROBENCHMARKS_CALLBACK_STREAMING_PING_PONG_H
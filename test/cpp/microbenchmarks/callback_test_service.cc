@@ -18,6 +18,9 @@
 
 #include "test/cpp/microbenchmarks/callback_test_service.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace grpc {
 namespace testing {
 namespace {
@@ -61,6 +64,58 @@ ServerUnaryReactor* CallbackStreamingTestService::Echo(
   return reactor;
 }
 
+ServerWriteReactor<EchoResponse>* CallbackStreamingTestService::ResponseStream(
+    CallbackServerContext* context, const EchoRequest* /*request*/) {
+  class Reactor : public ServerWriteReactor<EchoResponse> {
+   public:
+    explicit Reactor(CallbackServerContext* context) {
+      int message_size = GetIntValueFromMetadata(
+          kServerMessageSize, context->client_metadata(), 0);
+      messages_to_send_ = GetIntValueFromMetadata(
+          kServerMessagesToSend, context->client_metadata(), 0);
+      int batch_size = std::max(
+          1, GetIntValueFromMetadata(kServerWriteBatchSize,
+                                     context->client_metadata(), 1));
+      response_.set_message(std::string(message_size, 'a'));
+      // Every message in a batch is the same response.
+      batch_.assign(batch_size, &response_);
+      NextWrite();
+    }
+    void OnDone() override { delete this; }
+    void OnCancel() override {}
+    void OnWriteDone(bool ok) override {
+      if (!ok) {
+        gpr_log(GPR_ERROR, "Server write failed");
+        return;
+      }
+      NextWrite();
+    }
+
+   private:
+    void NextWrite() {
+      int remaining = messages_to_send_ - messages_sent_;
+      if (remaining == 0) {
+        Finish(grpc::Status::OK);
+        return;
+      }
+      int count = std::min(remaining, static_cast<int>(batch_.size()));
+      messages_sent_ += count;
+      if (count == 1) {
+        StartWrite(&response_);
+      } else {
+        StartWriteBatch(batch_.data(), count, grpc::WriteOptions());
+      }
+    }
+
+    EchoResponse response_;
+    std::vector<const EchoResponse*> batch_;
+    int messages_to_send_;
+    int messages_sent_ = 0;
+  };
+
+  return new Reactor(context);
+}
+
 ServerBidiReactor<EchoRequest, EchoResponse>*
 CallbackStreamingTestService::BidiStream(CallbackServerContext* context) {
   class Reactor : public ServerBidiReactor<EchoRequest, EchoResponse> {
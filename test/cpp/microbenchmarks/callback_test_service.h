@@ -33,6 +33,8 @@ namespace grpc {
 namespace testing {
 
 const char* const kServerMessageSize = "server_message_size";
+const char* const kServerMessagesToSend = "server_messages_to_send";
+const char* const kServerWriteBatchSize = "server_write_batch_size";
 
 class CallbackStreamingTestService : public EchoTestService::CallbackService {
  public:
@@ -42,6 +44,9 @@ class CallbackStreamingTestService : public EchoTestService::CallbackService {
                            const EchoRequest* request,
                            EchoResponse* response) override;
 
+  ServerWriteReactor<EchoResponse>* ResponseStream(
+      CallbackServerContext* context, const EchoRequest* request) override;
+
   ServerBidiReactor<EchoRequest, EchoResponse>* BidiStream(
       CallbackServerContext* context) override;
 };
@@ -25,6 +25,7 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -110,6 +111,8 @@ class ClientRequestCreator<ByteBuffer> {
       memset(buf.get(), 0, req_sz);
       Slice slice(buf.get(), req_sz);
       *req = ByteBuffer(&slice, 1);
+    } else if (payload_config.has_trace_params()) {
+      // Requests are drawn from the trace's size distributions per message.
     } else {
       gpr_log(GPR_ERROR, "Invalid PayloadConfig, missing bytebug_params: %s",
               payload_config.DebugString().c_str());
@@ -120,27 +123,67 @@ class ClientRequestCreator<ByteBuffer> {
 
 class HistogramEntry final {
  public:
-  HistogramEntry() : value_used_(false), status_used_(false) {}
+  HistogramEntry()
+      : value_used_(false),
+        value_from_intended_start_used_(false),
+        status_used_(false),
+        method_used_(false) {}
   bool value_used() const { return value_used_; }
   double value() const { return value_; }
   void set_value(double v) {
     value_used_ = true;
     value_ = v;
   }
+  // Latency measured from the time an open-loop client scheduled the rpc to
+  // be issued rather than from when it was actually started. Closed-loop
+  // clients have no schedule and leave this unset, in which case value() is
+  // used in its place.
+  bool value_from_intended_start_used() const {
+    return value_from_intended_start_used_;
+  }
+  double value_from_intended_start() const {
+    return value_from_intended_start_;
+  }
+  void set_value_from_intended_start(double v) {
+    value_from_intended_start_used_ = true;
+    value_from_intended_start_ = v;
+  }
   bool status_used() const { return status_used_; }
   int status() const { return status_; }
   void set_status(int status) {
     status_used_ = true;
     status_ = status;
   }
+  // Index of the method called in the trace a client replays, if any.
+  bool method_used() const { return method_used_; }
+  int method() const { return method_; }
+  void set_method(int method) {
+    method_used_ = true;
+    method_ = method;
+  }
 
  private:
   bool value_used_;
   double value_;
+  bool value_from_intended_start_used_;
+  double value_from_intended_start_;
   bool status_used_;
   int status_;
+  bool method_used_;
+  int method_;
 };
 
+// Nanoseconds elapsed since \a intended_start, the time returned by
+// Client::NextIssueTime() for an rpc. If the client falls behind its schedule,
+// e.g. because all outstanding rpcs are stuck behind a slow one, the time an
+// rpc spends waiting to be issued is charged to its latency instead of being
+// silently dropped (coordinated omission).
+inline double NanosSinceIntendedStart(gpr_timespec intended_start) {
+  const gpr_timespec elapsed =
+      gpr_time_sub(gpr_now(intended_start.clock_type), intended_start);
+  return elapsed.tv_sec * 1e9 + elapsed.tv_nsec;
+}
+
 typedef std::unordered_map<int, int64_t> StatusHistogram;
 
 inline void MergeStatusHistogram(const StatusHistogram& from,
@@ -151,6 +194,15 @@ inline void MergeStatusHistogram(const StatusHistogram& from,
   }
 }
 
+typedef std::unordered_map<int, Histogram> MethodHistograms;
+
+inline void MergeMethodHistograms(const MethodHistograms& from,
+                                  MethodHistograms* to) {
+  for (const auto& p : from) {
+    (*to)[p.first].Merge(p.second);
+  }
+}
+
 class Client {
  public:
   Client()
@@ -164,7 +216,9 @@ class Client {
 
   ClientStats Mark(bool reset) {
     Histogram latencies;
+    Histogram latencies_from_intended_start;
     StatusHistogram statuses;
+    MethodHistograms method_latencies;
     UsageTimer::Result timer_result;
 
     MaybeStartRequests();
@@ -173,23 +227,29 @@ class Client {
     int poll_count = cur_poll_count - last_reset_poll_count_;
     if (reset) {
       std::vector<Histogram> to_merge(threads_.size());
+      std::vector<Histogram> to_merge_intended(threads_.size());
       std::vector<StatusHistogram> to_merge_status(threads_.size());
+      std::vector<MethodHistograms> to_merge_method(threads_.size());
 
       for (size_t i = 0; i < threads_.size(); i++) {
-        threads_[i]->BeginSwap(&to_merge[i], &to_merge_status[i]);
+        threads_[i]->BeginSwap(&to_merge[i], &to_merge_intended[i],
+                               &to_merge_status[i], &to_merge_method[i]);
       }
       std::unique_ptr<UsageTimer> timer(new UsageTimer);
       timer_.swap(timer);
       for (size_t i = 0; i < threads_.size(); i++) {
         latencies.Merge(to_merge[i]);
+        latencies_from_intended_start.Merge(to_merge_intended[i]);
         MergeStatusHistogram(to_merge_status[i], &statuses);
+        MergeMethodHistograms(to_merge_method[i], &method_latencies);
       }
       timer_result = timer->Mark();
       last_reset_poll_count_ = cur_poll_count;
     } else {
       // merge snapshots of each thread histogram
       for (size_t i = 0; i < threads_.size(); i++) {
-        threads_[i]->MergeStatsInto(&latencies, &statuses);
+        threads_[i]->MergeStatsInto(&latencies, &latencies_from_intended_start,
+                                    &statuses, &method_latencies);
       }
       timer_result = timer_->Mark();
     }
@@ -209,12 +269,19 @@ class Client {
 
     ClientStats stats;
     latencies.FillProto(stats.mutable_latencies());
+    latencies_from_intended_start.FillProto(
+        stats.mutable_latencies_from_intended_start());
     for (StatusHistogram::const_iterator it = statuses.begin();
          it != statuses.end(); ++it) {
       RequestResultCount* rrc = stats.add_request_results();
       rrc->set_status_code(it->first);
       rrc->set_count(it->second);
     }
+    for (auto& p : method_latencies) {
+      MethodLatencies* ml = stats.add_method_latencies();
+      ml->set_method(method_names_[p.first]);
+      p.second.FillProto(ml->mutable_latencies());
+    }
     stats.set_time_elapsed(timer_result.wall);
     stats.set_time_system(timer_result.system);
     stats.set_time_user(timer_result.user);
@@ -266,16 +333,22 @@ class Client {
 
     ~Thread() { impl_.join(); }
 
-    void BeginSwap(Histogram* n, StatusHistogram* s) {
+    void BeginSwap(Histogram* n, Histogram* intended, StatusHistogram* s,
+                   MethodHistograms* m) {
       std::lock_guard<std::mutex> g(mu_);
       n->Swap(&histogram_);
+      intended->Swap(&histogram_from_intended_start_);
       s->swap(statuses_);
+      m->swap(method_histograms_);
     }
 
-    void MergeStatsInto(Histogram* hist, StatusHistogram* s) {
+    void MergeStatsInto(Histogram* hist, Histogram* intended,
+                        StatusHistogram* s, MethodHistograms* m) {
       std::unique_lock<std::mutex> g(mu_);
       hist->Merge(histogram_);
+      intended->Merge(histogram_from_intended_start_);
       MergeStatusHistogram(statuses_, s);
+      MergeMethodHistograms(method_histograms_, m);
     }
 
     std::vector<double> GetMedianPerIntervalList() {
@@ -286,6 +359,13 @@ class Client {
       std::lock_guard<std::mutex> g(mu_);
       if (entry->value_used()) {
         histogram_.Add(entry->value());
+        histogram_from_intended_start_.Add(
+            entry->value_from_intended_start_used()
+                ? entry->value_from_intended_start()
+                : entry->value());
+        if (entry->method_used()) {
+          method_histograms_[entry->method()].Add(entry->value());
+        }
         if (client_->GetLatencyCollectionIntervalInSeconds() > 0) {
           histogram_per_interval_.Add(entry->value());
           double now = UsageTimer::Now();
@@ -326,7 +406,9 @@ class Client {
 
     std::mutex mu_;
     Histogram histogram_;
+    Histogram histogram_from_intended_start_;
     StatusHistogram statuses_;
+    MethodHistograms method_histograms_;
     Client* client_;
     const size_t idx_;
     std::thread impl_;
@@ -341,6 +423,9 @@ class Client {
   bool closed_loop_;
   gpr_atm thread_pool_done_;
   double median_latency_collection_interval_seconds_;  // In seconds
+  // Names of the methods of a replayed trace, indexed by
+  // HistogramEntry::method().
+  std::vector<std::string> method_names_;
 
   void StartThreads(size_t num_threads) {
     gpr_atm_rel_store(&thread_pool_done_, static_cast<gpr_atm>(false));
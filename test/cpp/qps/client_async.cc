@@ -16,11 +16,13 @@
  *
  */
 
+#include <algorithm>
 #include <forward_list>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -101,6 +103,10 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       case State::RESP_DONE:
         if (status_.ok()) {
           entry->set_value((UsageTimer::Now() - start_) * 1e9);
+          if (next_issue_) {
+            entry->set_value_from_intended_start(
+                NanosSinceIntendedStart(intended_start_));
+          }
         }
         callback_(status_, &response_, entry);
         next_state_ = State::INVALID;
@@ -134,6 +140,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  gpr_timespec intended_start_;
   std::unique_ptr<grpc::ClientAsyncResponseReader<ResponseType>>
       response_reader_;
 
@@ -143,7 +150,8 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       RunNextState(true, nullptr);
     } else {  // wait for the issue time
       alarm_ = std::make_unique<Alarm>();
-      alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+      intended_start_ = next_issue_();
+      alarm_->Set(cq_, intended_start_, ClientRpcContext::tag(this));
     }
   }
 };
@@ -372,7 +380,8 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          intended_start_ = next_issue_();
+          alarm_->Set(cq_, intended_start_, ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
@@ -397,6 +406,10 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
           break;
         case State::READ_DONE:
           entry->set_value((UsageTimer::Now() - start_) * 1e9);
+          if (next_issue_) {
+            entry->set_value_from_intended_start(
+                NanosSinceIntendedStart(intended_start_));
+          }
           callback_(status_, &response_);
           if ((messages_per_stream_ != 0) &&
               (++messages_issued_ >= messages_per_stream_)) {
@@ -458,6 +471,7 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  gpr_timespec intended_start_;
   std::unique_ptr<grpc::ClientAsyncReaderWriter<RequestType, ResponseType>>
       stream_;
 
@@ -557,7 +571,8 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
           break;  // loop around, don't return
         case State::WAIT:
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          intended_start_ = next_issue_();
+          alarm_->Set(cq_, intended_start_, ClientRpcContext::tag(this));
           next_state_ = State::READY_TO_WRITE;
           return true;
         case State::READY_TO_WRITE:
@@ -573,6 +588,10 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
             return false;
           }
           entry->set_value((UsageTimer::Now() - start_) * 1e9);
+          if (next_issue_) {
+            entry->set_value_from_intended_start(
+                NanosSinceIntendedStart(intended_start_));
+          }
           next_state_ = State::STREAM_IDLE;
           break;  // loop around
         default:
@@ -611,6 +630,7 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  gpr_timespec intended_start_;
   std::unique_ptr<grpc::ClientAsyncWriter<RequestType>> stream_;
 
   void StartInternal(CompletionQueue* cq) {
@@ -768,8 +788,92 @@ class AsyncStreamingFromServerClient final
   }
 };
 
+// Draws values with probability proportional to their weights.
+template <typename T>
+class WeightedChoice {
+ public:
+  // Values with a weight that is not positive are never drawn.
+  void Add(T value, double weight) {
+    if (!(weight > 0)) return;
+    total_weight_ += weight;
+    cumulative_weights_.push_back(total_weight_);
+    values_.push_back(std::move(value));
+  }
+  bool empty() const { return values_.empty(); }
+  const T& Pick(std::mt19937* rng) const {
+    const double x =
+        std::uniform_real_distribution<double>(0, total_weight_)(*rng);
+    size_t i = std::upper_bound(cumulative_weights_.begin(),
+                                cumulative_weights_.end(), x) -
+               cumulative_weights_.begin();
+    return values_[std::min(i, values_.size() - 1)];
+  }
+
+ private:
+  std::vector<T> values_;
+  std::vector<double> cumulative_weights_;
+  double total_weight_ = 0;
+};
+
+// The workload described by TraceParams. It is shared by all the rpc
+// contexts of a client, each drawing from it with its own generator.
+class TraceModel {
+ public:
+  explicit TraceModel(const TraceParams& params) {
+    for (const auto& m : params.methods()) {
+      Method method;
+      for (const auto& size : m.request_sizes()) {
+        method.requests.Add(MakeRequest(size.value()), size.weight());
+      }
+      if (method.requests.empty()) method.requests.Add(MakeRequest(0), 1);
+      for (const auto& n : m.messages_per_stream()) {
+        method.messages_per_stream.Add(n.value(), n.weight());
+      }
+      method_choice_.Add(static_cast<int>(methods_.size()), m.weight());
+      methods_.push_back(std::move(method));
+      names_.push_back(m.name());
+    }
+    if (method_choice_.empty()) {
+      gpr_log(GPR_ERROR, "Invalid TraceParams, no method has weight: %s",
+              params.DebugString().c_str());
+      GPR_ASSERT(false);
+    }
+  }
+
+  const std::vector<std::string>& names() const { return names_; }
+  int PickMethod(std::mt19937* rng) const { return method_choice_.Pick(rng); }
+  const ByteBuffer& PickRequest(int method, std::mt19937* rng) const {
+    return methods_[method].requests.Pick(rng);
+  }
+  // Returns \a configured if the method has no stream lengths of its own.
+  int PickMessagesPerStream(int method, int configured,
+                            std::mt19937* rng) const {
+    const auto& choice = methods_[method].messages_per_stream;
+    return choice.empty() ? configured : choice.Pick(rng);
+  }
+
+ private:
+  struct Method {
+    WeightedChoice<ByteBuffer> requests;
+    WeightedChoice<int> messages_per_stream;
+  };
+
+  static ByteBuffer MakeRequest(int size) {
+    std::vector<char> buf(std::max(size, 0));
+    Slice slice(buf.data(), buf.size());
+    return ByteBuffer(&slice, 1);
+  }
+
+  std::vector<Method> methods_;
+  std::vector<std::string> names_;
+  WeightedChoice<int> method_choice_;
+};
+
 class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
  public:
+  // If \a trace is set, each stream calls a method drawn from it rather than
+  // the benchmark service's StreamingCall, and sends requests drawn from it
+  // rather than \a req.
   ClientRpcContextGenericStreamingImpl(
       grpc::GenericStub* stub, const ByteBuffer& req,
       std::function<gpr_timespec()> next_issue,
@@ -777,7 +881,8 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
           grpc::GenericStub*, grpc::ClientContext*,
           const std::string& method_name, CompletionQueue*)>
           prepare_req,
-      std::function<void(grpc::Status, ByteBuffer*)> on_done)
+      std::function<void(grpc::Status, ByteBuffer*)> on_done,
+      std::shared_ptr<const TraceModel> trace, uint32_t seed)
       : context_(),
         stub_(stub),
         cq_(nullptr),
@@ -786,7 +891,9 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
         next_state_(State::INVALID),
         callback_(std::move(on_done)),
         next_issue_(std::move(next_issue)),
-        prepare_req_(std::move(prepare_req)) {}
+        prepare_req_(std::move(prepare_req)),
+        trace_(std::move(trace)),
+        rng_(seed) {}
   ~ClientRpcContextGenericStreamingImpl() override {}
   void Start(CompletionQueue* cq, const ClientConfig& config) override {
     GPR_ASSERT(!config.use_coalesce_api());  // not supported yet.
@@ -805,7 +912,8 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          intended_start_ = next_issue_();
+          alarm_->Set(cq_, intended_start_, ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
@@ -813,7 +921,10 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
           }
           start_ = UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
-          stream_->Write(req_, ClientRpcContext::tag(this));
+          stream_->Write(trace_ == nullptr
+                             ? req_
+                             : trace_->PickRequest(method_, &rng_),
+                         ClientRpcContext::tag(this));
           return true;
         case State::WRITE_DONE:
           if (!ok) {
@@ -824,6 +935,11 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
           return true;
         case State::READ_DONE:
           entry->set_value((UsageTimer::Now() - start_) * 1e9);
+          if (next_issue_) {
+            entry->set_value_from_intended_start(
+                NanosSinceIntendedStart(intended_start_));
+          }
+          if (trace_ != nullptr) entry->set_method(method_);
           callback_(status_, &response_);
           if ((messages_per_stream_ != 0) &&
               (++messages_issued_ >= messages_per_stream_)) {
@@ -848,8 +964,8 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
   }
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextGenericStreamingImpl(
-        stub_, req_, next_issue_, prepare_req_, callback_);
-    clone->StartInternal(cq, messages_per_stream_);
+        stub_, req_, next_issue_, prepare_req_, callback_, trace_, rng_());
+    clone->StartInternal(cq, configured_messages_per_stream_);
   }
   void TryCancel() override { context_.TryCancel(); }
 
@@ -877,11 +993,17 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
       grpc::GenericStub*, grpc::ClientContext*, const std::string&,
       CompletionQueue*)>
       prepare_req_;
+  std::shared_ptr<const TraceModel> trace_;
+  std::mt19937 rng_;
+  // The method of trace_ this stream calls.
+  int method_ = 0;
   grpc::Status status_;
   double start_;
+  gpr_timespec intended_start_;
   std::unique_ptr<grpc::GenericClientAsyncReaderWriter> stream_;
 
   // Allow a limit on number of messages in a stream
+  int configured_messages_per_stream_;
   int messages_per_stream_;
   int messages_issued_;
 
@@ -889,9 +1011,17 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
     cq_ = cq;
     const std::string kMethodName(
         "/grpc.testing.BenchmarkService/StreamingCall");
+    configured_messages_per_stream_ = messages_per_stream;
     messages_per_stream_ = messages_per_stream;
     messages_issued_ = 0;
-    stream_ = prepare_req_(stub_, &context_, kMethodName, cq);
+    if (trace_ != nullptr) {
+      method_ = trace_->PickMethod(&rng_);
+      messages_per_stream_ =
+          trace_->PickMessagesPerStream(method_, messages_per_stream, &rng_);
+    }
+    stream_ = prepare_req_(
+        stub_, &context_,
+        trace_ == nullptr ? kMethodName : trace_->names()[method_], cq);
     next_state_ = State::STREAM_IDLE;
     stream_->StartCall(ClientRpcContext::tag(this));
   }
@@ -906,14 +1036,31 @@ class GenericAsyncStreamingClient final
     : public AsyncClient<grpc::GenericStub, ByteBuffer> {
  public:
   explicit GenericAsyncStreamingClient(const ClientConfig& config)
-      : AsyncClient<grpc::GenericStub, ByteBuffer>(config, SetupCtx,
-                                                   GenericStubCreator) {
-    StartThreads(num_async_threads_);
-  }
+      : GenericAsyncStreamingClient(config, MakeTrace(config)) {}
 
   ~GenericAsyncStreamingClient() override {}
 
  private:
+  GenericAsyncStreamingClient(const ClientConfig& config,
+                              std::shared_ptr<const TraceModel> trace)
+      : AsyncClient<grpc::GenericStub, ByteBuffer>(
+            config,
+            [trace](grpc::GenericStub* stub,
+                    std::function<gpr_timespec()> next_issue,
+                    const ByteBuffer& req) {
+              return SetupCtx(stub, std::move(next_issue), req, trace);
+            },
+            GenericStubCreator) {
+    if (trace != nullptr) method_names_ = trace->names();
+    StartThreads(num_async_threads_);
+  }
+
+  static std::shared_ptr<const TraceModel> MakeTrace(
+      const ClientConfig& config) {
+    if (!config.payload_config().has_trace_params()) return nullptr;
+    return std::make_shared<const TraceModel>(
+        config.payload_config().trace_params());
+  }
   static void CheckDone(const grpc::Status& /*s*/, ByteBuffer* /*response*/) {}
   static std::unique_ptr<grpc::GenericClientAsyncReaderWriter> PrepareReq(
       grpc::GenericStub* stub, grpc::ClientContext* ctx,
@@ -923,11 +1070,13 @@ class GenericAsyncStreamingClient final
   };
   static ClientRpcContext* SetupCtx(grpc::GenericStub* stub,
                                     std::function<gpr_timespec()> next_issue,
-                                    const ByteBuffer& req) {
+                                    const ByteBuffer& req,
+                                    std::shared_ptr<const TraceModel> trace) {
     return new ClientRpcContextGenericStreamingImpl(
         stub, req, std::move(next_issue),
         GenericAsyncStreamingClient::PrepareReq,
-        GenericAsyncStreamingClient::CheckDone);
+        GenericAsyncStreamingClient::CheckDone, std::move(trace),
+        std::random_device()());
   }
 };
 
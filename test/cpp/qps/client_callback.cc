@@ -46,7 +46,9 @@ namespace testing {
  */
 struct CallbackClientRpcContext {
   explicit CallbackClientRpcContext(BenchmarkService::Stub* stub)
-      : alarm_(nullptr), stub_(stub) {}
+      : alarm_(nullptr),
+        stub_(stub),
+        intended_start_(gpr_inf_past(GPR_CLOCK_MONOTONIC)) {}
 
   ~CallbackClientRpcContext() {}
 
@@ -54,6 +56,8 @@ struct CallbackClientRpcContext {
   ClientContext context_;
   std::unique_ptr<Alarm> alarm_;
   BenchmarkService::Stub* stub_;
+  // When the rpc was scheduled to be issued, for open-loop clients only
+  gpr_timespec intended_start_;
 };
 
 static std::unique_ptr<BenchmarkService::Stub> BenchmarkStubCreator(
@@ -176,6 +180,7 @@ class CallbackUnaryClient final : public CallbackClient {
       if (ctx_[vector_idx]->alarm_ == nullptr) {
         ctx_[vector_idx]->alarm_ = std::make_unique<Alarm>();
       }
+      ctx_[vector_idx]->intended_start_ = next_issue_time;
       ctx_[vector_idx]->alarm_->Set(next_issue_time,
                                     [this, t, vector_idx](bool /*ok*/) {
                                       IssueUnaryCallbackRpc(t, vector_idx);
@@ -187,13 +192,18 @@ class CallbackUnaryClient final : public CallbackClient {
 
   void IssueUnaryCallbackRpc(Thread* t, size_t vector_idx) {
     double start = UsageTimer::Now();
+    gpr_timespec intended_start = ctx_[vector_idx]->intended_start_;
     ctx_[vector_idx]->stub_->async()->UnaryCall(
         (&ctx_[vector_idx]->context_), &request_, &ctx_[vector_idx]->response_,
-        [this, t, start, vector_idx](grpc::Status s) {
+        [this, t, start, intended_start, vector_idx](grpc::Status s) {
           // Update Histogram with data from the callback run
           HistogramEntry entry;
           if (s.ok()) {
             entry.set_value((UsageTimer::Now() - start) * 1e9);
+            if (!closed_loop_) {
+              entry.set_value_from_intended_start(
+                  NanosSinceIntendedStart(intended_start));
+            }
           }
           entry.set_status(s.error_code());
           t->UpdateHistogram(&entry);
@@ -227,11 +237,16 @@ class CallbackStreamingClient : public CallbackClient {
   }
   ~CallbackStreamingClient() override {}
 
-  void AddHistogramEntry(double start, bool ok, Thread* thread_ptr) {
+  void AddHistogramEntry(double start, gpr_timespec intended_start, bool ok,
+                         Thread* thread_ptr) {
     // Update Histogram with data from the callback run
     HistogramEntry entry;
     if (ok) {
       entry.set_value((UsageTimer::Now() - start) * 1e9);
+      if (!closed_loop_) {
+        entry.set_value_from_intended_start(
+            NanosSinceIntendedStart(intended_start));
+      }
     }
     thread_ptr->UpdateHistogram(&entry);
   }
@@ -277,7 +292,8 @@ class CallbackStreamingPingPongReactor final
   }
 
   void OnReadDone(bool ok) override {
-    client_->AddHistogramEntry(write_time_, ok, thread_ptr_);
+    client_->AddHistogramEntry(write_time_, ctx_->intended_start_, ok,
+                               thread_ptr_);
 
     if (client_->ThreadCompleted() || !ok ||
         (client_->messages_per_stream() != 0 &&
@@ -292,6 +308,7 @@ class CallbackStreamingPingPongReactor final
     }
     if (!client_->IsClosedLoop()) {
       gpr_timespec next_issue_time = client_->NextRPCIssueTime();
+      ctx_->intended_start_ = next_issue_time;
       // Start an alarm callback to run the internal callback after
       // next_issue_time
       ctx_->alarm_->Set(next_issue_time, [this](bool /*ok*/) {
@@ -321,6 +338,7 @@ class CallbackStreamingPingPongReactor final
       if (ctx_->alarm_ == nullptr) {
         ctx_->alarm_ = std::make_unique<Alarm>();
       }
+      ctx_->intended_start_ = next_issue_time;
       ctx_->alarm_->Set(next_issue_time,
                         [this](bool /*ok*/) { StartNewRpc(); });
     } else {
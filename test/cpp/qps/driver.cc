@@ -21,6 +21,8 @@
 #include <cinttypes>
 #include <deque>
 #include <list>
+#include <map>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -104,6 +106,9 @@ static double SystemTime(const ClientStats& s) { return s.time_system(); }
 static double UserTime(const ClientStats& s) { return s.time_user(); }
 static double CliPollCount(const ClientStats& s) { return s.cq_poll_count(); }
 static double SvrPollCount(const ServerStats& s) { return s.cq_poll_count(); }
+static double SvrResidentMemory(const ServerStats& s) {
+  return s.resident_memory_bytes();
+}
 static double ServerWallTime(const ServerStats& s) { return s.time_elapsed(); }
 static double ServerSystemTime(const ServerStats& s) { return s.time_system(); }
 static double ServerUserTime(const ServerStats& s) { return s.time_user(); }
@@ -130,7 +135,8 @@ static bool IsSuccess(const Status& s) {
 }
 
 // Postprocess ScenarioResult and populate result summary.
-static void postprocess_scenario_result(ScenarioResult* result) {
+static void postprocess_scenario_result(ScenarioResult* result,
+                                        int client_channels) {
   // Get latencies from ScenarioResult latencies histogram and populate to
   // result summary.
   Histogram histogram;
@@ -141,6 +147,15 @@ static void postprocess_scenario_result(ScenarioResult* result) {
   result->mutable_summary()->set_latency_99(histogram.Percentile(99));
   result->mutable_summary()->set_latency_999(histogram.Percentile(99.9));
 
+  Histogram intended;
+  intended.MergeProto(result->latencies_from_intended_start());
+  auto* summary = result->mutable_summary();
+  summary->set_latency_from_intended_start_50(intended.Percentile(50));
+  summary->set_latency_from_intended_start_90(intended.Percentile(90));
+  summary->set_latency_from_intended_start_95(intended.Percentile(95));
+  summary->set_latency_from_intended_start_99(intended.Percentile(99));
+  summary->set_latency_from_intended_start_999(intended.Percentile(99.9));
+
   // Calculate qps and cpu load for each client and then aggregate results for
   // all clients
   double qps = 0;
@@ -222,6 +237,14 @@ static void postprocess_scenario_result(ScenarioResult* result) {
       server_queries_per_cpu_sec);
   result->mutable_summary()->set_client_queries_per_cpu_sec(
       client_queries_per_cpu_sec);
+
+  if (client_channels > 0) {
+    result->mutable_summary()->set_server_memory_per_channel_bytes(
+        sum(result->server_stats(), SvrResidentMemory) / client_channels);
+  }
+  result->mutable_summary()->set_server_polls_per_second(
+      sum(result->server_stats(), SvrPollCount) /
+      average(result->server_stats(), ServerWallTime));
 }
 
 struct ClientData {
@@ -252,7 +275,10 @@ static void FinishClients(const std::vector<ClientData>& clients,
 
 static void ReceiveFinalStatusFromClients(
     const std::vector<ClientData>& clients, Histogram& merged_latencies,
-    std::unordered_map<int, int64_t>& merged_statuses, ScenarioResult& result) {
+    Histogram& merged_latencies_from_intended_start,
+    std::unordered_map<int, int64_t>& merged_statuses,
+    std::map<std::string, Histogram>& merged_method_latencies,
+    ScenarioResult& result) {
   gpr_log(GPR_INFO, "Receiving final status from clients");
   ClientStatus client_status;
   for (size_t i = 0, i_end = clients.size(); i < i_end; i++) {
@@ -262,10 +288,16 @@ static void ReceiveFinalStatusFromClients(
       gpr_log(GPR_INFO, "Received final status from client %zu", i);
       const auto& stats = client_status.stats();
       merged_latencies.MergeProto(stats.latencies());
+      merged_latencies_from_intended_start.MergeProto(
+          stats.latencies_from_intended_start());
       for (int i = 0; i < stats.request_results_size(); i++) {
         merged_statuses[stats.request_results(i).status_code()] +=
             stats.request_results(i).count();
       }
+      for (const auto& method_latencies : stats.method_latencies()) {
+        merged_method_latencies[method_latencies.method()].MergeProto(
+            method_latencies.latencies());
+      }
       result.add_client_stats()->CopyFrom(stats);
       // Check that final status was should be the last message on the client
       // stream.
@@ -614,7 +646,9 @@ std::unique_ptr<ScenarioResult> RunScenario(
   // Finish a run
   std::unique_ptr<ScenarioResult> result(new ScenarioResult);
   Histogram merged_latencies;
+  Histogram merged_latencies_from_intended_start;
   std::unordered_map<int, int64_t> merged_statuses;
+  std::map<std::string, Histogram> merged_method_latencies;
 
   // For the case where clients lead the test such as UNARY and
   // STREAMING_FROM_CLIENT, clients need to finish completely while a server
@@ -631,7 +665,9 @@ std::unique_ptr<ScenarioResult> RunScenario(
     FinishServers(servers, server_mark);
   }
 
-  ReceiveFinalStatusFromClients(clients, merged_latencies, merged_statuses,
+  ReceiveFinalStatusFromClients(clients, merged_latencies,
+                                merged_latencies_from_intended_start,
+                                merged_statuses, merged_method_latencies,
                                 *result);
   ShutdownClients(clients, *result);
 
@@ -645,18 +681,25 @@ std::unique_ptr<ScenarioResult> RunScenario(
   delete g_inproc_servers;
 
   merged_latencies.FillProto(result->mutable_latencies());
+  merged_latencies_from_intended_start.FillProto(
+      result->mutable_latencies_from_intended_start());
   for (std::unordered_map<int, int64_t>::iterator it = merged_statuses.begin();
        it != merged_statuses.end(); ++it) {
     RequestResultCount* rrc = result->add_request_results();
     rrc->set_status_code(it->first);
     rrc->set_count(it->second);
   }
+  for (auto& p : merged_method_latencies) {
+    MethodLatencies* method_latencies = result->add_method_latencies();
+    method_latencies->set_method(p.first);
+    p.second.FillProto(method_latencies->mutable_latencies());
+  }
 
   // Fill in start and end time for the test scenario
   result->mutable_summary()->mutable_start_time()->set_seconds(start_time);
   result->mutable_summary()->mutable_end_time()->set_seconds(end_time);
 
-  postprocess_scenario_result(result.get());
+  postprocess_scenario_result(result.get(), client_config.client_channels());
   return result;
 }
 
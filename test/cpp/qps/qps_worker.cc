@@ -59,7 +59,8 @@ static std::unique_ptr<Client> CreateClient(const ClientConfig& config) {
     case ClientType::SYNC_CLIENT:
       return CreateSynchronousClient(config);
     case ClientType::ASYNC_CLIENT:
-      return config.payload_config().has_bytebuf_params()
+      return config.payload_config().has_bytebuf_params() ||
+                     config.payload_config().has_trace_params()
                  ? CreateGenericAsyncStreamingClient(config)
                  : CreateAsyncClient(config);
     case ClientType::CALLBACK_CLIENT:
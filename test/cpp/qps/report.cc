@@ -25,6 +25,7 @@
 
 #include "src/proto/grpc/testing/report_qps_scenario_service.grpc.pb.h"
 #include "test/cpp/qps/driver.h"
+#include "test/cpp/qps/histogram.h"
 #include "test/cpp/qps/parse_json.h"
 #include "test/cpp/qps/stats.h"
 
@@ -100,6 +101,25 @@ void GprLogReporter::ReportLatency(const ScenarioResult& result) {
           result.summary().latency_95() / 1000,
           result.summary().latency_99() / 1000,
           result.summary().latency_999() / 1000);
+  gpr_log(GPR_INFO,
+          "Latencies from intended start (50/90/95/99/99.9%%-ile): "
+          "%.1f/%.1f/%.1f/%.1f/%.1f us",
+          result.summary().latency_from_intended_start_50() / 1000,
+          result.summary().latency_from_intended_start_90() / 1000,
+          result.summary().latency_from_intended_start_95() / 1000,
+          result.summary().latency_from_intended_start_99() / 1000,
+          result.summary().latency_from_intended_start_999() / 1000);
+  for (const auto& method_latencies : result.method_latencies()) {
+    Histogram histogram;
+    histogram.MergeProto(method_latencies.latencies());
+    gpr_log(GPR_INFO,
+            "Latencies of %s (50/90/95/99/99.9%%-ile): "
+            "%.1f/%.1f/%.1f/%.1f/%.1f us (%.0f calls)",
+            method_latencies.method().c_str(), histogram.Percentile(50) / 1000,
+            histogram.Percentile(90) / 1000, histogram.Percentile(95) / 1000,
+            histogram.Percentile(99) / 1000,
+            histogram.Percentile(99.9) / 1000, histogram.Count());
+  }
 }
 
 void GprLogReporter::ReportTimes(const ScenarioResult& result) {
@@ -116,6 +136,10 @@ void GprLogReporter::ReportTimes(const ScenarioResult& result) {
 void GprLogReporter::ReportCpuUsage(const ScenarioResult& result) {
   gpr_log(GPR_INFO, "Server CPU usage: %.2f%%",
           result.summary().server_cpu_usage());
+  if (result.summary().server_memory_per_channel_bytes() > 0) {
+    gpr_log(GPR_INFO, "Server memory per channel: %.0f bytes",
+            result.summary().server_memory_per_channel_bytes());
+  }
 }
 
 void GprLogReporter::ReportPollCount(const ScenarioResult& result) {
@@ -123,6 +147,8 @@ void GprLogReporter::ReportPollCount(const ScenarioResult& result) {
           result.summary().client_polls_per_request());
   gpr_log(GPR_INFO, "Server Polls per Request: %.2f",
           result.summary().server_polls_per_request());
+  gpr_log(GPR_INFO, "Server Polls per Second: %.2f",
+          result.summary().server_polls_per_second());
 }
 
 void GprLogReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
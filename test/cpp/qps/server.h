@@ -71,6 +71,7 @@ class Server {
     stats.set_total_cpu_time(timer_result.total_cpu_time);
     stats.set_idle_cpu_time(timer_result.idle_cpu_time);
     stats.set_cq_poll_count(poll_count);
+    stats.set_resident_memory_bytes(UsageTimer::ResidentMemoryBytes());
     return stats;
   }
 
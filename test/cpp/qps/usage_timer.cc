@@ -27,6 +27,7 @@
 #ifdef __linux__
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <unistd.h>
 
 static double time_double(struct timeval* tv) {
   return tv->tv_sec + 1e-6 * tv->tv_usec;
@@ -76,6 +77,19 @@ static void get_cpu_usage(unsigned long long* total_cpu_time,
 #endif
 }
 
+unsigned long long UsageTimer::ResidentMemoryBytes() {
+#ifdef __linux__
+  // The second field of /proc/self/statm is the resident set size in pages.
+  std::ifstream proc_statm("/proc/self/statm");
+  unsigned long long size_pages = 0;
+  unsigned long long resident_pages = 0;
+  if (!(proc_statm >> size_pages >> resident_pages)) return 0;
+  return resident_pages * sysconf(_SC_PAGESIZE);
+#else
+  return 0;
+#endif
+}
+
 UsageTimer::Result UsageTimer::Sample() {
   Result r;
   r.wall = Now();
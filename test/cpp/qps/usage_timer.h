@@ -35,6 +35,9 @@ class UsageTimer {
 
   static double Now();
 
+  // Current resident set size of this process, or 0 where unsupported.
+  static unsigned long long ResidentMemoryBytes();
+
  private:
   static Result Sample();
 
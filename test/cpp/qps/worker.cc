@@ -17,6 +17,9 @@
  */
 
 #include <signal.h>
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
 
 #include <chrono>
 #include <thread>
@@ -25,6 +28,7 @@
 #include "absl/flags/flag.h"
 
 #include <grpc/grpc.h>
+#include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
 #include "test/core/util/test_config.h"
@@ -43,6 +47,22 @@ static bool got_sigint = false;
 
 static void sigint_handler(int /*x*/) { got_sigint = true; }
 
+// Scenarios with tens of thousands of channels need one file descriptor per
+// connection, well beyond the default soft limit of most systems.
+static void raise_open_file_limit() {
+#ifdef __linux__
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0 ||
+      limit.rlim_cur == limit.rlim_max) {
+    return;
+  }
+  limit.rlim_cur = limit.rlim_max;
+  if (setrlimit(RLIMIT_NOFILE, &limit) != 0) {
+    gpr_log(GPR_ERROR, "Could not raise open file limit");
+  }
+#endif
+}
+
 namespace grpc {
 namespace testing {
 
@@ -67,6 +87,7 @@ int main(int argc, char** argv) {
   grpc::testing::InitTest(&argc, &argv, true);
 
   signal(SIGINT, sigint_handler);
+  raise_open_file_limit();
 
   grpc::testing::RunServer();
 
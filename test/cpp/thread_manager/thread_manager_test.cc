@@ -24,10 +24,13 @@
 #include <chrono>
 #include <climits>
 #include <memory>
+#include <set>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpcpp/grpcpp.h>
 
@@ -178,6 +181,65 @@ TEST_P(ThreadManagerTest, TestThreadQuota) {
   }
 }
 
+#ifdef GPR_LINUX
+// Records the CPU each PollForWork() call runs on.
+class CpuRecordingThreadManager final : public grpc::ThreadManager {
+ public:
+  explicit CpuRecordingThreadManager(grpc_resource_quota* rq)
+      : ThreadManager("CpuRecordingThreadManager", rq, 1, 2) {}
+
+  WorkStatus PollForWork(void** tag, bool* ok) override {
+    if (num_polls_.fetch_add(1, std::memory_order_relaxed) >= 20) {
+      Shutdown();
+      return SHUTDOWN;
+    }
+    if (gpr_cpu_current_cpu() != 0) ran_off_cpu_.store(true);
+    *tag = nullptr;
+    *ok = true;
+    return WORK_FOUND;
+  }
+  void DoWork(void* /* tag */, bool /*ok*/, bool /*resources*/) override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  bool ran_off_cpu() const { return ran_off_cpu_.load(); }
+
+ private:
+  std::atomic_int num_polls_{0};
+  std::atomic_bool ran_off_cpu_{false};
+};
+
+TEST(ThreadManagerAffinityTest, ThreadsStayOnAssignedCpus) {
+  grpc_resource_quota* rq = grpc_resource_quota_create("Affinity test");
+  CpuRecordingThreadManager tm(rq);
+  grpc_resource_quota_unref(rq);
+  tm.SetCpuAffinity({0});
+  tm.Initialize();
+  tm.Wait();
+  EXPECT_FALSE(tm.ran_off_cpu());
+}
+#endif  // GPR_LINUX
+
+TEST(ThreadManagerNumaTest, ParsesCpuLists) {
+  EXPECT_EQ(grpc::ThreadManager::ParseCpuList("0-3,8,10-11\n"),
+            std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(grpc::ThreadManager::ParseCpuList("5"), std::vector<int>({5}));
+  EXPECT_TRUE(grpc::ThreadManager::ParseCpuList("").empty());
+  EXPECT_TRUE(grpc::ThreadManager::ParseCpuList("3-1").empty());
+  EXPECT_TRUE(grpc::ThreadManager::ParseCpuList("1-").empty());
+  EXPECT_TRUE(grpc::ThreadManager::ParseCpuList("a").empty());
+}
+
+TEST(ThreadManagerNumaTest, NodesCoverDistinctCpus) {
+  std::vector<std::vector<int>> nodes = grpc::ThreadManager::NumaNodeCpus();
+  ASSERT_FALSE(nodes.empty());
+  std::set<int> seen;
+  for (const std::vector<int>& cpus : nodes) {
+    EXPECT_FALSE(cpus.empty());
+    for (int cpu : cpus) EXPECT_TRUE(seen.insert(cpu).second) << cpu;
+  }
+}
+
 }  // namespace
 }  // namespace grpc
 
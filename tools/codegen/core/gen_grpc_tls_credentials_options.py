@@ -160,7 +160,16 @@ _DATA_MEMBERS = [
         setter_move_semantics=True,
         test_name="DifferentCrlDirectory",
         test_value_1="\"crl_directory_1\"",
-        test_value_2="\"crl_directory_2\"")
+        test_value_2="\"crl_directory_2\""),
+    DataMember(
+        name='verification_cache_size',
+        type='size_t',
+        default_initializer='0',
+        setter_comment=
+        ' The number of verified peer certificate chains to remember, so that a peer that reconnects is not verified again. Entries expire with the chain and after at most an hour. 0 disables the cache. Not used when CRL checking is enabled. Only supported for OpenSSL version >= 1.1.',
+        test_name="DifferentVerificationCacheSize",
+        test_value_1="0",
+        test_value_2="100")
 ]
 
 
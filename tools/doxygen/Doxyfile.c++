@@ -1042,8 +1042,10 @@ include/grpcpp/support/client_callback.h \
 include/grpcpp/support/client_interceptor.h \
 include/grpcpp/support/config.h \
 include/grpcpp/support/interceptor.h \
+include/grpcpp/support/lazy_message.h \
 include/grpcpp/support/message_allocator.h \
 include/grpcpp/support/method_handler.h \
+include/grpcpp/support/proto_arena_message_allocator.h \
 include/grpcpp/support/proto_buffer_reader.h \
 include/grpcpp/support/proto_buffer_writer.h \
 include/grpcpp/support/server_callback.h \
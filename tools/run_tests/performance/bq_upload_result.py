@@ -124,6 +124,8 @@ def _flatten_result_inplace(scenario_result):
     scenario_result['scenario']['serverConfig'] = json.dumps(
         scenario_result['scenario']['serverConfig'])
     scenario_result['latencies'] = json.dumps(scenario_result['latencies'])
+    scenario_result['latenciesFromIntendedStart'] = json.dumps(
+        scenario_result.get('latenciesFromIntendedStart', {}))
     scenario_result['serverCpuStats'] = []
     for stats in scenario_result['serverStats']:
         scenario_result['serverCpuStats'].append(dict())
@@ -133,6 +135,8 @@ def _flatten_result_inplace(scenario_result):
             'idleCpuTime', None)
     for stats in scenario_result['clientStats']:
         stats['latencies'] = json.dumps(stats['latencies'])
+        stats['latenciesFromIntendedStart'] = json.dumps(
+            stats.get('latenciesFromIntendedStart', {}))
         stats.pop('requestResults', None)
     scenario_result['serverCores'] = json.dumps(scenario_result['serverCores'])
     scenario_result['clientSuccess'] = json.dumps(
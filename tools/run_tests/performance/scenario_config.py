@@ -315,6 +315,26 @@ class CXXLanguage(Language):
             server_threads_per_cq=1,
             categories=[SCALABLE])
 
+        # Many long-lived, mostly idle streams spread over a large number of
+        # connections, as seen by a frontend serving a big fleet of clients.
+        # The offered load is kept low so that the results are dominated by
+        # the per-connection cost: see server_memory_per_channel_bytes,
+        # server_polls_per_second and server_cpu_usage in the summary.
+        for channels, outstanding in [(10000, 10000), (10000, 100000),
+                                      (50000, 100000)]:
+            yield _ping_pong_scenario(
+                'cpp_protobuf_async_streaming_idle_%d_channels_%d_streams' %
+                (channels, outstanding),
+                rpc_type='STREAMING',
+                client_type='ASYNC_CLIENT',
+                server_type='ASYNC_SERVER',
+                unconstrained_client='async',
+                outstanding=outstanding,
+                channels=channels,
+                offered_load=1000,
+                secure=False,
+                categories=[SWEEP])
+
         for secure in [True, False]:
             secstr = 'secure' if secure else 'insecure'
             smoketest_categories = ([SMOKETEST] if secure else [])